@@ -1,7 +1,7 @@
 /*
 	AimObject.cpp
 	20260212  hanaue sho
-	GCɓGɑ_IuWFNg
+	エイム中に敵に狙いをつけるオブジェクト
 */
 #include "AimObject.h"
 #include "ColliderComponent.h"
@@ -15,7 +15,7 @@ void AimObject::Init()
 {
 	GameObject::Init();
 
-	// RC_[
+	// コライダー
 	auto* col = AddComponent<Collider>();
 	float range = 200.0f;
 	col->SetCapsule(10, range);
@@ -27,7 +27,7 @@ void AimObject::Init()
 	auto* state = AddComponent<AimStateManagerComponent>();
 	state->Init();
 
-	// eݒ
+	// 親設定
 	GameObject* pCamera = Manager::GetScene()->GetGameObject<Camera>();
 	Transform()->SetParent(pCamera->Transform());
 
@@ -1,7 +1,7 @@
 /*
 	AimObject.h
 	20260212  hanaue sho
-	GCɓGɑ_IuWFNg
+	エイム中に敵に狙いをつけるオブジェクト
 */
 #ifndef AIMOBJECT_H_
 #define AIMOBJECT_H_
@@ -26,7 +26,7 @@ void AimStateManagerComponent::OnTriggerEnter(Collider* me, Collider* other)
 	{
 		if (other->Owner()->Tag() == "Target")
 		{
-			printf("uTargetɂ܂v\n");
+			printf("「Targetにあたりました」\n");
 			m_Targets.push_back(other->Owner());
 		}
 	}
@@ -42,7 +42,7 @@ void AimStateManagerComponent::OnTriggerExit(Collider* me, Collider* other)
 	{
 		if (other->Owner()->Tag() == "Target")
 		{
-			printf("uTargetO܂v\n");
+			printf("「Targetから外れました」\n");
 			m_Targets.erase(std::remove(m_Targets.begin(), m_Targets.end(), other->Owner()), m_Targets.end());
 		}
 	}
@@ -27,7 +27,7 @@ struct ScaleKey
 	Vector3 value;
 };
 
-// ԓɎg͖gpOK
+// 補間等に使うが今は未使用でOK
 struct KeyFrame
 {
 	float time;
@@ -38,7 +38,7 @@ struct KeyFrame
 
 struct BoneTrack
 {
-	int boneIndex; // Skelton ̃{[ԍ
+	int boneIndex; // Skelton 内のボーン番号
 	std::vector<TranslationKey> translationKeys;
 	std::vector<RotationKey>	rotationKeys;
 	std::vector<ScaleKey>		scaleKeys;
@@ -47,7 +47,7 @@ struct BoneTrack
 struct AnimationClip
 {
 	std::string			   name;
-	float				   duration; // Aj[VŜ̎
+	float				   duration; // アニメーション全体の時間
 	float				   ticksPerSecond;
 	std::vector<BoneTrack> tracks;
 };
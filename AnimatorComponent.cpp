@@ -7,19 +7,19 @@
 #include "AnimatorController.h"
 #include "Renderer.h"
 
-#pragma comment (lib, "assimp-vc143-mt.lib") // CuN
-#include "assimp/scene.h"	    // assimp ̒ԕ\̍\̒`
-#include "assimp/postprocess.h" // |XgvZXtO̒`
-#include "assimp/Importer.hpp"  // Impoeterp
+#pragma comment (lib, "assimp-vc143-mt.lib") // ライブラリリンク
+#include "assimp/scene.h"	    // assimp の中間表現の構造体定義
+#include "assimp/postprocess.h" // ポストプロセスフラグの定義
+#include "assimp/Importer.hpp"  // Impoeter専用
 
 namespace
 {
-	// BoneTrack 烍[Js
+	// BoneTrack からローカル行列を作る
 	Vector3 SampleTranslation(const BoneTrack& track, float time)
 	{
 		if (track.translationKeys.empty()) return Vector3(0, 0, 0);
 
-		// Ƃ肠 timeȉōő̃L[T
+		// とりあえず time以下で最大のキーを探す
 		const TranslationKey* prev = &track.translationKeys[0];
 		for (size_t i = 1; i < track.translationKeys.size(); i++)
 		{
@@ -32,7 +32,7 @@ namespace
 	{
 		if (track.rotationKeys.empty()) return Quaternion::Identity();
 
-		// Ƃ肠 timeȉōő̃L[T
+		// とりあえず time以下で最大のキーを探す
 		const RotationKey* prev = &track.rotationKeys[0];
 		for (size_t i = 1; i < track.rotationKeys.size(); i++)
 		{
@@ -45,7 +45,7 @@ namespace
 	{
 		if (track.scaleKeys.empty()) return Vector3(1, 1, 1);
 
-		// Ƃ肠 timeȉōő̃L[T
+		// とりあえず time以下で最大のキーを探す
 		const ScaleKey* prev = &track.scaleKeys[0];
 		for (size_t i = 1; i < track.scaleKeys.size(); i++)
 		{
@@ -54,7 +54,7 @@ namespace
 		}
 		return prev->value;
 	}
-	// ݖgp
+	// ※現在未使用
 	void ExtractBindTRS(const Matrix4x4& M, Vector3& outT, Matrix4x4& outR, Vector3& outS)
 	{
 		outT = Vector3(M.m[3][0], M.m[3][1], M.m[3][2]);
@@ -87,7 +87,7 @@ namespace
 
 void AnimatorComponent::AdvanceTime(float dt, const AnimationClip& clip, bool loop, float& inoutTime)
 {
-	// ԍXV
+	// 時間更新
 	inoutTime += dt * m_Speed;
 	if (clip.duration > 0.0f)
 	{
@@ -111,17 +111,17 @@ void AnimatorComponent::EvaluateLocalPose(const AnimationClip& clip, float time,
 	const int boneCount = (int)bones.size();
 
 	outLocalPose.resize(boneCount);
-	// Sm[h bindLocal ŏ
+	// 全ノードを bindLocal で初期化
 	for (int i = 0; i < boneCount; i++)
 		outLocalPose[i] = bones[i].bindLocal;
 
-	// Clip  BoneTrack ŏ㏑
+	// Clip の BoneTrack で上書き
 	for (const BoneTrack& track : clip.tracks)
 	{
 		int idx = track.boneIndex;
 		if (idx < 0 || idx >= (int)boneCount) continue;
 
-		// L[bindg
+		// キーが無い成分はbindを使う
 		Vector3 t   = track.translationKeys.empty() ? bones[idx].bindT			  : SampleTranslation(track, time);
 		Vector3 s   = track.scaleKeys.empty()		? bones[idx].bindS			  : SampleScale(track, time);
 		Matrix4x4 r = track.rotationKeys.empty()	? bones[idx].bindR.ToMatrix() : SampleRotation(track, time).normalized().ToMatrix();
@@ -138,7 +138,7 @@ void AnimatorComponent::EvaluateLocalPoseTRS(const AnimationClip& clip, float ti
 	const int boneCount = (int)bones.size();
 
 	outLocalPose.resize(boneCount);
-	// Sm[h bindLocal ŏ
+	// 全ノードを bindLocal で初期化
 	for (int i = 0; i < boneCount; i++)
 	{
 		outLocalPose[i].Translation = bones[i].bindT;
@@ -146,13 +146,13 @@ void AnimatorComponent::EvaluateLocalPoseTRS(const AnimationClip& clip, float ti
 		outLocalPose[i].Scale		= bones[i].bindS;
 	}
 
-	// Clip  BoneTrack ŏ㏑
+	// Clip の BoneTrack で上書き
 	for (const BoneTrack& track : clip.tracks)
 	{
 		int idx = track.boneIndex;
 		if (idx < 0 || idx >= (int)boneCount) continue;
 
-		// L[bindg
+		// キーが無い成分はbindを使う
 		Vector3 t = track.translationKeys.empty() ? bones[idx].bindT : SampleTranslation(track, time);
 		Vector3 s = track.scaleKeys.empty() ? bones[idx].bindS : SampleScale(track, time);
 		Quaternion r = track.rotationKeys.empty() ? bones[idx].bindR : SampleRotation(track, time).normalized();
@@ -170,7 +170,7 @@ void AnimatorComponent::EvaluateBindPose(std::vector<Matrix4x4>& outLocalPose)
 	const int boneCount = (int)bones.size();
 
 	outLocalPose.resize(boneCount);
-	// Sm[h bindLocal ŏ
+	// 全ノードを bindLocal で初期化
 	for (int i = 0; i < boneCount; i++)
 		outLocalPose[i] = bones[i].bindLocal;
 }
@@ -182,7 +182,7 @@ void AnimatorComponent::EvaluateBindPoseTRS(std::vector<LocalTRS>& outLocalPose)
 	const int boneCount = (int)bones.size();
 
 	outLocalPose.resize(boneCount);
-	// Sm[h bindLocal ŏ
+	// 全ノードを bindLocal で初期化
 	for (int i = 0; i < boneCount; i++)
 	{
 		outLocalPose[i].Translation = bones[i].bindT;
@@ -197,26 +197,26 @@ void AnimatorComponent::BuildModelAndSkinFromLocalTRS()
 	const auto& bones = skeleton.bones;
 	const int boneCount = (int)bones.size();
 
-	// TRS  Matrix4x4 
+	// TRS から Matrix4x4 へ
 	m_LocalPoseOut.resize(boneCount);
 	for (int i = 0; i < boneCount; i++)
 	{
-		// s֕ϊ
+		// 行列へ変換
 		m_LocalPoseOut[i] = Matrix4x4::CreateTRS(m_TRS_LocalPoseOut[i].Translation, m_TRS_LocalPoseOut[i].Rotation.ToMatrix(), m_TRS_LocalPoseOut[i].Scale);
 	}
 
 	m_ModelPose.resize(boneCount);
 	m_SkinMatrixes.resize(boneCount);
-	// m[hKwŃ[hp\z
+	// ノード階層でワールド姿勢を構築
 	for (int i = 0; i < boneCount; i++)
 	{
 		int parent = bones[i].parent;
-		if (parent < 0) // [g{[F[J[h
+		if (parent < 0) // ルートボーン：ローカル＝ワールド
 			m_ModelPose[i] = m_LocalPoseOut[i];
-		else // [J~e
+		else // ローカル×親
 			m_ModelPose[i] = m_LocalPoseOut[i] * m_ModelPose[parent];
 	}
-	// {[XLsɗƂibVԁ{[ԁ{[[hj
+	// ボーンだけスキン行列に落とす（メッシュ空間→ボーン空間→ボーンワールド）
 	for (int i = 0; i < boneCount; i++)
 	{
 		m_SkinMatrixes[i] = bones[i].invBindPose * m_ModelPose[i];
@@ -233,7 +233,7 @@ void AnimatorComponent::EvaluateNow()
 	if (boneCount <= 0) return;
 
 	m_TRS_LocalPoseOut.resize(boneCount);
-	// NbvȂ
+	// クリップがない
 	if (!m_ClipCurrent)
 	{
 		m_ModelPose.resize(boneCount);
@@ -252,36 +252,36 @@ void AnimatorComponent::EvaluateNow()
 		}
 		return;
 	}
-	else // Nbv
+	else // クリップがある
 	{
-		// 0b_̎pɂ
+		// 0秒時点の姿勢にする
 		EvaluateLocalPoseTRS(*m_ClipCurrent, 0.0f, m_TRS_LocalPoseOut);
 	}
 
-	// TRS  Matrix4x4 
+	// TRS から Matrix4x4 へ
 	m_LocalPoseOut.resize(boneCount);
 	for (int i = 0; i < boneCount; i++)
 	{
-		// s֕ϊ
+		// 行列へ変換
 		m_LocalPoseOut[i] = Matrix4x4::CreateTRS(m_TRS_LocalPoseOut[i].Translation, m_TRS_LocalPoseOut[i].Rotation.ToMatrix(), m_TRS_LocalPoseOut[i].Scale);
 	}
 
 	m_ModelPose.resize(boneCount);
 	m_SkinMatrixes.resize(boneCount);
-	// m[hKwŃ[hp\z
+	// ノード階層でワールド姿勢を構築
 	for (int i = 0; i < boneCount; i++)
 	{
 		int parent = bones[i].parent;
-		if (parent < 0) // [g{[F[J[h
+		if (parent < 0) // ルートボーン：ローカル＝ワールド
 			m_ModelPose[i] = m_LocalPoseOut[i];
-		else // [J~e
+		else // ローカル×親
 			m_ModelPose[i] = m_LocalPoseOut[i] * m_ModelPose[parent];
 	}
-	// {[XLsɗƂibVԁ{[ԁ{[[hj
+	// ボーンだけスキン行列に落とす（メッシュ空間→ボーン空間→ボーンワールド）
 	for (int i = 0; i < boneCount; i++)
 	{
 		m_SkinMatrixes[i] = bones[i].invBindPose * m_ModelPose[i];
-		//m_SkinMatrixes[i].identity(); // fobOp
+		//m_SkinMatrixes[i].identity(); // デバッグ用
 	}
 }
 
@@ -295,36 +295,36 @@ void AnimatorComponent::Update(float dt)
 	if (boneCount == 0) return;
 
 	// ==================================================
-	// ----- uh -----
+	// ----- ブレンド分岐 -----
 	// ==================================================
 	// --------------------------------------------------
-	// NXtF[h
+	// クロスフェード中
 	// --------------------------------------------------
-	if (m_IsBlending && m_ClipNext) // uh
+	if (m_IsBlending && m_ClipNext) // ブレンド中
 	{
 		const auto& clipNext = *m_ClipNext;
 
-		// Ԍo
+		// 時間経過
 		m_BlendElapsed += dt;
 		float alpha = (m_BlendDuration <= 0) ? 1 : Vector3::Clamp(m_BlendElapsed / m_BlendDuration, 0.0f, 1.0f);
 
-		// ----- B̕] -----
-		// ԍXV
+		// ----- B側の評価 -----
+		// 時間更新
 		AdvanceTime(dt, clipNext, m_LoopNext, m_TimeNext);
-		// Aj[Ṽ|[Y]
+		// アニメーションのポーズ評価
 		EvaluateLocalPoseTRS(clipNext, m_TimeNext, m_TRS_LocalPoseB);
 
-		// ----- A̕] -----
+		// ----- A側の評価 -----
 		if (m_FadeFromSnapshot)
 		{
-			// XibvVbĝ܂Aɂ
+			// スナップショットをそのままAにする
 			if ((int)m_TRS_FadeFromPose.size() != boneCount)
 				m_TRS_FadeFromPose.resize(boneCount);
 			m_TRS_LocalPoseA = m_TRS_FadeFromPose;
 		}
 		else
 		{
-			// NbvA A 
+			// クリップAから A を作る
 			if (!m_ClipCurrent) return;
 			const auto& clipCurrent = *m_ClipCurrent;
 			AdvanceTime(dt, clipCurrent, m_LoopCurrent, m_TimeCurrent);
@@ -332,7 +332,7 @@ void AnimatorComponent::Update(float dt)
 		}
 
 
-		// ----- A/B uh out  -----
+		// ----- A/B をブレンドして out を作る -----
 		m_TRS_LocalPoseOut.resize(boneCount);
 		m_LocalPoseOut.resize(boneCount);
 		for (int i = 0; i < boneCount; i++)
@@ -340,29 +340,29 @@ void AnimatorComponent::Update(float dt)
 			m_TRS_LocalPoseOut[i].Translation = Vector3::Lerp(m_TRS_LocalPoseA[i].Translation, m_TRS_LocalPoseB[i].Translation, alpha);
 			m_TRS_LocalPoseOut[i].Rotation    = Quaternion::NlerpShortest(m_TRS_LocalPoseA[i].Rotation, m_TRS_LocalPoseB[i].Rotation, alpha);
 			m_TRS_LocalPoseOut[i].Scale		  = Vector3::Lerp(m_TRS_LocalPoseA[i].Scale, m_TRS_LocalPoseB[i].Scale, alpha);
-			// s֕ϊ
+			// 行列へ変換
 			m_LocalPoseOut[i] = Matrix4x4::CreateTRS(m_TRS_LocalPoseOut[i].Translation, m_TRS_LocalPoseOut[i].Rotation.ToMatrix(), m_TRS_LocalPoseOut[i].Scale);
 		}
 
 		m_ModelPose.resize(boneCount);
 		m_SkinMatrixes.resize(boneCount);
-		// m[hKwŃ[hp\z
+		// ノード階層でワールド姿勢を構築
 		for (int i = 0; i < boneCount; i++)
 		{
 			int parent = bones[i].parent;
-			if (parent < 0) // [g{[F[J[h
+			if (parent < 0) // ルートボーン：ローカル＝ワールド
 				m_ModelPose[i] = m_LocalPoseOut[i];
-			else // [J~e
+			else // ローカル×親
 				m_ModelPose[i] = m_LocalPoseOut[i] * m_ModelPose[parent];
 		}
 
-		// {[XLsɗƂibVԁ{[ԁ{[[hj
+		// ボーンだけスキン行列に落とす（メッシュ空間→ボーン空間→ボーンワールド）
 		for (int i = 0; i < boneCount; i++)
 		{
 			m_SkinMatrixes[i] = bones[i].invBindPose * m_ModelPose[i];
 		}
 
-		// uhI
+		// ブレンド終了判定
 		if (m_BlendElapsed >= m_BlendDuration)
 		{
 			m_IsBlending = false;
@@ -376,24 +376,24 @@ void AnimatorComponent::Update(float dt)
 		return;
 	}
 	// --------------------------------------------------
-	// AnimatorController ̏펞uh
+	// AnimatorController の常時ブレンド
 	// --------------------------------------------------
 	if (m_Controller && m_IsLocomotion)
 	{
 		const Blend1DResult r = m_Controller->EvaluateLocomotion(m_BlendParam);
 		if (r.IsValid())
 		{
-			// ԍXV
+			// 時間更新
 			AdvanceTime(dt, *r.clipA, r.loopA, m_TimeA);
 			AdvanceTime(dt, *r.clipB, r.loopB, m_TimeB);
 		 
-			// Aj[Ṽ|[Y]
+			// アニメーションのポーズ評価
 			EvaluateLocalPoseTRS(*r.clipA, m_TimeA, m_TRS_LocalPoseA);
 			EvaluateLocalPoseTRS(*r.clipB, m_TimeB, m_TRS_LocalPoseB);
 
 			const float alpha = Vector3::Clamp(r.alpha, 0.0f, 1.0f);
 
-			// Ńuh
+			// ここでブレンド処理
 			m_TRS_LocalPoseOut.resize(boneCount);
 			m_LocalPoseOut.resize(boneCount);
 			for (int i = 0; i < boneCount; i++)
@@ -401,22 +401,22 @@ void AnimatorComponent::Update(float dt)
 				m_TRS_LocalPoseOut[i].Translation = Vector3::Lerp(m_TRS_LocalPoseA[i].Translation, m_TRS_LocalPoseB[i].Translation, alpha);
 				m_TRS_LocalPoseOut[i].Rotation = Quaternion::NlerpShortest(m_TRS_LocalPoseA[i].Rotation, m_TRS_LocalPoseB[i].Rotation, alpha);
 				m_TRS_LocalPoseOut[i].Scale = Vector3::Lerp(m_TRS_LocalPoseA[i].Scale, m_TRS_LocalPoseB[i].Scale, alpha);
-				// s֕ϊ
+				// 行列へ変換
 				m_LocalPoseOut[i] = Matrix4x4::CreateTRS(m_TRS_LocalPoseOut[i].Translation, m_TRS_LocalPoseOut[i].Rotation.ToMatrix(), m_TRS_LocalPoseOut[i].Scale);
 			}
 
 			m_ModelPose.resize(boneCount);
 			m_SkinMatrixes.resize(boneCount);
-			// m[hKwŃ[hp\z
+			// ノード階層でワールド姿勢を構築
 			for (int i = 0; i < boneCount; i++)
 			{
 				int parent = bones[i].parent;
-				if (parent < 0) // [g{[F[J[h
+				if (parent < 0) // ルートボーン：ローカル＝ワールド
 					m_ModelPose[i] = m_LocalPoseOut[i];
-				else // [J~e
+				else // ローカル×親
 					m_ModelPose[i] = m_LocalPoseOut[i] * m_ModelPose[parent];
 			}
-			// {[XLsɗƂibVԁ{[ԁ{[[hj
+			// ボーンだけスキン行列に落とす（メッシュ空間→ボーン空間→ボーンワールド）
 			for (int i = 0; i < boneCount; i++)
 			{
 				m_SkinMatrixes[i] = bones[i].invBindPose * m_ModelPose[i];
@@ -426,37 +426,37 @@ void AnimatorComponent::Update(float dt)
 	}
 
 	// --------------------------------------------------
-	// PNbv
+	// 単一クリップ中
 	// --------------------------------------------------
 	if (!m_ClipCurrent) return;
 	{
 		const auto& clipCurrent = *m_ClipCurrent;
 
-		// ԍXV
+		// 時間更新
 		AdvanceTime(dt, clipCurrent, m_LoopCurrent, m_TimeCurrent);
 
-		// Aj[Ṽ|[Y]
+		// アニメーションのポーズ評価
 		m_LocalPoseOut.resize(boneCount);
 		EvaluateLocalPoseTRS(clipCurrent, m_TimeCurrent, m_TRS_LocalPoseOut);
 		for (int i = 0; i < boneCount; i++)
 		{
-			// s֕ϊ
+			// 行列へ変換
 			m_LocalPoseOut[i] = Matrix4x4::CreateTRS(m_TRS_LocalPoseOut[i].Translation, m_TRS_LocalPoseOut[i].Rotation.ToMatrix(), m_TRS_LocalPoseOut[i].Scale);
 		}
 
 		m_ModelPose.resize(boneCount);
 		m_SkinMatrixes.resize(boneCount);
 
-		// m[hKwŃ[hp\z
+		// ノード階層でワールド姿勢を構築
 		for (int i = 0; i < boneCount; i++)
 		{
 			int parent = bones[i].parent;
-			if (parent < 0) // [g{[F[J[h
+			if (parent < 0) // ルートボーン：ローカル＝ワールド
 				m_ModelPose[i] = m_LocalPoseOut[i];
-			else // [J~e
+			else // ローカル×親
 				m_ModelPose[i] = m_LocalPoseOut[i] * m_ModelPose[parent];
 		}
-		// {[XLsɗƂibVԁ{[ԁ{[[hj
+		// ボーンだけスキン行列に落とす（メッシュ空間→ボーン空間→ボーンワールド）
 		for (int i = 0; i < boneCount; i++)
 		{
 			m_SkinMatrixes[i] = bones[i].invBindPose * m_ModelPose[i];
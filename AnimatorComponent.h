@@ -12,7 +12,7 @@ struct AnimationClip;
 class Matrix4x4;
 class AnimatorController;
 
-// [JTRS \
+// ローカルTRS 構造体
 struct LocalTRS
 {
 	Vector3 Translation;
@@ -24,82 +24,82 @@ class AnimatorComponent : public Component
 {
 private:
 	// ==================================================
-	// ----- {\vf -----
+	// ----- 基本構成要素 -----
 	// ==================================================
 	// --------------------------------------------------
-	// XPg
+	// スケルトン情報
 	// --------------------------------------------------
 	Skeleton*	   m_Skeleton  = nullptr;
 	// --------------------------------------------------
-	// Aj[VNbv
+	// アニメーションクリップ情報
 	// --------------------------------------------------
 	AnimationClip* m_ClipCurrent = nullptr;
 	AnimationClip* m_ClipNext = nullptr;
 	// --------------------------------------------------
-	// Aj[V̎
+	// アニメーションの時間
 	// --------------------------------------------------
-	float m_TimeCurrent = 0.0f; // Aj[VĐ̎
+	float m_TimeCurrent = 0.0f; // アニメーション再生中の時間
 	float m_TimeNext = 0.0f; 
 	// --------------------------------------------------
-	// [vtO
+	// ループ制御フラグ
 	// --------------------------------------------------
 	bool  m_LoopCurrent = true; 
 	bool  m_LoopNext = true; 
 	// --------------------------------------------------
-	// Đx
+	// 再生速度
 	// --------------------------------------------------
 	float m_Speed = 1.0f;
 	// --------------------------------------------------
-	// uh
+	// ブレンド制御
 	// --------------------------------------------------
 	bool m_IsBlending = false;
 	float m_BlendElapsed = 0.0f;
 	float m_BlendDuration = 0.0f;
 	// ==================================================
-	// ----- R[V -----
+	// ----- ロコモーション制御 -----
 	// ==================================================
 	// --------------------------------------------------
-	// Rg[[
+	// コントローラー
 	// --------------------------------------------------
 	AnimatorController* m_Controller = nullptr;
-	float m_BlendParam = 0.0f; // Rg[[p̑x
-	float m_TimeA = 0.0f; // Blend1D p
-	float m_TimeB = 0.0f; // Blend1D p
+	float m_BlendParam = 0.0f; // コントローラー用の速度
+	float m_TimeA = 0.0f; // Blend1D 用
+	float m_TimeB = 0.0f; // Blend1D 用
 	// --------------------------------------------------
-	// tO
+	// 制御フラグ
 	// --------------------------------------------------
 	bool m_IsLocomotion = true;
 	// ==================================================
-	// ----- NXtF[h -----
+	// ----- クロスフェード制御 -----
 	// ==================================================
 	bool m_FadeFromSnapshot = false;
 	// ==================================================
-	// ----- {[ƂTRS, Matrix -----
+	// ----- ボーンごとのTRS, Matrix -----
 	// ==================================================
 	// --------------------------------------------------
-	// {[Ƃ݂̌̃[Jp
+	// ボーンごとの現在のローカル姿勢
 	// --------------------------------------------------
 	std::vector<LocalTRS> m_TRS_LocalPoseA;
 	std::vector<LocalTRS> m_TRS_LocalPoseB;
 	std::vector<LocalTRS> m_TRS_LocalPoseOut;
-	std::vector<LocalTRS> m_TRS_FadeFromPose; // CrossFadep̃XibvVbg
+	std::vector<LocalTRS> m_TRS_FadeFromPose; // CrossFade用のスナップショット
 	std::vector<Matrix4x4> m_LocalPoseOut;
 	// --------------------------------------------------
-	// {[Ƃ݂̌̍ʎp
+	// ボーンごとの現在の合成結果姿勢
 	// --------------------------------------------------
-	std::vector<Matrix4x4> m_ModelPose; // {[Ƃ݂̌̍ʎp
+	std::vector<Matrix4x4> m_ModelPose; // ボーンごとの現在の合成結果姿勢
 	// --------------------------------------------------
-	// VS ɓŏIs
+	// VS に投げる最終行列
 	// --------------------------------------------------
-	std::vector<Matrix4x4> m_SkinMatrixes; // VS ɓŏIs
+	std::vector<Matrix4x4> m_SkinMatrixes; // VS に投げる最終行列
 public:
 	// ==================================================
-	// ----- p] -----
+	// ----- 姿勢評価 -----
 	// ==================================================
 	void EvaluateNow();
 
 	// ==================================================
-	// ----- Zb^[ -----
+	// ----- セッター -----
 	// ==================================================
 	void SetSkeleton(Skeleton* s)  noexcept { m_Skeleton = s; }
 	void SetClip(AnimationClip* c) noexcept { m_ClipCurrent = c; m_TimeCurrent = 0.0f; }
@@ -110,7 +110,7 @@ public:
 	void SetIsLocomotion(bool b)   noexcept { m_IsLocomotion = b; }
 
 	// ==================================================
-	// ----- ANZT -----
+	// ----- アクセサ -----
 	// ==================================================
 	const std::vector<Matrix4x4>& SkinMatrixes()  const noexcept { return m_SkinMatrixes; }
 	const std::vector<Matrix4x4>& ModelMatrixes() const noexcept { return m_ModelPose; }
@@ -118,7 +118,7 @@ public:
 	int BoneCount() noexcept { return m_Skeleton ? (int)m_Skeleton->bones.size() : 0; }
 
 	// ==================================================
-	// ----- NbvĐ -----
+	// ----- クリップ再生 -----
 	// ==================================================
 	void Play(AnimationClip* c) noexcept 
 	{ 
@@ -148,11 +148,11 @@ public:
 	{
 		if (!clip) return;
 
-		// ݏo͂XibvVbg
+		// 現在出力からスナップショット
 		const int boneCount = (int)m_Skeleton->bones.size();
 		m_TRS_FadeFromPose = m_TRS_LocalPoseOut;
 		if ((int)m_TRS_FadeFromPose.size() != boneCount)
-			m_TRS_FadeFromPose.resize(boneCount); // Ô
+			m_TRS_FadeFromPose.resize(boneCount); // 念のため
 
 		m_IsBlending = true;
 		m_FadeFromSnapshot = true;
@@ -165,19 +165,19 @@ public:
 	}
 
 	// ==================================================
-	// ----- CtTCN -----
+	// ----- ライフサイクル -----
 	// ==================================================
 	void Update(float dt) override;
 
 private:
-	// Ԍo
+	// 時間経過
 	void AdvanceTime(float dt, const AnimationClip& clip, bool loop, float& inoutTime);
-	// |[Y]
+	// ポーズ評価
 	void EvaluateLocalPose(const AnimationClip& clip, float time, std::vector<Matrix4x4>& outLocalPose);
 	void EvaluateLocalPoseTRS(const AnimationClip& clip, float time, std::vector<LocalTRS>& outLocalPose);
 	void EvaluateBindPose(std::vector<Matrix4x4>& outLocalPose);
 	void EvaluateBindPoseTRS(std::vector<LocalTRS>& outLocalPose);
-	// ModelPose  SkinMatrix ̍쐬
+	// ModelPose と SkinMatrix の作成
 	void BuildModelAndSkinFromLocalTRS();
 };
 
@@ -10,19 +10,19 @@ struct AnimationClip;
 
 struct Blend1DNode
 {
-	// Q_uh
+	// ２点ブレンド
 	AnimationClip* clipA = nullptr;
 	AnimationClip* clipB = nullptr;
 
-	// p[^̑Ήl
+	// パラメータの対応値
 	float parameterA = 0.0f;
 	float parameterB = 1.0f;
 	bool loopA = true;
 	bool loopB = true;
 
-	// ĐxĂ悢
+	// 再生速度を持たせてもよい
 
-	// `FbN
+	// 無効チェック
 	bool IsValid() const noexcept
 	{
 		return clipA && clipB && (parameterA - parameterB > 1e-8f);
@@ -36,7 +36,7 @@ struct Blend1DResult
 	bool loopA = true;
 	bool loopB = true;
 
-	// ĐxĂ悢
+	// 再生速度を持たせてもよい
 
 	float alpha = 0.0f;
 	bool IsValid() const noexcept { return clipA && clipB; }
@@ -62,7 +62,7 @@ public:
 			return out;
 		}
 
-		// paramA == paramB ̎̉
+		// paramA == paramB の事故回避
 		const float denom = (m_Locomotion.parameterB - m_Locomotion.parameterA);
 		if (denom == 0.0f)
 		{
@@ -13,7 +13,7 @@
 #include "MeshRendererComponent.h"
 #include "RigidbodyComponent.h"
 #include "Renderer.h"
-#include "Texture.h"  // Texture::Load 
+#include "Texture.h"  // Texture::Load 既存
 
 #include "AppleObject.h"
 #include "Manager.h"
@@ -22,18 +22,18 @@
 
 void AppleGenerator::Init()
 {
-	// 1) Transformi GameObject ctor Œǉς݁j擾ďpĂ
+	// 1) Transform（既に GameObject ctor で追加済み）を取得して初期姿勢を入れておく
 	auto* tf = GetComponent<TransformComponent>();
 	//tf->SetPosition({ 0,0,0 });
 	tf->SetScale({ 2,2,2 });
 	tf->SetEulerAngles({ 0,0,0 });
 	m_BasePosition = tf->Position();
 
-	// 2) MeshFilter ǉĒ_obt@i4_̋`j
+	// 2) MeshFilter を追加して頂点バッファ（4頂点の矩形）を作る
 	auto* mf = AddComponent<MeshFilterComponent>();
 	MeshFactory::CreateApple(mf, { 1, 36, 36 });
 
-	// 3) Material ǉiVF[_/eNX`/}eAj
+	// 3) Material を追加（シェーダ/テクスチャ/マテリアル）
 	auto* mat = AddComponent<MaterialComponent>();
 
 	ID3D11VertexShader* vs = nullptr;
@@ -43,12 +43,12 @@ void AppleGenerator::Init()
 	Renderer::CreatePixelShader(&ps, "shader\\PS_Toon.cso");
 	mat->SetVSPS(vs, ps, il, /*takeVS*/true, /*takePS*/true, /*takeIL*/true);
 
-	// eNX`Zbg
+	// テクスチャセット
 	ID3D11ShaderResourceView* srv = Texture::LoadAndRegisterKey("assets\\texture\\appleTexture.png");
-	// Tv[ Renderer::Init()  0Ԃ PSSetSamplers ς݂Ȃ null ł`
+	// サンプラーは Renderer::Init() で 0番に PSSetSamplers 済みなら null でも描ける
 	mat->SetMainTexture(srv, /*sampler*/nullptr, /*takeSrv*/false, /*takeSamp*/false);
 
-	// }eAZbg
+	// マテリアルセット
 	MaterialApp m{};
 	m.diffuse = Vector4(1, 1, 1, 1);
 	m.ambient = Vector4(1, 1, 1, 1);
@@ -56,13 +56,13 @@ void AppleGenerator::Init()
 	m.textureEnable = TRUE;
 	mat->SetMaterial(m);
 
-	// eNX`̉\̂ŃAt@uh
+	// 透明テクスチャの可能性が高いのでアルファブレンドに
 	mat->SetBlendMode(/*Alpha*/MaterialComponent::BlendMode::Opaque);
 
-	// 4) MeshRenderer ǉi`sWj
+	// 4) MeshRenderer を追加（描画実行係）
 	auto* mr = AddComponent<MeshRendererComponent>();
 
-	// AEgC}eAǉ
+	// アウトラインマテリアル追加
 	auto* matOutline = AddComponent<MaterialComponent>();
 	Renderer::CreateVertexShader(&vs, &il, "shader\\VS_Outline.cso");
 	Renderer::CreatePixelShader(&ps, "shader\\PS_Outline.cso");
@@ -70,7 +70,7 @@ void AppleGenerator::Init()
 	matOutline->SetBlendMode(/*Alpha*/MaterialComponent::BlendMode::Opaque);
 	mr->SetOutlineMaterial(matOutline);
 
-	// C[Zbg
+	// レイヤーセット
 	SetPhysicsLayer(1);
 }
 
@@ -78,7 +78,7 @@ void AppleGenerator::Update(float dt)
 {
 	GameObject::Update(dt);
 
-	// Ԍo
+	// 時間経過
 	m_Timer += dt;
 
 	if (m_Timer > m_Interval)
@@ -92,7 +92,7 @@ void AppleGenerator::Update(float dt)
 		destroy->SetTimer(20.0f);
 	}
 
-	// ړ
+	// 移動
 	m_Radian += dt;
 	if (m_Radian > 3.14f) m_Radian -= 3.14f;
 	Vector3 position = m_BasePosition;
@@ -1,7 +1,7 @@
 /*
     AudioBank.cpp
     20251002  hanaue sho
-    ܂Ƃ߂ĕۊǂ
+    音源をまとめて保管する役割
 */
 #include "AudioBank.h"
 #include <cstring> // strcmp
@@ -20,7 +20,7 @@ std::string AudioBank::NormalizePathKey(const char* path) {
 
 bool AudioBank::IsWaveExt(const std::string& path)
 {
-    //  '.' T
+    // 末尾の '.' を探す
     int dot = -1;
     for (int i = (int)path.size() - 1; i >= 0; i--)
     {
@@ -41,7 +41,7 @@ int AudioBank::PinDirectoryImpl(const std::string& dirNormalized, bool recursive
     (void)recursive;
     return 0;
 #else
-    // WinAPI p '\' ؂
+    // WinAPI 用に '\' 区切りへ
     std::string winPath = dirNormalized;
     for (auto& ch : winPath) if (ch == '/') ch = '\\';
     if (!winPath.empty() && winPath.back() != '\\') winPath.push_back('\\');
@@ -59,7 +59,7 @@ int AudioBank::PinDirectoryImpl(const std::string& dirNormalized, bool recursive
         if (std::strcmp(nameA, ".") == 0 || std::strcmp(nameA, "..") == 0) continue;
 
         std::string child = winPath + nameA;
-        // K
+        // 正規化
         for (auto& ch : child) if (ch == '\\') ch = '/';
 
         const DWORD attrs = fda.dwFileAttributes;
@@ -86,10 +86,10 @@ bool AudioBank::Pin(const char* path)
     if (!path) return false;
     const std::string key = NormalizePathKey(path);
 
-    // Ƀsς݂ȂOK
+    // 既にピン済みならOK
     if (s_Pinned.find(key) != s_Pinned.end()) return true;
 
-    // ǂݍ
+    // 読み込み
     auto clip = AudioClip::Load(key.c_str());
     if (!clip) return false;
 
@@ -105,7 +105,7 @@ std::shared_ptr<AudioClip> AudioBank::Get(const char* path)
     auto it = s_Pinned.find(key);
     if (it != s_Pinned.end()) return it->second;
 
-    // sł擾
+    // 未ピンでも取得する
     return AudioClip::Load(key.c_str());
 }
 
@@ -126,7 +126,7 @@ int AudioBank::PinDirectory(const char* dirPath, bool recursive)
 #ifndef _WIN32
     (void)dirPath;
     (void)recursive;
-    return 0; // Windows ȊO͖Ή
+    return 0; // Windows 以外は未対応
 #else
     if (!dirPath) return 0;
     std::string dir = NormalizePathKey(dirPath);
@@ -1,7 +1,7 @@
 /*
 	AudioBank.h
 	20251001  hanaue sho
-	܂Ƃ߂ĕۊǂiAudioClipǗj
+	音源をまとめて保管する役割（複数のAudioClipを管理）
 */
 #ifndef AUDIOBANK_H_
 #define AUDIOBANK_H_
@@ -15,60 +15,60 @@ class AudioBank
 {
 private:
 	// ==================================================
-	// {̗vf
+	// 本体要素
 	// ==================================================
 	// --------------------------------------------------
-	// ǂݍ񂾉̃v[
+	// 読み込んだ音源のプール
 	// --------------------------------------------------
 	static std::unordered_map<std::string, std::shared_ptr<AudioClip>> s_Pinned;
 
 	// ==================================================
-	// wp
+	// ヘルパ
 	// ==================================================
 	// --------------------------------------------------
-	// pX̐K
+	// パスの正規化
 	// --------------------------------------------------
 	static std::string NormalizePathKey(const char* path);
 	// --------------------------------------------------
-	// .wav ̔
+	// .wav の判定
 	// --------------------------------------------------
 	static bool IsWaveExt(const std::string& path);
 	// --------------------------------------------------
-	// fBNg
+	// ディレクトリ走査
 	// --------------------------------------------------
 	static int PinDirectoryImpl(const std::string& dirNormalized, bool recursive);
 
 public:
 	// --------------------------------------------------
-	// [h
+	// 音源をロード
 	// --------------------------------------------------
 	static bool Pin(const char* path);
 	// --------------------------------------------------
-	// ̎擾
-	// sς݂Ȃ炻Ԃ
-	// sȂ炻̏ AudioClip::Load() Ŏ擾iێ͂Ȃj
+	// 音源の取得
+	// ピン済みならそれを返す
+	// 未ピンならその場で AudioClip::Load() で取得（保持はしない）
 	// --------------------------------------------------
 	static std::shared_ptr<AudioClip> Get(const char* path);
 	// --------------------------------------------------
-	// s̉
-	// ŋLĂꍇ͎c
+	// ピンの解放
+	// 他で共有されている場合は残る
 	// --------------------------------------------------
 	static void Unpin(const char* path);
 	// --------------------------------------------------
-	// s̏ԊmF
+	// ピンの状態確認
 	// --------------------------------------------------
 	static bool IsPinned(const char* path);
 	// --------------------------------------------------
-	// w肵fBNgz܂Ƃ߂ăs
+	// 指定したディレクトリ配下をまとめてピン
 	// --------------------------------------------------
 	static int PinDirectory(const char* dirPath, bool recursive = true);
 
 	// ==================================================
-	// CtTCN
+	// ライフサイクル
 	// ==================================================
 	// --------------------------------------------------
-	// I
-	// Sĉ
+	// 終了処理
+	// 全て解除
 	// --------------------------------------------------
 	static void Clear();
 
@@ -1,7 +1,7 @@
 /*
 	AudioClip.cpp
 	20251001  hanaue sho
-	f[^
+	音源データ
 */
 #include "AudioClip.h"
 #include <fstream>
@@ -9,7 +9,7 @@
 #include <cassert>
 
 // --------------------------------------------------
-// {
+// 本体
 // --------------------------------------------------
 std::unordered_map<std::string, std::weak_ptr<AudioClip>> AudioClip::s_Pool;
 
@@ -35,12 +35,12 @@ std::shared_ptr<AudioClip> AudioClip::Load(const char* path)
 	if (!path) return nullptr;
 	const std::string key = NormalizePathKey(path);
 
-	// v[ėp
+	// プール再利用
 	auto it = s_Pool.find(key);
 	if (it != s_Pool.end())
 	{
 		if (auto sp = it->second.lock()) return sp;
-		s_Pool.erase(it); // ؂ weak_ptr 폜
+		s_Pool.erase(it); // 期限切れの weak_ptr を削除
 	}
 	auto clip = LoadInternal(key);
 	if (clip) s_Pool[key] = clip;
@@ -52,14 +52,14 @@ std::shared_ptr<AudioClip> AudioClip::LoadInternal(const std::string& normPath)
 	std::ifstream f(normPath, std::ios::binary);
 	if (!f) return nullptr;
 
-	// ----- RIFF/WAVE wb_ -----
+	// ----- RIFF/WAVE ヘッダ -----
 	char riff[4]; f.read(riff, 4); // "RIFF"
 	if (f.gcount() != 4 || std::strncmp(riff, "RIFF", 4) != 0) return nullptr;
-	(void)ReadU32LE(f);			   // fileSize(gp)
+	(void)ReadU32LE(f);			   // fileSize(未使用)
 	char wave[4]; f.read(wave, 4); // "WAVE"
 	if (f.gcount() != 4 || std::strncmp(wave, "WAVE", 4) != 0) return nullptr;
 
-	// ----- `N(fmt / data T) -----
+	// ----- チャンク走査(fmt / data を探す) -----
 	WAVEFORMATEX wf{}; 
 	bool hasFmt = false;
 	bool hasData = false;
@@ -72,10 +72,10 @@ std::shared_ptr<AudioClip> AudioClip::LoadInternal(const std::string& normPath)
 
 		if (std::strncmp(id, "fmt ", 4) == 0)
 		{
-			// Œł PCM  WAVEFORMAT ͂PUoCg
+			// 最低でも PCM の WAVEFORMAT は１６バイト
 			if (size < 16) return nullptr;
 
-			// tH[}bg̊b
+			// フォーマットの基礎部
 			wf.wFormatTag	   = ReadU16LE(f);
 			wf.nChannels	   = ReadU16LE(f);
 			wf.nSamplesPerSec  = ReadU32LE(f);
@@ -83,14 +83,14 @@ std::shared_ptr<AudioClip> AudioClip::LoadInternal(const std::string& normPath)
 			wf.nBlockAlign     = ReadU16LE(f);
 			wf.wBitsPerSample  = ReadU16LE(f);
 
-			// ]icsize jXLbv
+			// 余り（csize 分）をスキップ
 			if (size > 16)
 			{
 				uint16_t cbSize = ReadU16LE(f);
 				wf.cbSize = cbSize;
 				f.seekg(cbSize, std::ios::cur);
 			}
-			// Ή͈́FPCM(1)  IEEE_FLOAT(3) ̂
+			// 対応範囲：PCM(1) と IEEE_FLOAT(3) のみ
 			if (!(wf.wFormatTag == WAVE_FORMAT_PCM || wf.wFormatTag == WAVE_FORMAT_IEEE_FLOAT))
 				return nullptr;
 
@@ -98,27 +98,27 @@ std::shared_ptr<AudioClip> AudioClip::LoadInternal(const std::string& normPath)
 		}
 		else if (std::strncmp(id, "data", 4) == 0)
 		{
-			// f[^{
+			// データ本体
 			pcm.resize(size);
 			if (!f.read(reinterpret_cast<char*>(pcm.data()), size)) return nullptr;
 			hasData = true;
 		}
 		else
 		{
-			// gȂ`N͓ǂݔ΂(pad ΍˂)
+			// 使わないチャンクは読み飛ばす(pad 対策も兼ねて)
 			f.seekg(size, std::ios::cur);
 		}
 
-		// `N͋EɃpfBO邱Ƃ
+		// チャンクは偶数境界にパディングされることがある
 		if (size & 1) f.seekg(1, std::ios::cur);
 	}
 
 	if (!(hasFmt && hasData)) return nullptr;
 
-	// ŏo[WFBlockAlign ƃf[^
+	// 最小バージョン：BlockAlign とデータ長
 	if (wf.nBlockAlign == 0 || (pcm.size() % wf.nBlockAlign) != 0) return nullptr;
 
-	// 
+	// 完成
 	auto clip = std::make_shared<AudioClip>();
 	clip->m_Format = wf;
 	clip->m_PCM    = std::move(pcm);
@@ -1,7 +1,7 @@
 /*
 	AudioClip.h
 	20251001  hanaue sho
-	f[^iPj
+	音源データ（単一）
 */
 #ifndef AUDIOCLIP_H_
 #define AUDIOCLIP_H_
@@ -24,38 +24,38 @@ class AudioClip
 {
 private:
 	// ==================================================
-	// {̗vf
+	// 本体要素
 	// ==================================================
 	// --------------------------------------------------
-	// g`ǂ̂悤ɉ߂邩Ƃ^ij
-	// `A`lATv[gAʎqrbg
+	// 波形をどのように解釈するかというメタ情報（説明書）
+	// 形式、チャンネル数、サンプルレート、量子化ビット数等
 	// --------------------------------------------------
-	WAVEFORMATEX		 m_Format{}; // PCM 16bit OŖ߂
+	WAVEFORMATEX		 m_Format{}; // PCM 16bit 前提で埋める
 	// --------------------------------------------------
-	// g`f[^{
+	// 波形データ本体
 	// --------------------------------------------------
-	std::vector<uint8_t> m_PCM;		 // f[^iĐ͐ĂKvj
+	std::vector<uint8_t> m_PCM;		 // 生データ（再生中は生存している必要あり）
 	// --------------------------------------------------
-	// d[h邽߂̃LbV
-	// LbVłďL͂Ȃ
+	// 重複ロードを避けるためのキャッシュ
+	// 弱キャッシュであって所有はしない
 	// --------------------------------------------------
 	static std::unordered_map<std::string, std::weak_ptr<AudioClip>> s_Pool;
 
 	// ==================================================
-	// wp
+	// ヘルパ
 	// ==================================================
 	// --------------------------------------------------
-	// ǂݍ݁ij
+	// 音源読み込み（内部処理）
 	// --------------------------------------------------
 	static std::shared_ptr<AudioClip> LoadInternal(const std::string& normPath);
 	// --------------------------------------------------
-	// pX̐Ki'\\'  '/' ɓj
+	// パスの正規化（'\\' を '/' に統一）
 	// --------------------------------------------------
 	static std::string NormalizePathKey(const char* path); 
 
 public:
 	// --------------------------------------------------
-	// ǂݍ
+	// 音源読み込み
 	// --------------------------------------------------
 	static std::shared_ptr<AudioClip> Load(const char* path);
 
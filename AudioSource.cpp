@@ -1,7 +1,7 @@
 /*
 	AudioSource.cpp
 	20251001  hanaue sho
-	Đ@\
+	音源を再生する機能
 */
 #include "AudioSource.h"
 
@@ -10,13 +10,13 @@ void AudioSource::Play(bool loop)
 {
 	if (!m_Clip) return;
 
-	// 񂾂 SourceVoice 쐬itH[}bgɕRÂj
+	// 初回だけ SourceVoice を作成（フォーマットに紐づく）
 	if (!m_Voice)
 	{
 		AudioSystem::GetEngine()->CreateSourceVoice(&m_Voice, &m_Clip->GetFormat());
 	}
 
-	// LbVʂ𔽉f
+	// キャッシュした音量を反映
 	m_Voice->SetVolume(m_Volume);
 
 	XAUDIO2_BUFFER buf{};
@@ -49,19 +49,19 @@ void AudioSource::SetVolume(float v)
 
 void AudioSource::SetFade(float targetVolume, float fadeTime)
 {
-	if (m_IsFade) return; // tF[h͐VXVȂ
+	if (m_IsFade) return; // フェード処理中は新しく更新しない
 	m_IsFade = true;
 
 	m_FadeTime = fadeTime;
 	m_FadeTimer = 0.0f;
 	float vol = 0; m_Voice->GetVolume(&vol);
 	m_VolumeValue = (targetVolume - vol) / fadeTime;
-	m_Volume = targetVolume; // LbV
+	m_Volume = targetVolume; // キャッシュ
 }
 
 void AudioSource::Update(float dt)
 {
-	// ----- tF[h -----
+	// ----- フェード処理 -----
 	if (m_IsFade)
 	{
 		m_FadeTimer += dt;
@@ -1,7 +1,7 @@
 /*
 	AudioSource.h
 	20251001  hanaue sho
-	Đ@\
+	音源を再生する機能
 */
 #ifndef AUDIOSORCE_H_
 #define AUDIOSORCE_H_
@@ -15,22 +15,22 @@ class AudioSource : public Component
 {
 private:
 	// ==================================================
-	// {̗vf
+	// 本体要素
 	// ==================================================
 	// --------------------------------------------------
-	// 
+	// 音源
 	// --------------------------------------------------
 	std::shared_ptr<AudioClip> m_Clip;
 	// --------------------------------------------------
-	// 炷vC[
+	// 音を鳴らすプレイヤー
 	// --------------------------------------------------
 	IXAudio2SourceVoice*	   m_Voice{};
 	// --------------------------------------------------
-	// ʂ̃LbV
+	// 音量のキャッシュ
 	// --------------------------------------------------
 	float m_Volume = 1.0f;
 	// --------------------------------------------------
-	// tF[h
+	// フェード処理
 	// --------------------------------------------------
 	float m_FadeTime = 0.0f;
 	float m_FadeTimer = 0.0f;
@@ -40,41 +40,41 @@ private:
 public:
 	using Component::Component;
 	// ==================================================
-	// ֐
+	// 関数
 	// ==================================================
 	// --------------------------------------------------
-	// ̃Zbg
+	// 音源のセット
 	// --------------------------------------------------
 	void SetClip(const std::shared_ptr<AudioClip>& clip) { m_Clip = clip; }
 	// --------------------------------------------------
-	// ̍Đ
+	// 音源の再生
 	// --------------------------------------------------
 	void Play(bool loop = false);
 	// --------------------------------------------------
-	// ̒~
+	// 音源の停止
 	// --------------------------------------------------
 	void Stop();
 	// --------------------------------------------------
-	// ̉ʐݒ
+	// 音源の音量設定
 	// --------------------------------------------------
 	void SetVolume(float v);
 	// --------------------------------------------------
-	// tF[h
-	// w肵ʂ֎w肵Ԃď
-	// targetVolume : ړỈ
-	// fadeTime		: tF[h̎
+	// フェード処理
+	// 指定した音量へ指定した時間をかけて処理する
+	// targetVolume : 目的の音量
+	// fadeTime		: フェードの時間
 	// --------------------------------------------------
 	void SetFade(float volume, float fadeTime);
 
 	// ==================================================
-	// CtTCN
+	// ライフサイクル
 	// ==================================================
 	// --------------------------------------------------
-	// XV
+	// 更新処理
 	// --------------------------------------------------
 	void Update(float dt) override;
 	// --------------------------------------------------
-	// I
+	// 終了処理
 	// --------------------------------------------------
 	void Uninit() override;
 };
@@ -1,8 +1,8 @@
 /*
 	AudioSystem.h
 	20251001  hanaue sho
-	炷y䕔i XAudio2 ̋NIj
-	vOłP̂ݐ
+	音を鳴らす土台部分（ XAudio2 の起動＆終了）
+	プログラム内で１つのみ生成
 */
 #ifndef AUDIOSYSTEM_H_
 #define AUDIOSYSTEM_H_
@@ -13,49 +13,49 @@ class AudioSystem
 {
 private:
 	// ==================================================
-	// {̗vf
+	// 本体要素
 	// ==================================================
 	// --------------------------------------------------
-	// XAudio2 {
+	// XAudio2 本体
 	// --------------------------------------------------
 	static Microsoft::WRL::ComPtr<IXAudio2> s_Engine;
 	// --------------------------------------------------
-	// o̓~LT
+	// 出力ミキサ
 	// --------------------------------------------------
 	static IXAudio2MasteringVoice* s_Master; 
 	static bool								s_Initialized;
 
 public:
 	// ==================================================
-	// CtTCN
+	// ライフサイクル
 	// ==================================================
 	// --------------------------------------------------
-	// GWN}X^[{CX
-	// Main֐łP񂾂Ăяo
+	// エンジン起動＆マスターボイス生成
+	// Main関数内で１回だけ呼び出す
 	// --------------------------------------------------
 	static bool Init();
 	// --------------------------------------------------
-	// j
+	// 破棄
 	// --------------------------------------------------
 	static void Shutdown();
 
 	// ==================================================
-	// ֗ANZT
+	// 便利アクセサ
 	// ==================================================
-	static IXAudio2*			   GetEngine(); // ~LVOďo͂gOSh
-	static IXAudio2MasteringVoice* GetMaster(); // ŏIȉo̓~LTBɑSẲAOS̊o͂֗
+	static IXAudio2*			   GetEngine(); // 音をミキシングして出力する“音のOS”
+	static IXAudio2MasteringVoice* GetMaster(); // 最終段の出力ミキサ。ここに全ての音が混ざり、OSの既定出力へ流れる
 
 	// --------------------------------------------------
-	// S̉ʁi0.0f ~ 1.0fj
+	// 全体音量（0.0f ~ 1.0f）
 	// --------------------------------------------------
 	static void  SetMasterVolume(float vol);
 	static float GetMasterVolume();
 
 	// --------------------------------------------------
-	// AṽTXyh/W[Ŏg
+	// アプリのサスペンド/レジューム等で使う
 	// --------------------------------------------------
-	static void Suspend(); // ꎞ~
-	static void Resume();  // ĊJ
+	static void Suspend(); // 一時停止
+	static void Resume();  // 再開
 };
 
 #endif
\ No newline at end of file
@@ -1,7 +1,7 @@
 /*
 	BallJointComponent.h
 	20251130  hanaue sho
-	{[WCg
+	ボールジョイント
 */
 #ifndef BALLJOINTCOMPONENT_H_
 #define BALLJOINTCOMPONENT_H_
@@ -16,28 +16,28 @@ class BallJointComponent : public Component
 {
 private:
 	// ==================================================
-	// ----- vf -----
+	// ----- 要素 -----
 	// ==================================================
 	// --------------------------------------------------
-	// gRigidbody
+	// 自身のRigidbody
 	// --------------------------------------------------
 	Rigidbody* m_pRigidbody = nullptr;
 	// --------------------------------------------------
-	// ̃|C^
+	// 相方のポインタ
 	// --------------------------------------------------
 	GameObject* m_pOtherObject = nullptr;
 	// --------------------------------------------------
-	// eAJ[i[JWj
+	// 各アンカー（ローカル座標）
 	// --------------------------------------------------
 	Vector3 m_LocalAnchorA = Vector3(0.0f, 0.0f, 0.0f);
 	Vector3 m_LocalAnchorB = Vector3(0.0f, 0.0f, 0.0f);
 	// --------------------------------------------------
-	// PhysicsSystem ̍̔
+	// PhysicsSystem の採番
 	// --------------------------------------------------
 	int		m_JointId = -1;
 public:
 	// ==================================================
-	// ----- Zb^[EQb^[ -----
+	// ----- セッター・ゲッター -----
 	// ==================================================
 	void SetOtherObject(GameObject* other) { m_pOtherObject = other; }
 	void SetLocalAnchorA(const Vector3& anchor) { m_LocalAnchorA = anchor; }
@@ -53,16 +53,16 @@ public:
 	void SetJointId(int id) { m_JointId = id; }
 
 	// ==================================================
-	// ----- PhysicsSystemւ̓o^ -----
+	// ----- PhysicsSystemへの登録 -----
 	// ==================================================
 	void RegisterToPhysicsSystem()
 	{
-		// ȂǂZbgĂo^i{͍XV֐̕ǂȁj
+		// 相方などをセットしてから登録する（本当は更新する関数の方が良きかな）
 		Manager::GetScene()->physicsSystem().RegisterBallJoint(this);
 	}
 
 	// ==================================================
-	// ----- CtTCN -----
+	// ----- ライフサイクル -----
 	// ==================================================
 	void OnAdded() override
 	{
@@ -72,12 +72,12 @@ public:
 			assert(false && "BallJoint requires Rigidbody on owner");
 			return;
 		}
-		// PhysicsSystem ɓo^͂ł͍sȂ
+		// PhysicsSystem に登録はここでは行わない
 
 	}
 	void Uninit() override
 	{
-		// PhysicsSystem 폜
+		// PhysicsSystem から削除
 		Manager::GetScene()->physicsSystem().UnregisterBallJoint(this);
 	}
 };
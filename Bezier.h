@@ -1,6 +1,6 @@
 /*
 	Bezier.h
-	xWFȐ
+	ベジェ曲線
 	20250617  hanaue sho
 */
 #ifndef BEZIER_H_
@@ -9,7 +9,7 @@
 #include <vector>
 
 
-// xWFȐ̃NX
+// ベジェ曲線のクラス
 class Bezier
 {
 private:
@@ -33,7 +33,7 @@ public:
 		m_ControllPoints.erase(iter);
 	}
 
-	// ͂O`P̕_
+	// 引数は０～１の浮動小数点
 	Vector3 GetValue(float t)
 	{
 		if (t < 0) t = 0; if (t > 1) t = 1;
@@ -1,7 +1,7 @@
 /*
 	BillboardComponent.h
 	20250915  hanaue sho
-	r{[hR|[lg
+	ビルボードコンポーネント
 */
 #ifndef BILLBOARDCOMPONENT_H_
 #define BILLBOARDCOMPONENT_H_
@@ -17,9 +17,9 @@ class BillboardComponent : public Component
 public:
 	enum class BillboardType
 	{
-		Spherical,		// ɃJ
-		CylindericalY,  // YAbvۂ킹
-		ScreenAligned	// Jɐ
+		Spherical,		// 常にカメラを向く
+		CylindericalY,  // Yアップを保ちつつ水平方向だけ合わせる
+		ScreenAligned	// カメラに正対
 	};
 
 private:
@@ -54,17 +54,17 @@ public:
 			Vector3 u = Vector3::Cross(f, r);
 			rot = Matrix4x4::CreateAxes(r, u, f);
 		}
-		else if (m_Type == BillboardType::CylindericalY) // Y Œ
+		else if (m_Type == BillboardType::CylindericalY) // Y 固定
 		{
 			Vector3 toCam = camPos - objPos;
-			toCam.y = 0;					  // yOɂ
+			toCam.y = 0;					  // y成分を０にする
 			Vector3 f = toCam.normalized();
 			if (f.lengthSq() < 1e-6f) return;
 			Vector3 u = worldUp;
 			Vector3 r = Vector3::Cross(u, f).normalized();
 			rot = Matrix4x4::CreateAxes(r, u, f);
 		}
-		else if (m_Type == BillboardType::ScreenAligned) // 
+		else if (m_Type == BillboardType::ScreenAligned) // 正対
 		{
 			Vector3 f = camFwd;
 			Vector3 r = Vector3::Cross(worldUp, f).normalized();
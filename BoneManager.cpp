@@ -1,8 +1,8 @@
 /*
 	BoneManager.cpp
 	20260122  hanaue sho
-	f̃{[Ǘ}l[W
-	fIuWFNgP
+	モデルのボーンを管理するマネージャ
+	モデルオブジェクトが１つ持つ
 */
 #include "BoneManager.h"
 #include "ModelLoader.h"
@@ -17,7 +17,7 @@
 
 namespace
 {
-	// s񂩂 Translation o
+	// 行列から Translation を取り出す
 	Vector3 ExtractTranslation_RowVector(const Matrix4x4& mat)
 	{
 		return Vector3(mat.m[3][0], mat.m[3][1], mat.m[3][2]);
@@ -34,18 +34,18 @@ void BoneManager::UpdateFromAnimator(const std::vector<Matrix4x4>& boneModelPose
 
 	const bool useMask = (disableAnimeWriteMask && (int)disableAnimeWriteMask->size() == boneCount); // mask
 
-	// owner ̃[h
+	// owner のワールド
 	TransformComponent* ownerTrans = m_pOwner->Transform();
 	const Matrix4x4 ownerWorld = ownerTrans->WorldMatrix();
 
-	// {[[hXV { Transform 
+	// ボーンワールド更新 ＋ Transform 同期
 	for (int i = 0; i < boneCount; i++)
 	{
 		m_BoneWorldPose[i] = boneModelPose[i] * ownerWorld;
 
-		if (useMask && (*disableAnimeWriteMask)[i] != 0) continue; // }XNΏۂȂ㏑XLbv
+		if (useMask && (*disableAnimeWriteMask)[i] != 0) continue; // マスク対象なら上書きスキップ
 
-		// Transform XV
+		// Transform 更新
 		if (TransformComponent* bt = m_BoneTransforms[i])
 		{
 			bt->SetWorldMatrixFromExternal(m_BoneWorldPose[i]);
@@ -90,7 +90,7 @@ void BoneManager::SetBonePhysics(int boneIndex, bool enable, bool isDynamic)
 
 	if (!enable) return;
 
-	// ----- Collider  Rigidbody ̕t^ -----
+	// ----- Collider と Rigidbody の付与 -----
 	GameObject* bone = m_BoneObjects[boneIndex];
 	if (!bone->GetComponent<Collider>()) bone->AddComponent<Collider>();
 	if (!bone->GetComponent<Rigidbody>())bone->AddComponent<Rigidbody>();
@@ -115,7 +115,7 @@ void BoneManager::SyncBoneScale()
 	}
 }
 
-// {[̃RC_[̎
+// ボーンのコライダーの自動調整
 void BoneManager::AutoSetupCapsulesFromBindPose(int startIndex, int endIndex, float defaultRadius)
 {
 	if (!m_pSkeleton) return;
@@ -124,40 +124,40 @@ void BoneManager::AutoSetupCapsulesFromBindPose(int startIndex, int endIndex, fl
 	const int boneCount = (int)bones.size();
 	if (boneCount <= 0) return;
 
-	// ͈͂ۂ߂
+	// 範囲を丸める
 	startIndex = std::max(0, startIndex);
 	endIndex = std::min(boneCount - 1, endIndex);
 	if (startIndex > endIndex) return;
 
-	// ----- qXg -----
-	std::vector<std::vector<int>> children(boneCount); // eCfbNX  qCfbNXz
+	// ----- 子リストを作る -----
+	std::vector<std::vector<int>> children(boneCount); // 親インデックス → 子インデックス配列
 	for (int i = 0; i < boneCount; i++)
 	{
 		const int p = bones[i].parent;
 		if (p >= 0 && p < boneCount) children[p].push_back(i);
 	}
 
-	// ----- bindPose ̃fԍsibones[] eq̏ł邱ƂOj -----
+	// ----- bindPose のモデル空間行列を作る（bones[] が親→子の順であることが前提） -----
 	std::vector<Matrix4x4> bindModel(boneCount);
 	for (int i = 0; i < boneCount; i++)
 	{
 		const int p = bones[i].parent;
-		if (p < 0) bindModel[i] = bones[i].bindLocal; // [g{[
-		else	   bindModel[i] = bones[i].bindLocal * bindModel[p]; // q~e
+		if (p < 0) bindModel[i] = bones[i].bindLocal; // ルートボーン
+		else	   bindModel[i] = bones[i].bindLocal * bindModel[p]; // 子×親
 	}
-	// ʒuLbV
+	// 位置キャッシュ
 	std::vector<Vector3> bindPos(boneCount);
 	for (int i = 0; i < boneCount; i++)
 		bindPos[i] = ExtractTranslation_RowVector(bindModel[i]);
 
-	// ----- ͈͓{[ɑ΂ Capsule ݒ -----
+	// ----- 範囲内ボーンに対して Capsule を自動設定 -----
 	const float epsLen = 1e-5f;
 	for (int i = startIndex; i <= endIndex; i++)
 	{
 		GameObject* boneObject = (i >= 0 && i < (int)m_BoneObjects.size()) ? m_BoneObjects[i] : nullptr;
 		if (!boneObject) continue;
 
-		// \q{[Iԁiő勗j
+		// 代表子ボーンを選ぶ（最大距離）
 		int bestChild = -1;
 		float bestDist = -1.0f;
 		const Vector3 p0 = bindPos[i];
@@ -171,7 +171,7 @@ void BoneManager::AutoSetupCapsulesFromBindPose(int startIndex, int endIndex, fl
 				bestChild = c;
 			}
 		}
-		// qȂ[̓XLbviKvȂ狅AJvZցj
+		// 子がいない末端骨はスキップ（必要なら球、カプセルへ）
 		if (bestChild < 0) {
 			//printf("[SKIP] i=%d name=%s\n",i, bones[i].name.c_str());
 			continue;
@@ -182,7 +182,7 @@ void BoneManager::AutoSetupCapsulesFromBindPose(int startIndex, int endIndex, fl
 		const float len = seg.length();
 		if (len < epsLen) continue;
 
-		// dir {[[J: childPosLocal = p1 * invBindModel[i]
+		// dir をボーンローカルへ: childPosLocal = p1 * invBindModel[i]
 		Matrix4x4 invBindModel_i = bindModel[i].Inverse();
 		Vector3 childPosLocal = invBindModel_i.TransformPoint(p1);
 		float childLenLocal = childPosLocal.length();
@@ -190,19 +190,19 @@ void BoneManager::AutoSetupCapsulesFromBindPose(int startIndex, int endIndex, fl
 
 		const Vector3 dirLocal = childPosLocal * (1.0f / childLenLocal); // normalize
 
-		// JvZ̃[J{Y dirLocal ɍ킹
+		// カプセルのローカル＋Yを dirLocal に合わせる
 		Quaternion rotLocal = Quaternion::FromToRotation(Vector3(0, 1, 0), dirLocal).normalized();
 
-		// _F_ dirLocal  len/2 i len ̓fԂ̒j
-		// [J dirLocal ɃfԒ|̂CchildLenLocal g邪ł bindModel ̃XP[܂񂾒œꂷ
+		// 中点：原点から dirLocal へ len/2 （※ len はモデル空間の長さ）
+		// ローカル方向 dirLocal にモデル空間長を掛けるのが気持ち悪ければchildLenLocal を使う手もあるがここでは bindModel のスケールを含んだ長さで統一する
 		Vector3 centerLocal = childPosLocal* 0.5f;
 
-		// Collider ̎擾Aǉ
+		// Collider の取得、追加
 		SetBonePhysics(i, true, false);
 		Collider* col = boneObject->GetComponent<Collider>();
 		if (!col) continue;
 
-		// aFJvZȂ炻DA defaultRadius
+		// 半径：既存カプセルがあるならそれを優先、無ければ defaultRadius
 		float r = defaultRadius;
 		if (auto* cap = dynamic_cast<CapsuleCollision*>(col->Shape()))
 		{
@@ -215,13 +215,13 @@ void BoneManager::AutoSetupCapsulesFromBindPose(int startIndex, int endIndex, fl
 
 		col->SetCapsule(r, cylinder);
 
-		// ItZbgݒi[Jj
+		// オフセット設定（ローカル）
 		col->SetOffsetPosition(centerLocal);
 		col->SetOffsetRotation(rotLocal);
 	}
 }
 
-// {[̐
+// ボーンの生成
 void BoneManager::CreateBoneObjects()
 {
 	if (!m_pOwner || !m_pSkeleton) return;
@@ -238,13 +238,13 @@ void BoneManager::CreateBoneObjects()
 	{
 		const std::string& name = m_pSkeleton->bones[i].name;
 
-		// BoneObject 
+		// BoneObject 生成
 		BoneObject* bone = Manager::GetScene()->AddGameObject<BoneObject>(1);
-		// ÕZbg
+		// 名前のセット
 		bone->SetBoneIndex(i);
 		bone->SetName(name);
 
-		// ----- o^ -----
+		// ----- 登録 -----
 		m_BoneObjects[i] = bone;
 		m_BoneTransforms[i] = bone->Transform();
 
@@ -1,8 +1,8 @@
 /*
 	BoneObject.h
 	20260122  hanaue sho
-	{[p̃Q[IuWFNg
-	{͉Ȃ
+	ボーン専用のゲームオブジェクト
+	※基本は何もしない
 */
 #ifndef BONEOBJECT_H_
 #define BONEOBJECT_H_
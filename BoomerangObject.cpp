@@ -1,7 +1,7 @@
 /*
 	BoomerangObject.cpp
 	20260211  hanaue sho
-	u[̃IuWFNg
+	ブーメランのオブジェクト
 */
 #include "BoomerangObject.h"
 #include "Renderer.h"
@@ -33,30 +33,30 @@ void BoomerangObject::Init()
 	// MeshRenderer
 	auto* mr = AddComponent<MeshRendererComponent>();
 
-	// Slot 
+	// Slot 数
 	const int slotCount = mf->MaterialSlotCount();
 	mr->ResizeMaterialSlots(slotCount);
 
-	// ʃVF[_[
+	// 共通シェーダー
 	ID3D11VertexShader* vs = nullptr;
 	ID3D11PixelShader* ps = nullptr;
 	ID3D11InputLayout* il = nullptr;
 	Renderer::CreateVertexShader(&vs, &il, "shader\\VS_Lit.cso", Renderer::VertexLayoutType::Basic);
 	Renderer::CreatePixelShader(&ps, "shader\\PS_Toon.cso");
 
-	// ʃ}eA萔
+	// 共通マテリアル定数
 	MaterialApp m{};
 	m.diffuse = Vector4(1, 1, 1, 1);
 	m.ambient = Vector4(1, 1, 1, 1);
 	m.textureEnable = true;
 
-	// ꎞIɃeNX`ݒ -----
+	// 一時的にテクスチャを設定 -----
 	auto* mat = AddComponent<MaterialComponent>();
 	mat->SetVSPS(vs, ps, il, /*takeVS*/true, /*takePS*/true, /*takeIL*/true);
 	ID3D11ShaderResourceView* srv = Texture::LoadAndRegisterKey("assets\\texture\\whiteTexture.png");
 	mat->SetMainTexture(srv, /*sampler*/nullptr, /*takeSrv*/false, /*takeSamp*/false);
 
-	// slot Ƃ MaterialComponent  srv h
+	// slot ごとに MaterialComponent を作って srv を刺す
 	for (int slot = 0; slot < slotCount; slot++)
 	{
 		auto* mat = AddComponent<MaterialComponent>();
@@ -66,7 +66,7 @@ void BoomerangObject::Init()
 		ID3D11ShaderResourceView* srv = nullptr;
 		if (slot < (int)srvs.size()) srv = srvs[slot];
 
-		//srv = Texture::LoadAndRegisterKey("assets\\texture\\whiteTexture.png"); // fobOŃoOł΂
+		//srv = Texture::LoadAndRegisterKey("assets\\texture\\whiteTexture.png"); // デバッグでバグでばっぐ
 
 		mat->SetMainTexture(srv, nullptr);
 
@@ -78,7 +78,7 @@ void BoomerangObject::Init()
 	if (slotCount > 0)
 		mr->SetBaseMaterial(mr->GetMaterialSlot(0));
 
-	// AEgC}eAǉ
+	// アウトラインマテリアル追加
 	auto* matOutline = AddComponent<MaterialComponent>();
 	Renderer::CreateVertexShader(&vs, &il, "shader\\VS_Outline.cso", Renderer::VertexLayoutType::Basic);
 	Renderer::CreatePixelShader(&ps, "shader\\PS_Outline.cso");
@@ -90,7 +90,7 @@ void BoomerangObject::Init()
 	auto* col = AddComponent<Collider>();
 	col->Init();
 	col->SetSphere(4);
-	col->SetModeTrigger(); // ŏ̓gK[
+	col->SetModeTrigger(); // 最初はトリガー判定
 	SetPhysicsLayer(29);
 
 	// Rigidbody
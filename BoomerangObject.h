@@ -1,7 +1,7 @@
 /*
 	BoomerangObject.h
 	20260211  hanaue sho
-	u[̃IuWFNg
+	ブーメランのオブジェクト
 */
 #ifndef BOOMERANGOBJECT_H_
 #define BOOMERANGOBJECT_H_
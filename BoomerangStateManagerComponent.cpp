@@ -16,7 +16,7 @@
 
 namespace
 {
-	// -PI..PI ̒Ɏ߂
+	// -PI..PI の中に収める
 	float WrapPi(float a)
 	{
 		while (a > 3.1415926535f) a -= 2.0f * 3.1415926535f;
@@ -27,7 +27,7 @@ namespace
 
 void BoomerangStateManagerComponent::Init()
 {
-	// AimObject ̐
+	// AimObject の生成
 	m_pAimObject = Manager::GetScene()->AddGameObject<AimObject>(1);
 	m_pAimObject->Init();
 }
@@ -67,11 +67,11 @@ void BoomerangStateManagerComponent::OnTriggerEnter(Collider* me, Collider* othe
 	{
 		if (other->Owner()->Tag() == "Target")
 		{
-			// ^[QbgȊOȂI
+			// ターゲット以外なら終わり
 			if (other->Owner() != m_Targets[m_IndexTargets]) break;
 
 			m_IndexTargets++;
-			m_IsApproach = true; //  false ɂ̂͂ǂȂH
+			m_IsApproach = true; // これ false にするのはどうなん？
 
 			if (m_IndexTargets >= m_Targets.size()) ChangeStateBack();
 		}
@@ -84,7 +84,7 @@ void BoomerangStateManagerComponent::OnTriggerEnter(Collider* me, Collider* othe
 
 void BoomerangStateManagerComponent::ChangeState(State newState)
 {
-	// ----- I -----
+	// ----- 終了処理 -----
 	switch (m_State)
 	{
 	case State::Idle:
@@ -92,20 +92,20 @@ void BoomerangStateManagerComponent::ChangeState(State newState)
 	case State::Aim:
 		break;
 	case State::Throw:
-		// ^[QbgNA
+		// ターゲットクリア
 		ClearTargets();
 		break;
 	case State::Back:
 		break;
 	}
 
-	// -----  -----
+	// ----- 初期化処理 -----
 	m_State = newState;
 	switch (newState)
 	{
 	case State::Idle:
 	{
-		// wɃZbg
+		// 背中にセット
 		SetSpine();
 		GetAimObject()->GetComponent<AimStateManagerComponent>()->SetIsAimming(false);
 	}
@@ -118,24 +118,24 @@ void BoomerangStateManagerComponent::ChangeState(State newState)
 		break;
 	case State::Throw:
 	{
-		// Target Rs[iłȂĂǂȂ肻j
+		// Target をコピー（ここでしなくても良くなりそう）
 		//m_Targets = GetAimObject()->GetComponent<AimStateManagerComponent>()->Targets();
 		if (m_Targets.size() < 1)
 		{
-			ChangeState(State::Idle); // Ȃ
+			ChangeState(State::Idle); // 投げれない
 			break;
 		}
 
-		// ĕZo
-		m_MoveDir  = m_pPlayerObject->Transform()->Forward(); // ʃxNg
-		m_MoveDir += m_pPlayerObject->Transform()->Right(); // E֕␳
-		m_MoveDir.y += 0.2f; // ւ␳
+		// 飛翔方向算出
+		m_MoveDir  = m_pPlayerObject->Transform()->Forward(); // 正面ベクトル
+		m_MoveDir += m_pPlayerObject->Transform()->Right(); // 右側へ補正
+		m_MoveDir.y += 0.2f; // 上へも少し補正
 		m_MoveDir.normalize();
-		// eq֌W؂
+		// 親子関係を切る
 		Owner()->Transform()->SetParentKeepWorld(nullptr);
-		// tO
+		// フラグ初期化
 		m_IsApproach = false;
-		// CfbNX
+		// インデックス初期化
 		m_IndexTargets = 0;
 	}
 		break;
@@ -147,43 +147,43 @@ void BoomerangStateManagerComponent::ChangeState(State newState)
 void BoomerangStateManagerComponent::SetPlayerObject(GameObject* player)
 {
 	m_pPlayerObject = player;
-	// w{[
+	// 背骨ボーン
 	m_pBoneSpineObject = dynamic_cast<PlayerObject*>(m_pPlayerObject)->GetBoneObject(2);
 	m_pBoneHandObject = dynamic_cast<PlayerObject*>(m_pPlayerObject)->GetBoneObject(24);
 }
 
-// ^[Qbgǉ
+// ターゲット追加
 void BoomerangStateManagerComponent::AddTarget()
 {
-	// Ƃ肠^[QbgĂ
+	// とりあえずターゲットを持ってくる
 	std::vector<GameObject*> targets = m_pAimObject->GetComponent<AimStateManagerComponent>()->Targets();
 	if ((int)targets.size() < 1) return;
 
-	// ----- ɓĂ͖ -----
+	// ----- 既に入ってるやつは無視 -----
 	for (const auto& x : m_Targets)
 	{
-		auto it = std::remove(targets.begin(), targets.end(), x); // ʗvf菜i̎_ł͏I[ɖʂȗ̈悪cj
-		targets.erase(it, targets.end()); // 폜iʂȗ̈폜j
+		auto it = std::remove(targets.begin(), targets.end(), x); // 共通要素を取り除く（この時点では終端に無駄な領域が残る）
+		targets.erase(it, targets.end()); // 削除（無駄な領域を削除する）
 	}
-	// ----- D -----
+	// ----- 距離優先 -----
 	if ((int)targets.size() < 1) return;
-	Vector3 axis = m_pAimObject->Transform()->Forward(); // RC_[̎
-	Vector3 aimPos = m_pAimObject->Transform()->Position(); // RC_[̎n_
+	Vector3 axis = m_pAimObject->Transform()->Forward(); // コライダーの軸
+	Vector3 aimPos = m_pAimObject->Transform()->Position(); // コライダーの始点
 	GameObject* nearest = nullptr;
 	float distMin = FLT_MAX;
 	for (int i = 0; i < (int)targets.size(); i++)
 	{
-		Vector3 targetPosition = targets[i]->Transform()->Position(); // target ̈ʒu
-		Vector3 vectToTarget = targetPosition - aimPos; // aim ̎n_ target ւ̃xNg
-		Vector3 pointOnAxis = Vector3::Dot(axis, vectToTarget) * axis; // ̍ŋߐړ_
+		Vector3 targetPosition = targets[i]->Transform()->Position(); // target の位置
+		Vector3 vectToTarget = targetPosition - aimPos; // aim の始点から target へのベクトル
+		Vector3 pointOnAxis = Vector3::Dot(axis, vectToTarget) * axis; // 軸上の最近接点
 		float dist = (targetPosition - pointOnAxis).length();
-		if (dist < distMin) // ŏXV
+		if (dist < distMin) // 最小距離更新
 		{
 			nearest = targets[i];
 			distMin = dist;
 		}
 	}
-	// Ōɓo^
+	// 最後に登録
 	m_Targets.push_back(nearest);
 }
 
@@ -205,61 +205,61 @@ void BoomerangStateManagerComponent::SetSpine()
 
 void BoomerangStateManagerComponent::Throw(float dt)
 {
-	// ----- ď -----
+	// ----- 飛翔処理 -----
 	if (m_IsApproach)
 	{
-		// ^[Qbgʒu
+		// ターゲット位置
 		Vector3 target = target = m_Targets[m_IndexTargets]->Transform()->Position();
 
 		Vector3 vect = target - Owner()->Transform()->Position(); 
 		float dist = vect.length();
 		vect.normalize();
-		// -----  -----
-		// ̂ݎo
+		// ----- 水平成分 -----
+		// 水平成分のみ取り出す
 		Vector3 vectHolizontal = Vector3(vect.x, 0, vect.z);
 		Vector3 dirHolizontal  = Vector3(m_MoveDir.x, 0, m_MoveDir.z);
 		vectHolizontal.normalize();
 		dirHolizontal.normalize();
-		// ̊px߂
+		// 水平成分の角度を求める
 		float yawCur  = atan2f(dirHolizontal.x, dirHolizontal.z);
 		float yawVect = atan2f(vectHolizontal.x, vectHolizontal.z);
-		float yawDiff = WrapPi(yawVect - yawCur); // 
-		// őpɃNv
-		float maxTurn = m_IsApproach ? m_TurnRateApproach * dt : m_TurnRateFlight * dt; // Pt[̍őp
-		// ߋ maxTurn 𑝉
+		float yawDiff = WrapPi(yawVect - yawCur); // 差分
+		// 最大旋回角にクランプ
+		float maxTurn = m_IsApproach ? m_TurnRateApproach * dt : m_TurnRateFlight * dt; // １フレーム内の最大旋回角
+		// 近距離は maxTurn を増加
 		float addTurn = 90 * std::clamp((30.0f - dist) / 30.0f, 0.0f, 1.0f) * dt;
 		maxTurn += addTurn;
 
 		float yawStep = std::clamp(yawDiff, -maxTurn, maxTurn);
 		float yawNew = yawCur + yawStep;
 
-		// yawNew 琅𕜌
+		// yawNew から水平方向を復元
 		Vector3 dirNew = {sinf(yawNew), 0.0f, cosf(yawNew)};
 		dirNew.normalize();
 
-		// -----  -----
+		// ----- 垂直成分 -----
 		float diffVertical = target.y - Owner()->Transform()->Position().y;
 		diffVertical *= 1.0f * dt;
-		// 
+		// 成分合成
 		dirNew.y += diffVertical;
 		dirNew.normalize();
 
-		// ʒuXV
+		// 位置更新
 		Vector3 position = Owner()->Transform()->Position();
 		position += dirNew * (m_Speed * dt);
 		Owner()->Transform()->SetPosition(position);
 
-		// isXV
+		// 進行方向更新
 		m_MoveDir = dirNew;
 	}
 	else
 	{
 		Vector3 vect = m_MoveDir;
-		// ʒuXViij
+		// 位置更新（直進）
 		Vector3 position = Owner()->Transform()->Position();
 		position += vect * (m_Speed * dt);
 		Owner()->Transform()->SetPosition(position);
-		// ԍXV
+		// 時間更新
 		m_TimerFlight += dt;
 		if (m_TimerFlight > 1.0f)
 		{
@@ -275,71 +275,71 @@ void BoomerangStateManagerComponent::Throw(float dt)
 	//	m_IsApproach = true;
 	//}
 
-	// ----- ] -----
+	// ----- 回転処理 -----
 	Vector3 lookPos = Owner()->Transform()->Position();
-	lookPos += Vector3::Cross(m_MoveDir, { 0, 1, 0 }); // is̓悤ɂ
+	lookPos += Vector3::Cross(m_MoveDir, { 0, 1, 0 }); // 進行方向の内側を向くようにする
 	
-	Owner()->Transform()->LookAt(lookPos, Owner()->Transform()->Up()); // ֌
+	Owner()->Transform()->LookAt(lookPos, Owner()->Transform()->Up()); // 内側へ向ける
 	Vector3 axis = Owner()->Transform()->Forward();
-	Owner()->Transform()->RotateAxis(axis, -50.0f * dt); // ]
+	Owner()->Transform()->RotateAxis(axis, -50.0f * dt); // 回転させる
 
 }
 
 void BoomerangStateManagerComponent::Back(float dt)
 {
-	// ^[QbgʒuivC[֔ԁj
+	// ターゲット位置（プレイヤーへ飛ぶ）
 	Vector3 target = m_pPlayerObject->Transform()->Position();
 	
 	Vector3 vect = target - Owner()->Transform()->Position();
 	float dist = vect.length();
 	vect.normalize();
-	// -----  -----
-	// ̂ݎo
+	// ----- 水平成分 -----
+	// 水平成分のみ取り出す
 	Vector3 vectHolizontal = Vector3(vect.x, 0, vect.z);
 	Vector3 dirHolizontal = Vector3(m_MoveDir.x, 0, m_MoveDir.z);
 	vectHolizontal.normalize();
 	dirHolizontal.normalize();
-	// ̊px߂
+	// 水平成分の角度を求める
 	float yawCur = atan2f(dirHolizontal.x, dirHolizontal.z);
 	float yawVect = atan2f(vectHolizontal.x, vectHolizontal.z);
-	float yawDiff = WrapPi(yawVect - yawCur); // 
-	// őpɃNv
-	float maxTurn = m_IsApproach ? m_TurnRateApproach * dt : m_TurnRateFlight * dt; // Pt[̍őp
-	// ߋ maxTurn 𑝉
+	float yawDiff = WrapPi(yawVect - yawCur); // 差分
+	// 最大旋回角にクランプ
+	float maxTurn = m_IsApproach ? m_TurnRateApproach * dt : m_TurnRateFlight * dt; // １フレーム内の最大旋回角
+	// 近距離は maxTurn を増加
 	float addTurn = 90 * std::clamp((30.0f - dist) / 30.0f, 0.0f, 1.0f) * dt;
 	maxTurn += addTurn;
 
 	float yawStep = std::clamp(yawDiff, -maxTurn, maxTurn);
 	float yawNew = yawCur + yawStep;
 
-	// yawNew 琅𕜌
+	// yawNew から水平方向を復元
 	Vector3 dirNew = { sinf(yawNew), 0.0f, cosf(yawNew) };
 	dirNew.normalize();
 
-	// -----  -----
+	// ----- 垂直成分 -----
 	float diffVertical = target.y - Owner()->Transform()->Position().y;
 	diffVertical *= 1.0f * dt;
-	// 
+	// 成分合成
 	dirNew.y += diffVertical;
 	dirNew.normalize();
 
-	// ʒuXV
+	// 位置更新
 	Vector3 position = Owner()->Transform()->Position();
 	position += dirNew * (m_Speed * dt);
 	Owner()->Transform()->SetPosition(position);
 
-	// isXV
+	// 進行方向更新
 	m_MoveDir = dirNew;
 
-	// ----- ] -----
+	// ----- 回転処理 -----
 	Vector3 lookPos = Owner()->Transform()->Position();
-	lookPos += Vector3::Cross(m_MoveDir, { 0, 1, 0 }); // is̓悤ɂ
+	lookPos += Vector3::Cross(m_MoveDir, { 0, 1, 0 }); // 進行方向の内側を向くようにする
 
-	Owner()->Transform()->LookAt(lookPos, Owner()->Transform()->Up()); // ֌
+	Owner()->Transform()->LookAt(lookPos, Owner()->Transform()->Up()); // 内側へ向ける
 	Vector3 axis = Owner()->Transform()->Forward();
-	Owner()->Transform()->RotateAxis(axis, -50.0f * dt); // ]
+	Owner()->Transform()->RotateAxis(axis, -50.0f * dt); // 回転させる
 
-	// ----- vC[ڐG -----
+	// ----- プレイヤー接触処理 -----
 	if (dist < 10.0f)
 	{
 		ChangeState(State::Idle);
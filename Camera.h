@@ -10,7 +10,7 @@
 
 // ----- MyCameraClass -----
 // --------------------------------------------------
-// JNX
+// カメラ基底クラス
 // --------------------------------------------------
 class Camera : public GameObject
 {
@@ -24,21 +24,21 @@ public:
 
 /*
 // --------------------------------------------------
-// RJ
-// ^[QbgɒǏ]J
+// 自由カメラ
+// ターゲットに追従するカメラ
 // --------------------------------------------------
 class FreeCamera : public Camera
 {
 private:
-	XMVECTOR m_Position = {}; // W
+	XMVECTOR m_Position = {}; // 座標
 	XMFLOAT3 m_TargetPosition = {};
-	float m_Distance = -5.0f; // Ώۂ܂ł̐
+	float m_Distance = -5.0f; // 対象までの水平距離
 
-	XMVECTOR m_VectorRight = { 1.0f, 0.0f, 0.0f }; // ExNg
-	XMVECTOR m_VectorTop = { 0.0f, 1.0f, 0.0f }; // xNg
-	XMVECTOR m_VectorFront = { 0.0f, 0.0f, 1.0f }; // OxNg
+	XMVECTOR m_VectorRight = { 1.0f, 0.0f, 0.0f }; // 右方向ベクトル
+	XMVECTOR m_VectorTop = { 0.0f, 1.0f, 0.0f }; // 上方向ベクトル
+	XMVECTOR m_VectorFront = { 0.0f, 0.0f, 1.0f }; // 前方向ベクトル
 
-	XMVECTOR m_FocusPosition = {}; // _
+	XMVECTOR m_FocusPosition = {}; // 注視点
 
 public:
 	FreeCamera() = delete;
@@ -57,21 +57,21 @@ public:
 };
 
 // --------------------------------------------------
-// tH[J
-// ^[QbgɒǏ]J
+// フォローカメラ
+// ターゲットに追従するカメラ
 // --------------------------------------------------
 class FollowCamera : public Camera
 {
 private:
-	XMVECTOR m_Position = {0, 0, 0}; // W
+	XMVECTOR m_Position = {0, 0, 0}; // 座標
 	GameObject* m_pTargetObject = nullptr;
-	float m_Distance = -5.0f; // Ώۂ܂ł̐
+	float m_Distance = -5.0f; // 対象までの水平距離
 
-	XMVECTOR m_VectorRight = { 1.0f, 0.0f, 0.0f }; // ExNg
-	XMVECTOR m_VectorTop = { 0.0f, 1.0f, 0.0f }; // xNg
-	XMVECTOR m_VectorFront = { 0.0f, 0.0f, 1.0f }; // OxNg
+	XMVECTOR m_VectorRight = { 1.0f, 0.0f, 0.0f }; // 右方向ベクトル
+	XMVECTOR m_VectorTop = { 0.0f, 1.0f, 0.0f }; // 上方向ベクトル
+	XMVECTOR m_VectorFront = { 0.0f, 0.0f, 1.0f }; // 前方向ベクトル
 
-	XMVECTOR m_FocusPosition = {0, 0, 1}; // _
+	XMVECTOR m_FocusPosition = {0, 0, 1}; // 注視点
 
 public:
 	FollowCamera() = default;
@@ -14,7 +14,7 @@ void CameraComponent::Update(float dt)
 	view = (m_Mode == Mode::Perspective) ? CalcView3D() : CalcView2D();
 	m_CachedView = view;
 
-	if (m_ProjDirty) // ύXƂ
+	if (m_ProjDirty) // 変更があったときだけ処理するよ
 	{
 		m_CachedProj = (m_Mode == Mode::Perspective) ? CalcProj3D() : CalcProj2D();
 		m_ProjDirty = false;
@@ -32,19 +32,19 @@ Matrix4x4 CameraComponent::CalcView3D()
 	Vector3 right = Vector3::Cross(up, forward).normalized();
 	Vector3 newUp = Vector3::Cross(forward, right);
 
-	// قڕs΍
+	// ほぼ平行対策
 	if (std::fabs(Vector3::Dot(forward, newUp)) > 0.999f)
 		newUp = (std::fabs(forward.y) > 0.999f) ? Vector3(1, 0, 0) : Vector3(0, 1, 0);
 
-	// sxNg(DirectX)ɍ킹
+	// 行ベクトル版(DirectX)に合わせる
 	Matrix4x4 view;
 	view.identity();
-	// ]
+	// 回転
 	view.m[0][0] = right.x; view.m[0][1] = newUp.x; view.m[0][2] = forward.x;
 	view.m[1][0] = right.y; view.m[1][1] = newUp.y; view.m[1][2] = forward.y;
 	view.m[2][0] = right.z; view.m[2][1] = newUp.z; view.m[2][2] = forward.z;
 
-	// sړ
+	// 平行移動
 	view.m[3][0] = -Vector3::Dot(right,	  pos);
 	view.m[3][1] = -Vector3::Dot(newUp,   pos);
 	view.m[3][2] = -Vector3::Dot(forward, pos);
@@ -75,15 +75,15 @@ Matrix4x4 CameraComponent::CalcView2D()
 	Matrix4x4 view; 
 	view.identity();
 
-	if (!m_UseTransformIn2D || !m_pTransform) return view; // ŒJi_j
+	if (!m_UseTransformIn2D || !m_pTransform) return view; // 固定カメラ（原点）
 
-	// 2DpFJʒu C g View = Translate(-C)
+	// 2Dパン：カメラ位置 C を使って View = Translate(-C)
 	const Vector3 pos = m_pTransform->Position();
 	view.m[3][0] = -pos.x;
 	view.m[3][1] = -pos.y;
 	view.m[3][2] = -pos.z;
 
-	// @炱TransformIsDirtyKvHȂH@
+	// ※※※※※　もしかしたらここでTransformのIsDirtyを消費する必要がある？ない？　※※※※※
 	return view;
 }
 Matrix4x4 CameraComponent::CalcProj2D()
@@ -99,7 +99,7 @@ Matrix4x4 CameraComponent::CalcProj2D()
 	float f = m_OrthoFarZ;
 
 	proj.m[0][0] = 2.0f / (r - l);
-	proj.m[1][1] = 2.0f / (t - b); // top = 0, bottom = H ̂ƂiY]j
+	proj.m[1][1] = 2.0f / (t - b); // top = 0, bottom = H のとき負（Y反転）
 	proj.m[2][2] = 1.0f / (f - n);
 	proj.m[3][0] = (l + r) / (l - r);
 	proj.m[3][1] = (b + t) / (b - t);
@@ -1,8 +1,8 @@
 /*
 	CameraComponent.h
 	20250813  hanaue sho
-	JɎ
-	͎Matrix4x4ł͂ȂXMMatrixgĂ
+	カメラに持たせる情報
+	今は自作のMatrix4x4ではなくXMMatrixを使っているよ
 */
 #ifndef CAMERACOMPONENT_H_
 #define CAMERACOMPONENT_H_
@@ -21,24 +21,24 @@ public:
 
 protected:
 	// ==================================================
-	// ----- vf -----
+	// ----- 要素 -----
 	// ==================================================
 	// --------------------------------------------------
-	// ˑ
+	// 依存
 	// --------------------------------------------------
 	TransformComponent* m_pTransform = nullptr;
 
 	// --------------------------------------------------
-	// 
+	// 共通
 	// --------------------------------------------------
 	Mode m_Mode		 = Mode::Perspective;
-	bool m_IsMain	 = true; // Ƃ肠CJɐݒ
-	bool m_ProjDirty = true; // ˉep[^ύX
-	Matrix4x4 m_CachedProj{}; // LbV
-	Matrix4x4 m_CachedView{}; // LbV
+	bool m_IsMain	 = true; // とりあえずメインカメラに設定
+	bool m_ProjDirty = true; // 射影パラメータ変更
+	Matrix4x4 m_CachedProj{}; // キャッシュ
+	Matrix4x4 m_CachedView{}; // キャッシュ
 
 	// --------------------------------------------------
-	// eiPerspectivej
+	// 透視投影（Perspective）
 	// --------------------------------------------------
 	float m_FovY = DirectX::XMConvertToRadians(60.0f);
 	float m_Aspect = 16.0f / 9.0f;
@@ -46,7 +46,7 @@ protected:
 	float m_FarZ = 1000.0f;
 
 	// --------------------------------------------------
-	// seiOrthographic, ㌴_AYj
+	// 平行投影（Orthographic, 左上原点、Y下向き）
 	// --------------------------------------------------
 	float m_OrthoLeft	= 0.0f;
 	float m_OrthoRight  = static_cast<float>(SCREEN_WIDTH);
@@ -54,17 +54,17 @@ protected:
 	float m_OrthoBottom = static_cast<float>(SCREEN_HEIGHT);
 	float m_OrthoNearZ = 0.0f;
 	float m_OrthoFarZ = 1.0f;
-	bool m_UseTransformIn2D = false; // 2DłTransformŃpAY[ꍇtrue
+	bool m_UseTransformIn2D = false; // 2DでもTransformでパン、ズームしたい場合にtrue
 
 public:
 	// ==================================================
-	// ------ ݒ -----
+	// ------ 設定 -----
 	// ==================================================
 	void SetMode(Mode m) noexcept { if (m_Mode != m) { m_Mode = m; m_ProjDirty = true; } }
 	void SetAsMain(bool v) noexcept { m_IsMain = v; }
 
 	// ==================================================
-	// ----- e -----
+	// ----- 透視投影 -----
 	// ==================================================
 	void SetPerspective(float fovYRadian, float aspect, float nearZ, float farZ) noexcept
 	{
@@ -76,7 +76,7 @@ public:
 	void SetNearFar(float nearZ, float farZ) noexcept { m_NearZ = nearZ; m_FarZ = farZ; m_ProjDirty = true; }
 
 	// ==================================================
-	// ----- se -----
+	// ----- 平行投影 -----
 	// ==================================================
 	void SetOrthoOffCenter(float left, float right, float bottom, float top, float nearZ = 0.0f, float farZ = 1.0f) noexcept
 	{
@@ -86,7 +86,7 @@ public:
 	void UseTransformIn2D(bool v) noexcept { m_UseTransformIn2D = v; }
 
 	// ==================================================
-	// ----- CtTCN -----
+	// ----- ライフサイクル -----
 	// ==================================================
 	void OnAdded() override
 	{
@@ -96,7 +96,7 @@ public:
 	void Update(float dt) override;
 	
 	// ==================================================
-	// ----- Qb^[ -----
+	// ----- ゲッター -----
 	// ==================================================
 	bool IsMain() const { return m_IsMain; }
 	bool IsModePerspective() const { return m_Mode == Mode::Perspective; }
@@ -114,25 +114,25 @@ private:
 };
 
 /*
-	// Y^
+	// 備忘録
 	void UpdateView3D()
 	{
-		if (!m_pTransform) return; // ύX̂ŏ΂i!m_pTransform->IsWorldDirty()͈UȂɂj
+		if (!m_pTransform) return; // 変更が無いので処理を飛ばす（!m_pTransform->IsWorldDirty()は一旦なしにする）
 
-		// View(LH) :ʒuForward/Up琶
+		// View(LH) :位置とForward/Upから生成
 		const Vector3 pos = m_pTransform->Position();
 		Vector3 forward = m_pTransform->Forward().normalized();
 		Vector3 up = m_pTransform->Up().normalized();
 		if (fabsf(Vector3::Dot(forward, up)) > 0.999f) {
-			// forward ƂقڕsȂʂ̎I
+			// forward とほぼ平行なら別の軸を選ぶ
 			if (fabsf(forward.y) > 0.999f)
 			{
-				// forward قYȂ Xg
+				// forward がほぼY軸なら X軸を使う
 				up = Vector3(1, 0, 0);
 			}
 			else
 			{
-				// ȊO Yg
+				// それ以外は Y軸を使う
 				up = Vector3(0, 1, 0);
 			}
 		}
@@ -144,10 +144,10 @@ private:
 			XMVectorSet(up.x, up.y, up.z, 0.0f)
 		);
 
-		// Renderer 
+		// Renderer へ
 		Renderer::SetViewMatrix(view);
 
-		// Dirty iWorldMatrix()  worldDirty = false ɂ݌vj
+		// Dirty を消費（WorldMatrix() 内部で worldDirty = false にする設計）
 		(void)m_pTransform->WorldMatrix();
 	}
 
@@ -155,12 +155,12 @@ private:
 	{
 		if (!m_UseTransformIn2D || !m_pTransform)
 		{
-			// 2DŒJiView = identityj
+			// 2D固定カメラ（View = identity）
 			Renderer::SetViewMatrix(DirectX::XMMatrixIdentity());
 			return;
 		}
 
-		// 2DŃpꍇFJʒu C g View = Translate(-C)
+		// 2Dでパンしたい場合：カメラ位置 C を使って View = Translate(-C)
 		const Vector3 pos = m_pTransform->Position();
 		const DirectX::XMMATRIX view = DirectX::XMMatrixTranslation(-pos.x, -pos.y, -pos.z);
 		Renderer::SetViewMatrix(view);
@@ -1,8 +1,8 @@
 /*
 	CameraFollowComponent.h
 	20260211  hanaue sho
-	ΏۂǏ]J
-	͂ŉ]ł
+	対象を追従するカメラ
+	入力で回転もできる
 */
 #ifndef CAMERAFOLLOWCOMPONENT_H_
 #define CAMERAFOLLOWCOMPONENT_H_
@@ -11,19 +11,19 @@ void CameraMove::Update(float dt)
 {
 	if (!m_pTransform) return;
 
-	// NbNĂԂɃ}EẌړʂ𔽉f -----
+	// クリックしている間にマウスの移動量を反映 -----
 	Vector3 mouseDiff = Vector3(Mouse_GetPositionDiff().x, Mouse_GetPositionDiff().y, 0);
 	Vector3 right	  = m_pTransform->Right();
 	Vector3 up		  = m_pTransform->Up();
 	Vector3 forward   = m_pTransform->Forward();
 
-	// ENbNŉ] -----
+	// 右クリックで回転 -----
 	if (Mouse_IsClick(MS_CLICK_RIGHT))
 	{
 		m_pTransform->RotateAxis({ 0, 1, 0 }, mouseDiff.x * 0.005f);
 		m_pTransform->RotateAxis(right, mouseDiff.y * 0.005f);
 	}
-	// NbNňړ -----
+	// 中クリックで移動 -----
 	if (Mouse_IsClick(MS_CLICK_MIDDLE))
 	{
 		Vector3 position = m_pTransform->Position();
@@ -31,10 +31,10 @@ void CameraMove::Update(float dt)
 		position += up * mouseDiff.y * 0.01f;
 		m_pTransform->SetPosition(position);
 	}
-	// zC[őOړ -----
+	// ホイールで前後移動 -----
 	if (Mouse_IsWheelScroll())
 	{
-		Vector3 scroll = forward * Mouse_GetWheelScroll() * 0.5f; // 
+		Vector3 scroll = forward * Mouse_GetWheelScroll() * 0.5f; // 距離調整
 		Vector3 position = m_pTransform->Position();
 		position += scroll;
 		m_pTransform->SetPosition(position);
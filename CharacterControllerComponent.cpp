@@ -1,8 +1,8 @@
 /*
 	CharacterControllerComponent.h
 	20260205  hanaue sho
-	LN^[pR|[lg
-	PhysicsSystem ƘAgĈړS
+	キャラクター制御用コンポーネント
+	PhysicsSystem と連携して移動を担う
 */
 #include <cmath>
 #include "CharacterControllerComponent.h"
@@ -19,7 +19,7 @@ namespace
 	{
 		return std::cos(deg * 3.1415926535f / 180.0f);
 	}
-	// delta ̒ maxDelta ŃNvđ
+	// delta の長さを maxDelta でクランプして足す
 	Vector3 MoveTowardsVec(const Vector3& cur, const Vector3& target, float maxDelta)
 	{
 		Vector3 d = target - cur;
@@ -29,14 +29,14 @@ namespace
 		if (len < 1e-8f) return target;
 		return cur + d * (maxDelta / len);
 	}
-	// -PI..PI ̒Ɏ߂
+	// -PI..PI の中に収める
 	float WrapPi(float a)
 	{
 		while(a >  3.1415926535f) a -= 2.0f * 3.1415926535f;
 		while(a < -3.1415926535f) a += 2.0f * 3.1415926535f;
 		return a;
 	}
-	// yaw  -PI..PI  MoveTowards
+	// yaw を -PI..PI で MoveTowards
 	float MoveTowardsAngle(float cur, float target, float maxDelta)
 	{
 		float d = WrapPi(target - cur);
@@ -47,7 +47,7 @@ namespace
 }
 
 // ==================================================
-// CtTCN
+// ライフサイクル
 // ==================================================
 void CharacterControllerComponent::OnAdded()
 {
@@ -55,18 +55,18 @@ void CharacterControllerComponent::OnAdded()
 	m_pCapsuleCollider = Owner()->GetComponent<Collider>();
 	m_pPhysicsSystem = &Manager::GetScene()->physicsSystem();
 
-	// RC_[Őݒ肷
+	// コライダーを自動で設定する
 	if (!m_pCapsuleCollider)
 	{
 		m_pCapsuleCollider = Owner()->AddComponent<Collider>();
 	}
 	if (CapsuleCollision* cap = dynamic_cast<CapsuleCollision*>(m_pCapsuleCollider->Shape()))
 	{
-		// JvZȂ炻̂܂
+		// カプセルならそのまま
 	}
 	else
 	{
-		// JvZZbg
+		// カプセルセット
 		m_pCapsuleCollider->SetCapsule(1.0f, 1.0f);
 	}
 	m_pCapsuleCollider->SetModeQuery();
@@ -75,49 +75,49 @@ void CharacterControllerComponent::FixedUpdate(float fixedDt)
 {
 	if (!m_pTransform || !m_pCapsuleCollider || !m_pPhysicsSystem) return;
 
-	// XVÖʒu
+	// 更新前の位置
 	Vector3 prevPos = m_pTransform->Position();
-	m_WasGrounded = m_Grounded; // ڒnop
+	m_WasGrounded = m_Grounded; // 接地検出用
 
-	// 
+	// 同期
 	m_pCapsuleCollider->UpdateWorldPose();
 	m_pCapsuleCollider->UpdateWorldAABB();
-	// ړ
+	// 移動処理
 	StepMovement(fixedDt);
-	// nXV
+	// 着地更新
 	UpdateGrounded();
 
-	// XV̈ʒu
+	// 更新後の位置
 	Vector3 nowPos = m_pTransform->Position();
-	// ݑx̍XV
+	// 現在速度の更新
 	m_ActualVelocity = (nowPos - prevPos) / std::max(fixedDt, 1e-6f);
 
-	// ----- Wv֌W -----
+	// ----- ジャンプ関係処理 -----
 	// coyote timer update
-	if (m_Grounded) // n
+	if (m_Grounded) // 着地中
 	{
 		m_CoyoteTimer = m_Settings.coyoteTime;
  		m_AirJumpsUsed = 0;
 	}
-	else // iR[e^C}[j
+	else // 落下中（コヨーテタイマー消費）
 	{
 		if (m_WasGrounded) m_CoyoteTimer = m_Settings.coyoteTime;
 		else			   m_CoyoteTimer = std::max(0.0f, m_CoyoteTimer - fixedDt);
 	}
 	// consume buffered jump if possible
-	if (m_JumpBufferTimer > 0.0f) // obt@ɃWv͂cĂ邩
+	if (m_JumpBufferTimer > 0.0f) // バッファにジャンプ入力が残っているか
 	{
 		const bool canGroundJump = (m_Grounded || m_CoyoteTimer > 0.0f);
 		if (canGroundJump)
 		{
-			// nWv
+			// 地上ジャンプ
 			DoJump(false, m_Settings.jumpSpeed);
 			m_JumpBufferTimer = 0.0f;
-			m_CoyoteTimer = 0.0f; // R[e
+			m_CoyoteTimer = 0.0f; // コヨーテ消費
 		}
 		else if (m_AirJumpsUsed < m_Settings.maxAirJumps)
 		{
-			// 󒆃Wv
+			// 空中ジャンプ
 			DoJump(true, m_Settings.airJumpSpeed);
 			m_JumpBufferTimer = 0.0f;
 		}
@@ -126,12 +126,12 @@ void CharacterControllerComponent::FixedUpdate(float fixedDt)
 	if (m_JumpBufferTimer > 0.0f)
 		m_JumpBufferTimer = std::max(0.0f, m_JumpBufferTimer - fixedDt);
 
-	// ----- ֌W -----
+	// ----- 向き関係処理 -----
 	UpdateFacing(fixedDt);
 }
 
 // ==================================================
-// 
+// 入力
 // ==================================================
 void CharacterControllerComponent::SetMoveInput(const Vector3& moveInput)
 {
@@ -140,7 +140,7 @@ void CharacterControllerComponent::SetMoveInput(const Vector3& moveInput)
 }
 void CharacterControllerComponent::DoJump(bool isAirJump, float jumpSpeed)
 {
-	// cx
+	// 縦速度
 	if (isAirJump && !m_Settings.resetVerticalOnAirJump)
 		m_VerticalVelocity += jumpSpeed;
 	else
@@ -149,10 +149,10 @@ void CharacterControllerComponent::DoJump(bool isAirJump, float jumpSpeed)
 
 	if (isAirJump)
 	{
-		// 󒆃WvJEg
+		// 空中ジャンプカウント
 		m_AirJumpsUsed++;
 
-		// x̏㏑
+		// 水平速度の上書き
 		Vector3 input = m_MoveInputWorld; input.y = 0.0f;
 		if (input.lengthSq() > 1e-8f)
 		{
@@ -161,7 +161,7 @@ void CharacterControllerComponent::DoJump(bool isAirJump, float jumpSpeed)
 			float airMax = m_Settings.maxSpeed * m_Settings.airMaxSpeedScaleJump;
 			Vector3 target = input * (airMax * m_Settings.airJumpOverrideSpeedScale);
 
-			// S㏑ł͂Ȃ܂͊񂹂
+			// 完全上書きではなくまずは寄せる
 			float a = m_Settings.airJumpOverrideAlpha;
 			m_CurrentVelocity = m_CurrentVelocity * (1.0f - a) + target * a;
 		}
@@ -170,16 +170,16 @@ void CharacterControllerComponent::DoJump(bool isAirJump, float jumpSpeed)
 }
 
 // ==================================================
-// 邩
+// 歩けるか判定
 // ==================================================
 bool CharacterControllerComponent::IsWalkableNormal(const Vector3& n) const
 {
-	// up = (0, 1, 0) Oł
+	// up = (0, 1, 0) 前提です
 	return Vector3::Dot(n, Vector3(0,1,0)) >= CosDeg(m_Settings.maxSlopDeg);
 }
 
 // ==================================================
-// x
+// 速度処理
 // ==================================================
 void CharacterControllerComponent::StepMovement(float fixedDt)
 {
@@ -189,8 +189,8 @@ void CharacterControllerComponent::StepMovement(float fixedDt)
 	Vector3 input = m_MoveInputWorld;
 	input.y = 0.0f;
 	float inputLenSq = input.lengthSq();
-	if (inputLenSq > 1e-8f) input = input.normalized(); // ͂
-	else					input = Vector3(0, 0, 0);	// ͂Ȃ
+	if (inputLenSq > 1e-8f) input = input.normalized(); // 入力あり
+	else					input = Vector3(0, 0, 0);	// 入力なし
 	const bool hasInput = (inputLenSq > 1e-8f);
 
 	// --------------------------------------------------
@@ -200,51 +200,51 @@ void CharacterControllerComponent::StepMovement(float fixedDt)
 	float maxSpeed = m_Settings.maxSpeed;
 	if (inAir)
 	{
-		// 󒆂̍ő呬xɒ
+		// 空中の最大速度に調整
 		const bool rising = (m_VerticalVelocity > 0.0f);
 		const float scale = rising ? m_Settings.airMaxSpeedScaleJump : m_Settings.airMaxSpeedScaleFall;
 		maxSpeed *= scale;
 	}
 	// desired
 	Vector3 des = input * maxSpeed; des.y = 0.0f;
-	m_DesiredVelocity = des; // ڕWx
+	m_DesiredVelocity = des; // 目標速度
 
 	// --------------------------------------------------
 	// ----- current velocity -----
 	// --------------------------------------------------
 	Vector3 cur = m_CurrentVelocity; cur.y = 0.0f;
 
-	// xXP[
+	// 加速度スケール
 	float accelScale = 1.0f;
 	float turnAccelScale = 1.0f;
 	float decelScale = 1.0f;
 	if (inAir)
 	{
-		// 󒆃XP[
+		// 空中スケール
 		accelScale	   = m_Settings.airAccelScale;
 		turnAccelScale = m_Settings.airTurnAccelScale;
 		decelScale     = m_Settings.airDecelScale;
 	}
 
-	// ǂxg߂
+	// どういう加速度を使うかを決める
 	float  accel = 0.0f;
 	if (!hasInput)
 	{
-		// ͖F~߂
+		// 入力無し：止める
 		accel = m_Settings.deceleration * decelScale;
 		des = Vector3(0, 0, 0);
 	}
 	else
 	{
-		// ͂
-		// ]傫Ȃ turnAccelerationAłȂ acceleration g
+		// 入力あり
+		// 方向転換が大きいなら turnAcceleration、そうでなければ acceleration を使う
 		float curLenSq = cur.lengthSq();
 		if (curLenSq > 1e-8f)
 		{
 			Vector3 curDir = cur / std::sqrt(curLenSq);
 			Vector3 desDir = des.normalized();
 			float d = Vector3::Dot(curDir, desDir); // -1..1
-			// ]^傫ȂƂ͋
+			// 反転／大きく曲がるときは強め
 			accel = (d < 0.5f) ? m_Settings.turnAcceleration * turnAccelScale
 							   : m_Settings.acceleration	 * accelScale;
 		}
@@ -254,7 +254,7 @@ void CharacterControllerComponent::StepMovement(float fixedDt)
 	float maxDelta = accel * fixedDt;
 	Vector3 newCur = MoveTowardsVec(cur, des, maxDelta);
 
-	// 󒆃Nviیj
+	// 空中クランプ（保険）
 	if (inAir)
 	{
 		float speedSq = newCur.lengthSq();
@@ -270,12 +270,12 @@ void CharacterControllerComponent::StepMovement(float fixedDt)
 	// --------------------------------------------------
 	// ----- vertical velocity -----
 	// --------------------------------------------------
-	// ڒn̉xׂ͒
+	// 接地中の下向き速度は潰す
 	if (m_Grounded && m_VerticalVelocity < 0.0f)
 		m_VerticalVelocity = 0.0f;
-	// ㏸~Jbgŏd̓XP[؂ւ
+	// 上昇下降カットで重力スケールを切り替え
 	float gScale = 1.0f;
-	if (m_VerticalVelocity > 0.0f) // ㏸
+	if (m_VerticalVelocity > 0.0f) // 上昇中
 		gScale = (m_JumpHeld ? m_Settings.gravityScaleJump : m_Settings.gravityScaleCut);
 	else
 		gScale = m_Settings.gravityScaleFall;
@@ -283,145 +283,135 @@ void CharacterControllerComponent::StepMovement(float fixedDt)
 	m_VerticalVelocity += (m_Settings.gravity * gScale) * fixedDt;
 
 	// --------------------------------------------------
-	// ----- displacementiʒuj -----
+	// ----- displacement（位置増分）を作る -----
 	// --------------------------------------------------
 	Vector3 displacement = m_CurrentVelocity;
 	displacement.y = m_VerticalVelocity;
 	displacement *= fixedDt;
 
-	//  MoveSlide
-	MoveAndSlide_Substep(displacement, fixedDt);
+	// 合成して Move＆Slide
+	MoveAndSlide(displacement, fixedDt);
 }
-void CharacterControllerComponent::MoveAndSlide_Substep(const Vector3& displacement, float fixedDt)
+void CharacterControllerComponent::MoveAndSlide(const Vector3& displacement, float fixedDt)
 {
-	Vector3 remaining = displacement; //  Step Łu܂ړʁiʒȗjv
-	float len = std::sqrt(remaining.lengthSq()); // ړ
-	if (len < 1e-8f) return;
+	Vector3 remaining = displacement; // この Step で「まだ動きたい移動量（位置の増分）」
+	if (remaining.lengthSq() < 1e-8f) return;
 
-	// Pxő傫ړƃglOĂ܂
-	// ŁumaxStepMove vɕĕɕiTuXebvj
-	int steps = (int)std::ceil(len / m_Settings.maxStepMove); // ceil: _؂グ
-	steps = std::max(1, steps);
-
-	// QueryΏۂgݗĂ
+	// Query対象を組み立てる
 	QueryOptions opt{};
 	BuildQueryOpt(opt);
 
 	// --------------------------------------------------
-	// ----- TuXebv[v -----
-	// remaining Ȃ Move&Slide JԂ
+	// ----- スライドループ -----
+	// CapsuleCast で最初に当たるところまで進み、残りを壁に沿わせてもう一度キャストする
+	// キャストは途中の物も拾うので、サブステップに分けなくてもすり抜けない
 	// --------------------------------------------------
-	for (int s = 0; s < steps; s++)
+	for (int it = 0; it < m_Settings.maxSliderIterations; it++)
 	{
-		// --------------------------------------------------
-		// c肪قږΏI
-		// --------------------------------------------------
-		if (remaining.lengthSq() < 1e-8f) break;
+		const float len = remaining.length();
+		if (len < 1e-4f) break;
+
+		CastHit hit{};
+		if (!m_pPhysicsSystem->ColliderCast(m_pCapsuleCollider, remaining, hit, opt))
+		{
+			// 何にも当たらないので全部動く
+			MoveBy(remaining);
+			break;
+		}
 
 		// --------------------------------------------------
-		// ̃TuXebvœ stepDelta ߂
-		// remaining  masStepMove ȓɃNv̂ stepDelta Ƃ
+		// skin 手前まで進む
 		// --------------------------------------------------
-		Vector3 stepDelta = remaining; 
+		const float moveDist = std::max(0.0f, hit.distance - m_Settings.skinWidth);
+		const Vector3 moved = remaining * (moveDist / len);
+		MoveBy(moved);
+
+		// Dynamic 剛体を押し返す（進めなかった分だけ）
 		{
-			float stepLenSq = stepDelta.lengthSq();
-			float maxLen = m_Settings.maxStepMove;
-			if (stepLenSq > maxLen * maxLen)
-			{
-				float stepLen = std::sqrt(stepLenSq);
-				stepDelta *= (maxLen / stepLen);
-			}
+			QueryHit pushHit{};
+			pushHit.other  = hit.other;
+			pushHit.normal = hit.normal;
+			TryPushDynamic(pushHit, hit.normal * (len - moveDist), fixedDt);
 		}
-		// ̗zƂď
-		const Vector3 stepDeltaPlanned = stepDelta; 
 
 		// --------------------------------------------------
-		// ړ
+		// スライド
+		// 残り移動 remaining を”壁面に沿うように”変形する（hit.normal は自分の方を向く）
 		// --------------------------------------------------
-		m_pTransform->SetPosition(m_pTransform->Position() + stepDelta);
+		remaining -= moved;
+		const bool isWalkable = IsWalkableNormal(hit.normal);
 
-		// ̃RC_[𓯊
-		m_pCapsuleCollider->UpdateWorldPose();
-		m_pCapsuleCollider->UpdateWorldAABB();
+		float vn = Vector3::Dot(remaining, hit.normal); // 壁に沿うようなベクトルだけ残す
+		if (vn < 0.0f)
+			remaining = remaining - hit.normal * vn;
 
+		if (isWalkable)
+			if (remaining.y < 0.0f)
+				remaining.y = 0.0f;
 		// --------------------------------------------------
-		// ߂荞݉@{@XCh
+		// 速度側にも反映：壁方向に押し続ける速度を削る
+		// これをたらないと、毎フレーム同じ方向に突っ込む→押し出し…が繰り返されてしまう
 		// --------------------------------------------------
-		bool hitSomething = false; // ͎gĂȂÃfobOȂǂŎg
-		for (int it = 0; it < m_Settings.maxSliderIterations; it++)
+		if (!isWalkable)
 		{
-			Vector3 mtd{};
-			QueryHit hit{};
-			if (!m_pPhysicsSystem->QueryComputeMTD(m_pCapsuleCollider, mtd, &hit, opt))
-				break;
-			hitSomething = true;
-
-			// Dynamic ̂Ԃ
-			TryPushDynamic(hit, mtd, fixedDt);
-
-			// oiskin FĂ߂荞ݗ}j
-			Vector3 push = mtd;
-			float pushLenSq = push.lengthSq();
-			if (pushLenSq > 1e-12f)
+			Vector3 v = m_CurrentVelocity;
+			v.y = 0.0f;
+			float vN = Vector3::Dot(v, hit.normal);
+			if (vN < 0.0f)
 			{
-				Vector3 n = (-mtd).normalized(); // mtd = - normal * pen
-				push += -n * m_Settings.skinWidth; // mtd ̌t̂ -n@ɂĂ܂i{ push += n * m_Settings.skinWidthj
+				v = v - hit.normal * vN;
+				m_CurrentVelocity.x = v.x;
+				m_CurrentVelocity.z = v.z;
 			}
-			m_pTransform->SetPosition(m_pTransform->Position() + push);
+		}
+	}
 
-			// 
-			m_pCapsuleCollider->UpdateWorldPose();
-			m_pCapsuleCollider->UpdateWorldAABB();
+	// --------------------------------------------------
+	// 動く相手に押し込まれた分などは最後にまとめて押し出す
+	// --------------------------------------------------
+	Depenetrate(opt, fixedDt);
+}
+void CharacterControllerComponent::Depenetrate(const QueryOptions& opt, float fixedDt)
+{
+	for (int it = 0; it < m_Settings.maxSliderIterations; it++)
+	{
+		Vector3 mtd{};
+		QueryHit hit{};
+		if (!m_pPhysicsSystem->QueryComputeMTD(m_pCapsuleCollider, mtd, &hit, opt))
+			break;
 
-			// --------------------------------------------------
-			// XCh
-			// cړ remaining hǖʂɉ悤Ɂhό`
-			// --------------------------------------------------
-			const bool isWalkable = IsWalkableNormal(hit.normal);
-			
-			float vn = Vector3::Dot(remaining, hit.normal); // ǂɉ悤ȃxNgc
-			if (vn < 0.0f)
-				remaining = remaining - hit.normal * vn;
-
-			if (isWalkable)
-				if (remaining.y < 0.0f)
-					remaining.y = 0.0f;
-			// --------------------------------------------------
-			// xɂfFǕɉ鑬x
-			// ȂƁAt[ɓ˂ށMTDocJԂĂ܂
-			// --------------------------------------------------
-			{
-				Vector3 v = m_CurrentVelocity;
-				v.y = 0.0f;
-				float vN = Vector3::Dot(v, hit.normal);
-				if (vN < 0.0f)
-				{
-					v = v - hit.normal * vN;
-					m_CurrentVelocity.x = v.x;
-					m_CurrentVelocity.z = v.z;
-				}
-			}
-		}
-		// --------------------------------------------------
-		// ̃TuXebvŁgv悵h remaining 
-		// --------------------------------------------------
-		remaining -= stepDeltaPlanned;
+		// Dynamic 剛体を押し返す処理
+		TryPushDynamic(hit, mtd, fixedDt);
 
-		// remaining قږȂI
-		if (remaining.lengthSq() < 1e-8f) break;
+		// 押し出し（skin を少し足す：再めり込み抑制）
+		Vector3 push = mtd;
+		if (push.lengthSq() > 1e-12f)
+		{
+			Vector3 n = (-mtd).normalized(); // mtd = - normal * pen
+			push += -n * m_Settings.skinWidth; // mtd の向きが逆のせいで -n　にしています（本来は push += n * m_Settings.skinWidth）
+		}
+		MoveBy(push);
 	}
 }
+void CharacterControllerComponent::MoveBy(const Vector3& delta)
+{
+	m_pTransform->SetPosition(m_pTransform->Position() + delta);
+
+	// 自分のコライダーを同期
+	m_pCapsuleCollider->UpdateWorldPose();
+	m_pCapsuleCollider->UpdateWorldAABB();
+}
 void CharacterControllerComponent::UpdateGrounded()
 {
 	m_Grounded = false;
 	m_GroundNormal = Vector3(0, 1, 0);
 
-	// ㏸̓XibvȂ
+	// 上昇中はスナップしない
 	if (m_VerticalVelocity > 0.0f)
 		return;
 
 
-	// `FbNi{posewQuery~j
+	// 足元チェック（本当はpose指定Queryが欲しい）
 	const Vector3 pos0 = m_pTransform->Position();
 	const Vector3 down = Vector3(0, -m_Settings.groundProbe, 0);
 
@@ -435,29 +425,29 @@ void CharacterControllerComponent::UpdateGrounded()
 	QueryHit hit{};
 	if (m_pPhysicsSystem->QueryOverlapBest(m_pCapsuleCollider, hit, opt))
 	{
-		hit.normal = -hit.normal; // ۂ߁iȂQueryOverlapBestŕ␳ifʂȂȂj
+		hit.normal = -hit.normal; // 整合性を保つため（なぜかQueryOverlapBest内で補正するとif文を通らなくなる）
 		if (IsWalkableNormal(hit.normal))
 		{
 			m_Grounded = true;
 			m_GroundNormal = hit.normal;
 
-			// nʂɂ߂荞łȂ班߂
+			// 地面にめり込んでいるなら少し押し戻す
 			Vector3 snap = hit.mtd;
-			Vector3 up = { 0, 1, 0 }; // [hxNg
+			Vector3 up = { 0, 1, 0 }; // ワールド上ベクトル
 			float upMove = Vector3::Dot(snap, up);
 			if (upMove > 1e-12f)
 			{
-				// skinWidth グ
+				// skinWidth 分持ち上げる
 				upMove += m_Settings.skinWidth; 
-				// ߂荞񂾕߂
+				// めり込んだ分だけ戻す
 				m_pTransform->SetPosition(m_pTransform->Position() +  up * upMove);
 			}
 
-			// 
+			// 同期
 			m_pCapsuleCollider->UpdateWorldPose();
 			m_pCapsuleCollider->UpdateWorldAABB();
 
-			// groundedȂ痎x~߂
+			// groundedなら落下速度を止める
 			if (m_Grounded && m_VerticalVelocity < 0.0f)
 				m_VerticalVelocity = 0.0f;
 
@@ -465,15 +455,15 @@ void CharacterControllerComponent::UpdateGrounded()
 		}
 	}
 
-	// ڒnĂȂȂ猳ɖ߂
+	// 接地してないなら元に戻す
 	m_pTransform->SetPosition(pos0);
 	m_pCapsuleCollider->UpdateWorldPose();
 	m_pCapsuleCollider->UpdateWorldAABB();
 }
 
 // ==================================================
-// Dynamic ̂Ԃ
-// DynamiĉĂ͂邪Aʒuł킯ł͖BɁAMTD͕␳Ă̂DynamiĉɐGƌ
+// Dynamic 剛体を押し返す
+// ※Dynamic剛体を押してはいるが、位置を押し込んでいるわけでは無い。さらに、こちらのMTDは補正しているのでDynamic剛体に触れると減速する
 // ==================================================
 bool CharacterControllerComponent::TryPushDynamic(const QueryHit& hit, const Vector3& mtd, float dt)
 {
@@ -482,64 +472,68 @@ bool CharacterControllerComponent::TryPushDynamic(const QueryHit& hit, const Vec
 	auto* otherRb = hit.other->Owner()->GetComponent<Rigidbody>();
 	if (!otherRb || !otherRb->IsDynamic()) return false;
 
-	// ͉Ȃ̂Ŕ
+	// 床は押さないので判定
 	const float upDot = Vector3::Dot(hit.normal, Vector3(0, 1, 0));
 	if (upDot >= CosDeg(m_Settings.maxSlopDeg)) return false;
 
-	// iƂ肠u߂荞ݗʁ^vj
+	// 押す強さ（とりあえず「めり込み量／ｄｔ」）
 	const float pen = mtd.length();
 	if (pen <= 1e-6f) return false;
 
-	Vector3 dir = (-mtd).normalized(); // 
+	Vector3 dir = (-mtd).normalized(); // 相手を押す方向
 	float speed = std::min(pen / std::max(dt, 1e-6f), m_Settings.maxPushSpeed);
 
-	// 
+	// 相手を押す
 	Vector3 v = otherRb->Velocity();
 	float vn = Vector3::Dot(v, dir);
-	if (vn < speed) otherRb->SetVelocity(v + dir * (speed - vn));
+	if (vn < speed)
+	{
+		otherRb->SetVelocity(v + dir * (speed - vn));
+		otherRb->WakeUp(); // 眠っていたら起こす
+	}
 	return true;
 }
 
 // ==================================================
-// Queryp
+// Query用
 // ==================================================
 void CharacterControllerComponent::BuildQueryOpt(QueryOptions& opt) const
 {
 	opt.isSimulate  = true;
-	opt.isTrigger   = false; // ʏ Trigger ł͎~܂Ȃ
-	opt.isQueryOnly = false; //  QueryOnly ɂ͓Ȃ
+	opt.isTrigger   = false; // 通常 Trigger では止まらない
+	opt.isQueryOnly = false; // 他の QueryOnly には当たらない
 	opt.slop = 0.0f;
 }
 
 // ==================================================
-// p
+// 向き処理用
 // ==================================================
 void CharacterControllerComponent::UpdateFacing(float fixedDt)
 {
 	if (!m_Settings.faceMoveInput) return;
 	if (!m_pTransform) return;
 
-	// ͕
+	// 入力方向
 	Vector3 dir = m_MoveInputWorld;
 	dir.y = 0.0f;
 	if (dir.lengthSq() < 1e-8f) return;
 
 	dir = dir.normalized();
-	m_FacingDirWorld = dir; // ꉞێiO֏o͂ł邩j
+	m_FacingDirWorld = dir; // 一応保持（外部へ出力できるから）
 
-	// n/󒆂ŉ]xς
+	// 地上/空中で回転速度を変える
 	const float turnSpeedDeg = m_Grounded ? m_Settings.turnSpeedGroundDeg 
 										  : m_Settings.turnSpeedAirDeg;
 	const float maxDelta = (turnSpeedDeg * 3.1415926535f / 180.0f) * fixedDt;
 
-	// ݂ yaw ƖڕW yaw
+	// 現在の yaw と目標 yaw
 	const Vector3 f = m_pTransform->Forward();
 	float curYaw = std::atan2(f.x, f.z);
 	float tgtYaw = std::atan2(dir.x, dir.z);
 
 	float newYaw = MoveTowardsAngle(curYaw, tgtYaw, maxDelta);
 
-	// yaw ̂݉]ɔf
+	// yaw のみ回転に反映
 	Quaternion q = Quaternion::FromAxisAngle(Vector3(0, 1, 0), newYaw);
 	m_pTransform->SetRotation(q);
 }
\ No newline at end of file
@@ -1,8 +1,8 @@
 /*
 	CharacterControllerComponent.h
 	20260205  hanaue sho
-	LN^[pR|[lg
-	PhysicsSystem ƘAgĈړS
+	キャラクター制御用コンポーネント
+	PhysicsSystem と連携して移動を担う
 */
 #ifndef CHARACTERCONTROLLERCOMPONENT_H_
 #define CHARACTERCONTROLLERCOMPONENT_H_
@@ -20,111 +20,110 @@ class CharacterControllerComponent : public Component
 {
 public:
 	// ==================================================
-	// \
+	// 構造体
 	// ==================================================
 	struct Settings
 	{
 		// ----- movement -----
-		float maxSpeed = 50.0f;			// őړx
-		float acceleration = 200.0f;		// x [m/s^2]
-		float deceleration = 200.0f;		// ~x [m/s^2]
-		float turnAcceleration = 400.0f; // ^[x [m/s^2]
+		float maxSpeed = 50.0f;			// 最大移動速度
+		float acceleration = 200.0f;		// 加速度 [m/s^2]
+		float deceleration = 200.0f;		// 停止加速度 [m/s^2]
+		float turnAcceleration = 400.0f; // ターン加速度 [m/s^2]
 
 		// ----- jump -----
 		float gravity   = -9.8f;
-		float jumpSpeed = 50.0f; // Wvx
-		float gravityScaleJump = 6.5f; // ㏸ivY > 0  JumpHold j̏d͔{
-		float gravityScaleFall = 10.0f; // ~ivY <= 0j̏d͔{
-		float gravityScaleCut  = 11.5f; // ㏸Ƀ{^̏d͔{
-		int maxAirJumps = 2; // őWv
-		float airJumpSpeed = 50.0f; // 󒆃Wv̏x
-		bool resetVerticalOnAirJump = true; // 󒆃Wvɏ㏑邩i㏑j
-		float coyoteTime = 0.10f;	 // R痎nWvɂ
-		float jumpBufferTime = 0.1f; // WvێP\
+		float jumpSpeed = 50.0f; // ジャンプ初速度
+		float gravityScaleJump = 6.5f; // 上昇中（vY > 0 かつ JumpHold 中）の重力倍率
+		float gravityScaleFall = 10.0f; // 下降中（vY <= 0）の重力倍率
+		float gravityScaleCut  = 11.5f; // 上昇中にボタン離しの重力倍率
+		int maxAirJumps = 2; // 最大ジャンプ回数
+		float airJumpSpeed = 50.0f; // 空中ジャンプの初速度
+		bool resetVerticalOnAirJump = true; // 空中ジャンプ時に上書きするか（上書き推奨）
+		float coyoteTime = 0.10f;	 // 崖から落ちた後も地上ジャンプ扱いにする
+		float jumpBufferTime = 0.1f; // 早押しジャンプを保持する猶予
 
 		// ----- air control -----
-		float airMaxSpeedScaleJump = 0.8f; // ㏸̋󒆍ő呬x
-		float airMaxSpeedScaleFall = 1.0f; // ̋󒆍ő呬x
-		float airAccelScale     = 1.0f; // 󒆉xXP[
-		float airTurnAccelScale = 0.3f; // 󒆃^[xXP[
-		float airDecelScale     = 0.5f; // 󒆂ł͖̓ł̌iOƉiɊj
-		bool  airJumpOverrideHorizontal = true; // 󒆃Wvɐx㏑邩
-		float airJumpOverrideSpeedScale = 1.0f; // 󒆍ő呬xɑ΂ĉœhւ邩
-		float airJumpOverrideAlpha = 0.5f; // ㏑
+		float airMaxSpeedScaleJump = 0.8f; // 上昇中の空中最大速度
+		float airMaxSpeedScaleFall = 1.0f; // 落下中の空中最大速度
+		float airAccelScale     = 1.0f; // 空中加速度スケール
+		float airTurnAccelScale = 0.3f; // 空中ターン加速度スケール
+		float airDecelScale     = 0.5f; // 空中での入力無しでの減速（０だと永遠に滑る）
+		bool  airJumpOverrideHorizontal = true; // 空中ジャンプ時に水平速度を上書きするか
+		float airJumpOverrideSpeedScale = 1.0f; // 空中最大速度に対して何割で塗り替えるか
+		float airJumpOverrideAlpha = 0.5f; // 上書き時に
 
 		// ----- collision, ground -----
 		float skinWidth = 0.02f;   // 
-		float maxSlopDeg = 50.0f;  // ̍őX
-		float groundProbe = 0.08f; // `FbN
+		float maxSlopDeg = 50.0f;  // 床扱いの最大傾斜
+		float groundProbe = 0.08f; // 足元チェック
 
 		// ----- pushing -----
-		float maxPushSpeed = 50.0f; // Dynamicȍ̂Ԃő呬x
+		float maxPushSpeed = 50.0f; // Dynamicな剛体を押し返す最大速度
 		
-		// ----- solver, stepping -----
-		float maxStepMove = 0.15f;	   // 1substep@̍őړih~j
-		int	  maxSliderIterations = 4; // Q`Sŏ\
+		// ----- solver -----
+		int	  maxSliderIterations = 4; // ２～４で十分
 
 		// ----- turn -----
-		bool faceMoveInput = true; // ͕֌
-		float turnSpeedGroundDeg = 360.0f; // nFPb艽x񂷂
-		float turnSpeedAirDeg	 = 240.0f; // 󒆁FߒǏ]
+		bool faceMoveInput = true; // 入力方向へ向く
+		float turnSpeedGroundDeg = 360.0f; // 地上：１秒当たり何度回すか
+		float turnSpeedAirDeg	 = 240.0f; // 空中：弱め追従
 	};
 
 private:
 	// ==================================================
-	// \vf
+	// 構成要素
 	// ==================================================
 	TransformComponent* m_pTransform = nullptr;
 	Collider*			m_pCapsuleCollider = nullptr;
 	PhysicsSystem*		m_pPhysicsSystem = nullptr;
 
 	// ==================================================
-	// ݒ聕
+	// 設定＆状態
 	// ==================================================
 	Settings m_Settings{};
 
 	// ==================================================
-	// ́x
+	// 入力＆速度
 	// ==================================================
-	Vector3 m_MoveInputWorld{};  // 
-	float   m_InputDeadZone = 0.1f; // pbh̃fbh][
-	bool  m_JumpHeld = false; // Wv{^Ă邩i͑疈t[XVj
+	Vector3 m_MoveInputWorld{};  // 水平方向入力
+	float   m_InputDeadZone = 0.1f; // パッドのデッドゾーン
+	bool  m_JumpHeld = false; // 今ジャンプボタンを押されているか（入力側から毎フレーム更新）
 
-	Vector3 m_DesiredVelocity{}; // ͗R̖ڕWx( m_MoveInputWorld * maxSpeed )
-	Vector3 m_CurrentVelocity{}; // ̐x
-	float   m_VerticalVelocity = 0.0f;  // x
-	Vector3 m_ActualVelocity{};  // ړx
-	Vector3 m_PrevPosition{};	 // actualVelocity vZp
+	Vector3 m_DesiredVelocity{}; // 入力由来の目標速度( m_MoveInputWorld * maxSpeed )
+	Vector3 m_CurrentVelocity{}; // 慣性後の水平速度
+	float   m_VerticalVelocity = 0.0f;  // 垂直速度
+	Vector3 m_ActualVelocity{};  // 実移動速度
+	Vector3 m_PrevPosition{};	 // actualVelocity 計算用
 
 	// ==================================================
-	// n֌W
+	// 着地関係
 	// ==================================================
 	bool m_Grounded = false;
 	Vector3 m_GroundNormal = Vector3(0, 1, 0);
-	int m_AirJumpsUsed = 0; // 󒆃Wv񂵂
+	int m_AirJumpsUsed = 0; // 空中ジャンプ何回したか
 	bool m_WasGrounded = false;
 	float m_CoyoteTimer = 0.0f;
 	float m_JumpBufferTimer = 0.0f;
-	bool m_JumpPressedThisFrame = false; // ̓gK[i͑疈t[XVj
+	bool m_JumpPressedThisFrame = false; // 入力トリガー（入力側から毎フレーム更新）
 
 	// ==================================================
-	// ֌W
+	// 向き関係
 	// ==================================================
 	Vector3 m_FacingDirWorld = Vector3(0, 0, 1);
 public:
 	// ==================================================
-	// RXgN^
+	// コンストラクタ
 	// ==================================================
 	CharacterControllerComponent() = default;
 
 	// ==================================================
-	// CtTCN
+	// ライフサイクル
 	// ==================================================
 	void OnAdded() override;
 	void FixedUpdate(float fixedDt) override;
 
 	// ==================================================
-	// O
+	// 外部入力
 	// ==================================================
 	void SetMoveInput(const Vector3& moveInput);
 	void SetJumpHeld(bool held) { m_JumpHeld = held; }
@@ -137,7 +136,7 @@ public:
 	void AddVerticalVelocity(float vy) { m_VerticalVelocity += vy; }
 
 	// ==================================================
-	// ԎQ
+	// 状態参照
 	// ==================================================
 	bool IsGround() const { return m_Grounded; }
 	const Vector3& GroundNormal() const { return m_GroundNormal; }
@@ -145,7 +144,7 @@ public:
 	float MaxMoveSpeed() const { return m_Settings.maxSpeed; }
 
 	// ==================================================
-	// Zb^[
+	// セッター
 	// ==================================================
 	void SetSettings(const Settings& set) { m_Settings = set; }
 	void SetMaxMoveSpeed(float speed) { m_Settings.maxSpeed = speed; }
@@ -159,33 +158,35 @@ public:
 
 private:
 	// ==================================================
-	// 邩
+	// 歩けるか判定
 	// ==================================================
 	bool IsWalkableNormal(const Vector3& n) const;
 
 	// ==================================================
-	// x
+	// 速度処理
 	// ==================================================
 	void StepMovement(float fixedDt);
-	void MoveAndSlide_Substep(const Vector3& displacement, float fixedDt);
+	void MoveAndSlide(const Vector3& displacement, float fixedDt);
+	void Depenetrate(const QueryOptions& opt, float fixedDt); // めり込みを MTD で押し出す
+	void MoveBy(const Vector3& delta); // 移動してコライダーを同期
 	void UpdateGrounded();
 	// ==================================================
-	// Dynamic ̂Ԃ
+	// Dynamic 剛体を押し返す
 	// ==================================================
 	bool TryPushDynamic(const QueryHit& hit, const Vector3& mtd, float fixedDt);
 
 	// ==================================================
-	// Queryp
+	// Query用
 	// ==================================================
 	void BuildQueryOpt(QueryOptions& opt) const;
 
 	// ==================================================
-	// Wvp
+	// ジャンプ処理用
 	// ==================================================
 	void DoJump(bool isAirJump, float jumpSpeed);
 
 	// ==================================================
-	// p
+	// 向き処理用
 	// ==================================================
 	void UpdateFacing(float fixedDt);
 };
@@ -193,7 +194,8 @@ private:
 #endif
 
 /*
-yY^z
-QueryOverlapBestɂ铖蔻ŁAhit.normaľt̂ł̕ss𐮂邽߂̕ϊ
-΂߂Ă܂BiskinWidthgroundNormalӂj
+【備忘録】
+QueryOverlapBestによる当たり判定で、hit.normalの向きが逆のせいでの不都合を整えるための符号変換が
+いくつかちりばめられています。（skinWidthとgroundNormal辺り）
+ColliderCast の hit.normal は最初から自分の方を向いているので、スライドではそのまま使っています。
 */
\ No newline at end of file
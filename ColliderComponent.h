@@ -1,7 +1,7 @@
 /*
 	ColliderComponent.h
 	20250821  hanaue sho
-	RC_[ñR|[lg
+	コライダー系のコンポーネント
 */
 #ifndef COLLIDERCOMPONENT_H_
 #define COLLIDERCOMPONENT_H_
@@ -9,90 +9,95 @@
 #include "Component.h"
 #include "TransformComponent.h"
 #include "GameObject.h"
-#include "Collision.h"
+#include "collision.h"
 #include "Vector3.h"
-#include "manager.h"
-#include "Scene.h"
+#include "Manager.h"
+#include "scene.h"
 #include "PhysicsSystem.h"
 #include "ColliderPose.h"
-#include "RigidbodyComponent.h" // zQƂɂȂ肩˂Ȃ炠܂悭ȂPh
+#include "ShapeDispatch.h" // ColliderType
+#include "RigidbodyComponent.h" // 循環参照になりかねないからあんまりよくないケド
 
 
-// ==================================================
-// \
-// ==================================================
-enum class ColliderType
-{
-	Box,
-	Sphere,
-	Capsule,
-	MeshField,
-};
-
 class Collider : public Component
 {
 public:
 	enum class Mode
 	{
-		Simulate,  // ʏ
-		Trigger,  // gK[
-		QueryOnly // Solve ΏۊO
+		Simulate,  // 通常
+		Trigger,  // トリガー
+		QueryOnly // Solve 対象外
 	};
 
 private:
 	// ==================================================
-	// ----- {̗vf -----
+	// ----- 本体要素 -----
 	// ==================================================
 	// --------------------------------------------------
-	// VF[v
+	// シェープ
 	// --------------------------------------------------
 	std::unique_ptr<Collision> m_pShape = nullptr;
 	// --------------------------------------------------
-	// ItZbg
+	// オフセット
 	// --------------------------------------------------
 	Vector3 m_OffsetPositionLocal{0, 0, 0};
 	Quaternion m_OffsetRotationLocal = Quaternion();
 	bool m_OffsetDirty = true;
 	// --------------------------------------------------
-	// ItZbg݂ Transform
+	// オフセット込みの Transform
 	// --------------------------------------------------
 	ColliderPose m_WorldPose{};
 	// --------------------------------------------------
-	// LTpAABB
+	// 広域探査用のAABB
+	// --------------------------------------------------
+	AABB m_WorldAABB{}; // 広域探査で使う
+	// --------------------------------------------------
+	// PhyisicsSystem 用の採番
+	// 初期値は-1
+	// --------------------------------------------------
+	int m_Id = -1; // PhysicsSystem 採番
+	// --------------------------------------------------
+	// ブロードフェーズ木のプロキシ番号
+	// 初期値は-1
 	// --------------------------------------------------
-	AABB m_WorldAABB{}; // LTŎg
+	int m_ProxyId = -1;
 	// --------------------------------------------------
-	// PhyisicsSystem p̍̔
-	// l-1
+	// 同じ GameObject の Rigidbody
+	// PhysicsSystem が登録時に設定する（無ければ nullptr）
 	// --------------------------------------------------
-	int m_Id = -1; // PhysicsSystem ̔
+	Rigidbody* m_pBody = nullptr;
 	// --------------------------------------------------
-	// [h
-	// Simulate: ڐGɓ
-	// Trigger:  Cxg
+	// 登録先
+	// --------------------------------------------------
+	PhysicsSystem* m_pPhysics = nullptr;
+	// --------------------------------------------------
+	// モード
+	// Simulate: 接触解決に入れる
+	// Trigger:  イベント生成
 	// Query:	 
 	// --------------------------------------------------
 	Mode m_Mode = Mode::Simulate;
 	// --------------------------------------------------
-	// LtO
-	// ݂͎gĂȂH
+	// 有効化フラグ
+	// 現在は使われていない？
 	// --------------------------------------------------
 	bool m_IsEnable = true;
 
 	friend PhysicsSystem;
 public:
 	// ==================================================
-	// ----- Zb^[Qb^[ -----
+	// ----- セッターゲッター -----
 	// ==================================================
 	const Collision* Shape() const noexcept { return m_pShape.get(); }
 		  Collision* Shape()	   noexcept { return m_pShape.get(); }
 	const ColliderPose& WorldPose() const { return m_WorldPose; }
 	const AABB& WorldAABB() const { return m_WorldAABB; }
 	int  Id() const { return m_Id; }
-	void SetMode(Mode mode) { m_Mode = mode; }
-	void SetModeSimulate() { m_Mode = Mode::Simulate; }
-	void SetModeTrigger()  { m_Mode = Mode::Trigger; }
-	void SetModeQuery()	   { m_Mode = Mode::QueryOnly; }
+	Rigidbody* Body() const { return m_pBody; }
+	void SetMode(Mode mode) { m_Mode = mode; MarkBroadphaseDirty(); }
+	void SetModeSimulate() { SetMode(Mode::Simulate); }
+	void SetModeTrigger()  { SetMode(Mode::Trigger); }
+	void SetModeQuery()	   { SetMode(Mode::QueryOnly); }
 	bool IsSimulate() const { return m_Mode == Mode::Simulate; }
 	bool IsTrigger()  const { return m_Mode == Mode::Trigger; }
 	bool IsQuery()	  const { return m_Mode == Mode::QueryOnly; }
@@ -107,66 +112,67 @@ public:
 		auto* trans = Owner()->GetComponent<TransformComponent>();
 		if (!trans) return;
 
-		// Owner ̃[h
+		// Owner のワールド
 		const Vector3 ownerPos = trans->Position();
 		const Quaternion ownerRot = trans->Rotation();
 		const Vector3 ownerScale = trans->LossyScale();
 
-		// offset ]ÔߐK
+		// offset 回転を念のため正規化
 		Quaternion offsetRot = m_OffsetRotationLocal;
 		offsetRot = offsetRot.normalized();
 
-		// offset ʒu owner ]ŉ񂵂ĉZ
+		// offset 位置を owner 回転で回して加算
 		const Vector3 offsetPosWorld = ownerRot.Rotate(m_OffsetPositionLocal);
 		m_WorldPose.position = ownerPos + offsetPosWorld;
 
-		// ]̍
+		// 回転の合成
 		m_WorldPose.rotation = ownerRot * offsetRot;
-		m_WorldPose.rotation = m_WorldPose.rotation.normalized(); // K
+		m_WorldPose.rotation = m_WorldPose.rotation.normalized(); // 正規化
 
-		// XP[͂Ƃ肠̂܂
+		// スケールはとりあえずそのまま
 		m_WorldPose.scale = ownerScale;
 	}
 
-	// ----- `Zb^[ -----
-	void SetShape  (std::unique_ptr<Collision> shp)		{ m_pShape = std::move(shp); UpdateWorldAABB(); }
-	void SetBox	   (const Vector3& halfSize)			{ auto ptr = std::make_unique<BoxCollision>(halfSize);					 SetShape(std::move(ptr)); m_Type = ColliderType::Box; }
-	void SetSphere (float radius)						{ auto ptr = std::make_unique<SphereCollision>(radius);					 SetShape(std::move(ptr)); m_Type = ColliderType::Sphere; }
-	void SetCapsule(float radius, float cylinderHeight) { auto ptr = std::make_unique<CapsuleCollision>(radius, cylinderHeight); SetShape(std::move(ptr)); m_Type = ColliderType::Capsule; }
-	void SetMeshField(int width, int depth, float cellSizeX, float cellSizeZ, std::vector<float> heights) { auto ptr = std::make_unique<HeightMapCollision>(width, depth, cellSizeX, cellSizeZ, heights); SetShape(std::move(ptr)); m_Type = ColliderType::MeshField; }
+	// ----- 形状セッター -----
+	void SetShape  (std::unique_ptr<Collision> shp)		{ m_pShape = std::move(shp); UpdateWorldAABB(); if (m_Id >= 0) Manager::GetScene()->physicsSystem().UpdateShapeRecord(this); } // m_Type は先に設定しておく
+	void SetBox	   (const Vector3& halfSize)			{ auto ptr = std::make_unique<BoxCollision>(halfSize);					 m_Type = ColliderType::Box;	 SetShape(std::move(ptr)); }
+	void SetSphere (float radius)						{ auto ptr = std::make_unique<SphereCollision>(radius);					 m_Type = ColliderType::Sphere;  SetShape(std::move(ptr)); }
+	void SetCapsule(float radius, float cylinderHeight) { auto ptr = std::make_unique<CapsuleCollision>(radius, cylinderHeight); m_Type = ColliderType::Capsule; SetShape(std::move(ptr)); }
+	void SetMeshField(int width, int depth, float cellSizeX, float cellSizeZ, std::vector<float> heights) { auto ptr = std::make_unique<HeightMapCollision>(width, depth, cellSizeX, cellSizeZ, heights); m_Type = ColliderType::MeshField; SetShape(std::move(ptr)); }
+	void SetTriangleMesh(std::shared_ptr<const TriangleMeshBVH> mesh) { auto ptr = std::make_unique<TriangleMeshCollision>(std::move(mesh)); m_Type = ColliderType::TriangleMesh; SetShape(std::move(ptr)); } // 静的なモデル用
+	void SetConvexHull(std::shared_ptr<const ConvexHull> hull) { auto ptr = std::make_unique<ConvexHullCollision>(std::move(hull)); m_Type = ColliderType::ConvexHull; SetShape(std::move(ptr)); }
+
+	// ブロードフェーズの区分（静的かどうか）が変わるかもしれないので知らせる
+	void MarkBroadphaseDirty() { if (m_Id >= 0) Manager::GetScene()->physicsSystem().MarkBroadphaseDirty(); }
 
 	// ==================================================
-	// ----- CtTCN -----
+	// ----- ライフサイクル -----
 	// ==================================================
 	void OnAdded() override
 	{
-		//RegisterColider̒UpdateWorldAABBĂԂ̂Őɏ
+		//RegisterColiderの中でUpdateWorldAABBを呼ぶので先に初期化する
 		SetSphere(1);
 
-		//  World p̓
+		// ここで World 姿勢の同期
 		UpdateWorldPose();
 		 
-		//  PhysicsSystem ɓo^iID̔ԁj
+		// ここで PhysicsSystem に登録（ID採番）
 		m_Id = Manager::GetScene()->physicsSystem().RegisterCollider(this);
 	}
 	void Uninit() override
 	{
-		// 폜
+		// 削除処理
 		Manager::GetScene()->physicsSystem().UnregisterCollider(this);
 	}
-	void FixedUpdate(float dt) override
-	{
-		UpdateWorldAABB(); // `̓
-		UpdateWorldPose(); // `̓
-	}
-
-	void OnTriggerEnter(class Collider* me, class Collider* other) override
+	void FixedUpdate(float /*dt*/) override
 	{
-		//printf("");
+		UpdateWorldAABB(); // 形状の同期
+		UpdateWorldPose(); // 形状の同期
 	}
-	void OnTriggerExit(class Collider* me, class Collider* other)
+	void OnTransformMoved() override
 	{
-		//printf("ꂽ");		
+		// 静的な区分の間だけ Transform を見張っている（PhysicsSystem が付け外しする）
+		if (m_pPhysics) m_pPhysics->RequestStaticRefresh(this);
 	}
 
 public:
@@ -1,7 +1,7 @@
 /*
 	ColliderPose.h
 	20260125  hanaue sho
-	ColliderComponent  TransformComponent + offset ̓蔻
+	ColliderComponent で TransformComponent + offset の当たり判定
 */
 #ifndef COLLIDERPOSE_H_
 #define COLLIDERPOSE_H_
@@ -14,10 +14,10 @@ struct ColliderPose
 	Quaternion rotation;
 	Vector3 scale;
 
-	// ֗
+	// 便利
 	Vector3 WorldRight()   const 
 	{ 
-		//return rotation.Rotate({ 1, 0, 0 }).normalized(); // ƂȂsɂȂ
+		//return rotation.Rotate({ 1, 0, 0 }).normalized(); // こっちだとなぜか不安定になる
 		Matrix4x4 R = rotation.ToMatrix();
 		return Vector3(R.m[0][0], R.m[0][1], R.m[0][2]).normalized();
 	}
@@ -1,12 +1,28 @@
 /*
 	Component.h
 	20250813  hanaue sho
-	wẐ
+	学校のやつを改造
 */
 #ifndef COMPONENT_H_
 #define COMPONENT_H_
+#include <cstdint>
+#include <type_traits>
 
-class GameObject; // O錾
+class GameObject; // 前方宣言
+class Collider;
+
+// --------------------------------------------------
+// 物理イベント（GameObject の受け手の登録で使うビット）
+// --------------------------------------------------
+enum PhysicsEvent : uint8_t
+{
+	PhysicsEventTriggerEnter   = 1 << 0,
+	PhysicsEventTriggerStay	   = 1 << 1,
+	PhysicsEventTriggerExit	   = 1 << 2,
+	PhysicsEventCollisionEnter = 1 << 3,
+	PhysicsEventCollisionStay  = 1 << 4,
+	PhysicsEventCollisionExit  = 1 << 5,
+};
 
 class Component
 {
@@ -17,38 +33,67 @@ public:
 	Component() = default;
 	virtual ~Component() = default;
 
-	// L҃ANZXiǂݎpAPIj
+	// 所有者アクセス（読み取り専用API）
 	GameObject*			Owner()		  noexcept  { return m_pOwner; }
 	const GameObject*	Owner() const noexcept	{ return m_pOwner; }
 
-	// ----- CtTCN -----
-	virtual void OnAdded() {}		// AddComponent
-	virtual void Init() {}			// GameObject.Init()
-	virtual void Uninit() {}		// GameObjectj
+	// ----- ライフサイクル -----
+	virtual void OnAdded() {}		// AddComponent時
+	virtual void Init() {}			// GameObject.Init()時
+	virtual void Uninit() {}		// GameObject破棄時
 
-	// ----- XV -----
-	virtual void FixedUpdate(float dt) {}	// ŒXViZnj
-	virtual void Update(float dt) {}		// ʏXV
-	virtual void Draw() {}					// `
+	// ----- 更新 -----
+	virtual void FixedUpdate(float /*dt*/) {}	// 固定更新（物理演算系）
+	virtual void Update(float /*dt*/) {}		// 通常更新
+	virtual void Draw() {}					// 描画
 
-	// ----- fBXpb` -----
-	virtual void OnTriggerEnter(class Collider* me, class Collider* other) {}
-	virtual void OnTriggerStay (class Collider* me, class Collider* other) {}
-	virtual void OnTriggerExit (class Collider* me, class Collider* other) {}
+	// ----- ディスパッチ -----
+	virtual void OnTriggerEnter(class Collider* /*me*/, class Collider* /*other*/) {}
+	virtual void OnTriggerStay (class Collider* /*me*/, class Collider* /*other*/) {}
+	virtual void OnTriggerExit (class Collider* /*me*/, class Collider* /*other*/) {}
 
-	virtual void OnCollisionEnter(class Collider* me, class Collider* other) {}
-	virtual void OnCollisionStay (class Collider* me, class Collider* other) {}
-	virtual void OnCollisionExit (class Collider* me, class Collider* other) {}
+	virtual void OnCollisionEnter(class Collider* /*me*/, class Collider* /*other*/) {}
+	virtual void OnCollisionStay (class Collider* /*me*/, class Collider* /*other*/) {}
+	virtual void OnCollisionExit (class Collider* /*me*/, class Collider* /*other*/) {}
 
+	// ----- 通知 -----
+	virtual void OnTransformMoved() {} // 見張っている Transform が書き換えられた時（TransformComponent::SetMoveWatcher）
 
-	// Rs[A[u͌֎~iL҂ƃCtTCNނ߁j
+	// コピー、ムーブは原則禁止（所有者とライフサイクルが絡むため）
 	Component(const Component&) = delete;
 	Component& operator =(const Component&) = delete;
 	Component(Component&&) = delete;
 	Component& operator =(const Component&&) = delete;
 
-	// owner ݒł̂ GameObject Ɍ
+	// owner を設定できるのは GameObject だけに限定
 	friend class GameObject;
 };
 
+// --------------------------------------------------
+// 物理イベントの受け手（GameObject が AddComponent で登録する）
+// --------------------------------------------------
+struct PhysicsListener
+{
+	Component* component;
+	uint8_t	   events; // PhysicsEvent のビット
+};
+
+// --------------------------------------------------
+// T が実際に上書きしている物理イベント（AddComponent で調べる）
+// 上書きしていなければ &T::OnXxx は Component のメンバー関数ポインタのまま
+// --------------------------------------------------
+template<class T>
+constexpr uint8_t PhysicsEventsOf()
+{
+	using Fn = void (Component::*)(Collider*, Collider*);
+	uint8_t events = 0;
+	if (!std::is_same_v<decltype(&T::OnTriggerEnter)  , Fn>) events |= PhysicsEventTriggerEnter;
+	if (!std::is_same_v<decltype(&T::OnTriggerStay)	  , Fn>) events |= PhysicsEventTriggerStay;
+	if (!std::is_same_v<decltype(&T::OnTriggerExit)	  , Fn>) events |= PhysicsEventTriggerExit;
+	if (!std::is_same_v<decltype(&T::OnCollisionEnter), Fn>) events |= PhysicsEventCollisionEnter;
+	if (!std::is_same_v<decltype(&T::OnCollisionStay) , Fn>) events |= PhysicsEventCollisionStay;
+	if (!std::is_same_v<decltype(&T::OnCollisionExit) , Fn>) events |= PhysicsEventCollisionExit;
+	return events;
+}
+
 #endif
\ No newline at end of file
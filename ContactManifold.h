@@ -1,7 +1,7 @@
 /*
 	ContactManifold.h
 	20250901  hanaue sho
-	ڐG_̏̍\
+	接触点の情報の構造体
 */
 #ifndef CONTACTMANIFOLD_H_
 #define CONTACTMANIFOLD_H_
@@ -9,59 +9,59 @@
 
 
 // ==================================================
-// ----- ڐG_P̏̍\ -----
+// ----- 接触点１つあたりの情報の構造体 -----
 // ==================================================
 struct ContactPoint
 {
 	// --------------------------------------------------
-	// ڐG_̈ʒu
+	// 接触点の位置
 	// --------------------------------------------------
-	Vector3 pointOnA{}; // Ã[JڐG_iA̕\ʏj
-	Vector3 pointOnB{}; // B̃[JڐG_iB̕\ʏj
+	Vector3 pointOnA{}; // Aのローカル接触点（Aの表面上）
+	Vector3 pointOnB{}; // Bのローカル接触点（Bの表面上）
 	// --------------------------------------------------
-	// ѓ[x
+	// 貫入深度
 	// --------------------------------------------------
 	float penetration = 0.0f; 
 	// --------------------------------------------------
-	// @̗ݐϐKCpXiPȂXJ[ŗǂj
+	// 法線の累積正規インパルス（１軸ならスカラーで良い）
 	// --------------------------------------------------
 	float accumN = 0.0f; 
 	// --------------------------------------------------
-	// ڐ̗ݐϐKCpXiPȂXJ[ŗǂj
+	// 接線の累積正規インパルス（１軸ならスカラーで良い）
 	// --------------------------------------------------
 	Vector3 accumImpulseT = Vector3();
 	// --------------------------------------------------
-	// Փ˓_̔oCAX
-	// t[̍ŏŌvẐi[
+	// 衝突点の反発バイアス
+	// フレームの最初で計算したものを格納する
 	// --------------------------------------------------
 	float restitutionBias = 0.0f;
 };
 
 // ==================================================
-// ----- ڐG_̏̍\ -----
+// ----- 接触点の情報の構造体 -----
 // ==================================================
 struct ContactManifold
 {
 	// --------------------------------------------------
-	// ڐG_̍ő
+	// 接触点の最大個数
 	// --------------------------------------------------
-	static constexpr int MAX_POINTS = 4; // OBB*OBB Ȃ̂łS
+	static constexpr int MAX_POINTS = 4; // OBB*OBB なので４つに
 	// --------------------------------------------------
-	// GĂ邩
+	// 触れているか判定
 	// --------------------------------------------------
 	bool touching = false;
 	// --------------------------------------------------
-	// A  B ւ̒PʃxNg
+	// A → B への単位ベクトル
 	// --------------------------------------------------
 	Vector3 normal{};
 	// --------------------------------------------------
-	// LȐڐG_̐
+	// 有効な接触点の数
 	// --------------------------------------------------
 	int count = 0;
 	// --------------------------------------------------
-	// Փ˓_P̏
+	// 衝突点１つ当たりの情報
 	// --------------------------------------------------
-	ContactPoint points[4]; // őS_
+	ContactPoint points[4]; // 最大４点
 };
 
 #endif
\ No newline at end of file
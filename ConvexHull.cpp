@@ -0,0 +1,279 @@
+/*
+	ConvexHull.cpp
+	20261017  hanaue sho
+	当たり判定用の凸包（頂点群から作る）
+*/
+#include <algorithm>
+#include <unordered_map>
+#include <cstdint>
+#include <math.h>
+#include "ConvexHull.h"
+
+// ==================================================
+// ヘルパ関数
+// ==================================================
+namespace
+{
+	// 作成途中の三角形（外から見て反時計回り）
+	struct HullTriangle
+	{
+		int		v[3];
+		Vector3 normal;
+		float	distance = 0.0f;
+		bool	alive = true;
+	};
+	HullTriangle MakeTriangle(const std::vector<Vector3>& p, int a, int b, int c)
+	{
+		HullTriangle t;
+		t.v[0] = a; t.v[1] = b; t.v[2] = c;
+		t.normal = Vector3::Cross(p[b] - p[a], p[c] - p[a]).normalized();
+		t.distance = Vector3::Dot(t.normal, p[a]);
+		return t;
+	}
+	// 辺のキー（向き付き）
+	int64_t EdgeKey(int a, int b) { return ((int64_t)a << 32) | (uint32_t)b; }
+}
+
+// ==================================================
+// ----- 構築 -----
+// 四面体から始めて、外側の点を１つずつ足していく（見える面を消して、地平線の辺と点で面を張る）
+// ==================================================
+ConvexHull::ConvexHull(const std::vector<Vector3>& points)
+{
+	const int n = (int)points.size();
+	assert(n >= 4 && "ConvexHull needs at least 4 points");
+	if (n < 4) return;
+
+	// ----- 許容誤差は大きさに合わせる -----
+	Vector3 bmin = points[0], bmax = points[0];
+	for (const Vector3& p : points)
+	{
+		bmin = { std::min(bmin.x, p.x), std::min(bmin.y, p.y), std::min(bmin.z, p.z) };
+		bmax = { std::max(bmax.x, p.x), std::max(bmax.y, p.y), std::max(bmax.z, p.z) };
+	}
+	const Vector3 size = bmax - bmin;
+	const float eps = std::max(1e-6f, 1e-5f * std::max(size.x, std::max(size.y, size.z)));
+
+	// ----- 最初の四面体（なるべく大きく取る） -----
+	int i0 = 0;
+	for (int i = 1; i < n; i++) if (points[i].x < points[i0].x) i0 = i;
+	int i1 = i0;
+	float best = 0.0f;
+	for (int i = 0; i < n; i++)
+	{
+		const float d = (points[i] - points[i0]).lengthSq();
+		if (d > best) { best = d; i1 = i; }
+	}
+	int i2 = i0;
+	best = 0.0f;
+	for (int i = 0; i < n; i++)
+	{
+		const float d = Vector3::Cross(points[i1] - points[i0], points[i] - points[i0]).lengthSq();
+		if (d > best) { best = d; i2 = i; }
+	}
+	int i3 = i0;
+	best = 0.0f;
+	const Vector3 baseNormal = Vector3::Cross(points[i1] - points[i0], points[i2] - points[i0]).normalized();
+	for (int i = 0; i < n; i++)
+	{
+		const float d = fabsf(Vector3::Dot(baseNormal, points[i] - points[i0]));
+		if (d > best) { best = d; i3 = i; }
+	}
+	if (i1 == i0 || i2 == i0 || best <= eps)
+	{
+		assert(false && "ConvexHull points are flat");
+		return;
+	}
+
+	std::vector<HullTriangle> tris;
+	const Vector3 inside = (points[i0] + points[i1] + points[i2] + points[i3]) * 0.25f;
+	auto addTriangle = [&](int a, int b, int c)
+		{
+			HullTriangle t = MakeTriangle(points, a, b, c);
+			if (Vector3::Dot(t.normal, inside) - t.distance > 0.0f) t = MakeTriangle(points, a, c, b); // 内側を向いていたら裏返す
+			tris.push_back(t);
+		};
+	addTriangle(i0, i1, i2);
+	addTriangle(i0, i1, i3);
+	addTriangle(i1, i2, i3);
+	addTriangle(i2, i0, i3);
+
+	// ----- 点を１つずつ足す -----
+	std::vector<int> visible;
+	std::vector<int64_t> edges;
+	std::vector<std::pair<int, int>> horizon;
+	for (int i = 0; i < n; i++)
+	{
+		if (i == i0 || i == i1 || i == i2 || i == i3) continue;
+		const Vector3& p = points[i];
+
+		visible.clear();
+		for (int t = 0; t < (int)tris.size(); t++)
+			if (tris[t].alive && Vector3::Dot(tris[t].normal, p) - tris[t].distance > eps) visible.push_back(t);
+		if (visible.empty()) continue; // 内側
+
+		// 見える面の辺のうち、逆向きの辺が見える面に無いものが地平線
+		edges.clear();
+		for (int t : visible)
+			for (int k = 0; k < 3; k++)
+				edges.push_back(EdgeKey(tris[t].v[k], tris[t].v[(k + 1) % 3]));
+		std::sort(edges.begin(), edges.end());
+		horizon.clear();
+		for (int t : visible)
+		{
+			for (int k = 0; k < 3; k++)
+			{
+				const int a = tris[t].v[k], b = tris[t].v[(k + 1) % 3];
+				if (!std::binary_search(edges.begin(), edges.end(), EdgeKey(b, a))) horizon.push_back({ a, b });
+			}
+			tris[t].alive = false;
+		}
+		for (const auto& e : horizon) tris.push_back(MakeTriangle(points, e.first, e.second, i)); // 向きは消した面と同じ
+
+		// 死んだ面が増えたら詰める
+		if (tris.size() > 64 && std::count_if(tris.begin(), tris.end(), [](const HullTriangle& t) { return t.alive; }) * 2 < (int)tris.size())
+			tris.erase(std::remove_if(tris.begin(), tris.end(), [](const HullTriangle& t) { return !t.alive; }), tris.end());
+	}
+
+	// ----- 使っている頂点だけ残す -----
+	std::vector<int> remap(n, -1);
+	std::vector<int> indices;
+	for (const HullTriangle& t : tris)
+	{
+		if (!t.alive) continue;
+		for (int k = 0; k < 3; k++)
+		{
+			if (remap[t.v[k]] < 0)
+			{
+				remap[t.v[k]] = (int)m_Vertices.size();
+				m_Vertices.push_back(points[t.v[k]]);
+			}
+			indices.push_back(remap[t.v[k]]);
+		}
+	}
+
+	BuildFacesAndAdjacency(indices, eps);
+}
+// --------------------------------------------------
+// 同じ平面の三角形を多角形の面にまとめ、面の辺から頂点の隣接を作る
+// 種の三角形の平面から eps 以上ずれる三角形はまとめない（曲面が１枚の面に潰れないように）
+// --------------------------------------------------
+void ConvexHull::BuildFacesAndAdjacency(const std::vector<int>& triangles, float eps)
+{
+	const int triCount = (int)triangles.size() / 3;
+	std::vector<HullTriangle> tris(triCount);
+	for (int t = 0; t < triCount; t++)
+		tris[t] = MakeTriangle(m_Vertices, triangles[t * 3 + 0], triangles[t * 3 + 1], triangles[t * 3 + 2]);
+
+	// ----- 向き付き辺 → 三角形 -----
+	std::unordered_map<int64_t, int> edgeToTri;
+	for (int t = 0; t < triCount; t++)
+		for (int k = 0; k < 3; k++)
+			edgeToTri[EdgeKey(tris[t].v[k], tris[t].v[(k + 1) % 3])] = t;
+
+	// ----- 種の三角形と同じ平面の隣をまとめる -----
+	const float PlaneCos = 1.0f - 1e-4f;
+	std::vector<int> group(triCount, -1);
+	std::vector<int> members, stack;
+	std::unordered_map<int, int> next; // 境界の辺（始点 → 終点）
+	for (int seed = 0; seed < triCount; seed++)
+	{
+		if (group[seed] >= 0) continue;
+		const int id = (int)m_Faces.size();
+		members.clear();
+		stack.assign(1, seed);
+		group[seed] = id;
+		while (!stack.empty())
+		{
+			const int t = stack.back();
+			stack.pop_back();
+			members.push_back(t);
+			for (int k = 0; k < 3; k++)
+			{
+				auto it = edgeToTri.find(EdgeKey(tris[t].v[(k + 1) % 3], tris[t].v[k])); // 隣（逆向きの辺を持つ三角形）
+				if (it == edgeToTri.end()) continue;
+				const int u = it->second;
+				if (group[u] >= 0 || Vector3::Dot(tris[u].normal, tris[seed].normal) < PlaneCos) continue;
+				bool onPlane = true;
+				for (int m = 0; m < 3; m++)
+					onPlane &= fabsf(Vector3::Dot(tris[seed].normal, m_Vertices[tris[u].v[m]]) - tris[seed].distance) <= eps;
+				if (!onPlane) continue;
+				group[u] = id;
+				stack.push_back(u);
+			}
+		}
+
+		// ----- 境界の辺をつないで多角形にする -----
+		next.clear();
+		Vector3 normal{};
+		for (int t : members)
+		{
+			const HullTriangle& tri = tris[t];
+			normal += Vector3::Cross(m_Vertices[tri.v[1]] - m_Vertices[tri.v[0]], m_Vertices[tri.v[2]] - m_Vertices[tri.v[0]]); // 面積の重み付き
+			for (int k = 0; k < 3; k++)
+			{
+				const int a = tri.v[k], b = tri.v[(k + 1) % 3];
+				auto it = edgeToTri.find(EdgeKey(b, a));
+				if (it == edgeToTri.end() || group[it->second] != id) next[a] = b;
+			}
+		}
+		Face face;
+		face.normal = normal.normalized();
+		face.distance = -1e30f;
+		face.first = (int)m_FaceVertices.size();
+		const int start = next.begin()->first;
+		int v = start;
+		do
+		{
+			m_FaceVertices.push_back(v);
+			face.distance = std::max(face.distance, Vector3::Dot(face.normal, m_Vertices[v])); // 全頂点が内側に入るように
+			face.count++;
+			auto it = next.find(v);
+			if (it == next.end()) break;
+			v = it->second;
+		} while (v != start && face.count <= (int)next.size());
+		assert(v == start && face.count == (int)next.size() && "ConvexHull face is not a simple polygon");
+		m_Faces.push_back(face);
+	}
+
+	// ----- 面の内側だけにある頂点（まとめた面の真ん中）を捨てる -----
+	std::vector<int> remap(m_Vertices.size(), -1);
+	std::vector<Vector3> used;
+	for (int& v : m_FaceVertices)
+	{
+		if (remap[v] < 0)
+		{
+			remap[v] = (int)used.size();
+			used.push_back(m_Vertices[v]);
+		}
+		v = remap[v];
+	}
+	m_Vertices.swap(used);
+
+	// ----- 隣接（面の辺、重複は除く） -----
+	std::vector<std::vector<int>> adj(m_Vertices.size());
+	for (const Face& f : m_Faces)
+	{
+		for (int k = 0; k < f.count; k++)
+		{
+			const int a = m_FaceVertices[f.first + k];
+			const int b = m_FaceVertices[f.first + (k + 1) % f.count];
+			if (std::find(adj[a].begin(), adj[a].end(), b) == adj[a].end()) adj[a].push_back(b);
+			if (std::find(adj[b].begin(), adj[b].end(), a) == adj[b].end()) adj[b].push_back(a);
+		}
+	}
+	m_AdjOffset.assign(1, 0);
+	for (const auto& list : adj)
+	{
+		m_Adj.insert(m_Adj.end(), list.begin(), list.end());
+		m_AdjOffset.push_back((int)m_Adj.size());
+	}
+
+	// ----- 重心と、重心から一番近い面までの距離 -----
+	m_Centroid = Vector3();
+	for (const Vector3& v : m_Vertices) m_Centroid += v;
+	m_Centroid = m_Centroid / (float)m_Vertices.size();
+	m_InnerRadius = 1e30f;
+	for (const Face& f : m_Faces)
+		m_InnerRadius = std::min(m_InnerRadius, f.distance - Vector3::Dot(f.normal, m_Centroid));
+}
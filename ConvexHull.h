@@ -0,0 +1,99 @@
+/*
+	ConvexHull.h
+	20261017  hanaue sho
+	当たり判定用の凸包（頂点群から作る）
+	ローカル空間で持つので、同じアセットのコライダー同士で共有できる
+*/
+#ifndef CONVEXHULL_H_
+#define CONVEXHULL_H_
+#include <vector>
+#include <assert.h>
+#include "Vector3.h"
+
+// ==================================================
+// ----- クラス本体 -----
+// ==================================================
+class ConvexHull
+{
+public:
+	// --------------------------------------------------
+	// 面（同じ平面の三角形はまとめて多角形にする）
+	// 頂点は外から見て反時計回り、FaceVertex(first) ～ FaceVertex(first + count - 1)
+	// --------------------------------------------------
+	struct Face
+	{
+		Vector3 normal;		   // 外向き（正規化済み）
+		float	distance = 0.0f; // Dot(normal, p) = distance が面
+		int		first = 0;
+		int		count = 0;
+	};
+
+private:
+	std::vector<Vector3> m_Vertices;	// 凸包の頂点だけ（内側の点は捨てる）
+	std::vector<int>	 m_AdjOffset;	// 頂点 i の隣は m_Adj[m_AdjOffset[i]] ～ m_Adj[m_AdjOffset[i + 1] - 1]
+	std::vector<int>	 m_Adj;
+	std::vector<Face>	 m_Faces;
+	std::vector<int>	 m_FaceVertices;
+	Vector3 m_Centroid{};
+	float	m_InnerRadius = 0.0f;		// 重心から一番近い面までの距離
+
+public:
+	// ==================================================
+	// ----- コンストラクタ -----
+	// 点群から凸包を作る（重なり、内側の点は捨てる）
+	// ==================================================
+	explicit ConvexHull(const std::vector<Vector3>& points);
+
+	// ==================================================
+	// ----- ゲッター -----
+	// ==================================================
+	int VertexCount() const { return (int)m_Vertices.size(); }
+	int FaceCount() const { return (int)m_Faces.size(); }
+	const Vector3& Vertex(int i) const { return m_Vertices[i]; }
+	const Face& GetFace(int i) const { return m_Faces[i]; }
+	const Vector3& FaceVertex(const Face& face, int k) const { return m_Vertices[m_FaceVertices[face.first + k]]; }
+	const Vector3& Centroid() const { return m_Centroid; }
+	float InnerRadius() const { return m_InnerRadius; }
+
+	// --------------------------------------------------
+	// dir 方向で一番遠い頂点（ローカル）
+	// 隣の頂点をたどって登っていく（凸なので局所最大＝最大）
+	// hint は前回の答え（次の呼び出しの出発点に使う）
+	// --------------------------------------------------
+	int SupportIndex(const Vector3& dir, int hint = 0) const
+	{
+		assert(!m_Vertices.empty());
+		int best = (0 <= hint && hint < VertexCount()) ? hint : 0;
+		float bestDot = Vector3::Dot(m_Vertices[best], dir);
+		for (bool moved = true; moved; )
+		{
+			moved = false;
+			for (int k = m_AdjOffset[best]; k < m_AdjOffset[best + 1]; k++)
+			{
+				const int n = m_Adj[k];
+				const float d = Vector3::Dot(m_Vertices[n], dir);
+				if (d > bestDot) { bestDot = d; best = n; moved = true; }
+			}
+		}
+		return best;
+	}
+	// --------------------------------------------------
+	// dir 方向に一番向いている面
+	// --------------------------------------------------
+	int SupportFace(const Vector3& dir) const
+	{
+		int best = 0;
+		float bestDot = -1e30f;
+		for (int i = 0; i < FaceCount(); i++)
+		{
+			const float d = Vector3::Dot(m_Faces[i].normal, dir);
+			if (d > bestDot) { bestDot = d; best = i; }
+		}
+		return best;
+	}
+
+private:
+	void BuildFacesAndAdjacency(const std::vector<int>& triangles, float eps);
+};
+
+#endif
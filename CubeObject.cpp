@@ -12,21 +12,21 @@
 #include "MeshRendererComponent.h"
 #include "RigidbodyComponent.h"
 #include "Renderer.h"
-#include "Texture.h"  // Texture::Load 
+#include "Texture.h"  // Texture::Load 既存
 
 void CubeObject::Init()
 {
-	// 1) Transformi GameObject ctor Œǉς݁j擾ďpĂ
+	// 1) Transform（既に GameObject ctor で追加済み）を取得して初期姿勢を入れておく
 	auto* tf = GetComponent<TransformComponent>();
 	tf->SetPosition({ 0,0,0 });
 	tf->SetScale({ 1,1,1 });
 	tf->SetEulerAngles({ 0,0,0 });
 
-	// 2) MeshFilter ǉĒ_obt@i4_̋`j
+	// 2) MeshFilter を追加して頂点バッファ（4頂点の矩形）を作る
 	auto* mf = AddComponent<MeshFilterComponent>();
 	MeshFactory::CreateCube(mf, { {1, 1, 1} });
 
-	// 3) Material ǉiVF[_/eNX`/}eAj
+	// 3) Material を追加（シェーダ/テクスチャ/マテリアル）
 	auto* mat = AddComponent<MaterialComponent>();
 
 	ID3D11VertexShader* vs = nullptr;
@@ -36,12 +36,12 @@ void CubeObject::Init()
 	Renderer::CreatePixelShader(&ps, "shader\\PS_Toon.cso");
 	mat->SetVSPS(vs, ps, il, /*takeVS*/true, /*takePS*/true, /*takeIL*/true);
 
-	// eNX`Zbg
+	// テクスチャセット
 	ID3D11ShaderResourceView* srv = Texture::LoadAndRegisterKey("assets\\texture\\Apple.png");
-	// Tv[ Renderer::Init()  0Ԃ PSSetSamplers ς݂Ȃ null ł`
+	// サンプラーは Renderer::Init() で 0番に PSSetSamplers 済みなら null でも描ける
 	mat->SetMainTexture(srv, /*sampler*/nullptr, /*takeSrv*/false, /*takeSamp*/false);
 
-	// }eAZbg
+	// マテリアルセット
 	MaterialApp m{};
 	m.diffuse = Vector4(1, 1, 1, 1);
 	m.ambient = Vector4(1, 1, 1, 1);
@@ -49,13 +49,13 @@ void CubeObject::Init()
 	m.textureEnable = TRUE;
 	mat->SetMaterial(m);
 
-	// eNX`̉\̂ŃAt@uh
+	// 透明テクスチャの可能性が高いのでアルファブレンドに
 	mat->SetBlendMode(/*Alpha*/MaterialComponent::BlendMode::Opaque);
 
-	// 4) MeshRenderer ǉi`sWj
+	// 4) MeshRenderer を追加（描画実行係）
 	auto* mr = AddComponent<MeshRendererComponent>();
 
-	// AEgC}eAǉ
+	// アウトラインマテリアル追加
 	auto* matOutline = AddComponent<MaterialComponent>();
 	Renderer::CreateVertexShader(&vs, &il, "shader\\VS_Outline.cso");
 	Renderer::CreatePixelShader(&ps, "shader\\PS_Outline.cso");
@@ -63,7 +63,7 @@ void CubeObject::Init()
 	matOutline->SetBlendMode(/*Alpha*/MaterialComponent::BlendMode::Opaque);
 	mr->SetOutlineMaterial(matOutline);
 
-	// 𓭂̂ŃRC_[Ȃǂݒ
+	// 物理を働かせたいのでコライダーなどを設定
 	Collider* coll = AddComponent<Collider>();
 	coll->SetBox({0.5f, 0.5f, 0.5f});
 	coll->SetModeSimulate();
@@ -74,7 +74,7 @@ void CubeObject::Init()
 	rigid->SetMass(1.0f);
 	rigid->ComputeBoxInertia({0.5f, 0.5f, 0.5f});
 
-	// C[Zbg
+	// レイヤーセット
 	SetPhysicsLayer(1);
 }
 
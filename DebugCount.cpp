@@ -1,7 +1,7 @@
 /*
 	DebugCount.h
 	20251010  hanaue sho
-	fobOŃJEg悤
+	デバッグでカウントするよう
 */
 #include "DebugCount.h"
 
@@ -9,7 +9,7 @@ std::map<std::string, int> DebugCount::m_Counters;
 
 void DebugCount::Count(const std::string& name, int n)
 {
-	// name ݂Ȃꍇ͂OŎ
+	// name が存在しない場合は０で自動生成される
 	m_Counters[name] += n;
 }
 
@@ -1,7 +1,7 @@
 /*
 	DebugCount.h
 	20251010  hanaue sho
-	fobOŃJEg悤
+	デバッグでカウントするよう
 */
 #ifndef DEBUGCOUNTER_H_
 #define DEBUGCOUNTER_H_
@@ -1,7 +1,7 @@
 /*
 	DebugRendereComponent.h
 	20251130  hanaue sho
-	RC_[̃C[t[\Ȃ
+	コライダーのワイヤーフレーム表示など
 */
 #include <cmath>
 #include <cstdio>
@@ -14,11 +14,11 @@
 
 void DebugRenderer::Initialize()
 {
-	// Reï̗m
+	// コンテナの領域確保
 	m_Vertexes.reserve(MaxVertexes);
 	m_Indexes.reserve(MaxIndexes);
 
-	// _obt@쐬
+	// 頂点バッファ作成
 	D3D11_BUFFER_DESC bd = {};
 	bd.ByteWidth	  = sizeof(DebugVertex) * MaxVertexes;
 	bd.Usage		  = D3D11_USAGE_DYNAMIC;
@@ -27,7 +27,7 @@ void DebugRenderer::Initialize()
 
 	Renderer::Device()->CreateBuffer(&bd, nullptr, m_VertexBuffer.GetAddressOf());
 
-	// CfbNXobt@쐬
+	// インデックスバッファ作成
 	D3D11_BUFFER_DESC ibd = {};
 	ibd.ByteWidth	   = sizeof(int) * MaxIndexes;
 	ibd.Usage		   = D3D11_USAGE_DYNAMIC;
@@ -36,8 +36,8 @@ void DebugRenderer::Initialize()
 
 	Renderer::Device()->CreateBuffer(&ibd, nullptr, m_IndexBuffer.GetAddressOf());
 
-	// VF[_[쐬
-	// t@Cl[T
+	// シェーダー作成
+	// ファイルネームから探す
 	FILE* file = fopen("shader\\VS_Debug.cso", "rb");
 	assert(file);
 	long int fsize = _filelength(_fileno(file));
@@ -47,7 +47,7 @@ void DebugRenderer::Initialize()
 
 	Renderer::Device()->CreateVertexShader(buffer.get(), fsize, NULL, m_VS.GetAddressOf());
 
-	// DebugDraw p InputLayout 
+	// DebugDraw 用の InputLayout を作る
 	D3D11_INPUT_ELEMENT_DESC layout[] =
 	{
 		{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT,	 0,	(UINT)offsetof(DebugVertex, pos)  , D3D11_INPUT_PER_VERTEX_DATA, 0 },
@@ -84,18 +84,18 @@ void DebugRenderer::Flush()
 
 	auto* ctx = Renderer::DeviceContext();
 
-	// VB ɒ_f[^
+	// VB に頂点データを書き込む
 	D3D11_MAPPED_SUBRESOURCE mapped;
 	ctx->Map(m_VertexBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped);
 	memcpy(mapped.pData, m_Vertexes.data(), sizeof(DebugVertex) * m_Vertexes.size());
 	ctx->Unmap(m_VertexBuffer.Get(), 0);
 
-	// IB ɃCfbNX
+	// IB にインデックスを書き込む
 	ctx->Map(m_IndexBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped);
 	memcpy(mapped.pData, m_Indexes.data(), sizeof(int) * m_Indexes.size());
 	ctx->Unmap(m_IndexBuffer.Get(), 0);
 
-	// pCvCɃZbg
+	// パイプラインにセット
 	UINT stride = sizeof(DebugVertex);
 	UINT offset = 0;
 	ID3D11Buffer* vb = m_VertexBuffer.Get();
@@ -116,24 +116,24 @@ void DebugRenderer::Flush()
 
 void DebugRenderer::DrawLine(const Vector3& p0, const Vector3& p1, const Vector4& color)
 {
-	// ̒_T
+	// 今の頂点数を控える
 	int baseIndex = (int)m_Vertexes.size();
 
-	// _Qǉ
+	// 頂点を２つ追加
 	m_Vertexes.push_back({ p0, color });
 	m_Vertexes.push_back({ p1, color });
 
-	// CfbNXQǉ
+	// インデックスを２つ追加
 	m_Indexes.push_back(baseIndex + 0);
 	m_Indexes.push_back(baseIndex + 1);
 }
 
 void DebugRenderer::DrawBox(const Vector3& center, const Vector3& halfSize, const Matrix4x4& rotation, const Vector4& color)
 {
-	// ݂̒_T
+	// 現在の頂点数を控える
 	int baseIndex = (int)m_Vertexes.size();
 
-	// W_ǉ
+	// ８頂点を追加
 	Vector3 local[8] =
 	{
 		{-halfSize.x, -halfSize.y, -halfSize.z},
@@ -148,13 +148,13 @@ void DebugRenderer::DrawBox(const Vector3& center, const Vector3& halfSize, cons
 	for (int i = 0; i < 8; i++)
 	{
 		Vector3 p = local[i];
-		p = rotation.TransformNormal(p); // ]Kp
-		p += center; // S𑫂ă[hW
+		p = rotation.TransformNormal(p); // 回転を適用
+		p += center; // 中心を足してワールド座標へ
 
 		m_Vertexes.push_back({ p, color });
 	}
 
-	// PQ{̃GbWCfbNXƂĒǉ
+	// １２本のエッジをインデックスとして追加
 	auto AddEdge = [&](int a, int b)
 		{
 			m_Indexes.push_back(baseIndex + a);
@@ -219,7 +219,7 @@ void DebugRenderer::DrawSphere(const Vector3& center, float radius, const Matrix
 					m_Indexes.push_back(baseIndex + i);
 				}
 			}
-			// Ōƍŏ
+			// 最後と最初を結ぶ
 			m_Indexes.push_back(baseIndex + segments - 1);
 			m_Indexes.push_back(baseIndex + 0);
 		};
@@ -239,19 +239,19 @@ void DebugRenderer::DrawCapsule(const Vector3& center, float radius, float cylin
 			p += center;
 			return p;
 		};
-	// [J
+	// ローカル
 	Vector3 bottomLocal = { 0.0f, -halfHeight, 0.0f };
 	Vector3 topLocal = { 0.0f, halfHeight, 0.0f };
 
-	// [h
+	// ワールド
 	Vector3 bottomWorld = LocalToWorld(bottomLocal);
 	Vector3 topWorld	= LocalToWorld(topLocal);
 
-	// {gAgbv͋̂`
+	// ボトム、トップ部分は球体を描画
 	DrawSphere(bottomWorld, radius, rotation, color);
 	DrawSphere(topWorld,    radius, rotation, color);
 
-	// V_[`
+	// シリンダー部分を描画
 	Vector3 dirs[4] =
 	{
 		{  radius, 0.0f,  0.0f},
@@ -1,7 +1,7 @@
 /*
 	DebugRendereComponent.h
 	20251130  hanaue sho
-	RC_[̃C[t[\Ȃ
+	コライダーのワイヤーフレーム表示など
 */
 #ifndef DEBUGRENDERER_H_
 #define DEBUGRENDERER_H_
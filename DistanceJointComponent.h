@@ -1,7 +1,7 @@
 /*
 	DistanceJointComponent.h
 	20251119  hanaue sho
-	WCgR|[lg
+	距離ジョイントコンポーネント
 */
 #ifndef DISTANCEJOINTCOMPONENT_H_
 #define DISTANCEJOINTCOMPONENT_H_
@@ -15,45 +15,45 @@ class Rigidbody;
 class DistanceJointComponent : public Component
 {
 public:
-	enum DistanceJointMode // CN[ĥō͒PenumŒ`
+	enum DistanceJointMode // 巡回インクルードのせいで今は単純なenumで定義
 	{
-		Rod,		// 
-		Rope,		// 肾
-		Compression // 
+		Rod,		// 押し引き両方
+		Rope,		// 引っ張りだけ
+		Compression // 押しだけ
 	};
 
 private:
 	// ==================================================
-	// ----- vf -----
+	// ----- 要素 -----
 	// ==================================================
 	// --------------------------------------------------
-	// gRigidbody
+	// 自身のRigidbody
     // --------------------------------------------------
 	Rigidbody* m_pRigidbody = nullptr;
 	// --------------------------------------------------
-	// ̃|C^
+	// 相方のポインタ
 	// --------------------------------------------------
 	GameObject* m_pOtherObject = nullptr;
 	// --------------------------------------------------
-	// eAJ[i[JWj
+	// 各アンカー（ローカル座標）
     // --------------------------------------------------
 	Vector3 m_LocalAnchorA = Vector3(0.0f, 0.0f, 0.0f);
 	Vector3 m_LocalAnchorB = Vector3(0.0f, 0.0f, 0.0f);
 	// --------------------------------------------------
-	// AJ[̋
+	// アンカーの距離
 	// --------------------------------------------------
 	float	m_RestLength = 1.0f;
 	// --------------------------------------------------
-	// AJ[̎
+	// アンカーの種類
 	// --------------------------------------------------
 	DistanceJointMode m_Mode = DistanceJointMode::Rod;
 	// --------------------------------------------------
-	// PhysicsSystem ̍̔
+	// PhysicsSystem の採番
 	// --------------------------------------------------
 	int		m_JointId = -1;
 public:
 	// ==================================================
-	// ----- Zb^[EQb^[ -----
+	// ----- セッター・ゲッター -----
 	// ==================================================
 	void SetOtherObject(GameObject* other) { m_pOtherObject = other; }
 	void SetRestLength (float length)	   { m_RestLength = length; }
@@ -73,16 +73,16 @@ public:
 	void SetJointId(int id) { m_JointId = id; }
 
 	// ==================================================
-	// ----- PhysicsSystemւ̓o^ -----
+	// ----- PhysicsSystemへの登録 -----
 	// ==================================================
 	void RegisterToPhysicsSystem()
 	{
-		// ȂǂZbgĂo^i{͍XV֐̕ǂȁj
+		// 相方などをセットしてから登録する（本当は更新する関数の方が良きかな）
 		Manager::GetScene()->physicsSystem().RegisterDistanceJoint(this);
 	}
 
 	// ==================================================
-	// ----- CtTCN -----
+	// ----- ライフサイクル -----
 	// ==================================================
 	void OnAdded() override
 	{
@@ -92,12 +92,12 @@ public:
 			assert(false && "DistanceJoint requires Rigidbody on owner");
 			return;
 		}
-		// PhysicsSystem ɓo^͂ł͍sȂ
+		// PhysicsSystem に登録はここでは行わない
 
 	}
 	void Uninit() override
 	{
-		// PhysicsSystem 폜
+		// PhysicsSystem から削除
 		Manager::GetScene()->physicsSystem().UnregisterDistanceJoint(this);
 	}
 };
@@ -1,7 +1,7 @@
 /*
 	DxDevice.spp
 	20251006  hanaue sho
-	Device, DeviceContext 𐶐NX
+	Device, DeviceContext を生成するクラス
 */
 #include "DxDevice.h"
 #include <cassert>
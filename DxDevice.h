@@ -1,7 +1,7 @@
 /*
 	DxDevice.h
 	20251006  hanaue sho
-	Device, DeviceContext 𐶐NX
+	Device, DeviceContext を生成するクラス
 */
 #ifndef DXDEVICE_H_
 #define DXDEVICE_H_
@@ -13,7 +13,7 @@ class DxDevice
 {
 private:
 	// ==================================================
-	// ----- {̗vf -----
+	// ----- 本体要素 -----
 	// ==================================================
 	ComPtr<ID3D11Device>		m_Device;
 	ComPtr<ID3D11DeviceContext> m_DeviceContext;
@@ -21,7 +21,7 @@ private:
 
 public:
 	// ==================================================
-	// ----- ֐ -----
+	// ----- 関数 -----
 	// ==================================================
 	void Create();
 	ID3D11Device*		 Device()		 const { return m_Device.Get(); }
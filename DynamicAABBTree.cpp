@@ -0,0 +1,359 @@
+/*
+	DynamicAABBTree.cpp
+	20261017  hanaue sho
+	ブロードフェーズ用の動的 AABB 木
+*/
+#include <algorithm>
+#include "DynamicAABBTree.h"
+
+namespace
+{
+	// ２つの AABB を包む AABB
+	AABB Combine(const AABB& a, const AABB& b)
+	{
+		AABB out;
+		out.min = Vector3(std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y), std::min(a.min.z, b.min.z));
+		out.max = Vector3(std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y), std::max(a.max.z, b.max.z));
+		return out;
+	}
+	// 表面積（SAH のコスト）
+	float SurfaceArea(const AABB& a)
+	{
+		const Vector3 d = a.max - a.min;
+		return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+	}
+	// a が b を完全に含んでいるか
+	bool Contains(const AABB& a, const AABB& b)
+	{
+		return a.min.x <= b.min.x && a.min.y <= b.min.y && a.min.z <= b.min.z
+			&& b.max.x <= a.max.x && b.max.y <= a.max.y && b.max.z <= a.max.z;
+	}
+	// マージン分太らせる
+	AABB Fatten(const AABB& a, float margin)
+	{
+		const Vector3 r(margin, margin, margin);
+		AABB out;
+		out.min = a.min - r;
+		out.max = a.max + r;
+		return out;
+	}
+}
+
+// ==================================================
+// ----- プロキシ操作 -----
+// ==================================================
+// --------------------------------------------------
+// 登録、解除
+// --------------------------------------------------
+int DynamicAABBTree::CreateProxy(const AABB& aabb, Collider* pUser)
+{
+	const int id = AllocateNode();
+	Node& node = m_Nodes[id];
+	node.aabb  = Fatten(aabb, FatMargin);
+	node.pUser = pUser;
+	node.height = 0;
+
+	InsertLeaf(id);
+	m_ProxyCount++;
+	return id;
+}
+void DynamicAABBTree::DestroyProxy(int proxyId)
+{
+	assert(0 <= proxyId && proxyId < (int)m_Nodes.size());
+	assert(m_Nodes[proxyId].IsLeaf());
+
+	RemoveLeaf(proxyId);
+	FreeNode(proxyId);
+	m_ProxyCount--;
+}
+// --------------------------------------------------
+// 移動
+// --------------------------------------------------
+bool DynamicAABBTree::MoveProxy(int proxyId, const AABB& aabb)
+{
+	assert(0 <= proxyId && proxyId < (int)m_Nodes.size());
+	assert(m_Nodes[proxyId].IsLeaf());
+
+	// fat AABB の中に収まっているなら木はそのまま
+	if (Contains(m_Nodes[proxyId].aabb, aabb)) return false;
+
+	RemoveLeaf(proxyId);
+	m_Nodes[proxyId].aabb = Fatten(aabb, FatMargin);
+	InsertLeaf(proxyId);
+	return true;
+}
+// --------------------------------------------------
+// 全消去
+// --------------------------------------------------
+void DynamicAABBTree::Clear()
+{
+	m_Nodes.clear();
+	m_Root = NullNode;
+	m_FreeList = NullNode;
+	m_ProxyCount = 0;
+}
+
+// ==================================================
+// ----- 内部処理 -----
+// ==================================================
+// --------------------------------------------------
+// ノード確保、解放（空きリストで再利用）
+// --------------------------------------------------
+int DynamicAABBTree::AllocateNode()
+{
+	int id;
+	if (m_FreeList != NullNode)
+	{
+		id = m_FreeList;
+		m_FreeList = m_Nodes[id].parent;
+	}
+	else
+	{
+		id = (int)m_Nodes.size();
+		m_Nodes.emplace_back();
+	}
+	m_Nodes[id] = Node();
+	return id;
+}
+void DynamicAABBTree::FreeNode(int id)
+{
+	m_Nodes[id] = Node();
+	m_Nodes[id].parent = m_FreeList;
+	m_FreeList = id;
+}
+// --------------------------------------------------
+// 葉の挿入
+// 表面積が一番増えない兄弟を探してペアにする
+// --------------------------------------------------
+void DynamicAABBTree::InsertLeaf(int leaf)
+{
+	if (m_Root == NullNode)
+	{
+		m_Root = leaf;
+		m_Nodes[leaf].parent = NullNode;
+		return;
+	}
+
+	// ----- 兄弟探し -----
+	const AABB leafAABB = m_Nodes[leaf].aabb;
+	int index = m_Root;
+	while (!m_Nodes[index].IsLeaf())
+	{
+		const Node& node = m_Nodes[index];
+		const int left  = node.left;
+		const int right = node.right;
+
+		const float area = SurfaceArea(node.aabb);
+		const float combinedArea = SurfaceArea(Combine(node.aabb, leafAABB));
+
+		// ここに新しい親を作るコスト
+		const float cost = 2.0f * combinedArea;
+		// 下に降りた時に祖先が膨らむコスト
+		const float inheritanceCost = 2.0f * (combinedArea - area);
+
+		auto childCost = [&](int child)
+			{
+				const AABB combined = Combine(m_Nodes[child].aabb, leafAABB);
+				if (m_Nodes[child].IsLeaf())
+					return SurfaceArea(combined) + inheritanceCost;
+				return (SurfaceArea(combined) - SurfaceArea(m_Nodes[child].aabb)) + inheritanceCost;
+			};
+		const float costLeft  = childCost(left);
+		const float costRight = childCost(right);
+
+		// ここが一番安いなら確定
+		if (cost < costLeft && cost < costRight) break;
+
+		index = (costLeft < costRight) ? left : right;
+	}
+	const int sibling = index;
+
+	// ----- 新しい親を作る -----
+	const int oldParent = m_Nodes[sibling].parent;
+	const int newParent = AllocateNode();
+	m_Nodes[newParent].parent = oldParent;
+	m_Nodes[newParent].aabb   = Combine(leafAABB, m_Nodes[sibling].aabb);
+	m_Nodes[newParent].height = m_Nodes[sibling].height + 1;
+	m_Nodes[newParent].left   = sibling;
+	m_Nodes[newParent].right  = leaf;
+	m_Nodes[sibling].parent = newParent;
+	m_Nodes[leaf].parent	= newParent;
+
+	if (oldParent != NullNode)
+	{
+		if (m_Nodes[oldParent].left == sibling) m_Nodes[oldParent].left  = newParent;
+		else									m_Nodes[oldParent].right = newParent;
+	}
+	else
+	{
+		m_Root = newParent;
+	}
+
+	// ----- 祖先を辿って AABB と高さを直す -----
+	index = m_Nodes[leaf].parent;
+	while (index != NullNode)
+	{
+		index = Balance(index);
+
+		const int left  = m_Nodes[index].left;
+		const int right = m_Nodes[index].right;
+		m_Nodes[index].height = 1 + std::max(m_Nodes[left].height, m_Nodes[right].height);
+		m_Nodes[index].aabb   = Combine(m_Nodes[left].aabb, m_Nodes[right].aabb);
+
+		index = m_Nodes[index].parent;
+	}
+}
+// --------------------------------------------------
+// 葉の取り外し
+// 親を消して兄弟を祖父にぶら下げる
+// --------------------------------------------------
+void DynamicAABBTree::RemoveLeaf(int leaf)
+{
+	if (leaf == m_Root)
+	{
+		m_Root = NullNode;
+		return;
+	}
+
+	const int parent = m_Nodes[leaf].parent;
+	const int grandParent = m_Nodes[parent].parent;
+	const int sibling = (m_Nodes[parent].left == leaf) ? m_Nodes[parent].right : m_Nodes[parent].left;
+
+	if (grandParent != NullNode)
+	{
+		if (m_Nodes[grandParent].left == parent) m_Nodes[grandParent].left  = sibling;
+		else									 m_Nodes[grandParent].right = sibling;
+		m_Nodes[sibling].parent = grandParent;
+		FreeNode(parent);
+
+		int index = grandParent;
+		while (index != NullNode)
+		{
+			index = Balance(index);
+
+			const int left  = m_Nodes[index].left;
+			const int right = m_Nodes[index].right;
+			m_Nodes[index].aabb   = Combine(m_Nodes[left].aabb, m_Nodes[right].aabb);
+			m_Nodes[index].height = 1 + std::max(m_Nodes[left].height, m_Nodes[right].height);
+
+			index = m_Nodes[index].parent;
+		}
+	}
+	else
+	{
+		m_Root = sibling;
+		m_Nodes[sibling].parent = NullNode;
+		FreeNode(parent);
+	}
+	m_Nodes[leaf].parent = NullNode;
+}
+// --------------------------------------------------
+// 回転による平衡化（AVL）
+// a の左右の高さが２以上ずれていたら回転して、新しい部分木の根を返す
+// ただし下ろす側の AABB が広がる回転は、ずれが MaxAreaImbalance までなら見送る
+// （地形のような大きな葉が回転で沈むと、祖先が全部大きくなってレイも重なりも毎回そこを通るので）
+// --------------------------------------------------
+int DynamicAABBTree::Balance(int iA)
+{
+	Node& A = m_Nodes[iA];
+	if (A.IsLeaf() || A.height < 2) return iA;
+
+	const int iB = A.left;
+	const int iC = A.right;
+	const int balance = m_Nodes[iC].height - m_Nodes[iB].height;
+	if ((balance > 1 && balance <= MaxAreaImbalance) || (balance < -1 && balance >= -MaxAreaImbalance))
+	{
+		// 持ち上げる子、A に残る子、A に移る孫（持ち上げる子の低い方）
+		const Node& up = m_Nodes[balance > 1 ? iC : iB];
+		const int iStay = balance > 1 ? iB : iC;
+		const int iMove = (m_Nodes[up.left].height > m_Nodes[up.right].height) ? up.right : up.left;
+		// 回した後は A が (残る子, 移る孫)、持ち上げた子が今の A の AABB になる
+		if (SurfaceArea(Combine(m_Nodes[iStay].aabb, m_Nodes[iMove].aabb)) > SurfaceArea(up.aabb)) return iA;
+	}
+
+	// 右（C）を持ち上げる
+	if (balance > 1)
+	{
+		Node& C = m_Nodes[iC];
+		const int iF = C.left;
+		const int iG = C.right;
+
+		C.left = iA;
+		C.parent = A.parent;
+		A.parent = iC;
+
+		if (C.parent != NullNode)
+		{
+			if (m_Nodes[C.parent].left == iA) m_Nodes[C.parent].left  = iC;
+			else							  m_Nodes[C.parent].right = iC;
+		}
+		else m_Root = iC;
+
+		// F, G の高い方を C に残す
+		if (m_Nodes[iF].height > m_Nodes[iG].height)
+		{
+			C.right = iF;
+			A.right = iG;
+			m_Nodes[iG].parent = iA;
+			A.aabb = Combine(m_Nodes[iB].aabb, m_Nodes[iG].aabb);
+			C.aabb = Combine(A.aabb, m_Nodes[iF].aabb);
+			A.height = 1 + std::max(m_Nodes[iB].height, m_Nodes[iG].height);
+			C.height = 1 + std::max(A.height, m_Nodes[iF].height);
+		}
+		else
+		{
+			C.right = iG;
+			A.right = iF;
+			m_Nodes[iF].parent = iA;
+			A.aabb = Combine(m_Nodes[iB].aabb, m_Nodes[iF].aabb);
+			C.aabb = Combine(A.aabb, m_Nodes[iG].aabb);
+			A.height = 1 + std::max(m_Nodes[iB].height, m_Nodes[iF].height);
+			C.height = 1 + std::max(A.height, m_Nodes[iG].height);
+		}
+		return iC;
+	}
+
+	// 左（B）を持ち上げる
+	if (balance < -1)
+	{
+		Node& B = m_Nodes[iB];
+		const int iD = B.left;
+		const int iE = B.right;
+
+		B.left = iA;
+		B.parent = A.parent;
+		A.parent = iB;
+
+		if (B.parent != NullNode)
+		{
+			if (m_Nodes[B.parent].left == iA) m_Nodes[B.parent].left  = iB;
+			else							  m_Nodes[B.parent].right = iB;
+		}
+		else m_Root = iB;
+
+		// D, E の高い方を B に残す
+		if (m_Nodes[iD].height > m_Nodes[iE].height)
+		{
+			B.right = iD;
+			A.left = iE;
+			m_Nodes[iE].parent = iA;
+			A.aabb = Combine(m_Nodes[iC].aabb, m_Nodes[iE].aabb);
+			B.aabb = Combine(A.aabb, m_Nodes[iD].aabb);
+			A.height = 1 + std::max(m_Nodes[iC].height, m_Nodes[iE].height);
+			B.height = 1 + std::max(A.height, m_Nodes[iD].height);
+		}
+		else
+		{
+			B.right = iE;
+			A.left = iD;
+			m_Nodes[iD].parent = iA;
+			A.aabb = Combine(m_Nodes[iC].aabb, m_Nodes[iD].aabb);
+			B.aabb = Combine(A.aabb, m_Nodes[iE].aabb);
+			A.height = 1 + std::max(m_Nodes[iC].height, m_Nodes[iD].height);
+			B.height = 1 + std::max(A.height, m_Nodes[iE].height);
+		}
+		return iB;
+	}
+
+	return iA;
+}
@@ -0,0 +1,260 @@
+/*
+	DynamicAABBTree.h
+	20261017  hanaue sho
+	ブロードフェーズ用の動的 AABB 木
+	葉には少し太らせた AABB（fat AABB）を持たせて、はみ出した時だけ差し替える
+*/
+#ifndef DYNAMICAABBTREE_H_
+#define DYNAMICAABBTREE_H_
+#include <vector>
+#include <assert.h>
+#include <math.h>
+#include "collision.h"
+
+class Collider;
+
+// ==================================================
+// ----- クラス本体 -----
+// ==================================================
+class DynamicAABBTree
+{
+public:
+	// --------------------------------------------------
+	// 定数
+	// --------------------------------------------------
+	static constexpr int   NullNode = -1;
+	static constexpr float FatMargin = 0.1f; // 葉の AABB を太らせる量
+	static constexpr int   MaxStack = 256;	 // 探索用スタックを関数内に取る深さ（木がこれより高い時はヒープに取る）
+	static constexpr int   MaxAreaImbalance = 8; // 表面積が増える回転を見送ってよい左右の高さの差（これを超えたら回す）
+
+private:
+	// ==================================================
+	// ----- 要素 -----
+	// ==================================================
+	// --------------------------------------------------
+	// ノード
+	// 葉なら left == NullNode
+	// 使っていないノードは parent で空きリストにつなぐ
+	// --------------------------------------------------
+	struct Node
+	{
+		AABB aabb{};
+		Collider* pUser = nullptr;
+		int parent = NullNode; // 未使用なら空きリストの次
+		int left   = NullNode;
+		int right  = NullNode;
+		int height = -1; // 葉なら０、未使用なら -1
+
+		bool IsLeaf() const { return left == NullNode; }
+	};
+
+	std::vector<Node> m_Nodes;
+	int m_Root = NullNode;
+	int m_FreeList = NullNode;
+	int m_ProxyCount = 0;
+
+	// --------------------------------------------------
+	// 探索用スタック
+	// 深さ優先で辿ると積まれるのは高々「木の高さ + 1」個なので、その分を先に取る
+	// Balance は高さの差を MaxAreaImbalance まで許すので、高さは log2(葉の数) に収まるとは限らない
+	// 普段は関数内の配列、MaxStack を超える高さの時だけ std::vector に切り替える
+	// --------------------------------------------------
+	template<class T>
+	class TraversalStack
+	{
+	private:
+		T m_Local[MaxStack];
+		std::vector<T> m_Heap;
+		T* m_pData = m_Local;
+		int m_Capacity = MaxStack;
+		int m_Top = 0;
+
+	public:
+		explicit TraversalStack(int height)
+		{
+			if (height + 2 > MaxStack)
+			{
+				m_Heap.resize((size_t)height + 2);
+				m_pData = m_Heap.data();
+				m_Capacity = height + 2;
+			}
+		}
+		TraversalStack(const TraversalStack&) = delete;
+		TraversalStack& operator=(const TraversalStack&) = delete;
+
+		bool Empty() const { return m_Top == 0; }
+		void Push(const T& v) { assert(m_Top < m_Capacity && "DynamicAABBTree stack overflow"); m_pData[m_Top++] = v; }
+		T Pop() { return m_pData[--m_Top]; }
+	};
+
+public:
+	// ==================================================
+	// ----- コンストラクタ -----
+	// ==================================================
+	DynamicAABBTree() = default;
+	~DynamicAABBTree() = default;
+
+	// ==================================================
+	// ----- プロキシ操作 -----
+	// ==================================================
+	// --------------------------------------------------
+	// 登録、解除
+	// 戻り値はプロキシID（ノード番号）
+	// --------------------------------------------------
+	int  CreateProxy(const AABB& aabb, Collider* pUser);
+	void DestroyProxy(int proxyId);
+	// --------------------------------------------------
+	// 移動
+	// fat AABB からはみ出していなければ何もしないで false
+	// はみ出したら取り外して入れ直して true
+	// --------------------------------------------------
+	bool MoveProxy(int proxyId, const AABB& aabb);
+	// --------------------------------------------------
+	// 全消去
+	// --------------------------------------------------
+	void Clear();
+
+	// ==================================================
+	// ----- ゲッター -----
+	// ==================================================
+	const AABB& GetFatAABB(int proxyId) const { assert(0 <= proxyId && proxyId < (int)m_Nodes.size()); return m_Nodes[proxyId].aabb; }
+	Collider* GetUser(int proxyId) const	  { assert(0 <= proxyId && proxyId < (int)m_Nodes.size()); return m_Nodes[proxyId].pUser; }
+	int ProxyCount() const { return m_ProxyCount; }
+	int Height() const { return m_Root == NullNode ? 0 : m_Nodes[m_Root].height; }
+
+	// ==================================================
+	// ----- 探索 -----
+	// ==================================================
+	// --------------------------------------------------
+	// aabb と fat AABB が重なる葉ごとに callback(proxyId) を呼ぶ
+	// callback が false を返したら打ち切り
+	// --------------------------------------------------
+	template<class F>
+	void Query(const AABB& aabb, F&& callback) const
+	{
+		if (m_Root == NullNode) return;
+
+		TraversalStack<int> stack(Height());
+		stack.Push(m_Root);
+		while (!stack.Empty())
+		{
+			const int id = stack.Pop();
+			const Node& node = m_Nodes[id];
+			if (!node.aabb.isOverlap(aabb)) continue;
+
+			if (node.IsLeaf())
+			{
+				if (!callback(id)) return;
+			}
+			else
+			{
+				stack.Push(node.left);
+				stack.Push(node.right);
+			}
+		}
+	}
+
+	// --------------------------------------------------
+	// レイと fat AABB が重なる葉ごとに callback(proxyId) を呼ぶ
+	// callback は新しい maxDist を返す（当たったら縮めて奥の枝を刈る、負なら打ち切り）
+	// --------------------------------------------------
+	template<class F>
+	void RayCast(const Vector3& origin, const Vector3& dir, float maxDist, F&& callback) const
+	{
+		if (m_Root == NullNode) return;
+
+		const Vector3 invDir = InverseDirection(dir);
+		TraversalStack<int> stack(Height());
+		stack.Push(m_Root);
+		while (!stack.Empty())
+		{
+			const int id = stack.Pop();
+			const Node& node = m_Nodes[id];
+			if (!node.aabb.isOverlapRay(origin, invDir, maxDist)) continue;
+
+			if (node.IsLeaf())
+			{
+				maxDist = callback(id);
+				if (maxDist < 0.0f) return;
+			}
+			else
+			{
+				stack.Push(node.left);
+				stack.Push(node.right);
+			}
+		}
+	}
+	// --------------------------------------------------
+	// レイをまとめて辿る（パケット）
+	// 束全体を囲む bounds で枝ごと刈り、bounds を丸ごと含むノードは全部のレイをそのまま子に渡す
+	// それ以外のノードでは「まだ重なっているレイ」の番号を絞り込んで子に渡す
+	// test(aabb, rayIndex) で重なり判定、leaf(proxyId, rays, count) で葉に届いたレイをまとめて渡す
+	// work は番号の置き場（呼び出し側で使い回す）
+	// --------------------------------------------------
+	template<class TestF, class LeafF>
+	void RayCastBatch(int count, const AABB& bounds, std::vector<int>& work, TestF&& test, LeafF&& leaf) const
+	{
+		if (m_Root == NullNode || count <= 0) return;
+
+		struct Entry { int node, begin, count; };
+		TraversalStack<Entry> stack(Height());
+
+		// 深さごとに高々 count 個ずつ積むので、先に全部確保しておく
+		work.resize((size_t)count * (Height() + 2));
+		int* ids = work.data();
+		for (int i = 0; i < count; i++) ids[i] = i;
+		stack.Push({ m_Root, 0, count });
+		while (!stack.Empty())
+		{
+			const Entry e = stack.Pop();
+			const Node& node = m_Nodes[e.node];
+			if (!node.aabb.isOverlap(bounds)) continue; // 束ごと外れ
+
+			// ----- 束ごと中に入っている（木の上の方）ならレイごとの判定はいらない -----
+			int begin = e.begin, hitCount = e.count;
+			if (!node.aabb.isContain(bounds))
+			{
+				// ----- このノードに届くレイを後ろに詰め直す（後から積んだ分は使い終わっているので上書き） -----
+				begin = e.begin + e.count;
+				hitCount = 0;
+				for (int k = 0; k < e.count; k++)
+				{
+					const int ray = ids[e.begin + k];
+					ids[begin + hitCount] = ray; // 分岐しないで書いてから数だけ進める
+					hitCount += test(node.aabb, ray) ? 1 : 0;
+				}
+				if (hitCount == 0) continue;
+			}
+
+			if (node.IsLeaf())
+			{
+				leaf(e.node, ids + begin, hitCount);
+			}
+			else
+			{
+				stack.Push({ node.left,  begin, hitCount });
+				stack.Push({ node.right, begin, hitCount });
+			}
+		}
+	}
+	// --------------------------------------------------
+	// スラブ法用の方向の逆数（０成分は大きな値にする）
+	// --------------------------------------------------
+	static Vector3 InverseDirection(const Vector3& dir)
+	{
+		auto inv = [](float v) { return fabsf(v) > 1e-12f ? 1.0f / v : (v < 0.0f ? -1e30f : 1e30f); };
+		return { inv(dir.x), inv(dir.y), inv(dir.z) };
+	}
+
+private:
+	// ==================================================
+	// ----- 内部処理 -----
+	// ==================================================
+	int  AllocateNode();
+	void FreeNode(int id);
+	void InsertLeaf(int leaf);
+	void RemoveLeaf(int leaf);
+	int  Balance(int a);
+};
+
+#endif
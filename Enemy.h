@@ -14,7 +14,7 @@
 #include "MeshRendererComponent.h"
 #include "RigidbodyComponent.h"
 #include "renderer.h"
-#include "texture.h"  // Texture::Load 
+#include "texture.h"  // Texture::Load 既存
 
 
 class ModelRenderer;
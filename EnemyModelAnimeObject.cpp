@@ -102,24 +102,24 @@ void EnemyModelAnimeObject::Init()
 	// MeshRenderer
 	auto* mr = AddComponent<MeshRendererComponent>();
 
-	// Slot 
+	// Slot 数
 	const int slotCount = mf->MaterialSlotCount();
 	mr->ResizeMaterialSlots(slotCount);
 
-	// ʃVF[_[
+	// 共通シェーダー
 	ID3D11VertexShader* vs = nullptr;
 	ID3D11PixelShader* ps = nullptr;
 	ID3D11InputLayout* il = nullptr;
 	Renderer::CreateVertexShader(&vs, &il, "shader\\VS_Skinned.cso", Renderer::VertexLayoutType::Skinned);
 	Renderer::CreatePixelShader(&ps, "shader\\PS_Toon.cso");
 
-	// ʃ}eA萔
+	// 共通マテリアル定数
 	MaterialApp m{};
 	m.diffuse = Vector4(1, 1, 1, 1);
 	m.ambient = Vector4(1, 1, 1, 1);
 	m.textureEnable = true;
 
-	// slot Ƃ MaterialComponent  srv h
+	// slot ごとに MaterialComponent を作って srv を刺す
 	for (int slot = 0; slot < slotCount; slot++)
 	{
 		auto* mat = AddComponent<MaterialComponent>();
@@ -139,7 +139,7 @@ void EnemyModelAnimeObject::Init()
 	if (slotCount > 0)
 		mr->SetBaseMaterial(mr->GetMaterialSlot(0));
 
-	// AEgC}eAǉ
+	// アウトラインマテリアル追加
 	auto* matOutline = AddComponent<MaterialComponent>();
 	Renderer::CreateVertexShader(&vs, &il, "shader\\VS_SkinnedOutline.cso", Renderer::VertexLayoutType::Skinned);
 	Renderer::CreatePixelShader(&ps, "shader\\PS_Outline.cso");
@@ -147,7 +147,7 @@ void EnemyModelAnimeObject::Init()
 	matOutline->SetBlendMode(/*Alpha*/MaterialComponent::BlendMode::Opaque);
 	mr->SetOutlineMaterial(matOutline);
 
-	// ----- ^[Qbg -----
+	// ----- ターゲット -----
 	GameObject* bone = m_pBoneManager->GetBoneObject(0);
 	GameObject* target = Manager::GetScene()->AddGameObject<TargetObject>(1);
 	target->Init();
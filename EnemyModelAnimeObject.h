@@ -13,10 +13,10 @@ class AnimatorController;
 
 enum class Type
 {
-	Melee, // ߐ
-	Shot,  // 
-	ShotAndBarrier, // oA\
-	Barrier, // oA\
+	Melee, // 近接
+	Shot,  // 遠距離
+	ShotAndBarrier, // バリア―
+	Barrier, // バリア―
 };
 
 class EnemyModelAnimeObject : public GameObject
@@ -42,7 +42,7 @@ public:
 	void Uninit() override;
 	void Update(float dt) override;
 
-	// ----- OĂяoAj -----
+	// ----- 外部から呼び出されるアニメ制御 -----
 	void SetIsLocomotion(bool b);
 	void SetBlendParam(float blend);
 	void SetSpeedAnime(float speed);
@@ -51,10 +51,10 @@ public:
 	void PlayAnimeAttack();
 	void PlayAnimeDead();
 
-	// ̃Zbg
+	// 骨のセット
 	void SetupBones();
 
-	// Qb^[iƃG[oj
+	// ゲッター（これらを作るとエラーが出る）
 	const BoneManager& GetBoneManager() const { return *m_pBoneManager; }
 	const AnimatorController& GetAnimatorController() const { return *m_pController; }
 };
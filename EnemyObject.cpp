@@ -8,7 +8,7 @@
 #include "ColliderComponent.h"
 #include "RigidbodyComponent.h"
 #include "Renderer.h"
-#include "Texture.h"  // Texture::Load 
+#include "Texture.h"  // Texture::Load 既存
 #include "EnemyModelAnimeObject.h"
 #include "CharacterControllerComponent.h"
 
@@ -17,7 +17,7 @@
 
 void EnemyObject::Init()
 {
-	// 1) Transformi GameObject ctor Œǉς݁j擾ďpĂ
+	// 1) Transform（既に GameObject ctor で追加済み）を取得して初期姿勢を入れておく
 	auto* tf = GetComponent<TransformComponent>();
 	tf->SetPosition({ 0, 10, 50 });
 	float s = 5.0f;
@@ -29,7 +29,7 @@ void EnemyObject::Init()
 	m_pModelAnimeObject->Init();
 	m_pModelAnimeObject->Transform()->SetParent(this->Transform());
 
-	// 𓭂̂ŃRC_[Ȃǂݒ
+	// 物理を働かせたいのでコライダーなどを設定
 	Collider* col = AddComponent<Collider>();
 	col->SetCapsule(1.5f, 1);
 	col->SetModeQuery();
@@ -45,7 +45,7 @@ void EnemyObject::Init()
 	// CharacterController
 	auto* cc = AddComponent<CharacterControllerComponent>();
 
-	// ^Oݒ
+	// タグ設定
 	SetTag("Enemy");
 }
 
@@ -25,30 +25,30 @@ void FenceObject::Init()
 	// MeshRenderer
 	auto* mr = AddComponent<MeshRendererComponent>();
 
-	// Slot 
+	// Slot 数
 	const int slotCount = mf->MaterialSlotCount();
 	mr->ResizeMaterialSlots(slotCount);
 
-	// ʃVF[_[
+	// 共通シェーダー
 	ID3D11VertexShader* vs = nullptr;
 	ID3D11PixelShader* ps = nullptr;
 	ID3D11InputLayout* il = nullptr;
 	Renderer::CreateVertexShader(&vs, &il, "shader\\VS_Lit.cso", Renderer::VertexLayoutType::Basic);
 	Renderer::CreatePixelShader(&ps, "shader\\PS_Toon.cso");
 
-	// ʃ}eA萔
+	// 共通マテリアル定数
 	MaterialApp m{};
 	m.diffuse = Vector4(1, 1, 1, 1);
 	m.ambient = Vector4(1, 1, 1, 1);
 	m.textureEnable = true;
 
-	// ꎞIɃeNX`ݒ -----
+	// 一時的にテクスチャを設定 -----
 	auto* mat = AddComponent<MaterialComponent>();
 	mat->SetVSPS(vs, ps, il, /*takeVS*/true, /*takePS*/true, /*takeIL*/true);
 	ID3D11ShaderResourceView* srv = Texture::LoadAndRegisterKey("assets\\texture\\whiteTexture.png");
 	mat->SetMainTexture(srv, /*sampler*/nullptr, /*takeSrv*/false, /*takeSamp*/false);
 
-	// slot Ƃ MaterialComponent  srv h
+	// slot ごとに MaterialComponent を作って srv を刺す
 	for (int slot = 0; slot < slotCount; slot++)
 	{
 		auto* mat = AddComponent<MaterialComponent>();
@@ -58,7 +58,7 @@ void FenceObject::Init()
 		ID3D11ShaderResourceView* srv = nullptr;
 		if (slot < (int)srvs.size()) srv = srvs[slot];
 
-		//srv = Texture::LoadAndRegisterKey("assets\\texture\\whiteTexture.png"); // fobOŃoOł΂
+		//srv = Texture::LoadAndRegisterKey("assets\\texture\\whiteTexture.png"); // デバッグでバグでばっぐ
 
 		mat->SetMainTexture(srv, nullptr);
 
@@ -70,7 +70,7 @@ void FenceObject::Init()
 	if (slotCount > 0)
 		mr->SetBaseMaterial(mr->GetMaterialSlot(0));
 
-	// AEgC}eAǉ
+	// アウトラインマテリアル追加
 	auto* matOutline = AddComponent<MaterialComponent>();
 	Renderer::CreateVertexShader(&vs, &il, "shader\\VS_Outline.cso", Renderer::VertexLayoutType::Basic);
 	Renderer::CreatePixelShader(&ps, "shader\\PS_Outline.cso");
@@ -82,7 +82,7 @@ void FenceObject::Init()
 	auto* col = AddComponent<Collider>();
 	col->Init();
 	col->SetBox({6, 0.5f, 20});
-	col->SetModeSimulate(); // ŏ̓gK[
+	col->SetModeSimulate(); // 最初はトリガー判定
 	col->SetOffsetPosition({ 0, 0, 25 });
 
 }
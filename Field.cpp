@@ -9,20 +9,20 @@
 
 void Field::Init()
 {
-	// 1) Transformi GameObject ctor Œǉς݁j擾ďpĂ
+	// 1) Transform（既に GameObject ctor で追加済み）を取得して初期姿勢を入れておく
 	auto* tf = GetComponent<TransformComponent>();
 	tf->SetPosition({ 0,0,0 });
 	tf->SetScale({ 1,1,1 });
 	tf->SetEulerAngles({ 0,0,0 });
 
-	// 2) MeshFilter ǉĒ_obt@i4_̋`j
+	// 2) MeshFilter を追加して頂点バッファ（4頂点の矩形）を作る
 	std::vector<float> heights;
 	for (int i = 0; i < 100 * 100; i++) heights.push_back(0.0f);
 	for (int i = 0; i < 100 * 100; i++) if (i % 1 == 0) heights[i] = Random::RandomRangeStepped(0.0f, 2.0f, 0.1f);
 	auto* mf = AddComponent<MeshFilterComponent>();
 	MeshFactory::CreateMeshField(mf, { 100, 100, 20.0f, 20.0f, heights, true});
 
-	// 3) Material ǉiVF[_/eNX`/}eAj
+	// 3) Material を追加（シェーダ/テクスチャ/マテリアル）
 	auto* mat = AddComponent<MaterialComponent>();
 
 	ID3D11VertexShader* vs = nullptr;
@@ -32,9 +32,9 @@ void Field::Init()
 	Renderer::CreatePixelShader(&ps, "shader\\PS_PixelLit.cso");
 	mat->SetVSPS(vs, ps, il, /*takeVS*/true, /*takePS*/true, /*takeIL*/true);
 
-	//  Polygon2D Ɠ kirby g
+	// 旧 Polygon2D と同じ kirby を使う
 	ID3D11ShaderResourceView* srv = Texture::LoadAndRegisterKey("assets\\texture\\ground.png");
-	// Tv[ Renderer::Init()  0Ԃ PSSetSamplers ς݂Ȃ null ł`
+	// サンプラーは Renderer::Init() で 0番に PSSetSamplers 済みなら null でも描ける
 	mat->SetMainTexture(srv, /*sampler*/nullptr, /*takeSrv*/false, /*takeSamp*/false);
 
 	MaterialApp m{};
@@ -43,13 +43,13 @@ void Field::Init()
 	m.textureEnable = TRUE;
 	mat->SetMaterial(m);
 
-	// eNX`̉\̂ŃAt@uh
+	// 透明テクスチャの可能性が高いのでアルファブレンドに
 	mat->SetBlendMode(/*Alpha*/MaterialComponent::BlendMode::Opaque);
 
-	// 4) MeshRenderer ǉi`sWj
+	// 4) MeshRenderer を追加（描画実行係）
 	AddComponent<MeshRendererComponent>();
 
-	// 蔻ǉ
+	// 当たり判定追加
 	Collider* coll = AddComponent<Collider>();
 	coll->SetMeshField(100, 100, 20.0f, 20.0f, heights);
 	//coll->SetSphere(1);
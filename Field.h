@@ -11,7 +11,7 @@
 #include "MaterialComponent.h"
 #include "MeshRendererComponent.h"
 #include "renderer.h"
-#include "texture.h"  // Texture::Load 
+#include "texture.h"  // Texture::Load 既存
 
 class Field : public GameObject
 {
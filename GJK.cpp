@@ -0,0 +1,571 @@
+/*
+	GJK.cpp
+	20261017  hanaue sho
+	凸形状同士の距離（GJK）と形状キャスト（保守的前進）、めり込み（EPA）
+*/
+#include <math.h>
+#include <float.h>
+#include "GJK.h"
+#include "ConvexHull.h"
+
+namespace
+{
+	const int	GJKMaxIterations  = 32;		 // GJK の反復上限
+	const float GJKRelTolerance	  = 1e-6f;	 // 収束判定（相対）
+	const float GJKOverlapDistSq  = 1e-10f;	 // これより近ければ重なっている
+	const int	CastMaxIterations = 32;		 // 保守的前進の反復上限
+	const float CastTarget		  = 2e-3f;	 // この距離まで進める（０まで進めるとコアが重なって法線が取れない）
+	const float CastTolerance	  = 1e-3f;	 // CastTarget からの許容誤差
+	const int	EPAMaxVertices	  = 64;		 // EPA の頂点の上限（反復の上限にもなる）
+	const int	EPAMaxFaces		  = 128;	 // EPA の面の上限
+	const int	EPAMaxEdges		  = 64;		 // EPA の地平線の辺の上限
+	const float EPATolerance	  = 1e-4f;	 // これ以上外に広がらなければ収束
+
+	// --------------------------------------------------
+	// シンプレックス（A - B のミンコフスキー差の頂点）
+	// --------------------------------------------------
+	struct SimplexVertex
+	{
+		Vector3 a, b; // A, B それぞれのサポート点
+		Vector3 w;	  // a - b
+		float	u = 0.0f; // 最近点の重心座標
+	};
+	struct Simplex
+	{
+		SimplexVertex v[4];
+		int count = 0;
+
+		Vector3 Closest() const
+		{
+			Vector3 p{};
+			for (int i = 0; i < count; i++) p += v[i].w * v[i].u;
+			return p;
+		}
+		void Keep1(int i)
+		{
+			const SimplexVertex a = v[i];
+			v[0] = a; v[0].u = 1.0f;
+			count = 1;
+		}
+		void Keep2(int i, int j, float ui, float uj)
+		{
+			const SimplexVertex a = v[i], b = v[j];
+			v[0] = a; v[0].u = ui;
+			v[1] = b; v[1].u = uj;
+			count = 2;
+		}
+	};
+
+	// --------------------------------------------------
+	// 線分の最近点
+	// --------------------------------------------------
+	void SolveSegment(Simplex& s)
+	{
+		const Vector3 A = s.v[0].w;
+		const Vector3 ab = s.v[1].w - A;
+		const float denom = Vector3::Dot(ab, ab);
+		const float t = denom > 1e-20f ? -Vector3::Dot(A, ab) / denom : 0.0f;
+		if		(t <= 0.0f) s.Keep1(0);
+		else if (t >= 1.0f) s.Keep1(1);
+		else				s.Keep2(0, 1, 1.0f - t, t);
+	}
+	// --------------------------------------------------
+	// 三角形の最近点（領域分け）
+	// --------------------------------------------------
+	void SolveTriangle(Simplex& s)
+	{
+		const Vector3 A = s.v[0].w, B = s.v[1].w, C = s.v[2].w;
+		const Vector3 ab = B - A, ac = C - A;
+
+		const float d1 = -Vector3::Dot(ab, A);
+		const float d2 = -Vector3::Dot(ac, A);
+		if (d1 <= 0.0f && d2 <= 0.0f) { s.Keep1(0); return; }
+
+		const float d3 = -Vector3::Dot(ab, B);
+		const float d4 = -Vector3::Dot(ac, B);
+		if (d3 >= 0.0f && d4 <= d3) { s.Keep1(1); return; }
+
+		const float vc = d1 * d4 - d3 * d2;
+		if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+		{
+			const float t = d1 / (d1 - d3);
+			s.Keep2(0, 1, 1.0f - t, t);
+			return;
+		}
+
+		const float d5 = -Vector3::Dot(ab, C);
+		const float d6 = -Vector3::Dot(ac, C);
+		if (d6 >= 0.0f && d5 <= d6) { s.Keep1(2); return; }
+
+		const float vb = d5 * d2 - d1 * d6;
+		if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+		{
+			const float t = d2 / (d2 - d6);
+			s.Keep2(0, 2, 1.0f - t, t);
+			return;
+		}
+
+		const float va = d3 * d6 - d5 * d4;
+		if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+		{
+			const float t = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+			s.Keep2(1, 2, 1.0f - t, t);
+			return;
+		}
+
+		// 面の内側
+		const float denom = 1.0f / (va + vb + vc);
+		s.v[0].u = va * denom;
+		s.v[1].u = vb * denom;
+		s.v[2].u = vc * denom;
+		s.count = 3;
+	}
+	// --------------------------------------------------
+	// 原点が面 abc に対して d と反対側にあるか
+	// 潰れた四面体は全部の面を外側扱いにする
+	// --------------------------------------------------
+	bool OriginOutsideFace(const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& d)
+	{
+		const Vector3 n = Vector3::Cross(b - a, c - a);
+		const float signO = -Vector3::Dot(a, n);
+		const float signD = Vector3::Dot(d - a, n);
+		if (signD * signD < 1e-20f) return true;
+		return signO * signD < 0.0f;
+	}
+	// --------------------------------------------------
+	// 四面体の最近点
+	// 原点を含んでいたら false
+	// --------------------------------------------------
+	bool SolveTetrahedron(Simplex& s)
+	{
+		static const int Faces[4][4] = { { 0, 1, 2, 3 }, { 0, 2, 3, 1 }, { 0, 3, 1, 2 }, { 1, 3, 2, 0 } };
+
+		bool outside = false;
+		float bestSq = FLT_MAX;
+		Simplex best;
+		for (const auto& f : Faces)
+		{
+			if (!OriginOutsideFace(s.v[f[0]].w, s.v[f[1]].w, s.v[f[2]].w, s.v[f[3]].w)) continue;
+			outside = true;
+
+			Simplex t;
+			t.v[0] = s.v[f[0]]; t.v[1] = s.v[f[1]]; t.v[2] = s.v[f[2]];
+			t.count = 3;
+			SolveTriangle(t);
+			const float distSq = t.Closest().lengthSq();
+			if (distSq < bestSq) { bestSq = distSq; best = t; }
+		}
+		if (!outside) return false;
+		s = best;
+		return true;
+	}
+	// --------------------------------------------------
+	// 原点に一番近い点を求めて、いらない頂点を捨てる
+	// --------------------------------------------------
+	bool SolveSimplex(Simplex& s)
+	{
+		switch (s.count)
+		{
+		case 1: s.v[0].u = 1.0f; return true;
+		case 2: SolveSegment(s);  return true;
+		case 3: SolveTriangle(s); return true;
+		case 4: return SolveTetrahedron(s);
+		}
+		return true;
+	}
+
+	// --------------------------------------------------
+	// GJK 本体
+	// 重なったときのシンプレックスは EPA の出発点に使うので s に残す
+	// --------------------------------------------------
+	GJK::DistanceResult SolveDistance(const SupportShape& a, const Vector3& offsetA, const SupportShape& b, Simplex& s)
+	{
+		auto support = [&](const Vector3& dir, SimplexVertex& out)
+			{
+				out.a = a.Support(dir) + offsetA;
+				out.b = b.Support(-dir);
+				out.w = out.a - out.b;
+			};
+
+		GJK::DistanceResult result;
+
+		// ----- 中心同士の向きから始める -----
+		Vector3 d = (a.Center() + offsetA) - b.Center();
+		if (d.lengthSq() < 1e-12f) d = Vector3(1.0f, 0.0f, 0.0f);
+		support(-d, s.v[0]);
+		s.v[0].u = 1.0f;
+		s.count = 1;
+
+		Vector3 v = s.v[0].w;
+		float distSq = v.lengthSq();
+		for (int iter = 0; iter < GJKMaxIterations; iter++)
+		{
+			if (distSq < GJKOverlapDistSq) { result.overlap = true; return result; }
+
+			// ----- 原点の方向へ新しい頂点を取る -----
+			SimplexVertex w;
+			support(-v, w);
+			if (distSq - Vector3::Dot(v, w.w) <= GJKRelTolerance * distSq) break; // これ以上近づかない
+
+			bool duplicate = false;
+			for (int i = 0; i < s.count; i++)
+				if ((s.v[i].w - w.w).lengthSq() < 1e-12f) { duplicate = true; break; }
+			if (duplicate) break;
+
+			s.v[s.count++] = w;
+			if (!SolveSimplex(s)) { result.overlap = true; return result; } // 原点を含んだ
+
+			const Vector3 nv = s.Closest();
+			const float nd = nv.lengthSq();
+			if (nd >= distSq) break; // 数値誤差で進まなくなった
+			v = nv;
+			distSq = nd;
+		}
+
+		// ----- 重心座標から最近点を復元 -----
+		for (int i = 0; i < s.count; i++)
+		{
+			result.pointA += s.v[i].a * s.v[i].u;
+			result.pointB += s.v[i].b * s.v[i].u;
+		}
+		result.distance = (result.pointB - result.pointA).length();
+		if (result.distance * result.distance < GJKOverlapDistSq) result.overlap = true;
+		return result;
+	}
+
+	// --------------------------------------------------
+	// EPA（コアのめり込み）
+	// GJK のシンプレックスを四面体まで膨らませ、原点に一番近い面を外へ押し広げていく
+	// 配列は固定長（ヒープを使わない）
+	// --------------------------------------------------
+	struct EPAFace
+	{
+		int		v[3];
+		Vector3 n;		   // 外向き（正規化済み）
+		float	d = 0.0f;  // 原点からの距離
+	};
+	bool SolvePenetration(const SupportShape& a, const SupportShape& b, Simplex& s, GJK::PenetrationResult& out)
+	{
+		auto support = [&](const Vector3& dir, SimplexVertex& o)
+			{
+				o.a = a.Support(dir);
+				o.b = b.Support(-dir);
+				o.w = o.a - o.b;
+			};
+		const float epsSq = 1e-10f;
+
+		// ----- 四面体まで膨らませる -----
+		static const Vector3 Axes[6] = { { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+		if (s.count == 1)
+		{
+			for (const Vector3& dir : Axes)
+			{
+				support(dir, s.v[1]);
+				if ((s.v[1].w - s.v[0].w).lengthSq() > epsSq) { s.count = 2; break; }
+			}
+		}
+		if (s.count == 2)
+		{
+			const Vector3 line = (s.v[1].w - s.v[0].w).normalized();
+			const Vector3 ref = fabsf(line.x) < 0.57f ? Vector3(1, 0, 0) : (fabsf(line.y) < 0.57f ? Vector3(0, 1, 0) : Vector3(0, 0, 1));
+			const Vector3 e1 = Vector3::Cross(line, ref).normalized();
+			const Vector3 e2 = Vector3::Cross(line, e1);
+			for (int k = 0; k < 6; k++) // 線分の周りを 60 度ずつ
+			{
+				const float angle = 1.0471976f * k;
+				support(e1 * cosf(angle) + e2 * sinf(angle), s.v[2]);
+				if (Vector3::Cross(line, s.v[2].w - s.v[0].w).lengthSq() > epsSq) { s.count = 3; break; }
+			}
+		}
+		if (s.count == 3)
+		{
+			const Vector3 n = Vector3::Cross(s.v[1].w - s.v[0].w, s.v[2].w - s.v[0].w).normalized();
+			auto offPlane = [&]() { const float h = Vector3::Dot(n, s.v[3].w - s.v[0].w); return h * h > epsSq; };
+			support(n, s.v[3]);
+			if (!offPlane()) support(-n, s.v[3]);
+			if (offPlane()) s.count = 4;
+		}
+		if (s.count < 4) return false; // 潰れている
+
+		SimplexVertex verts[EPAMaxVertices];
+		EPAFace faces[EPAMaxFaces];
+		int vertCount = 4, faceCount = 0;
+		for (int i = 0; i < 4; i++) verts[i] = s.v[i];
+
+		auto makeFace = [&](int i, int j, int k, EPAFace& f) -> bool
+			{
+				const Vector3 n = Vector3::Cross(verts[j].w - verts[i].w, verts[k].w - verts[i].w);
+				const float len = n.length();
+				if (len < 1e-12f) return false;
+				f.v[0] = i; f.v[1] = j; f.v[2] = k;
+				f.n = n / len;
+				f.d = Vector3::Dot(f.n, verts[i].w);
+				return true;
+			};
+
+		// ----- 最初の四面体（重心が内側になるよう向きを揃える） -----
+		const Vector3 center = (verts[0].w + verts[1].w + verts[2].w + verts[3].w) * 0.25f;
+		static const int TetraFaces[4][3] = { { 0, 1, 2 }, { 0, 3, 1 }, { 0, 2, 3 }, { 1, 3, 2 } };
+		for (const auto& t : TetraFaces)
+		{
+			EPAFace f;
+			if (!makeFace(t[0], t[1], t[2], f)) return false;
+			if (Vector3::Dot(f.n, center - verts[t[0]].w) > 0.0f && !makeFace(t[0], t[2], t[1], f)) return false;
+			faces[faceCount++] = f;
+		}
+
+		// ----- 一番近い面を押し広げる -----
+		int closest = 0;
+		for (;;)
+		{
+			closest = 0;
+			for (int i = 1; i < faceCount; i++)
+				if (faces[i].d < faces[closest].d) closest = i;
+			const EPAFace best = faces[closest];
+
+			SimplexVertex w;
+			support(best.n, w);
+			if (Vector3::Dot(w.w, best.n) - best.d < EPATolerance) break; // これ以上広がらない
+			if (vertCount == EPAMaxVertices) break;
+			const int newIndex = vertCount;
+			verts[vertCount++] = w;
+
+			// 新しい点から見える面を消して、地平線の辺を集める
+			int edges[EPAMaxEdges][2];
+			int edgeCount = 0;
+			bool overflow = false;
+			for (int i = 0; i < faceCount; )
+			{
+				if (Vector3::Dot(faces[i].n, w.w - verts[faces[i].v[0]].w) <= 0.0f) { i++; continue; }
+				for (int k = 0; k < 3; k++)
+				{
+					const int e0 = faces[i].v[k], e1 = faces[i].v[(k + 1) % 3];
+					// 逆向きの辺があれば両側とも消える面なので地平線ではない
+					bool shared = false;
+					for (int e = 0; e < edgeCount; e++)
+					{
+						if (edges[e][0] == e1 && edges[e][1] == e0)
+						{
+							edges[e][0] = edges[edgeCount - 1][0];
+							edges[e][1] = edges[edgeCount - 1][1];
+							edgeCount--;
+							shared = true;
+							break;
+						}
+					}
+					if (shared) continue;
+					if (edgeCount == EPAMaxEdges) { overflow = true; continue; }
+					edges[edgeCount][0] = e0;
+					edges[edgeCount][1] = e1;
+					edgeCount++;
+				}
+				faces[i] = faces[--faceCount]; // 消す
+			}
+			if (overflow || faceCount + edgeCount > EPAMaxFaces) return false;
+
+			for (int e = 0; e < edgeCount; e++)
+			{
+				EPAFace f;
+				if (makeFace(edges[e][0], edges[e][1], newIndex, f)) faces[faceCount++] = f;
+			}
+			if (faceCount == 0) return false;
+		}
+
+		// ----- 原点を面に落とした点の重心座標から、A / B の点を復元 -----
+		const EPAFace& f = faces[closest];
+		const Vector3 p = f.n * f.d;
+		const Vector3 a0 = verts[f.v[0]].w, a1 = verts[f.v[1]].w, a2 = verts[f.v[2]].w;
+		const Vector3 n = Vector3::Cross(a1 - a0, a2 - a0);
+		const float area = Vector3::Dot(n, n);
+		float u = Vector3::Dot(Vector3::Cross(a1 - p, a2 - p), n) / area;
+		float v = Vector3::Dot(Vector3::Cross(a2 - p, a0 - p), n) / area;
+		float t = 1.0f - u - v;
+
+		out.normal = f.n; // A - B の外向き ＝ A → B
+		out.depth  = f.d;
+		out.pointA = verts[f.v[0]].a * u + verts[f.v[1]].a * v + verts[f.v[2]].a * t;
+		out.pointB = verts[f.v[0]].b * u + verts[f.v[1]].b * v + verts[f.v[2]].b * t;
+		return true;
+	}
+}
+
+// ==================================================
+// ----- 凸形状 -----
+// ==================================================
+SupportShape SupportShape::Sphere(const Vector3& center, float radius)
+{
+	SupportShape s;
+	s.type = Type::Point;
+	s.p[0] = center;
+	s.radius = radius;
+	return s;
+}
+SupportShape SupportShape::Capsule(const Vector3& p0, const Vector3& p1, float radius)
+{
+	SupportShape s;
+	s.type = Type::Segment;
+	s.p[0] = p0;
+	s.p[1] = p1;
+	s.radius = radius;
+	return s;
+}
+SupportShape SupportShape::Box(const Vector3& center, const Vector3 axes[3], const Vector3& half)
+{
+	SupportShape s;
+	s.type = Type::Box;
+	s.p[0] = center;
+	for (int i = 0; i < 3; i++) s.axis[i] = axes[i];
+	s.half = half;
+	return s;
+}
+SupportShape SupportShape::Triangle(const Vector3& a, const Vector3& b, const Vector3& c)
+{
+	SupportShape s;
+	s.type = Type::Triangle;
+	s.p[0] = a;
+	s.p[1] = b;
+	s.p[2] = c;
+	return s;
+}
+SupportShape SupportShape::Hull(const ConvexHull* hull, const Vector3& position, const Vector3 axes[3], const Vector3& scale)
+{
+	assert(hull);
+	SupportShape s;
+	s.type = Type::Hull;
+	s.hull = hull;
+	s.p[0] = position;
+	for (int i = 0; i < 3; i++) s.axis[i] = axes[i];
+	s.half = scale;
+	return s;
+}
+Vector3 SupportShape::Support(const Vector3& dir) const
+{
+	switch (type)
+	{
+	case Type::Point:
+		return p[0];
+	case Type::Segment:
+		return Vector3::Dot(p[0], dir) >= Vector3::Dot(p[1], dir) ? p[0] : p[1];
+	case Type::Triangle:
+	{
+		const float d0 = Vector3::Dot(p[0], dir);
+		const float d1 = Vector3::Dot(p[1], dir);
+		const float d2 = Vector3::Dot(p[2], dir);
+		if (d0 >= d1 && d0 >= d2) return p[0];
+		return d1 >= d2 ? p[1] : p[2];
+	}
+	case Type::Box:
+	{
+		Vector3 out = p[0];
+		for (int i = 0; i < 3; i++)
+			out += axis[i] * (Vector3::Dot(axis[i], dir) >= 0.0f ? half[i] : -half[i]);
+		return out;
+	}
+	case Type::Hull:
+	{
+		// 方向をローカルに移して山登り（スケールは掛けておく）
+		const Vector3 local(Vector3::Dot(axis[0], dir) * half.x, Vector3::Dot(axis[1], dir) * half.y, Vector3::Dot(axis[2], dir) * half.z);
+		hint = hull->SupportIndex(local, hint);
+		return HullToWorld(hull->Vertex(hint));
+	}
+	}
+	return p[0];
+}
+Vector3 SupportShape::Center() const
+{
+	switch (type)
+	{
+	case Type::Segment:	 return (p[0] + p[1]) * 0.5f;
+	case Type::Triangle: return (p[0] + p[1] + p[2]) * (1.0f / 3.0f);
+	case Type::Hull:	 return HullToWorld(hull->Centroid());
+	default:			 return p[0];
+	}
+}
+void SupportShape::ComputeBounds(Vector3& outMin, Vector3& outMax) const
+{
+	for (int k = 0; k < 3; k++)
+	{
+		Vector3 e{};
+		e[k] = 1.0f;
+		outMax[k] = Support(e)[k] + radius;
+		outMin[k] = Support(-e)[k] - radius;
+	}
+}
+
+// ==================================================
+// ----- GJK -----
+// ==================================================
+// --------------------------------------------------
+// コア形状同士の最近点
+// --------------------------------------------------
+GJK::DistanceResult GJK::Distance(const SupportShape& a, const Vector3& offsetA, const SupportShape& b)
+{
+	Simplex s;
+	return SolveDistance(a, offsetA, b, s);
+}
+// --------------------------------------------------
+// 形状キャスト（保守的前進）
+// 平行移動だけなら距離は t について凸なので、「今の距離 / 近づく速さ」だけ進めても行き過ぎない
+// --------------------------------------------------
+bool GJK::ShapeCast(const SupportShape& a, const Vector3& delta, const SupportShape& b, float maxFraction, CastResult& out)
+{
+	if (delta.lengthSq() < 1e-16f) return false;
+
+	const float radius = a.radius + b.radius;
+	float t = 0.0f;
+	Vector3 n{};
+	DistanceResult r;
+	for (int iter = 0; iter < CastMaxIterations; iter++)
+	{
+		const DistanceResult current = Distance(a, delta * t, b);
+		if (current.overlap)
+		{
+			if (iter == 0) return false; // コアが最初から重なっている
+			break;						 // 誤差で重なったら１つ前の法線で当たりにする
+		}
+		r = current;
+
+		n = (r.pointB - r.pointA) / r.distance; // A→B
+		const float separation = r.distance - radius;
+		const float approach = Vector3::Dot(delta, n);
+		if (separation <= CastTarget + CastTolerance)
+		{
+			// 最初から触れているなら、近づいていく相手だけ当たりにする
+			if (iter == 0 && (separation < -CastTolerance || approach <= 0.0f)) return false;
+			break;
+		}
+		if (approach <= 0.0f) return false; // 離れていく
+
+		t += (separation - CastTarget) / approach;
+		if (t > maxFraction) return false;
+	}
+
+	out.fraction = t;
+	out.normal = -n;
+	out.point = r.pointB - n * b.radius;
+	return true;
+}
+// --------------------------------------------------
+// 半径込みのめり込み
+// --------------------------------------------------
+bool GJK::Penetration(const SupportShape& a, const SupportShape& b, PenetrationResult& out)
+{
+	const float radius = a.radius + b.radius;
+	Simplex s;
+	const DistanceResult r = SolveDistance(a, Vector3(), b, s);
+	if (!r.overlap)
+	{
+		// ----- コアは離れている：最近点から -----
+		out.normal = (r.pointB - r.pointA) / r.distance;
+		out.depth  = radius - r.distance;
+	}
+	else
+	{
+		// ----- コアが重なっている：EPA -----
+		if (!SolvePenetration(a, b, s, out)) return false;
+		out.depth += radius;
+	}
+	out.pointA = (r.overlap ? out.pointA : r.pointA) + out.normal * a.radius;
+	out.pointB = (r.overlap ? out.pointB : r.pointB) - out.normal * b.radius;
+	return true;
+}
@@ -0,0 +1,105 @@
+/*
+	GJK.h
+	20261017  hanaue sho
+	凸形状同士の距離（GJK）と形状キャスト（保守的前進）
+	形状は「コア形状（点、線分、箱、三角形、凸包）＋半径」で表す
+	球は点＋半径、カプセルは線分＋半径
+	めり込んでいるときは EPA で一番浅く抜ける向きを求める
+*/
+#ifndef GJK_H_
+#define GJK_H_
+#include <cstdint>
+#include "Vector3.h"
+
+class ConvexHull;
+
+// ==================================================
+// ----- 凸形状 -----
+// ==================================================
+struct SupportShape
+{
+	enum class Type : uint8_t { Point, Segment, Box, Triangle, Hull };
+	Type type = Type::Point;
+
+	Vector3 p[3];	   // Point: p[0]、Segment: p[0]～p[1]、Triangle: p[0]～p[2]、Box: 中心 p[0]、Hull: 位置 p[0]
+	Vector3 axis[3];   // Box / Hull の軸（ワールド、正規化済み）
+	Vector3 half{};	   // Box の半分のサイズ（スケール適用後）、Hull のスケール
+	float radius = 0.0f; // コア形状からの膨らみ
+	const ConvexHull* hull = nullptr; // Hull の頂点（ローカル）
+	mutable int hint = 0;			  // Hull の前回のサポート頂点（山登りの出発点）
+
+	// ----- 作成 -----
+	static SupportShape Sphere(const Vector3& center, float radius);
+	static SupportShape Capsule(const Vector3& p0, const Vector3& p1, float radius);
+	static SupportShape Box(const Vector3& center, const Vector3 axes[3], const Vector3& half);
+	static SupportShape Triangle(const Vector3& a, const Vector3& b, const Vector3& c);
+	static SupportShape Hull(const ConvexHull* hull, const Vector3& position, const Vector3 axes[3], const Vector3& scale);
+
+	// Hull のローカル → ワールド
+	Vector3 HullToWorld(const Vector3& local) const
+	{
+		return p[0] + axis[0] * (local.x * half.x) + axis[1] * (local.y * half.y) + axis[2] * (local.z * half.z);
+	}
+
+	// --------------------------------------------------
+	// コア形状の dir 方向で一番遠い点（半径は含まない）
+	// --------------------------------------------------
+	Vector3 Support(const Vector3& dir) const;
+	Vector3 Center() const;
+	// --------------------------------------------------
+	// 半径込みの AABB の min / max
+	// --------------------------------------------------
+	void ComputeBounds(Vector3& outMin, Vector3& outMax) const;
+};
+
+// ==================================================
+// ----- GJK -----
+// ==================================================
+namespace GJK
+{
+	// --------------------------------------------------
+	// コア形状同士の最近点
+	// offsetA だけ A をずらして測る（キャストで形状を作り直さないため）
+	// overlap のときは distance = 0 で最近点は不定
+	// --------------------------------------------------
+	struct DistanceResult
+	{
+		bool	overlap = false;
+		float	distance = 0.0f;
+		Vector3 pointA{};
+		Vector3 pointB{};
+	};
+	DistanceResult Distance(const SupportShape& a, const Vector3& offsetA, const SupportShape& b);
+
+	// --------------------------------------------------
+	// 形状キャスト
+	// A を delta 動かしたとき、B に最初に触れる割合 fraction（maxFraction まで）を保守的前進で求める
+	// normal は B の面の法線（A の方を向く）、point は B の表面上の接触点
+	// 最初からめり込んでいる、または離れていく相手は当たり無し
+	// --------------------------------------------------
+	struct CastResult
+	{
+		float	fraction = 1.0f;
+		Vector3 normal{};
+		Vector3 point{};
+	};
+	bool ShapeCast(const SupportShape& a, const Vector3& delta, const SupportShape& b, float maxFraction, CastResult& out);
+
+	// --------------------------------------------------
+	// 半径込みのめり込み
+	// コアが離れていれば GJK の最近点から、重なっていれば EPA で求める
+	// normal は A → B、depth > 0 でめり込み（負なら離れている距離）
+	// pointA / pointB はそれぞれの表面上の点
+	// EPA が潰れた形で解けなかったら false
+	// --------------------------------------------------
+	struct PenetrationResult
+	{
+		Vector3 normal{};
+		float	depth = 0.0f;
+		Vector3 pointA{};
+		Vector3 pointB{};
+	};
+	bool Penetration(const SupportShape& a, const SupportShape& b, PenetrationResult& out);
+}
+
+#endif
@@ -49,7 +49,7 @@ void GameMainScene::Init()
 {
 	Scene::Init();
 
-	// J -----
+	// カメラ -----
 	{
 		Camera* pCamera = AddGameObject<Camera>(0);
 		pCamera->Init();
@@ -67,7 +67,7 @@ void GameMainScene::Init()
 		//as->Play();
 	}
 	{
-		// 2DJ
+		// 2Dカメラ
 		Camera* pCamera = AddGameObject<Camera>(0);
 		pCamera->Init();
 
@@ -90,7 +90,7 @@ void GameMainScene::Init()
 	pLightObject->Init();
 	pLightObject->Transform()->SetPosition({ -7, 0, 0 });*/
 
-	// vC[ -----
+	// プレイヤー -----
 	PlayerObject* pPlayer = AddGameObject<PlayerObject>(1);
 	pPlayer->Init();
 	auto* psm = pPlayer->GetComponent<PlayerStateManagerComponent>();
@@ -99,20 +99,20 @@ void GameMainScene::Init()
 	follow->SetTargetObject(pPlayer);
 	psm->SetCameraObject(pCamera);
 
-	// XJCh[
+	// スカイドーム
 	SkydomeObject* pSkydome = AddGameObject<SkydomeObject>(1);
 	pSkydome->Init();
 	//pSkydome->Transform()->SetParent(pPlayer->Transform());
 
-	//// ThobO
+	//// サンドバッグ
 	//SandbagObject* pSandbag = AddGameObject<SandbagObject>(1);
 	//pSandbag->Init();
 
-	//// m
+	//// ノレン
 	//NorenObject* pNoren = AddGameObject<NorenObject>(1);
 	//pNoren->Init();
 
-	// u[
+	// ブーメラン
 	BoomerangObject* pBoomerang = AddGameObject<BoomerangObject>(1);
 	pBoomerang->Init();
 	auto* state = pBoomerang->GetComponent<BoomerangStateManagerComponent>();
@@ -120,14 +120,14 @@ void GameMainScene::Init()
 	state->ChangeStateIdle();
 	psm->SetBoomerangObject(pBoomerang); // Player Setter
 
-	// Gl~[
+	// エネミー
 	EnemyObject* pEnemyObject = AddGameObject<EnemyObject>(1);
 	pEnemyObject->Init();
 	pEnemyObject = AddGameObject<EnemyObject>(1);
 	pEnemyObject->Init();
 	pEnemyObject->Transform()->SetPosition({ 0, 10, 80 });
 
-	// -----
+	// りんご-----
 	AppleObject* pApple = AddGameObject<AppleObject>(1);
 	pApple->Init();
 	pApple->Transform()->SetPosition({ 3, -3, 3 });
@@ -155,7 +155,7 @@ void GameMainScene::Init()
 		}
 	}
 
-	// Gl~[ -----
+	// エネミー -----
 	Enemy* pEnemy = AddGameObject<Enemy>(1);
 	pEnemy->Init();
 	pEnemy->Transform()->SetPosition({ 5, 3, 0 });
@@ -194,14 +194,14 @@ void GameMainScene::Init()
 	hjc->SetSpringTarget(3);
 	hjc->RegisterToPhysicsSystem();*/
 
-	// 
+	// 床
 	pEnemy = AddGameObject<Enemy>(1);
 	pEnemy->Init();
 	pEnemy->Transform()->SetPosition({ 0, -10, 0 });
 	pEnemy->Transform()->SetScale({ 10, 5, 10 });
 	pEnemy->Transform()->SetEulerAngles({ 0, 0, 0.1f });
 	pEnemy->GetComponent<Collider>()->SetBox({ 1, 1, 1 });
-	pEnemy->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Static); // 
+	pEnemy->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Static); // 壁
 	//djc = pEnemy->AddComponent<DistanceJointComponent>();
 	//djc->SetOtherObject(pPlayerEx);
 	//djc->SetLocalAnchorA(Vector3(0, 5, 0));
@@ -209,45 +209,45 @@ void GameMainScene::Init()
 	//djc->SetMode(DistanceJointComponent::DistanceJointMode::Rope);
 	//djc->RegisterToPhysicsSystem();
 
-	// ǂS
+	// 壁４方
 	pEnemy = AddGameObject<Enemy>(1);
 	pEnemy->Init();
 	pEnemy->Transform()->SetPosition({ 10.5f, -4, 0 });
 	pEnemy->Transform()->SetScale({ 1, 5, 10 });
 	pEnemy->GetComponent<Collider>()->SetBox({ 1, 1, 1 });
-	pEnemy->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Static); // 
+	pEnemy->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Static); // 壁
 
 	pEnemy = AddGameObject<Enemy>(1);
 	pEnemy->Init();
 	pEnemy->Transform()->SetPosition({ -10.5f, -4, 0 });
 	pEnemy->Transform()->SetScale({ 1, 1, 10 });
 	pEnemy->GetComponent<Collider>()->SetBox({ 1, 1, 1 });
-	pEnemy->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Static); // 
+	pEnemy->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Static); // 壁
 
 	pEnemy = AddGameObject<Enemy>(1);
 	pEnemy->Init();
 	pEnemy->Transform()->SetPosition({ 0, -4, 10.5f });
 	pEnemy->Transform()->SetScale({ 10, 1, 1 });
 	pEnemy->GetComponent<Collider>()->SetBox({ 1, 1, 1 });
-	pEnemy->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Static); // 
+	pEnemy->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Static); // 壁
 
 	pEnemy = AddGameObject<Enemy>(1);
 	pEnemy->Init();
 	pEnemy->Transform()->SetPosition({ 0, -4, -10.5f });
 	pEnemy->Transform()->SetScale({ 10, 1, 1 });
 	pEnemy->GetComponent<Collider>()->SetBox({ 1, 1, 1 });
-	pEnemy->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Static); // 
+	pEnemy->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Static); // 壁
 
-	// 
+	// 柵
 	CreateFences();
 
-	// eg
+	// テント
 	CreateTents();
 
-	// 
+	// 木
 	CreateTrees();
 
-	// Cg֌W
+	// ライト関係
 	LightApp light = {};
 	light.enable = 1;
 	light.diffuse = Vector4(1.0f, 1.0f, 1.0f, 1.0f);
@@ -255,12 +255,12 @@ void GameMainScene::Init()
 	light.direction = Vector4(0.3f, -1.0f, 0.0f, 0.0f).normalized();
 	Renderer::SetLight(light);
 
-	// bVtB[h
+	// メッシュフィールド
 	Field* pField = AddGameObject<Field>(1);
 	pField->Init();
 	pField->Transform()->SetPosition({ -500, -5, -500 });
 
-	// VF[_[֌W
+	// シェーダー関係
 	ToonApp toon = MakeToon(ToonPreset::GravityRush2Like);
 	Renderer::SetToon(toon);
 
@@ -299,7 +299,7 @@ void GameMainScene::CreateFences()
 
 	float radius = 200.0f;
 
-	// n p`
+	// n 角形を作る
 	const int numVertex = 8 * 6;
 	for (int i = 0; i < numVertex; i++)
 	{
@@ -315,7 +315,7 @@ void GameMainScene::CreateFences()
 		pFence->Transform()->RotateAxis({ 0, 1, 0 }, -rad + myPI / 2.0f);
 	}
 
-	// f
+	// 横断
 	for (int i = 0; i < 7; i++)
 	{
 		float rad = -myPI / 4.0f;
@@ -364,7 +364,7 @@ void GameMainScene::CreateTrees()
 
 	float radiusBase = 280.0f;
 
-	// n p`
+	// n 角形を作る
 	const int numVertex = 8 * 6;
 	for (int j = 0; j < 5; j++)
 	{
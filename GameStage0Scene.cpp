@@ -48,7 +48,7 @@ void GameStage0Scene::Init()
 {
 	Scene::Init();
 
-	// J -----
+	// カメラ -----
 	{
 		Camera* pCamera = AddGameObject<Camera>(0);
 		pCamera->Init();
@@ -66,7 +66,7 @@ void GameStage0Scene::Init()
 		//as->Play();
 	}
 	{
-		// 2DJ
+		// 2Dカメラ
 		Camera* pCamera = AddGameObject<Camera>(0);
 		pCamera->Init();
 
@@ -76,7 +76,7 @@ void GameStage0Scene::Init()
 
 	}
 
-	// vC[ -----
+	// プレイヤー -----
 	PlayerObject* pPlayer = AddGameObject<PlayerObject>(1);
 	pPlayer->Init();
 	auto* psm = pPlayer->GetComponent<PlayerStateManagerComponent>();
@@ -85,7 +85,7 @@ void GameStage0Scene::Init()
 	follow->SetTargetObject(pPlayer);
 	psm->SetCameraObject(pCamera);
 
-	// u[
+	// ブーメラン
 	BoomerangObject* pBoomerang = AddGameObject<BoomerangObject>(1);
 	pBoomerang->Init();
 	auto* state = pBoomerang->GetComponent<BoomerangStateManagerComponent>();
@@ -93,22 +93,22 @@ void GameStage0Scene::Init()
 	state->ChangeStateIdle();
 	psm->SetBoomerangObject(pBoomerang); // Player Setter
 
-	// bVtB[h
+	// メッシュフィールド
 	Field* pField = AddGameObject<Field>(1);
 	pField->Init();
 	pField->Transform()->SetPosition({ -500, -5, -500 });
 
-	// XJCh[
+	// スカイドーム
 	SkydomeObject* pSkydome = AddGameObject<SkydomeObject>(1);
 	pSkydome->Init();
 
-	// 
+	// 柵
 	CreateFences();
 
-	// 
+	// 木
 	CreateTrees();
 
-	// Cg֌W
+	// ライト関係
 	LightApp light = {};
 	light.enable = 1;
 	light.diffuse = Vector4(1.0f, 1.0f, 1.0f, 1.0f);
@@ -116,7 +116,7 @@ void GameStage0Scene::Init()
 	light.direction = Vector4(0.3f, -1.0f, 0.0f, 0.0f).normalized();
 	Renderer::SetLight(light);
 
-	// VF[_[֌W
+	// シェーダー関係
 	ToonApp toon = MakeToon(ToonPreset::GravityRush2Like);
 	Renderer::SetToon(toon);
 
@@ -155,7 +155,7 @@ void GameStage0Scene::CreateFences()
 
 	float radius = 200.0f;
 
-	// n p`
+	// n 角形を作る
 	const int numVertex = 8 * 6;
 	for (int i = 0; i < numVertex; i++)
 	{
@@ -171,7 +171,7 @@ void GameStage0Scene::CreateFences()
 		pFence->Transform()->RotateAxis({ 0, 1, 0 }, -rad + myPI / 2.0f);
 	}
 
-	// f
+	// 横断
 	for (int i = 0; i < 7; i++)
 	{
 		float rad = -myPI / 4.0f;
@@ -220,7 +220,7 @@ void GameStage0Scene::CreateTrees()
 
 	float radiusBase = 280.0f;
 
-	// n p`
+	// n 角形を作る
 	const int numVertex = 8 * 6;
 	for (int j = 0; j < 5; j++)
 	{
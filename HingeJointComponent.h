@@ -1,103 +1,103 @@
 /*
 	HingeJointComponent.h
 	20251204  hanaue sho
-	qWWCg
-	1ɂ̂݉]邷WCg
+	ヒンジジョイント
+	1軸にのみ回転をゆるすジョイント
 */
 #ifndef HINGEJOINTCOMPONENT_H_
 #define HINGEJOINTCOMPONENT_H_
 #include "Component.h"
 #include "Vector3.h"
 #include "GameObject.h"
-#include "physicsSystem.h"
+#include "PhysicsSystem.h"
 
 class Rigidbody;
 
 class HingeJointComponent : public Component
 {
 	// ==================================================
-	// ----- vf -----
+	// ----- 要素 -----
 	// ==================================================
 	// --------------------------------------------------
-	// gRigidbody
+	// 自身のRigidbody
 	// --------------------------------------------------
 	Rigidbody* m_pRigidbody = nullptr;
 	// --------------------------------------------------
-	// ̃|C^
+	// 相方のポインタ
 	// --------------------------------------------------
 	GameObject* m_pOtherObject = nullptr;
 	// --------------------------------------------------
-	// eAJ[i[JWj
+	// 各アンカー（ローカル座標）
 	// --------------------------------------------------
 	Vector3 m_LocalAnchorA = Vector3(0.0f, 0.0f, 0.0f);
 	Vector3 m_LocalAnchorB = Vector3(0.0f, 0.0f, 0.0f);
 	// --------------------------------------------------
-	// Œ莲i[JWj
+	// 固定軸（ローカル座標）
 	// --------------------------------------------------
 	Vector3 m_Axis = Vector3(1.0f, 0.0f, 0.0f);
 
 	// ==================================================
-	// ----- px~bg -----
+	// ----- 角度リミット -----
 	// ==================================================
 	// --------------------------------------------------
-	// px~bgL
+	// 角度リミット有効化
 	// --------------------------------------------------
 	bool m_EnableLimit = false;
 	// --------------------------------------------------
-	// ŏAőpxiWApj
+	// 最小、最大角度（ラジアン角）
 	// --------------------------------------------------
 	float m_LimitMin = 0.0f;
 	float m_LimitMax = 1.0f;
 	// --------------------------------------------------
-	// [JxNgi~bgȂǂɎgj
-	// RefB  Register ŎŌvZ
+	// ローカル基底ベクトル（リミットなどに使う）
+	// RefB は Register 内で自動で計算される
 	// --------------------------------------------------
 	Vector3 m_LocalRefA = { 0.0f, 0.0f, 0.0f };
 	Vector3 m_LocalRefB = { 0.0f, 0.0f, 0.0f };
 
 	// ==================================================
-	// ----- [^[ -----
+	// ----- モーター -----
 	// ==================================================
 	// --------------------------------------------------
-	// [^[L
+	// モーター有効化
 	// --------------------------------------------------
 	bool m_EnableMotor = false;
 	// --------------------------------------------------
-	// ڕWpx[rad/s]
+	// 目標角速度[rad/s]
 	// --------------------------------------------------
 	float m_MotorSpeed = 0.0f;
 	// --------------------------------------------------
-	// őgN
+	// 最大トルク
 	// --------------------------------------------------
 	float m_MaxMotorTorque = 0.0f;
 
 	// ==================================================
-	// ----- ol -----
+	// ----- バネ -----
 	// ==================================================
 	// --------------------------------------------------
-	// olL
+	// バネ有効化
 	// --------------------------------------------------
 	bool m_EnableSpring = false;
 	// --------------------------------------------------
-	// ڕWpx
+	// 目標角度
 	// --------------------------------------------------
 	float m_SpringTarget = 0.0f;
 	// --------------------------------------------------
-	// ol
+	// バネ剛性
 	// --------------------------------------------------
 	float m_SpringStiffness = 0.0f;
 	// --------------------------------------------------
-	// ol
+	// バネ減衰
 	// --------------------------------------------------
 	float m_SpringDamping = 0.0f;
 
 	// --------------------------------------------------
-	// PhysicsSystem ̍̔
+	// PhysicsSystem の採番
 	// --------------------------------------------------
 	int		m_JointId = -1;
 public:
 	// ==================================================
-	// ----- Zb^[EQb^[ -----
+	// ----- セッター・ゲッター -----
 	// ==================================================
 	void SetOtherObject(GameObject* other) { m_pOtherObject = other; }
 	void SetLocalAnchorA(const Vector3& anchor) { m_LocalAnchorA = anchor; }
@@ -121,17 +121,17 @@ public:
 	GameObject* OtherObject() const { return m_pOtherObject; }
 	const Vector3& LocalAnchorA() const { return m_LocalAnchorA; }
 	const Vector3& LocalAnchorB() const { return m_LocalAnchorB; }
-	const Vector3& Axis() const { return m_Axis.normalized(); }
-	const bool EnableLimit() const { return m_EnableLimit; }
-	const float LimitMin() const { return m_LimitMin; }
-	const float LimitMax() const { return m_LimitMax; }
-	const bool EnableMotor() const { return m_EnableMotor; }
-	const float MotorSpeed() const { return m_MotorSpeed; }
-	const float MaxMotorTorque() const { return m_MaxMotorTorque; }
-	const bool EnableSpring() const { return m_EnableSpring; }
-	const float SpringTarget() const { return m_SpringTarget; }
-	const float SpringDamping() const { return m_SpringDamping; }
-	const float SpringStiffness() const { return m_SpringStiffness; }
+	Vector3 Axis() const { return m_Axis.normalized(); } // 一時オブジェクトなので値で返す
+	bool EnableLimit() const { return m_EnableLimit; }
+	float LimitMin() const { return m_LimitMin; }
+	float LimitMax() const { return m_LimitMax; }
+	bool EnableMotor() const { return m_EnableMotor; }
+	float MotorSpeed() const { return m_MotorSpeed; }
+	float MaxMotorTorque() const { return m_MaxMotorTorque; }
+	bool EnableSpring() const { return m_EnableSpring; }
+	float SpringTarget() const { return m_SpringTarget; }
+	float SpringDamping() const { return m_SpringDamping; }
+	float SpringStiffness() const { return m_SpringStiffness; }
 	const Vector3& LocalRefA() const { return m_LocalRefA; }
 	const Vector3& LocalRefB() const { return m_LocalRefB; }
 
@@ -139,16 +139,16 @@ public:
 	void SetJointId(int id) { m_JointId = id; }
 
 	// ==================================================
-	// ----- PhysicsSystemւ̓o^ -----
+	// ----- PhysicsSystemへの登録 -----
 	// ==================================================
 	void RegisterToPhysicsSystem()
 	{
-		// ȂǂZbgĂo^i{͍XV֐̕ǂȁj
+		// 相方などをセットしてから登録する（本当は更新する関数の方が良きかな）
 		Manager::GetScene()->physicsSystem().RegisterHingeJoint(this);
 	}
 
 	// ==================================================
-	// ----- CtTCN -----
+	// ----- ライフサイクル -----
 	// ==================================================
 	void OnAdded() override
 	{
@@ -158,12 +158,12 @@ public:
 			assert(false && "HingeJoint requires Rigidbody on owner");
 			return;
 		}
-		// PhysicsSystem ɓo^͂ł͍sȂ
+		// PhysicsSystem に登録はここでは行わない
 
 	}
 	void Uninit() override
 	{
-		// PhysicsSystem 폜
+		// PhysicsSystem から削除
 		Manager::GetScene()->physicsSystem().UnregisterHingeJoint(this);
 	}
 };
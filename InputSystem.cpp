@@ -4,5 +4,5 @@
 */
 #include"InputSystem.h"
 
-// ̒`
+// 実体定義
 Vector3 InputSystem::m_Input = Vector3(0, 0, 0);
\ No newline at end of file
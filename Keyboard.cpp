@@ -1,11 +1,11 @@
 //--------------------------------------------------------------------------------------
 // File: Keyboard.cpp
 //
-// L[{[hW[
+// キーボードモジュール
 //
 //--------------------------------------------------------------------------------------
 // 2020/06/07
-//     DirectXTKAȂ񂿂CpɃVFCvAbv
+//     DirectXTKより、なんちゃってC言語用にシェイプアップ改変
 //
 // Licensed under the MIT License.
 //
@@ -17,7 +17,7 @@
 #include <assert.h>
 //#include "debugPrintf.h"
 
-static_assert(sizeof(Keyboard_State) == 256 / 8, "L[{[hԍ\̂̃TCYsv");
+static_assert(sizeof(Keyboard_State) == 256 / 8, "キーボード状態構造体のサイズ不一致");
 
 
 static Keyboard_State gState = {};
@@ -26,7 +26,7 @@ static Keyboard_State gStateOld = {};
 
 void keycopy()
 {
-    gStateOld = gState; //ÕL[ۑ
+    gStateOld = gState; //前回のキー情報を保存
     
 }
 
@@ -70,7 +70,7 @@ bool Keyboard_IsKeyDown(Keyboard_Keys key, const Keyboard_State* pState)
     return false;
 }
 
-//gK[
+//トリガー判定
 bool Keyboard_IsKeyDownTrigger(Keyboard_Keys key)
 {
     if (key <= 0xfe)
@@ -113,7 +113,7 @@ bool Keyboard_IsKeyUp(Keyboard_Keys key)
 }
 
 
-// L[{[ȟ݂̏Ԃ擾
+// キーボードの現在の状態を取得する
 const Keyboard_State* Keyboard_GetState(void)
 {
     return &gState;
@@ -131,7 +131,7 @@ void Keyboard_Reset(void)
 }
 
 
-// L[{[ĥ߂̃EHǂbZ[WvV[WtbN֐
+// キーボード制御のためのウォンどうメッセージプロシージャフック関数
 void Keyboard_ProcessMessage(UINT message, WPARAM wParam, LPARAM lParam)
 {
     bool down = false;
@@ -162,7 +162,7 @@ void Keyboard_ProcessMessage(UINT message, WPARAM wParam, LPARAM lParam)
         vk = (int)MapVirtualKey(((unsigned int)lParam & 0x00ff0000) >> 16u, MAPVK_VSC_TO_VK_EX);
         if (!down)
         {
-            // VtgƉEVtg̗ɉꂽꍇɃNA悤ɂ邽߂̉
+            // 左シフトと右シフトの両方が同時に押された場合にクリアされるようにするための回避策
             keyUp(VK_LSHIFT);
             keyUp(VK_RSHIFT);
         }
@@ -1,11 +1,11 @@
 //--------------------------------------------------------------------------------------
 // File: Keyboard.h
 //
-// L[{[hW[
+// キーボードモジュール
 //
 //--------------------------------------------------------------------------------------
 // 2020/06/07
-//     DirectXTKAȂ񂿂CpɃVFCvAbv
+//     DirectXTKより、なんちゃってC言語用にシェイプアップ改変
 //
 // Licensed under the MIT License.
 //
@@ -21,7 +21,7 @@
 #include <memory>
 
 
-// L[
+// キー列挙
 typedef enum Keyboard_Keys_tag
 {
     KK_NONE               = 0x0,
@@ -203,7 +203,7 @@ typedef enum Keyboard_Keys_tag
 } Keyboard_Keys;
 
 
-// L[{[hԍ\
+// キーボード状態構造体
 typedef struct Keyboard_State_tag
 {
     bool Reserved0 : 8;
@@ -393,30 +393,30 @@ typedef struct Keyboard_State_tag
 } Keyboard_State;
 
 
-// L[{[hW[̏
+// キーボードモジュールの初期化
 void Keyboard_Initialize(void);
 
-// L[{[ȟ݂̃L[̏Ԃ擾
+// キーボードの現在のキー毎の状態を取得する
 bool Keyboard_IsKeyDown(Keyboard_Keys key);
 bool Keyboard_IsKeyUp(Keyboard_Keys key);
 
-// L[{[ȟ݂̏Ԃ擾
+// キーボードの現在の状態を取得する
 const Keyboard_State* Keyboard_GetState(void);
 const Keyboard_State* Keyboard_GetStateOld(void);
 
-// L[{[h̏ԂL[̏Ԃ擾
+// キーボードの状態からキー毎の状態を取得する
 bool Keyboard_IsKeyDown(Keyboard_Keys key, const Keyboard_State* pState);
 bool Keyboard_IsKeyUp(Keyboard_Keys key, const Keyboard_State* pState);
 
-// L[{[h̏ԂZbg
+// キーボードの状態をリセットする
 void Keyboard_Reset(void);
 
-// L[{[ĥ߂̃EHǂbZ[WvV[WtbN֐
+// キーボード制御のためのウォンどうメッセージプロシージャフック関数
 void Keyboard_ProcessMessage(UINT message, WPARAM wParam, LPARAM lParam);
 
 
 
-//gK[p
+//トリガー用
 bool Keyboard_IsKeyDownTrigger(Keyboard_Keys key);
 void    keycopy();
 
@@ -16,40 +16,40 @@ class LightComponent : public Component
 {
 private:
 	// ==================================================
-	// ----- \vf -----
+	// ----- 構成要素 -----
 	// ==================================================
 	// --------------------------------------------------
-	// gUF
+	// 拡散光色
 	// --------------------------------------------------
 	Vector3	m_Diffuse = Vector3(1.0f, 1.0f, 1.0f);
 
 	// --------------------------------------------------
-	// L
+	// 有効距離
 	// --------------------------------------------------
 	float m_Range = 10;
 
 	// --------------------------------------------------
-	// x
+	// 強度
 	// --------------------------------------------------
 	float m_Intensity = 1.0f;
 
 	// --------------------------------------------------
-	// dl
+	// 仕様中
 	// --------------------------------------------------
 	bool m_Enable = true;
 	
 	// --------------------------------------------------
-	// _[eB
+	// ダーティ
 	// --------------------------------------------------
 	bool m_Dirty = false;
 
 	// --------------------------------------------------
-	// Transform Q
+	// Transform 参照
 	// --------------------------------------------------
 	TransformComponent* m_pTransform = nullptr;
 public:
 	// ==================================================
-	// ----- Zb^[Qb^[-----
+	// ----- セッターゲッター-----
 	// ==================================================
 	const Vector3& Diffuse() const { return m_Diffuse; }
 	float Range()			 const { return m_Range; }
@@ -62,19 +62,19 @@ public:
 	void SetDirty	 (bool b)				  { m_Dirty = b; }
 
 	// ==================================================
-	// ----- CtTCN -----
+	// ----- ライフサイクル -----
 	// ==================================================
 	void OnAdded() override
 	{
-		//  LightManager ֓o^
+		// ここで LightManager へ登録する
 		Manager::GetScene()->lightManager().Register(this);
 
-		// Transform LbV
+		// Transform キャッシュ
 		m_pTransform = Owner()->Transform();
 	}
 	void Uninit() override
 	{
-		//  LightManager 폜
+		// ここで LightManager から削除する
 		Manager::GetScene()->lightManager().Unregister(this);
 	}
 };
@@ -1,7 +1,7 @@
 /*
 	LightManager.cpp
 	20251106  hanaue sho
-	Cg̏𓝊GPU֑閽߂o
+	ライトの情報を統括してGPUへ送る命令を出す
 */
 #include "LightManager.h"
 #include "LightComponent.h"
@@ -9,7 +9,7 @@
 #include "Vector3.h"
 
 // --------------------------------------------------
-// AI
+// 初期化、終了処理
 // --------------------------------------------------
 void LightManager::Init()
 {
@@ -21,12 +21,12 @@ void LightManager::Shutdown()
 }
 
 // --------------------------------------------------
-// t[̍ŏɃCgpbN
+// フレームの最初にライト情報をパックする
 // --------------------------------------------------
 void LightManager::BeginFrameAndUploadAllLights()
 {
 	m_Packed.clear();
-	m_Packed.reserve(m_Components.size()); // Ä̊m
+	m_Packed.reserve(m_Components.size()); // 連続領域の確保
 
 	for (auto* lc : m_Components)
 	{
@@ -44,13 +44,13 @@ void LightManager::BeginFrameAndUploadAllLights()
 		m_Packed.push_back(pl);
 	}
 
-	// obt@XV
+	// バッファ更新
 	const int count = static_cast<int>(m_Packed.size());
 	Renderer::SetPointLights(count ? m_Packed.data() : nullptr, count);
 }
 
 // --------------------------------------------------
-// ߖT̃Cg̃CfbNXԂ
+// 近傍のライトのインデックスを返す
 // --------------------------------------------------
 int LightManager::GetNearestIndexes(const Vector3& position, int k, int* outIndex)
 {
@@ -72,9 +72,9 @@ int LightManager::GetNearestIndexes(const Vector3& position, int k, int* outInde
 
 		const float intensity = pl.intensity;
 		const float att = 1.0f / (1.0f + distSq / (range * range));
-		const float score = intensity * att; // Score iƉe͂Zoj
+		const float score = intensity * att; // Score （距離と影響力から算出）
 
-		// ŏXbgƔr
+		// 最小スロットと比較
 		int minJ = 0;
 		for (int j = 1; j < k; j++)
 			if (top[j].score < top[minJ].score)
@@ -82,13 +82,13 @@ int LightManager::GetNearestIndexes(const Vector3& position, int k, int* outInde
 		if (score > top[minJ].score) top[minJ] = { score, i };
 	}
 
-	// XRÃm͖
+	// スコアが負のモノは無視
 	int count = 0;
 	for (int j = 0; j < k; j++)
 		if (top[j].idx >= 0)
 			outIndex[count++] = top[j].idx;
 
-	return count; // Ԃ
+	return count; // 総数を返す
 }
 
-// XgN`[hobt@@i15́j
+// ストラクチャードバッファ　（魔導書15章）
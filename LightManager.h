@@ -1,7 +1,7 @@
 /*
 	LightManager.h
 	20251105  hanaue sho
-	Cg̏𓝊GPU֑閽߂o
+	ライトの情報を統括してGPUへ送る命令を出す
 */
 #ifndef LIGHTMANAGER_H_
 #define LIGHTMANAGER_H_
@@ -17,18 +17,18 @@ class LightManager
 {
 private:
 	// ==================================================
-	// ----- \vf -----
+	// ----- 構成要素 -----
 	// ==================================================
 	// --------------------------------------------------
-	// eV[
+	// 親シーン
 	// --------------------------------------------------
-	Scene* m_pScene = nullptr; // ݂̃V[
+	Scene* m_pScene = nullptr; // 現在のシーン
 	// --------------------------------------------------
-	// o^ꂽ LightComponent
+	// 登録された LightComponent
 	// --------------------------------------------------
 	std::vector<LightComponent*> m_Components;
 	// --------------------------------------------------
-	// t[č\zAz
+	// 毎フレーム再構築する連続配列
 	// --------------------------------------------------
 	std::vector<PointLightApp> m_Packed;
 
@@ -37,17 +37,17 @@ public:
 	~LightManager() = default;
 
 	// --------------------------------------------------
-	// AI
+	// 初期化、終了処理
 	// --------------------------------------------------
 	void Init();
 	void Shutdown();
 
 	// --------------------------------------------------
-	// o^
+	// 登録
 	// --------------------------------------------------
 	void Register(LightComponent* lc) { m_Components.push_back(lc); }
 	// --------------------------------------------------
-	// o^
+	// 登録解除
 	// --------------------------------------------------
 	void Unregister(LightComponent* lc) 
 	{
@@ -56,11 +56,11 @@ public:
 	}
 
 	// --------------------------------------------------
-	// t[̍ŏɃCgpbN
+	// フレームの最初にライト情報をパックする
 	// --------------------------------------------------
 	void BeginFrameAndUploadAllLights();
 	// --------------------------------------------------
-	// ߖT̃Cg̃CfbNXԂ
+	// 近傍のライトのインデックスを返す
 	// --------------------------------------------------
 	int GetNearestIndexes(const Vector3& position, int k, int* outIndex);
 };
@@ -13,22 +13,22 @@
 #include "ColliderComponent.h"
 #include "RigidbodyComponent.h"
 #include "Renderer.h"
-#include "Texture.h"  // Texture::Load 
+#include "Texture.h"  // Texture::Load 既存
 
 void LightObject::Init()
 {
-	// 1) Transformi GameObject ctor Œǉς݁j擾ďpĂ
+	// 1) Transform（既に GameObject ctor で追加済み）を取得して初期姿勢を入れておく
 	auto* tf = GetComponent<TransformComponent>();
 	tf->SetPosition({ 2,0,0 });
 	tf->SetScale({ 1.0f, 1.0f, 1.0f });
 	tf->SetEulerAngles({ 0,0,0 });
 
-	// 2) MeshFilter ǉĒ_obt@
+	// 2) MeshFilter を追加して頂点バッファを作る
 	auto* mf = AddComponent<MeshFilterComponent>();
 	//MeshFactory::CreateSphere(mf, { 1, 12, 12});
 	MeshFactory::CreateCapsule(mf, { 1, 1});
 
-	// 3) Material ǉiVF[_/eNX`/}eAj
+	// 3) Material を追加（シェーダ/テクスチャ/マテリアル）
 	auto* mat = AddComponent<MaterialComponent>();
 
 	ID3D11VertexShader* vs = nullptr;
@@ -38,25 +38,25 @@ void LightObject::Init()
 	Renderer::CreatePixelShader(&ps, "shader\\PS_TexUnlit.cso");
 	mat->SetVSPS(vs, ps, il, /*takeVS*/true, /*takePS*/true, /*takeIL*/true);
 
-	// eNX`Zbg
+	// テクスチャセット
 	ID3D11ShaderResourceView* srv = Texture::LoadAndRegisterKey("assets\\texture\\apple.png");
-	// Tv[ Renderer::Init()  0Ԃ PSSetSamplers ς݂Ȃ null ł`
+	// サンプラーは Renderer::Init() で 0番に PSSetSamplers 済みなら null でも描ける
 	mat->SetMainTexture(srv, /*sampler*/nullptr, /*takeSrv*/false, /*takeSamp*/false);
 
-	// }eAZbg
+	// マテリアルセット
 	MaterialApp m{};
 	m.diffuse = Vector4(1, 1, 1, 1);
 	m.ambient = Vector4(1, 1, 1, 1);
 	m.textureEnable = true;
 	mat->SetMaterial(m);
 
-	// eNX`̉\̂ŃAt@uh
+	// 透明テクスチャの可能性が高いのでアルファブレンドに
 	mat->SetBlendMode(/*Alpha*/MaterialComponent::BlendMode::Opaque);
 
-	// 4) MeshRenderer ǉi`sWj
+	// 4) MeshRenderer を追加（描画実行係）
 	auto* mr = AddComponent<MeshRendererComponent>();
 
-	// 5) LightComponent ǉ
+	// 5) LightComponent を追加
 	auto* lc = AddComponent<LightComponent>();
 	lc->SetDiffuse({ 1.0f, 1.0f, 1.0f });
 	lc->SetIntensity(1);
@@ -73,7 +73,7 @@ void LightObject::Init()
 	rb->ComputeSphereInertia(1);
 	rb->SetBodyType(Rigidbody::BodyType::Dynamic);
 
-	// C[Zbg
+	// レイヤーセット
 	SetPhysicsLayer(2);
 }
 
@@ -1,7 +1,7 @@
 /*
 	main.cpp
 	2025  hanaue sho
-	WinMain ̃Gg|Cg
+	WinMain のエントリポイント
 */
 #include "Main.h"
 #include "DxDevice.h"
@@ -10,25 +10,29 @@
 
 #include "AudioSystem.h"
 #include "Manager.h"
+#include "Scene.h"
+#include "PhysicsSystem.h"
+#include "PhysicsBenchmark.h"
 #include "Mouse.h"
 #include "Keyboard.h"
 #include <thread>
 #include <chrono>
+#include <string.h>
 
 #include "DebugCount.h"
 
 const char* CLASS_NAME = "AppClass";
-const char* WINDOW_NAME = "DX11Q[";
+const char* WINDOW_NAME = "DX11ゲーム";
 
 // ==================================================
-// ----- O[oϐ -----
+// ----- グローバル変数 -----
 // ==================================================
 static HWND			 g_Window;
 static DxDevice		 g_Device;
 static SwapChainManager g_Swap;
 
 // ==================================================
-// ----- vg^Cv錾 -----
+// ----- プロトタイプ宣言 -----
 // ==================================================
 LRESULT CALLBACK WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam);
 HWND GetWindow()
@@ -43,7 +47,23 @@ HWND GetWindow()
 int APIENTRY WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nCmdShow)
 {
 	// ==================================================
-	// ----- Window̐ -----
+	// ----- 物理ベンチマーク -----
+	// 起動引数に -physbench があれば、ウィンドウや D3D を作らずに回して終わる
+	// 表は physbench.txt、ステップごとの計測は physbench_<シーン名>.csv
+	// 続けてスレッド数を変えて回した表、パイプライン実行の表、ウォームスタートの比較、レイキャストも physbench.txt に足す
+	// 答え合わせで食い違いがあれば終了コードを 1 にする
+	// ==================================================
+	if (lpCmdLine && strstr(lpCmdLine, "-physbench"))
+	{
+		FILE* out = fopen("physbench.txt", "w");
+		if (!out) return 1;
+		const int mismatches = PhysicsBenchmark::RunSuite(out, "physbench_");
+		fclose(out);
+		return mismatches > 0 ? 1 : 0;
+	}
+
+	// ==================================================
+	// ----- Windowの生成 -----
 	// ==================================================
 	WNDCLASSEX wcex;
 	{
@@ -71,14 +91,14 @@ int APIENTRY WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLi
 	}
 
 	// ==================================================
-	// ----- DirectX  -----
+	// ----- DirectX 初期化 -----
 	// ==================================================
-	g_Device.Create(); // Device, DeviceContext 쐬
-	g_Swap.Create(g_Window, SCREEN_WIDTH, SCREEN_HEIGHT, g_Device.Device(), g_Device.DeviceContext()); // RTV, DSV 쐬
+	g_Device.Create(); // Device, DeviceContext 作成
+	g_Swap.Create(g_Window, SCREEN_WIDTH, SCREEN_HEIGHT, g_Device.Device(), g_Device.DeviceContext()); // RTV, DSV 作成
 	Renderer::Init(g_Device.Device(), g_Device.DeviceContext());
 
 	// ==================================================
-	// ----- Av -----
+	// ----- アプリ初期化 -----
 	// ==================================================
 	CoInitializeEx(nullptr, COINITBASE_MULTITHREADED);
 
@@ -87,38 +107,41 @@ int APIENTRY WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLi
 	Keyboard_Initialize();
 	Manager::Init();
 
-	// fobOEBhE
-	AllocConsole(); // R\[쐬
-	FILE* a = freopen("CONOUT$", "w", stdout); // stdoutR\[Ƀ_CNg
-	printf("Hello, World!\n"); // R\[ɏo
+	// デバッグウィンドウ生成
+	AllocConsole(); // コンソールを作成
+	FILE* a = freopen("CONOUT$", "w", stdout); // stdoutをコンソールにリダイレクト
+	printf("Hello, World!\n"); // コンソールに出力
 
 
 	ShowWindow(g_Window, nCmdShow);
 	UpdateWindow(g_Window);
 
 	// ==================================================
-	// ----- [v ----- iAL[^j
+	// ----- ループ処理 ----- （アキュムレータ方式）
 	// ==================================================
 	using clock = std::chrono::steady_clock;
 	auto prev = clock::now();
 
 	double accumulator = 0.0f;
-	const double fixedDt = 1.0 / 60.0; // [g
+	const double fixedDt = 1.0 / 60.0; // 物理レート統一
 
-	// FPSp̐ώZ
+	// FPS用の積算
 	double fpsElapsed = 0.0;
 	int fpsFrames = 0;
-	int lastPhysSteps = 0; // ߃t[ŉ FixedStep 
+	int lastPhysSteps = 0; // 直近フレームで何回 FixedStep したか
+
+	// 起動引数に -physthread があれば、物理を専用スレッドで回して Update / Draw と重ねる（PhysicsSystem::SetPipelined）
+	const bool pipelinedPhysics = lpCmdLine && strstr(lpCmdLine, "-physthread");
 
 	bool running = true;
 	MSG msg;
 	while(running)
 	{
-		while (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE)) // bZ[W̏
+		while (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE)) // メッセージの処理
 		{
 			if (msg.message == WM_QUIT)
 			{
-				running = false; // [vI
+				running = false; // ループ終了
 				break;
 			}
 
@@ -128,30 +151,31 @@ int APIENTRY WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLi
 		if (!running) break;
 		
 
-		// ----- Ԍv -----
-		auto now = clock::now(); // ݂̃t[̎
-		double dt = std::chrono::duration<double>(now - prev).count(); // Õt[̎Ԃƍ̃t[̎Ԃ̍
-		prev = now; // ݂̃t[̎Ԃ̕ۑ
-		//dt = std::min(dt, 0.05); // t[ő 50ms
+		// ----- 時間計測 -----
+		auto now = clock::now(); // 現在のフレームの時間
+		double dt = std::chrono::duration<double>(now - prev).count(); // 前のフレームの時間と今のフレームの時間の差分
+		prev = now; // 現在のフレームの時間の保存
+		//dt = std::min(dt, 0.05); // フレーム最大 50ms
 
-		// -----  -----
-		//accumulator = std::min(accumulator + dt, 0.25); // ݐύő 250 ms
+		// ----- 物理 -----
+		//accumulator = std::min(accumulator + dt, 0.25); // 累積最大 250 ms
 		accumulator += dt; 
 		int steps = 0; 
-		const int maxSteps = 6; // XpC΍
+		const int maxSteps = 6; // スパイラル対策
+		if (Scene* scene = Manager::GetScene()) scene->physicsSystem().SetPipelined(pipelinedPhysics); // シーンが切り替わったら付け直す
 		while (accumulator >= fixedDt && steps < maxSteps)
 		{
-			// FixedUpdate i̒ PhysicsSytem Ă΂Ăj
+			// FixedUpdate （この中で PhysicsSytem が呼ばれているよ）
 			Manager::FixedUpdate(fixedDt);
 			
-			// JEg
+			// カウント
 			accumulator -= fixedDt;
 			steps++;
 		}
 		lastPhysSteps = steps;
 
 		// ==================================================
-		// ----- Q[XVA` -----
+		// ----- ゲーム更新、描画 -----
 		// ==================================================
 		g_Swap.BindAsRenderTarget();
 		const float clearColor[4] = { 0.1f, 0.3f, 0.5f, 1.0f };
@@ -166,34 +190,36 @@ int APIENTRY WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLi
 		keycopy();
 
 
-		// ----- FPSvƃ^CgXViPbƁj -----
-		fpsElapsed += dt; // [vԃJEg
-		fpsFrames += 1; // [vt[JEg
+		// ----- FPS計測とタイトル更新（１秒ごと） -----
+		fpsElapsed += dt; // 毎ループ時間カウント
+		fpsFrames += 1; // 毎ループフレームカウント
 		if (fpsElapsed >= 1.0f) 
 		{
-			double fps = fpsFrames / fpsElapsed; // PbFPS
-			double ms = 1000.0 / (fps > 0 ? fps : 1); // ڈ̂Ptv
+			double fps = fpsFrames / fpsElapsed; // １秒平均FPS
+			double ms = 1000.0 / (fps > 0 ? fps : 1); // 目安の１フレ所要時間
+			double physMs = 0.0; // 直近の物理１ステップの所要時間（内訳は PhysicsSystem::StatsHistory）
+			if (Scene* scene = Manager::GetScene()) physMs = scene->physicsSystem().LastStepStats().totalMs;
 		#ifdef UNICODE
 			wchar_t title[128];
-			swprintf_s(title, L"%hs | FPS: %.1f (%.2f ms) | PhysSteps: %d", WINDOW_NAME, fps, ms, lastPhysSteps);
-			SetWindowTextW(g_Window, title); // EBhẼo[ɕ\
+			swprintf_s(title, L"%hs | FPS: %.1f (%.2f ms) | PhysSteps: %d (%.2f ms)", WINDOW_NAME, fps, ms, lastPhysSteps, physMs);
+			SetWindowTextW(g_Window, title); // ウィンドウのバーに表示
 		#else
 			char title[128];
-			snprintf(title, sizeof(title), "%s | FPS: %.1f (%.2f ms) | PhysSteps: %d", WINDOW_NAME, fps, ms, lastPhysSteps);
-			SetWindowTextA(g_Window, title); // EBhẼo[ɕ\
+			snprintf(title, sizeof(title), "%s | FPS: %.1f (%.2f ms) | PhysSteps: %d (%.2f ms)", WINDOW_NAME, fps, ms, lastPhysSteps, physMs);
+			SetWindowTextA(g_Window, title); // ウィンドウのバーに表示
 		#endif		
-			// ώZZbg
+			// 積算をリセット
 			fpsElapsed -= 1.0f;
 			fpsFrames	= 0;
 		}
-	} // while I
+	} // while 終了
 
 	timeEndPeriod(1);
 
 	UnregisterClass(CLASS_NAME, wcex.hInstance);
 
 	// ==================================================
-	// ----- I -----
+	// ----- 終了処理 -----
 	// ==================================================
 	Renderer::Uninit();
 	g_Swap.Destroy();
@@ -207,10 +233,10 @@ int APIENTRY WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLi
 
 // --------------------------------------------------
 // WndProc
-// Windows̃bZ[Wz
-// EBhEɔSCxgiL[A}EXATCYAjȂǁjɓ͂
-// ŏbZ[WFreturn 0;
-// ŏȂbZ[WFDefWindowProc֓ni菈j
+// Windowsのメッセージ配送先
+// ウィンドウに発生する全イベント（キー、マウス、リサイズ、破棄など）がここに届く
+// 自分で処理したメッセージ：return 0;
+// 自分で処理しないメッセージ：DefWindowProcへ渡す（既定処理）
 // --------------------------------------------------
 LRESULT CALLBACK WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
 {
@@ -225,9 +251,9 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
 		}
 		return 0;
 
-	// L[{[hiʏL[j-----
-	case WM_KEYDOWN: // L[ꂽiI[gs[gj
-	case WM_KEYUP:	 // L[ꂽ
+	// キーボード（通常キー）-----
+	case WM_KEYDOWN: // 物理キーが押された（オートリピートあり）
+	case WM_KEYUP:	 // 物理キーが離された
 		Keyboard_ProcessMessage(uMsg, wParam, lParam);
 		switch (wParam)
 		{
@@ -237,46 +263,46 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
 		}
 		return 0;
 
-	// VXeL[iALT^F10݁j-----
+	// システムキー（ALT／F10押下絡み）-----
 	case WM_SYSKEYDOWN:
 	case WM_SYSKEYUP:
 		Keyboard_ProcessMessage(uMsg, wParam, lParam);
 		break;
 	
-	// AṽANeBu^ANeBu̐؂ւ -----
+	// アプリのアクティブ／非アクティブの切り替え -----
 	case WM_ACTIVATEAPP:
-		Keyboard_ProcessMessage(uMsg, wParam, lParam); // œ͏Ԃ̃NAȂǂsƈS
+		Keyboard_ProcessMessage(uMsg, wParam, lParam); // ここで入力状態のクリアなどを行うと安全
 		return 0;
 		
-	// RAW INPUT i̓́Fo^ĂΔłj
+	// RAW INPUT （生の入力：登録していれば飛んでくれる）
 	case WM_INPUT:
-		Mouse_ProcessMessage(uMsg, wParam, lParam);  // RAW }EXgȂ炱
+		Mouse_ProcessMessage(uMsg, wParam, lParam);  // RAW マウスを使うならこちら
 		return 0;
 
-	// }EXiRAW̒ʏ탁bZ[Wj-----
-	case WM_MOUSEMOVE:	 // }EXړ
-	case WM_LBUTTONDOWN: // NbN
-	case WM_LBUTTONUP:	 // NbN
-	case WM_RBUTTONDOWN: // ENbN
-	case WM_RBUTTONUP:	 // ENbN
-	case WM_MBUTTONDOWN: // {^
-	case WM_MBUTTONUP:	 // {^
-	case WM_MOUSEWHEEL:	 // }EXzC[
-	case WM_XBUTTONDOWN: // TCh{^
-	case WM_XBUTTONUP:	 // TCh{^
+	// マウス（非RAWの通常メッセージ）-----
+	case WM_MOUSEMOVE:	 // マウス移動
+	case WM_LBUTTONDOWN: // 左クリック押下
+	case WM_LBUTTONUP:	 // 左クリック離上
+	case WM_RBUTTONDOWN: // 右クリック押下
+	case WM_RBUTTONUP:	 // 右クリック離上
+	case WM_MBUTTONDOWN: // 中央ボタン押下
+	case WM_MBUTTONUP:	 // 中央ボタン離上
+	case WM_MOUSEWHEEL:	 // マウスホイール
+	case WM_XBUTTONDOWN: // サイドボタン押下
+	case WM_XBUTTONUP:	 // サイドボタン離上
 	case WM_MOUSEHOVER:
 		Mouse_ProcessMessage(uMsg, wParam, lParam);
 		return 0;
 
-	// EBhE̔j -----
+	// ウィンドウの破棄 -----
 	case WM_DESTROY:
-		PostQuitMessage(0); // C[v WM_QUIT 
+		PostQuitMessage(0); // メインループに WM_QUIT が入る
 		return 0;
 	default:
 		break;
 	}
 
-	// ɗ̂͊菈iTCYύXANCAg̈Aŏj
+	// ここに来たものは既定処理（サイズ変更、非クライアント領域、最小化等）
 	return DefWindowProc(hWnd, uMsg, wParam, lParam);
 }
 
@@ -16,7 +16,7 @@
 using namespace DirectX;
 
 
-#include "DirectXTex.h" // ̓eNX`ǂݍނ߂̃Cu
+#include "DirectXTex.h" // こいつはテクスチャを読み込むためのライブラリ
 
 #if _DEBUG
 #pragma comment(lib, "DirectXTex_Debug.lib")
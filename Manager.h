@@ -16,6 +16,8 @@ public:
 	static void Draw();
 
 	static Scene* GetScene() { return m_pScene; }
+	// すぐに差し替える（ベンチマークなどウィンドウ無しで回す用、Init / Uninit は呼び出し側で行う）
+	static Scene* SwapScene(Scene* scene) { Scene* prev = m_pScene; m_pScene = scene; return prev; }
 
 	template <typename T>
 	static void SetScene()
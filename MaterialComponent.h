@@ -1,7 +1,7 @@
 /*
 	MaterialComponent.h
 	20250813  hanaue sho
-	hǂ`hƂiVF[_[A}eAAeNX`ATv[j
+	”どう描くか”という情報を持つ（シェーダー、マテリアル、テクスチャ、サンプラー）
 */
 #ifndef MATERIALCOMPONENT_H_
 #define MATERIALCOMPONENT_H_
@@ -15,10 +15,10 @@ public:
 	enum class BlendMode {Opaque, Alpha, Additive};
 protected:
 	// ==================================================
-	// ----- \vf -----
+	// ----- 構成要素 -----
 	// ==================================================
 	// --------------------------------------------------
-	// VF[_[CAEgiftHgFL遁j
+	// シェーダーレイアウト（デフォルト：所有する＝解放する）
 	// --------------------------------------------------
 	ID3D11VertexShader* m_VS = nullptr;
 	ID3D11PixelShader*  m_PS = nullptr;
@@ -27,10 +27,10 @@ protected:
 	bool m_OwnsPS = true;
 	bool m_OwnsIL = true;
 
-	MaterialApp	m_Material{}; // Renderer.h MATERIAL
+	MaterialApp	m_Material{}; // Renderer.h のMATERIAL
 
 	// --------------------------------------------------
-	// eNX`iʏ̓AZbgL񏊗Lj
+	// テクスチャ（通常はアセット共有＝非所有）
 	// --------------------------------------------------
 	ID3D11ShaderResourceView* m_MainTexture = nullptr;
 	ID3D11SamplerState*		  m_Sampler		= nullptr; 
@@ -38,17 +38,17 @@ protected:
 	bool m_OwnsSamp = false;
 
 	// --------------------------------------------------
-	// uhݒ
+	// ブレンド設定
 	// --------------------------------------------------
 	BlendMode m_Blend = BlendMode::Opaque;
 
 public:
 	// ==================================================
-	// ----- Zbg -----
+	// ----- セット -----
 	// ==================================================
 	void SetVSPS(ID3D11VertexShader* vs, ID3D11PixelShader* ps, ID3D11InputLayout* il, bool takeVS = true, bool takePS = true, bool takeIL = true ) noexcept
 	{	
-		// L̒u̓[Nh~
+		// 既存所有物の置き換え時はリーク防止
 		if (m_OwnsVS && m_VS && m_VS != vs) m_VS->Release();
 		if (m_OwnsPS && m_PS && m_PS != ps) m_PS->Release();
 		if (m_OwnsIL && m_IL && m_IL != il) m_IL->Release();
@@ -69,12 +69,12 @@ public:
 	}
 
 	// ==================================================
-	// ----- Ó -----
+	// ----- 妥当性 -----
 	// ==================================================
 	bool IsReady() const noexcept {	return (m_VS && m_PS && m_IL); }
 
 	// ==================================================
-	// ----- oCh -----
+	// ----- バインド -----
 	// ==================================================
 	void Bind() const
 	{
@@ -90,13 +90,13 @@ public:
 		// SRV
 		if (m_MainTexture) ctx->PSSetShaderResources(0, 1, &m_MainTexture);
 
-		// Tv[ݒiݒȂKlj
+		// サンプラー設定（未設定なら規定値）
 		ID3D11SamplerState* sampl = m_Sampler ? m_Sampler : Renderer::DefaultLinearWrapSampler();
 		if (sampl)		   ctx->PSSetSamplers(0, 1, &sampl);
 	}
 
 	// --------------------------------------------------
-	// eNX`𖾎IɊO
+	// テクスチャを明示的に外す
 	// --------------------------------------------------
 	void UnbindTextures() const noexcept
 	{
@@ -107,13 +107,13 @@ public:
 	}
 
 	// ==================================================
-	// ----- uhݒ -----
+	// ----- ブレンド設定 -----
 	// ==================================================
 	void SetBlendMode(BlendMode m) noexcept { m_Blend = m; }
 	bool IsTransparent() const noexcept { return m_Blend != BlendMode::Opaque; }
 
 	// ==================================================
-	// ----- j -----
+	// ----- 破棄 -----
 	// ==================================================
 	void Uninit() override
 	{
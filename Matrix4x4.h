@@ -1,7 +1,7 @@
 /*
 	Matrix4x4.h
 	20250806  hanaue sho
-	sxNgViSsڂɕsړjiEWnj
+	行ベクトル流儀（４行目に平行移動成分）（右手座標系）
 */
 #ifndef MATRIX4X4_H_
 #define MATRIX4X4_H_
@@ -13,24 +13,24 @@ class Matrix4x4
 {
 public:
 	// ==================================================
-	// ----- vf{ -----
-	// 	   {m00, m01, m02, m03}  Right  (m00, m01, m02)
-	// m = {m10, m11, m11, m13}  Top    (m10, m11, m12)
-	//     {m20, m21, m22, m23}  Forward(m20, m21, m22)
-	//     {m30, m31, m32, m33}  Translate(m30, m31, m32)
+	// ----- 要素本体 -----
+	// 	   {m00, m01, m02, m03} ← Right  (m00, m01, m02)
+	// m = {m10, m11, m11, m13} ← Top    (m10, m11, m12)
+	//     {m20, m21, m22, m23} ← Forward(m20, m21, m22)
+	//     {m30, m31, m32, m33} ← Translate(m30, m31, m32)
     // ==================================================
-	float m[4][4]; // s{
+	float m[4][4]; // 行列本体
 
 	// ==================================================
-	// ----- RXgN^ -----
+	// ----- コンストラクタ -----
     // ==================================================
-	Matrix4x4() { identity(); } // K
+	Matrix4x4() { identity(); } // 正規化
 
 	// ==================================================
-	// ----- Iy[^ -----
+	// ----- オペレータ -----
     // ==================================================
     // --------------------------------------------------
-	// s񓯎m̊|Z
+	// 行列同士の掛け算
 	// 	   {m00, m01, m02, m03}	     {M00, M01, M02, M03}
 	// m = {m10, m11, m11, m13}, M = {M10, M11, M11, M13}
 	//     {m20, m21, m22, m23}		 {M20, M21, M22, M23}
@@ -56,7 +56,7 @@ public:
 		return result;
 	}
 	// --------------------------------------------------
-	// s float ̊|Zievf float |j
+	// 行列と float の掛け算（各要素に float を掛ける）
 	// 	       {m00*s, m01*s, m02*s, m03*s}
 	// m * s = {m10*s, m11*s, m11*s, m13*s}
 	//		   {m20*s, m21*s, m22*s, m23*s}
@@ -69,17 +69,17 @@ public:
 		{
 			for (int col = 0; col < 4; col++)
 			{
-				result.m[row][col] = m[row][col] * f; // e float |
+				result.m[row][col] = m[row][col] * f; // 各成分に float を掛ける
 			}
 		}
 		return result;
 	}
 
 	// ==================================================
-	// ----- [eBeB -----
+	// ----- ユーティリティ -----
     // ==================================================
 	// --------------------------------------------------
-	// Pʍsɏ
+	// 単位行列に初期化
 	//	   {1, 0, 0, 0}
 	// m = {0, 1, 0, 0}
 	//     {0, 0, 1, 0}
@@ -87,11 +87,11 @@ public:
     // --------------------------------------------------
 	void identity()
 	{
-		memset(m, 0, sizeof(m)); // 
+		memset(m, 0, sizeof(m)); // 初期化
 		m[0][0] = m[1][1] = m[2][2] = m[3][3] = 1.0f;
 	}
 	// --------------------------------------------------
-	// 3x3݂̂[
+	// 左上3x3のみをゼロに
 	//	   {0, 0, 0, 0}
 	// m = {0, 0, 0, 0}
 	//     {0, 0, 0, 0}
@@ -99,11 +99,11 @@ public:
     // --------------------------------------------------
 	void Zero3x3()
 	{
-		memset(m, 0, sizeof(m)); // 
-		m[3][3] = 1.0f; // [3][3]݂̂PCȊO͂O
+		memset(m, 0, sizeof(m)); // 初期化
+		m[3][3] = 1.0f; // [3][3]のみ１，それ以外は０に
 	}
 	// --------------------------------------------------
-	// ]u
+	// 転置処理
 	// 			{m00, m10, m20, m30}
 	// transM = {m01, m11, m21, m31}
 	//			{m02, m12, m22, m32}
@@ -118,27 +118,27 @@ public:
 		return t;
 	}
 	// --------------------------------------------------
-	// ts
-	// m * invM = 1 𖞂 invM
-	// ȈՎȂ̂Œ
+	// 逆行列
+	// m * invM = 1 を満たす invM
+	// ※簡易実装なので注意
 	// --------------------------------------------------
 	Matrix4x4 Inverse() const
 	{
 		Matrix4x4 inv;
 		inv.identity();
 
-		// 3x3 ̋tsvZi]{XP[j
+		// 3x3 の逆行列を計算（回転＋スケール部分）
 		float det =
 			m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
 			m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
 			m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
 
 		if (fabs(det) < 1e-8f) {
-			// ts񂪑݂Ȃ
-			return inv; // PʍsԂȂǓKXG[
+			// 逆行列が存在しない
+			return inv; // 単位行列を返すなど適宜エラー処理
 		}
 
-		// Ŋ
+		// 長さで割る
 		float invDet = 1.0f / det;
 
 		inv.m[0][0] =  (m[1][1] * m[2][2] - m[1][2] * m[2][1]) * invDet;
@@ -153,7 +153,7 @@ public:
 		inv.m[2][1] = -(m[0][0] * m[2][1] - m[0][1] * m[2][0]) * invDet;
 		inv.m[2][2] =  (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * invDet;
 
-		// sړ̋tvZ
+		// 平行移動の逆を計算
 		inv.m[3][0] = -(m[3][0] * inv.m[0][0] + m[3][1] * inv.m[1][0] + m[3][2] * inv.m[2][0]);
 		inv.m[3][1] = -(m[3][0] * inv.m[0][1] + m[3][1] * inv.m[1][1] + m[3][2] * inv.m[2][1]);
 		inv.m[3][2] = -(m[3][0] * inv.m[0][2] + m[3][1] * inv.m[1][2] + m[3][2] * inv.m[2][2]);
@@ -162,10 +162,10 @@ public:
 	}
 	
 	// ==================================================
-	// -----  -----
+	// ----- 生成 -----
 	// ==================================================
 	// --------------------------------------------------
-	// sړs
+	// 平行移動行列
 	//	   {1, 0, 0, 0}
 	// m = {0, 1, 0, 0}
 	//     {0, 0, 1, 0}
@@ -181,7 +181,7 @@ public:
 		return mat;
 	}
 	// --------------------------------------------------
-	// XP[s
+	// スケール行列
 	//	   {1*s, 0  , 0  , 0}
 	// m = {0  , 1*s, 0  , 0}
 	//     {0  , 0  , 1*s, 0}
@@ -197,16 +197,16 @@ public:
 		return mat;
 	}
 	// --------------------------------------------------
-	// IC[p]s iYawPitchRolljiSăWAjiEWnj
+	// オイラー角から回転行列 （Yaw→Pitch→Roll）（全てラジアン）（右手座標系）
 	//	   {cy * cr + sy * sp * sr, cy * sr - sy * sp * cr, sy * cp}
 	// m = {-cp * sr			  , cp * cr				  , sp	   }
 	//     {sy * cr + cy * sp * sr,sy * sr - cy * sp * cr , cy * cp}
 	// --------------------------------------------------
 	static Matrix4x4 CreateRotationYawPitchRoll(float yaw, float pitch, float roll)
 	{
-		float cy = cos(yaw)  , sy = sin(yaw);   // Yaw   : 
-		float cp = cos(pitch), sp = sin(pitch); // Pitch : 
-		float cr = cos(roll) , sr = sin(roll);  // Roll	 : 
+		float cy = cos(yaw)  , sy = sin(yaw);   // Yaw   : ｙ軸
+		float cp = cos(pitch), sp = sin(pitch); // Pitch : ｘ軸
+		float cr = cos(roll) , sr = sin(roll);  // Roll	 : ｚ軸
 
 		Matrix4x4 mat;
 		mat.identity();
@@ -232,7 +232,7 @@ public:
 		return mat;
 	}
 	// --------------------------------------------------
-	// ]siApx]sj
+	// 回転行列（軸、角度から回転行列を作る）
 	// a = angle
 	// c = cos(angle), s = sin(angle), t = 1-c
 	//	   { t * a.x * a.x + c	    , t * a.x * a.y + s * a.z, t * a.x * a.z - s * a.y}
@@ -264,28 +264,28 @@ public:
 		return mat;
 	}
 	// --------------------------------------------------
-	// Transform Matrix 𐶐
-	// 3*3ɉ]si[
-	// 3*3ɃXP[Kp
-	// Ssڂɕsړi[
+	// Transform からMatrix を生成
+	// 左上3*3に回転行列を格納
+	// 左上3*3にスケールを適用
+	// ４行目に平行移動成分を格納
 	// --------------------------------------------------
 	static Matrix4x4 CreateTRS(const Vector3& pos, const Matrix4x4& rot3x3, const Vector3& s)
 	{
 		Matrix4x4 M = rot3x3;
-		// sXP[ (S * R)
+		// 行スケール (S * R)
 		M.m[0][0] *= s.x; M.m[0][1] *= s.x; M.m[0][2] *= s.x;
 		M.m[1][0] *= s.y; M.m[1][1] *= s.y; M.m[1][2] *= s.y;
 		M.m[2][0] *= s.z; M.m[2][1] *= s.z; M.m[2][2] *= s.z;
-		// sړ (S * R * T)
+		// 平行移動 (S * R * T)
 		M.m[3][0] = pos.x; M.m[3][1] = pos.y; M.m[3][2] = pos.z;
 		M.m[0][3] = M.m[1][3] = M.m[2][3] = 0.0f; M.m[3][3] = 1.0f;
 		return M;
 	}
 	// --------------------------------------------------
-	// Right, Up, Forward 琶isxNgVj
-	// 	   {right.x	 , right.y  , right.z  , 0}  Right  (m00, m01, m02)
-	// m = {top.x	 , top.y	, top.z	   , 0}  Top    (m10, m11, m12)
-	//     {forward.x, forward.y, forward.z, 0}  Forward(m20, m21, m22)
+	// Right, Up, Forward から生成（行ベクトル流儀）
+	// 	   {right.x	 , right.y  , right.z  , 0} ← Right  (m00, m01, m02)
+	// m = {top.x	 , top.y	, top.z	   , 0} ← Top    (m10, m11, m12)
+	//     {forward.x, forward.y, forward.z, 0} ← Forward(m20, m21, m22)
 	//     {0		 , 0		, 0		   , 1} 
 	// --------------------------------------------------
 	static Matrix4x4 CreateAxes(const Vector3& right, const Vector3& up, const Vector3& forward, const Vector3& trans = { 0, 0, 0 })
@@ -300,16 +300,16 @@ public:
 	}
 
 	// ==================================================
-	// ----- ϊEo -----
+	// ----- 変換・抽出 -----
 	// ==================================================
 	// --------------------------------------------------
-	// s񂩂IC[p֕ϊiEWnj
-	// Pitch : R[1][2] ӂɌ܂ asin(R[1][2])
+	// 行列からオイラー角へ変換（右手座標系）
+	// Pitch : R[1][2] から一意に決まる asin(R[1][2])
 	// if (!Pitch = 90)
-	//	Yaw   : R[0][2]  R[2][2]   atan2( R[0][2], R[2][2])
-	//	Roll  : R[1][0]  R[1][1]   atan2(-R[1][0], R[1][1])
+	//	Yaw   : R[0][2] と R[2][2] から  atan2( R[0][2], R[2][2])
+	//	Roll  : R[1][0] と R[1][1] から  atan2(-R[1][0], R[1][1])
 	// if (Pitch = 90)
-	//	Yaw   : R[2][0]  R[0][0]   atan2( R[2][0], R[0][0])
+	//	Yaw   : R[2][0] と R[0][0] から  atan2( R[2][0], R[0][0])
 	//	Roll  : 0 
 	// --------------------------------------------------
 	Vector3 ToEulerAngles() const
@@ -329,13 +329,13 @@ public:
 		float yaw = 0;
 		float roll = 0;
 
-		// pitch(X])
+		// pitch(X軸回転)
 		if (fabs(cosf(pitch)) > 1e-6f) // 
 		{
 			yaw  = atan2f( r02, r22); // yaw
 			roll = atan2f(-r10, r11); // roll
 		}
-		else // WobNߖTipitch  90j
+		else // ジンバルロック近傍（pitch ≒ 90）
 		{
 			yaw = atan2f(r20, r00);
 			roll = 0.0f;
@@ -343,26 +343,26 @@ public:
 		return {pitch, yaw, roll}; // {X, Y, Z}
 	}
 	// --------------------------------------------------
-	// s񂩂]݂̂o
-	// x]񕔕iR~RjoAXP[Ŋ萳K
-	// ߂ĐVsɊi[ĕԂ
+	// 行列から回転情報のみを取り出す
+	// 一度回転情報部分（左上３×３）を取り出し、スケールで割り正規化
+	// それを改めて新しい行列に格納し直して返す
 	// --------------------------------------------------
 	Matrix4x4 RotationNormalized() const
 	{
-		// eso
+		// 各行成分を取り出す
 		Vector3 r0(m[0][0], m[0][1], m[0][2]); 
 		Vector3 r1(m[1][0], m[1][1], m[1][2]); 
 		Vector3 r2(m[2][0], m[2][1], m[2][2]); 
 
-		// es̃XP[o
+		// 各行のスケールを取り出す
 		float sx = r0.length(); if (sx < 1e-8f) { r0 = Vector3(1, 0, 0); sx = 1; } else {r0 *= (1.0f / sx); }
 		float sy = r1.length(); if (sy < 1e-8f) { r1 = Vector3(0, 1, 0); sy = 1; } else {r1 *= (1.0f / sy); }
 		float sz = r2.length(); if (sz < 1e-8f) { r2 = Vector3(0, 0, 1); sz = 1; } else {r2 *= (1.0f / sz); }
 
-		// ]o
+		// 反転検出
 		if (Vector3::Dot(Vector3::Cross(r0, r1), r2) < 0.0f) r2 *= -1.0f;
 
-		// Kꂽ]Ԃ
+		// 正規化された回転情報を返す
 		Matrix4x4 R; R.identity();
 		R.m[0][0] = r0.x; R.m[0][1] = r0.y; R.m[0][2] = r0.z;
 		R.m[1][0] = r1.x; R.m[1][1] = r1.y; R.m[1][2] = r1.z;
@@ -371,16 +371,16 @@ public:
 	}
 
 	// ==================================================
-	// ----- ]Kp -----
+	// ----- 回転適用 -----
 	// ==================================================
 	// --------------------------------------------------
-	// xNgɑ΂ĉ]sKp
-	// vect : xNg, Mat : ]s
-	// v' = vect * Mat isxNgVFEsj
+	// ベクトルに対して回転行列を適用
+	// vect : ベクトル, Mat : 回転行列
+	// v' = vect * Mat （行ベクトル流儀：右から行列をかける）
 	// --------------------------------------------------
 	Vector3 TransformNormal(const Vector3& vect) const
 	{
-		// [s][]
+		// [行][列]
 		return Vector3(
 			vect.x * m[0][0] + vect.y * m[1][0] + vect.z * m[2][0],
 			vect.x * m[0][1] + vect.y * m[1][1] + vect.z * m[2][1],
@@ -388,7 +388,7 @@ public:
 		);
 	}
 	// --------------------------------------------------
-	// xNgɑ΂ĉ]{sړKpi[hWϊj
+	// ベクトルに対して回転＋平行移動を適用（ワールド座標変換）
 	// v = {x, y, z, 1}
 	// --------------------------------------------------
 	Vector3 TransformPoint(const Vector3& vect) const
@@ -401,7 +401,7 @@ public:
 	}
 
 	// ==================================================
-	// ----- fobOvg -----
+	// ----- デバッグプリント -----
 	// ==================================================
 	static void Printf(const Matrix4x4& mat, const std::string& name = "noname")
 	{
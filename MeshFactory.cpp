@@ -1,8 +1,8 @@
 /*
 	MeshFactory.cpp
 	20250818  hanaue sho
-	상bV
-	炻̂܂ MeshFilter ɃZbgiL MeshFilter j
+	自作メッシュを作る
+	作ったらそのまま MeshFilter にセットする（所有権は MeshFilter ）
 */
 #define NOMINMAX
 #include <algorithm>
@@ -18,7 +18,7 @@
 
 template<class T> inline T Lerp(T a, T b, T t) { return a + (b - a) * t; }
 // --------------------------------------------------
-// 
+// 平面
 // --------------------------------------------------
 void MeshFactory::CreateQuad(MeshFilterComponent* filter, const QuadParams& p)
 {
@@ -31,13 +31,13 @@ void MeshFactory::CreateQuad(MeshFilterComponent* filter, const QuadParams& p)
 	float x0 = p.originCenter ? -hw : 0.0f;
 	float y0 = p.originCenter ? -hh : 0.0f;
 
-	// ----- _f[^쐬ij -----
+	// ----- 頂点データ作成（左上基準） -----
 	v[0].position = { x0		  , y0			 , 0.0f }; v[0].normal = { 0, 0, 1 }; v[0].diffuse = { 1, 1, 1, 1 }; v[0].texcoord = { 0, 0 };
 	v[1].position = { x0 + p.width, y0			 , 0.0f }; v[1].normal = { 0, 0, 1 }; v[1].diffuse = { 1, 1, 1, 1 }; v[1].texcoord = { 1, 0 };
 	v[2].position = { x0		  , y0 + p.height, 0.0f }; v[2].normal = { 0, 0, 1 }; v[2].diffuse = { 1, 1, 1, 1 }; v[2].texcoord = { 0, 1 };
 	v[3].position = { x0 + p.width, y0 + p.height, 0.0f }; v[3].normal = { 0, 0, 1 }; v[3].diffuse = { 1, 1, 1, 1 }; v[3].texcoord = { 1, 1 };
 
-	// ----- VB 쐬 -----
+	// ----- VB 作成 -----
 	D3D11_BUFFER_DESC bd{};
 	bd.Usage = D3D11_USAGE_DEFAULT;
 	bd.ByteWidth = sizeof(VERTEX_3D) * 4;
@@ -48,7 +48,7 @@ void MeshFactory::CreateQuad(MeshFilterComponent* filter, const QuadParams& p)
 	HRESULT hr = Renderer::Device()->CreateBuffer(&bd, &sd, &vb);
 	if (FAILED(hr)) { assert(false && "CreateBuffer VB failed"); return; }
 
-	// ----- IB 쐬 -----
+	// ----- IB 作成 -----
 	uint32_t idx[6] = { 0, 1, 2, 2, 1, 3 };
 	D3D11_BUFFER_DESC ibd{};
 	ibd.Usage = D3D11_USAGE_DEFAULT;
@@ -61,7 +61,7 @@ void MeshFactory::CreateQuad(MeshFilterComponent* filter, const QuadParams& p)
 	if (FAILED(hr)) { vb->Release(); assert(false && "CreateBuffer IB failed"); return; }
 
 
-	// ----- MeshFilter ɏn -----
+	// ----- MeshFilter に情報を渡す -----
 	filter->SetVertexBuffer(vb, sizeof(VERTEX_3D), 4, 0, true);
 	filter->SetIndexBuffer(ib, 6, DXGI_FORMAT_R32_UINT, true);
 	filter->SetTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
@@ -77,13 +77,13 @@ void MeshFactory::CreatePlane(MeshFilterComponent* filter, const PlaneParams& p)
 	float x0 = p.originCenter ? -hw : 0.0f;
 	float z0 = p.originCenter ? -hd : 0.0f;
 
-	// ----- _f[^쐬ij -----
+	// ----- 頂点データ作成（左上基準） -----
 	v[0].position = { x0		  , 0.0f, z0 + p.depth }; v[2].normal = { 0, 1, 0 }; v[2].diffuse = { 1, 1, 1, 1 }; v[2].texcoord = { 0, 1 };
 	v[1].position = { x0 + p.width, 0.0f, z0 + p.depth }; v[3].normal = { 0, 1, 0 }; v[3].diffuse = { 1, 1, 1, 1 }; v[3].texcoord = { 1, 1 };
 	v[2].position = { x0		  , 0.0f, z0		   }; v[0].normal = { 0, 1, 0 }; v[0].diffuse = { 1, 1, 1, 1 }; v[0].texcoord = { 0, 0 };
 	v[3].position = { x0 + p.width, 0.0f, z0		   }; v[1].normal = { 0, 1, 0 }; v[1].diffuse = { 1, 1, 1, 1 }; v[1].texcoord = { 1, 0 };
 
-	// ----- VB 쐬 -----
+	// ----- VB 作成 -----
 	D3D11_BUFFER_DESC bd{};
 	bd.Usage = D3D11_USAGE_DEFAULT;
 	bd.ByteWidth = sizeof(VERTEX_3D) * 4;
@@ -94,7 +94,7 @@ void MeshFactory::CreatePlane(MeshFilterComponent* filter, const PlaneParams& p)
 	HRESULT hr = Renderer::Device()->CreateBuffer(&bd, &sd, &vb);
 	if (FAILED(hr)) { assert(false && "CreateBuffer VB failed"); return; }
 
-	// ----- IB 쐬 -----
+	// ----- IB 作成 -----
 	uint32_t idx[6] = { 0, 1, 2, 2, 1, 3 };
 	D3D11_BUFFER_DESC ibd{};
 	ibd.Usage = D3D11_USAGE_DEFAULT;
@@ -107,40 +107,40 @@ void MeshFactory::CreatePlane(MeshFilterComponent* filter, const PlaneParams& p)
 	if (FAILED(hr)) { vb->Release(); assert(false && "CreateBuffer IB failed"); return; }
 
 
-	// ----- MeshFilter ɏn -----
+	// ----- MeshFilter に情報を渡す -----
 	filter->SetVertexBuffer(vb, sizeof(VERTEX_3D), 4, 0, true);
 	filter->SetIndexBuffer(ib, 6, DXGI_FORMAT_R32_UINT, true);
 	filter->SetTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 }
 
 // --------------------------------------------------
-// 
+// 球体
 // --------------------------------------------------
 void MeshFactory::CreateSphere(MeshFilterComponent* filter, const SphereParams& p)
 {
 	assert(filter);
 
-	// K[h
+	// ガード
 	const uint32_t slices = std::max<uint32_t>(3, p.slices);
 	const uint32_t stacks = std::max<uint32_t>(3, p.stacks);
 	const float R = std::max<float>(0.0f, p.radius);
-	if (R == 0) return; // aO̓^[
+	if (R == 0) return; // 半径０はリターン
 
-	// _ = (stacks + 1) * (slices + 1)  -----
-	// ox[vŏdˁAܓx͒[LȂ
+	// 頂点数 = (stacks + 1) * (slices + 1)  -----
+	// 経度をループで重ね、緯度は端も共有しない方式
 	const uint32_t vCount = (stacks + 1) * (slices + 1);
-	const uint32_t iCount = stacks * slices * 6; // eObhłQOp`
+	const uint32_t iCount = stacks * slices * 6; // 各グリッドで２三角形
 
 	std::vector<VERTEX_3D> vertexes;
 	std::vector<uint32_t> idx;
 	vertexes.resize(vCount);
 	idx.reserve(iCount);
 
-	// ܓxFODDstacks, oxFODDslices
+	// 緯度：０．．stacks, 経度：０．．slices
 	for (uint32_t iy = 0; iy <= stacks; iy++)
 	{
 		float v = (float)iy / (float)stacks; // [0, 1]
-		float theta = (1.0f - v) * PI;		 // [0, ]ij
+		float theta = (1.0f - v) * PI;		 // [0, π]（下→上）
 
 		float sinT = sinf(theta);
 		float cosT = cosf(theta);
@@ -148,30 +148,30 @@ void MeshFactory::CreateSphere(MeshFilterComponent* filter, const SphereParams&
 		for (uint32_t ix = 0; ix <= slices; ix++)
 		{
 			float u = (float)ix / (float)slices; // [0, 1]
-			float phi = u * 2.0f * PI;			 // [0, Q]
+			float phi = u * 2.0f * PI;			 // [0, ２π]
 
 			float sinP = sinf(phi);
 			float cosP = cosf(phi);
 
-			// Pʋ̈ʒu
-			Vector3 normal = { sinT * cosP, cosT, sinT * sinP }; // Y ̋
+			// 単位球の位置
+			Vector3 normal = { sinT * cosP, cosT, sinT * sinP }; // Y が上の球
 			Vector3 pos = normal * R;
 
-			if (p.insideOut) normal = -normal; // 
+			if (p.insideOut) normal = -normal; // 内向き
 
-			// VERTEX_3D 
+			// VERTEX_3D へ
 			VERTEX_3D vert{};
 			vert.position = pos;
 			vert.normal = normal;
 			vert.diffuse = Vector4(1, 1, 1, 1);
-			vert.texcoord = Vector2(u, theta / PI); // vtȂ̂
+			vert.texcoord = Vector2(u, theta / PI); // vが逆なので
 
 			vertexes[iy * (slices + 1) + ix] = vert;
 		}
 	}
 
-	// CfbNX -----
-	// ʏF(i0, i2, i1), (i2, i3, i1)
+	// インデックス -----
+	// 通常：(i0, i2, i1), (i2, i3, i1)
 	auto emitTri = [&](uint32_t a, uint32_t b, uint32_t c)
 		{
 			if (!p.insideOut) { idx.push_back(a); idx.push_back(b); idx.push_back(c); }
@@ -196,7 +196,7 @@ void MeshFactory::CreateSphere(MeshFilterComponent* filter, const SphereParams&
 		}
 	}
 
-	// ----- VB 쐬 -----
+	// ----- VB 作成 -----
 	D3D11_BUFFER_DESC vbd{};
 	vbd.Usage = D3D11_USAGE_DEFAULT;
 	vbd.ByteWidth = (UINT)(sizeof(VERTEX_3D) * vertexes.size());
@@ -207,7 +207,7 @@ void MeshFactory::CreateSphere(MeshFilterComponent* filter, const SphereParams&
 	HRESULT hr = Renderer::Device()->CreateBuffer(&vbd, &vsd, &vb);
 	if (FAILED(hr)) { assert(false && "CreateBuffer VB failed"); return; }
 
-	// ----- IB 쐬 -----
+	// ----- IB 作成 -----
 	D3D11_BUFFER_DESC ibd{};
 	ibd.Usage = D3D11_USAGE_DEFAULT;
 	ibd.ByteWidth = (UINT)(sizeof(uint32_t) * idx.size());
@@ -218,14 +218,14 @@ void MeshFactory::CreateSphere(MeshFilterComponent* filter, const SphereParams&
 	hr = Renderer::Device()->CreateBuffer(&ibd, &isd, &ib);
 	if (FAILED(hr)) { assert(false && "CreateBuffer IB failed"); return; }
 
-	// ----- MeshFilter  -----
+	// ----- MeshFilter へ -----
 	filter->SetVertexBuffer(vb, sizeof(VERTEX_3D), (UINT)vertexes.size(), 0, true);
 	filter->SetIndexBuffer (ib, (UINT)idx.size(), DXGI_FORMAT_R32_UINT, true);
 	filter->SetTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 }
 
 // --------------------------------------------------
-// 
+// 立方体
 // --------------------------------------------------
 void MeshFactory::CreateCube(MeshFilterComponent* filter, const CubeParams& p)
 {
@@ -235,7 +235,7 @@ void MeshFactory::CreateCube(MeshFilterComponent* filter, const CubeParams& p)
 	const float h = std::max(0.0f, p.size.y);
 	const float d = std::max(0.0f, p.size.z);
 
-	// _ItZbg
+	// 原点オフセット
 	const float x0 = p.originCenter ? -w * 0.5f : 0.0f;
 	const float y0 = p.originCenter ? -h * 0.5f : 0.0f;
 	const float z0 = p.originCenter ? -d * 0.5f : 0.0f;
@@ -244,7 +244,7 @@ void MeshFactory::CreateCube(MeshFilterComponent* filter, const CubeParams& p)
 	const float y1 = y0 + h;
 	const float z1 = z0 + d;
 
-	// ʂƂS_
+	// 面ごと４頂点
 	VERTEX_3D v[24]{};
 
 	auto setV = [&](int i, float px, float py, float pz, const Vector3& n, float u, float vv)
@@ -292,8 +292,8 @@ void MeshFactory::CreateCube(MeshFilterComponent* filter, const CubeParams& p)
 	setV(22, x0, y0, z0, { 0, 0, -1 }, 0, 1);
 	setV(23, x1, y0, z0, { 0, 0, -1 }, 1, 1);
 
-	// CfbNX
-	uint32_t idx[36]{}; // ieʂQOp`AvRUj
+	// インデックス
+	uint32_t idx[36]{}; // （各面２三角形、合計３６）
 	auto putFace = [&](int baseV, int baseI)
 		{
 			if (!p.insideOut) // (0,1,2), (2,1,3) 
@@ -301,7 +301,7 @@ void MeshFactory::CreateCube(MeshFilterComponent* filter, const CubeParams& p)
 				idx[baseI + 0] = baseV + 0; idx[baseI + 1] = baseV + 1; idx[baseI + 2] = baseV + 2;
 				idx[baseI + 3] = baseV + 2; idx[baseI + 4] = baseV + 1; idx[baseI + 5] = baseV + 3;
 			}
-			else // ]
+			else // 反転
 			{
 				idx[baseI + 0] = baseV + 0; idx[baseI + 1] = baseV + 2; idx[baseI + 2] = baseV + 1;
 				idx[baseI + 3] = baseV + 2; idx[baseI + 4] = baseV + 3; idx[baseI + 5] = baseV + 1;
@@ -315,7 +315,7 @@ void MeshFactory::CreateCube(MeshFilterComponent* filter, const CubeParams& p)
 	putFace(16, 24); // +Z
 	putFace(20, 30); // -Z
 
-	// ----- VB 쐬 -----
+	// ----- VB 作成 -----
 	D3D11_BUFFER_DESC vbd{};
 	vbd.Usage = D3D11_USAGE_DEFAULT;
 	vbd.ByteWidth = sizeof(VERTEX_3D) * 24;
@@ -328,7 +328,7 @@ void MeshFactory::CreateCube(MeshFilterComponent* filter, const CubeParams& p)
 	HRESULT hr = Renderer::Device()->CreateBuffer(&vbd, &vsd, &vb);
 	if (FAILED(hr)) { assert(false && "CreateBuffer VB failed"); return; }
 
-	// ----- IB 쐬 -----
+	// ----- IB 作成 -----
 	D3D11_BUFFER_DESC ibd{};
 	ibd.Usage = D3D11_USAGE_DEFAULT;
 	ibd.ByteWidth = sizeof(uint32_t) * 36;
@@ -341,14 +341,14 @@ void MeshFactory::CreateCube(MeshFilterComponent* filter, const CubeParams& p)
 	hr = Renderer::Device()->CreateBuffer(&ibd, &isd, &ib);
 	if (FAILED(hr)) { vb->Release(); assert(false && "CreateBuffer IB failed"); return; }
 
-	// ----- MeshFilter  -----
+	// ----- MeshFilter へ -----
 	filter->SetVertexBuffer(vb, sizeof(VERTEX_3D), 24, 0, true);
 	filter->SetIndexBuffer(ib, 36, DXGI_FORMAT_R32_UINT, true); 
 	filter->SetTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 }
 
 // --------------------------------------------------
-// ~
+// 円柱
 // --------------------------------------------------
 void MeshFactory::CreateCylinder(MeshFilterComponent* filter, const CylinderParams& p)
 {
@@ -361,8 +361,8 @@ void MeshFactory::CreateCylinder(MeshFilterComponent* filter, const CylinderPara
 	const float yBottom = -H * 0.5f;
 	const float yTop	= +H * 0.5f;
 
-	// ----- _obt@\z -----
-	// F(stacks + 1) * (slices + 1)
+	// ----- 頂点バッファ構築 -----
+	// 胴：(stacks + 1) * (slices + 1)
 	const uint32_t vBody   = (stacks + 1) * (slices + 1);
 	const uint32_t vTop	   = 1 + (slices + 1);
 	const uint32_t vBottom = 1 + (slices + 1);
@@ -380,12 +380,12 @@ void MeshFactory::CreateCylinder(MeshFilterComponent* filter, const CylinderPara
 
 	uint32_t idxV = 0;
 
-	// ̒_ -----
+	// 胴体頂点 -----
 	for (uint32_t iy = 0; iy <= stacks; iy++)
 	{
 		float t = (stacks == 0) ? 0.0f : (float)iy / (float)stacks; // [0, 1]
 		float yu = Lerp(yBottom, yTop, t);
-		float v = 1.0f - t; // eNX`iɍsقǏj
+		float v = 1.0f - t; // テクスチャｖ（上に行くほど小さく）
 
 		for (uint32_t ix = 0; ix <= slices; ix++)
 		{
@@ -393,48 +393,48 @@ void MeshFactory::CreateCylinder(MeshFilterComponent* filter, const CylinderPara
 			float phi = u * 2.0f * PI;
 			float cx = cosf(phi), sx = sinf(phi);
 			Vector3 pos = { R * cx, yu, R * sx };
-			Vector3 nor = { cx, 0, sx };		 // ͐@
-			putVertex(idxV++, pos, nor, u, v);  // _̓o^ 
+			Vector3 nor = { cx, 0, sx };		 // 胴は水平法線
+			putVertex(idxV++, pos, nor, u, v);  // 頂点情報の登録 
 		}
 	}
 
-	// Lbv -----
+	// 上キャップ -----
 	const uint32_t baseTop = idxV;
-	putVertex(idxV++, { 0, yTop, 0 }, { 0, +1, 0 }, 0.5f, 0.5f); // ʂ̃Z^[
+	putVertex(idxV++, { 0, yTop, 0 }, { 0, +1, 0 }, 0.5f, 0.5f); // 上面のセンター部
 	for (uint32_t ix = 0; ix <= slices; ix++)
 	{
 		float u = (float)ix / (float)slices;
 		float phi = u * 2.0f * PI;
 		float cx = cosf(phi), sx = sinf(phi);
 		Vector3 pos = { R * cx, yTop, R * sx };
-		// ɍWۂUV
+		// 極座標っぽいUV
 		float uu = 0.5f + 0.5f * cx;
 		float vv = 0.5f - 0.5f * sx;
-		putVertex(idxV++, pos, { 0,+1,0 }, uu, vv); // _o^
+		putVertex(idxV++, pos, { 0,+1,0 }, uu, vv); // 頂点情報登録
 	}
 
-	// Lbv -----
+	// 下キャップ -----
 	const uint32_t baseBottom = idxV;
-	putVertex(idxV++, { 0, yBottom, 0 }, { 0, -1, 0 }, 0.5f, 0.5f); // ʂ̃Z^[
+	putVertex(idxV++, { 0, yBottom, 0 }, { 0, -1, 0 }, 0.5f, 0.5f); // 上面のセンター部
 	for (uint32_t ix = 0; ix <= slices; ix++)
 	{
 		float u = (float)ix / (float)slices;
 		float phi = u * 2.0f * PI;
 		float cx = cosf(phi), sx = sinf(phi);
 		Vector3 pos = { R * cx, yBottom, R * sx };
-		// ɍWۂUV
+		// 極座標っぽいUV
 		float uu = 0.5f + 0.5f * cx;
 		float vv = 0.5f - 0.5f * sx;
-		putVertex(idxV++, pos, { 0,-1,0 }, uu, vv); // _o^
+		putVertex(idxV++, pos, { 0,-1,0 }, uu, vv); // 頂点情報登録
 	}
 
-	// ----- CfbNX -----
+	// ----- インデックス -----
 	std::vector<uint32_t> idx;
 	idx.reserve(stacks * slices * 6 + slices * 3 * 2);
 
 	auto emitTri = [&](uint32_t a, uint32_t b, uint32_t c)
 		{
-			if (!p.insideOut) { idx.push_back(a); idx.push_back(b); idx.push_back(c); } // tɂ璼iȂŁHj
+			if (!p.insideOut) { idx.push_back(a); idx.push_back(b); idx.push_back(c); } // 逆にしたら直った（なんで？）
 			else { idx.push_back(a); idx.push_back(c); idx.push_back(b); }
 		};
 	auto emitQuad = [&](uint32_t i00, uint32_t i01, uint32_t i10, uint32_t i11)
@@ -443,7 +443,7 @@ void MeshFactory::CreateCylinder(MeshFilterComponent* filter, const CylinderPara
 			emitTri(i10, i11, i01);
 		};
 	
-	// ́FOԂ̎lp
+	// 胴体：リング間の四角
 	for (uint32_t iy = 0; iy < stacks; iy++)
 	{
 		for (uint32_t ix = 0; ix < slices; ix++)
@@ -456,25 +456,25 @@ void MeshFactory::CreateCylinder(MeshFilterComponent* filter, const CylinderPara
 		}
 	}
 
-	// LbvF
+	// 上キャップ：扇
 	for (uint32_t ix = 0; ix < slices; ix++)
 	{
 		uint32_t c = baseTop;
 		uint32_t r0 = baseTop + 1 + ix;
 		uint32_t r1 = baseTop + 1 + ix + 1;
-		emitTri(c, r1, r0); // (c, r1, r0)ŕ\
+		emitTri(c, r1, r0); // (c, r1, r0)で表向き
 	}
-	// LbvF
+	// 下キャップ：扇
 	for (uint32_t ix = 0; ix < slices; ix++)
 	{
 		uint32_t c = baseBottom;
 		uint32_t r0 = baseBottom + 1 + ix;
 		uint32_t r1 = baseBottom + 1 + ix + 1;
-		emitTri(c, r0, r1); // Ȃ̂(c, r0, r1)ŕ\
+		emitTri(c, r0, r1); // 下向きなので(c, r0, r1)で表向き
 	}
 
-	// `FbN -----
-	// _@Ɩʖ@Ă邩
+	// チェック -----
+	// 頂点法線と面法線が同じ向きを向いているか判定
 	auto checkFace = [&](uint32_t a, uint32_t b, uint32_t c) {
 		Vector3 pa = vertexes[a].position;
 		Vector3 pb = vertexes[b].position;
@@ -482,14 +482,14 @@ void MeshFactory::CreateCylinder(MeshFilterComponent* filter, const CylinderPara
 
 		Vector3 e1 = pb - pa;
 		Vector3 e2 = pc - pa;
-		Vector3 fN = Vector3::Cross(e1, e2).normalized(); // ʖ@
-		Vector3 vN = vertexes[a].normal.normalized();	  // _@
+		Vector3 fN = Vector3::Cross(e1, e2).normalized(); // 面法線
+		Vector3 vN = vertexes[a].normal.normalized();	  // 頂点法線
 		float s = Vector3::Dot(fN, vN);
 		return (p.insideOut ? (s < 0.f) : (s > 0.f));
 		};
 	assert(checkFace(idx[0], idx[1], idx[2]) && "Winding/normal mismatch");
 
-	// ----- VB 쐬 -----
+	// ----- VB 作成 -----
 	D3D11_BUFFER_DESC vbd{};
 	vbd.Usage = D3D11_USAGE_DEFAULT;
 	vbd.ByteWidth = (UINT)(sizeof(VERTEX_3D) * vertexes.size());
@@ -500,7 +500,7 @@ void MeshFactory::CreateCylinder(MeshFilterComponent* filter, const CylinderPara
 	HRESULT hr = Renderer::Device()->CreateBuffer(&vbd, &vsd, &vb);
 	if (FAILED(hr)) { assert(false && "VB failed"); return; }
 
-	// ----- IB 쐬 -----
+	// ----- IB 作成 -----
 	D3D11_BUFFER_DESC ibd{};
 	ibd.Usage = D3D11_USAGE_DEFAULT;
 	ibd.ByteWidth = (UINT)(sizeof(uint32_t) * idx.size());
@@ -511,14 +511,14 @@ void MeshFactory::CreateCylinder(MeshFilterComponent* filter, const CylinderPara
 	hr = Renderer::Device()->CreateBuffer(&ibd, &isd, &ib);
 	if (FAILED(hr)) { vb->Release(); assert(false && "IB failed"); return; }
 
-	// ----- MeshFilter  -----
+	// ----- MeshFilter へ -----
 	filter->SetVertexBuffer(vb, sizeof(VERTEX_3D), (UINT)vertexes.size(), 0, true);
 	filter->SetIndexBuffer(ib, (UINT)idx.size(), DXGI_FORMAT_R32_UINT, true);
 	filter->SetTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 }
 
 // --------------------------------------------------
-// JvZ
+// カプセル
 // --------------------------------------------------
 void MeshFactory::CreateCapsule(MeshFilterComponent* filter, const CapsuleParams& p)
 {
@@ -530,62 +530,62 @@ void MeshFactory::CreateCapsule(MeshFilterComponent* filter, const CapsuleParams
 	const float R = std::max(0.0f, p.radius);
 	const float H = std::max(0.0f, p.cylinderHeight);
 
-	const float yBody0 = -H * 0.5f; // ̉[
-	const float yBody1 = +H * 0.5f; // ̏[
+	const float yBody0 = -H * 0.5f; // 胴体下端
+	const float yBody1 = +H * 0.5f; // 胴体上端
 
-	// ----- O`iƔajɐς -----
-	struct Ring { float y; float r; bool cap; }; // cap == true Ȃ ʂ̖@iSj
+	// ----- リング定義（ｙと半径）を順に積む -----
+	struct Ring { float y; float r; bool cap; }; // cap == true なら 半球面の法線（球中心基準）
 	std::vector<Ring> rings;
 
-	// 
+	// 下半球
 	for (uint32_t i = 0; i <= stacksC; i++)
 	{
 		float t = (float)i / (float)stacksC; // 0..1
 		float theta = t * (PI * 0.5f);		 // 0..pi/2
 		float cy = -cosf(theta);			 // [-1..0]
 		float sy =  sinf(theta);			 // [0..1]
-		rings.push_back({ yBody0 + cy * R, sy * R, true }); // S yBody0
+		rings.push_back({ yBody0 + cy * R, sy * R, true }); // 球中心は yBody0
 	}
-	// ́FÔ݁iE͔Ăj
+	// 胴体：内部リングのみ（境界は半球が持っている）
 	for (uint32_t i = 1; i < stacksB; i++)
 	{
 		float t = (float)i / (float)stacksB; // 0..1
 		float y = Lerp(yBody0, yBody1, t);
 		rings.push_back({ y, R, false });
 	}
-	// 㔼
+	// 上半球
 	for (int i = (int)stacksC; i >= 0; i--)
 	{
 		float t = (float)i / (float)stacksC; // 0..1
 		float theta = t * (PI * 0.5f);		 // 0..pi/2
 		float cy = cosf(theta);			 // [0..1]
 		float sy = sinf(theta);			 // [0..1]
-		rings.push_back({ yBody1 + cy * R, sy * R, true }); // S yBody1
+		rings.push_back({ yBody1 + cy * R, sy * R, true }); // 球中心は yBody1
 	}
 
-	//  ----- _zieO slices + 1j-----
+	//  ----- 頂点配列（各リングに slices + 1個）-----
 	const uint32_t vPerRing = slices + 1;
 	const uint32_t vCount = (uint32_t)rings.size() * vPerRing;
 	std::vector<VERTEX_3D> vertexes(vCount);
 	
-	std::vector<float> vRing(rings.size(), 0.0f); // eÔɌ߂
-	const float Lcap = 0.5f * PI * R; // 
-	const float Ltotal = std::max(1e-8f, H + 2.0f * Lcap); // ォ牺܂ł̒
+	std::vector<float> vRing(rings.size(), 0.0f); // 各リングのｖを先に決める
+	const float Lcap = 0.5f * PI * R; // 半球弧
+	const float Ltotal = std::max(1e-8f, H + 2.0f * Lcap); // 上から下までの長さ
 	const float epsY = 1e-6f;
 	auto clamp01 = [](float x) { return std::max(0.0f, std::min(1.0f, x)); };
 	for (uint32_t ir = 0; ir < rings.size(); ir++)
 	{
 		const Ring& rg = rings[ir];
 		float s = 0.0f;
-		if (rg.cap) // 
+		if (rg.cap) // 半球部分
 		{
 			float theta = asinf(clamp01((R > 0.0f) ? (rg.r / R) : 0.0f)); // 0..pi/2
-			if (rg.y <= yBody0 + epsY) // 
+			if (rg.y <= yBody0 + epsY) // 下半球
 				s = R * theta;
-			else // 㔼
-				s = H + 2.0f * Lcap - R * theta; // H + R - R
+			else // 上半球
+				s = H + 2.0f * Lcap - R * theta; // H + πR - Rθ
 		}
-		else // ̕ 
+		else // 胴体部分 
 			s = Lcap + (rg.y - yBody0);
 
 		vRing[ir] = 1.0f - s / Ltotal;
@@ -611,12 +611,12 @@ void MeshFactory::CreateCapsule(MeshFilterComponent* filter, const CapsuleParams
 			Vector3 pos = { r.r * cx, r.y, r.r * sx };
 
 			Vector3 n;
-			if (r.cap) // aFS̖@
+			if (r.cap) // 半径：球中心基準の法線
 			{
 				float centerY = (r.y > 0.0f) ? yBody1 : yBody0;
 				n = Vector3(pos.x, pos.y - centerY, pos.z).normalized();
 			}
-			else // ́F@
+			else // 胴体：水平法線
 			{
 				n = Vector3(cx, 0, sx);
 			}
@@ -624,7 +624,7 @@ void MeshFactory::CreateCapsule(MeshFilterComponent* filter, const CapsuleParams
 		}
 	}
 
-	// ----- CfbNX -----
+	// ----- インデックス -----
 	std::vector<uint32_t> idx;
 	idx.reserve((uint32_t)( (rings.size() - 1) * slices * 6 ));
 
@@ -651,7 +651,7 @@ void MeshFactory::CreateCapsule(MeshFilterComponent* filter, const CapsuleParams
 		}
 	}
 
-	// `FbN -----
+	// チェック -----
 	auto checkFace = [&](uint32_t a, uint32_t b, uint32_t c) {
 		Vector3 pa = vertexes[a].position;
 		Vector3 pb = vertexes[b].position;
@@ -662,28 +662,28 @@ void MeshFactory::CreateCapsule(MeshFilterComponent* filter, const CapsuleParams
 		Vector3 n = Vector3::Cross(e1, e2);
 		float len = n.length();
 
-		// ɂ̏kށiR_قڋʁ^_j̓XLbv
+		// 極の縮退（３点がほぼ共通／同一点）はスキップ
 		const float kAreaEps = 1e-8f;
-		if (len < kAreaEps) return true; // ʐςقڃ[iOp`ׂj
+		if (len < kAreaEps) return true; // 面積ほぼゼロ（三角形潰れ）
 
-		n /= len; // K
+		n /= len; // 正規化
 
 		Vector3 na = vertexes[a].normal;
 		Vector3 nb = vertexes[b].normal;
 		Vector3 nc = vertexes[c].normal;
 
-		const float kDotEps = -1e-4f; // l덷e
+		const float kDotEps = -1e-4f; // 数値誤差を許容
 		float sa = Vector3::Dot(n, na);
 		float sb = Vector3::Dot(n, nb);
 		float sc = Vector3::Dot(n, nc);
 
-		// insideOut ł@݌vȂ̂Łuɐv
+		// insideOut でも巻き順も法線も同じ側を向く設計なので「常に正」を期待
 		return (sa > kDotEps && sb > kDotEps && sc > kDotEps);
 		};
 	assert(checkFace(idx[0], idx[1], idx[2]) && "Winding/normal mismatch");
 
 
-	// ----- VB 쐬 -----
+	// ----- VB 作成 -----
 	D3D11_BUFFER_DESC vbd{};
 	vbd.Usage = D3D11_USAGE_DEFAULT;
 	vbd.ByteWidth = (UINT)(sizeof(VERTEX_3D) * vertexes.size());
@@ -694,7 +694,7 @@ void MeshFactory::CreateCapsule(MeshFilterComponent* filter, const CapsuleParams
 	HRESULT hr = Renderer::Device()->CreateBuffer(&vbd, &vsd, &vb);
 	if (FAILED(hr)) { assert(false && "VB failed"); return; }
 
-	// ----- IB 쐬 -----
+	// ----- IB 作成 -----
 	D3D11_BUFFER_DESC ibd{};
 	ibd.Usage = D3D11_USAGE_DEFAULT;
 	ibd.ByteWidth = (UINT)(sizeof(uint32_t) * idx.size());
@@ -705,21 +705,21 @@ void MeshFactory::CreateCapsule(MeshFilterComponent* filter, const CapsuleParams
 	hr = Renderer::Device()->CreateBuffer(&ibd, &isd, &ib);
 	if (FAILED(hr)) { vb->Release(); assert(false && "IB failed"); return; }
 
-	// ----- MeshFilter  -----
+	// ----- MeshFilter へ -----
 	filter->SetVertexBuffer(vb, sizeof(VERTEX_3D), (UINT)vertexes.size(), 0, true);
 	filter->SetIndexBuffer(ib, (UINT)idx.size(), DXGI_FORMAT_R32_UINT, true);
 	filter->SetTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 }
 
 // --------------------------------------------------
-// bVtB[h
+// メッシュフィールド
 // --------------------------------------------------
 void MeshFactory::CreateMeshField(MeshFilterComponent* filter, const MeshFieldParams& p)
 {
 	assert(filter);
 
-	const int width = p.width; // Obh_
-	const int depth = p.depth; // Obh_
+	const int width = p.width; // グリッド頂点数
+	const int depth = p.depth; // グリッド頂点数
 	const float csX = p.cellSizeX;
 	const float csZ = p.cellSizeZ;
 
@@ -731,14 +731,14 @@ void MeshFactory::CreateMeshField(MeshFilterComponent* filter, const MeshFieldPa
 	const int quadCount = (width - 1) * (depth - 1);
 	const int indexCount = quadCount * 6;
 
-	// ----- _obt@쐬 -----
+	// ----- 頂点バッファ作成 -----
 	std::vector<VERTEX_3D> vertexes(vertexCount);
 
 	for (int iz = 0; iz < depth; iz++)
 	{
 		for (int ix = 0; ix < width; ix++)
 		{
-			int idx = iz * width + ix; // HeightMap Ɠ̎
+			int idx = iz * width + ix; // HeightMap と同じ引数の取り方をする
 
 			float px = ix * csX;
 			float pz = iz * csZ;
@@ -747,7 +747,7 @@ void MeshFactory::CreateMeshField(MeshFilterComponent* filter, const MeshFieldPa
 			VERTEX_3D& vertex = vertexes[idx];
 			vertex.position = { px, py, pz };
 			
-			// F
+			// 白色
 			vertex.diffuse = { 1.0f, 1.0f, 1.0f, 1.0f };
 
 			// UV 
@@ -757,24 +757,24 @@ void MeshFactory::CreateMeshField(MeshFilterComponent* filter, const MeshFieldPa
 				float v = (depth > 1) ? (float)iz / (float)(depth - 1) : 0.0f;
 				vertex.texcoord = { u, v };
 			}
-			else // ZƂɂPeNX`\
+			else // セルごとに１枚テクスチャを貼る
 			{
-				// wrap Tv
+				// wrap サンプラ
 				vertex.texcoord = { (float)ix, (float)iz };
 			}
-			// normal ͌ŌvẐłł̓[
+			// normal は後で計算するのでここではゼロ初期化
 			vertex.normal = { 0.0f, 0.0f, 0.0f };
 		}
 	}
 
-	// ʖ@WvĒ_@
+	// 面法線を集計して頂点法線を作る
 	auto AccumulateFaceNormal = [&](int i0, int i1, int i2)
 		{
 			const Vector3& p0 = vertexes[i0].position;
 			const Vector3& p1 = vertexes[i1].position;
 			const Vector3& p2 = vertexes[i2].position;
 
-			// CW \ɂȂ悤 Cross ̌킹
+			// CW が表になるように Cross の向きを合わせる
 			Vector3 e1 = p1 - p0;
 			Vector3 e2 = p2 - p0;
 			Vector3 n = Vector3::Cross(e1, e2);
@@ -787,22 +787,22 @@ void MeshFactory::CreateMeshField(MeshFilterComponent* filter, const MeshFieldPa
 	{
 		for (int ix = 0; ix < width - 1; ix++)
 		{
-			int v00 = iz * width + ix;		 // O
-			int v10 = v00 + 1;				 // EO
-			int v01 = (iz + 1) * width + ix; // 
-			int v11 = v01 + 1;				 // E
+			int v00 = iz * width + ix;		 // 左手前
+			int v10 = v00 + 1;				 // 右手前
+			int v01 = (iz + 1) * width + ix; // 左奥
+			int v11 = v01 + 1;				 // 右奥
 
 			AccumulateFaceNormal(v00, v01, v11);
 			AccumulateFaceNormal(v00, v11, v10);
 		}
 	}
-	// e_̖@𐳋K
+	// 各頂点の法線を正規化
 	for (int i = 0; i < vertexCount; i++)
 	{
 		vertexes[i].normal.normalize();
 	}
 
-	// ----- CfbNXobt@쐬 -----
+	// ----- インデックスバッファ作成 -----
 	std::vector<uint32_t> indexes;
 	indexes.resize(indexCount);
 
@@ -811,10 +811,10 @@ void MeshFactory::CreateMeshField(MeshFilterComponent* filter, const MeshFieldPa
 	{
 		for (int ix = 0; ix < width - 1; ix++)
 		{
-			int v00 = iz * width + ix;		 // O
-			int v10 = v00 + 1;				 // EO
-			int v01 = (iz + 1) * width + ix; // 
-			int v11 = v01 + 1;				 // E
+			int v00 = iz * width + ix;		 // 左手前
+			int v10 = v00 + 1;				 // 右手前
+			int v01 = (iz + 1) * width + ix; // 左奥
+			int v11 = v01 + 1;				 // 右奥
 
 			// tri0: v00, v01, v11
 			indexes[idx++] = v00;
@@ -827,7 +827,7 @@ void MeshFactory::CreateMeshField(MeshFilterComponent* filter, const MeshFieldPa
 		}
 	}
 
-	// ----- VB 쐬 -----
+	// ----- VB 作成 -----
 	D3D11_BUFFER_DESC vbd{};
 	vbd.Usage = D3D11_USAGE_DEFAULT;
 	vbd.ByteWidth = (UINT)(sizeof(VERTEX_3D) * vertexes.size());
@@ -838,7 +838,7 @@ void MeshFactory::CreateMeshField(MeshFilterComponent* filter, const MeshFieldPa
 	HRESULT hr = Renderer::Device()->CreateBuffer(&vbd, &vsd, &vb);
 	if (FAILED(hr)) { assert(false && "VB failed"); return; }
 
-	// ----- IB 쐬 -----
+	// ----- IB 作成 -----
 	D3D11_BUFFER_DESC ibd{};
 	ibd.Usage = D3D11_USAGE_DEFAULT;
 	ibd.ByteWidth = (UINT)(sizeof(uint32_t) * indexes.size());
@@ -849,26 +849,26 @@ void MeshFactory::CreateMeshField(MeshFilterComponent* filter, const MeshFieldPa
 	hr = Renderer::Device()->CreateBuffer(&ibd, &isd, &ib);
 	if (FAILED(hr)) { vb->Release(); assert(false && "IB failed"); return; }
 
-	// ----- MeshFilter  -----
+	// ----- MeshFilter へ -----
 	filter->SetVertexBuffer(vb, sizeof(VERTEX_3D), (UINT)vertexes.size(), 0, true);
 	filter->SetIndexBuffer(ib, (UINT)indexes.size(), DXGI_FORMAT_R32_UINT, true);
 	filter->SetTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 }
 
 // --------------------------------------------------
-// S
+// リンゴ
 // --------------------------------------------------
 void MeshFactory::CreateApple(MeshFilterComponent* filter, const AppleParams& p)
 {
 	assert(filter);
 
-	// K[h
+	// ガード
 	const uint32_t slices = std::max<uint32_t>(3, p.slices);
 	const uint32_t stacks = std::max<uint32_t>(3, p.stacks);
 	const float R = std::max<float>(0.0f, p.radius);
-	if (R == 0) return; // aO̓^[
+	if (R == 0) return; // 半径０はリターン
 
-	// fʃxWF -----
+	// 断面ベジェ生成 -----
 	Bezier bezier;
 	bezier.CreatePoint(Vector3(0.00f * R, -1.00f * R, 0)); // 
 	bezier.CreatePoint(Vector3(1.30f * R, -1.10f * R, 0)); // 
@@ -878,10 +878,10 @@ void MeshFactory::CreateApple(MeshFilterComponent* filter, const AppleParams& p)
 	bezier.CreatePoint(Vector3(0.00f * R, 0.70f * R, 0)); // 
 	bezier.CreatePoint(Vector3(0.00f * R, 0.50f * R, 0)); // 
 
-	// ֐ߎ ixWFȐ̐ڃxNg߂j-----
+	// 導関数近似 （ベジェ曲線の接ベクトルを求める）-----
 	auto BezierDeriv = [&](float t)->Vector3
 		{
-			// [_̐lǂNv{S
+			// 端点の数値安定を少し良くするクランプ＋中心差分
 			t = std::min(1.0f, std::max(0.0f, t));
 			const float dt = 1e-3f;
 			float t0 = std::max(0.0f, t - dt);
@@ -889,15 +889,15 @@ void MeshFactory::CreateApple(MeshFilterComponent* filter, const AppleParams& p)
 			Vector3 p0 = bezier.GetValue(t0);
 			Vector3 p1 = bezier.GetValue(t1);
 			float inv = (t1 - t0) > 0 ? 1.0f / (t1 - t0) : 0.0f;
-			return (p1 - p0) * inv; // XY ɗLiZ͏ɂOj
+			return (p1 - p0) * inv; // XY に有効（Zは常に０）
 		};
 
-	// Tv񁕌ʒp[^icXgb`}j-----
+	// ｔサンプル列＆弧長パラメータｖ（縦ストレッチ抑制）-----
 	std::vector<float> tSamples(stacks + 1);
 	for (uint32_t i = 0; i <= stacks; i++) tSamples[i] = (float)i / (float)stacks;
 
-	// eϕŌʒiݐϒjVɐK
-	const int integN = 512; // O`P̋Ԃ𕪊𑜓x
+	// 粗積分で弧長（累積長）→Vに正規化
+	const int integN = 512; // ０～１の区間を分割する解像度
 	std::vector<float> cum(integN + 1, 0.0f);
 	{
 		Vector3 prev = bezier.GetValue(0.0f);
@@ -913,7 +913,7 @@ void MeshFactory::CreateApple(MeshFilterComponent* filter, const AppleParams& p)
 			for (int i = 0; i <= integN; i++) cum[i] = (float)i / integN;
 	}
 
-	// Cӂ̓_ t ʒɊÂO`P̊荇Ɏʑ
+	// 任意の点 t を弧長に基づく０～１の割り合いに写像
 	auto ArcV = [&](float t)->float
 		{
 			float ft = t * integN;
@@ -928,7 +928,7 @@ void MeshFactory::CreateApple(MeshFilterComponent* filter, const AppleParams& p)
 	std::vector<float> vParam(stacks + 1);
 	for (uint32_t i = 0; i <= stacks; i++) vParam[i] = ArcV(tSamples[i]);
 
-	// pxe[u -----
+	// 周方向角度テーブル -----
 	std::vector<float> sinP(slices + 1), cosP(slices + 1);
 	for (uint32_t ix = 0; ix <= slices; ix++)
 	{
@@ -938,12 +938,12 @@ void MeshFactory::CreateApple(MeshFilterComponent* filter, const AppleParams& p)
 		cosP[ix] = std::cosf(phi);
 	}
 
-	// _ -----
+	// 頂点生成 -----
 	const uint32_t vCount = (stacks + 1) * (slices + 1);
 	const uint32_t iCount = stacks * slices * 6;
 	std::vector<VERTEX_3D> vertexes(vCount);
 
-	// K֐
+	// 正規化関数
 	auto Normalize2 = [](float x, float y)->Vector2 {
 		float l = std::sqrt(x * x + y * y);
 		if (l <= 1e-8f) return Vector2(1, 0);
@@ -960,7 +960,7 @@ void MeshFactory::CreateApple(MeshFilterComponent* filter, const AppleParams& p)
 		float r = std::max(0.0f, P.x);
 		float y = P.y;
 
-		// @O@
+		// 法線→外向き法線
 		Vector2 T2 = Normalize2(dP.x, dP.y);
 		Vector2 N2 = Normalize2(+T2.y, -T2.x);
 
@@ -968,16 +968,16 @@ void MeshFactory::CreateApple(MeshFilterComponent* filter, const AppleParams& p)
 		{
 			float cx = cosP[ix], sx = sinP[ix];
 
-			Vector3 pos(r * cx, y, r * sx);		// ʒu
-			Vector3 n(N2.x * cx, N2.y, N2.x * sx); // @
+			Vector3 pos(r * cx, y, r * sx);		// 位置
+			Vector3 n(N2.x * cx, N2.y, N2.x * sx); // 法線
 
 			float nl = std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
 			if (nl < 1e-6f) { n = Vector3(cx, 0, sx); nl = 1.0f; }
 			n.x /= nl; n.y /= nl; n.z /= nl;
 			if (p.insideOut) { n.x = -n.x; n.y = -n.y; n.z = -n.z; }
 
-			float U = (float)ix / (float)slices; // 
-			float Vv = 1.0f - vParam[iy];				 // ciʒj
+			float U = (float)ix / (float)slices; // 周方向
+			float Vv = 1.0f - vParam[iy];				 // 縦（弧長基準）
 
 			VERTEX_3D vert{};
 			vert.position = pos;
@@ -989,7 +989,7 @@ void MeshFactory::CreateApple(MeshFilterComponent* filter, const AppleParams& p)
 		}
 	}
 
-	// CfbNX -----
+	// インデックス -----
 	std::vector<uint32_t> idx; idx.reserve(iCount);
 	auto emitTri = [&](uint32_t a, uint32_t b, uint32_t c)
 		{
@@ -1013,7 +1013,7 @@ void MeshFactory::CreateApple(MeshFilterComponent* filter, const AppleParams& p)
 		}
 	}
 
-	// ----- VB 쐬 -----
+	// ----- VB 作成 -----
 	D3D11_BUFFER_DESC vbd{};
 	vbd.Usage = D3D11_USAGE_DEFAULT;
 	vbd.ByteWidth = (UINT)(sizeof(VERTEX_3D) * vertexes.size());
@@ -1024,7 +1024,7 @@ void MeshFactory::CreateApple(MeshFilterComponent* filter, const AppleParams& p)
 	HRESULT hr = Renderer::Device()->CreateBuffer(&vbd, &vsd, &vb);
 	if (FAILED(hr)) { assert(false && "VB failed"); return; }
 
-	// ----- IB 쐬 -----
+	// ----- IB 作成 -----
 	D3D11_BUFFER_DESC ibd{};
 	ibd.Usage = D3D11_USAGE_DEFAULT;
 	ibd.ByteWidth = (UINT)(sizeof(uint32_t) * idx.size());
@@ -1035,7 +1035,7 @@ void MeshFactory::CreateApple(MeshFilterComponent* filter, const AppleParams& p)
 	hr = Renderer::Device()->CreateBuffer(&ibd, &isd, &ib);
 	if (FAILED(hr)) { vb->Release(); assert(false && "IB failed"); return; }
 
-	// ----- MeshFilter  -----
+	// ----- MeshFilter へ -----
 	filter->SetVertexBuffer(vb, sizeof(VERTEX_3D), (UINT)vertexes.size(), 0, true);
 	filter->SetIndexBuffer(ib, (UINT)idx.size(), DXGI_FORMAT_R32_UINT, true);
 	filter->SetTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
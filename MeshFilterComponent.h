@@ -1,8 +1,8 @@
 /*
 	MeshFilterComponent.h
 	20250813  hanaue sho
-	WIgi`j̕ێ
-	h`hƂi_ACfbNXAg|W etc.j
+	ジオメトリ（形状）の保持者
+	”何を描くか”という情報を持つ（頂点、インデックス、トポロジ etc.）
 */
 #ifndef MESHFILTERCOMPONENT_H_
 #define MESHFILTERCOMPONENT_H_
@@ -11,12 +11,12 @@
 #include <vector>
 #include <cstdint>
 
-// fp[cƂDraw邽߂̂
+// モデルをパーツごとにDrawするためのもの
 struct SubMesh
 {
-	uint32_t indexStart = 0;   // IB ̊JnItZbg
-	uint32_t indexCount = 0;   // ̃TubṼCfbNX
-	int		 materialSlot = 0; // gp}eAԍ
+	uint32_t indexStart = 0;   // IB の開始オフセット
+	uint32_t indexCount = 0;   // そのサブメッシュのインデックス数
+	int		 materialSlot = 0; // 使用するマテリアル番号
 };
 
 class MeshFilterComponent : public Component
@@ -36,7 +36,7 @@ protected:
 	std::vector<SubMesh> m_SubMeshes;
 	int m_MaterialSlotCount = 0;
 
-	// L
+	// 所有権
 	bool m_OwnsVB = false;
 	bool m_OwnsIB = false;
 
@@ -55,7 +55,7 @@ public:
 	void SetMaterialSlotCount(int count) { m_MaterialSlotCount = count; }
 	int  MaterialSlotCount() const { return m_MaterialSlotCount; }
 
-	// ANZX
+	// アクセス
 	ID3D11Buffer* VertexBuffer() const noexcept  { return m_VertexBuffer; }
 	ID3D11Buffer* IndexBuffer()  const noexcept  { return m_IndexBuffer; }
 	UINT		  Stride()		 const noexcept  { return m_Stride; }
@@ -68,7 +68,7 @@ public:
 	const SubMesh& GetSubMesh(int i) const { return m_SubMeshes[i]; }
 	bool	       HasSubMeshes()	 const { return !m_SubMeshes.empty(); }
 
-	// Ó
+	// 妥当性
 	bool IsIndexed() const noexcept { return m_IndexBuffer != nullptr && m_IndexCount > 0; }
 
 	bool IsReady() const noexcept
@@ -85,7 +85,7 @@ public:
 		return true;
 	}
 
-	// jiL̂݁j
+	// 破棄（所有時のみ）
 	void Uninit() override
 	{
 		if (m_OwnsVB && m_VertexBuffer) { m_VertexBuffer->Release(); m_VertexBuffer = nullptr; }
@@ -93,7 +93,7 @@ public:
 		m_SubMeshes.clear();
 	}
 
-	// OǗꍇ̃Zbg
+	// 外部が寿命を管理する場合のリセット
 	void ResetNonOwning() noexcept
 	{
 		m_VertexBuffer = nullptr; m_IndexBuffer = nullptr;
@@ -1,7 +1,7 @@
 /*
 	MeshRendererComponent.h
 	20250813  hanaue sho
-	hǂ`hƂ
+	”どう描くか”という情報を持つ
 */
 #ifndef MESHRENDERERCOMPONENT_H_
 #define MESHRENDERERCOMPONENT_H_
@@ -26,7 +26,7 @@ protected:
 	MaterialComponent*	 m_pMaterialBase = nullptr;
 	MaterialComponent*	 m_pMaterialOutline = nullptr;
 
-	// SubMesh p
+	// SubMesh 用
 	std::vector<MaterialComponent*> m_MaterialSlots;
 public:
 	void SetBaseMaterial(MaterialComponent* mat) { m_pMaterialBase = mat; }
@@ -36,12 +36,12 @@ public:
 	{
 		if (slot >= 0 && slot < (int)m_MaterialSlots.size() && m_MaterialSlots[slot])
 			return m_MaterialSlots[slot];
-		return m_pMaterialBase; // tH[obN
+		return m_pMaterialBase; // フォールバック
 	}
 	void ResizeMaterialSlots(int count) { m_MaterialSlots.assign(count, nullptr); }
 
 	// ==================================================
-	// ----- CtTCN -----
+	// ----- ライフサイクル -----
 	// ==================================================
 	void OnAdded() override
 	{
@@ -49,34 +49,34 @@ public:
 		m_pMeshFilter = Owner()->GetComponent<MeshFilterComponent>();
 		if (!m_pMaterialBase)
 			m_pMaterialBase = Owner()->GetComponent<MaterialComponent>();
-		// TubVwȂx[Xslot0
+		// サブメッシュが未指定ならベースをslot0扱い
 		if (m_MaterialSlots.empty() && m_pMaterialBase)
 			m_MaterialSlots.push_back(m_pMaterialBase);
 	}
 	// --------------------------------------------------
-	// x[X`
+	// ベース描画
 	// --------------------------------------------------
 	virtual void DrawBase() 
 	{
 		if (!m_pTransform || !m_pMeshFilter || !m_pMaterialBase) return;
 		if (!m_pMaterialBase->IsReady() || !m_pMeshFilter->IsReady()) return;
 
-		// }eAiVF[_AILAeNX`A萔obt@MATERIALjoCh
+		// マテリアル（シェーダ、IL、テクスチャ、定数バッファのMATERIAL）をバインド
 		m_pMaterialBase->Bind();
 
-		// world s Renderer 
+		// world 行列を Renderer に
 		const Matrix4x4& worldMatrix = m_pTransform->WorldMatrix();
 		const Matrix4x4& worldMatrixInv = m_pTransform->WorldMatrixInv();
 		Renderer::SetObject(worldMatrix, worldMatrixInv);
 
-		// ߖT|CgCgXV
+		// 近傍ポイントライトを更新
 		const int k = 4;
 		int indexes[k] = {};
 		int count = 0;
 		count = Manager::GetScene()->lightManager().GetNearestIndexes(m_pTransform->Position(), k, indexes);
 		Renderer::SetPointLightIndexes(indexes, count);
 
-		// Animator `FbN
+		// Animator チェック
 		const Matrix4x4* skinPtr = nullptr;
 		int boneCount = 0;
 		if (auto* provider = Owner()->GetComponent< SkinMatrixProviderComponent>())
@@ -93,10 +93,10 @@ public:
 			Renderer::SetSkinMatrixes(skinPtr, boneCount);
 		else
 		{
-			//Renderer::SetSkinMatrixes(nullptr, 0); // 
+			//Renderer::SetSkinMatrixes(nullptr, 0); // 無効化
 		}
 
-		// MeshZbg Draw
+		// Meshをセットして Draw
 		auto* ctx = Renderer::DeviceContext();
 		if (!ctx) return;
 
@@ -117,7 +117,7 @@ public:
 				{
 					const SubMesh& sm = m_pMeshFilter->GetSubMesh(i);
 					if (sm.indexCount == 0) continue;
-					// }eAoCh
+					// マテリアルバインド処理
 					auto* mat = GetMaterialSlot(sm.materialSlot);
 					if (!mat || !mat->IsReady()) mat = m_pMaterialBase;
 					mat->Bind();
@@ -130,28 +130,28 @@ public:
 				ctx->DrawIndexed(m_pMeshFilter->IndexCount(), 0, 0);
 			}
 		}
-		else // CfbNX`i_`j
+		else // 非インデックス描画（頂点描画）
 		{
 			ctx->Draw(m_pMeshFilter->VertexCount(), 0);
 		}
 	}
 	// --------------------------------------------------
-	// AEgC`
+	// アウトライン描画
 	// --------------------------------------------------
 	void DrawOutline()
 	{
 		if (!m_pTransform || !m_pMeshFilter || !m_pMaterialOutline) return;
 		if (!m_pMaterialOutline->IsReady() || !m_pMeshFilter->IsReady()) return;
 
-		// }eAiVF[_AILAeNX`A萔obt@MATERIALjoCh
+		// マテリアル（シェーダ、IL、テクスチャ、定数バッファのMATERIAL）をバインド
 		m_pMaterialOutline->Bind();
 
-		// world s Renderer 
+		// world 行列を Renderer に
 		const Matrix4x4& worldMatrix = m_pTransform->WorldMatrix();
 		const Matrix4x4& worldMatrixInv = m_pTransform->WorldMatrixInv();
 		Renderer::SetObject(worldMatrix, worldMatrixInv);
 
-		// Animator `FbN
+		// Animator チェック
 		const Matrix4x4* skinPtr = nullptr;
 		int boneCount = 0;
 		if (auto* provider = Owner()->GetComponent< SkinMatrixProviderComponent>())
@@ -168,10 +168,10 @@ public:
 			Renderer::SetSkinMatrixes(skinPtr, boneCount);
 		else
 		{
-			//Renderer::SetSkinMatrixes(nullptr, 0); // 
+			//Renderer::SetSkinMatrixes(nullptr, 0); // 無効化
 		}
 
-		// MeshZbg Draw
+		// Meshをセットして Draw
 		auto* ctx = Renderer::DeviceContext();
 		if (!ctx) return;
 
@@ -202,7 +202,7 @@ public:
 				ctx->DrawIndexed(m_pMeshFilter->IndexCount(), 0, 0);
 			}
 		}
-		else // CfbNX`i_`j
+		else // 非インデックス描画（頂点描画）
 		{
 			ctx->Draw(m_pMeshFilter->VertexCount(), 0);
 		}
@@ -36,7 +36,7 @@ void Manager::Draw()
 {
 	m_pScene->Draw();
 
-	// V[؂ւ
+	// シーン切り替え
 	if (m_pSceneNext != nullptr)
 	{
 		m_pScene->Uninit();
@@ -24,7 +24,7 @@ void ModelAnimeObject::Init()
 	auto* tf = GetComponent<TransformComponent>();
 	float s = 1.0f;
 	//tf->SetPosition({ 0, -5.5f, 0 });
-	tf->SetPosition({ 0, -0.5f, -150 }); // SetParentKeepWorld̊֌Włg
+	tf->SetPosition({ 0, -0.5f, -150 }); // SetParentKeepWorldの関係でこっちを使う
 	tf->SetScale({ s, s, s });
 	tf->SetEulerAngles({ 3.141592F / 2 * 3, 0, 0 });
 
@@ -69,24 +69,24 @@ void ModelAnimeObject::Init()
 	// MeshRenderer
 	auto* mr = AddComponent<MeshRendererComponent>();
 
-	// Slot 
+	// Slot 数
 	const int slotCount = mf->MaterialSlotCount();
 	mr->ResizeMaterialSlots(slotCount);
 
-	// ʃVF[_[
+	// 共通シェーダー
 	ID3D11VertexShader* vs = nullptr;
 	ID3D11PixelShader* ps = nullptr;
 	ID3D11InputLayout* il = nullptr;
 	Renderer::CreateVertexShader(&vs, &il, "shader\\VS_Skinned.cso", Renderer::VertexLayoutType::Skinned);
 	Renderer::CreatePixelShader(&ps, "shader\\PS_Toon.cso");
 
-	// ʃ}eA萔
+	// 共通マテリアル定数
 	MaterialApp m{};
 	m.diffuse = Vector4(1, 1, 1, 1);
 	m.ambient = Vector4(1, 1, 1, 1);
 	m.textureEnable = true;
 
-	// slot Ƃ MaterialComponent  srv h
+	// slot ごとに MaterialComponent を作って srv を刺す
 	for (int slot = 0; slot < slotCount; slot++)
 	{
 		auto* mat = AddComponent<MaterialComponent>();
@@ -106,7 +106,7 @@ void ModelAnimeObject::Init()
 	if (slotCount > 0)
 		mr->SetBaseMaterial(mr->GetMaterialSlot(0));
 
-	// AEgC}eAǉ
+	// アウトラインマテリアル追加
 	auto* matOutline = AddComponent<MaterialComponent>();
 	Renderer::CreateVertexShader(&vs, &il, "shader\\VS_SkinnedOutline.cso", Renderer::VertexLayoutType::Skinned);
 	Renderer::CreatePixelShader(&ps, "shader\\PS_Outline.cso");
@@ -230,11 +230,11 @@ void ModelAnimeObject::SetupBones()
 {
 	auto* animator = GetComponent<AnimatorComponent>();
 
-	// ܂͍̈ʒu𑵂
+	// まずは骨の位置を揃える
 	animator->EvaluateNow();
 	m_pBoneManager->UpdateFromAnimator(animator->ModelMatrixes(), nullptr);
 
-	// ̐ݒ
+	// 骨の設定
 	const int indexHip = 0; // Spin0..2 : 1..3
 	const int indexNeck = 4;
 	const int indexHead = 5;
@@ -306,7 +306,7 @@ void ModelAnimeObject::SetupBones()
 		if (i == indexEar0R + 1) { coll->SetCapsule(0.2f, 0.4f); coll->SetOffsetPosition({ 0, 0.00f, 0.0f }); }
 		if (i == indexEar0R + 2) { coll->SetCapsule(0.1f, 0.2f); coll->SetOffsetPosition({ 0, 0.12f, -0.2f }); }
 	}
-	for (int i = indexEar0L; i <= indexEar2L; i++) // WCgݒ
+	for (int i = indexEar0L; i <= indexEar2L; i++) // ジョイント設定
 	{
 		auto* bone = m_pBoneManager->GetBoneObject(i);
 		if (i == indexEar0L)
@@ -324,16 +324,16 @@ void ModelAnimeObject::SetupBones()
 			joint->SetLocalAnchorA({ 0, 0.4f, 0 });
 			joint->SetLocalAnchorB({ 0, -0.3f, 0.0f });
 			joint->RegisterToPhysicsSystem();
-			auto* rigid = bone->GetComponent<Rigidbody>(); // ɗƂ
+			auto* rigid = bone->GetComponent<Rigidbody>(); // 上向きに落とす
 			rigid->SetGravityScale(-0.5f);
 		}
 		if (i == indexEar0L + 2)
 		{
-			auto* rigid = bone->GetComponent<Rigidbody>(); // ɗƂ
+			auto* rigid = bone->GetComponent<Rigidbody>(); // 上向きに落とす
 			rigid->SetGravityScale(-0.5f);
 		}
 	}
-	for (int i = indexEar0R; i <= indexEar2R; i++) // WCgݒ
+	for (int i = indexEar0R; i <= indexEar2R; i++) // ジョイント設定
 	{
 		auto* bone = m_pBoneManager->GetBoneObject(i);
 		if (i == indexEar0R)
@@ -351,12 +351,12 @@ void ModelAnimeObject::SetupBones()
 			joint->SetLocalAnchorA({ 0, 0.4f, 0 });
 			joint->SetLocalAnchorB({ 0, -0.3f, 0.0f });
 			joint->RegisterToPhysicsSystem();
-			auto* rigid = bone->GetComponent<Rigidbody>(); // ɗƂ
+			auto* rigid = bone->GetComponent<Rigidbody>(); // 上向きに落とす
 			rigid->SetGravityScale(-0.5f);
 		}
 		if (i == indexEar0R + 2)
 		{
-			auto* rigid = bone->GetComponent<Rigidbody>(); // ɗƂ
+			auto* rigid = bone->GetComponent<Rigidbody>(); // 上向きに落とす
 			rigid->SetGravityScale(-0.5f);
 		}
 	}
@@ -415,7 +415,7 @@ void ModelAnimeObject::SetupBones()
 		auto* rigid = bone->GetComponent<Rigidbody>();
 		rigid->ComputeBoxInertia({ 0.2f, 0.2f, 0.03f });
 	}
-	for (int i = indexMuffler0; i <= indexMuffler7; i++) // WCgݒ
+	for (int i = indexMuffler0; i <= indexMuffler7; i++) // ジョイント設定
 	{
 		auto* bone = m_pBoneManager->GetBoneObject(i);
 		if (1 == indexMuffler0)
@@ -453,7 +453,7 @@ void ModelAnimeObject::SetupBones()
 		coll->SetBox({ 0.2, 0.2, 0.1 });
 		coll->SetOffsetPosition({ 0, 0, 0 });
 	}
-	for (int i = indexTail0; i <= indexTail7; i++) // WCgݒ
+	for (int i = indexTail0; i <= indexTail7; i++) // ジョイント設定
 	{
 		auto* bone = m_pBoneManager->GetBoneObject(i);
 		if (i != indexTail7)
@@ -487,7 +487,7 @@ void ModelAnimeObject::SetupBones()
 		if (i == indexUpperLegR + 3) { coll->SetCapsule(0.1f, 0.4f); coll->SetOffsetPosition({ 0, 0.60f, 0.0f }); }
 	}
 
-	//{[ Rigidbody ̃C[ݒ肷
+	//ボーンの Rigidbody のレイヤーを設定する
 	for (int i = 0; i < m_pBoneManager->GetBonesSize(); i++)
 	{
 		auto* bone = m_pBoneManager->GetBoneObject(i);
@@ -33,7 +33,7 @@ public:
 	void Uninit() override;
 	void Update(float dt) override;
 
-	// ----- OĂяoAj -----
+	// ----- 外部から呼び出されるアニメ制御 -----
 	void SetIsLocomotion(bool b);
 	void SetBlendParam(float blend);
 	void SetSpeedAnime(float speed);
@@ -44,10 +44,10 @@ public:
 	void PlayAnimeThrow();
 
 
-	// ̃Zbg
+	// 骨のセット
 	void SetupBones();
 
-	// Qb^[iƃG[oj
+	// ゲッター（これらを作るとエラーが出る）
 	const BoneManager& GetBoneManager() const { return *m_pBoneManager; }
 	const AnimatorController& GetAnimatorController() const { return *m_pController; }
 };
@@ -1,10 +1,10 @@
 /*
 	ModelLoader.cpp
 	20251212  hanaue sho
-	assimp ɂ郂f[_[
-	 TexCoord.y 𔽓]Ă܂
+	assimp によるモデルローダー
+	※ TexCoord.y を反転させています
 */
-#pragma comment (lib, "assimp-vc143-mt.lib") // CuN
+#pragma comment (lib, "assimp-vc143-mt.lib") // ライブラリリンク
 #include <cassert>
 #include <filesystem>
 #include "ModelLoader.h"
@@ -13,12 +13,16 @@
 #include "Renderer.h"
 #include "Texture.h"
 #include "AnimationClip.h"
+#include "TriangleMeshBVH.h"
+#include "ConvexHull.h"
 
 std::unordered_map<std::string, std::shared_ptr<ModelResource>> ModelLoader::s_ModelPool;
+std::unordered_map<std::string, std::shared_ptr<const TriangleMeshBVH>> ModelLoader::s_CollisionMeshPool;
+std::unordered_map<std::string, std::shared_ptr<const ConvexHull>> ModelLoader::s_ConvexHullPool;
 
 namespace
 {
-	// TRSɕ
+	// TRSに分解
 	void ExtractBindTRS(const Matrix4x4& M, Vector3& outT, Quaternion& outR, Vector3& outS)
 	{
 		outT = Vector3(M.m[3][0], M.m[3][1], M.m[3][2]);
@@ -50,7 +54,7 @@ namespace
 		outR = Quaternion::FromMatrix(mat);
 	}
 
-	// aiMatrix4x4  Matrix4x4 ֕ϊ
+	// aiMatrix4x4 から Matrix4x4 へ変換
 	Matrix4x4 ToMatrix4x4(const aiMatrix4x4& m)
 	{
 		Matrix4x4 mat;
@@ -61,7 +65,7 @@ namespace
 		return mat;
 	}
 
-	// m[hW߂
+	// ノードを集める
 	void BuildNodesRecursive(const aiNode* node, int parentNode, Skeleton& skeleton)
 	{
 		Node n;
@@ -69,7 +73,7 @@ namespace
 		n.parent = parentNode;
 		n.bindLocal = ToMatrix4x4(node->mTransformation);
 
-		// dmF
+		// 重複確認
 		auto it = skeleton.nodeNameToIndex.find(n.name);
 		if (it != skeleton.nodeNameToIndex.end())
 		{
@@ -82,7 +86,7 @@ namespace
 		skeleton.nodes.push_back(n);
 		skeleton.nodeNameToIndex[n.name] = thisIndex;
 
-		// ----- meshToNode o^ -----
+		// ----- meshToNode 登録 -----
 		for (unsigned int i = 0;i < node->mNumMeshes; i++)
 		{
 			unsigned int meshIndex = node->mMeshes[i];
@@ -100,22 +104,22 @@ namespace
 			skeleton.meshToNode[meshIndex] = thisIndex;
 		}
 
-		// q
+		// 子へ
 		for (unsigned int i = 0; i < node->mNumChildren; i++)
 			BuildNodesRecursive(node->mChildren[i], thisIndex, skeleton);
 	}
 
-	// aiBone W߂
+	// aiBone を集める
 	// scene->mesh->bone
 	std::unordered_map<std::string, const aiBone*> CollectBones(const aiScene* scene)
 	{
 		std::unordered_map<std::string, const aiBone*> map;
 
-		// mesh ̐
+		// mesh の数分回す
 		for (unsigned int m = 0; m < scene->mNumMeshes; m++)
 		{
 			const aiMesh* mesh = scene->mMeshes[m];
-			// bone ̐
+			// bone の数分回す
 			for (unsigned int b = 0; b < mesh->mNumBones; b++)
 			{
 				const aiBone* bone = mesh->mBones[b];
@@ -123,23 +127,23 @@ namespace
 
 				if (name.empty()) continue;
 
-				// bone i[
+				// bone 格納
 				// emplace(key, value) : 
-				// key ݂ȂȂVKɗvfđ}
-				// key ɑ݂Ȃ牽Ȃiunordered_map ̓L[dȂ̂Łj
-				// ߂l it ͗vfwCe[^[A inserted boolԂȋ}ǂj
+				// key が存在しないなら新規に要素を作って挿入
+				// key が既に存在するなら何もしない（unordered_map はキー重複を許さないので）
+				// 戻り値は it は要素を指すイテレーター、 inserted はboolを返す（今回の挿入が成功したかどうか）
 				auto [it, inserted] = map.emplace(name, bone);
 				if (!inserted)
 				{
 					//it->second = bone;
-					//printf("d܂: %s\n", name.c_str()); //  זȂ̂ŃRgAEg
+					//printf("重複があります: %s\n", name.c_str()); // ※ 邪魔なのでコメントアウト
 				}
 			}
 		}
 		return map;
 	}
 
-	// eT
+	// 親骨探索
 	int FindParentBoneIndexByNode(const Skeleton& skeleton, int nodeIndex)
 	{
 		int p = skeleton.nodes[nodeIndex].parent;
@@ -147,19 +151,19 @@ namespace
 		{
 			auto it = skeleton.boneNameToIndex.find(skeleton.nodes[p].name);
 			if (it != skeleton.boneNameToIndex.end())
-				return it->second; // e
+				return it->second; // 親骨が見つかった
 			p = skeleton.nodes[p].parent;
 		}
-		return -1; // [g
+		return -1; // ルート骨
 	}
 
-	// _ɃEFCgǉ
+	// 頂点にウェイトを追加する
 	constexpr int MAX_INFLUENCES = 4;
 	void AddBoneWeightToVertex(VERTEX_SKINNED& vertex, int boneIndex, float weight)
 	{
 		if (weight <= 0.0f) return;
 
-		// ܂󂢂ĂXbgȂ炻ɓ
+		// まだ空いているスロットがあるならそこに入れる
 		for (int i = 0; i < MAX_INFLUENCES; i++)
 		{
 			if (vertex.boneWeight[i] <= 0.0f)
@@ -170,7 +174,7 @@ namespace
 			}
 		}
 
-		// S܂Ăꍇ́uԏEFCgƍւvid{[Dj
+		// 全部埋まっている場合は「一番小さいウェイトと差し替え」（重いボーン優先）
 		int smallest = 0;
 		for (int i = 0; i < MAX_INFLUENCES; i++)
 		{
@@ -184,14 +188,14 @@ namespace
 		}
 	}
 
-	// VERTEX_SKINNED ɏl߂
+	// VERTEX_SKINNED に情報を詰める
 	void FillSkinnedVertexesFromMesh(const aiMesh* mesh, const Skeleton& skeleton, std::vector<VERTEX_SKINNED>& outVertexes, bool flipV)
 	{
 		assert(mesh);
 		outVertexes.clear();
 		outVertexes.resize(mesh->mNumVertices);
 
-		// ŏ position, normal, texcoord Zbg{[[
+		// 最初に position, normal, texcoord をセット＆ボーン情報をゼロ初期化
 		for (unsigned int i = 0; i < mesh->mNumVertices; i++)
 		{
 			auto& vertex = outVertexes[i];
@@ -212,7 +216,7 @@ namespace
 				);
 			}
 			else
-				vertex.normal = Vector3(0, 1, 0); // KȃftHgl
+				vertex.normal = Vector3(0, 1, 0); // 適当なデフォルト値
 			// texcord
 			if (mesh->HasTextureCoords(0))
 			{
@@ -224,7 +228,7 @@ namespace
 			else
 				vertex.texcoord = Vector2(0, 0);
 
-			// {[̓Z[
+			// ボーン情報はセゼロ期化
 			for (int j = 0; j < MAX_INFLUENCES; j++)
 			{
 				vertex.boneIndex[j] = 0;
@@ -232,10 +236,10 @@ namespace
 			}
 		}
 
-		// Skeleton ̖O  index ̃}bv
+		// Skeleton の名前 → index のマップを作る
 		const std::unordered_map<std::string, int>& boneNameToIndex = skeleton.boneNameToIndex;
 
-		// e aiBone ɂ
+		// 各 aiBone について
 		for (unsigned int b = 0; b < mesh->mNumBones; b++)
 		{
 			const aiBone* aiBonePtr = mesh->mBones[b];
@@ -243,12 +247,12 @@ namespace
 
 			std::string boneName = aiBonePtr->mName.C_Str();
 			auto it = boneNameToIndex.find(boneName);
-			if (it == boneNameToIndex.end()) // Skeleton ɑ݂Ȃ{[͖
+			if (it == boneNameToIndex.end()) // Skeleton に存在しないボーン名は無視
 				continue;
 
 			int boneIndex = it->second;
 
-			// ̃{[eS_ɑ΂ăEFCgǉ
+			// このボーンが影響する全頂点に対してウェイトを追加
 			for (unsigned int w = 0; w < aiBonePtr->mNumWeights; w++)
 			{
 				const aiVertexWeight& vw = aiBonePtr->mWeights[w];
@@ -260,7 +264,7 @@ namespace
 			}
 		}
 
-		// EFCgKtH[obN
+		// ウェイト正規化＆フォールバック
 		for (auto& vertex : outVertexes)
 		{
 			float sum = vertex.boneWeight[0] +
@@ -273,21 +277,21 @@ namespace
 				for (int i = 0; i < MAX_INFLUENCES; i++)
 					vertex.boneWeight[i] *= inv;
 			}
-			else // ǂ̃{[ɂRÂĂȂ_
+			else // どのボーンにも紐づいていない頂点
 			{
-				vertex.boneIndex[0] = (uint8_t)skeleton.rootBone; // [g{[փtH[obN
+				vertex.boneIndex[0] = (uint8_t)skeleton.rootBone; // ルートボーンへフォールバック
 				vertex.boneWeight[0] = 1.0f;
 			}
 		}
 	}
 
-	// {[̃\[g
+	// ボーンのソート
 	void SortBonesParentFirst(Skeleton& skeleton)
 	{
 		const int n = (int)skeleton.bones.size();
 		if (n <= 1) return;
 
-		// children 
+		// children を作る
 		std::vector<std::vector<int>> children(n);
 		std::vector<int> roots;
 		roots.reserve(n);
@@ -301,7 +305,7 @@ namespace
 				continue;
 			}
 
-			if (p >= n) // ꂽeQƗpB[gɗƂij
+			if (p >= n) // 壊れた親参照用。ルート扱いに落とす（回避策）
 			{
 				skeleton.bones[i].parent = -1;
 				roots.push_back(i);
@@ -310,17 +314,17 @@ namespace
 			children[p].push_back(i);
 		}
 
-		// OŌZ폇Œ
+		// 名前で兄弟順を固定
 		auto boneKey = [&](int idx) -> const std::string& {
 			return skeleton.bones[idx].name;
 			};
 
-		// roots Œ菇
+		// roots を固定順に
 		std::sort(roots.begin(), roots.end(), [&](int a, int b) {
 			return boneKey(a) < boneKey(b);
 			});
 
-		// ee children Œ菇
+		// 各親の children を固定順に
 		for (int p = 0; p < n; ++p) {
 			auto& ch = children[p];
 			std::sort(ch.begin(), ch.end(), [&](int a, int b) {
@@ -329,7 +333,7 @@ namespace
 		}
 
 
-		// eq order iDFSj
+		// 親→子順の order を作る（DFS）
 		std::vector<int> order;
 		order.reserve(n);
 		std::vector<char> visited(n, 0);
@@ -348,17 +352,17 @@ namespace
 		for (int r : roots)
 			dfs(dfs, r);
 
-		// BłĂȂΒǉif[^j^zȂǂ̑΍j
+		// もし到達できていない骨があれば追加（データ破損／循環などの対策）
 		for (int i = 0; i < n; i++)
 			if (!visited[i])
 				dfs(dfs, i);
 
-		// oldToNew 
+		// oldToNew を作る
 		std::vector<int> oldToNew(n, -1);
 		for (int newIndex = 0; newIndex < (int)order.size(); newIndex++)
 			oldToNew[order[newIndex]] = newIndex;
 
-		// bones ёւ
+		// bones を並び替え
 		std::vector<Bone> newBones(n);
 		for (int newIndex = 0; newIndex < n; newIndex++)
 		{
@@ -371,13 +375,13 @@ namespace
 		}
 		skeleton.bones.swap(newBones);
 
-		// boneNameToIndex č\z
+		// boneNameToIndex を再構築
 		skeleton.boneNameToIndex.clear();
 		skeleton.boneNameToIndex.reserve((size_t)n);
 		for (int i = 0; i < n; i++)
 			skeleton.boneNameToIndex[skeleton.bones[i].name] = i;
 
-		// boneToNode č\z
+		// boneToNode も再構築
 		if ((int)skeleton.boneToNode.size() == n)
 		{
 			std::vector<int> newBoneToNode(n, -1);
@@ -391,9 +395,9 @@ namespace
 
 	}
 
-	// bV̏Ăݍsi͌ǎgĂ炸j
+	// メッシュの焼きこみ行列を作る（今は結局使っておらず）
 
-	// ÓIbVp̒_lߍ
+	// 静的メッシュ用の頂点情報を詰め込む
 	void FillStaticVertexesFromMesh(const aiMesh* mesh, std::vector<VERTEX_3D>& out, bool flipV)
 	{
 		out.clear();
@@ -428,7 +432,7 @@ namespace
 		}
 	}
 
-	// aiMaterial hgȃeNX`pXhPƂ
+	// aiMaterial から”使えそうなテクスチャパス”を１つとる
 	bool TryGetTexturePath(const aiMaterial* mat, aiTextureType type, aiString& outPath)
 	{
 		if (!mat) return false;
@@ -437,13 +441,13 @@ namespace
 	}
 	bool GetBestTexturePath(aiMaterial* mat, aiString& outPath)
 	{
-		// ܂ DIFFUSE
+		// まずは DIFFUSE
 		if (TryGetTexturePath(mat, aiTextureType_DIFFUSE, outPath)) return true;
-		// PBR nĂꍇ̃tH[obNiAssimp ̃o[WFBXɂhj
+		// PBR 系が入っている場合のフォールバック（Assimp のバージョンやFBXにより揺れる）
 #ifdef aiTextureType_BASE_COLOR
 		if (TryGetTexturePath(mat, aiTextureType_BASE_COLOR, outPath)) return true;
 #endif
-		// Ō̕ی
+		// 最後の保険
 		if (TryGetTexturePath(mat, aiTextureType_UNKNOWN, outPath)) return true;
 		return false;
 	}
@@ -459,7 +463,7 @@ namespace
 		if (p == std::string::npos) return n;
 		return n.substr(p + 1);
 	}
-	// }bv
+	// マップを作る
 	void BuildEmbeddedTextureSRVMap(const aiScene* scene, std::unordered_map<std::string, ID3D11ShaderResourceView*>& outMap)
 	{
 		outMap.clear();
@@ -478,7 +482,7 @@ namespace
 			std::string key = NormalizeSlashes(t->mFilename.C_Str());
 			if (key.empty())
 			{
-				// Ȃ֋X̃L[
+				// 空なら便宜上のキーを作る
 				key = "*embedded_" + std::to_string(i);
 			}
 
@@ -490,15 +494,15 @@ namespace
 
 			if (t->mHeight == 0)
 			{
-				// k`ipng/jpgjۂƓĂFmWidthoCg
+				// 圧縮形式（png/jpg等）が丸ごと入っている：mWidthがバイト数
 				const uint8_t* data = reinterpret_cast<const uint8_t*>(t->pcData);
 				const size_t size = static_cast<size_t>(t->mWidth);
 				hr = LoadFromWICMemory(data, size, WIC_FLAGS_NONE, &metadata, image);
 			}
 			else
 			{
-				// 񈳏kisNZj͌`FX̂ō͍Œ̑Ή
-				// FBX͂ɂ͗ȂiȂʓrΉKvjiЂƐ悸XLbvĂ悢j
+				// 非圧縮（生ピクセル）※ここは形式が色々あるので今回は最低限の対応
+				// 多くのFBXはここには来ない（来るなら別途対応が必要）（ひと先ずスキップしてよい）
 				continue;
 			}
 			if (FAILED(hr)) continue;
@@ -507,9 +511,9 @@ namespace
 
 			if (FAILED(hr) || !srv) continue;
 
-			// tL[œo^
+			// フルキーで登録
 			outMap[key] = srv;
-			// t@Cło^iMaterialt@CԂP[X΍j
+			// ファイル名だけでも登録（Material側がファイル名だけを返すケース対策）
 			outMap[GetFilenameOnly(key)] = srv;
 		}
 	}
@@ -520,14 +524,14 @@ namespace
 	{
 		if (!scene || !mat) return nullptr;
 		aiString texPath;
-		if (!GetBestTexturePath(mat, texPath)) return nullptr; // eNX`wȂ
+		if (!GetBestTexturePath(mat, texPath)) return nullptr; // そもそもテクスチャ指定なし
 
 		std::string p = NormalizeSlashes(texPath.C_Str());
 
-		// ߍݎň
-		if (!p.empty() && p[0] == '*') // Assimp ł͖ߍ݂ "*0" ݂Ȍ`ŗ邱Ƃ
+		// 埋め込み辞書で引く
+		if (!p.empty() && p[0] == '*') // Assimp では埋め込みが "*0" みたいな形式で来ることもある
 		{
-			// "*0"  scene->mTextures[0]
+			// "*0" → scene->mTextures[0]
 			int index = atoi(p.c_str() + 1);
 			if (index >= 0 && index < (int)scene->mNumTextures)
 			{
@@ -540,7 +544,7 @@ namespace
 				if (it2 != embeddedMap.end()) return it2->second;
 			}
 		}
-		// ʏ̕łɂΎg
+		// 通常の文字列でも辞書にあれば使う
 		{
 			auto it = embeddedMap.find(p);
 			if (it != embeddedMap.end()) return it->second;
@@ -548,7 +552,7 @@ namespace
 			if (it2 != embeddedMap.end()) return it2->second;
 		}
 
-		// t@C[h
+		// ファイルロード
 		std::filesystem::path texRel(p);
 		std::filesystem::path full = texRel.is_absolute() ? texRel : (modelDir / texRel);
 
@@ -561,7 +565,7 @@ void ModelLoader::LoadMeshFromFile(MeshFilterComponent* filter, const std::strin
 {
 	assert(filter);
 
-	// Assimp Ńfǂ
+	// Assimp でモデルを読む
 	Assimp::Importer importer;
 	const aiScene* scene = importer.ReadFile(path.c_str(),
 											 aiProcess_Triangulate
@@ -577,7 +581,7 @@ void ModelLoader::LoadMeshFromFile(MeshFilterComponent* filter, const std::strin
 		return;
 	}
 
-	// ----- VB/IV  + subMesh 쐬 ----- 
+	// ----- VB/IV 統合 + subMesh 作成 ----- 
 	std::vector<VERTEX_3D> vertexes;
 	std::vector<uint32_t> indexes;
 	unsigned int totalVertexes = 0;
@@ -591,22 +595,22 @@ void ModelLoader::LoadMeshFromFile(MeshFilterComponent* filter, const std::strin
 		aiMesh* mesh = scene->mMeshes[i]; 
 		if (!mesh) continue;
 
-		// ̃bVIBɒǉn߂ʒuiindexPʁj
+		// このメッシュがIBに追加し始める位置（index単位）
 		uint32_t indexStart = (uint32_t)indexes.size();
 
-		// _obt@p̔z쐬
+		// 頂点バッファ用の配列を作成
 		std::vector<VERTEX_3D> meshVertex;
 		FillStaticVertexesFromMesh(mesh, meshVertex, flipV);
-		// ܂Őς񂾒_ɃItZbg
+		// 今まで積んだ頂点を基準にオフセット
 		uint32_t baseVertex = static_cast<uint32_t>(vertexes.size());
 
 		vertexes.insert(vertexes.end(), meshVertex.begin(), meshVertex.end());
 
-		// CfbNXz쐬
+		// インデックス配列を作成
 		for (unsigned i = 0; i < mesh->mNumFaces; i++)
 		{
 			const aiFace& face = mesh->mFaces[i];
-			assert(face.mNumIndices == 3); // Triangle ςݑO
+			assert(face.mNumIndices == 3); // Triangle 済み前提
 			indexes.push_back(baseVertex + face.mIndices[0]);
 			indexes.push_back(baseVertex + face.mIndices[1]);
 			indexes.push_back(baseVertex + face.mIndices[2]);
@@ -630,7 +634,7 @@ void ModelLoader::LoadMeshFromFile(MeshFilterComponent* filter, const std::strin
 		return;
 	}
 	
-	// ----- VB 쐬 -----
+	// ----- VB 作成 -----
 	D3D11_BUFFER_DESC bd{};
 	bd.Usage = D3D11_USAGE_DEFAULT;
 	bd.ByteWidth = sizeof(VERTEX_3D) * static_cast<UINT>(vertexes.size());
@@ -645,7 +649,7 @@ void ModelLoader::LoadMeshFromFile(MeshFilterComponent* filter, const std::strin
 		return;
 	}
 
-	// ----- IB 쐬 -----
+	// ----- IB 作成 -----
 	D3D11_BUFFER_DESC ibd{};
 	ibd.Usage = D3D11_USAGE_DEFAULT;
 	ibd.ByteWidth = sizeof(uint32_t) * static_cast<UINT>(indexes.size());
@@ -661,7 +665,7 @@ void ModelLoader::LoadMeshFromFile(MeshFilterComponent* filter, const std::strin
 		return;
 	}
 
-	// MeshFilter ɓn
+	// MeshFilter に渡す
 	filter->SetVertexBuffer(vb, sizeof(VERTEX_3D), static_cast<UINT>(vertexes.size()), 0, true);
 	filter->SetIndexBuffer(ib, static_cast<UINT>(indexes.size()), DXGI_FORMAT_R32_UINT, true);
 	filter->SetTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
@@ -672,8 +676,8 @@ void ModelLoader::LoadMeshFromFile(MeshFilterComponent* filter, const std::strin
 	outSrvs.clear();
 	outSrvs.resize(slotCount, nullptr);
 
-	// ----- Texture ̎擾 -----
-	// ft@C̃fBNg擾
+	// ----- Texture の取得 -----
+	// モデルファイルのディレクトリを取得
 	std::filesystem::path modelPath(path);
 	std::filesystem::path modelDir = modelPath.parent_path();
 
@@ -681,7 +685,7 @@ void ModelLoader::LoadMeshFromFile(MeshFilterComponent* filter, const std::strin
 	std::unordered_map<std::string, ID3D11ShaderResourceView*> embeddedMap;
 	BuildEmbeddedTextureSRVMap(scene, embeddedMap);
 
-	// }eAXbgɓ
+	// マテリアルスロットに入れる
 	for (int matIndex = 0; matIndex < slotCount; matIndex++)
 	{
 		aiMaterial* mat = scene->mMaterials[matIndex];
@@ -697,7 +701,7 @@ void ModelLoader::LoadSkinnedMeshFromFile(MeshFilterComponent* filter, const std
 	Assimp::Importer importer;
 	const aiScene* scene = importer.ReadFile(path,
 											 aiProcess_Triangulate 
-											 //aiProcess_ConvertToLeftHanded  // ꂢH
+											 //aiProcess_ConvertToLeftHanded  // これいる？
 											 //aiProcess_GenNormals |
 											 //aiProcess_CalcTangentSpace |
 											 //aiProcess_JoinIdenticalVertices |
@@ -711,7 +715,7 @@ void ModelLoader::LoadSkinnedMeshFromFile(MeshFilterComponent* filter, const std
 		return;
 	}
 
-	// ----- SbV܂Ƃ߂1̒_/CfbNXzɂ -----
+	// ----- 全メッシュをまとめて1つの頂点/インデックス配列にする -----
 	std::vector<VERTEX_SKINNED> vertexes;
 	std::vector<uint32_t> indexes;
 	unsigned int totalVertexes = 0;
@@ -725,20 +729,20 @@ void ModelLoader::LoadSkinnedMeshFromFile(MeshFilterComponent* filter, const std
 		const aiMesh* mesh = scene->mMeshes[i];
 		if (!mesh) continue;
 
-		// ̃bVIBɒǉn߂ʒuiindexPʁj
+		// このメッシュがIBに追加し始める位置（index単位）
 		uint32_t indexStart = (uint32_t)indexes.size();
 
-		// ̃bV̒_ꎞobt@ɋl߂
+		// このメッシュ分の頂点を一時バッファに詰める
 		std::vector<VERTEX_SKINNED> meshVertexes;
 		FillSkinnedVertexesFromMesh(mesh, skeleton, meshVertexes, flipV);
 
-		// ܂Őς񂾒_ɃItZbg
+		// 今まで積んだ頂点を基準にオフセット
 		uint32_t baseVertex = static_cast<uint32_t>(vertexes.size());
 
-		// S̃obt@ɒǉ
+		// 全体バッファに追加
 		vertexes.insert(vertexes.end(), meshVertexes.begin(), meshVertexes.end());
 
-		// CfbNXz̃bVǉ
+		// インデックス配列もこのメッシュ分を追加
 		for (unsigned int j = 0; j < mesh->mNumFaces; j++)
 		{
 			const aiFace& face = mesh->mFaces[j];
@@ -749,15 +753,15 @@ void ModelLoader::LoadSkinnedMeshFromFile(MeshFilterComponent* filter, const std
 			indexes.push_back(baseVertex + face.mIndices[2]);
 		}
 
-		// ̃bVǉindex
+		// このメッシュが追加したindex数
 		uint32_t indexCount = (uint32_t)indexes.size() - indexStart;
 
-		// SubMesh o^
+		// SubMesh 登録
 		SubMesh sm{};
 		sm.indexStart = indexStart;
 		sm.indexCount = indexCount;
 		sm.materialSlot = (int)mesh->mMaterialIndex;
-		// indexCount == 0  mesh ̓XLbvOK
+		// indexCount == 0 の mesh はスキップしてOK
 		if (sm.indexCount > 0)
 			filter->AddSubMesh(sm);		
 	}
@@ -768,7 +772,7 @@ void ModelLoader::LoadSkinnedMeshFromFile(MeshFilterComponent* filter, const std
 		return;
 	}
 
-	// ----- VB 쐬 -----
+	// ----- VB 作成 -----
 	D3D11_BUFFER_DESC bd{};
 	bd.Usage = D3D11_USAGE_DEFAULT;
 	bd.ByteWidth = sizeof(VERTEX_SKINNED) * static_cast<UINT>(vertexes.size());
@@ -783,7 +787,7 @@ void ModelLoader::LoadSkinnedMeshFromFile(MeshFilterComponent* filter, const std
 		return;
 	}
 
-	// ----- IB 쐬 -----
+	// ----- IB 作成 -----
 	D3D11_BUFFER_DESC ibd{};
 	ibd.Usage = D3D11_USAGE_DEFAULT;
 	ibd.ByteWidth = sizeof(uint32_t) * static_cast<UINT>(indexes.size());
@@ -799,7 +803,7 @@ void ModelLoader::LoadSkinnedMeshFromFile(MeshFilterComponent* filter, const std
 		return;
 	}
 
-	// MeshFilter ɓn
+	// MeshFilter に渡す
 	filter->SetVertexBuffer(vb, sizeof(VERTEX_SKINNED), static_cast<UINT>(vertexes.size()), 0, true);
 	filter->SetIndexBuffer(ib, static_cast<UINT>(indexes.size()), DXGI_FORMAT_R32_UINT, true);
 	filter->SetTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
@@ -810,8 +814,8 @@ void ModelLoader::LoadSkinnedMeshFromFile(MeshFilterComponent* filter, const std
 	outSrvs.clear();
 	outSrvs.resize(slotCount, nullptr);
 
-	// ----- Texture ̎擾 -----
-	// ft@C̃fBNg擾
+	// ----- Texture の取得 -----
+	// モデルファイルのディレクトリを取得
 	std::filesystem::path modelPath(path);
 	std::filesystem::path modelDir = modelPath.parent_path();
 
@@ -819,7 +823,7 @@ void ModelLoader::LoadSkinnedMeshFromFile(MeshFilterComponent* filter, const std
 	std::unordered_map<std::string, ID3D11ShaderResourceView*> embeddedMap;
 	BuildEmbeddedTextureSRVMap(scene, embeddedMap);
 
-	// }eAXbgɓ
+	// マテリアルスロットに入れる
 	for (int matIndex = 0; matIndex < slotCount; matIndex++)
 	{
 		aiMaterial* mat = scene->mMaterials[matIndex];
@@ -832,20 +836,20 @@ AnimationClip ModelLoader::BuildAnimationClip(const aiScene* scene, const Skelet
 {
 	AnimationClip clip{};
 
-	if (scene->mNumAnimations == 0) return clip; // ̃Nbv
+	if (scene->mNumAnimations == 0) return clip; // 空のクリップ
 	if (animeIndex >= scene->mNumAnimations) return clip;
 
 	const aiAnimation* pAnime = scene->mAnimations[animeIndex];
 
-	// O擾
+	// 名前取得
 	clip.name = pAnime->mName.C_Str();
 
-	float ticksPerSec = (pAnime->mTicksPerSecond != 0.0) ? (float)pAnime->mTicksPerSecond : 30.0f; // KȃftHgli30.0fj
+	float ticksPerSec = (pAnime->mTicksPerSecond != 0.0) ? (float)pAnime->mTicksPerSecond : 30.0f; // 適当なデフォルト値（30.0f）
 
 	clip.ticksPerSecond = ticksPerSec;
-	clip.duration = (float)(pAnime->mDuration / ticksPerSec); // bɕϊ
+	clip.duration = (float)(pAnime->mDuration / ticksPerSec); // 秒に変換する
 
-	//   index }bv
+	// 骨名 → index マップ
 	const std::unordered_map<std::string, int>& boneNameToIndex = skeleton.boneNameToIndex;
 
 	clip.tracks.reserve(pAnime->mNumChannels);
@@ -856,7 +860,7 @@ AnimationClip ModelLoader::BuildAnimationClip(const aiScene* scene, const Skelet
 		std::string nodeName = nodeAnim->mNodeName.C_Str();
 
 		auto it = boneNameToIndex.find(nodeName);
-		if (it == boneNameToIndex.end()) continue; // Skelton ɂȂm[h̓XLbv
+		if (it == boneNameToIndex.end()) continue; // Skelton にないノードはスキップ
 
 		BoneTrack track{};
 		track.boneIndex = it->second;
@@ -867,7 +871,7 @@ AnimationClip ModelLoader::BuildAnimationClip(const aiScene* scene, const Skelet
 		{
 			const auto& k = nodeAnim->mPositionKeys[i];
 			TranslationKey key{};
-			key.time = (float)(k.mTime / ticksPerSec); // b
+			key.time = (float)(k.mTime / ticksPerSec); // 秒
 			key.value = Vector3{
 				k.mValue.x,
 				k.mValue.y,
@@ -881,7 +885,7 @@ AnimationClip ModelLoader::BuildAnimationClip(const aiScene* scene, const Skelet
 		{
 			const auto& k = nodeAnim->mRotationKeys[i];
 			RotationKey key{};
-			key.time = (float)(k.mTime / ticksPerSec); // b
+			key.time = (float)(k.mTime / ticksPerSec); // 秒
 			key.value = Quaternion{
 				k.mValue.x,
 				k.mValue.y,
@@ -896,7 +900,7 @@ AnimationClip ModelLoader::BuildAnimationClip(const aiScene* scene, const Skelet
 		{
 			const auto& k = nodeAnim->mScalingKeys[i];
 			ScaleKey key{};
-			key.time = (float)(k.mTime / ticksPerSec); // b
+			key.time = (float)(k.mTime / ticksPerSec); // 秒
 			key.value = Vector3{
 				k.mValue.x,
 				k.mValue.y,
@@ -918,24 +922,24 @@ AnimationClip ModelLoader::BuildAnimationClipFromFile(const std::string& path, c
 	const aiScene* scene = importer.ReadFile(path,
 											 aiProcess_Triangulate 
 											 //aiProcess_JoinIdenticalVertices |
-											 //aiProcess_ConvertToLeftHanded | // ꂢH
+											 //aiProcess_ConvertToLeftHanded | // これいる？
 											 //aiProcess_SortByPType
 											 //aiProcessPreset_TargetRealtime_MaxQuality
 											);
 	if (!scene)
 	{
 		assert(false && "Assimp load failed");
-		return clip; // g͋̂܂
+		return clip; // 中身は空のまま
 	}
 	if (scene->mNumAnimations == 0)
 	{
-		// AjȂ
+		// アニメなし
 		return clip;
 	}
 	if (animeIndex >= scene->mNumAnimations)
 	{
 		assert(false && "animeIndex out of range");
-		return clip; // g͋̂܂
+		return clip; // 中身は空のまま
 	}
 
 	clip = BuildAnimationClip(scene, skeleton, animeIndex);
@@ -948,34 +952,34 @@ Skeleton ModelLoader::BuildSkeleton(const aiScene* scene)
 	if (!scene || !scene->mRootNode) return skeleton;
 
 
-	// Sm[htbgɍ\z
+	// 全ノードをフラットに構築
 	skeleton.meshToNode.resize(scene->mNumMeshes, -1);
 	BuildNodesRecursive(scene->mRootNode, -1, skeleton);
 
-	// d݂{[W
+	// 重みをもつボーンを収集
 	auto boneMap = CollectBones(scene);
-	// {[P{ȂfȂ̂܂
+	// ボーンが１本もないモデルなら空のまま
 	if (boneMap.empty()) return skeleton;
 
-	// boneName -> boneIndex m
+	// boneName -> boneIndex を確定
 	for (auto& [name, aiBonePtr] : boneMap)
 	{
 		Bone b{};
-		b.name = name; // Oi[
-		b.invBindPose = ToMatrix4x4(aiBonePtr->mOffsetMatrix); // bindPose ̋ts
-		skeleton.boneNameToIndex[name] = (int)skeleton.bones.size(); // Oԍ悤
+		b.name = name; // 名前格納
+		b.invBindPose = ToMatrix4x4(aiBonePtr->mOffsetMatrix); // bindPose の逆行列
+		skeleton.boneNameToIndex[name] = (int)skeleton.bones.size(); // 名前から番号を引けるように
 		skeleton.bones.push_back(b);
 	}
-	// boneIndex -> nodeIndex ̑Ή
+	// boneIndex -> nodeIndex の対応を作る
 	skeleton.boneToNode.resize(skeleton.bones.size(), -1);
 	for (size_t i = 0; i < skeleton.bones.size(); i++)
 	{
-		const std::string& boneName = skeleton.bones[i].name; // {[̖O
+		const std::string& boneName = skeleton.bones[i].name; // ボーンの名前
 
 		auto it = skeleton.nodeNameToIndex.find(boneName);
 		if (it == skeleton.nodeNameToIndex.end())
 		{
-			// Ȃ
+			// 見つからない処理
 			printf("[BuildSkeleton] bone node not found: %s\n", boneName.c_str());
 			skeleton.boneToNode[i] = -1;
 			continue;
@@ -983,13 +987,13 @@ Skeleton ModelLoader::BuildSkeleton(const aiScene* scene)
 
 		skeleton.boneToNode[i] = it->second;
 	}
-	// e{[
+	// 親ボーン解決
 	for (size_t i = 0; i < skeleton.bones.size(); i++)
 	{
 		int nodeIndex = skeleton.boneToNode[i];
 		Bone& bone = skeleton.bones[i];
 
-		if (nodeIndex < 0) // {[ɑΉm[hȂꍇ̏ij
+		if (nodeIndex < 0) // ボーン名に対応するノードが見つからなかった場合の処理（回避策）
 		{
 			bone.parent = -1;
 			bone.bindLocal.identity();
@@ -998,7 +1002,7 @@ Skeleton ModelLoader::BuildSkeleton(const aiScene* scene)
 
 		bone.parent = FindParentBoneIndexByNode(skeleton, nodeIndex);
 
-		// bindLocal ́um[h̃[Jv
+		// bindLocal は「骨ノードのローカル」
 		bone.bindLocal = skeleton.nodes[nodeIndex].bindLocal;
 		ExtractBindTRS(bone.bindLocal, bone.bindT, bone.bindR, bone.bindS);
 	}
@@ -1017,7 +1021,7 @@ Skeleton ModelLoader::BuildSkeleton(const aiScene* scene)
 		skeleton.rootBone = 0;
 	}
 
-	// {[z\[g
+	// ボーン配列をソートする
 	SortBonesParentFirst(skeleton);
 	return skeleton;
 }
@@ -1030,7 +1034,7 @@ Skeleton ModelLoader::BuildSkeletonFromFile(const std::string& path)
 	const aiScene* scene = importer.ReadFile(path,
 											 aiProcess_Triangulate 
 											 //aiProcess_GenNormals |
-											 //aiProcess_ConvertToLeftHanded | // ꂢH
+											 //aiProcess_ConvertToLeftHanded | // これいる？
 											 //aiProcess_CalcTangentSpace |
 											 //aiProcess_JoinIdenticalVertices |
 											 //aiProcess_ImproveCacheLocality |
@@ -1039,9 +1043,89 @@ Skeleton ModelLoader::BuildSkeletonFromFile(const std::string& path)
 	if (!scene || !scene->HasMeshes())
 	{
 		assert(false && "Assimp load failed or no mesh");
-		return skeleton; // g͋̂܂
+		return skeleton; // 中身は空のまま
 	}
 
 	skeleton = BuildSkeleton(scene);
 	return skeleton;
 }
+
+// --------------------------------------------------
+// 当たり判定用の三角形メッシュ（BVH）を読む
+// 描画用と同じくメッシュの頂点をそのまま使う（ノードの Transform は掛けない）
+// 一度作ったらパスごとに共有する
+// --------------------------------------------------
+std::shared_ptr<const TriangleMeshBVH> ModelLoader::LoadCollisionMeshFromFile(const std::string& path)
+{
+	auto it = s_CollisionMeshPool.find(path);
+	if (it != s_CollisionMeshPool.end()) return it->second;
+
+	Assimp::Importer importer;
+	const aiScene* scene = importer.ReadFile(path.c_str(),
+											 aiProcess_Triangulate |
+											 aiProcess_JoinIdenticalVertices
+											);
+	if (!scene || !scene->HasMeshes())
+	{
+		assert(false && "Assimp load failed or no mesh");
+		return nullptr;
+	}
+
+	// ----- 全メッシュの頂点とインデックスを１つにまとめる -----
+	std::vector<Vector3> vertices;
+	std::vector<uint32_t> indices;
+	for (unsigned int i = 0; i < scene->mNumMeshes; i++)
+	{
+		const aiMesh* mesh = scene->mMeshes[i];
+		if (!mesh) continue;
+
+		// 今まで積んだ頂点を基準にオフセット
+		const uint32_t baseVertex = static_cast<uint32_t>(vertices.size());
+		for (unsigned int v = 0; v < mesh->mNumVertices; v++)
+			vertices.push_back({ mesh->mVertices[v].x, mesh->mVertices[v].y, mesh->mVertices[v].z });
+
+		for (unsigned int f = 0; f < mesh->mNumFaces; f++)
+		{
+			const aiFace& face = mesh->mFaces[f];
+			if (face.mNumIndices != 3) continue; // 点や線は当たり判定に使わない
+			indices.push_back(baseVertex + face.mIndices[0]);
+			indices.push_back(baseVertex + face.mIndices[1]);
+			indices.push_back(baseVertex + face.mIndices[2]);
+		}
+	}
+
+	auto bvh = std::make_shared<const TriangleMeshBVH>(std::move(vertices), std::move(indices));
+	s_CollisionMeshPool[path] = bvh;
+	return bvh;
+}
+
+// --------------------------------------------------
+// 当たり判定用の凸包を読む（全メッシュの頂点を包む）
+// 一度作ったらパスごとに共有する
+// --------------------------------------------------
+std::shared_ptr<const ConvexHull> ModelLoader::LoadConvexHullFromFile(const std::string& path)
+{
+	auto it = s_ConvexHullPool.find(path);
+	if (it != s_ConvexHullPool.end()) return it->second;
+
+	Assimp::Importer importer;
+	const aiScene* scene = importer.ReadFile(path.c_str(), aiProcess_JoinIdenticalVertices);
+	if (!scene || !scene->HasMeshes())
+	{
+		assert(false && "Assimp load failed or no mesh");
+		return nullptr;
+	}
+
+	std::vector<Vector3> points;
+	for (unsigned int i = 0; i < scene->mNumMeshes; i++)
+	{
+		const aiMesh* mesh = scene->mMeshes[i];
+		if (!mesh) continue;
+		for (unsigned int v = 0; v < mesh->mNumVertices; v++)
+			points.push_back({ mesh->mVertices[v].x, mesh->mVertices[v].y, mesh->mVertices[v].z });
+	}
+
+	auto hull = std::make_shared<const ConvexHull>(points);
+	s_ConvexHullPool[path] = hull;
+	return hull;
+}
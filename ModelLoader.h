@@ -1,7 +1,7 @@
 /*
 	ModelLoader.h
 	20251212  hanaue sho
-	assimp ɂ郂f[_[
+	assimp によるモデルローダー
 */
 #ifndef MODELLOADER_H_
 #define MODELLOADER_H_
@@ -9,17 +9,19 @@
 #include <string>
 #include <vector>
 #include <unordered_map>
-#include "assimp/scene.h"	    // assimp ̒ԕ\̍\̒`
-#include "assimp/postprocess.h" // |XgvZXtO̒`
-#include "assimp/Importer.hpp"  // Impoeterp
+#include "assimp/scene.h"	    // assimp の中間表現の構造体定義
+#include "assimp/postprocess.h" // ポストプロセスフラグの定義
+#include "assimp/Importer.hpp"  // Impoeter専用
 #include "Matrix4x4.h"
 #include "Quaternion.h"
 
 class MeshFilterComponent;
 class ID3D11ShaderResourceView;
 struct AnimationClip;
+class TriangleMeshBVH;
+class ConvexHull;
 
-// m[h
+// ノード
 struct Node
 {
 	std::string name;
@@ -27,31 +29,31 @@ struct Node
 	Matrix4x4 bindLocal;
 };
 
-// {[
+// ボーン
 struct Bone
 {
-	int parent; // eCfbNXiȂ -1j
+	int parent; // 親インデックス（なければ -1）
 	std::string name;
-	Matrix4x4 bindLocal;   // oCh|[Ỹ[J Transform
-	Matrix4x4 invBindPose; // toCh|[Yimeshԁ{[ԁj
-	Vector3 bindT;    // ʒuoCh
-	Quaternion bindR; // ]oCh
-	Vector3 bindS;	  // XP[oCh
+	Matrix4x4 bindLocal;   // バインドポーズ時のローカル Transform
+	Matrix4x4 invBindPose; // 逆バインドポーズ（mesh空間→ボーン空間）
+	Vector3 bindT;    // 位置バインド
+	Quaternion bindR; // 回転バインド
+	Vector3 bindS;	  // スケールバインド
 };
 
-// XPg
+// スケルトン
 struct Skeleton
 {
-	std::vector<Bone> bones; // {[z
-	std::vector<Node> nodes; // m[hz
+	std::vector<Bone> bones; // ボーン配列
+	std::vector<Node> nodes; // ノード配列
 
-	// ϊp
-	std::unordered_map < std::string, int> nodeNameToIndex; // m[h̖OCfbNXi[
-	std::unordered_map < std::string, int> boneNameToIndex; // {[̖OCfbNXi[
+	// 変換用
+	std::unordered_map < std::string, int> nodeNameToIndex; // ノードの名前からインデックスを格納
+	std::unordered_map < std::string, int> boneNameToIndex; // ボーンの名前からインデックスを格納
 	std::vector<int> boneToNode; // boneIndex -> nodeIndex
 	std::vector<int> meshToNode; // mesh -> node
 
-	// [g{[CfbNX
+	// ルートボーンインデックス
 	int rootBone = -1;
 };
 
@@ -65,6 +67,8 @@ class ModelLoader
 {
 private:
 	static std::unordered_map<std::string, std::shared_ptr<ModelResource>> s_ModelPool;
+	static std::unordered_map<std::string, std::shared_ptr<const TriangleMeshBVH>> s_CollisionMeshPool; // 当たり判定用（同じパスなら共有）
+	static std::unordered_map<std::string, std::shared_ptr<const ConvexHull>> s_ConvexHullPool; // 当たり判定用（同じパスなら共有）
 public:
 	static void LoadMeshFromFile(MeshFilterComponent* filter, const std::string& path, std::vector<ID3D11ShaderResourceView*>& outSrvs, bool flipV);
 	static void LoadSkinnedMeshFromFile(MeshFilterComponent* filter, const std::string& path, const Skeleton& skeleton, std::vector<ID3D11ShaderResourceView*>& outSrvs, bool flipV = false);
@@ -72,6 +76,8 @@ public:
 	static AnimationClip BuildAnimationClipFromFile(const std::string& path, const Skeleton& skeleton, unsigned int animeIndex);
 	static Skeleton BuildSkeleton(const aiScene* scene);
 	static Skeleton BuildSkeletonFromFile(const std::string& path);
+	static std::shared_ptr<const TriangleMeshBVH> LoadCollisionMeshFromFile(const std::string& path);
+	static std::shared_ptr<const ConvexHull> LoadConvexHullFromFile(const std::string& path);
 };
 
 #endif
\ No newline at end of file
@@ -77,11 +77,11 @@ void ModelObject::Init()
 	// MeshRenderer
 	auto* mr = AddComponent<MeshRendererComponent>();
 
-	// Slot 
+	// Slot 数
 	const int slotCount = mf->MaterialSlotCount();
 	mr->ResizeMaterialSlots(slotCount);
 
-	// ʃVF[_[
+	// 共通シェーダー
 	ID3D11VertexShader* vs = nullptr;
 	ID3D11PixelShader* ps = nullptr;
 	ID3D11InputLayout* il = nullptr;
@@ -89,20 +89,20 @@ void ModelObject::Init()
 	//Renderer::CreateVertexShader(&vs, &il, "shader\\VS_Lit.cso", Renderer::VertexLayoutType::Basic);
 	Renderer::CreatePixelShader(&ps, "shader\\PS_Toon.cso");
 
-	// ʃ}eA萔
+	// 共通マテリアル定数
 	MaterialApp m{};
 	m.diffuse = Vector4(1, 1, 1, 1);
 	m.ambient = Vector4(1, 1, 1, 1);
 	m.textureEnable = true;
 
-	// ꎞIɃeNX`ݒ -----
+	// 一時的にテクスチャを設定 -----
 	auto* mat = AddComponent<MaterialComponent>();
 	mat->SetVSPS(vs, ps, il, /*takeVS*/true, /*takePS*/true, /*takeIL*/true);
 	ID3D11ShaderResourceView* srv = Texture::LoadAndRegisterKey("assets\\texture\\whiteTexture.png");
 	mat->SetMainTexture(srv, /*sampler*/nullptr, /*takeSrv*/false, /*takeSamp*/false);
 
 
-	// slot Ƃ MaterialComponent  srv h
+	// slot ごとに MaterialComponent を作って srv を刺す
 	for (int slot = 0; slot < slotCount; slot++)
 	{
 		auto* mat = AddComponent<MaterialComponent>();
@@ -112,7 +112,7 @@ void ModelObject::Init()
 		ID3D11ShaderResourceView* srv = nullptr;
 		if (slot < (int)srvs.size()) srv = srvs[slot];
 
-		//srv = Texture::LoadAndRegisterKey("assets\\texture\\whiteTexture.png"); // fobOŃoOł΂
+		//srv = Texture::LoadAndRegisterKey("assets\\texture\\whiteTexture.png"); // デバッグでバグでばっぐ
 
 		mat->SetMainTexture(srv, nullptr);
 
@@ -124,7 +124,7 @@ void ModelObject::Init()
 	if (slotCount > 0)
 		mr->SetBaseMaterial(mr->GetMaterialSlot(0));
 
-	// AEgC}eAǉ
+	// アウトラインマテリアル追加
 	auto* matOutline = AddComponent<MaterialComponent>();
 	Renderer::CreateVertexShader(&vs, &il, "shader\\VS_SkinnedOutline.cso", Renderer::VertexLayoutType::Skinned);
 	Renderer::CreatePixelShader(&ps, "shader\\PS_Outline.cso");
@@ -18,28 +18,28 @@ std::unordered_map<std::string, MODEL*> ModelRenderer::m_ModelPool;
 void ModelRenderer::Draw()
 {
 
-	// _obt@ݒ
+	// 頂点バッファ設定
 	UINT stride = sizeof(VERTEX_3D);
 	UINT offset = 0;
 	Renderer::DeviceContext()->IASetVertexBuffers(0, 1, &m_Model->VertexBuffer, &stride, &offset);
 
-	// CfbNXobt@ݒ
+	// インデックスバッファ設定
 	Renderer::DeviceContext()->IASetIndexBuffer(m_Model->IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
 
-	// v~eBug|Wݒ
+	// プリミティブトポロジ設定
 	Renderer::DeviceContext()->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
 
 	for( unsigned int i = 0; i < m_Model->SubsetNum; i++ )
 	{
-		// }eAݒ
+		// マテリアル設定
 		Renderer::SetMaterial(m_Model->SubsetArray[i].Material.Material );
 
-		// eNX`ݒ
+		// テクスチャ設定
 		if(m_Model->SubsetArray[i].Material.Texture)
 			Renderer::DeviceContext()->PSSetShaderResources( 0, 1, &m_Model->SubsetArray[i].Material.Texture );
 
-		// |S`
+		// ポリゴン描画
 		Renderer::DeviceContext()->DrawIndexed(m_Model->SubsetArray[i].IndexNum, m_Model->SubsetArray[i].StartIndex, 0 );
 	}
 
@@ -105,7 +105,7 @@ void ModelRenderer::LoadModel( const char *FileName, MODEL *Model)
 
 
 
-	// _obt@
+	// 頂点バッファ生成
 	{
 		D3D11_BUFFER_DESC bd;
 		ZeroMemory( &bd, sizeof(bd) );
@@ -122,7 +122,7 @@ void ModelRenderer::LoadModel( const char *FileName, MODEL *Model)
 	}
 
 
-	// CfbNXobt@
+	// インデックスバッファ生成
 	{
 		D3D11_BUFFER_DESC bd;
 		ZeroMemory( &bd, sizeof(bd) );
@@ -138,7 +138,7 @@ void ModelRenderer::LoadModel( const char *FileName, MODEL *Model)
 		Renderer::Device()->CreateBuffer( &bd, &sd, &Model->IndexBuffer );
 	}
 
-	// TuZbgݒ
+	// サブセット設定
 	{
 		Model->SubsetArray = new SUBSET[ modelObj.SubsetNum ];
 		Model->SubsetNum = modelObj.SubsetNum;
@@ -152,7 +152,7 @@ void ModelRenderer::LoadModel( const char *FileName, MODEL *Model)
 
 			Model->SubsetArray[i].Material.Texture = nullptr;
 
-			// eNX`ǂݍ
+			// テクスチャ読み込み
 			TexMetadata metadata;
 			ScratchImage image;
 			wchar_t wc[256];
@@ -174,7 +174,7 @@ void ModelRenderer::LoadModel( const char *FileName, MODEL *Model)
 
 }
 
-//fǍ////////////////////////////////////////////
+//モデル読込////////////////////////////////////////////
 void ModelRenderer::LoadObj( const char *FileName, MODEL_OBJ *ModelObj )
 {
 
@@ -212,7 +212,7 @@ void ModelRenderer::LoadObj( const char *FileName, MODEL_OBJ *ModelObj )
 
 
 
-	//vfJEg
+	//要素数カウント
 	while( true )
 	{
 		fscanf( file, "%s", str );
@@ -249,7 +249,7 @@ void ModelRenderer::LoadObj( const char *FileName, MODEL_OBJ *ModelObj )
 			}
 			while( c != '\n' && c!= '\r' );
 
-			//lp͎Opɕ
+			//四角は三角に分割
 			if( in == 4 )
 				in = 6;
 
@@ -258,7 +258,7 @@ void ModelRenderer::LoadObj( const char *FileName, MODEL_OBJ *ModelObj )
 	}
 
 
-	//m
+	//メモリ確保
 	positionArray = new Vector3[ positionNum ];
 	normalArray   = new Vector3[ normalNum ];
 	texcoordArray = new Vector2[ texcoordNum ];
@@ -276,7 +276,7 @@ void ModelRenderer::LoadObj( const char *FileName, MODEL_OBJ *ModelObj )
 
 
 
-	//vfǍ
+	//要素読込
 	Vector3 *position = positionArray;
 	Vector3 *normal = normalArray;
 	Vector2 *texcoord = texcoordArray;
@@ -297,7 +297,7 @@ void ModelRenderer::LoadObj( const char *FileName, MODEL_OBJ *ModelObj )
 
 		if( strcmp( str, "mtllib" ) == 0 )
 		{
-			//}eAt@C
+			//マテリアルファイル
 			fscanf( file, "%s", str );
 
 			char path[256];
@@ -309,12 +309,12 @@ void ModelRenderer::LoadObj( const char *FileName, MODEL_OBJ *ModelObj )
 		}
 		else if( strcmp( str, "o" ) == 0 )
 		{
-			//IuWFNg
+			//オブジェクト名
 			fscanf( file, "%s", str );
 		}
 		else if( strcmp( str, "v" ) == 0 )
 		{
-			//_W
+			//頂点座標
 			fscanf( file, "%f", &position->x );
 			fscanf( file, "%f", &position->y );
 			fscanf( file, "%f", &position->z );
@@ -322,7 +322,7 @@ void ModelRenderer::LoadObj( const char *FileName, MODEL_OBJ *ModelObj )
 		}
 		else if( strcmp( str, "vn" ) == 0 )
 		{
-			//@
+			//法線
 			fscanf( file, "%f", &normal->x );
 			fscanf( file, "%f", &normal->y );
 			fscanf( file, "%f", &normal->z );
@@ -330,7 +330,7 @@ void ModelRenderer::LoadObj( const char *FileName, MODEL_OBJ *ModelObj )
 		}
 		else if( strcmp( str, "vt" ) == 0 )
 		{
-			//eNX`W
+			//テクスチャ座標
 			fscanf( file, "%f", &texcoord->x );
 			fscanf( file, "%f", &texcoord->y );
 			texcoord->x = 1.0f - texcoord->x;
@@ -339,7 +339,7 @@ void ModelRenderer::LoadObj( const char *FileName, MODEL_OBJ *ModelObj )
 		}
 		else if( strcmp( str, "usemtl" ) == 0 )
 		{
-			//}eA
+			//マテリアル
 			fscanf( file, "%s", str );
 
 			if( sc != 0 )
@@ -365,7 +365,7 @@ void ModelRenderer::LoadObj( const char *FileName, MODEL_OBJ *ModelObj )
 		}
 		else if( strcmp( str, "f" ) == 0 )
 		{
-			//
+			//面
 			in = 0;
 
 			do
@@ -376,7 +376,7 @@ void ModelRenderer::LoadObj( const char *FileName, MODEL_OBJ *ModelObj )
 				ModelObj->VertexArray[vc].position = positionArray[ atoi( s ) - 1 ];
 				if( s[ strlen( s ) + 1 ] != '/' )
 				{
-					//eNX`W݂Ȃꍇ
+					//テクスチャ座標が存在しない場合もある
 					s = strtok( nullptr, "/" );
 					ModelObj->VertexArray[vc].texcoord = texcoordArray[ atoi( s ) - 1 ];
 				}
@@ -394,7 +394,7 @@ void ModelRenderer::LoadObj( const char *FileName, MODEL_OBJ *ModelObj )
 			}
 			while( c != '\n' && c != '\r' );
 
-			//lp͎Opɕ
+			//四角は三角に分割
 			if( in == 4 )
 			{
 				ModelObj->IndexArray[ic] = vc - 4;
@@ -419,7 +419,7 @@ void ModelRenderer::LoadObj( const char *FileName, MODEL_OBJ *ModelObj )
 	delete[] materialArray;
 }
 
-//}eAǂݍ///////////////////////////////////////////////////////////////////
+//マテリアル読み込み///////////////////////////////////////////////////////////////////
 void ModelRenderer::LoadMaterial( const char *FileName, MODEL_MATERIAL **MaterialArray, unsigned int *MaterialNum )
 {
 
@@ -438,7 +438,7 @@ void ModelRenderer::LoadMaterial( const char *FileName, MODEL_MATERIAL **Materia
 	MODEL_MATERIAL *materialArray;
 	unsigned int materialNum = 0;
 
-	//vfJEg
+	//要素数カウント
 	while( true )
 	{
 		fscanf( file, "%s", str );
@@ -454,11 +454,11 @@ void ModelRenderer::LoadMaterial( const char *FileName, MODEL_MATERIAL **Materia
 	}
 
 
-	//m
+	//メモリ確保
 	materialArray = new MODEL_MATERIAL[ materialNum ];
 
 
-	//vfǍ
+	//要素読込
 	int mc = -1;
 
 	fseek( file, 0, SEEK_SET );
@@ -473,7 +473,7 @@ void ModelRenderer::LoadMaterial( const char *FileName, MODEL_MATERIAL **Materia
 
 		if( strcmp( str, "newmtl" ) == 0 )
 		{
-			//}eA
+			//マテリアル名
 			mc++;
 			fscanf( file, "%s", materialArray[ mc ].Name );
 			strcpy( materialArray[ mc ].TextureName, "" );
@@ -485,7 +485,7 @@ void ModelRenderer::LoadMaterial( const char *FileName, MODEL_MATERIAL **Materia
 		}
 		else if( strcmp( str, "Ka" ) == 0 )
 		{
-			//ArGg
+			//アンビエント
 			fscanf( file, "%f", &materialArray[ mc ].Material.ambient.x );
 			fscanf( file, "%f", &materialArray[ mc ].Material.ambient.y );
 			fscanf( file, "%f", &materialArray[ mc ].Material.ambient.z );
@@ -493,7 +493,7 @@ void ModelRenderer::LoadMaterial( const char *FileName, MODEL_MATERIAL **Materia
 		}
 		else if( strcmp( str, "Kd" ) == 0 )
 		{
-			//fBt[Y
+			//ディフューズ
 			fscanf( file, "%f", &materialArray[ mc ].Material.diffuse.x );
 			fscanf( file, "%f", &materialArray[ mc ].Material.diffuse.y );
 			fscanf( file, "%f", &materialArray[ mc ].Material.diffuse.z );
@@ -501,7 +501,7 @@ void ModelRenderer::LoadMaterial( const char *FileName, MODEL_MATERIAL **Materia
 		}
 		else if( strcmp( str, "Ks" ) == 0 )
 		{
-			//XyL
+			//スペキュラ
 			fscanf( file, "%f", &materialArray[ mc ].Material.specular.x );
 			fscanf( file, "%f", &materialArray[ mc ].Material.specular.y );
 			fscanf( file, "%f", &materialArray[ mc ].Material.specular.z );
@@ -509,17 +509,17 @@ void ModelRenderer::LoadMaterial( const char *FileName, MODEL_MATERIAL **Materia
 		}
 		else if( strcmp( str, "Ns" ) == 0 )
 		{
-			//XyLx
+			//スペキュラ強度
 			fscanf( file, "%f", &materialArray[ mc ].Material.shininess );
 		}
 		else if( strcmp( str, "d" ) == 0 )
 		{
-			//At@
+			//アルファ
 			fscanf( file, "%f", &materialArray[ mc ].Material.diffuse.w );
 		}
 		else if( strcmp( str, "map_Kd" ) == 0 )
 		{
-			//eNX`
+			//テクスチャ
 			fscanf( file, "%s", str );
 
 			char path[256];
@@ -2,7 +2,7 @@
 
 
 
-// }eA\
+// マテリアル構造体
 struct MODEL_MATERIAL
 {
 	char						Name[256];
@@ -13,7 +13,7 @@ struct MODEL_MATERIAL
 };
 
 
-// `TuZbg\
+// 描画サブセット構造体
 struct SUBSET
 {
 	unsigned int	StartIndex;
@@ -22,7 +22,7 @@ struct SUBSET
 };
 
 
-// f\
+// モデル構造体
 struct MODEL_OBJ
 {
 	VERTEX_3D		*VertexArray;
@@ -1,11 +1,11 @@
 //--------------------------------------------------------------------------------------
 // File: mouse.cpp
 //
-// ֗ȃ}EXW[
+// 便利なマウスモジュール
 //
 //--------------------------------------------------------------------------------------
 // 2020/02/11
-//     DirectXTKAȂ񂿂CpɃVFCvAbv
+//     DirectXTKより、なんちゃってC言語用にシェイプアップ改変
 //
 // Licensed under the MIT License.
 //
@@ -183,7 +183,7 @@ void Mouse_ProcessMessage(UINT message, WPARAM wParam, LPARAM lParam)
         point.x = gLastX;
         point.y = gLastY;
 
-        // [gfBXNgbvɑΉ邽߂ɈړOɃJ[\\
+        // リモートディスクトップに対応するために移動前にカーソルを表示する
         ShowCursor(TRUE);
 
         if (MapWindowPoints(gWindow, nullptr, &point, 1)) {
@@ -255,7 +255,7 @@ void Mouse_ProcessMessage(UINT message, WPARAM wParam, LPARAM lParam)
                 }
                 else if (raw.data.mouse.usFlags & MOUSE_VIRTUAL_DESKTOP) {
 
-                    // [gfBXNgbvȂǂɑΉ
+                    // リモートディスクトップなどに対応
                     const int width = GetSystemMetrics(SM_CXVIRTUALSCREEN);
                     const int height = GetSystemMetrics(SM_CYVIRTUALSCREEN);
 
@@ -341,13 +341,13 @@ void Mouse_ProcessMessage(UINT message, WPARAM wParam, LPARAM lParam)
         break;
 
     default:
-        // }EXɑ΂郁bZ[W͖c
+        // マウスに対するメッセージは無かった…
         return;
     }
 
     if (gMode == MOUSE_POSITION_MODE_ABSOLUTE) {
 
-        // ׂẴ}EXbZ[Wɑ΂ĐVW擾
+        // すべてのマウスメッセージに対して新しい座標を取得する
         int xPos = GET_X_LPARAM(lParam);
         int yPos = GET_Y_LPARAM(lParam);
 
@@ -357,18 +357,18 @@ void Mouse_ProcessMessage(UINT message, WPARAM wParam, LPARAM lParam)
 }
 
 
-// -------------------------------------------------- ǉ
-// Ȃ͋@\ȂH
+// -------------------------------------------------- 追加分
+// なぜかこいつは機能しない？
 void MouseUpdate()
 {
-    if (Mouse_IsConnected()) // Z[t
+    if (Mouse_IsConnected()) // セーフ
     {
         Mouse_KeyCopy();
     }
 }
 
 // --------------------------------------------------
-// NbNĂ
+// クリックをしている間
 // --------------------------------------------------
 bool Mouse_IsClick(MOUSE_KEY key)
 {
@@ -380,13 +380,13 @@ bool Mouse_IsClick(MOUSE_KEY key, const Mouse_State* pState)
     if (key <= 0x0004)
     {
         unsigned int* p = (unsigned int*)pState;
-        return (p[0] & key) != 0; // ݂ state ƃL[̃R[h ANDZ
+        return (p[0] & key) != 0; // 現在の state とキーのコードを AND演算する
     }
     return false;
 }
 
 // --------------------------------------------------
-// NbN߂Ƃ
+// クリックをやめたとき
 // --------------------------------------------------
 bool Mouse_IsClickUp(MOUSE_KEY key)
 {
@@ -400,13 +400,13 @@ bool Mouse_IsClickUp(MOUSE_KEY key, const Mouse_State* pState)
         unsigned int* p = (unsigned int*)pState;
         unsigned int* pOld = (unsigned int*)&g_StateOld;
 
-        return ((p[0] & key) == 0) && ((pOld[0] & key) != 0); // ݗĂāAPt[O͉Ă
+        return ((p[0] & key) == 0) && ((pOld[0] & key) != 0); // 現在離されていて、１フレーム前は押されていた
     }
     return false;
 }
 
 // --------------------------------------------------
-// NbNƂ
+// クリックをしたときだけ
 // --------------------------------------------------
 bool Mouse_IsClickTrigger(MOUSE_KEY key)
 {
@@ -446,14 +446,14 @@ XMFLOAT2 Mouse_GetPositionDiff()
 }
 
 // --------------------------------------------------
-// }EXXWԂ
+// マウスのX座標を返す
 // --------------------------------------------------
 int Mouse_GetPositionX()
 {
     return g_State.x;
 }
 // --------------------------------------------------
-// }XEYWԂ
+// マスウのY座標を返す
 // --------------------------------------------------
 int Mouse_GetPositionY()
 {
@@ -461,14 +461,14 @@ int Mouse_GetPositionY()
 }
 
 // --------------------------------------------------
-// }EXzC[̉]Ԃ
-// ̃t[̃}EXzC[̒l̐ԂB
-// t[lOɂ                            ----------isN炻̎ɑΉj
+// マウスホイールの回転を返す
+// そのフレームのマウスホイールの値の正負を返す。
+// 毎フレーム値を０にする                            ----------（不具合が起きたらその時に対応）
 // 
-// ԂlF
-// @F{P
-// @F|P
-// @񂵂ĂȂFO
+// 返り値：
+// 　上：＋１
+// 　下：－１
+// 　回してない：０
 // --------------------------------------------------
 int Mouse_GetWheelScroll()
 {
@@ -485,7 +485,7 @@ int Mouse_GetWheelScroll()
 }
 
 // --------------------------------------------------
-// }EXzC[̒lԂ
+// マウスホイールの値を返す
 // --------------------------------------------------
 int Mouse_GetWheelValue()
 {
@@ -493,7 +493,7 @@ int Mouse_GetWheelValue()
 }
 
 // --------------------------------------------------
-// }EX State ̋L^
+// マウスの State の記録
 // --------------------------------------------------
 void Mouse_KeyCopy()
 {
@@ -56,24 +56,24 @@ void NorenObject::Init()
 	// MeshRenderer
 	auto* mr = AddComponent<MeshRendererComponent>();
 
-	// Slot 
+	// Slot 数
 	const int slotCount = mf->MaterialSlotCount();
 	mr->ResizeMaterialSlots(slotCount);
 
-	// ʃVF[_[
+	// 共通シェーダー
 	ID3D11VertexShader* vs = nullptr;
 	ID3D11PixelShader* ps = nullptr;
 	ID3D11InputLayout* il = nullptr;
 	Renderer::CreateVertexShader(&vs, &il, "shader\\VS_Skinned.cso", Renderer::VertexLayoutType::Skinned);
 	Renderer::CreatePixelShader(&ps, "shader\\PS_Toon.cso");
 
-	// ʃ}eA萔
+	// 共通マテリアル定数
 	MaterialApp m{};
 	m.diffuse = Vector4(1, 1, 1, 1);
 	m.ambient = Vector4(1, 1, 1, 1);
 	m.textureEnable = true;
 
-	// slot Ƃ MaterialComponent  srv h
+	// slot ごとに MaterialComponent を作って srv を刺す
 	for (int slot = 0; slot < slotCount; slot++)
 	{
 		auto* mat = AddComponent<MaterialComponent>();
@@ -93,7 +93,7 @@ void NorenObject::Init()
 	if (slotCount > 0)
 		mr->SetBaseMaterial(mr->GetMaterialSlot(0));
 
-	// AEgC}eAǉ
+	// アウトラインマテリアル追加
 	//auto* matOutline = AddComponent<MaterialComponent>();
 	//Renderer::CreateVertexShader(&vs, &il, "shader\\VS_SkinnedOutline.cso", Renderer::VertexLayoutType::Skinned);
 	//Renderer::CreatePixelShader(&ps, "shader\\PS_Outline.cso");
@@ -113,7 +113,7 @@ void NorenObject::Update(float dt)
 {
 	GameObject::Update(dt);
 
-	// ----- Aj[VĐ -----
+	// ----- アニメーション再生 -----
 	auto* animator = GetComponent<AnimatorComponent>();
 	auto* provider = GetComponent<SkinMatrixProviderComponent>();
 	if (m_pProvider->IsAniamtion())
@@ -135,11 +135,11 @@ void NorenObject::SetupBones()
 {
 	auto* animator = GetComponent<AnimatorComponent>();
 
-	// ܂͍̈ʒu𑵂
+	// まずは骨の位置を揃える
 	animator->EvaluateNow();
 	m_pBoneManager->UpdateFromAnimator(animator->ModelMatrixes(), nullptr);
 
-	// ̐ݒ
+	// 骨の設定
 	const int indexRoot0 = 0;
 	const int indexBone00 = 1;
 	const int indexBone02 = 3;
@@ -153,7 +153,7 @@ void NorenObject::SetupBones()
 	const int indexBone30 = 13;
 	const int indexBone32 = 15;
 
-	// c̃WCg
+	// 縦のジョイント
 	for (int num = 0; num < 4; num++)// RootBone0 .. 3
 	{
 		const int indexRoot = indexRoot0 + 4 * num;
@@ -169,28 +169,28 @@ void NorenObject::SetupBones()
 			if (i == indexRoot + 2) { coll->SetSphere(0.4f); coll->SetOffsetPosition({ 0, 0.0f, 0.0f }); }
 			if (i == indexRoot + 3) { coll->SetSphere(0.4f); coll->SetOffsetPosition({ 0, 0.0f, 0.0f }); }
 		}
-		for (int i = indexRoot; i < indexRoot + 3; i++) // WCgݒ
+		for (int i = indexRoot; i < indexRoot + 3; i++) // ジョイント設定
 		{
 			auto* bone = m_pBoneManager->GetBoneObject(i);
 			if (i % 4 == 0)
 			{
 				auto* joint = bone->AddComponent<BallJointComponent>();
 				joint->SetOtherObject(m_pBoneManager->GetBoneObject(i + 1));
-				joint->SetLocalAnchorA({ 0, -0.2f, 0 }); // {[
-				joint->SetLocalAnchorB({ 0, -0.5f, 0 }); // {[
+				joint->SetLocalAnchorA({ 0, -0.2f, 0 }); // 上向きボーン
+				joint->SetLocalAnchorB({ 0, -0.5f, 0 }); // 下向きボーン
 				joint->RegisterToPhysicsSystem();
 			}
 			else
 			{
 				auto* joint = bone->AddComponent<BallJointComponent>();
 				joint->SetOtherObject(m_pBoneManager->GetBoneObject(i + 1));
-				joint->SetLocalAnchorA({ 0,  0.5f, 0 }); // {[
-				joint->SetLocalAnchorB({ 0, -0.5f, 0 }); // {[
+				joint->SetLocalAnchorA({ 0,  0.5f, 0 }); // 下向きボーン
+				joint->SetLocalAnchorB({ 0, -0.5f, 0 }); // 下向きボーン
 				joint->RegisterToPhysicsSystem();
 			}
 		}
 	}
-	// ̃WCg
+	// 横のジョイント
 	for (int num = 0; num < 3; num++)
 	{
 		const int indexBone = indexBone00 + 4 * num;
@@ -199,8 +199,8 @@ void NorenObject::SetupBones()
 			auto* bone = m_pBoneManager->GetBoneObject(i);
 			auto* joint = bone->AddComponent<BallJointComponent>();
 			joint->SetOtherObject(m_pBoneManager->GetBoneObject(i + 4));
-			joint->SetLocalAnchorA({ 0.0f,  0.0f, 0.5f }); // {[
-			joint->SetLocalAnchorB({ 0.0f,  0.0f, -0.5f }); // {[
+			joint->SetLocalAnchorA({ 0.0f,  0.0f, 0.5f }); // 下向きボーン
+			joint->SetLocalAnchorB({ 0.0f,  0.0f, -0.5f }); // 下向きボーン
 			joint->RegisterToPhysicsSystem();
 		}
 	}
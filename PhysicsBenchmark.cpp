@@ -0,0 +1,1245 @@
+/*
+	PhysicsBenchmark.cpp
+	20261017  hanaue sho
+	物理演算のベンチマーク（ウィンドウ、描画、アセット無しで回す）
+*/
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "PhysicsBenchmark.h"
+#include "Manager.h"
+#include "scene.h"
+#include "PhysicsSystem.h"
+#include "GameObject.h"
+#include "TransformComponent.h"
+#include "ColliderComponent.h"
+#include "RigidbodyComponent.h"
+#include "collision.h"
+#include "ColliderPose.h"
+#include "ConvexHull.h"
+#include "ContactManifold.h"
+#include "DynamicAABBTree.h"
+#include "ShapeDispatch.h"
+#include "SimdKernels.h"
+#include "Triangle.h"
+#include "BallJointComponent.h"
+#include "HingeJointComponent.h"
+
+namespace
+{
+	const float FixedDt = 1.0f / 60.0f;
+	const int	SettleWindow = 60;	   // 安定性を見るステップ数（最後の 1 秒）
+	const float LostHeight = -20.0f;   // これより下に落ちたら抜けたとみなす
+
+	// ==================================================
+	// ----- ベンチマーク用のシーン -----
+	// テクスチャの読み込みやライトを持たない（物理だけ作る）
+	// ==================================================
+	class BenchScene : public Scene
+	{
+	public:
+		void Init() override
+		{
+			m_pPhysicsSystem.reset(new PhysicsSystem(*this));
+			m_pPhysicsSystem->Init();
+		}
+
+		// --------------------------------------------------
+		// 物を置く
+		// --------------------------------------------------
+		GameObject* AddBody(const Vector3& pos, bool dynamic, float mass = 1.0f)
+		{
+			GameObject* go = AddGameObject<GameObject>(0);
+			go->Transform()->SetPosition(pos);
+			go->SetPhysicsLayer(1);
+			Collider* coll = go->AddComponent<Collider>();
+			coll->SetModeSimulate();
+			Rigidbody* rigid = go->AddComponent<Rigidbody>();
+			if (dynamic) rigid->SetMass(mass);
+			else		 rigid->SetBodyTypeStatic();
+			return go;
+		}
+		GameObject* AddBox(const Vector3& pos, const Vector3& half, bool dynamic, float mass = 1.0f)
+		{
+			GameObject* go = AddBody(pos, dynamic, mass);
+			go->GetComponent<Collider>()->SetBox(half);
+			go->GetComponent<Rigidbody>()->ComputeBoxInertia(half);
+			return go;
+		}
+		GameObject* AddSphere(const Vector3& pos, float radius, bool dynamic, float mass = 1.0f)
+		{
+			GameObject* go = AddBody(pos, dynamic, mass);
+			go->GetComponent<Collider>()->SetSphere(radius);
+			go->GetComponent<Rigidbody>()->ComputeSphereInertia(radius);
+			return go;
+		}
+		GameObject* AddCapsule(const Vector3& pos, float radius, float cylinderHeight, bool dynamic, float mass = 1.0f)
+		{
+			GameObject* go = AddBody(pos, dynamic, mass);
+			go->GetComponent<Collider>()->SetCapsule(radius, cylinderHeight);
+			go->GetComponent<Rigidbody>()->ComputeBoxInertia(Vector3(radius, cylinderHeight * 0.5f + radius, radius)); // 箱で近似
+			return go;
+		}
+		GameObject* AddGround(float halfSize)
+		{
+			return AddBox(Vector3(0.0f, -1.0f, 0.0f), Vector3(halfSize, 1.0f, halfSize), false);
+		}
+	};
+
+	// --------------------------------------------------
+	// トリガーに入った回数を数える
+	// --------------------------------------------------
+	class TriggerCounter : public Component
+	{
+	public:
+		int* pCount = nullptr;
+		void OnTriggerEnter(Collider*, Collider*) override { (*pCount)++; }
+	};
+
+	// --------------------------------------------------
+	// 乱数（実行環境で並びが変わらないように整数から自分で float にする）
+	// --------------------------------------------------
+	struct BenchRandom
+	{
+		std::mt19937 engine{ 12345u };
+		float Range(float min, float max) { return min + (max - min) * float(engine() >> 8) * (1.0f / 16777216.0f); }
+	};
+
+	// ==================================================
+	// ----- シーンを組む -----
+	// ==================================================
+	// --------------------------------------------------
+	// 箱のピラミッド（下の段 20 個、210 個）
+	// --------------------------------------------------
+	void BuildBoxPyramid(BenchScene& scene)
+	{
+		scene.AddGround(40.0f);
+		const int base = 20;
+		const Vector3 half(0.5f, 0.5f, 0.5f);
+		for (int row = 0; row < base; row++)
+		{
+			const int count = base - row;
+			for (int i = 0; i < count; i++)
+			{
+				const float x = (i - (count - 1) * 0.5f) * 1.05f;
+				scene.AddBox(Vector3(x, 0.5f + row * 1.0f, 0.0f), half, true);
+			}
+		}
+	}
+	// --------------------------------------------------
+	// 100x100 の HeightMap（中心が原点）
+	// --------------------------------------------------
+	void AddHeightField(BenchScene& scene)
+	{
+		const int width = 100, depth = 100;
+		const float cellSize = 1.0f;
+		std::vector<float> heights(width * depth);
+		for (int z = 0; z < depth; z++)
+			for (int x = 0; x < width; x++)
+				heights[z * width + x] = 0.5f * sinf(x * 0.3f) * cosf(z * 0.2f);
+
+		GameObject* field = scene.AddGameObject<GameObject>(0);
+		field->Transform()->SetPosition(Vector3(-width * cellSize * 0.5f, 0.0f, -depth * cellSize * 0.5f));
+		field->SetPhysicsLayer(1);
+		Collider* coll = field->AddComponent<Collider>();
+		coll->SetMeshField(width, depth, cellSize, cellSize, heights);
+		coll->SetModeSimulate();
+		field->AddComponent<Rigidbody>()->SetBodyTypeStatic();
+	}
+	// --------------------------------------------------
+	// リンゴの雨（HeightMap に球 800 個を高さをずらして落とす）
+	// --------------------------------------------------
+	void BuildAppleRain(BenchScene& scene)
+	{
+		AddHeightField(scene);
+
+		BenchRandom random;
+		for (int i = 0; i < 800; i++)
+		{
+			const Vector3 pos(random.Range(-20.0f, 20.0f), 3.0f + (i / 100) * 2.5f + random.Range(0.0f, 1.0f), random.Range(-20.0f, 20.0f));
+			scene.AddSphere(pos, 0.5f, true);
+		}
+	}
+	// --------------------------------------------------
+	// 球の雨（HeightMap に球 1500 個、AppleRain より広く撒いて落とす）
+	// ペアの数に対してコライダーが多いので、ブロードフェーズ（BroadUpdate、Broadphase）の時間を見る
+	// --------------------------------------------------
+	void BuildSphereRain(BenchScene& scene)
+	{
+		AddHeightField(scene);
+
+		BenchRandom random;
+		for (int i = 0; i < 1500; i++)
+		{
+			const Vector3 pos(random.Range(-35.0f, 35.0f), 2.0f + (i / 150) * 1.5f + random.Range(0.0f, 1.0f), random.Range(-35.0f, 35.0f));
+			scene.AddSphere(pos, 0.4f, true);
+		}
+	}
+	// --------------------------------------------------
+	// ラグドール（胴、頭、腕４、脚４の 10 個、ジョイント９個）を 24 体積む
+	// 肩、股関節、首はボール、肘、膝はヒンジ
+	// 隣り合う部位は少し離して置く（ジョイントで繋いだ同士も当たるので）
+	// --------------------------------------------------
+	void BuildRagdoll(BenchScene& scene, const Vector3& p)
+	{
+		auto ball = [](GameObject* a, GameObject* b, const Vector3& anchorA, const Vector3& anchorB)
+			{
+				auto* joint = a->AddComponent<BallJointComponent>();
+				joint->SetOtherObject(b);
+				joint->SetLocalAnchorA(anchorA);
+				joint->SetLocalAnchorB(anchorB);
+				joint->RegisterToPhysicsSystem();
+			};
+		auto hinge = [](GameObject* a, GameObject* b, const Vector3& anchorA, const Vector3& anchorB)
+			{
+				auto* joint = a->AddComponent<HingeJointComponent>();
+				joint->SetOtherObject(b);
+				joint->SetLocalAnchorA(anchorA);
+				joint->SetLocalAnchorB(anchorB);
+				joint->SetAxis(Vector3(1.0f, 0.0f, 0.0f));
+				joint->SetEnableLimit(true);
+				joint->SetLimitMin(-0.1f);
+				joint->SetLimitMax(2.4f);
+				joint->RegisterToPhysicsSystem();
+			};
+
+		const float limbHalf = 0.23f; // 腕の半分の長さ（半径込み）
+		const float legHalf	 = 0.25f;
+		GameObject* torso = scene.AddBox(p, Vector3(0.3f, 0.4f, 0.15f), true, 4.0f);
+		GameObject* head  = scene.AddSphere(p + Vector3(0.0f, 0.7f, 0.0f), 0.2f, true);
+		ball(torso, head, Vector3(0.0f, 0.45f, 0.0f), Vector3(0.0f, -0.25f, 0.0f));
+
+		for (int side = -1; side <= 1; side += 2)
+		{
+			// 腕
+			const Vector3 shoulder(side * 0.42f, 0.35f, 0.0f);
+			GameObject* upperArm = scene.AddCapsule(p + shoulder - Vector3(0.0f, limbHalf, 0.0f), 0.08f, 0.3f, true);
+			GameObject* lowerArm = scene.AddCapsule(p + shoulder - Vector3(0.0f, limbHalf * 3.0f, 0.0f), 0.08f, 0.3f, true);
+			ball (torso,	upperArm, shoulder,						 Vector3(0.0f, limbHalf, 0.0f));
+			hinge(upperArm, lowerArm, Vector3(0.0f, -limbHalf, 0.0f), Vector3(0.0f, limbHalf, 0.0f));
+
+			// 脚
+			const Vector3 hip(side * 0.15f, -0.45f, 0.0f);
+			GameObject* thigh = scene.AddCapsule(p + hip - Vector3(0.0f, legHalf, 0.0f), 0.1f, 0.3f, true);
+			GameObject* shin  = scene.AddCapsule(p + hip - Vector3(0.0f, legHalf * 3.0f, 0.0f), 0.1f, 0.3f, true);
+			ball (torso, thigh, hip,							  Vector3(0.0f, legHalf, 0.0f));
+			hinge(thigh, shin,	Vector3(0.0f, -legHalf, 0.0f), Vector3(0.0f, legHalf, 0.0f));
+		}
+	}
+	void BuildRagdollPile(BenchScene& scene)
+	{
+		scene.AddGround(40.0f);
+		BenchRandom random;
+		for (int i = 0; i < 24; i++)
+		{
+			const int column = i % 4, level = i / 4;
+			const Vector3 p((column % 2) * 1.2f - 0.6f + random.Range(-0.1f, 0.1f), 2.0f + level * 2.2f, (column / 2) * 1.0f - 0.5f + random.Range(-0.1f, 0.1f));
+			BuildRagdoll(scene, p);
+		}
+	}
+	// --------------------------------------------------
+	// 箱の塔（1x1x1 を６段、まっすぐ積む）
+	// --------------------------------------------------
+	void BuildBoxStack(BenchScene& scene)
+	{
+		scene.AddGround(10.0f);
+		const Vector3 half(0.5f, 0.5f, 0.5f);
+		for (int i = 0; i < 6; i++)
+			scene.AddBox(Vector3(0.0f, 0.5f + i * 1.0f, 0.0f), half, true);
+	}
+	// --------------------------------------------------
+	// 箱の山（10x10 を 20 段、2000 個を少し離して置いて落とす）
+	// 眠ると並列ソルバーに仕事が回らないのでスリープは切る
+	// --------------------------------------------------
+	void BuildBoxPile(BenchScene& scene)
+	{
+		scene.physicsSystem().SetEnableSleep(false);
+		scene.AddGround(40.0f);
+		const Vector3 half(0.5f, 0.5f, 0.5f);
+		for (int y = 0; y < 20; y++)
+			for (int z = 0; z < 10; z++)
+				for (int x = 0; x < 10; x++)
+				{
+					const float offset = (y % 2) * 0.25f; // 段ごとにずらして崩れるようにする
+					scene.AddBox(Vector3((x - 4.5f) * 1.1f + offset, 0.5f + y * 1.1f, (z - 4.5f) * 1.1f + offset), half, true);
+				}
+	}
+	// --------------------------------------------------
+	// トリガーの床（20x20 のトリガー箱の上を球 400 個が転がる、外周は壁）
+	// --------------------------------------------------
+	void BuildTriggerField(BenchScene& scene, int* pEnterCount)
+	{
+		const float halfSize = 32.0f;
+		scene.AddGround(halfSize);
+		scene.AddBox(Vector3( halfSize, 1.0f, 0.0f), Vector3(0.5f, 2.0f, halfSize), false);
+		scene.AddBox(Vector3(-halfSize, 1.0f, 0.0f), Vector3(0.5f, 2.0f, halfSize), false);
+		scene.AddBox(Vector3(0.0f, 1.0f,  halfSize), Vector3(halfSize, 2.0f, 0.5f), false);
+		scene.AddBox(Vector3(0.0f, 1.0f, -halfSize), Vector3(halfSize, 2.0f, 0.5f), false);
+
+		for (int z = 0; z < 20; z++)
+			for (int x = 0; x < 20; x++)
+			{
+				GameObject* go = scene.AddGameObject<GameObject>(0);
+				go->Transform()->SetPosition(Vector3(-28.5f + x * 3.0f, 0.5f, -28.5f + z * 3.0f));
+				go->SetPhysicsLayer(1);
+				Collider* coll = go->AddComponent<Collider>();
+				coll->SetBox(Vector3(1.0f, 0.5f, 1.0f));
+				coll->SetModeTrigger();
+				go->AddComponent<TriggerCounter>()->pCount = pEnterCount;
+			}
+
+		BenchRandom random;
+		for (int i = 0; i < 400; i++)
+		{
+			const Vector3 pos(random.Range(-28.0f, 28.0f), 0.4f + random.Range(0.0f, 0.5f), random.Range(-28.0f, 28.0f));
+			GameObject* go = scene.AddSphere(pos, 0.4f, true);
+			Rigidbody* rigid = go->GetComponent<Rigidbody>();
+			rigid->SetVelocity(Vector3(random.Range(-6.0f, 6.0f), 0.0f, random.Range(-6.0f, 6.0f)));
+			rigid->SetLinDamping(0.0f);
+			rigid->SetRestitution(0.5f);
+		}
+	}
+}
+
+// ==================================================
+// ----- 名前 -----
+// ==================================================
+const char* PhysicsBenchmark::SceneName(SceneType type)
+{
+	switch (type)
+	{
+	case SceneType::BoxPyramid:	  return "BoxPyramid";
+	case SceneType::AppleRain:	  return "AppleRain";
+	case SceneType::RagdollPile:  return "RagdollPile";
+	case SceneType::TriggerField: return "TriggerField";
+	case SceneType::SphereRain:	  return "SphereRain";
+	case SceneType::BoxStack:	  return "BoxStack";
+	case SceneType::BoxPile:	  return "BoxPile";
+	default:					  return "Unknown";
+	}
+}
+
+// ==================================================
+// ----- 実行 -----
+// ==================================================
+namespace PhysicsBenchmark
+{
+namespace
+{
+	// --------------------------------------------------
+	// 時間を計る
+	// --------------------------------------------------
+	template<class F>
+	double MeasureMs(F&& func)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		func();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+	// --------------------------------------------------
+	// レイ × 三角形（両面、総当たりの答え合わせ用）
+	// --------------------------------------------------
+	bool RayTriangle(const Ray& ray, const Triangle& tri, float& outT)
+	{
+		const Vector3 e1 = tri.b - tri.a;
+		const Vector3 e2 = tri.c - tri.a;
+		const Vector3 p = Vector3::Cross(ray.direction, e2);
+		const float det = Vector3::Dot(e1, p);
+		if (fabsf(det) < 1e-12f) return false;
+		const float invDet = 1.0f / det;
+		const Vector3 s = ray.origin - tri.a;
+		const float u = Vector3::Dot(s, p) * invDet;
+		if (u < 0.0f || u > 1.0f) return false;
+		const Vector3 q = Vector3::Cross(s, e1);
+		const float v = Vector3::Dot(ray.direction, q) * invDet;
+		if (v < 0.0f || u + v > 1.0f) return false;
+		const float t = Vector3::Dot(e2, q) * invDet;
+		if (t < 0.0f || t > ray.maxDistance) return false;
+		outT = t;
+		return true;
+	}
+	// --------------------------------------------------
+	// HeightMap の全セルの三角形に当てて、一番手前の距離（外れは -1）
+	// --------------------------------------------------
+	float RaycastHeightFieldBrute(const Collider* field, const Ray& ray)
+	{
+		const auto* map = static_cast<const HeightMapCollision*>(field->Shape());
+		float best = -1.0f;
+		for (int j = 0; j < (int)map->Depth() - 1; j++)
+			for (int i = 0; i < (int)map->Width() - 1; i++)
+			{
+				Triangle tri[2];
+				map->BuildCellTrianglesWorld(i, j, field->WorldPose(), tri[0], tri[1]);
+				for (const Triangle& t : tri)
+				{
+					float d;
+					if (RayTriangle(ray, t, d) && (best < 0.0f || d < best)) best = d;
+				}
+			}
+		return best;
+	}
+
+	// --------------------------------------------------
+	// 種類からシーンを組む
+	// --------------------------------------------------
+	void BuildScene(BenchScene& scene, SceneType type, int* triggerEnters)
+	{
+		switch (type)
+		{
+		case SceneType::BoxPyramid:	  BuildBoxPyramid(scene);	 break;
+		case SceneType::AppleRain:	  BuildAppleRain(scene);	 break;
+		case SceneType::RagdollPile:  BuildRagdollPile(scene);	 break;
+		case SceneType::TriggerField: BuildTriggerField(scene, triggerEnters); break;
+		case SceneType::SphereRain:	  BuildSphereRain(scene);	 break;
+		case SceneType::BoxStack:	  BuildBoxStack(scene);		 break;
+		case SceneType::BoxPile:	  BuildBoxPile(scene);		 break;
+		default: assert(false); break;
+		}
+	}
+
+	// --------------------------------------------------
+	// Run の中身
+	// configure はシーンを組む前に PhysicsSystem の設定を変える（比較用のモードから）
+	// --------------------------------------------------
+	Result RunConfigured(SceneType type, int steps, int threads, const char* csvPath, bool pipelined, double mainThreadMs,
+		const std::function<void(PhysicsSystem&)>& configure)
+	{
+		assert(steps > 0);
+		Result result;
+		result.type	 = type;
+		result.steps = steps;
+
+		// ----- シーンを差し替えて組む（コンポーネントは Manager のシーンに登録される）-----
+		BenchScene scene;
+		Scene* prevScene = Manager::SwapScene(&scene);
+		scene.Init();
+		PhysicsSystem& physics = scene.physicsSystem();
+		physics.SetSolverThreadCount(threads);
+		physics.SetPipelined(pipelined);
+		physics.StatsHistory().SetCapacity(steps);
+		if (configure) configure(physics);
+
+		int triggerEnters = 0;
+		BuildScene(scene, type, &triggerEnters);
+
+		// 置いた位置（ずれを見る用）
+		std::vector<Rigidbody*> bodies;
+		std::vector<Vector3>	spawn;
+		for (GameObject* go : scene.GetGameObjects<GameObject>())
+		{
+			Rigidbody* rigid = go->GetComponent<Rigidbody>();
+			if (!rigid || !rigid->IsDynamic()) continue;
+			bodies.push_back(rigid);
+			spawn.push_back(go->Transform()->Position());
+		}
+		result.bodies = (int)bodies.size();
+
+		// ----- 回す -----
+		double speedSum = 0.0;
+		long long speedCount = 0;
+		long long contactSum = 0;
+		const auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < steps; i++)
+		{
+			scene.FixedUpdate(FixedDt);
+
+			// 本体スレッドの仕事（パイプライン実行ではステップと重なる）
+			const auto workEnd = std::chrono::steady_clock::now() + std::chrono::duration<double, std::milli>(mainThreadMs);
+			while (std::chrono::steady_clock::now() < workEnd) {}
+			physics.SyncStep(); // 結果を読むので、次の FixedUpdate を待たずにここで書き戻す
+
+			const PhysicsStepStats& stats = physics.LastStepStats();
+			for (int p = 0; p < PhysicsStepStats::PhaseCount; p++) result.phaseMs[p] += stats.phaseMs[p];
+			result.avgStepMs += stats.totalMs;
+			result.maxStepMs  = std::max(result.maxStepMs, stats.totalMs);
+			contactSum		 += stats.contacts;
+			result.joints	  = stats.joints;
+
+			if (i >= steps - SettleWindow)
+			{
+				for (Rigidbody* rigid : bodies)
+				{
+					const float speed = rigid->Velocity().length();
+					speedSum += speed;
+					speedCount++;
+					result.maxSpeed = std::max(result.maxSpeed, speed);
+				}
+			}
+		}
+		const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		// ----- 集計 -----
+		result.stepsPerSecond = seconds > 0.0 ? steps / seconds : 0.0;
+		result.frameMs		  = seconds * 1000.0 / steps;
+		for (int p = 0; p < PhysicsStepStats::PhaseCount; p++) result.phaseMs[p] /= steps;
+		result.avgStepMs   /= steps;
+		result.avgContacts	= (int)(contactSum / steps);
+		result.triggerEnters = triggerEnters;
+		result.meanSpeed	= speedCount > 0 ? (float)(speedSum / speedCount) : 0.0f;
+		for (size_t i = 0; i < bodies.size(); i++)
+		{
+			const Vector3 pos = bodies[i]->Owner()->Transform()->Position();
+			if (pos.y < LostHeight) { result.lostBodies++; continue; }
+			const float dx = pos.x - spawn[i].x, dz = pos.z - spawn[i].z;
+			result.maxDrift = std::max(result.maxDrift, sqrtf(dx * dx + dz * dz));
+		}
+		if (csvPath) physics.StatsHistory().WriteCSV(csvPath);
+
+		// ----- 後始末 -----
+		scene.Uninit();
+		Manager::SwapScene(prevScene);
+		return result;
+	}
+}
+}
+PhysicsBenchmark::Result PhysicsBenchmark::Run(SceneType type, int steps, int threads, const char* csvPath, bool pipelined, double mainThreadMs)
+{
+	return RunConfigured(type, steps, threads, csvPath, pipelined, mainThreadMs, nullptr);
+}
+void PhysicsBenchmark::RunAll(FILE* out, int steps, int threads, const char* csvPrefix)
+{
+	assert(out);
+	fprintf(out, "PhysicsBenchmark: %d steps, dt %.4f, solver threads %d\n", steps, FixedDt, threads);
+	fprintf(out, "%-13s %6s %6s %10s %8s %8s %8s %9s %9s %8s %5s\n",
+		"scene", "bodies", "joints", "steps/s", "avg ms", "max ms", "contacts", "meanSpd", "maxSpd", "drift", "lost");
+	for (int t = 0; t < (int)SceneType::Count; t++)
+	{
+		const SceneType type = (SceneType)t;
+		std::string csvPath;
+		if (csvPrefix) csvPath = std::string(csvPrefix) + SceneName(type) + ".csv";
+		const Result r = Run(type, steps, threads, csvPrefix ? csvPath.c_str() : nullptr);
+
+		fprintf(out, "%-13s %6d %6d %10.1f %8.3f %8.3f %8d %9.4f %9.4f %8.4f %5d\n",
+			SceneName(type), r.bodies, r.joints, r.stepsPerSecond, r.avgStepMs, r.maxStepMs, r.avgContacts, r.meanSpeed, r.maxSpeed, r.maxDrift, r.lostBodies);
+		fprintf(out, "  phases(ms):");
+		for (int p = 0; p < PhysicsStepStats::PhaseCount; p++) fprintf(out, " %s %.3f", PhysicsStepStats::PhaseName(p), r.phaseMs[p]);
+		if (type == SceneType::TriggerField) fprintf(out, "\n  trigger enters: %d", r.triggerEnters);
+		fprintf(out, "\n");
+	}
+}
+void PhysicsBenchmark::RunThreadScaling(FILE* out, int steps, int maxThreads)
+{
+	assert(out && maxThreads >= 1);
+	fprintf(out, "PhysicsBenchmark thread scaling: %d steps, dt %.4f\n", steps, FixedDt);
+	fprintf(out, "%-13s %7s %8s %7s %10s %10s %8s %8s %8s %6s\n",
+		"scene", "threads", "avg ms", "speedup", "BroadUpd", "Narrow", "Solve", "SolvePos", "contacts", "same");
+	for (int t = 0; t < (int)SceneType::Count; t++)
+	{
+		const SceneType type = (SceneType)t;
+		double baseMs = 0.0;
+		Result parallel; // ２スレッドの結果
+		for (int threads = 1; threads <= maxThreads; threads *= 2)
+		{
+			const Result r = Run(type, steps, threads);
+			if (threads == 1) baseMs = r.avgStepMs;
+			if (threads == 2) parallel = r;
+			const bool same = r.meanSpeed == parallel.meanSpeed && r.maxSpeed == parallel.maxSpeed && r.maxDrift == parallel.maxDrift
+				&& r.lostBodies == parallel.lostBodies && r.avgContacts == parallel.avgContacts;
+			fprintf(out, "%-13s %7d %8.3f %6.2fx %10.3f %10.3f %8.3f %8.3f %8d %6s\n",
+				SceneName(type), threads, r.avgStepMs, r.avgStepMs > 0.0 ? baseMs / r.avgStepMs : 0.0,
+				r.phaseMs[PhysicsStepStats::BroadUpdate], r.phaseMs[PhysicsStepStats::Narrowphase],
+				r.phaseMs[PhysicsStepStats::Solve], r.phaseMs[PhysicsStepStats::SolvePosition], r.avgContacts,
+				threads < 2 ? "-" : (same ? "yes" : "no"));
+		}
+	}
+}
+void PhysicsBenchmark::RunPipeline(FILE* out, int steps, double mainThreadMs)
+{
+	assert(out && mainThreadMs >= 0.0);
+	fprintf(out, "PhysicsBenchmark pipeline: %d steps, dt %.4f, main thread work %.2f ms/frame\n", steps, FixedDt, mainThreadMs);
+	fprintf(out, "%-13s %-9s %9s %8s %7s %9s %9s %8s %6s\n",
+		"scene", "mode", "frame ms", "step ms", "speedup", "meanSpd", "maxSpd", "drift", "same");
+	for (int t = 0; t < (int)SceneType::Count; t++)
+	{
+		const SceneType type = (SceneType)t;
+		const Result sync = Run(type, steps, 1, nullptr, false, mainThreadMs);
+		const Result pipe = Run(type, steps, 1, nullptr, true,  mainThreadMs);
+		const bool same = sync.meanSpeed == pipe.meanSpeed && sync.maxSpeed == pipe.maxSpeed && sync.maxDrift == pipe.maxDrift
+			&& sync.lostBodies == pipe.lostBodies && sync.avgContacts == pipe.avgContacts && sync.triggerEnters == pipe.triggerEnters;
+		for (const Result* r : { &sync, &pipe })
+		{
+			fprintf(out, "%-13s %-9s %9.3f %8.3f %6.2fx %9.4f %9.4f %8.4f %6s\n",
+				SceneName(type), r == &sync ? "sync" : "pipelined", r->frameMs, r->avgStepMs,
+				r->frameMs > 0.0 ? sync.frameMs / r->frameMs : 0.0, r->meanSpeed, r->maxSpeed, r->maxDrift,
+				r == &sync ? "-" : (same ? "yes" : "no"));
+		}
+	}
+}
+void PhysicsBenchmark::RunWarmStart(FILE* out, int steps)
+{
+	assert(out);
+	fprintf(out, "PhysicsBenchmark warm start: %s, %d steps, dt %.4f\n", SceneName(SceneType::BoxStack), steps, FixedDt);
+	fprintf(out, "%-9s %5s %8s %9s %9s %8s %7s\n", "warmStart", "iters", "avg ms", "meanSpd", "maxSpd", "drift", "settled");
+	for (int warm = 1; warm >= 0; warm--)
+		for (int iterations : { 3, 4, 8 })
+		{
+			const Result r = RunConfigured(SceneType::BoxStack, steps, 1, nullptr, false, 0.0, [&](PhysicsSystem& physics)
+				{
+					physics.SetEnableWarmStart(warm != 0);
+					physics.SetVelocityIterations(iterations);
+				});
+			// 半分以上ずれず、最後の 1 秒でほぼ止まっていれば積めている
+			const bool settled = r.maxDrift < 0.5f && r.meanSpeed < 0.05f && r.lostBodies == 0;
+			fprintf(out, "%-9s %5d %8.3f %9.4f %9.4f %8.4f %7s\n",
+				warm ? "on" : "off", iterations, r.avgStepMs, r.meanSpeed, r.maxSpeed, r.maxDrift, settled ? "yes" : "no");
+		}
+}
+int PhysicsBenchmark::RunRaycast(FILE* out, int rayCount)
+{
+	assert(out && rayCount > 0);
+	const int Repeat = 5;		// 計る時は同じレイを何回か撃つ
+	const int BruteCount = 300; // 総当たりで答え合わせする本数（向きごと）
+
+	BenchScene scene;
+	Scene* prevScene = Manager::SwapScene(&scene);
+	scene.Init();
+	PhysicsSystem& physics = scene.physicsSystem();
+	AddHeightField(scene);
+	scene.FixedUpdate(FixedDt); // 区分と木を作る
+	physics.SyncStep();
+	const Collider* field = nullptr;
+	for (GameObject* go : scene.GetGameObjects<GameObject>()) field = go->GetComponent<Collider>();
+
+	// ----- レイを作る -----
+	// 真下付近（上から地面へ）、かすめる（地面すれすれを遠くまで）、横（箱の間を抜ける）
+	// 並びは格子の順にして、隣り合うレイが近くを通るようにする（RaycastMany の束が小さくなる）
+	BenchRandom random;
+	const int side = std::max(1, (int)sqrtf((float)rayCount));
+	std::vector<Ray> down(rayCount), grazing(rayCount), horizontal(rayCount);
+	for (int i = 0; i < rayCount; i++)
+	{
+		const float u = ((i % side) + 0.5f) / side, v = ((i / side) % side + 0.5f) / side;
+		const float x = -48.0f + u * 96.0f, z = -48.0f + v * 96.0f;
+		down[i] = { Vector3(x, 10.0f, z), Vector3(random.Range(-0.05f, 0.05f), -1.0f, random.Range(-0.05f, 0.05f)).normalized(), 30.0f };
+
+		const float angle = v * 6.2831853f;
+		grazing[i] = { Vector3(x * 0.5f, 1.0f, z * 0.5f), Vector3(cosf(angle), -0.02f, sinf(angle)).normalized(), 100.0f };
+		horizontal[i] = { Vector3(-49.0f, 1.0f + u * 0.8f, z), Vector3(1.0f, 0.0f, 0.0f), 100.0f };
+	}
+
+	QueryOptions opt;
+	std::vector<RaycastHit> single(rayCount), many(rayCount);
+	auto castSingle = [&](const std::vector<Ray>& rays)
+		{
+			return MeasureMs([&]
+				{
+					for (int r = 0; r < Repeat; r++)
+						for (int i = 0; i < rayCount; i++) physics.Raycast(rays[i].origin, rays[i].direction, rays[i].maxDistance, single[i], opt);
+				});
+		};
+	auto castMany = [&](const std::vector<Ray>& rays)
+		{
+			return MeasureMs([&] { for (int r = 0; r < Repeat; r++) physics.RaycastMany(rays.data(), rayCount, many.data(), opt); });
+		};
+	auto raysPerSecond = [&](double ms) { return ms > 0.0 ? rayCount * Repeat / (ms * 1000.0) : 0.0; }; // M rays/s
+	auto countHits = [&](const std::vector<RaycastHit>& hits) { return (int)std::count_if(hits.begin(), hits.end(), [](const RaycastHit& h) { return h.other != nullptr; }); };
+	// RaycastMany と Raycast で相手と距離が同じか
+	auto compareMany = [&]()
+		{
+			int mismatches = 0;
+			for (int i = 0; i < rayCount; i++)
+				if (single[i].other != many[i].other || fabsf(single[i].distance - many[i].distance) > 1e-4f) mismatches++;
+			return mismatches;
+		};
+	// HeightMap の当たりを総当たりと比べる
+	auto compareBrute = [&](const std::vector<Ray>& rays)
+		{
+			int mismatches = 0;
+			const int step = std::max(1, rayCount / BruteCount);
+			for (int i = 0; i < rayCount; i += step)
+			{
+				const float expected = RaycastHeightFieldBrute(field, rays[i]);
+				RaycastHit hit;
+				const bool got = physics.Raycast(rays[i].origin, rays[i].direction, rays[i].maxDistance, hit, opt);
+				if (got != (expected >= 0.0f) || (got && fabsf(hit.distance - expected) > 1e-3f)) mismatches++;
+			}
+			return mismatches;
+		};
+
+	fprintf(out, "PhysicsBenchmark raycast: %d rays x %d\n", rayCount, Repeat);
+	fprintf(out, "%-24s %-10s %6s %8s %9s %9s\n", "scene", "rays", "hits", "Mrays/s", "many M/s", "mismatch");
+	int mismatches = 0;
+
+	// ----- HeightMap だけ -----
+	for (const auto* rays : { &down, &grazing })
+	{
+		const double singleMs = castSingle(*rays);
+		const double manyMs	  = castMany(*rays);
+		const int bad = compareMany() + compareBrute(*rays);
+		mismatches += bad;
+		fprintf(out, "%-24s %-10s %6d %8.2f %9.2f %9d\n", "heightfield", rays == &down ? "down" : "grazing",
+			countHits(single), raysPerSecond(singleMs), raysPerSecond(manyMs), bad);
+	}
+
+	// ----- HeightMap ＋箱 400 個（止めたまま置く）-----
+	for (int i = 0; i < 400; i++)
+	{
+		const Vector3 pos(random.Range(-45.0f, 45.0f), 1.0f, random.Range(-45.0f, 45.0f));
+		scene.AddBox(pos, Vector3(0.5f, 0.5f, 0.5f), false);
+	}
+	scene.FixedUpdate(FixedDt);
+	physics.SyncStep();
+	for (const auto* rays : { &down, &horizontal })
+	{
+		const double singleMs = castSingle(*rays);
+		const double manyMs	  = castMany(*rays);
+		const int bad = compareMany();
+		mismatches += bad;
+		fprintf(out, "%-24s %-10s %6d %8.2f %9.2f %9d\n", "heightfield + 400 boxes", rays == &down ? "down" : "horizontal",
+			countHits(single), raysPerSecond(singleMs), raysPerSecond(manyMs), bad);
+	}
+	if (mismatches > 0) fprintf(out, "  RAYCAST MISMATCH: %d\n", mismatches);
+
+	scene.Uninit();
+	Manager::SwapScene(prevScene);
+	return mismatches;
+}
+int PhysicsBenchmark::RunDispatch(FILE* out)
+{
+	assert(out);
+	const int ScatteredCount = 200000; // 散らばった配列の形状の数（組も同じ数）
+	const int HotCount		 = 4096;   // キャッシュに乗る配列の組の数
+	const int HotRepeat		 = 100;
+	const int Trials		 = 5;
+
+	// ----- 形状を作る -----
+	// 組 i は形状 2i と 2i + 1（近くに置いてだいたい当たるようにする）
+	// 散らばった方は組の順番をばらばらにして、キャッシュに乗らないようにする
+	struct ShapeSet
+	{
+		std::vector<std::unique_ptr<Collision>> shapes;
+		std::vector<ColliderPose> poses;
+		std::vector<ShapeRecord>  records;
+		std::vector<int> order; // 回す組の順番
+	};
+	auto makeShape = [](ColliderType type, BenchRandom& random) -> std::unique_ptr<Collision>
+		{
+			switch (type)
+			{
+			case ColliderType::Sphere:	return std::make_unique<SphereCollision>(random.Range(0.3f, 0.6f));
+			case ColliderType::Capsule: return std::make_unique<CapsuleCollision>(random.Range(0.2f, 0.4f), random.Range(0.5f, 1.0f));
+			default:					return std::make_unique<BoxCollision>(Vector3(random.Range(0.3f, 0.6f), random.Range(0.3f, 0.6f), random.Range(0.3f, 0.6f)));
+			}
+		};
+	auto build = [&](ColliderType typeA, ColliderType typeB, int pairCount, bool scatter)
+		{
+			BenchRandom random;
+			ShapeSet set;
+			for (int i = 0; i < pairCount; i++)
+			{
+				const Vector3 center(random.Range(-100.0f, 100.0f), random.Range(0.0f, 10.0f), random.Range(-100.0f, 100.0f));
+				for (int k = 0; k < 2; k++)
+				{
+					const ColliderType type = k == 0 ? typeA : typeB;
+					ColliderPose pose;
+					pose.position = center + Vector3(random.Range(-0.4f, 0.4f), random.Range(-0.4f, 0.4f), random.Range(-0.4f, 0.4f));
+					pose.rotation = Quaternion::FromEulerAngles(Vector3(random.Range(-3.1f, 3.1f), random.Range(-3.1f, 3.1f), random.Range(-3.1f, 3.1f)));
+					pose.scale = Vector3(1.0f, 1.0f, 1.0f);
+					set.shapes.push_back(makeShape(type, random));
+					set.poses.push_back(pose);
+					set.records.push_back(ShapeDispatch::MakeRecord(type, set.shapes.back().get()));
+					set.records.back().pose = pose;
+				}
+				set.order.push_back(i);
+			}
+			if (scatter) std::shuffle(set.order.begin(), set.order.end(), random.engine);
+			return set;
+		};
+
+	fprintf(out, "PhysicsBenchmark dispatch: scattered %d pairs, hot %d pairs x %d\n", ScatteredCount, HotCount, HotRepeat);
+	fprintf(out, "%-10s %-15s %10s %10s %7s %6s %9s\n", "arrays", "pair", "virtual M/s", "table M/s", "ratio", "hits", "mismatch");
+	const ColliderType pairs[][2] =
+	{
+		{ ColliderType::Sphere, ColliderType::Sphere },
+		{ ColliderType::Box,	ColliderType::Box },
+		{ ColliderType::Capsule, ColliderType::Box },
+	};
+	const char* typeNames[] = { "box", "sphere", "capsule" };
+	int mismatches = 0;
+	for (int scatter = 1; scatter >= 0; scatter--)
+		for (const auto& pair : pairs)
+		{
+			const int pairCount = scatter ? ScatteredCount : HotCount;
+			const int repeat	= scatter ? 1 : HotRepeat;
+			const ShapeSet set = build(pair[0], pair[1], pairCount, scatter != 0);
+			std::vector<ContactManifold> virtualOut(pairCount), tableOut(pairCount);
+
+			// 揺れが大きいので何回か回して一番速い時間を使う
+			auto bestMs = [](auto&& func)
+				{
+					double best = MeasureMs(func);
+					for (int t = 1; t < Trials; t++) best = std::min(best, MeasureMs(func));
+					return best;
+				};
+			int hits = 0;
+			const double virtualMs = bestMs([&]
+				{
+					hits = 0;
+					for (int r = 0; r < repeat; r++)
+						for (int i : set.order)
+						{
+							ContactManifold& m = virtualOut[i];
+							m = ContactManifold();
+							hits += set.shapes[i * 2]->isOverlap(set.poses[i * 2], *set.shapes[i * 2 + 1], set.poses[i * 2 + 1], m, 0.0f);
+						}
+				});
+			const double tableMs = bestMs([&]
+				{
+					for (int r = 0; r < repeat; r++)
+						for (int i : set.order)
+						{
+							ContactManifold& m = tableOut[i];
+							m = ContactManifold();
+							ShapeDispatch::Overlap(set.records[i * 2], set.records[i * 2 + 1], m, 0.0f);
+						}
+				});
+
+			// 接触の数、法線、深さが同じか
+			int bad = 0;
+			for (int i = 0; i < pairCount; i++)
+			{
+				const ContactManifold& a = virtualOut[i];
+				const ContactManifold& b = tableOut[i];
+				bool same = a.touching == b.touching && a.count == b.count
+					&& a.normal.x == b.normal.x && a.normal.y == b.normal.y && a.normal.z == b.normal.z;
+				for (int p = 0; same && p < a.count; p++) same = a.points[p].penetration == b.points[p].penetration;
+				if (!same) bad++;
+			}
+			mismatches += bad;
+
+			const double pairsDone = (double)pairCount * repeat;
+			const double virtualRate = virtualMs > 0.0 ? pairsDone / (virtualMs * 1000.0) : 0.0;
+			const double tableRate	 = tableMs	 > 0.0 ? pairsDone / (tableMs	* 1000.0) : 0.0;
+			char name[32];
+			snprintf(name, sizeof(name), "%s-%s", typeNames[(int)pair[0]], typeNames[(int)pair[1]]);
+			fprintf(out, "%-10s %-15s %10.2f %10.2f %6.2fx %6d %9d\n", scatter ? "scattered" : "hot", name,
+				virtualRate, tableRate, virtualRate > 0.0 ? tableRate / virtualRate : 0.0, hits / repeat, bad);
+		}
+
+	// ----- Intersect（トリガー）と Overlap の当たり外れが同じか -----
+	// 境目付近に置いた組を、スケール違い、凸包も混ぜて比べる
+	const int IntersectSamples = 20000;
+	BenchRandom random;
+	std::vector<Vector3> hullPoints;
+	for (int i = 0; i < 24; i++) hullPoints.push_back(Vector3(random.Range(-0.6f, 0.6f), random.Range(-0.6f, 0.6f), random.Range(-0.6f, 0.6f)));
+	const auto hull = std::make_shared<const ConvexHull>(hullPoints);
+	auto makeAny = [&](ColliderType type) -> std::unique_ptr<Collision>
+		{
+			if (type == ColliderType::ConvexHull) return std::make_unique<ConvexHullCollision>(hull);
+			return makeShape(type, random);
+		};
+	const ColliderType convex[] = { ColliderType::Box, ColliderType::Sphere, ColliderType::Capsule, ColliderType::ConvexHull };
+	const char* convexNames[] = { "box", "sphere", "capsule", "", "", "hull" };
+	fprintf(out, "%-17s %8s %9s\n", "intersect", "hits", "mismatch");
+	for (ColliderType typeA : convex)
+		for (ColliderType typeB : convex)
+		{
+			int hits = 0, bad = 0;
+			for (int i = 0; i < IntersectSamples; i++)
+			{
+				std::unique_ptr<Collision> shapes[2] = { makeAny(typeA), makeAny(typeB) };
+				ShapeRecord records[2];
+				for (int k = 0; k < 2; k++)
+				{
+					records[k] = ShapeDispatch::MakeRecord(k == 0 ? typeA : typeB, shapes[k].get());
+					ColliderPose& pose = records[k].pose;
+					pose.rotation = Quaternion::FromEulerAngles(Vector3(random.Range(-3.1f, 3.1f), random.Range(-3.1f, 3.1f), random.Range(-3.1f, 3.1f)));
+					pose.scale = (i % 3 == 0) ? Vector3(random.Range(0.7f, 1.5f), random.Range(0.7f, 1.5f), random.Range(0.7f, 1.5f)) : Vector3(1.0f, 1.0f, 1.0f);
+					if (i % 7 == 0) pose.scale.x = -pose.scale.x; // 鏡像
+				}
+				Vector3 dir(random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f));
+				dir.normalize();
+				records[1].pose.position = dir * random.Range(0.0f, 2.5f);
+
+				ContactManifold m;
+				const bool overlap	 = ShapeDispatch::Overlap(records[0], records[1], m, 0.0f);
+				const bool intersect = ShapeDispatch::Intersect(records[0], records[1]);
+				hits += overlap;
+				if (overlap != intersect) bad++;
+			}
+			mismatches += bad;
+			char name[32];
+			snprintf(name, sizeof(name), "%s-%s", convexNames[(int)typeA], convexNames[(int)typeB]);
+			fprintf(out, "%-17s %8d %9d\n", name, hits, bad);
+		}
+
+	if (mismatches > 0) fprintf(out, "  DISPATCH MISMATCH: %d\n", mismatches);
+	return mismatches;
+}
+int PhysicsBenchmark::RunSimdCheck(FILE* out)
+{
+	assert(out);
+	const int BoxCount	  = 10000;
+	const int QueryCount  = 200;
+	const int SphereCount = 4099; // 8 の倍数にしない（端数の処理も通す）
+	const int PairCount	  = 20003;
+	BenchRandom random;
+
+	// ----- AABB：ぴったり接する箱、空き ID も混ぜる -----
+	AABBSoA soa;
+	soa.Resize(BoxCount);
+	for (int i = 0; i < BoxCount; i++)
+	{
+		if (i % 97 == 0) { soa.Clear(i); continue; }
+		const Vector3 center(random.Range(-50.0f, 50.0f), random.Range(-50.0f, 50.0f), random.Range(-50.0f, 50.0f));
+		const Vector3 half(random.Range(0.1f, 3.0f), random.Range(0.1f, 3.0f), random.Range(0.1f, 3.0f));
+		soa.Set(i, { center - half, center + half });
+	}
+	std::vector<int> indices;
+	for (int i = 0; i < BoxCount - 5; i++) indices.push_back(i);
+	std::shuffle(indices.begin(), indices.end(), random.engine);
+	std::vector<AABB> queries;
+	for (int q = 0; q < QueryCount; q++)
+	{
+		const Vector3 center(random.Range(-50.0f, 50.0f), random.Range(-50.0f, 50.0f), random.Range(-50.0f, 50.0f));
+		const Vector3 half(random.Range(0.5f, 10.0f), random.Range(0.5f, 10.0f), random.Range(0.5f, 10.0f));
+		queries.push_back({ center - half, center + half });
+	}
+	// 箱の面にぴったり接するクエリ（max 側、min 側）
+	for (int q = 1; q < 20; q++)
+	{
+		queries.push_back({ {soa.maxX[q], soa.minY[q], soa.minZ[q]}, {soa.maxX[q] + 1.0f, soa.maxY[q], soa.maxZ[q]} });
+		queries.push_back({ {soa.minX[q], soa.minY[q] - 1.0f, soa.minZ[q]}, {soa.maxX[q], soa.minY[q], soa.maxZ[q]} });
+	}
+
+	// ----- 球：中心が同じ組、ちょうど接する組、スケール違いも混ぜる -----
+	std::vector<SphereCollision> spheres;
+	std::vector<ShapeRecord> records;
+	spheres.reserve(SphereCount);
+	for (int i = 0; i < SphereCount; i++)
+	{
+		spheres.emplace_back(random.Range(0.2f, 1.0f));
+		ShapeRecord r = ShapeDispatch::MakeRecord(ColliderType::Sphere, &spheres.back());
+		r.pose.position = Vector3(random.Range(-10.0f, 10.0f), random.Range(-10.0f, 10.0f), random.Range(-10.0f, 10.0f));
+		r.pose.scale = (i % 5 == 0) ? Vector3(1.5f, 1.5f, 1.5f) : Vector3(1.0f, 1.0f, 1.0f);
+		if (i % 31 == 1) r.pose.position = records[i - 1].pose.position;											 // 中心が同じ
+		if (i % 37 == 1) r.pose.position = records[i - 1].pose.position + Vector3(records[i - 1].param[0] + r.param[0], 0, 0); // ちょうど接する
+		records.push_back(r);
+	}
+	std::vector<int> idA(PairCount), idB(PairCount);
+	for (int i = 0; i < PairCount; i++)
+	{
+		if (i < SphereCount - 1) { idA[i] = i; idB[i] = i + 1; continue; } // 並びの組（同じ中心、接する組を含む）
+		idA[i] = (int)(random.engine() % SphereCount);
+		idB[i] = (int)(random.engine() % SphereCount);
+	}
+	const float slop = 0.01f;
+
+	// ----- 答え（カーネルを通さないスカラー版） -----
+	std::vector<std::vector<int>> refHits(queries.size());
+	for (size_t q = 0; q < queries.size(); q++)
+		for (int j : indices)
+		{
+			const AABB o{ {soa.minX[j], soa.minY[j], soa.minZ[j]}, {soa.maxX[j], soa.maxY[j], soa.maxZ[j]} };
+			if (queries[q].isOverlap(o)) refHits[q].push_back(j);
+		}
+	std::vector<ContactManifold> refManifolds(PairCount);
+	std::vector<uint8_t> refHit(PairCount);
+	for (int i = 0; i < PairCount; i++) refHit[i] = ShapeDispatch::Overlap(records[idA[i]], records[idB[i]], refManifolds[i], slop);
+
+	auto sameFloat = [](float a, float b) { return memcmp(&a, &b, sizeof(float)) == 0; };
+	auto sameVec   = [&](const Vector3& a, const Vector3& b) { return sameFloat(a.x, b.x) && sameFloat(a.y, b.y) && sameFloat(a.z, b.z); };
+
+	// ----- 命令セットごとに比べる -----
+	fprintf(out, "PhysicsBenchmark SIMD check: %d boxes x %d queries, %d sphere pairs (detected %s)\n",
+		BoxCount, (int)queries.size(), PairCount, SimdKernels::LevelName(SimdKernels::DetectLevel()));
+	const SimdKernels::Level saved = SimdKernels::ActiveLevel();
+	int failures = 0;
+	const SimdKernels::Level levels[] = { SimdKernels::Level::Scalar, SimdKernels::Level::SSE, SimdKernels::Level::AVX2 };
+	for (SimdKernels::Level level : levels)
+	{
+		if ((int)level > (int)SimdKernels::DetectLevel())
+		{
+			fprintf(out, "  %-6s skipped (not supported by this CPU)\n", SimdKernels::LevelName(level));
+			continue;
+		}
+		SimdKernels::SetLevel(level);
+
+		int aabbBad = 0;
+		std::vector<int> hits(indices.size());
+		for (size_t q = 0; q < queries.size(); q++)
+		{
+			const int n = SimdKernels::OverlapIndexed(queries[q], soa, indices.data(), (int)indices.size(), hits.data());
+			if (n != (int)refHits[q].size() || !std::equal(refHits[q].begin(), refHits[q].end(), hits.begin())) aabbBad++;
+		}
+
+		int sphereBad = 0;
+		std::vector<ContactManifold> manifolds(PairCount);
+		std::vector<uint8_t> hit(PairCount);
+		SimdKernels::SphereSphere(records.data(), idA.data(), idB.data(), PairCount, slop, manifolds.data(), hit.data());
+		for (int i = 0; i < PairCount; i++)
+		{
+			bool same = (hit[i] != 0) == (refHit[i] != 0);
+			if (same && hit[i]) // 当たっていない組は書かない約束なので比べない
+			{
+				const ContactManifold& a = manifolds[i];
+				const ContactManifold& b = refManifolds[i];
+				same = a.touching == b.touching && a.count == b.count && sameVec(a.normal, b.normal)
+					&& sameFloat(a.points[0].penetration, b.points[0].penetration)
+					&& sameVec(a.points[0].pointOnA, b.points[0].pointOnA) && sameVec(a.points[0].pointOnB, b.points[0].pointOnB);
+			}
+			if (!same)
+			{
+				if (sphereBad == 0)
+					fprintf(out, "    first sphere mismatch: pair %d (%d, %d) hit %d / %d\n", i, idA[i], idB[i], (int)hit[i], (int)refHit[i]);
+				sphereBad++;
+			}
+		}
+
+		fprintf(out, "  %-6s AABB %d/%d queries differ, sphere %d/%d pairs differ  %s\n", SimdKernels::LevelName(level),
+			aabbBad, (int)queries.size(), sphereBad, PairCount, (aabbBad + sphereBad) ? "FAIL" : "ok");
+		failures += aabbBad + sphereBad;
+	}
+	SimdKernels::SetLevel(saved);
+	if (failures > 0) fprintf(out, "  SIMD MISMATCH: %d\n", failures);
+	return failures;
+}
+int PhysicsBenchmark::RunSnapshot(FILE* out, int warmSteps, int steps)
+{
+	assert(out && warmSteps > 0 && steps > 0);
+	fprintf(out, "PhysicsBenchmark snapshot: save after %d steps, run %d, restore, run %d again\n", warmSteps, steps, steps);
+	fprintf(out, "%-13s %-10s %8s %9s %9s %6s\n", "scene", "mode", "bytes", "reSave", "resim", "");
+
+	// 姿勢を FNV-1a でまとめる（Transform に書き戻った結果まで見る）
+	auto hashPoses = [](const std::vector<Rigidbody*>& bodies)
+		{
+			uint64_t h = 1469598103934665603ull;
+			auto mix = [&h](const void* p, size_t n)
+				{
+					const uint8_t* b = (const uint8_t*)p;
+					for (size_t i = 0; i < n; i++) { h ^= b[i]; h *= 1099511628211ull; }
+				};
+			for (Rigidbody* rigid : bodies)
+			{
+				const Vector3 pos = rigid->Owner()->Transform()->Position();
+				const Quaternion rot = rigid->Owner()->Transform()->Rotation();
+				mix(&pos, sizeof(pos));
+				mix(&rot, sizeof(rot));
+			}
+			return h;
+		};
+
+	const SceneType types[] = { SceneType::BoxPyramid, SceneType::AppleRain, SceneType::RagdollPile, SceneType::TriggerField };
+	struct Mode { const char* name; int threads; bool pipelined; };
+	const Mode modes[] = { { "serial", 1, false }, { "threads4", 4, false }, { "pipelined", 1, true } };
+	int failures = 0;
+	for (SceneType type : types)
+		for (const Mode& mode : modes)
+		{
+			BenchScene scene;
+			Scene* prevScene = Manager::SwapScene(&scene);
+			scene.Init();
+			PhysicsSystem& physics = scene.physicsSystem();
+			physics.SetSolverThreadCount(mode.threads);
+			physics.SetPipelined(mode.pipelined);
+			int triggerEnters = 0;
+			BuildScene(scene, type, &triggerEnters);
+			std::vector<Rigidbody*> bodies;
+			for (GameObject* go : scene.GetGameObjects<GameObject>())
+				if (Rigidbody* rigid = go->GetComponent<Rigidbody>()) bodies.push_back(rigid);
+
+			auto run = [&](int count)
+				{
+					for (int i = 0; i < count; i++)
+					{
+						scene.FixedUpdate(FixedDt);
+						physics.SyncStep();
+					}
+				};
+			run(warmSteps);
+
+			// パイプライン実行ではステップが走っている最中に保存する（保存側で待って反映する）
+			scene.FixedUpdate(FixedDt);
+			std::vector<uint8_t> saved;
+			physics.SaveSnapshot(saved);
+
+			run(steps);
+			std::vector<uint8_t> first;
+			physics.SaveSnapshot(first);
+			const uint64_t firstHash = hashPoses(bodies);
+
+			// 戻して、戻した直後の保存が同じか、同じだけ回して同じところに着くか
+			scene.FixedUpdate(FixedDt); // 走っている最中に戻す（パイプライン実行）
+			const bool restored = physics.RestoreSnapshot(saved);
+			std::vector<uint8_t> again;
+			physics.SaveSnapshot(again);
+			const bool reSave = restored && again == saved;
+
+			run(steps);
+			std::vector<uint8_t> second;
+			physics.SaveSnapshot(second);
+			const bool resim = second == first && hashPoses(bodies) == firstHash;
+
+			const int bad = (reSave ? 0 : 1) + (resim ? 0 : 1);
+			failures += bad;
+			fprintf(out, "%-13s %-10s %8d %9s %9s %6s\n", SceneName(type), mode.name, (int)saved.size(),
+				reSave ? "same" : "DIFF", resim ? "same" : "DIFF", bad ? "FAIL" : "ok");
+
+			scene.Uninit();
+			Manager::SwapScene(prevScene);
+		}
+
+	// ----- 保存＋復元の時間 -----
+	// 巻き戻しで毎フレーム使えるように、１往復を 1000 ボディあたり 1ms 未満に収める
+	// 10 ステップ離れた２つの保存を交互に戻す（戻すたびに全部のボディが動く、巻き戻しと同じ仕事）
+	for (SceneType type : { SceneType::SphereRain, SceneType::BoxPile })
+	{
+		const int RoundTrips = 100;
+		const double BudgetUsPer1000 = 1000.0;
+		BenchScene scene;
+		Scene* prevScene = Manager::SwapScene(&scene);
+		scene.Init();
+		PhysicsSystem& physics = scene.physicsSystem();
+		BuildScene(scene, type, nullptr);
+		for (int i = 0; i < warmSteps; i++) scene.FixedUpdate(FixedDt);
+		std::vector<uint8_t> snapshots[2], buffer;
+		physics.SaveSnapshot(snapshots[0]);
+		for (int i = 0; i < 10; i++) scene.FixedUpdate(FixedDt);
+		physics.SaveSnapshot(snapshots[1]);
+		physics.SaveSnapshot(buffer); // 一度目はバッファの確保が入るので外す
+
+		int bodyCount = 0;
+		for (GameObject* go : scene.GetGameObjects<GameObject>())
+			if (go->GetComponent<Rigidbody>()) bodyCount++;
+
+		bool restored = true;
+		const double ms = MeasureMs([&]
+			{
+				for (int r = 0; r < RoundTrips; r++)
+				{
+					physics.SaveSnapshot(buffer);
+					restored = physics.RestoreSnapshot(snapshots[r & 1]) && restored;
+				}
+			});
+		const double us = ms * 1000.0 / RoundTrips;
+		const double budgetUs = BudgetUsPer1000 * bodyCount / 1000.0;
+		const bool ok = restored && us < budgetUs;
+		if (!ok) failures++;
+		fprintf(out, "round trip: %-11s %5d bodies %8d bytes %8.1f us per save + restore (budget %.0f us)  %s\n",
+			SceneName(type), bodyCount, (int)buffer.size(), us, budgetUs, ok ? "ok" : "FAIL");
+
+		scene.Uninit();
+		Manager::SwapScene(prevScene);
+	}
+
+	if (failures > 0) fprintf(out, "  SNAPSHOT MISMATCH: %d\n", failures);
+	return failures;
+}
+int PhysicsBenchmark::RunBroadphaseScaling(FILE* out)
+{
+	assert(out);
+	const int Counts[] = { 100, 1000, 10000 };
+	const int Frames = 5;			// 少しずつ動かして、その度に両方で組を出す
+	const float Spacing = 2.0f;		// 箱１個あたりの場所（数を増やしても混み具合は変えない）
+	fprintf(out, "PhysicsBenchmark broadphase scaling: dynamic AABB tree vs all-pairs AABB::isOverlap, %d frames\n", Frames);
+	fprintf(out, "%8s %9s %10s %12s %8s %8s %9s\n", "boxes", "build ms", "tree ms", "allpairs ms", "speedup", "pairs", "mismatch");
+
+	int failures = 0;
+	for (int n : Counts)
+	{
+		BenchRandom random;
+		const float extent = Spacing * cbrtf((float)n) * 0.5f;
+		std::vector<Vector3> centers(n), halves(n), moves(n);
+		for (int i = 0; i < n; i++)
+		{
+			centers[i] = Vector3(random.Range(-extent, extent), random.Range(-extent, extent), random.Range(-extent, extent));
+			halves[i]  = Vector3(random.Range(0.2f, 0.8f), random.Range(0.2f, 0.8f), random.Range(0.2f, 0.8f));
+			moves[i]   = Vector3(random.Range(-0.05f, 0.05f), random.Range(-0.05f, 0.05f), random.Range(-0.05f, 0.05f)); // １フレームの移動
+		}
+		std::vector<AABB> aabbs(n);
+		auto place = [&](int frame)
+			{
+				for (int i = 0; i < n; i++)
+				{
+					const Vector3 c = centers[i] + moves[i] * (float)frame;
+					aabbs[i] = { c - halves[i], c + halves[i] };
+				}
+			};
+
+		// ----- 木を組む（プロキシ番号 → 箱の番号） -----
+		place(0);
+		DynamicAABBTree tree;
+		std::vector<int> proxies(n), boxOf;
+		const double buildMs = MeasureMs([&]
+			{
+				for (int i = 0; i < n; i++) proxies[i] = tree.CreateProxy(aabbs[i], nullptr);
+			});
+		for (int i = 0; i < n; i++)
+		{
+			if ((int)boxOf.size() <= proxies[i]) boxOf.resize(proxies[i] + 1, -1);
+			boxOf[proxies[i]] = i;
+		}
+
+		// 組は小さい番号を上にしたキー（QueryBroadPairs と同じく、fat AABB で引いてから実際の AABB で確かめる）
+		auto key = [](int a, int b) { return ((uint64_t)(uint32_t)a << 32) | (uint32_t)b; };
+		std::vector<uint64_t> treePairs, allPairs;
+		treePairs.reserve((size_t)n * 8);
+		allPairs.reserve((size_t)n * 8);
+		double treeMs = 0.0, allMs = 0.0;
+		int bad = 0;
+		for (int frame = 1; frame <= Frames; frame++)
+		{
+			place(frame);
+			treeMs += MeasureMs([&]
+				{
+					treePairs.clear();
+					for (int i = 0; i < n; i++) tree.MoveProxy(proxies[i], aabbs[i]);
+					for (int i = 0; i < n; i++)
+					{
+						const AABB& aabbA = aabbs[i];
+						tree.Query(aabbA, [&](int proxyId)
+							{
+								const int j = boxOf[proxyId];
+								if (j > i && aabbA.isOverlap(aabbs[j])) treePairs.push_back(key(i, j));
+								return true;
+							});
+					}
+					std::sort(treePairs.begin(), treePairs.end()); // 木の形に依存しない順に
+				});
+			allMs += MeasureMs([&]
+				{
+					allPairs.clear();
+					for (int i = 0; i < n; i++)
+						for (int j = i + 1; j < n; j++)
+							if (aabbs[i].isOverlap(aabbs[j])) allPairs.push_back(key(i, j));
+				});
+			if (treePairs != allPairs)
+			{
+				std::vector<uint64_t> diff;
+				std::set_symmetric_difference(treePairs.begin(), treePairs.end(), allPairs.begin(), allPairs.end(), std::back_inserter(diff));
+				bad += (int)diff.size();
+			}
+		}
+
+		failures += bad;
+		fprintf(out, "%8d %9.3f %10.3f %12.3f %7.1fx %8d %9d%s\n", n, buildMs, treeMs / Frames, allMs / Frames,
+			treeMs > 0.0 ? allMs / treeMs : 0.0, (int)allPairs.size(), bad, bad ? "  FAIL" : "");
+	}
+	if (failures > 0) fprintf(out, "  BROADPHASE MISMATCH: %d\n", failures);
+	return failures;
+}
+int PhysicsBenchmark::RunSuite(FILE* out, const char* csvPrefix)
+{
+	assert(out);
+	RunAll(out, 600, 1, csvPrefix);
+	RunThreadScaling(out, 600, 8);
+	RunPipeline(out, 600, 4.0);
+	RunWarmStart(out, 300);
+
+	// 答え合わせ（食い違いを足していく）
+	int mismatches = 0;
+	mismatches += RunBroadphaseScaling(out);
+	mismatches += RunRaycast(out, 100000);
+	mismatches += RunDispatch(out);
+	mismatches += RunSimdCheck(out);
+	mismatches += RunSnapshot(out, 120, 120);
+	return mismatches;
+}
@@ -0,0 +1,94 @@
+/*
+	PhysicsBenchmark.h
+	20261017  hanaue sho
+	物理演算のベンチマーク（ウィンドウ、描画、アセット無しで回す）
+	決まった負荷のシーンを組んで固定ステップで回し、ステップ数/秒、フェーズごとの時間、安定性を出す
+	PhysicsSystem、コライダー、剛体、ジョイントと数学ヘッダーだけで動くようにしている（PhysicsSystemDebug.cpp は要らない）
+	Scene、Manager の実装（scene.cpp、Mnager.cpp）は描画に繋がるので、ゲームの外では PhysicsBenchmarkMain.cpp の代わりを使う
+	ゲームからは起動引数 -physbench、Linux などでは CMakeLists.txt の physbench で回す
+*/
+#ifndef PHYSICSBENCHMARK_H_
+#define PHYSICSBENCHMARK_H_
+#include <stdio.h>
+#include "PhysicsStats.h"
+
+namespace PhysicsBenchmark
+{
+	// --------------------------------------------------
+	// シーン
+	// --------------------------------------------------
+	enum class SceneType
+	{
+		BoxPyramid,	  // 箱のピラミッド（積み重ねの安定性）
+		AppleRain,	  // 100x100 の HeightMap にリンゴ（球）を降らせる
+		RagdollPile,  // ボール、ヒンジジョイントのラグドールを積む
+		TriggerField, // トリガーの並んだ床を球が転がる
+		SphereRain,	  // AppleRain と同じ HeightMap に球 1500 個（ブロードフェーズの負荷）
+		BoxStack,	  // 箱を６段積む（ウォームスタートと反復回数の効き）
+		BoxPile,	  // 箱 2000 個（10x10 を 20 段）を落とす、スリープ無し（並列ソルバーの負荷）
+		Count,
+	};
+	const char* SceneName(SceneType type);
+
+	// --------------------------------------------------
+	// 結果
+	// 安定性は最後の 1 秒（60 ステップ）の Dynamic の速さと、置いた位置からのずれ
+	// 積み上げたものが止まっていれば meanSpeed は 0 に近づく
+	// --------------------------------------------------
+	struct Result
+	{
+		SceneType type = SceneType::BoxPyramid;
+		int bodies = 0; // Dynamic の数
+		int joints = 0;
+		int steps  = 0;
+		double stepsPerSecond = 0.0; // オブジェクトの FixedUpdate 込み
+		double frameMs = 0.0;		 // １フレーム（FixedUpdate ＋ 本体スレッドの仕事）の平均
+		double avgStepMs = 0.0;		 // PhysicsSystem の１ステップ（平均）
+		double maxStepMs = 0.0;
+		double phaseMs[PhysicsStepStats::PhaseCount] = {}; // フェーズごとの平均
+		int	   avgContacts = 0;
+		int	   triggerEnters = 0; // TriggerField で数えた OnTriggerEnter
+		float  meanSpeed = 0.0f;  // 最後の 1 秒の平均の速さ [m/s]
+		float  maxSpeed  = 0.0f;  // 最後の 1 秒の最大の速さ [m/s]
+		float  maxDrift	 = 0.0f;  // 置いた位置からの水平方向のずれの最大 [m]（BoxPyramid で見る）
+		int	   lostBodies = 0;	  // 床を抜けて落ちていったもの
+	};
+
+	// --------------------------------------------------
+	// 実行
+	// Run: １シーンを steps ステップ回す（threads はソルバーのスレッド数）
+	// csvPath を渡すとステップごとの計測を CSV で書き出す
+	// RunAll: 全シーンを回して表を out に書く（csvPrefix があれば "<prefix><シーン名>.csv" も）
+	// RunThreadScaling: 全シーンをスレッド数 1, 2, 4, ... maxThreads で回して、並列にしたフェーズの時間と１スレッドからの速さを書く
+	// ２スレッド以上は同じ結果になるはずなので、２スレッドの結果と比べて same に書く
+	// RunPipeline: 全シーンを同期実行とパイプライン実行で回して、１フレームの時間と結果が同じかを書く
+	// mainThreadMs は１フレームごとに本体スレッドで回す仕事（Update / Draw の代わりに空回りする）の時間
+	// RunWarmStart: BoxStack をウォームスタートの on/off と速度の反復回数 3, 4, 8 で回して、積めたか（崩れず止まったか）を書く
+	// RunBroadphaseScaling: 箱 100、1000、10000 個の AABB を動的 AABB 木と全部の組の AABB::isOverlap で組にして、１フレームの時間と組が同じかを書く
+	// 木の方は MoveProxy で動かしてから引く（ステップごとの仕事と同じ）
+	// RunRaycast: HeightMap だけ、HeightMap ＋箱 400 個にレイを撃って本数/秒を書く（Raycast と RaycastMany）
+	// HeightMap の当たりは全三角形の総当たりと、RaycastMany は Raycast と比べて、食い違った本数を書く（0 でなければ壊れている）
+	// RunDispatch: ナローフェーズの判定を仮想関数（isOverlap）と ShapeDispatch のテーブルで回して、組/秒と食い違った組の数を書く
+	// 散らばった配列（キャッシュに乗らない）と、小さい配列を何度も回す（キャッシュに乗る）の２通り
+	// あわせて凸形状の全部の組で、Intersect（トリガー）と Overlap の当たり外れが同じかを見る
+	// RunSimdCheck: SimdKernels を CPU が対応している命令セットごとに回して、スカラー版（AABB::isOverlap、ShapeDispatch::Overlap）と
+	// ビット単位で比べる。食い違いは FAIL として書く
+	// RunSnapshot: warmSteps 回したところで保存して steps 回し、戻してもう一度 steps 回して、保存したバイト列と姿勢がビット単位で同じかを見る
+	// 直列、ソルバー４スレッド、パイプライン実行（ステップが走っている最中に保存、復元する）で確かめる
+	// あわせて SphereRain、BoxPile で保存＋復元１往復の時間を計って、1000 ボディあたり 1ms を超えたら食い違いと同じく数える
+	// RunSuite: 上を全部決まった設定で回す（-physbench と physbench の中身）、戻り値は答え合わせで食い違った数の合計
+	// --------------------------------------------------
+	Result Run(SceneType type, int steps, int threads = 1, const char* csvPath = nullptr, bool pipelined = false, double mainThreadMs = 0.0);
+	void   RunAll(FILE* out, int steps = 600, int threads = 1, const char* csvPrefix = nullptr);
+	void   RunThreadScaling(FILE* out, int steps = 600, int maxThreads = 8);
+	void   RunPipeline(FILE* out, int steps = 600, double mainThreadMs = 4.0);
+	void   RunWarmStart(FILE* out, int steps = 300);
+	int	   RunBroadphaseScaling(FILE* out);				 // 戻り値は食い違った組の数
+	int	   RunRaycast(FILE* out, int rayCount = 100000); // 戻り値は食い違った本数
+	int	   RunDispatch(FILE* out);						 // 戻り値は食い違った組の数
+	int	   RunSimdCheck(FILE* out);						 // 戻り値は食い違った数
+	int	   RunSnapshot(FILE* out, int warmSteps = 120, int steps = 120); // 戻り値は食い違った数
+	int	   RunSuite(FILE* out, const char* csvPrefix = nullptr);
+}
+
+#endif
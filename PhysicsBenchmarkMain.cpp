@@ -0,0 +1,110 @@
+/*
+	PhysicsBenchmarkMain.cpp
+	20261017  hanaue sho
+	物理ベンチマークだけの実行ファイル（CMakeLists.txt の physbench）
+	ウィンドウ、D3D、アセット無しで PhysicsBenchmark::RunSuite を回す
+	scene.cpp、Mnager.cpp は描画に繋がるので使わず、ベンチマークに要る分（物理の初期化と FixedUpdate）だけをここで実装する
+	ゲーム本体（vcxproj）には入れない（Scene、Manager の定義が重なる）
+*/
+#include <stdio.h>
+#include "PhysicsBenchmark.h"
+#include "Manager.h"
+#include "scene.h"
+#include "PhysicsSystem.h"
+
+// ==================================================
+// ----- Manager の代わり -----
+// シーンは PhysicsBenchmark が SwapScene で差し替える
+// ==================================================
+Scene* Manager::m_pScene = nullptr;
+Scene* Manager::m_pSceneNext = nullptr;
+
+void Manager::Init() {}
+void Manager::Uninit() {}
+void Manager::Update(float dt)		{ if (m_pScene) m_pScene->Update(dt); }
+void Manager::FixedUpdate(float dt) { if (m_pScene) m_pScene->FixedUpdate(dt); }
+void Manager::Draw() {}
+
+// ==================================================
+// ----- Scene の代わり -----
+// ライト、テクスチャ、描画は持たない
+// ==================================================
+Scene::~Scene() = default;
+
+void Scene::Init()
+{
+	m_pPhysicsSystem.reset(new PhysicsSystem(*this)); // make_unique は deleter には使えない
+	m_pPhysicsSystem->Init();
+}
+
+void Scene::Uninit()
+{
+	for (auto& gameObjectList : m_GameObjects)
+	{
+		for (auto* gameObject : gameObjectList)
+		{
+			if (!gameObject) continue;
+
+			gameObject->Uninit();
+			delete gameObject;
+		}
+		gameObjectList.clear();
+	}
+
+	if (m_pPhysicsSystem) { m_pPhysicsSystem->Shutdown(); m_pPhysicsSystem.reset(); }
+}
+
+void Scene::Update(float dt)
+{
+	for (auto& gameObjectList : m_GameObjects)
+	{
+		for (auto* gameObject : gameObjectList)
+		{
+			if (gameObject)
+				gameObject->Update(dt);
+		}
+	}
+}
+
+void Scene::FixedUpdate(float fixedDt)
+{
+	// scene.cpp と同じ順番（前のステップを待つ → スクリプト → 次のステップを渡す）
+	m_pPhysicsSystem->SyncStep();
+
+	for (auto& gameObjectList : m_GameObjects)
+	{
+		for (auto* gameObject : gameObjectList)
+		{
+			if (gameObject)
+				gameObject->FixedUpdate(fixedDt);
+		}
+	}
+
+	m_pPhysicsSystem->BeginStep(fixedDt);
+	m_pPhysicsSystem->KickStep(fixedDt);
+}
+
+void Scene::Draw() {}
+
+void PhysicsSystemDeleter::operator()(PhysicsSystem* p) noexcept { delete p; }
+void LightManagerDeleter::operator()(LightManager*) noexcept {} // LightManager は作らない
+
+// ==================================================
+// ----- main -----
+// physbench [表の出力先]（省略すると physbench.txt、ステップごとの計測は physbench_<シーン名>.csv）
+// 答え合わせで食い違いがあれば終了コードを 1 にする（-physbench と同じ）
+// ==================================================
+int main(int argc, char** argv)
+{
+	const char* path = argc > 1 ? argv[1] : "physbench.txt";
+	FILE* out = fopen(path, "w");
+	if (!out)
+	{
+		fprintf(stderr, "physbench: cannot open %s\n", path);
+		return 1;
+	}
+	const int mismatches = PhysicsBenchmark::RunSuite(out, "physbench_");
+	fclose(out);
+	printf("physbench: wrote %s, %d mismatches\n", path, mismatches);
+	return mismatches > 0 ? 1 : 0;
+}
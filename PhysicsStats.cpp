@@ -0,0 +1,125 @@
+/*
+	PhysicsStats.cpp
+	20261017  hanaue sho
+	物理演算の計測（フェーズごとの時間と件数）
+*/
+#include <assert.h>
+#include <stdio.h>
+#include "PhysicsStats.h"
+
+namespace
+{
+	// 形状の種類の名前（CSV / JSON の列名用）
+	const char* TypeName(int type)
+	{
+		static const char* names[] = { "Box", "Sphere", "Capsule", "MeshField", "TriangleMesh", "ConvexHull" };
+		static_assert(sizeof(names) / sizeof(names[0]) == ShapeDispatch::TypeCount, "add the new shape type name");
+		return names[type];
+	}
+	constexpr int PairTypeCount = ShapeDispatch::TypeCount * ShapeDispatch::TypeCount;
+}
+
+// ==================================================
+// ----- １ステップ分の計測 -----
+// ==================================================
+const char* PhysicsStepStats::PhaseName(int phase)
+{
+	static const char* names[] =
+	{
+		"Wake", "IntegrateForce", "BroadUpdate", "Broadphase", "Narrowphase", "PreSolve", "Solve",
+		"SolvePosition", "ContactCache", "Integrate", "Continuous", "Sleep", "Events", "SyncPose",
+	};
+	static_assert(sizeof(names) / sizeof(names[0]) == PhaseCount, "add the new phase name");
+	assert(0 <= phase && phase < PhaseCount);
+	return names[phase];
+}
+int PhysicsStepStats::NarrowphaseCallTotal() const
+{
+	int total = 0;
+	for (int k = 0; k < PairTypeCount; k++) total += narrowphaseCalls[k];
+	return total;
+}
+
+// ==================================================
+// ----- リングバッファ -----
+// ==================================================
+void PhysicsStatsHistory::SetCapacity(int capacity)
+{
+	assert(capacity > 0);
+	m_Buffer.assign(capacity, PhysicsStepStats{});
+	Clear();
+}
+void PhysicsStatsHistory::Push(const PhysicsStepStats& stats)
+{
+	m_Buffer[m_Head] = stats;
+	m_Head = (m_Head + 1) % Capacity();
+	if (m_Count < Capacity()) m_Count++;
+}
+const PhysicsStepStats& PhysicsStatsHistory::At(int i) const
+{
+	assert(0 <= i && i < m_Count);
+	const int oldest = (m_Head - m_Count + Capacity()) % Capacity();
+	return m_Buffer[(oldest + i) % Capacity()];
+}
+
+// --------------------------------------------------
+// CSV
+// step, total, フェーズの時間..., 件数..., 判定回数（使われた組だけでなく全部の組）
+// --------------------------------------------------
+bool PhysicsStatsHistory::WriteCSV(const char* path) const
+{
+	FILE* file = fopen(path, "w");
+	if (!file) return false;
+
+	fprintf(file, "step,totalMs");
+	for (int p = 0; p < PhysicsStepStats::PhaseCount; p++) fprintf(file, ",%sMs", PhysicsStepStats::PhaseName(p));
+	fprintf(file, ",broadphaseTests,broadphasePairs,broadphaseSkipped,triggerPairs,contacts,joints,solverIslands,velocityIterations,positionIterations,events,awakeBodies,sleepingBodies");
+	for (int k = 0; k < PairTypeCount; k++)
+		fprintf(file, ",narrow%sx%s", TypeName(k / ShapeDispatch::TypeCount), TypeName(k % ShapeDispatch::TypeCount));
+	fprintf(file, "\n");
+
+	for (int i = 0; i < m_Count; i++)
+	{
+		const PhysicsStepStats& s = At(i);
+		fprintf(file, "%u,%.4f", s.step, s.totalMs);
+		for (int p = 0; p < PhysicsStepStats::PhaseCount; p++) fprintf(file, ",%.4f", s.phaseMs[p]);
+		fprintf(file, ",%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d", s.broadphaseTests, s.broadphasePairs, s.broadphaseSkipped, s.triggerPairs, s.contacts, s.joints,
+			s.solverIslands, s.velocityIterations, s.positionIterations, s.events, s.awakeBodies, s.sleepingBodies);
+		for (int k = 0; k < PairTypeCount; k++) fprintf(file, ",%d", s.narrowphaseCalls[k]);
+		fprintf(file, "\n");
+	}
+	fclose(file);
+	return true;
+}
+// --------------------------------------------------
+// JSON
+// 判定回数は 0 でない組だけ { "Sphere-Box": 12 } のように書く
+// --------------------------------------------------
+bool PhysicsStatsHistory::WriteJSON(const char* path) const
+{
+	FILE* file = fopen(path, "w");
+	if (!file) return false;
+
+	fprintf(file, "[\n");
+	for (int i = 0; i < m_Count; i++)
+	{
+		const PhysicsStepStats& s = At(i);
+		fprintf(file, "  {\"step\": %u, \"totalMs\": %.4f, \"phaseMs\": {", s.step, s.totalMs);
+		for (int p = 0; p < PhysicsStepStats::PhaseCount; p++)
+			fprintf(file, "%s\"%s\": %.4f", p ? ", " : "", PhysicsStepStats::PhaseName(p), s.phaseMs[p]);
+		fprintf(file, "}, \"broadphaseTests\": %d, \"broadphasePairs\": %d, \"broadphaseSkipped\": %d, \"triggerPairs\": %d, \"contacts\": %d, \"joints\": %d, \"solverIslands\": %d, \"velocityIterations\": %d, \"positionIterations\": %d, \"events\": %d, \"awakeBodies\": %d, \"sleepingBodies\": %d, \"narrowphaseCalls\": {",
+			s.broadphaseTests, s.broadphasePairs, s.broadphaseSkipped, s.triggerPairs, s.contacts, s.joints, s.solverIslands, s.velocityIterations, s.positionIterations,
+			s.events, s.awakeBodies, s.sleepingBodies);
+		bool first = true;
+		for (int k = 0; k < PairTypeCount; k++)
+		{
+			if (s.narrowphaseCalls[k] == 0) continue;
+			fprintf(file, "%s\"%s-%s\": %d", first ? "" : ", ", TypeName(k / ShapeDispatch::TypeCount), TypeName(k % ShapeDispatch::TypeCount), s.narrowphaseCalls[k]);
+			first = false;
+		}
+		fprintf(file, "}}%s\n", i + 1 < m_Count ? "," : "");
+	}
+	fprintf(file, "]\n");
+	fclose(file);
+	return true;
+}
@@ -0,0 +1,105 @@
+/*
+	PhysicsStats.h
+	20261017  hanaue sho
+	物理演算の計測（フェーズごとの時間と件数）
+	PhysicsSystem が毎ステップ埋めて、直近 N ステップ分をリングバッファに残す
+	CSV / JSON に書き出して、重いフレームがどのフェーズから来ているかを後で見る
+*/
+#ifndef PHYSICSSTATS_H_
+#define PHYSICSSTATS_H_
+#include <cstdint>
+#include <vector>
+#include "ShapeDispatch.h"
+
+// ==================================================
+// ----- １ステップ分の計測 -----
+// ==================================================
+struct PhysicsStepStats
+{
+	// --------------------------------------------------
+	// フェーズ（ステップの中で実行する順）
+	// --------------------------------------------------
+	enum Phase : uint8_t
+	{
+		Wake,			 // 眠っているアイランドを起こす
+		IntegrateForce,	 // 外力 → 速度
+		BroadUpdate,	 // WorldAABB 更新と木の組み替え
+		Broadphase,		 // 候補ペア集め
+		Narrowphase,	 // 形状ごとの判定
+		PreSolve,		 // 接触、ジョイントの事前計算とソルバーボディ
+		Solve,			 // 速度の反復
+		SolvePosition,	 // めり込み解消（擬似速度の反復）
+		ContactCache,	 // 累積インパルスの持ち越し
+		Integrate,		 // 減衰と速度積分
+		Continuous,		 // CCD
+		Sleep,			 // アイランド構築と眠りの判定
+		Events,			 // ペア集合の差分とイベント配信
+		SyncPose,		 // WorldPose の同期
+		PhaseCount,
+	};
+	static const char* PhaseName(int phase);
+
+	// --------------------------------------------------
+	// 時間 [ms]
+	// --------------------------------------------------
+	double phaseMs[PhaseCount] = {};
+	double totalMs = 0.0;
+
+	// --------------------------------------------------
+	// 件数
+	// --------------------------------------------------
+	uint32_t step = 0;			  // 何ステップ目か
+	int broadphaseTests = 0;	  // 木から引いて AABB を比べた数
+	int broadphasePairs = 0;	  // ナローに回した候補ペア
+	int broadphaseSkipped = 0;	  // 種類で省いた組（静的同士、Kinematic×Static、Kinematic 同士）
+	int triggerPairs = 0;		  // 重なりだけの判定に回したトリガーのペア（narrowphaseCalls には入らない）
+	int narrowphaseCalls[ShapeDispatch::TypeCount * ShapeDispatch::TypeCount] = {}; // 形状の組ごとの判定回数（ShapeDispatch::PairIndex）
+	int contacts = 0;			  // 解いた接触
+	int joints = 0;				  // 解いたジョイント
+	int solverIslands = 0;		  // 速度を解いたアイランド
+	int velocityIterations = 0;	  // 実際に回した速度の反復（一番多く回したアイランドの回数）
+	int positionIterations = 0;	  // 実際に回しためり込み解消の反復
+	int events = 0;				  // 配信したイベント（Enter / Stay / Exit のペア数）
+	int awakeBodies = 0;		  // 起きている Dynamic
+	int sleepingBodies = 0;		  // 眠っている Dynamic
+
+	int NarrowphaseCallTotal() const;
+};
+
+// ==================================================
+// ----- 直近 N ステップのリングバッファ -----
+// ==================================================
+class PhysicsStatsHistory
+{
+private:
+	std::vector<PhysicsStepStats> m_Buffer;
+	int m_Head  = 0; // 次に書く場所
+	int m_Count = 0;
+
+public:
+	explicit PhysicsStatsHistory(int capacity = 600) { SetCapacity(capacity); }
+
+	// --------------------------------------------------
+	// 容量（変えると中身は消える）
+	// --------------------------------------------------
+	void SetCapacity(int capacity);
+	int  Capacity() const { return (int)m_Buffer.size(); }
+	int  Size() const { return m_Count; }
+	void Clear() { m_Head = 0; m_Count = 0; }
+
+	// --------------------------------------------------
+	// 追加、参照（At(0) が一番古い、At(Size() - 1) が最新）
+	// --------------------------------------------------
+	void Push(const PhysicsStepStats& stats);
+	const PhysicsStepStats& At(int i) const;
+	const PhysicsStepStats& Latest() const { return At(m_Count - 1); }
+
+	// --------------------------------------------------
+	// 書き出し（古い順、失敗したら false）
+	// CSV は１行１ステップ、JSON はステップの配列
+	// --------------------------------------------------
+	bool WriteCSV (const char* path) const;
+	bool WriteJSON(const char* path) const;
+};
+
+#endif
@@ -1,12 +1,15 @@
 /*
 	PhysicsSystem.cpp
 	20250821  hanaue sho
-	Z
+	物理演算
 */
 #include <assert.h>
 #include <algorithm>
+#include <cstring>
+#include <cfloat>
+#include <type_traits>
 #include "PhysicsSystem.h"
-#include "Scene.h"
+#include "scene.h"
 #include "Component.h"
 #include "TransformComponent.h"
 #include "ColliderComponent.h"
@@ -14,23 +17,54 @@
 #include "DistanceJointComponent.h"
 #include "BallJointComponent.h"
 #include "HingeJointComponent.h"
-#include "Collision.h"
+#include "collision.h"
 #include "ContactManifold.h"
-
-#include "DebugRenderer.h"
+#include "Triangle.h"
+#include "GJK.h"
+#include "TriangleMeshBVH.h"
+#include "ConvexHull.h"
 
 namespace
 {
-	Vector3 Gravity = { 0.0f, -9.8f, 0.0f }; // KvȂO
-	const float Slop = 0.005f;				 // eʁi傫Ƃ߂荞ނj
-	const float RestThreshold = 0.2f;		 // oCAXe
-	const float Baumgarte = 0.2f;			 // ʒu␳̌W
+	Vector3 Gravity = { 0.0f, -9.8f, 0.0f }; // 必要なら０
+	const float Slop = 0.005f;				 // 許容量（大きすぎるとめり込むよ）
+	const float RestThreshold = 0.2f;		 // 反発バイアス許容量
+	const float Baumgarte = 0.8f;			 // １ステップで戻すめり込みの割合（擬似速度）
+	const float VelocityBaumgarte = 0.2f;	 // 浅いめり込みを速度でも戻す係数（積み上げの傾きを止める）
+	const float MaxBiasPenetration = 0.01f;	 // 速度で戻すめり込みの上限（深い分は擬似速度だけ、飛び出す速さは 0.2 * 0.01 / dt まで）
+	const float SpeculativeMargin = 0.002f;	 // これだけ離れている点も接触点に残す（浮きかけた角のインパルスを切らさない）
+	const float WarmStartNormalDot = 0.95f;	 // キャッシュを使う法線の一致度（cos）
+	const float WarmStartMatchDist = 0.05f;	 // 接触点を同じとみなす距離
+	const float SleepLinearTolerance  = 0.05f; // 眠れる速度
+	const float SleepAngularTolerance = 0.05f; // 眠れる角速度
+	const float TimeToSleep = 0.5f;			   // この時間静止していたら眠る
+	const int	MaxSolverColors  = 64;			   // 並列ソルバーの色数（ボディごとに uint64_t のビットで持つ）
+	const int	MinParallelBatch = 16;			   // これより小さいバッチは１スレッドで解く
+	const int	MinParallelPairs = 64;			   // ナローのペアがスレッドあたりこれより少なければ１スレッドで判定する
+	const int	MinParallelAABBs = 128;			   // WorldAABB の更新がスレッドあたりこれより少なければ１スレッドで回す
+	const int	SphereLaneAlign	 = 8;			   // 球 × 球をスレッドで区切るときの幅（SIMD の端数処理がスレッド数で変わらないように）
+	const int	CCDBisectionIterations = 8;		   // CCD で当たった区間を詰める回数
+	const int	RayPacketSize = 64;				   // RaycastMany で木を一緒に辿るレイの本数
+
+	// 浅いめり込みを戻す目標の法線速度（MaxBiasPenetration で頭打ち）
+	// 離れている点（SpeculativeMargin の内側）は、次のステップで隙間がちょうど閉じる速さまで近づいてよい
+	float ContactPositionBias(float penetration, float dt)
+	{
+		if (penetration < 0.0f) return dt > 0.0f ? penetration / dt : 0.0f;
+		const float C = std::min(penetration - Slop, MaxBiasPenetration);
+		return C > 0.0f && dt > 0.0f ? VelocityBaumgarte * C / dt : 0.0f;
+	}
 
-	// Nv
-	float Clamp(float value, float min, float max)
+	// 本当に触れている点があるか（SpeculativeMargin で拾った離れている点だけなら Collision イベントにしない）
+	// イベントは Overlap(slop 0) のときと同じにする
+	bool HasPenetratingPoint(const ContactManifold& m)
 	{
-		return value < min ? min : (value > max ? max : value);
+		if (m.count == 0) return true;
+		for (int i = 0; i < m.count; i++)
+			if (m.points[i].penetration >= 0.0f) return true;
+		return false;
 	}
+
 	// PassModeFilter
 	bool PassModeFilter(const Collider* col, const QueryOptions& opt)
 	{
@@ -40,7 +74,43 @@ namespace
 		if (col->IsQuery())	   return opt.isQueryOnly;
 		return false;
 	}
-	// ő[x
+	// Query の相手として見るか（Mode とレイヤー）
+	bool PassQueryFilter(const Collider* col, const QueryOptions& opt)
+	{
+		if (!PassModeFilter(col, opt)) return false;
+		return (opt.layerMask & (uint32_t(1) << col->Owner()->PhysicsLayer())) != 0;
+	}
+	// 起きている Dynamic か
+	bool IsAwakeDynamic(const Rigidbody* rb)
+	{
+		return rb && rb->IsDynamic() && !rb->IsSleeping();
+	}
+	// 動いている Kinematic か
+	bool IsMovingKinematic(const Rigidbody* rb)
+	{
+		if (!rb || !rb->IsKinematic()) return false;
+		return rb->KinematicVelocity().lengthSq() > 0.0f || rb->KinematicAngularVelocity().lengthSq() > 0.0f;
+	}
+	// 剛体の状態
+	enum class BodyState
+	{
+		Static,	  // 動かない（Rigidbody 無し、止まっている Kinematic）
+		Sleeping, // 眠っている Dynamic
+		Awake,	  // 起きている Dynamic、動いている Kinematic
+	};
+	// Rigidbody の無いコライダーは静的扱い（スクリプトで動かして押すなら相手を WakeUp すること）
+	BodyState GetBodyState(const Rigidbody* rb)
+	{
+		if (IsAwakeDynamic(rb) || IsMovingKinematic(rb)) return BodyState::Awake;
+		if (rb && rb->IsSleeping()) return BodyState::Sleeping;
+		return BodyState::Static;
+	}
+	// 眠っている剛体のコライダーか
+	bool IsSleepingCollider(const Collider* col)
+	{
+		return col && col->Body() && col->Body()->IsSleeping();
+	}
+	// 最大深度
 	float GetMaxPenetration(const ContactManifold& m)
 	{
 		float p = 0.0f;
@@ -48,10 +118,111 @@ namespace
 			p = std::max(p, m.points[i].penetration);
 		return p;
 	}
+	// AABB の結合
+	AABB Combine(const AABB& a, const AABB& b)
+	{
+		AABB out;
+		out.min = Vector3(std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y), std::min(a.min.z, b.min.z));
+		out.max = Vector3(std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y), std::max(a.max.z, b.max.z));
+		return out;
+	}
+	// 形状の一番薄いところの半分の厚み（CCD の刻み幅）
+	// この刻みで動かせば、途中にある物を必ずどこかで踏む
+	float ComputeMinExtent(const Collision& shape, const Vector3& scale)
+	{
+		const float s = std::min(fabsf(scale.x), std::min(fabsf(scale.y), fabsf(scale.z)));
+		if (auto* sphere = dynamic_cast<const SphereCollision*>(&shape))
+			return sphere->Radius() * fabsf(scale.x);
+		if (auto* capsule = dynamic_cast<const CapsuleCollision*>(&shape))
+			return capsule->Radius() * s;
+		if (auto* box = dynamic_cast<const BoxCollision*>(&shape))
+		{
+			const Vector3& h = box->HalfSize();
+			return std::min(h.x * fabsf(scale.x), std::min(h.y * fabsf(scale.y), h.z * fabsf(scale.z)));
+		}
+		if (auto* hull = dynamic_cast<const ConvexHullCollision*>(&shape))
+			return hull->Hull().InnerRadius() * s;
+		return 0.0f; // HeightMap などは動かす対象にしない
+	}
+	// Collision をキャスト用の凸形状にする（HeightMap、TriangleMesh は三角形ごとに作るので false）
+	bool MakeSupportShape(const Collision& shape, const ColliderPose& pose, SupportShape& out)
+	{
+		if (auto* sphere = dynamic_cast<const SphereCollision*>(&shape))
+		{
+			out = SupportShape::Sphere(pose.position, sphere->Radius() * fabsf(pose.scale.x));
+			return true;
+		}
+		if (auto* capsule = dynamic_cast<const CapsuleCollision*>(&shape))
+		{
+			const Vector3 up = pose.WorldUp();
+			const float halfCylinder = capsule->CylinderHeight() * fabsf(pose.scale.y) * 0.5f;
+			const float radius = capsule->Radius() * std::max(fabsf(pose.scale.x), fabsf(pose.scale.z));
+			out = SupportShape::Capsule(pose.position + up * halfCylinder, pose.position - up * halfCylinder, radius);
+			return true;
+		}
+		if (auto* box = dynamic_cast<const BoxCollision*>(&shape))
+		{
+			const Vector3 axes[3] = { pose.WorldRight(), pose.WorldUp(), pose.WorldForward() };
+			const Vector3 half(box->HalfSize().x * fabsf(pose.scale.x), box->HalfSize().y * fabsf(pose.scale.y), box->HalfSize().z * fabsf(pose.scale.z));
+			out = SupportShape::Box(pose.position, axes, half);
+			return true;
+		}
+		if (auto* hull = dynamic_cast<const ConvexHullCollision*>(&shape))
+		{
+			const Vector3 axes[3] = { pose.WorldRight(), pose.WorldUp(), pose.WorldForward() };
+			out = SupportShape::Hull(&hull->Hull(), pose.position, axes, pose.scale);
+			return true;
+		}
+		return false;
+	}
+	// --------------------------------------------------
+	// 掃引（保守的前進）
+	// startPose から delta * maxT まで、extent 以下の刻みで進めて最初に重なる区間を探し、二分探索で詰める
+	// Slop を超えてめり込んだら当たりとみなす
+	// outT は当たる直前（めり込みが Slop 以内）の割合、outNormal は自分→相手
+	// 最初からめり込んでいる相手は通常の接触に任せるので false
+	// --------------------------------------------------
+	bool SweepShape(const Collision& shape, const ColliderPose& startPose, const Vector3& delta, float extent,
+					const Collision& other, const ColliderPose& otherPose, float maxT, float& outT, Vector3& outNormal)
+	{
+		auto hitAt = [&](float t, Vector3* normal)
+			{
+				ColliderPose pose = startPose;
+				pose.position = startPose.position + delta * t;
+				ContactManifold m;
+				if (!shape.isOverlap(pose, other, otherPose, m, 0.0f)) return false;
+				if (!m.touching || m.count <= 0) return false;
+				if (GetMaxPenetration(m) <= Slop) return false; // 触れているだけなら通常の接触に任せる（滑っている間に止めない）
+				if (normal) *normal = m.normal;
+				return true;
+			};
+		if (hitAt(0.0f, nullptr)) return false;
+
+		const int steps = std::max(1, (int)ceilf(delta.length() * maxT / extent));
+		float prev = 0.0f;
+		for (int i = 1; i <= steps; i++)
+		{
+			const float t = maxT * (float)i / (float)steps;
+			if (!hitAt(t, nullptr)) { prev = t; continue; }
+
+			// ----- 当たった区間を二分探索 -----
+			float lo = prev, hi = t;
+			for (int k = 0; k < CCDBisectionIterations; k++)
+			{
+				const float mid = 0.5f * (lo + hi);
+				if (hitAt(mid, nullptr)) hi = mid;
+				else					 lo = mid;
+			}
+			hitAt(hi, &outNormal);
+			outT = lo;
+			return true;
+		}
+		return false;
+	}
 }
 
 // --------------------------------------------------
-// AI
+// 初期化、終了処理
 // --------------------------------------------------
 void PhysicsSystem::Init()
 {
@@ -61,56 +232,104 @@ void PhysicsSystem::Init()
 	m_CurrTrigger.clear();
 	m_PrevCollision.clear();
 	m_CurrCollision.clear();
+	m_CollisionPartnerStart.clear();
+	m_CollisionPartners.clear();
 	m_TriggerEnter.clear();
 	m_TriggerStay.clear();
 	m_TriggerExit.clear();
 	m_CollisionEnter.clear();
 	m_CollisionStay.clear();
 	m_CollisionExit.clear();
-	m_NextId = 0; m_FreeIds.clear(); m_ById.clear();
+	m_NextId = 0; m_FreeIds.clear(); m_RetiredIds.clear(); m_ById.clear(); m_ColliderSlot.clear();
+	m_BroadPhase.Clear();
+	m_StaticColliders.clear();
+	m_KinematicColliders.clear();
+	m_DynamicColliders.clear();
+	m_TriggerColliders.clear();
+	m_MovingColliders.clear();
+	m_BroadSetOf.clear();
+	m_BroadWoken.clear();
+	m_MovedStatics.clear();
+	m_BroadSetsDirty  = true;
+	m_StaticPairCount = 0;
+	m_CandidatePairs.clear();
+	m_TriggerPairs.clear();
+	m_ContactCache.clear();
+	m_IslandBodies.clear();
+	m_IslandParent.clear();
+	m_SleepingIslands.clear();
+	m_NextIslandId = 1;
 
 	for (int i = 0; i < MaxLayers; i++)
-		m_CollisionMask[i] = 0xFFFFFFFFu; // Ƃ肠SON
-	SetCollision(30, 31, false); // 30: Playerf{[, 31: CharacterControllerComponent
+		m_CollisionMask[i] = 0xFFFFFFFFu; // とりあえず全部ON
+	SetCollision(30, 31, false); // 30: Playerモデルボーン, 31: CharacterControllerComponent
 	SetCollision(29, 30, false); // 29: BoomerangObject
 }
 void PhysicsSystem::Shutdown()
 {
+	// 走っているステップは書き戻さずに捨てる（オブジェクトは先に破棄されている）
+	WaitStep();
+	m_StepInFlight = false;
+	m_UseStepPoses = false;
+	m_BodyCommands.clear();
+	m_PendingColliders.clear();
+	m_PendingRigidbodies.clear();
+	StopStepThread();
+
 	m_Colliders.clear();
 	m_Rigidbodies.clear();
 	m_PrevTrigger.clear();
 	m_CurrTrigger.clear();
 	m_PrevCollision.clear();
 	m_CurrCollision.clear();
+	m_CollisionPartnerStart.clear();
+	m_CollisionPartners.clear();
 	m_TriggerEnter.clear();
 	m_TriggerStay.clear();
 	m_TriggerExit.clear();
 	m_CollisionEnter.clear();
 	m_CollisionStay.clear();
 	m_CollisionExit.clear();
+	m_BroadPhase.Clear();
+	m_StaticColliders.clear();
+	m_KinematicColliders.clear();
+	m_DynamicColliders.clear();
+	m_TriggerColliders.clear();
+	m_MovingColliders.clear();
+	m_BroadSetOf.clear();
+	m_BroadWoken.clear();
+	m_MovedStatics.clear();
+	m_BroadSetsDirty  = true;
+	m_StaticPairCount = 0;
+	m_CandidatePairs.clear();
+	m_TriggerPairs.clear();
+	m_ContactCache.clear();
+	m_IslandBodies.clear();
+	m_IslandParent.clear();
+	m_SleepingIslands.clear();
 	m_pScene = nullptr;
 }
 void PhysicsSystem::SetCollision(int layerA, int layerB, bool enable)
 {
-	assert(0 <= layerA, && layerA < MaxLayers);
-	assert(0 <= layerB, && layerB < MaxLayers);
+	assert(0 <= layerA && layerA < MaxLayers);
+	assert(0 <= layerB && layerB < MaxLayers);
 
 	// uint32_t(1) = 0000...0001
-	// uint32_t(1) << 2 = 0000...010 i3rbgڂPj
+	// uint32_t(1) << 2 = 0000...010 （下から3ビット目だけが１）
 	uint32_t bitA = (uint32_t(1) << layerA);
 	uint32_t bitB = (uint32_t(1) << layerB);
 	if (enable)
 	{
-		// |= : ORZq ̂
-		// bitB ̂PĂꏊƓ CollisionMask ̏ꏊɂP𗧂Ă
+		// |= : OR演算子 のこと
+		// bitB の１が立っている場所と同じ CollisionMask の場所に１を立てる
 		m_CollisionMask[layerA] |= bitB;
 		m_CollisionMask[layerB] |= bitA;
 	}
 	else
 	{
-		// ~ : 1111...1 ƂNANDZ
-		// bitB = 0000...0100 ̂Ƃ ~bitB = 1111...1011
-		// &= : NOTZqibitB ̂PĂꏊOɂ鏈j
+		// ~ : 1111...1 とのNAND演算
+		// bitB = 0000...0100 のとき ~bitB = 1111...1011
+		// &= : NOT演算子（bitB の１が立っている場所を０にする処理）
 		m_CollisionMask[layerA] &= ~bitB;
 		m_CollisionMask[layerB] &= ~bitA;
 	}
@@ -123,97 +342,163 @@ bool PhysicsSystem::ShouldCollide(const Collider& a, const Collider& b) const
 	uint32_t maskA = m_CollisionMask[layerA];
 	uint32_t maskB = m_CollisionMask[layerB];
 
-	// ݂̃}XNɑ̃rbgĂ邩
+	// お互いのマスクに相手のビットが立っているかを見る
 	bool aWants = (maskA & (uint32_t(1) << layerB)) != 0;
 	bool bWants = (maskB & (uint32_t(1) << layerA)) != 0;
 
-	// }gNXΏ̂ɂĂȂAǂ炩Е̃`FbNł
+	// マトリクスを対称にしているなら、どちらか片方のチェックだけでもいい
 	return aWants && bWants;
 }
 // --------------------------------------------------
-// o^A 
+// 登録、解除 
 // --------------------------------------------------
 int PhysicsSystem::RegisterCollider(Collider* c)
 {
 	assert(c);
 	assert(c->m_Id == -1 && "already registered");
+	c->m_pPhysics = this;
+
+	// パイプライン実行でステップが走っている間は、SyncStep まで溜める（ID はそのときに振る）
+	if (m_StepInFlight && std::this_thread::get_id() == m_MainThreadId)
+	{
+		m_PendingColliders.push_back(c);
+		return -1;
+	}
 
 	int id;
 	if (!m_FreeIds.empty()) { id = m_FreeIds.back(); m_FreeIds.pop_back(); }
-	else { id = m_NextId++; m_ById.resize(m_NextId, nullptr); }
+	else { id = m_NextId++; m_ById.resize(m_NextId, nullptr); m_ColliderSlot.resize(m_NextId, -1); m_BroadSetOf.resize(m_NextId, BroadSet::None); m_BroadWoken.resize(m_NextId, 0); m_ShapeRecords.resize(m_NextId); m_WorldAABBs.Resize(m_NextId); }
 	c->m_Id = id;
-	m_ById[id] = c; // tpɓo^
+	m_ById[id] = c; // 逆引き用に登録
+	UpdateShapeRecord(c);
 
+	c->m_pBody = c->Owner()->GetComponent<Rigidbody>(); // 後から付く場合は RegisterRigidbody で設定
 	c->UpdateWorldAABB();
+	m_WorldAABBs.Set(id, c->WorldAABB());
+	c->m_ProxyId = m_BroadPhase.CreateProxy(c->WorldAABB(), c); // ブロードフェーズ木に登録
+	m_ColliderSlot[id] = (int)m_Colliders.size();
 	m_Colliders.push_back(c);
+	m_BroadSetOf[id] = BroadSet::None;
+	m_BroadSetsDirty = true;
 	return id;
 }
 void PhysicsSystem::UnregisterCollider(Collider* c)
 {
-	if (!c || c->m_Id < 0) return;
-
-	// yAW珜
-	const int id = c->m_Id;
-	for (auto it = m_PrevTrigger.begin(); it != m_PrevTrigger.end();)
-	{
-		int a = KeyHigh(*it), b = KeyLow(*it);
-		if (a == id || b == id) it = m_PrevTrigger.erase(it);
-		else it++;
-	}
-	for (auto it = m_CurrTrigger.begin(); it != m_CurrTrigger.end();)
-	{
-		int a = KeyHigh(*it), b = KeyLow(*it);
-		if (a == id || b == id) it = m_CurrTrigger.erase(it);
-		else it++;
-	}
-	for (auto it = m_PrevCollision.begin(); it != m_PrevCollision.end();)
+	if (!c) return;
+	if (c->m_Id < 0)
 	{
-		int a = KeyHigh(*it), b = KeyLow(*it);
-		if (a == id || b == id) it = m_PrevCollision.erase(it);
-		else it++;
+		// まだ登録を溜めていただけ
+		auto it = std::find(m_PendingColliders.begin(), m_PendingColliders.end(), c);
+		if (it != m_PendingColliders.end()) m_PendingColliders.erase(it);
+		c->m_pPhysics = nullptr;
+		return;
 	}
-	for (auto it = m_CurrCollision.begin(); it != m_CurrCollision.end();)
+	WaitStep(); // 物理スレッドが触っている配列を変えるので
+	StopWatchingStatic(c);
+	m_MovedStatics.erase(std::remove(m_MovedStatics.begin(), m_MovedStatics.end(), c), m_MovedStatics.end());
+
+	// 乗っていた相手が眠っていたら起こす（支えが消えるので）
+	const int id = c->m_Id;
+	WakeIsland(c->m_pBody);
+	WakeCollisionPartners(id);
+
+	// ブロードフェーズ木から除去
+	if (c->m_ProxyId >= 0)
 	{
-		int a = KeyHigh(*it), b = KeyLow(*it);
-		if (a == id || b == id) it = m_CurrCollision.erase(it);
-		else it++;
+		m_BroadPhase.DestroyProxy(c->m_ProxyId);
+		c->m_ProxyId = -1;
 	}
 
-	// t
+	// 逆引き
+	// ペア集合と接触キャッシュに残ったキーは読み飛ばし、次のステップの始めにまとめて落とす
+	// それまで ID は再利用しない（新しいコライダーが古いペアを引き継がないように）
 	m_ById[id] = nullptr;
-	m_FreeIds.push_back(id);
-
-	// Xg珜O
-	auto it = std::find(m_Colliders.begin(), m_Colliders.end(), c);
-	if (it != m_Colliders.end()) { *it = m_Colliders.back(); m_Colliders.pop_back(); }
+	m_ShapeRecords[id] = ShapeRecord();
+	m_WorldAABBs.Clear(id);
+	m_RetiredIds.push_back(id);
+
+	// リストから除外（末尾と入れ替え）
+	const int slot = m_ColliderSlot[id];
+	assert(slot >= 0 && m_Colliders[slot] == c);
+	m_Colliders[slot] = m_Colliders.back();
+	m_ColliderSlot[m_Colliders[slot]->m_Id] = slot;
+	m_Colliders.pop_back();
+	m_ColliderSlot[id] = -1;
+	m_BroadSetOf[id] = BroadSet::None;
+	m_BroadSetsDirty = true;
 	c->m_Id = -1;
+	c->m_pPhysics = nullptr;
+}
+void PhysicsSystem::UpdateShapeRecord(Collider* c)
+{
+	assert(c && c->m_Id >= 0);
+	if (!c->Shape()) return;
+	WaitStep();
+	const ColliderPose pose = m_ShapeRecords[c->m_Id].pose;
+	m_ShapeRecords[c->m_Id] = ShapeDispatch::MakeRecord(c->m_Type, c->Shape());
+	m_ShapeRecords[c->m_Id].pose = pose;
+	if (m_BroadSetOf[c->m_Id] == BroadSet::Static) RefreshStaticCollider(c); // 大きさが変わるので木も合わせる
 }
 void PhysicsSystem::RegisterRigidbody(Rigidbody* rb)
 {
 	assert(rb);
-	// o^ς݃`FbN
+	// 登録済みチェック
 	auto it = std::find(m_Rigidbodies.begin(), m_Rigidbodies.end(), rb);
-	if (it != m_Rigidbodies.end()) return; // ɓo^ς
+	if (it != m_Rigidbodies.end()) return; // 既に登録済み
+
+	rb->m_pPhysics = this;
+	// パイプライン実行でステップが走っている間は、SyncStep まで溜める
+	if (m_StepInFlight && std::this_thread::get_id() == m_MainThreadId)
+	{
+		if (std::find(m_PendingRigidbodies.begin(), m_PendingRigidbodies.end(), rb) == m_PendingRigidbodies.end())
+			m_PendingRigidbodies.push_back(rb);
+		return;
+	}
 
 	m_Rigidbodies.push_back(rb);
+	m_BroadSetsDirty = true; // ボディが付くと区分が変わる
+
+	// 同じ GameObject のコライダーに紐づける
+	rb->Owner()->ForEachComponent([rb](Component* comp)
+		{
+			if (auto* col = dynamic_cast<Collider*>(comp)) col->m_pBody = rb;
+		});
 }
 void PhysicsSystem::UnregisterRigidbody(Rigidbody* rb)
 {
 	if (!rb) return;
+	WaitStep(); // 物理スレッドが読んでいる m_pPhysics や、積んでいる m_NewSleepers を変えるので先に待つ
+
+	// 溜めていた操作と起こす候補を捨てる
+	StopWatching(rb);
+	m_WakeRequests.erase(std::remove(m_WakeRequests.begin(), m_WakeRequests.end(), rb), m_WakeRequests.end());
+	m_NewSleepers.erase(std::remove(m_NewSleepers.begin(), m_NewSleepers.end(), rb), m_NewSleepers.end());
+	rb->m_pPhysics = nullptr;
+	m_BodyCommands.erase(std::remove_if(m_BodyCommands.begin(), m_BodyCommands.end(), [rb](const BodyCommand& cmd) { return cmd.rb == rb; }), m_BodyCommands.end());
+	auto pending = std::find(m_PendingRigidbodies.begin(), m_PendingRigidbodies.end(), rb);
+	if (pending != m_PendingRigidbodies.end()) { m_PendingRigidbodies.erase(pending); return; } // まだ登録を溜めていただけ
+
+	WakeIsland(rb); // 一緒に眠っていた剛体を起こす
+	m_BroadSetsDirty = true;
+	rb->Owner()->ForEachComponent([rb](Component* comp)
+		{
+			if (auto* col = dynamic_cast<Collider*>(comp); col && col->m_pBody == rb) col->m_pBody = nullptr;
+		});
 	auto it = std::find(m_Rigidbodies.begin(), m_Rigidbodies.end(), rb);
-	if (it != m_Rigidbodies.end()) { *it = m_Rigidbodies.back(); m_Rigidbodies.pop_back(); } // Ōɉ񂵂Ď菜
+	if (it != m_Rigidbodies.end()) { *it = m_Rigidbodies.back(); m_Rigidbodies.pop_back(); } // 最後に回して取り除く
 }
 int PhysicsSystem::RegisterDistanceJoint(DistanceJointComponent* joint)
 {
 	assert(joint);
 	assert(joint->JointId() == -1 && "already registered");
+	WaitStep();
 
 	int id;
 	if (!m_FreeDistanceJointIds.empty()) { id = m_FreeDistanceJointIds.back(); m_FreeDistanceJointIds.pop_back(); }
 	else { id = m_DistanceJointNextId++; m_DistanceJointById.resize(m_DistanceJointNextId, nullptr); }
 
 	joint->SetJointId(id);
-	m_DistanceJointById[id] = joint; // tpɓo^
+	m_DistanceJointById[id] = joint; // 逆引き用に登録
 
 	DistanceJoint dj{};
 	dj.jointId = id;
@@ -232,14 +517,15 @@ int PhysicsSystem::RegisterDistanceJoint(DistanceJointComponent* joint)
 void PhysicsSystem::UnregisterDistanceJoint(DistanceJointComponent* joint)
 {
 	if (!joint || joint->JointId() < 0) return;
+	WaitStep();
 
 	const int id = joint->JointId();
 
-	// t
+	// 逆引き
 	m_DistanceJointById[id] = nullptr;
 	m_FreeDistanceJointIds.push_back(id);
 
-	// Xg珜O
+	// リストから除外
 	auto it = std::find_if(m_DistanceJoints.begin(), m_DistanceJoints.end(), [id](const DistanceJoint& dj) { return dj.jointId == id; });
 	if (it != m_DistanceJoints.end()) { *it = m_DistanceJoints.back(); m_DistanceJoints.pop_back(); }
 	joint->SetJointId(-1);
@@ -248,13 +534,14 @@ int PhysicsSystem::RegisterBallJoint(BallJointComponent* joint)
 {
 	assert(joint);
 	assert(joint->JointId() == -1 && "already registered");
+	WaitStep();
 
 	int id;
 	if (!m_FreeBallJointIds.empty()) { id = m_FreeBallJointIds.back(); m_FreeBallJointIds.pop_back(); }
 	else { id = m_BallJointNextId++; m_BallJointById.resize(m_BallJointNextId, nullptr); }
 
 	joint->SetJointId(id);
-	m_BallJointById[id] = joint; // tpɓo^
+	m_BallJointById[id] = joint; // 逆引き用に登録
 
 	BallJoint bj{};
 	bj.jointId = id;
@@ -271,14 +558,15 @@ int PhysicsSystem::RegisterBallJoint(BallJointComponent* joint)
 void PhysicsSystem::UnregisterBallJoint(BallJointComponent* joint)
 {
 	if (!joint || joint->JointId() < 0) return;
+	WaitStep();
 
 	const int id = joint->JointId();
 
-	// t
+	// 逆引き
 	m_BallJointById[id] = nullptr;
 	m_FreeBallJointIds.push_back(id);
 
-	// Xg珜O
+	// リストから除外
 	auto it = std::find_if(m_BallJoints.begin(), m_BallJoints.end(), [id](const BallJoint& bj) { return bj.jointId == id; });
 	if (it != m_BallJoints.end()) { *it = m_BallJoints.back(); m_BallJoints.pop_back(); }
 	joint->SetJointId(-1);
@@ -287,13 +575,14 @@ int PhysicsSystem::RegisterHingeJoint(HingeJointComponent* joint)
 {
 	assert(joint);
 	assert(joint->JointId() == -1 && "already registered");
+	WaitStep();
 
 	int id;
 	if (!m_FreeHingeJointIds.empty()) { id = m_FreeHingeJointIds.back(); m_FreeHingeJointIds.pop_back(); }
 	else { id = m_HingeJointNextId++; m_HingeJointById.resize(m_HingeJointNextId, nullptr); }
 
 	joint->SetJointId(id);
-	m_HingeJointById[id] = joint; // tpɓo^
+	m_HingeJointById[id] = joint; // 逆引き用に登録
 
 	HingeJoint hj{};
 	hj.jointId = id;
@@ -314,16 +603,16 @@ int PhysicsSystem::RegisterHingeJoint(HingeJointComponent* joint)
 	hj.springTarget  = joint->SpringTarget();
 	hj.springDamping = joint->SpringDamping();
 
-	// ----- refA/B ̃Zbg -----
+	// ----- refA/B のセット -----
 	Quaternion qA = hj.tfA->Rotation();
 	Quaternion qB = hj.tfB->Rotation();
 
 	Vector3 axisWorld = qA.Rotate(hj.localAxisA).normalized();
 
-	// B ̃[Jɋtϊĕۑ
+	// B 側のローカル軸に逆変換して保存
 	hj.localAxisB = qB.Inverse().Rotate(axisWorld);
 	
-	// ƒsKȕ[hō
+	// 軸と直行する適当な方向をワールドで作る
 	Vector3 refWorld;
 	if (fabsf(axisWorld.x) > 0.577f)
 		refWorld = Vector3(axisWorld.y, -axisWorld.x, 0.0f);
@@ -331,7 +620,7 @@ int PhysicsSystem::RegisterHingeJoint(HingeJointComponent* joint)
 		refWorld = Vector3(0.0f, axisWorld.z, -axisWorld.y);
 	refWorld.normalize();
 
-	// A, B ̃[Jɖ߂ĕۑ
+	// A, B のローカルに戻して保存
 	hj.localRefA = qA.Inverse().Rotate(refWorld);
 	hj.localRefB = qB.Inverse().Rotate(refWorld);
 
@@ -341,213 +630,675 @@ int PhysicsSystem::RegisterHingeJoint(HingeJointComponent* joint)
 void PhysicsSystem::UnregisterHingeJoint(HingeJointComponent* joint)
 {
 	if (!joint || joint->JointId() < 0) return;
+	WaitStep();
 
 	const int id = joint->JointId();
 
-	// t
+	// 逆引き
 	m_HingeJointById[id] = nullptr;
 	m_FreeHingeJointIds.push_back(id);
 
-	// Xg珜O
+	// リストから除外
 	auto it = std::find_if(m_HingeJoints.begin(), m_HingeJoints.end(), [id](const HingeJoint& bj) { return bj.jointId == id; });
 	if (it != m_HingeJoints.end()) { *it = m_HingeJoints.back(); m_HingeJoints.pop_back(); }
 	joint->SetJointId(-1);
 }
 
 // ==================================================
-// Xebv̎n܂
-// ͂̉Ȃǂs
-// XNvg FixedUpdate Ɏs
+// ステップの始まり
+// 力の解決などを行う
+// スクリプトの FixedUpdate を先に実行
 // ==================================================
 void PhysicsSystem::BeginStep(float fixedDt)
 {
+	m_Stats = PhysicsStepStats{};
+	m_Stats.step = m_StatsStep++;
+	m_StepStart = m_PhaseStart = std::chrono::steady_clock::now();
+
 	m_CurrTrigger.clear();
 	m_CurrCollision.clear();
 	m_Contacts.clear();
+	PurgeRetiredPairs(); // 前のステップの後に解除されたコライダーのペアを落とす
 
-	// ----- Óxid͂Ȃǁj-----
-	IntegrationForce(fixedDt);
+	// ----- スクリプトに動かされたアイランドを起こす -----
+	WakeSleepingIslands();
+	EndPhase(PhysicsStepStats::Wake);
 
-	// Xebv̍ŏ WorldAABB XV
-	for (Collider* c : m_Colliders)
-		c->UpdateWorldAABB();
-	SyncCOM(); // COM ̓
+	// ----- 外力→速度（重力など）-----
+	IntegrationForce(fixedDt);
+	EndPhase(PhysicsStepStats::IntegrateForce);
+
+	// ステップの最初に WorldAABB を更新（静的なものは振り分けたときに合わせてあるので見ない）
+	// fat AABB からはみ出したものだけ木を組み替える
+	// CCD のボディは今ステップで動く範囲まで広げて入れておく（他の CCD の掃引から見えるように）
+	// AABB の計算はコライダーごとに独立なのでスレッドで分け、木の組み替えだけ１スレッドで行う
+	if (m_BroadSetsDirty) RebuildBroadphaseSets();
+	if (!m_MovedStatics.empty()) RefreshMovedStatics(); // スクリプトに動かされた静的なもの
+	const int movingCount = (int)m_MovingColliders.size();
+	m_MovingProxyAABBs.resize(movingCount);
+	auto updateAABBs = [&](int begin, int end)
+		{
+			for (int i = begin; i < end; i++)
+			{
+				Collider* c = m_MovingColliders[i];
+				if (!IsSleepingCollider(c)) // 眠っている間は動かない
+				{
+					c->UpdateWorldAABB();
+					AABB proxy = c->WorldAABB();
+					Rigidbody* rb = c->Body();
+					if (rb && rb->IsContinuousCollision() && IsAwakeDynamic(rb))
+					{
+						const Vector3 move = rb->Velocity() * fixedDt;
+						proxy = Combine(proxy, { proxy.min + move, proxy.max + move });
+					}
+					m_MovingProxyAABBs[i] = proxy;
+				}
+				m_WorldAABBs.Set(c->Id(), c->WorldAABB()); // ブロードの絞り込み用（眠っているものも）
+			}
+		};
+	if (movingCount >= MinParallelAABBs * m_WorkerPool.ThreadCount()) m_WorkerPool.ParallelFor(movingCount, updateAABBs);
+	else																 updateAABBs(0, movingCount);
+	for (int i = 0; i < movingCount; i++)
+	{
+		Collider* c = m_MovingColliders[i];
+		if (!IsSleepingCollider(c)) m_BroadPhase.MoveProxy(c->m_ProxyId, m_MovingProxyAABBs[i]);
+	}
+	SyncCOM(); // COM の同期
 
-	// ----- ̑xXV -----
+	// ----- 見かけの速度更新 -----
 	UpdateKinematicApparentVelocity(fixedDt);
+	EndPhase(PhysicsStepStats::BroadUpdate);
 }
 
 // ==================================================
-// Xebv
-// Փ˔Axs
+// ステップ
+// 衝突判定、速度解決を行う
 // ==================================================
 void PhysicsSystem::Step(float fixedDt)
 {
-	// ----- Փ˔ -----
-	DetermineCollision();
+	// ----- 衝突判定 -----
+	DetermineCollision(); // ブロード、ナローの区切りは中で付ける
 
-	// ----- Փ˓_OvZ -----
+	// ----- 衝突点事前計算 -----
 	PreSolveContacts();
-	// ----- WCgOvZ -----
+	// ----- ジョイント事前計算 -----
 	PreSolveDistanceJoints(fixedDt);
 	PreSolveBallJoints(fixedDt);
 	PreSolveHingeJoints(fixedDt);
 
-	// ----- x -----
-	for (int i = 0; i < 8; i++) 
-	{ 
-		ResolveDistanceJoints(fixedDt);
-		ResolveBallJoints(fixedDt);
-		ResolveHingeJoints(fixedDt);
-		ResolveVelocity(fixedDt); 
-		//printf("---------- resolve : %d\n", i); 
+	// ----- ソルバーボディを集める -----
+	BuildSolverBodies();
+	BuildSolverIslands();
+	EndPhase(PhysicsStepStats::PreSolve);
+
+	// ----- 速度解決 -----
+	if (m_WorkerPool.ThreadCount() > 1)
+	{
+		SolveVelocityParallel(fixedDt);
+	}
+	else
+	{
+		BeginSolverIterations();
+		for (int i = 0; i < m_MaxVelocityIterations; i++) 
+		{ 
+			ResolveDistanceJoints(fixedDt);
+			ResolveBallJoints(fixedDt);
+			ResolveHingeJoints(fixedDt);
+			ResolveVelocity(fixedDt); 
+			//printf("---------- resolve : %d\n", i); 
+			if (!EndSolverIteration(i, 1, false)) break; // 全アイランドが収束した
+		}
 	}
+
+	// ----- 速度を Rigidbody へ書き戻す -----
+	m_SolverBodies.WriteBack();
+	EndPhase(PhysicsStepStats::Solve);
+
+	// ----- めり込み解消（擬似速度はソルバーボディに残して、速度積分で位置へ足す）-----
+	if (m_WorkerPool.ThreadCount() > 1) SolvePositionParallel(fixedDt);
+	else								ResolvePosition(fixedDt);
+	EndPhase(PhysicsStepStats::SolvePosition);
+
+	// ----- 累積インパルスを次ステップへ持ち越す -----
+	UpdateContactCache();
+	EndPhase(PhysicsStepStats::ContactCache);
 }
 
 // ==================================================
-// Xebv̏I
-// AxϕAʒu␳AfBXpb`s
+// ステップの終わり
+// 減衰、速度積分（めり込み解消の擬似速度もここで位置へ足す）、ディスパッチ処理等を行う
 // ==================================================
 void PhysicsSystem::EndStep(float fixedDt)
 {
-	// -----  -----
+	IntegrateStep(fixedDt);
+	FinishStep();
+}
+// --------------------------------------------------
+// EndStep の前半（パイプライン実行では物理スレッドで回す）
+// --------------------------------------------------
+void PhysicsSystem::IntegrateStep(float fixedDt)
+{
+	// ----- 減衰 -----
 	ApplyDamping(fixedDt);
 
-	// ----- xϕ -----
+	// ----- 速度積分 -----
+	BeginContinuousCollision();
 	IntegrationVelocity(fixedDt);
+	EndPhase(PhysicsStepStats::Integrate);
 
-	// ----- ʒu␳ -----
-	for (int i = 0; i < 4; i++)	CorrectPosition();
-
+	// ----- 連続衝突判定（すり抜け防止）-----
+	SolveContinuousCollision();
+	EndPhase(PhysicsStepStats::Continuous);
 
-	auto diffSets = [&](auto& prev, auto& curr, auto& outEnter, auto& outExit, auto& outStay)
-		{
-			// Enter : Curr ɂ Prev ɂȂ
-			for (auto k: curr) 
-				if (!prev.count(k))
-				{
-					outEnter.emplace_back(m_ById[KeyHigh(k)], m_ById[KeyLow(k)]); // Enter ɂ
-				}
-			// Exit : Prev ɂ Curr ɂȂ
-			for (auto k : prev) 
-				if (!curr.count(k))
-				{
-					outExit.emplace_back(m_ById[KeyHigh(k)], m_ById[KeyLow(k)]); // Exit ɂ
-				}
-				else
-				{   // Stay : Prev ɂ Curr ɂ
-					outStay.emplace_back(m_ById[KeyHigh(k)], m_ById[KeyLow(k)]); // Stay ɂ
-				}
-			prev.swap(curr); curr.clear();
-		};
+	// ----- スリープ判定 -----
+	UpdateSleep(fixedDt);
+	EndPhase(PhysicsStepStats::Sleep);
+}
+// --------------------------------------------------
+// EndStep の後半（イベントのハンドラがオブジェクトを触るので本体スレッドで回す）
+// --------------------------------------------------
+void PhysicsSystem::FinishStep()
+{
+	// ----- 眠ったボディの Transform を見張る -----
+	WatchNewSleepers();
 
-	diffSets(m_PrevTrigger  , m_CurrTrigger  , m_TriggerEnter  , m_TriggerExit  , m_TriggerStay);
-	diffSets(m_PrevCollision, m_CurrCollision, m_CollisionEnter, m_CollisionExit, m_CollisionStay);
+	// ----- Enter / Stay / Exit -----
+	DiffPairs(m_PrevTrigger  , m_CurrTrigger  , m_TriggerEnter  , m_TriggerExit  , m_TriggerStay);
+	DiffPairs(m_PrevCollision, m_CurrCollision, m_CollisionEnter, m_CollisionExit, m_CollisionStay);
+	BuildCollisionPartners();
 
-	// ----- fBXpb` -----
+	// ----- ディスパッチ処理 -----
 	DispatchEvents(); 
+	EndPhase(PhysicsStepStats::Events);
 
-	// ----- WorldPose ̓iȂƕ`悪Pt[Yj -----
-	for (Collider* c : m_Colliders)
+	// ----- WorldPose の同期（これをしないと描画が１フレーム分ズレる） -----
+	ForEachMovingCollider([&](Collider* c)
+	{
+		if (IsSleepingCollider(c)) return;
 		c->UpdateWorldPose();
+	});
+	EndPhase(PhysicsStepStats::SyncPose);
+
+	// ----- 計測を締める -----
+	m_Stats.contacts = (int)m_Contacts.size();
+	m_Stats.joints	 = (int)(m_DistanceJoints.size() + m_BallJoints.size() + m_HingeJoints.size());
+	for (const Rigidbody* rb : m_Rigidbodies)
+	{
+		if (!rb->IsDynamic()) continue;
+		if (rb->IsSleeping()) m_Stats.sleepingBodies++;
+		else				  m_Stats.awakeBodies++;
+	}
+	m_Stats.totalMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_StepStart).count();
+	m_LastStats = m_Stats;
+	m_StatsHistory.Push(m_Stats);
+}
+
+// ==================================================
+// ----- パイプライン実行 -----
+// 物理スレッドが Step と EndStep の前半を回している間に、本体スレッドは前のステップの姿勢で Update / Draw を進める
+// 物理スレッドは Transform に触らない（姿勢は Rigidbody の m_Step～ に写して読み書きする）
+// ==================================================
+void PhysicsSystem::SetPipelined(bool enable)
+{
+	if (enable == m_Pipelined) return;
+	if (enable)
+	{
+		m_MainThreadId	 = std::this_thread::get_id(); // 操作を溜めるのはこのスレッドから来たものだけ
+		m_StepThreadStop = false;
+		m_StepThread	 = std::thread([this] { StepThreadMain(); });
+		m_Pipelined		 = true;
+	}
+	else
+	{
+		SyncStep(); // 走っているステップを反映してから止める
+		StopStepThread();
+	}
+}
+void PhysicsSystem::KickStep(float fixedDt)
+{
+	assert(!m_StepInFlight && "call SyncStep first");
+	if (!m_Pipelined)
+	{
+		Step(fixedDt);
+		EndStep(fixedDt);
+		return;
+	}
+
+	CaptureStepPoses();
+	m_StepDt = fixedDt;
+	m_StepInFlight = true;
+	{
+		std::lock_guard<std::mutex> lock(m_StepMutex);
+		m_StepRunning = true;
+	}
+	m_StepWake.notify_one();
+}
+void PhysicsSystem::SyncStep()
+{
+	if (!m_StepInFlight) return;
+	WaitStep();
+	m_StepInFlight = false;
+
+	// 待っていた間（本体スレッドの Update / Draw）はステップの時間に入れない
+	const auto now = std::chrono::steady_clock::now();
+	m_StepStart += now - m_StepAsyncEnd;
+	m_PhaseStart = now;
+
+	// ----- 姿勢を Transform へ書き戻して、残りを本体スレッドで -----
+	// 走っている間にコライダーが解除されていたら、WorldPose を合わせる前に区分を振り分け直す
+	if (m_BroadSetsDirty) RebuildBroadphaseSets();
+	PublishStepPoses();
+	EndPhase(PhysicsStepStats::SyncPose);
+	FinishStep();
+
+	// ----- 走っている間に溜めた登録と操作を、呼ばれた順に -----
+	ApplyPendingRegistrations();
+	ApplyBodyCommands();
 }
+// --------------------------------------------------
+// 物理スレッド
+// --------------------------------------------------
+void PhysicsSystem::StepThreadMain()
+{
+	std::unique_lock<std::mutex> lock(m_StepMutex);
+	for (;;)
+	{
+		m_StepWake.wait(lock, [this] { return m_StepRunning || m_StepThreadStop; });
+		if (m_StepThreadStop) return;
+		lock.unlock();
 
+		Step(m_StepDt);
+		IntegrateStep(m_StepDt);
+		m_StepAsyncEnd = std::chrono::steady_clock::now();
+
+		lock.lock();
+		m_StepRunning = false;
+		m_StepDone.notify_all();
+	}
+}
+void PhysicsSystem::WaitStep()
+{
+	if (!m_StepInFlight) return;
+	std::unique_lock<std::mutex> lock(m_StepMutex);
+	m_StepDone.wait(lock, [this] { return !m_StepRunning; });
+}
+void PhysicsSystem::StopStepThread()
+{
+	m_Pipelined = false;
+	if (!m_StepThread.joinable()) return;
+	{
+		std::lock_guard<std::mutex> lock(m_StepMutex);
+		m_StepThreadStop = true;
+	}
+	m_StepWake.notify_one();
+	m_StepThread.join();
+}
 // --------------------------------------------------
-// fBXpb`
+// ステップ中の剛体の姿勢
+// 途中で起こされるボディもあるので、眠っているものも含めて全部写す
 // --------------------------------------------------
-void PhysicsSystem::DispatchEvents()
+void PhysicsSystem::CaptureStepPoses()
+{
+	for (Rigidbody* rb : m_Rigidbodies)
+	{
+		const TransformComponent* tf = rb->Owner()->Transform();
+		rb->m_StepStartPosition = rb->m_StepPosition = tf->Position();
+		rb->m_StepStartRotation = rb->m_StepRotation = tf->Rotation();
+		rb->m_StepPositionDirty = false;
+		rb->m_StepRotationDirty = false;
+		rb->m_StepVelocity = rb->m_Velocity;
+		rb->m_StepAngularVelocity = rb->m_AngularVelocity;
+		rb->m_StepKinematicVelocity = rb->m_KinematicVelocity;
+		rb->m_StepKinematicAngularVelocity = rb->m_KinematicAngularVelocity;
+		rb->m_StepIsSleeping = rb->m_IsSleeping;
+	}
+	m_UseStepPoses = true;
+}
+void PhysicsSystem::PublishStepPoses()
 {
-	// OnTriggerEnte, Exit ̌Ăяo
-	auto callAll = [](Collider* me, Collider* other, bool enter, bool isTrigger)
+	m_UseStepPoses = false;
+	for (Rigidbody* rb : m_Rigidbodies)
+	{
+		if (!rb->m_StepPositionDirty && !rb->m_StepRotationDirty) continue;
+		TransformComponent* tf = rb->Owner()->Transform();
+
+		// 走っている間にスクリプトが動かしていたらそちらを残す（COM は次の FixedUpdate で Transform に合わせ直る）
+		const Quaternion q = tf->Rotation();
+		const Quaternion& s = rb->m_StepStartRotation;
+		const bool moved = (tf->Position() - rb->m_StepStartPosition).lengthSq() > 0.0f
+			|| q.x != s.x || q.y != s.y || q.z != s.z || q.w != s.w;
+		if (!moved)
 		{
-			if (auto* go = me->Owner())
+			if (rb->m_StepRotationDirty) tf->SetRotation(rb->m_StepRotation);
+			if (rb->m_StepPositionDirty) tf->SetPosition(rb->m_StepPosition);
+
+			// 眠った時の姿勢は Transform から読み直した値で持つ（起床の判定で比べるので）
+			if (rb->m_IsSleeping)
 			{
-				go->ForEachComponent(
-					[&](Component* c) {
-						if (isTrigger)
-						{
-							if (enter) c->OnTriggerEnter(me, other);
-							else	   c->OnTriggerExit(me, other);
-						}
-						else
-						{
-							if (enter) c->OnCollisionEnter(me, other);
-							else	   c->OnCollisionExit(me, other);
-						}
-					}); // h_hnĂ
+				rb->m_SleepPosition = tf->Position();
+				rb->m_SleepRotation = tf->Rotation();
 			}
-		};
-	// OnTriggerStay ̌ďo
-	auto callAllStay = [](Collider* me, Collider* other, bool isTrigger)
+		}
+		rb->m_StepPositionDirty = false;
+		rb->m_StepRotationDirty = false;
+	}
+}
+Vector3 PhysicsSystem::StepPosition(const Rigidbody* rb, const TransformComponent* tf) const
+{
+	if (m_UseStepPoses && rb) return rb->m_StepPosition;
+	return tf->Position();
+}
+Quaternion PhysicsSystem::StepRotation(const Rigidbody* rb, const TransformComponent* tf) const
+{
+	if (m_UseStepPoses && rb) return rb->m_StepRotation;
+	return tf->Rotation();
+}
+void PhysicsSystem::SetStepPosition(Rigidbody* rb, TransformComponent* tf, const Vector3& position)
+{
+	if (!m_UseStepPoses) { tf->SetPosition(position); return; }
+	rb->m_StepPosition = position;
+	rb->m_StepPositionDirty = true;
+}
+void PhysicsSystem::SetStepRotation(Rigidbody* rb, TransformComponent* tf, const Quaternion& rotation)
+{
+	if (!m_UseStepPoses) { tf->SetRotation(rotation); return; }
+	rb->m_StepRotation = rotation;
+	rb->m_StepRotationDirty = true;
+}
+ColliderPose PhysicsSystem::StepWorldPose(Collider* c)
+{
+	Rigidbody* rb = c->Body();
+	if (!m_UseStepPoses || !rb)
+	{
+		c->UpdateWorldPose();
+		return c->m_WorldPose;
+	}
+
+	// Collider::UpdateWorldPose と同じ合成（スケールは FixedUpdate で合わせた値のまま）
+	ColliderPose pose = c->m_WorldPose;
+	pose.position = rb->m_StepPosition + rb->m_StepRotation.Rotate(c->m_OffsetPositionLocal);
+	pose.rotation = (rb->m_StepRotation * c->m_OffsetRotationLocal.normalized()).normalized();
+	return pose;
+}
+// --------------------------------------------------
+// 溜めた登録と操作の反映
+// --------------------------------------------------
+void PhysicsSystem::ApplyPendingRegistrations()
+{
+	for (Collider* c : m_PendingColliders)	   RegisterCollider(c);
+	for (Rigidbody* rb : m_PendingRigidbodies) RegisterRigidbody(rb);
+	m_PendingColliders.clear();
+	m_PendingRigidbodies.clear();
+}
+void PhysicsSystem::ApplyBodyCommands()
+{
+	for (const BodyCommand& cmd : m_BodyCommands)
+	{
+		Rigidbody* rb = cmd.rb;
+		switch (cmd.type)
 		{
-			if (auto* go = me->Owner())
-			{
-				go->ForEachComponent(
-					[&](Component* c) {
-						if (isTrigger)
-						{
-							c->OnTriggerStay(me, other);
-						}
-						else
-						{
-							c->OnCollisionStay(me, other);
-						}
-					});
-			}
-		};
+		case BodyCommand::Type::AddForce:			 rb->AddForce(cmd.a);					break;
+		case BodyCommand::Type::AddTorque:			 rb->AddTorque(cmd.a);					break;
+		case BodyCommand::Type::AddForceAtPoint:	 rb->AddForceAtPoint(cmd.a, cmd.b);		break;
+		case BodyCommand::Type::ApplyImpulse:		 rb->ApplyImpulse(cmd.a);				break;
+		case BodyCommand::Type::ApplyImpulseAtPoint: rb->ApplyImpulseAtPoint(cmd.a, cmd.b); break;
+		case BodyCommand::Type::SetVelocity:		 rb->SetVelocity(cmd.a);				break;
+		case BodyCommand::Type::SetAngularVelocity:	 rb->SetAngularVelocity(cmd.a);			break;
+		case BodyCommand::Type::WakeUp:				 rb->WakeUp();							break;
+		case BodyCommand::Type::SetBodyType:		 rb->SetBodyType((Rigidbody::BodyType)cmd.value); break;
+		case BodyCommand::Type::SetMass:			 rb->SetMass(cmd.scalar);				break;
+		case BodyCommand::Type::SetRestitution:		 rb->SetRestitution(cmd.scalar);		break;
+		case BodyCommand::Type::SetFrictionDynamic:	 rb->SetFrictionDynamic(cmd.scalar);	break;
+		case BodyCommand::Type::SetFrictionStatic:	 rb->SetFrictionStatic(cmd.scalar);		break;
+		case BodyCommand::Type::SetLinDamping:		 rb->SetLinDamping(cmd.scalar);			break;
+		case BodyCommand::Type::SetAngDamping:		 rb->SetAngDamping(cmd.scalar);			break;
+		case BodyCommand::Type::SetGravityMode:		 rb->SetGravityMode((enum Rigidbody::GravityMode)cmd.value); break; // GravityMode() 関数と名前が重なるので enum を付ける
+		case BodyCommand::Type::SetGravityScale:	 rb->SetGravityScale(cmd.scalar);		break;
+		case BodyCommand::Type::SetCustomGravity:	 rb->SetCustomGravity(cmd.a);			break;
+		case BodyCommand::Type::SetCanSleep:		 rb->SetCanSleep(cmd.value != 0);		break;
+		case BodyCommand::Type::SetContinuousCollision: rb->SetContinuousCollision(cmd.value != 0); break;
+		case BodyCommand::Type::SetSolverIterations: rb->SetSolverIterations(cmd.value, cmd.value2); break;
+		}
+	}
+	m_BodyCommands.clear();
+}
 
-	// TriggerEnter -----
-	for (auto& p : m_TriggerEnter)
+// --------------------------------------------------
+// ブロードフェーズの区分
+// 動かないもの（ボディ無し、Static）は静的、クエリは Rigidbody 無しで動かされることがあるので Kinematic 側
+// トリガーはボディに関係なく専用の区分（Rigidbody 無しで動かされることがあるので毎ステップ更新する）
+// --------------------------------------------------
+PhysicsSystem::BroadSet PhysicsSystem::ClassifyCollider(const Collider* c) const
+{
+	if (c->IsTrigger()) return BroadSet::Trigger;
+	const Rigidbody* rb = c->Body();
+	if (rb && rb->IsDynamic()) return BroadSet::Dynamic;
+	if (c->IsQuery() || (rb && rb->IsKinematic())) return BroadSet::Kinematic;
+	return BroadSet::Static;
+}
+bool PhysicsSystem::IsBroadQuerier(const Collider* c) const
+{
+	return !c->IsQuery() && c->Shape() && !IsSleepingCollider(c) && m_BroadSetOf[c->Id()] != BroadSet::Static;
+}
+void PhysicsSystem::RebuildBroadphaseSets()
+{
+	const size_t prevStaticCount = m_StaticColliders.size();
+	bool staticChanged = false;
+	m_StaticColliders.clear();
+	m_KinematicColliders.clear();
+	m_DynamicColliders.clear();
+	m_TriggerColliders.clear();
+	for (Collider* c : m_Colliders)
 	{
-		Collider* A = p.first;
-		Collider* B = p.second;
-		callAll(A, B, true, true);
-		callAll(B, A, true, true);
+		const BroadSet set = ClassifyCollider(c);
+		BroadSet& prev = m_BroadSetOf[c->Id()];
+		const bool becameStatic = set == BroadSet::Static && prev != BroadSet::Static;
+		if ((set == BroadSet::Static) != (prev == BroadSet::Static)) staticChanged = true;
+		if (prev == BroadSet::Static && set != BroadSet::Static) StopWatchingStatic(c); // 動くものは毎ステップ姿勢を見るので要らない
+		prev = set;
+
+		switch (set)
+		{
+		case BroadSet::Static:
+			m_StaticColliders.push_back(c);
+			if (becameStatic) { RefreshStaticCollider(c); WatchStatic(c); } // 新しく静的になったものだけ今の姿勢に合わせる
+			break;
+		case BroadSet::Kinematic: m_KinematicColliders.push_back(c); break;
+		case BroadSet::Trigger:	  m_TriggerColliders.push_back(c);	 break;
+		default:				  m_DynamicColliders.push_back(c);	 break;
+		}
 	}
-	// TriggerExit -----
-	for (auto& p : m_TriggerExit)
+	if (m_StaticColliders.size() != prevStaticCount) staticChanged = true; // 静的なものが解除された
+	if (staticChanged) CountStaticPairs();
+	m_MovingColliders.clear();
+	m_MovingColliders.insert(m_MovingColliders.end(), m_KinematicColliders.begin(), m_KinematicColliders.end());
+	m_MovingColliders.insert(m_MovingColliders.end(), m_DynamicColliders.begin(), m_DynamicColliders.end());
+	m_MovingColliders.insert(m_MovingColliders.end(), m_TriggerColliders.begin(), m_TriggerColliders.end());
+	m_BroadSetsDirty = false;
+}
+// --------------------------------------------------
+// 静的コライダーの Transform の見張り
+// Transform の見張りは１つだけなので、同じ GameObject に静的コライダーが複数あれば最初の１つが見張って、動いたら全部合わせる
+// 静的なボディは眠らないので、Rigidbody の見張り（眠っている間だけ）とはぶつからない
+// --------------------------------------------------
+void PhysicsSystem::RefreshMovedStatics()
+{
+	for (Collider* moved : m_MovedStatics)
 	{
-		Collider* A = p.first;
-		Collider* B = p.second;
-		callAll(A, B, false, true);
-		callAll(B, A, false, true);
+		moved->Owner()->ForEachComponent([this](Component* comp)
+			{
+				auto* c = dynamic_cast<Collider*>(comp);
+				if (!c || c->m_Id < 0 || m_BroadSetOf[c->m_Id] != BroadSet::Static) return;
+				RefreshStaticCollider(c);
+				WakeCollisionPartners(c->m_Id); // 乗っていたものは支えが動いたので起こす
+			});
 	}
-	// CollisionEnter -----
-	for (auto& p : m_CollisionEnter)
+	m_MovedStatics.clear();
+}
+void PhysicsSystem::WakeCollisionPartners(int id)
+{
+	if (id + 1 >= (int)m_CollisionPartnerStart.size()) return;
+	for (int k = m_CollisionPartnerStart[id]; k < m_CollisionPartnerStart[id + 1]; k++)
+		if (Collider* other = m_ById[m_CollisionPartners[k]]) WakeIsland(other->m_pBody);
+}
+void PhysicsSystem::WatchStatic(Collider* c)
+{
+	TransformComponent* tf = c->Owner()->Transform();
+	if (tf && !tf->MoveWatcher()) tf->SetMoveWatcher(c);
+}
+void PhysicsSystem::StopWatchingStatic(Collider* c)
+{
+	TransformComponent* tf = c->Owner()->Transform();
+	if (tf && tf->MoveWatcher() == c) tf->SetMoveWatcher(nullptr);
+}
+void PhysicsSystem::RefreshStaticCollider(Collider* c)
+{
+	assert(c && c->Id() >= 0);
+	WaitStep();
+	c->UpdateWorldPose();
+	c->UpdateWorldAABB();
+	m_ShapeRecords[c->Id()].pose = c->m_WorldPose;
+	m_WorldAABBs.Set(c->Id(), c->WorldAABB());
+	m_BroadPhase.MoveProxy(c->m_ProxyId, c->WorldAABB());
+}
+void PhysicsSystem::CountStaticPairs()
+{
+	// 以前は毎ステップ木から引いて AABB を比べていた組（計測用、静的の区分が変わったときだけ数え直す）
+	m_StaticPairCount = 0;
+	for (Collider* colA : m_StaticColliders)
 	{
-		Collider* A = p.first;
-		Collider* B = p.second;
-		callAll(A, B, true, false);
-		callAll(B, A, true, false);
+		if (!colA->Shape()) continue;
+		m_BroadPhase.Query(colA->WorldAABB(), [&](int proxyId)
+			{
+				Collider* colB = m_BroadPhase.GetUser(proxyId);
+				if (colB->Id() <= colA->Id() || !colB->Shape()) return true;
+				if (m_BroadSetOf[colB->Id()] == BroadSet::Static && ShouldCollide(*colA, *colB)) m_StaticPairCount++;
+				return true;
+			});
 	}
-	// CollisionExit -----
-	for (auto& p : m_CollisionExit)
+}
+
+// --------------------------------------------------
+// 衝突ペア集合
+// prev / curr はキー順に並べておき、Enter / Stay / Exit を１回のマージで取る
+// 解除したコライダーのペアはここで読み飛ばす（Exit も出さない）
+// --------------------------------------------------
+void PhysicsSystem::DiffPairs(std::vector<uint64_t>& prev, std::vector<uint64_t>& curr,
+	std::vector<std::pair<Collider*, Collider*>>& outEnter,
+	std::vector<std::pair<Collider*, Collider*>>& outExit,
+	std::vector<std::pair<Collider*, Collider*>>& outStay)
+{
+	std::sort(curr.begin(), curr.end()); // ナローは形状の組ごとに積むので並べ直す
+
+	auto emit = [&](std::vector<std::pair<Collider*, Collider*>>& out, uint64_t k)
+		{
+			if (IsLivePair(k)) out.emplace_back(m_ById[KeyHigh(k)], m_ById[KeyLow(k)]);
+		};
+	size_t i = 0, j = 0;
+	while (i < prev.size() || j < curr.size())
 	{
-		Collider* A = p.first;
-		Collider* B = p.second;
-		callAll(A, B, false, false);
-		callAll(B, A, false, false);
+		if (j == curr.size() || (i < prev.size() && prev[i] < curr[j]))
+		{   // Exit : Prev にあって Curr にない
+			emit(outExit, prev[i++]);
+		}
+		else if (i == prev.size() || curr[j] < prev[i])
+		{   // Enter : Curr にあって Prev にない
+			emit(outEnter, curr[j++]);
+		}
+		else
+		{   // Stay : Prev にあって Curr にもある
+			emit(outStay, curr[j]);
+			i++; j++;
+		}
 	}
-	// TriggerStay -----
-	for (auto& p : m_TriggerStay)
+	prev.swap(curr); curr.clear();
+	prev.erase(std::remove_if(prev.begin(), prev.end(), [&](uint64_t k) { return !IsLivePair(k); }), prev.end());
+}
+void PhysicsSystem::BuildCollisionPartners()
+{
+	// id ごとに数えて、開始位置を詰めてから並べる
+	const int slots = (int)m_ById.size();
+	m_CollisionPartnerStart.assign(slots + 1, 0);
+	for (uint64_t k : m_PrevCollision)
 	{
-		Collider* A = p.first;
-		Collider* B = p.second;
-		callAllStay(A, B, true);
-		callAllStay(B, A, true);
+		m_CollisionPartnerStart[KeyHigh(k) + 1]++;
+		m_CollisionPartnerStart[KeyLow(k) + 1]++;
 	}
+	for (int id = 0; id < slots; id++) m_CollisionPartnerStart[id + 1] += m_CollisionPartnerStart[id];
 
-	// CollisionStay -----
-	for (auto& p : m_TriggerStay)
+	m_CollisionPartners.resize(m_CollisionPartnerStart[slots]);
+	for (uint64_t k : m_PrevCollision)
 	{
-		Collider* A = p.first;
-		Collider* B = p.second;
-		callAllStay(A, B, false);
-		callAllStay(B, A, false);
+		const int a = KeyHigh(k), b = KeyLow(k);
+		m_CollisionPartners[m_CollisionPartnerStart[a]++] = b;
+		m_CollisionPartners[m_CollisionPartnerStart[b]++] = a;
 	}
+	// 詰めるときに進めた分を戻す
+	for (int id = slots; id > 0; id--) m_CollisionPartnerStart[id] = m_CollisionPartnerStart[id - 1];
+	m_CollisionPartnerStart[0] = 0;
+}
+void PhysicsSystem::PurgeRetiredPairs()
+{
+	if (m_RetiredIds.empty()) return;
+
+	auto retired = [&](uint64_t k) { return !IsLivePair(k); };
+	m_PrevTrigger.erase(std::remove_if(m_PrevTrigger.begin(), m_PrevTrigger.end(), retired), m_PrevTrigger.end());
+	m_PrevCollision.erase(std::remove_if(m_PrevCollision.begin(), m_PrevCollision.end(), retired), m_PrevCollision.end());
+	m_ContactCache.erase(std::remove_if(m_ContactCache.begin(), m_ContactCache.end(), [&](const ContactCacheEntry& e) { return retired(e.key); }), m_ContactCache.end());
+	BuildCollisionPartners();
+
+	// ここで初めて再利用に回す
+	m_FreeIds.insert(m_FreeIds.end(), m_RetiredIds.begin(), m_RetiredIds.end());
+	m_RetiredIds.clear();
+}
 
+// --------------------------------------------------
+// ディスパッチ処理
+// --------------------------------------------------
+void PhysicsSystem::DispatchEvents()
+{
+	m_Stats.events += (int)(m_TriggerEnter.size() + m_TriggerStay.size() + m_TriggerExit.size()
+		+ m_CollisionEnter.size() + m_CollisionStay.size() + m_CollisionExit.size());
+
+	// 受け手の分だけ呼び出しを積む（受け手のいない GameObject はビットで丸ごと省く）
+	m_EventCalls.clear();
+	auto push = [&](Collider* me, Collider* other, uint8_t event)
+		{
+			const GameObject* go = me->Owner();
+			if (!go || !(go->PhysicsEvents() & event)) return;
+			for (const PhysicsListener& l : go->PhysicsListeners())
+				if (l.events & event) m_EventCalls.push_back({ l.component, me, other, event });
+		};
+	auto pushPairs = [&](const std::vector<std::pair<Collider*, Collider*>>& pairs, uint8_t event)
+		{
+			for (auto& p : pairs)
+			{
+				push(p.first, p.second, event);
+				push(p.second, p.first, event);
+			}
+		};
+	pushPairs(m_TriggerEnter  , PhysicsEventTriggerEnter);
+	pushPairs(m_TriggerExit	  , PhysicsEventTriggerExit);
+	pushPairs(m_CollisionEnter, PhysicsEventCollisionEnter);
+	pushPairs(m_CollisionExit , PhysicsEventCollisionExit);
+	pushPairs(m_TriggerStay	  , PhysicsEventTriggerStay);
+	pushPairs(m_CollisionStay , PhysicsEventCollisionStay);
+
+	// 呼び出し
+	for (const EventCall& e : m_EventCalls)
+	{
+		switch (e.event)
+		{
+		case PhysicsEventTriggerEnter:	 e.component->OnTriggerEnter  (e.me, e.other); break;
+		case PhysicsEventTriggerStay:	 e.component->OnTriggerStay	  (e.me, e.other); break;
+		case PhysicsEventTriggerExit:	 e.component->OnTriggerExit	  (e.me, e.other); break;
+		case PhysicsEventCollisionEnter: e.component->OnCollisionEnter(e.me, e.other); break;
+		case PhysicsEventCollisionStay:	 e.component->OnCollisionStay (e.me, e.other); break;
+		case PhysicsEventCollisionExit:	 e.component->OnCollisionExit (e.me, e.other); break;
+		}
+	}
 
-	// n
+	// 後始末
 	m_TriggerEnter.clear();
 	m_TriggerStay.clear();
 	m_TriggerExit.clear();
@@ -557,10 +1308,10 @@ void PhysicsSystem::DispatchEvents()
 }
 
 // ==================================================
-// ----- Query ֌W -----
+// ----- Query 関係 -----
 // ==================================================
 // --------------------------------------------------
-// Pj܂̈ʒuŏdȂĂ邩ił[PԂj
+// １）いまの位置で重なっているか（最も深い１件を返す）
 // --------------------------------------------------
 bool PhysicsSystem::QueryOverlapBest(const Collider* self, QueryHit& outHit, const QueryOptions& opt) const
 {
@@ -568,7 +1319,7 @@ bool PhysicsSystem::QueryOverlapBest(const Collider* self, QueryHit& outHit, con
 	const Collision* shapeA = self->Shape();
 	if (!shapeA) return false;
 
-	// ̌ݎpAABB
+	// 自分の現在姿勢でAABBを作る
 	const ColliderPose& poseA = self->m_WorldPose;
 	const AABB aabbA = shapeA->ComputeWorldAABB(poseA);
 
@@ -582,10 +1333,10 @@ bool PhysicsSystem::QueryOverlapBest(const Collider* self, QueryHit& outHit, con
 		if (!other) continue;
 		if (other == self) continue;
 
-		// Mode tB^
+		// Mode フィルタ
 		if (!PassModeFilter(other, opt)) continue;
 
-		// C[
+		// レイヤー判定
 		if (!ShouldCollide(*self, *other)) continue;
 
 		const Collision* shapeB = other->Shape();
@@ -616,7 +1367,7 @@ bool PhysicsSystem::QueryOverlapBest(const Collider* self, QueryHit& outHit, con
 	return found;
 }
 // --------------------------------------------------
-// QjMTDiŏoj~ꍇ
+// ２）MTD（最小押し出し）だけ欲しい場合
 // --------------------------------------------------
 bool PhysicsSystem::QueryComputeMTD(const Collider* self, Vector3& outMTD, QueryHit* outHit, const QueryOptions& opt) const
 {
@@ -634,121 +1385,250 @@ bool PhysicsSystem::QueryComputeMTD(const Collider* self, Vector3& outMTD, Query
 	return true;
 }
 // --------------------------------------------------
-// Rj^ CapsuleCast: delta ɓƂɍŏɓʒu񕪒TŒT
+// ３）形状キャスト
 // --------------------------------------------------
-bool PhysicsSystem::QueryCapsuleCastBinary(const Collider* self, const Vector3& delta, float skinWidth, QueryHit& outHit, const QueryOptions& opt, int binaryIterations) const
+bool PhysicsSystem::SphereCast(const Vector3& center, float radius, const Vector3& delta, CastHit& outHit, const QueryOptions& opt) const
 {
-	if (!self) return false;
-	const Collision* shapeA = self->Shape();
-	if (!shapeA) return false;
-
-	// ܂AI_ŏdȂȂȂurłȂvƂ݂Ȃ
-	ColliderPose poseStart = self->m_WorldPose; // n_it[j
-	ColliderPose poseEnd = poseStart; // I_ĩt[j
-	poseEnd.position += delta;
-
-	// I_łOvelap`FbN
-	auto OverlapBestAtPose = [&](const ColliderPose& poseA, QueryHit& hit)->bool
-		{
-			const AABB aabbA = shapeA->ComputeWorldAABB(poseA);
+	return CastSupportShape(SupportShape::Sphere(center, radius), delta, nullptr, outHit, opt);
+}
+bool PhysicsSystem::CapsuleCast(const Vector3& p0, const Vector3& p1, float radius, const Vector3& delta, CastHit& outHit, const QueryOptions& opt) const
+{
+	return CastSupportShape(SupportShape::Capsule(p0, p1, radius), delta, nullptr, outHit, opt);
+}
+bool PhysicsSystem::BoxCast(const Vector3& center, const Vector3& halfSize, const Quaternion& rotation, const Vector3& delta, CastHit& outHit, const QueryOptions& opt) const
+{
+	ColliderPose pose{ center, rotation.normalized(), Vector3(1.0f, 1.0f, 1.0f) };
+	const Vector3 axes[3] = { pose.WorldRight(), pose.WorldUp(), pose.WorldForward() };
+	return CastSupportShape(SupportShape::Box(center, axes, halfSize), delta, nullptr, outHit, opt);
+}
+bool PhysicsSystem::ColliderCast(const Collider* self, const Vector3& delta, CastHit& outHit, const QueryOptions& opt) const
+{
+	if (!self || !self->Shape()) return false;
 
-			bool found = false;
-			float bestPenetration = -FLT_MAX;
+	SupportShape shape;
+	if (!MakeSupportShape(*self->Shape(), self->m_WorldPose, shape)) return false; // HeightMap は動かさない
+	return CastSupportShape(shape, delta, self, outHit, opt);
+}
+// --------------------------------------------------
+// 形状キャストの本体
+// HeightMap は掃引 AABB に掛かるセルの三角形ごと、TriangleMesh は BVH で拾った三角形ごとにキャストする
+// --------------------------------------------------
+bool PhysicsSystem::CastSupportShape(const SupportShape& shape, const Vector3& delta, const Collider* self, CastHit& outHit, const QueryOptions& opt) const
+{
+	const float length = delta.length();
+	if (length < 1e-8f) return false;
 
-			const int n = (int)m_Colliders.size();
-			for (int i = 0; i < n; i++)
-			{
-				Collider* other = m_Colliders[i];
-				if (!other) continue;
-				if (other == self) continue;
+	// ----- 掃引 AABB -----
+	AABB sweep;
+	shape.ComputeBounds(sweep.min, sweep.max);
+	sweep = Combine(sweep, { sweep.min + delta, sweep.max + delta });
 
-				if (!PassModeFilter(other, opt)) continue;
-				if (!ShouldCollide(*self, *other)) continue;
+	bool found = false;
+	float best = 1.0f;
+	m_BroadPhase.Query(sweep, [&](int proxyId)
+		{
+			Collider* other = m_BroadPhase.GetUser(proxyId);
+			if (other == self) return true;
 
-				const Collision* shapeB = other->Shape();
-				if (!shapeB) continue;
+			// Mode、レイヤー判定
+			if (!PassQueryFilter(other, opt)) return true;
+			if (self && !ShouldCollide(*self, *other)) return true;
 
-				// u[h
-				if (!aabbA.isOverlap(other->WorldAABB()))continue;
+			const Collision* shapeB = other->Shape();
+			if (!shapeB) return true;
 
-				// Narrow
-				ContactManifold m{};
-				if (!shapeA->isOverlap(poseA, *shapeB, other->m_WorldPose, m, opt.slop)) continue;
-				if (!m.touching || m.count <= 0) continue;
+			// fat AABB ではなく実際の AABB で
+			if (!sweep.isOverlap(other->WorldAABB())) return true;
 
-				const float pene = GetMaxPenetration(m);
-				if (!found || pene >= bestPenetration)
+			auto castTo = [&](const SupportShape& target)
 				{
+					GJK::CastResult r;
+					if (!GJK::ShapeCast(shape, delta, target, best, r)) return;
+					if (found && r.fraction >= best) return;
 					found = true;
-					bestPenetration = pene;
+					best = r.fraction;
 
-					hit.other = other;
-					hit.normal = m.normal;
-					hit.penetration = pene;
-					hit.mtd = -m.normal * pene;
-					hit.manifold = m;
-				}
+					outHit.other	= other;
+					outHit.fraction = r.fraction;
+					outHit.normal	= r.normal;
+					outHit.point	= r.point;
+				};
+
+			if (auto* map = dynamic_cast<const HeightMapCollision*>(shapeB))
+			{
+				const ColliderPose& pose = other->m_WorldPose;
+				int iMin, iMax, jMin, jMax;
+				if (!map->ComputeCellRange(pose, sweep, iMin, iMax, jMin, jMax)) return true;
+
+				// 高さが掃引範囲に掛からないセルはピラミッドでまとめて飛ばす
+				const float yMin = (sweep.min.y - pose.position.y) / pose.scale.y;
+				const float yMax = (sweep.max.y - pose.position.y) / pose.scale.y;
+				map->ForEachCellInRange(iMin, iMax, jMin, jMax, yMin, yMax, [&](int i, int j)
+					{
+						Triangle tri[2];
+						if (!map->BuildCellTrianglesWorld(i, j, pose, tri[0], tri[1])) return;
+						for (const Triangle& t : tri)
+						{
+							// 三角形単位でも掃引範囲に掛からないものは飛ばす
+							if (std::max(t.a.y, std::max(t.b.y, t.c.y)) < sweep.min.y) continue;
+							if (std::min(t.a.y, std::min(t.b.y, t.c.y)) > sweep.max.y) continue;
+							castTo(SupportShape::Triangle(t.a, t.b, t.c));
+						}
+					});
 			}
-			return found;
-		};
+			else if (auto* mesh = dynamic_cast<const TriangleMeshCollision*>(shapeB))
+			{
+				// 掃引 AABB に掛かる三角形だけ BVH で拾う
+				mesh->ForEachTriangleInAABB(other->m_WorldPose, sweep, [&](const Triangle& t)
+					{
+						castTo(SupportShape::Triangle(t.a, t.b, t.c));
+					});
+			}
+			else
+			{
+				SupportShape target;
+				if (MakeSupportShape(*shapeB, other->m_WorldPose, target)) castTo(target);
+			}
+			return true;
+		});
 
-	QueryHit endHit{};
-	if (!OverlapBestAtPose(poseEnd, endHit))
-	{
-		return false;
-	}
+	if (found) outHit.distance = best * length;
+	return found;
+}
+// --------------------------------------------------
+// ４）レイキャスト
+// --------------------------------------------------
+bool PhysicsSystem::Raycast(const Vector3& origin, const Vector3& direction, float maxDistance, RaycastHit& outHit, const QueryOptions& opt) const
+{
+	outHit = RaycastHit{};
+	if (maxDistance <= 0.0f || direction.lengthSq() < 1e-12f) return false;
+	const Vector3 dir = direction.normalized();
 
-	// 񕪒TFŏɏdȂ邔T
-	float lo = 0.0f;
-	float hi = 1.0f;
+	m_BroadPhase.RayCast(origin, dir, maxDistance, [&](int proxyId)
+		{
+			Collider* other = m_BroadPhase.GetUser(proxyId);
+			const Collision* shape = other->Shape();
+			if (!shape || !PassQueryFilter(other, opt)) return maxDistance;
+
+			RayHit hit;
+			if (!shape->Raycast(other->m_WorldPose, origin, dir, maxDistance, hit)) return maxDistance;
+
+			maxDistance = hit.distance; // これより奥は見なくていい
+			outHit.other	= other;
+			outHit.distance = hit.distance;
+			outHit.point	= hit.point;
+			outHit.normal	= hit.normal;
+			return maxDistance;
+		});
+	return outHit.other != nullptr;
+}
+// --------------------------------------------------
+// ５）レイキャストをまとめて
+// 近いレイを束（パケット）にして木を一度で辿る
+// 束全体の AABB で枝ごと刈りつつ、各ノードでまだ届くレイだけを子に渡し、葉では届いたレイを相手の形状にまとめて当てる
+// --------------------------------------------------
+int PhysicsSystem::RaycastMany(const Ray* rays, int count, RaycastHit* outHits, const QueryOptions& opt) const
+{
+	if (count <= 0) return 0;
+	assert(rays && outHits);
 
-	QueryHit midHit{};
-	for (int it = 0; it < binaryIterations; it++)
+	// --------------------------------------------------
+	// レイごとの状態（木の判定で触るものだけ１か所にまとめる、maxDist は当たるたびに縮める）
+	// --------------------------------------------------
+	struct RayState
 	{
-		const float mid = (lo + hi) * 0.5f;
-		ColliderPose poseMid = poseStart;
-		poseMid.position += delta * mid;
+		Vector3 origin, invDir;
+		float maxDist; // 無効なレイは負（どこにも届かない）
+	};
+	RayState states[RayPacketSize];
+	Vector3 dirs[RayPacketSize];
+	std::vector<int> work; // 木を辿るときの番号置き場（パケット間で使い回す）
 
-		QueryHit h{};
-		if (OverlapBestAtPose(poseMid, h)) // ^񒆂ŏdȂ邩`FbN
-		{
-			// dȂ˂ƎO
-			hi = mid;
-			midHit = h;
-		}
-		else
+	// 離れたレイまで一緒にすると束の AABB が大きくなるだけなので、RayPacketSize 本ずつ辿る
+	for (int base = 0; base < count; base += RayPacketSize)
+	{
+		const Ray* packet = rays + base;
+		RaycastHit* packetHits = outHits + base;
+		const int n = std::min(RayPacketSize, count - base);
+
+		// ----- 下ごしらえと束全体の AABB -----
+		AABB bounds{};
+		bool anyValid = false;
+		for (int i = 0; i < n; i++)
 		{
-			lo = mid;
+			packetHits[i] = RaycastHit{};
+			const bool valid = packet[i].maxDistance > 0.0f && packet[i].direction.lengthSq() >= 1e-12f;
+			dirs[i]	  = valid ? packet[i].direction.normalized() : Vector3();
+			states[i] = { packet[i].origin, DynamicAABBTree::InverseDirection(dirs[i]), valid ? packet[i].maxDistance : -1.0f };
+			if (!valid) continue;
+
+			const Vector3 end = packet[i].origin + dirs[i] * packet[i].maxDistance;
+			const AABB segment = Combine({ packet[i].origin, packet[i].origin }, { end, end });
+			bounds = anyValid ? Combine(bounds, segment) : segment;
+			anyValid = true;
 		}
+		if (!anyValid) continue;
+
+		// ----- 木を束で辿る -----
+		m_BroadPhase.RayCastBatch(n, bounds, work,
+			[&states](const AABB& aabb, int i)
+			{
+				const RayState& r = states[i];
+				return aabb.isOverlapRay(r.origin, r.invDir, r.maxDist);
+			},
+			[&](int proxyId, const int* indices, int hitCount)
+			{
+				Collider* other = m_BroadPhase.GetUser(proxyId);
+				const Collision* shape = other->Shape();
+				if (!shape || !PassQueryFilter(other, opt)) return;
+
+				for (int k = 0; k < hitCount; k++)
+				{
+					const int i = indices[k];
+					RayState& r = states[i];
+					if (r.maxDist < 0.0f) continue; // 木の上の方ではレイごとに見ないので、無効なレイも届く
+					RayHit hit;
+					if (!shape->Raycast(other->m_WorldPose, r.origin, dirs[i], r.maxDist, hit)) continue;
+
+					r.maxDist = hit.distance;
+					packetHits[i].other	   = other;
+					packetHits[i].distance = hit.distance;
+					packetHits[i].point	   = hit.point;
+					packetHits[i].normal   = hit.normal;
+				}
+			});
 	}
-	outHit = midHit; // ʁA
-	return true;
+
+	int hitCount = 0;
+	for (int i = 0; i < count; i++)
+		if (outHits[i].other) hitCount++;
+	return hitCount;
 }
 
 // --------------------------------------------------
-// ͔f
+// 力反映
 // m_Rigidbodies
 // --------------------------------------------------
 void PhysicsSystem::IntegrationForce(float dt)
 {
 	for (Rigidbody* rb : m_Rigidbodies)
 	{
-		if (!rb || !rb->IsDynamic()) continue;
+		if (!IsAwakeDynamic(rb)) continue; // 眠っている剛体は飛ばす
 
-		//  InertiaWorldInv ̍XV -----
+		// ここで InertiaWorldInv の更新 -----
 		rb->UpdateInertiaWorldInvFrom(rb->Owner()->Transform()->Rotation());
 
-		// d͉x̌
+		// 重力加速度の決定
 		Vector3 gravity{ 0.0f, 0.0f, 0.0f };
 		switch (rb->GravityMode())
 		{
-		case Rigidbody::GravityMode::Global: // O[od
+		case Rigidbody::GravityMode::Global: // グローバル重力
 			gravity = Gravity * rb->GravityScale();
 			break;
-		case Rigidbody::GravityMode::Custom: // JX^d
+		case Rigidbody::GravityMode::Custom: // カスタム重力
 			gravity = rb->CustomGravity();
 			break;
-		case Rigidbody::GravityMode::None: // d
+		case Rigidbody::GravityMode::None: // 無重力
 			gravity = {0.0f, 0.0f, 0.0f};
 			break;
 		}
@@ -758,8 +1638,8 @@ void PhysicsSystem::IntegrationForce(float dt)
 		Vector3 acc = gravity + force * rb->InvMass();
 		rb->SetVelocity(rb->Velocity() + acc * dt);
 
-		// gNf
-		//  += InertiaWorld^-1 * t * dt
+		// トルク反映
+		// ω += InertiaWorld^-1 * t * dt
 		Vector3 tau = rb->ConsumeTorques();
 		Vector3 omega = rb->ApplyInvInertiaWorld(tau) * dt;
 		rb->SetAngularVelocity(rb->AngularVelocity() + omega);
@@ -767,94 +1647,317 @@ void PhysicsSystem::IntegrationForce(float dt)
 }
 
 // --------------------------------------------------
-// Փ˔
+// ブロードの候補集め（colA の AABB で木を引く）
+// woken はこのステップで起こしたもの（最初に引いたときに拾われていない、静的・眠っていた相手との組だけを拾う）
+// --------------------------------------------------
+void PhysicsSystem::QueryBroadPairs(Collider* colA, bool woken)
+{
+	const AABB& aabbA = colA->WorldAABB();
+	m_BroadCandidates.clear();
+	m_BroadPhase.Query(aabbA, [&](int proxyId)
+		{
+			Collider* colB = m_BroadPhase.GetUser(proxyId);
+			if (colB == colA) return true;
+			if (!woken)
+			{
+				// 同じペアは ID の小さい方からだけ拾う（木を引かない相手は必ずこちらで拾う）
+				if (colB->Id() < colA->Id() && IsBroadQuerier(colB)) return true;
+			}
+			else
+			{
+				// 起きていた相手とは拾い済み、一緒に起こしたもの同士は ID の小さい方から
+				const bool resting = m_BroadSetOf[colB->Id()] == BroadSet::Static || IsSleepingCollider(colB);
+				if (!resting && !(m_BroadWoken[colB->Id()] && colA->Id() < colB->Id())) return true;
+			}
+			if (colB->IsQuery()) return true; // QueryOnly は早期リターン
+
+			// レイヤー判定
+			if (!ShouldCollide(*colA, *colB)) return true;
+
+			// Dynamic かトリガーが絡む組だけ（Kinematic×Static、Kinematic 同士は解くものもイベントも無い）
+			if (m_BroadSetOf[colA->Id()] != BroadSet::Dynamic && m_BroadSetOf[colB->Id()] != BroadSet::Dynamic &&
+				m_BroadSetOf[colA->Id()] != BroadSet::Trigger && m_BroadSetOf[colB->Id()] != BroadSet::Trigger)
+			{
+				m_Stats.broadphaseSkipped++;
+				return true;
+			}
+
+			m_BroadCandidates.push_back(colB->Id());
+			return true;
+		});
+
+	// fat AABB ではなく実際の AABB で当たっているか大まかに判定（SoA でまとめて）
+	m_Stats.broadphaseTests += (int)m_BroadCandidates.size();
+	m_BroadHits.resize(m_BroadCandidates.size());
+	const int hitCount = SimdKernels::OverlapIndexed(aabbA, m_WorldAABBs, m_BroadCandidates.data(), (int)m_BroadCandidates.size(), m_BroadHits.data());
+	const bool triggerA = m_BroadSetOf[colA->Id()] == BroadSet::Trigger;
+	for (int i = 0; i < hitCount; i++)
+	{
+		const int idB = m_BroadHits[i];
+		std::vector<uint64_t>& pairs = (triggerA || m_BroadSetOf[idB] == BroadSet::Trigger) ? m_TriggerPairs : m_CandidatePairs;
+		pairs.push_back(MakePairKey(colA->Id(), idB));
+	}
+}
+
+// --------------------------------------------------
+// 衝突判定
 // m_Colliders
 // --------------------------------------------------
 void PhysicsSystem::DetermineCollision()
 {
-	// 蔻
-	const int n = (int)m_Colliders.size();
-	for (int ia = 0; ia < n; ia++)
+	// ----- ブロード（動的 AABB 木）-----
+	// 各コライダーの AABB で木を引いて候補ペアを集める
+	// 静的なものは木を引かない（静的同士の組は出さない、静的との組は相手側で拾う）
+	m_CandidatePairs.clear();
+	m_TriggerPairs.clear();
+	m_Stats.broadphaseSkipped = m_StaticPairCount;
+	ForEachMovingCollider([&](Collider* col) { m_ShapeRecords[col->Id()].pose = col->m_WorldPose; }); // ナロー用に姿勢を写す（静的なものは振り分けたときに写してある）
+	m_BroadSleepers.clear();
+	ForEachMovingCollider([&](Collider* colA)
+	{
+		if (IsSleepingCollider(colA)) { m_BroadSleepers.push_back(colA); return; } // 眠っている側からは引かない（相手側で拾う）
+		if (IsBroadQuerier(colA)) QueryBroadPairs(colA, false);
+	});
+	// 木の形に依存しないようにキー順に並べる
+	std::sort(m_CandidatePairs.begin(), m_CandidatePairs.end());
+	EndPhase(PhysicsStepStats::Broadphase);
+
+	// ----- 眠っているアイランドを起こす -----
+	// 起きている剛体が実際に触れたら、相手のアイランドごと起こす
+	if (!m_SleepingIslands.empty())
 	{
-		// Collider 擾
-		Collider* colA = m_Colliders[ia];
-		if (colA->IsQuery()) continue; // QueryOnly ͑^[
-		const Collision* shapeA = colA->Shape();
-		if (!shapeA) continue;
+		const size_t sleepingIslands = m_SleepingIslands.size();
+		for (uint64_t key : m_CandidatePairs)
+		{
+			Collider* colA = m_ById[KeyHigh(key)];
+			Collider* colB = m_ById[KeyLow(key)];
+			if (!colB->Shape()) continue;
+
+			const BodyState stateA = GetBodyState(colA->Body());
+			const BodyState stateB = GetBodyState(colB->Body());
+			Rigidbody* sleeper = nullptr;
+			if		(stateA == BodyState::Awake && stateB == BodyState::Sleeping) sleeper = colB->Body();
+			else if (stateB == BodyState::Awake && stateA == BodyState::Sleeping) sleeper = colA->Body();
+			if (!sleeper) continue;
+
+			ContactManifold m;
+			if (ShapeDispatch::Overlap(m_ShapeRecords[colA->Id()], m_ShapeRecords[colB->Id()], m, 0.0f) && m.touching && m.count > 0)
+				WakeIsland(sleeper);
+		}
 
-		for (int ib = ia + 1; ib < n; ib++)
+		// 起こしたものはまだ木を引いていないので、静的なもの・一緒に眠っていたものとの組をここで拾う
+		if (m_SleepingIslands.size() != sleepingIslands)
 		{
-			Collider* colB = m_Colliders[ib];
-			if (colB->IsQuery()) continue; // QueryOnly ͑^[
+			const size_t broadPairs = m_CandidatePairs.size();
+			for (Collider* c : m_BroadSleepers) if (!IsSleepingCollider(c)) m_BroadWoken[c->Id()] = 1;
+			for (Collider* c : m_BroadSleepers) if (m_BroadWoken[c->Id()] && IsBroadQuerier(c)) QueryBroadPairs(c, true);
+			for (Collider* c : m_BroadSleepers) m_BroadWoken[c->Id()] = 0;
+			std::sort(m_CandidatePairs.begin() + broadPairs, m_CandidatePairs.end());
+			std::inplace_merge(m_CandidatePairs.begin(), m_CandidatePairs.begin() + broadPairs, m_CandidatePairs.end());
+		}
+	}
+	m_Stats.broadphasePairs = (int)m_CandidatePairs.size();
+	m_Stats.triggerPairs	= (int)m_TriggerPairs.size();
 
-			// C[
-			if (!ShouldCollide(*colA, *colB)) continue;
+	// 眠り×眠り、眠り×静的のペアは候補に出てこないので、イベントだけ前ステップから引き継ぐ
+	if (!m_SleepingIslands.empty())
+	{
+		auto resting = [&](const Collider* c) { return IsSleepingCollider(c) || m_BroadSetOf[c->Id()] == BroadSet::Static; };
+		auto carry = [&](const auto& prev, auto& curr)
+			{
+				for (uint64_t key : prev)
+				{
+					if (!IsLivePair(key)) continue;
+					const Collider* colA = m_ById[KeyHigh(key)];
+					const Collider* colB = m_ById[KeyLow(key)];
+					if (resting(colA) && resting(colB) && (IsSleepingCollider(colA) || IsSleepingCollider(colB))) curr.push_back(key);
+				}
+			};
+		carry(m_PrevTrigger, m_CurrTrigger);
+		carry(m_PrevCollision, m_CurrCollision);
+	}
 
-			// u[hiAABBj
-			if (!colA->WorldAABB().isOverlap(colB->WorldAABB())) continue; // AABB œĂ邩܂ɔ
+	// ----- ナロー -----
+	// 候補ペアを形状の組ごとに並べ直す（組の中はキー順のまま）
+	constexpr int PairTypeCount = ShapeDispatch::TypeCount * ShapeDispatch::TypeCount;
+	auto pairType = [&](uint64_t key) { return ShapeDispatch::PairIndex(m_ShapeRecords[KeyHigh(key)].type, m_ShapeRecords[KeyLow(key)].type); };
+	std::fill(std::begin(m_NarrowBatchStart), std::end(m_NarrowBatchStart), 0);
+	for (uint64_t key : m_CandidatePairs) m_NarrowBatchStart[pairType(key) + 1]++;
+	for (int k = 0; k < PairTypeCount; k++) m_NarrowBatchStart[k + 1] += m_NarrowBatchStart[k];
+	m_NarrowPairs.resize(m_CandidatePairs.size());
+	{
+		int fill[PairTypeCount];
+		std::copy(m_NarrowBatchStart, m_NarrowBatchStart + PairTypeCount, fill);
+		for (uint64_t key : m_CandidatePairs) m_NarrowPairs[fill[pairType(key)]++] = key;
+	}
 
-			// i[
-			const Collision* shapeB = colB->Shape();
-			if (!shapeB) continue;
+	// ペアは互いに独立なので、並べたペアとトリガーのペアをスレッド数で区切って判定する
+	// 各スレッドは自分のバッファに積み、最後にスレッド順に繋ぐ（区切った順に繋ぐので逐次と同じ並び）
+	const int narrowCount  = (int)m_NarrowPairs.size();
+	const int triggerCount = (int)m_TriggerPairs.size();
+	const int threads = (narrowCount + triggerCount >= MinParallelPairs * m_WorkerPool.ThreadCount()) ? m_WorkerPool.ThreadCount() : 1;
+	if ((int)m_NarrowBuffers.size() < threads) m_NarrowBuffers.resize(threads);
+	auto runThreads = [&](const std::function<void(int)>& job)
+		{
+			if (threads > 1) m_WorkerPool.Run([&](int t) { if (t < threads) job(t); });
+			else			 job(0);
+		};
+	// [0, count) の t 番目の区切り（align の倍数で区切る）
+	auto sliceBegin = [&](int count, int t, int align) { return std::min(count, (int)((int64_t)count * t / threads) / align * align); };
+
+	// 球 × 球（リンゴ同士など）は先にまとめて判定しておく（SIMD の幅で区切る）
+	// 接触点が１つで浮きかける角が無いので SpeculativeMargin は使わない
+	const int sphereType  = ShapeDispatch::PairIndex(ColliderType::Sphere, ColliderType::Sphere);
+	const int sphereBegin = m_NarrowBatchStart[sphereType];
+	const int sphereCount = m_NarrowBatchStart[sphereType + 1] - sphereBegin;
+	if (sphereCount > 0)
+	{
+		m_SphereIdA.resize(sphereCount);
+		m_SphereIdB.resize(sphereCount);
+		m_SphereManifolds.resize(sphereCount);
+		m_SphereHits.resize(sphereCount);
+		for (int i = 0; i < sphereCount; i++)
+		{
+			m_SphereIdA[i] = KeyHigh(m_NarrowPairs[sphereBegin + i]);
+			m_SphereIdB[i] = KeyLow(m_NarrowPairs[sphereBegin + i]);
+		}
+		runThreads([&](int t)
+			{
+				const int begin = sliceBegin(sphereCount, t, SphereLaneAlign);
+				const int end	= t + 1 < threads ? sliceBegin(sphereCount, t + 1, SphereLaneAlign) : sphereCount;
+				if (begin < end)
+					SimdKernels::SphereSphere(m_ShapeRecords.data(), m_SphereIdA.data() + begin, m_SphereIdB.data() + begin, end - begin, 0.0f,
+						m_SphereManifolds.data() + begin, m_SphereHits.data() + begin);
+			});
+	}
 
-			ContactManifold m; 
-			if (!shapeA->isOverlap(colA->m_WorldPose, *shapeB, colB->m_WorldPose, m, 0.0f)) continue;
+	runThreads([&](int t)
+		{
+			NarrowBuffer& buf = m_NarrowBuffers[t];
+			buf.triggers.clear();
+			buf.collisions.clear();
+			buf.contacts.clear();
+			std::fill(std::begin(buf.calls), std::end(buf.calls), 0);
+
+			// ----- トリガー -----
+			// イベントにはペアのキーしか使わないので、接触点は作らずに重なっているかだけ見る
+			const int triggerEnd = t + 1 < threads ? sliceBegin(triggerCount, t + 1, 1) : triggerCount;
+			for (int p = sliceBegin(triggerCount, t, 1); p < triggerEnd; p++)
+			{
+				const uint64_t key = m_TriggerPairs[p];
+				if (!m_ById[KeyLow(key)]->Shape()) continue;
+				if (ShapeDispatch::Intersect(m_ShapeRecords[KeyHigh(key)], m_ShapeRecords[KeyLow(key)])) buf.triggers.push_back(key);
+			}
 
-			if (colA->IsTrigger() || colB->IsTrigger()) m_CurrTrigger.insert(MakePairKey(colA->Id(), colB->Id()));
-			else // ǂ IsTrigger  off  Collision Cxg			  
+			// ----- 形状の組ごとの判定 -----
+			const int narrowEnd = t + 1 < threads ? sliceBegin(narrowCount, t + 1, 1) : narrowCount;
+			for (int p = sliceBegin(narrowCount, t, 1); p < narrowEnd; p++)
 			{
-				m_CurrCollision.insert(MakePairKey(colA->Id(), colB->Id()));
+				const uint64_t key = m_NarrowPairs[p];
+				Collider* colA = m_ById[KeyHigh(key)];
+				Collider* colB = m_ById[KeyLow(key)];
+				if (!colB->Shape()) continue;
+
+				// 眠り×静的のペアは判定を省いて、イベントだけ前ステップから引き継ぐ
+				{
+					const BodyState stateA = GetBodyState(colA->Body());
+					const BodyState stateB = GetBodyState(colB->Body());
+					if (stateA != BodyState::Awake && stateB != BodyState::Awake)
+					{
+						if (stateA == BodyState::Sleeping || stateB == BodyState::Sleeping)
+						{
+							if (std::binary_search(m_PrevCollision.begin(), m_PrevCollision.end(), key)) buf.collisions.push_back(key);
+							continue;
+						}
+					}
+				}
+
+				const int k = pairType(key);
+				buf.calls[k]++;
+				ContactManifold m;
+				if (k == sphereType)
+				{
+					if (!m_SphereHits[p - sphereBegin]) continue;
+					m = m_SphereManifolds[p - sphereBegin];
+				}
+				else if (!ShapeDispatch::Overlap(m_ShapeRecords[colA->Id()], m_ShapeRecords[colB->Id()], m, SpeculativeMargin)) continue;
+
+				// トリガーは別に判定しているので、ここに来るのはどっちも IsTrigger が off のペア（Collision イベントへ）
+				if (HasPenetratingPoint(m)) buf.collisions.push_back(key);
 				if (m.touching && m.count > 0)
-					m_Contacts.push_back({ colA, colB, m });
+				{
+					if (m_EnableWarmStart) WarmStartFromCache(key, colA, m); // 前ステップの累積インパルスを引き継ぐ（キャッシュは読むだけ）
+					buf.contacts.push_back({ colA, colB, m });
+				}
 			}
-		}
+		});
+
+	// スレッド順に繋ぐ
+	for (int t = 0; t < threads; t++)
+	{
+		const NarrowBuffer& buf = m_NarrowBuffers[t];
+		m_CurrTrigger.insert(m_CurrTrigger.end(), buf.triggers.begin(), buf.triggers.end());
+		m_CurrCollision.insert(m_CurrCollision.end(), buf.collisions.begin(), buf.collisions.end());
+		m_Contacts.insert(m_Contacts.end(), buf.contacts.begin(), buf.contacts.end());
+		for (int k = 0; k < PairTypeCount; k++) m_Stats.narrowphaseCalls[k] += buf.calls[k];
 	}
+	EndPhase(PhysicsStepStats::Narrowphase);
 }
 
 // --------------------------------------------------
-// Փ˓_̎OvZ
+// 衝突点の事前計算
 // m_Contacts
 // --------------------------------------------------
 void PhysicsSystem::PreSolveContacts()
 {
-	// Փ˃yA
+	// 衝突ペア
 	for (auto& c : m_Contacts)
 	{
-		if (c.m.touching && c.m.count > 0) // GĂ邩Փ˓_
+		if (c.m.touching && c.m.count > 0) // 触れているかつ衝突点あり
 		{
-			// Rigidbody 擾
-			auto* rbA = c.A->Owner()->GetComponent<Rigidbody>();
-			auto* rbB = c.B->Owner()->GetComponent<Rigidbody>();
-
-			const float invA = (rbA && rbA->IsDynamic()) ? rbA->InvMass() : 0.0f; // tʎ擾
-			const float invB = (rbB && rbB->IsDynamic()) ? rbB->InvMass() : 0.0f; // tʎ擾
-
-			// W
+			// Rigidbody 取得（コライダーが持っている）
+			auto* rbA = c.A->Body();
+			auto* rbB = c.B->Body();
+
+			const float invA = (rbA && rbA->IsDynamic()) ? rbA->InvMass() : 0.0f; // 逆質量取得
+			const float invB = (rbB && rbB->IsDynamic()) ? rbB->InvMass() : 0.0f; // 逆質量取得
+
+			// 摩擦係数（現在はRigidbody）
+			const float fricDynamicA = rbA ? rbA->FrictionDynamic() : 0.0f;
+			const float fricDynamicB = rbB ? rbB->FrictionDynamic() : 0.0f;
+			const float fricStaticA = rbA ? rbA->FrictionStatic() : 0.0f;
+			const float fricStaticB = rbB ? rbB->FrictionStatic() : 0.0f;
+			auto Mix = [](float a, float b) {return (a > 0.0f && b > 0.0f) ? sqrtf(a * b) : std::max(a, b); };
+			const float fricD = std::max(0.0f, Mix(fricDynamicA, fricDynamicB));
+			c.frictionDynamic = fricD;
+			c.frictionStatic  = std::max(0.0f, std::max(Mix(fricStaticA, fricStaticB), fricD)); // fricS >= fricD
+
+			// 反発係数
 			const float eCandidate = std::max(rbA ? rbA->Restitution() : 0.0f,
 											  rbB ? rbB->Restitution() : 0.0f);
 
-			// eՓ˓_
+			// 各衝突点
 			for (int i = 0; i < c.m.count; i++)
 			{
 				float biasRest = 0.0f;
 
 				if (invA + invB > 0.0f && eCandidate > 0.0f)
 				{
-					const Vector3 p = (c.m.points[i].pointOnA + c.m.points[i].pointOnB) * 0.5f; //ڐG_̒_߂
-					const Vector3 xA = rbA ? rbA->WorldCOM() : Vector3(); // dSW
-					const Vector3 xB = rbB ? rbB->WorldCOM() : Vector3(); // dSW
-					const Vector3 rA = p - xA; // COM ̃xNgiΈʒuj
-					const Vector3 rB = p - xB; // COM ̃xNgiΈʒuj
+					const Vector3 p = (c.m.points[i].pointOnA + c.m.points[i].pointOnB) * 0.5f; //接触点の中点を求める
+					const Vector3 xA = rbA ? rbA->WorldCOM() : Vector3(); // 重心座標
+					const Vector3 xB = rbB ? rbB->WorldCOM() : Vector3(); // 重心座標
+					const Vector3 rA = p - xA; // COM からのベクトル（相対位置）
+					const Vector3 rB = p - xB; // COM からのベクトル（相対位置）
 
-					// xip݁j
+					// 速度（角成分込み）
 					const Vector3 vA = rbA ? rbA->Velocity() : Vector3{};
 					const Vector3 wA = rbA ? rbA->AngularVelocity() : Vector3{};
 					const Vector3 vB = rbB ? rbB->Velocity() : Vector3{};
 					const Vector3 wB = rbB ? rbB->AngularVelocity() : Vector3{};
 
-					// ڐG_̑Αx vRel = (vB + wB~rB) - (vA + wA~rA) [relative velocity]
-					const Vector3 vRel = (vB + Vector3::Cross(wB, rB)) - (vA + Vector3::Cross(wA, rA)); // ΑxiA猩B̑Αxj
-					const float relVelN = Vector3::Dot(vRel, c.m.normal); // @̑Αx [normal relative velocity]
+					// 接触点の相対速度 vRel = (vB + wB×rB) - (vA + wA×rA) [relative velocity]
+					const Vector3 vRel = (vB + Vector3::Cross(wB, rB)) - (vA + Vector3::Cross(wA, rA)); // 相対速度（Aから見たBの相対速度）
+					const float relVelN = Vector3::Dot(vRel, c.m.normal); // 法線方向の相対速度 [normal relative velocity]
 					if (relVelN < -RestThreshold)
 					{
 						biasRest = eCandidate * relVelN;
@@ -864,363 +1967,916 @@ void PhysicsSystem::PreSolveContacts()
 			}
 		}
 	}
-}
 
-// --------------------------------------------------
-// x
-// m_Contacts
-// CpX@iڐGACAWCgȂǂ̑xSőɑxXV@j
-// --------------------------------------------------
-void PhysicsSystem::ResolveVelocity(float dt)
-{
+	// ----- ウォームスタート -----
+	// 反発バイアスは引き継ぎ前の速度で求めたいので、全部計算し終わってから適用する
 	for (auto& c : m_Contacts)
 	{
-		auto* rbA = c.A->Owner()->GetComponent<Rigidbody>();
-		auto* rbB = c.B->Owner()->GetComponent<Rigidbody>();
-
-		const float invA = (rbA && rbA->IsDynamic()) ? rbA->InvMass() : 0.0f; // tʎ擾
-		const float invB = (rbB && rbB->IsDynamic()) ? rbB->InvMass() : 0.0f; // tʎ擾
-		if (invA + invB == 0.0f) continue; // Œ
-		// @
-		const Vector3 n = c.m.normal; // AB
-
-		// CWi݂Rigidbodyj
-		const float fricDynamicA = rbA ? rbA->FrictionDynamic() : 0.0f;
-		const float fricDynamicB = rbB ? rbB->FrictionDynamic() : 0.0f;
-		const float fricStaticA = rbA ? rbA->FrictionStatic() : 0.0f;
-		const float fricStaticB = rbB ? rbB->FrictionStatic() : 0.0f;
-		auto Mix = [](float a, float b) {return (a > 0.0f && b > 0.0f) ? sqrtf(a * b) : std::max(a, b); };
-		float fricD = Mix(fricDynamicA, fricDynamicB);
-		float fricS = Mix(fricStaticA, fricStaticB);
-		fricD = std::max(0.0f, fricD);
-		fricS = std::max(0.0f, std::max(fricS, fricD)); // fricS >= fricD
-
-		// ----- p̏wp -----
-		// d : ]i@܂͐ڐj
-		// ڐG_ɕ̃CpX 1[NEs]ꂽƂ́up^ɂtx^vXJ[ŕԂ
-		// ڐG_x(v = ց~r)ɃCpX(P = d * j)ꂽƂ̊pxω( = I^-1(r~P))ڐG_x֖߂^((I^-1(r~d))~r)ŎˉéiHj
-		auto AngTerm = [](Rigidbody* rb, const Vector3& r, const Vector3& d) -> float
-			{
-				// nE[(I^-1 (r~d))~r] = dot(d, (r~d))~r)WJĂǐdł
-				return  Vector3::Dot(d, Vector3::Cross(rb->ApplyInvInertiaWorld(Vector3::Cross(r, d)), r));
-			};
+		auto* rbA = c.A->Body();
+		auto* rbB = c.B->Body();
+		const float invA = (rbA && rbA->IsDynamic()) ? rbA->InvMass() : 0.0f;
+		const float invB = (rbB && rbB->IsDynamic()) ? rbB->InvMass() : 0.0f;
+		if (invA + invB == 0.0f) continue;
 
-		// ======== PHASE 1: Sړ_́u@v =========
-		// eڐG_ɂĖ@CpX
-		for (int i = 0; i < c.m.count; i++)
-		{
-			// ڐG_ COM 
-			const Vector3 p = (c.m.points[i].pointOnA + c.m.points[i].pointOnB) * 0.5f; //ڐG_̒_߂
-			const Vector3 pA = c.m.points[i].pointOnA;
-			const Vector3 pB = c.m.points[i].pointOnB;
-			const Vector3 xA = rbA ? rbA->WorldCOM() : Vector3(); // dSW
-			const Vector3 xB = rbB ? rbB->WorldCOM() : Vector3(); // dSW
-			const Vector3 rA = p - xA; // COM ̃xNgiΈʒuj
-			const Vector3 rB = p - xB; // COM ̃xNgiΈʒuj
-			
-			// xip݁j
-			const Vector3 vA = rbA ? rbA->GetLinearVelocitySolver()  : Vector3() ;
-			const Vector3 wA = rbA ? rbA->GetAngularVelocitySolver() : Vector3() ;
-			const Vector3 vB = rbB ? rbB->GetLinearVelocitySolver()  : Vector3() ;
-			const Vector3 wB = rbB ? rbB->GetAngularVelocitySolver() : Vector3() ;
-
-			// ڐG_̑Αx vRel = (vB + wB~rB) - (vA + wA~rA) [relative velocity]
-			const Vector3 vRel = (vB + Vector3::Cross(wB, rB)) - (vA + Vector3::Cross(wA, rA)); // ΑxiA猩B̑Αxj
-			const float relVelN = Vector3::Dot(vRel, n); // @̑Αx [normal relative velocity]
-			if (relVelN > 0.0f && c.m.points[i].penetration <= Slop) continue; // Ă && ߂荞݂ Ȃ̂ŕsv
-
-
-			// ----- @CpXip݂̗Lʁj -----
-			// Lʂ̕i@j
-			float denomN = invA + invB; // p݂̖@̗Lʂ̋t [normal effective mass]
-			if (rbA && invA > 0.0f) denomN += AngTerm(rbA, rA, n); // ڐG_x́ghǂꂾς邩\W
-			if (rbB && invB > 0.0f) denomN += AngTerm(rbB, rB, n); //  k = (invA + invB + AngTermA + AngTermB)
-			if (denomN < 1e-12f) continue;
-
-			// ʒuoCAX
-			const float pen = c.m.points[i].penetration;
-			const float bias_pos = pen > Slop ? Baumgarte * (pen - Slop) / dt : 0.0f;
-			// oCAX
-			const float bias_rest = c.m.points[i].restitutionBias; // Ŕ܂܂
-
-			// CpXiCpXʁj
-			float deltaImpulseN = -(relVelN + bias_pos + bias_rest) / denomN;
-			// delta = relVelN / denomN; // ̑ΑxOɂCpX
-			// delota += bias_rest / denomN; // ̑xɂCpX
-
-
-			// ݐσCpX
-			float old = c.m.points[i].accumN;
-			c.m.points[i].accumN = std::max(0.0f, old + deltaImpulseN);
-			deltaImpulseN = c.m.points[i].accumN - old; // ۂɓKp鑝
-
-			const Vector3 impulseVector = n * deltaImpulseN; // xNgCpX [normal impulse vector]
-
-			// v   ɑKp -----
-			if (rbA && invA > 0.0f)
-			{
-				rbA->SetVelocity(vA - impulseVector * invA);
-				rbA->SetAngularVelocity(wA - rbA->ApplyInvInertiaWorld(Vector3::Cross(rA, impulseVector)));
-			}
-			if (rbB && invB > 0.0f)
-			{
-				rbB->SetVelocity(vB + impulseVector * invB);
-				rbB->SetAngularVelocity(wB + rbB->ApplyInvInertiaWorld(Vector3::Cross(rB, impulseVector)));
-			}
-		}
-		
-		// ======== PHASE 2: Sړ_́uCv =========
-		// eڐG_ɂĖC
 		for (int i = 0; i < c.m.count; i++)
 		{
-			// ڐG_ COM 
-			const Vector3 p = (c.m.points[i].pointOnA + c.m.points[i].pointOnB) * 0.5f; //ڐG_̒_߂
-			const Vector3 pA = c.m.points[i].pointOnA;
-			const Vector3 pB = c.m.points[i].pointOnB;
-			const Vector3 xA = rbA ? rbA->WorldCOM() : Vector3(); // dSW
-			const Vector3 xB = rbB ? rbB->WorldCOM() : Vector3(); // dSW
-			const Vector3 rA = p - xA; // COM ̃xNgiΈʒuj
-			const Vector3 rB = p - xB; // COM ̃xNgiΈʒuj
-
-			// ----- Ći@XV̑Αxŕ]j -----
-			const Vector3 vA2 = rbA ? rbA->GetLinearVelocitySolver()  : Vector3();
-			const Vector3 wA2 = rbA ? rbA->GetAngularVelocitySolver() : Vector3();
-			const Vector3 vB2 = rbB ? rbB->GetLinearVelocitySolver()  : Vector3();
-			const Vector3 wB2 = rbB ? rbB->GetAngularVelocitySolver() : Vector3();
-			const Vector3 vRel2 = (vB2 + Vector3::Cross(wB2, rB)) - (vA2 + Vector3::Cross(wA2, rA)); // Αx
-
-			// ----- ]ڐ̃CpX -----
-			Vector3 t1;
-			if (fabsf(n.x) > 0.57735f) t1 = Vector3{ -n.y, n.x, 0.0f };
-			else					   t1 = Vector3{ 0.0f, -n.z, n.y };
-			t1 = t1.normalized();
-			Vector3 t2 = Vector3::Cross(n, t1); // ڐiQځj
-
-			// Lʂ̕
-			float denomT1 = invA + invB; // ڐ̗Lʂ̕ [tangential impulse mass]
-			if (rbA && invA > 0.0f) denomT1 += AngTerm(rbA, rA, t1);
-			if (rbB && invB > 0.0f) denomT1 += AngTerm(rbB, rB, t1);
-			if (denomT1 < 1e-12f) continue;
-			float denomT2 = invA + invB; // ڐ̗Lʂ̕ [tangential impulse mass]
-			if (rbA && invA > 0.0f) denomT2 += AngTerm(rbA, rA, t2);
-			if (rbB && invB > 0.0f) denomT2 += AngTerm(rbB, rB, t2);
-			if (denomT2 < 1e-12f) continue;
-
-			// ]܂iÎ~C^[Qbg vt' = 0j
-			float v_t1 = Vector3::Dot(vRel2, t1);
-			float v_t2 = Vector3::Dot(vRel2, t2);
-			float deltaImpulseT_desired_1 = -(v_t1) / denomT1; // [tangential impulse scalar]
-			float deltaImpulseT_desired_2 = -(v_t2) / denomT2; // [tangential impulse scalar]
-
-			// ----- Coulomb ~ia =  * jnjŃNv -----
-			float jtMaxS = fricS * c.m.points[i].accumN; // Î~Ca@ * jn iݐρj
-			float jtMaxD = fricD * c.m.points[i].accumN; // Ca@ * jn iݐρj
-			if (jtMaxD <= 0.0f) continue; // @͂ȂC
-
-			Vector3 oldImpWorld = c.m.points[i].accumImpulseT; // [hݐ
-			float oldImp1 = Vector3::Dot(oldImpWorld, t1); // t1 o
-			float oldImp2 = Vector3::Dot(oldImpWorld, t2); // t2 o
-
-			Vector3 starImp = Vector3{ oldImp1 + deltaImpulseT_desired_1, oldImp2 + deltaImpulseT_desired_2, 0.0f };
-			float deltaImpulseT = starImp.length(); // ۂɓKpCpX
-
-			Vector3 newImp;
-			if (deltaImpulseT <= jtMaxS) // static : S~
-			{
-				newImp = starImp;
-			}
-			else // slip : C~ɒt
-			{ 
-				if (deltaImpulseT > 1e-12f) newImp = starImp * (jtMaxD / deltaImpulseT);
-				else						newImp = Vector3();
-			}
+			const ContactPoint& cp = c.m.points[i];
+			if (cp.accumN == 0.0f && cp.accumImpulseT.lengthSq() == 0.0f) continue;
 
-			Vector3 delta = newImp - Vector3{ oldImp1, oldImp2, 0.0f };
-
-			c.m.points[i].accumImpulseT = t1 * newImp.x + t2 * newImp.y; // ݐς͐ExNgŕۑ
-
-			const Vector3 impulseTVector = t1 * delta.x + t2 * delta.y; // ڐɊ|CpXxNg [tangential impulse vector]
+			const Vector3 p = (cp.pointOnA + cp.pointOnB) * 0.5f; //接触点の中点を求める
+			const Vector3 impulse = c.m.normal * cp.accumN + cp.accumImpulseT; // 法線＋接線
 			if (rbA && invA > 0.0f)
 			{
-				rbA->SetVelocity(rbA->Velocity() - impulseTVector * invA);
-				rbA->SetAngularVelocity(rbA->AngularVelocity() - rbA->ApplyInvInertiaWorld(Vector3::Cross(rA, impulseTVector)));
+				const Vector3 rA = p - rbA->WorldCOM();
+				rbA->SetVelocity(rbA->Velocity() - impulse * invA);
+				rbA->SetAngularVelocity(rbA->AngularVelocity() - rbA->ApplyInvInertiaWorld(Vector3::Cross(rA, impulse)));
 			}
 			if (rbB && invB > 0.0f)
 			{
-				rbB->SetVelocity(rbB->Velocity() + impulseTVector * invB);
-				rbB->SetAngularVelocity(rbB->AngularVelocity() + rbB->ApplyInvInertiaWorld(Vector3::Cross(rB, impulseTVector)));
+				const Vector3 rB = p - rbB->WorldCOM();
+				rbB->SetVelocity(rbB->Velocity() + impulse * invB);
+				rbB->SetAngularVelocity(rbB->AngularVelocity() + rbB->ApplyInvInertiaWorld(Vector3::Cross(rB, impulse)));
 			}
 		}
 	}
 }
 
 // --------------------------------------------------
-// 
-// m_Rigidbodies
+// 接触キャッシュ
+// 法線がほぼ同じで、A のローカルで近い点同士を同じ接触点とみなす
 // --------------------------------------------------
-void PhysicsSystem::ApplyDamping(float dt)
+void PhysicsSystem::WarmStartFromCache(uint64_t key, const Collider* colA, ContactManifold& m) const
 {
-	if (dt <= 0.0f) return;
-
-	for (Rigidbody* rb : m_Rigidbodies)
+	auto it = std::lower_bound(m_ContactCache.begin(), m_ContactCache.end(), key, [](const ContactCacheEntry& e, uint64_t k) { return e.key < k; });
+	if (it == m_ContactCache.end() || it->key != key) return;
+	const ContactCacheEntry& e = *it;
+	if (Vector3::Dot(e.normal, m.normal) < WarmStartNormalDot) return; // 向きが変わったら使わない
+
+	const ColliderPose& poseA = colA->WorldPose();
+	const Quaternion invRotA = poseA.rotation.Conjugate();
+	bool used[ContactManifold::MAX_POINTS] = {};
+	for (int i = 0; i < m.count; i++)
 	{
-		if (!rb || !rb->IsDynamic()) continue;
+		const Vector3 p = (m.points[i].pointOnA + m.points[i].pointOnB) * 0.5f;
+		const Vector3 local = invRotA.Rotate(p - poseA.position);
 
-		const float a = std::exp(-rb->LinDamping() * dt);
-		const float b = std::exp(-rb->AngDamping() * dt);
+		// 一番近い未使用の点
+		int best = -1;
+		float bestDistSq = WarmStartMatchDist * WarmStartMatchDist;
+		for (int j = 0; j < e.count; j++)
+		{
+			if (used[j]) continue;
+			const float d = (e.localPointA[j] - local).lengthSq();
+			if (d < bestDistSq) { bestDistSq = d; best = j; }
+		}
+		if (best < 0) continue;
 
-		// `
-		rb->SetVelocity(rb->Velocity() * a);
-		rb->SetAngularVelocity(rb->AngularVelocity() * b);
+		used[best] = true;
+		m.points[i].accumN = e.accumN[best];
+		m.points[i].accumImpulseT = e.accumImpulseT[best];
+	}
+}
+void PhysicsSystem::UpdateContactCache()
+{
+	m_StepStamp++;
+
+	// ----- キー順に並べる -----
+	// m_Contacts はほとんどキー順（起こしたペアなどが後ろに付く）なので、崩れているときだけ並べ替える
+	// 同じペアが２つあれば後の方を残す（stable_sort で順番を保つ）
+	m_ContactCacheOrder.clear();
+	for (int i = 0; i < (int)m_Contacts.size(); i++)
+		m_ContactCacheOrder.push_back({ MakePairKey(m_Contacts[i].A->Id(), m_Contacts[i].B->Id()), i });
+	auto byKey = [](const std::pair<uint64_t, int>& a, const std::pair<uint64_t, int>& b) { return a.first < b.first; };
+	if (!std::is_sorted(m_ContactCacheOrder.begin(), m_ContactCacheOrder.end(), byKey))
+		std::stable_sort(m_ContactCacheOrder.begin(), m_ContactCacheOrder.end(), byKey);
+
+	// ----- 今ステップの接触で作り直す（触れていないペアはここで消える）-----
+	m_ContactCache.clear();
+	for (size_t n = 0; n < m_ContactCacheOrder.size(); n++)
+	{
+		if (n + 1 < m_ContactCacheOrder.size() && m_ContactCacheOrder[n + 1].first == m_ContactCacheOrder[n].first) continue;
+		const Contact& c = m_Contacts[m_ContactCacheOrder[n].second];
+		m_ContactCache.emplace_back();
+		ContactCacheEntry& e = m_ContactCache.back();
+		e.key = m_ContactCacheOrder[n].first;
+		const ColliderPose& poseA = c.A->WorldPose();
+		const Quaternion invRotA = poseA.rotation.Conjugate();
+
+		e.normal = c.m.normal;
+		e.count  = c.m.count;
+		for (int i = 0; i < c.m.count; i++)
+		{
+			const Vector3 p = (c.m.points[i].pointOnA + c.m.points[i].pointOnB) * 0.5f;
+			e.localPointA[i]   = invRotA.Rotate(p - poseA.position);
+			e.accumN[i]		   = c.m.points[i].accumN;
+			e.accumImpulseT[i] = c.m.points[i].accumImpulseT;
+		}
+		for (int i = c.m.count; i < ContactManifold::MAX_POINTS; i++) // 使わない分も０にしておく（スナップショットのバイト列が実行ごとに変わらないように）
+		{
+			e.localPointA[i]   = Vector3(0.0f, 0.0f, 0.0f);
+			e.accumImpulseT[i] = Vector3(0.0f, 0.0f, 0.0f);
+		}
+		e.stamp = m_StepStamp;
 	}
 }
 
 // --------------------------------------------------
-// ʒu␳
+// 速度解決
 // m_Contacts
+// 逐次インパルス法（接触、摩擦、ジョイントなどの速度拘束で即座に速度を更新する手法）
 // --------------------------------------------------
-void PhysicsSystem::CorrectPosition()
+void PhysicsSystem::ResolveVelocity(float dt)
 {
 	for (auto& c : m_Contacts)
-	{
-		auto* rbA = c.A->Owner()->GetComponent<Rigidbody>();
-		auto* rbB = c.B->Owner()->GetComponent<Rigidbody>();
-		const float invA = (rbA && rbA->IsDynamic()) ? rbA->InvMass() : 0.0f;
-		const float invB = (rbB && rbB->IsDynamic()) ? rbB->InvMass() : 0.0f;
-		if (invA + invB == 0.0f) continue;
+		if (IsSolverIslandActive(c.island)) RecordSolverDelta(0, c.island, ResolveContact(c, dt));
+}
+float PhysicsSystem::ResolveContact(Contact& c, float dt)
+{
+	// ソルバーボディ（PreSolve で番号を振ってある）
+	SolverBodySet& bodies = m_SolverBodies;
+	const int iA = c.bodyA;
+	const int iB = c.bodyB;
+
+	const float invA = bodies.InvMass(iA); // 逆質量取得
+	const float invB = bodies.InvMass(iB); // 逆質量取得
+	if (invA + invB == 0.0f) return 0.0f; // 両方固定
+	// 法線
+	const Vector3 n = c.m.normal; // A→B
+
+	// 摩擦係数（PreSolveContacts で混ぜてある）
+	const float fricD = c.frictionDynamic;
+	const float fricS = c.frictionStatic;
+
+	float maxDelta = 0.0f; // 入れたインパルスの変化の最大
+
+	// ----- 角項の小ヘルパ -----
+	// d : 評価方向（法線または接線）
+	// 接触点に方向ｄのインパルスを 1[N・s]入れたときの「角運動による逆加速度寄与」をスカラーで返す
+	// 接触点速度(v = ω×r)にインパルス(P = d * j)を入れたときの角速度変化(Δω = I^-1(r×P))を接触点速度へ戻した寄与((I^-1(r×d))×r)をｄで射影したもの（？）
+	auto AngTerm = [&bodies](int body, const Vector3& r, const Vector3& d) -> float
+		{
+			// n・[(I^-1 (r×d))×r] = dot(d, (r×d))×r)を展開してもいいが可読性重視でこちら
+			return  Vector3::Dot(d, Vector3::Cross(bodies.ApplyInvInertia(body, Vector3::Cross(r, d)), r));
+		};
 
-		const Vector3 n = c.m.normal; // AB
+	// ======== PHASE 1: 全接点の「法線」だけ解く =========
+	// 複数点はまとめて解く、解けなかったら１点ずつ
+	const bool solvedBlock = m_EnableBlockSolver && c.m.count >= 2 && ResolveNormalBlock(c, dt, maxDelta);
 
-		float maxPen = 0.0f;
-		for (int i = 0; i < c.m.count; i++)
-			maxPen = std::max(maxPen, c.m.points[i].penetration); // ő̊ѓ[x̗p
+	// 各接触点について法線インパルス
+	for (int i = 0; !solvedBlock && i < c.m.count; i++)
+	{
+		// 接触点と COM 差分を取る
+		const Vector3 p = (c.m.points[i].pointOnA + c.m.points[i].pointOnB) * 0.5f; //接触点の中点を求める
+		const Vector3 xA = bodies.COM(iA); // 重心座標
+		const Vector3 xB = bodies.COM(iB); // 重心座標
+		const Vector3 rA = p - xA; // COM からのベクトル（相対位置）
+		const Vector3 rB = p - xB; // COM からのベクトル（相対位置）
 		
-		// slop Ŕ
-		const float C = std::max(0.0f, maxPen - Slop);
-		if (C <= 0.0f) continue;
+		// 速度（角成分込み）
+		const Vector3 vA = bodies.LinearVelocity(iA);
+		const Vector3 wA = bodies.AngularVelocity(iA);
+		const Vector3 vB = bodies.LinearVelocity(iB);
+		const Vector3 wB = bodies.AngularVelocity(iB);
+
+		// 接触点の相対速度 vRel = (vB + wB×rB) - (vA + wA×rA) [relative velocity]
+		const Vector3 vRel = (vB + Vector3::Cross(wB, rB)) - (vA + Vector3::Cross(wA, rA)); // 相対速度（Aから見たBの相対速度）
+		const float relVelN = Vector3::Dot(vRel, n); // 法線方向の相対速度 [normal relative velocity]
+		if (relVelN > 0.0f && c.m.points[i].penetration <= Slop && c.m.points[i].accumN <= 0.0f) continue; // 離れていく方向 && めり込みが無い && 押していない なので不要
+
+
+		// ----- 法線インパルス（角項込みの有効質量） -----
+		// 有効質量の分母（法線）
+		float denomN = invA + invB; // 角項込みの法線方向の有効質量の逆 [normal effective mass]
+		if (invA > 0.0f) denomN += AngTerm(iA, rA, n); // 接触点速度の“ｄ方向成分”がどれだけ変わるかを表す係数↓
+		if (invB > 0.0f) denomN += AngTerm(iB, rB, n); // 分母 k = (invA + invB + AngTermA + AngTermB)
+		if (denomN < 1e-12f) continue;
+
+		// 位置バイアス（浅いめり込みだけ、深い分は ResolvePseudoContact の擬似速度で直す）
+		const float bias_pos = ContactPositionBias(c.m.points[i].penetration, dt);
+		// 反発バイアス
+		const float bias_rest = c.m.points[i].restitutionBias; // ここで反発処理が含まれる
+
+		// 増分インパルス（インパルス量）
+		float deltaImpulseN = -(relVelN - bias_pos + bias_rest) / denomN;
+		// delta = relVelN / denomN; // 今の相対速度を０にするインパルス
+		// delta -= bias_pos / denomN; // めり込みを戻す方向（離れる向き）に押すインパルス
+		// delota += bias_rest / denomN; // 反発後の速度にするインパルス
+
+
+		// 累積インパルス
+		float old = c.m.points[i].accumN;
+		c.m.points[i].accumN = std::max(0.0f, old + deltaImpulseN);
+		deltaImpulseN = c.m.points[i].accumN - old; // 実際に適用する増分
+		maxDelta = std::max(maxDelta, fabsf(deltaImpulseN));
+
+		const Vector3 impulseVector = n * deltaImpulseN; // ベクトル化したインパルス [normal impulse vector]
+
+		// v と ω に即時適用 -----
+		if (invA > 0.0f)
+		{
+			bodies.SetLinearVelocity(iA, vA - impulseVector * invA);
+			bodies.SetAngularVelocity(iA, wA - bodies.ApplyInvInertia(iA, Vector3::Cross(rA, impulseVector)));
+		}
+		if (invB > 0.0f)
+		{
+			bodies.SetLinearVelocity(iB, vB + impulseVector * invB);
+			bodies.SetAngularVelocity(iB, wB + bodies.ApplyInvInertia(iB, Vector3::Cross(rB, impulseVector)));
+		}
+	}
+	
+	// ======== PHASE 2: 全接点の「摩擦」だけ解く =========
+	// 複数点は圧力中心でまとめて解く（点ごとに順に解くと高い積み上げが揺れる）
+	if (c.m.count >= 2)
+	{
+		ResolveFrictionPatch(c, maxDelta);
+		return maxDelta;
+	}
 
-		// ƒ
-		const float s = Baumgarte * C / (invA + invB); // tʔ
-		const Vector3 corrA = -n * (s * invA);
-		const Vector3 corrB =  n * (s * invB);
-		
-		// ----- ʒuf -----
-		auto anyNonZero = [](const Vector3& v) { return v.lengthSq() > 1e-12f; };
+	// １点だけの接触は点ごとに摩擦
+	for (int i = 0; i < c.m.count; i++)
+	{
+		// 接触点と COM 差分を取る
+		const Vector3 p = (c.m.points[i].pointOnA + c.m.points[i].pointOnB) * 0.5f; //接触点の中点を求める
+		const Vector3 xA = bodies.COM(iA); // 重心座標
+		const Vector3 xB = bodies.COM(iB); // 重心座標
+		const Vector3 rA = p - xA; // COM からのベクトル（相対位置）
+		const Vector3 rB = p - xB; // COM からのベクトル（相対位置）
+
+		// ----- 動摩擦力（法線更新後の相対速度で評価） -----
+		const Vector3 vA2 = bodies.LinearVelocity(iA);
+		const Vector3 wA2 = bodies.AngularVelocity(iA);
+		const Vector3 vB2 = bodies.LinearVelocity(iB);
+		const Vector3 wB2 = bodies.AngularVelocity(iB);
+		const Vector3 vRel2 = (vB2 + Vector3::Cross(wB2, rB)) - (vA2 + Vector3::Cross(wA2, rA)); // 相対速度
+
+		// ----- 希望する接線のインパルス -----
+		Vector3 t1;
+		if (fabsf(n.x) > 0.57735f) t1 = Vector3{ -n.y, n.x, 0.0f };
+		else					   t1 = Vector3{ 0.0f, -n.z, n.y };
+		t1 = t1.normalized();
+		Vector3 t2 = Vector3::Cross(n, t1); // 接線方向（２軸目）
+
+		// 有効質量の分母
+		float denomT1 = invA + invB; // 接線方向の有効質量の分母 [tangential impulse mass]
+		if (invA > 0.0f) denomT1 += AngTerm(iA, rA, t1);
+		if (invB > 0.0f) denomT1 += AngTerm(iB, rB, t1);
+		if (denomT1 < 1e-12f) continue;
+		float denomT2 = invA + invB; // 接線方向の有効質量の分母 [tangential impulse mass]
+		if (invA > 0.0f) denomT2 += AngTerm(iA, rA, t2);
+		if (invB > 0.0f) denomT2 += AngTerm(iB, rB, t2);
+		if (denomT2 < 1e-12f) continue;
+
+		// 望ましい増分（静止摩擦ターゲット vt' = 0）
+		float v_t1 = Vector3::Dot(vRel2, t1);
+		float v_t2 = Vector3::Dot(vRel2, t2);
+		float deltaImpulseT_desired_1 = -(v_t1) / denomT1; // [tangential impulse scalar]
+		float deltaImpulseT_desired_2 = -(v_t2) / denomT2; // [tangential impulse scalar]
+
+		// ----- Coulomb 円錐（半径 = μ * jn）でクランプ -----
+		float jtMaxS = fricS * c.m.points[i].accumN; // 静止摩擦半径　μ * jn （累積）
+		float jtMaxD = fricD * c.m.points[i].accumN; // 動摩擦半径　μ * jn （累積）
+		if (jtMaxD <= 0.0f) continue; // 法線反力がない≒摩擦が無い
+
+		Vector3 oldImpWorld = c.m.points[i].accumImpulseT; // ワールド累積
+		float oldImp1 = Vector3::Dot(oldImpWorld, t1); // t1 成分取り出し
+		float oldImp2 = Vector3::Dot(oldImpWorld, t2); // t2 成分取り出し
+
+		Vector3 starImp = Vector3{ oldImp1 + deltaImpulseT_desired_1, oldImp2 + deltaImpulseT_desired_2, 0.0f };
+		float deltaImpulseT = starImp.length(); // 実際に適用するインパルス
+
+		Vector3 newImp;
+		if (deltaImpulseT <= jtMaxS) // static : 完全停止
+		{
+			newImp = starImp;
+		}
+		else // slip : 動摩擦円錐に張り付け
+		{ 
+			if (deltaImpulseT > 1e-12f) newImp = starImp * (jtMaxD / deltaImpulseT);
+			else						newImp = Vector3();
+		}
+
+		Vector3 delta = newImp - Vector3{ oldImp1, oldImp2, 0.0f };
+		maxDelta = std::max(maxDelta, delta.length());
 
-		// ----- A: COM  Transform 𕜌 -----
-		if (rbA && invA > 0.0f && anyNonZero(corrA))
+		c.m.points[i].accumImpulseT = t1 * newImp.x + t2 * newImp.y; // 累積は世界ベクトルで保存する
+
+		const Vector3 impulseTVector = t1 * delta.x + t2 * delta.y; // 接線方向に掛けるインパルスベクトル [tangential impulse vector]
+		if (invA > 0.0f)
 		{
-			rbA->SetWorldCOM(rbA->WorldCOM() + corrA); // COM ֔f
-			auto* tfA = c.A->Owner()->Transform();
-			if (tfA)
-			{
-				Quaternion qA = tfA->Rotation();
-				const Vector3 rA = qA.Rotate(rbA->CenterOfMassLocal());
-				tfA->SetPosition(rbA->WorldCOM() - rA);
-			}
+			bodies.SetLinearVelocity(iA, bodies.LinearVelocity(iA) - impulseTVector * invA);
+			bodies.SetAngularVelocity(iA, bodies.AngularVelocity(iA) - bodies.ApplyInvInertia(iA, Vector3::Cross(rA, impulseTVector)));
 		}
-		// ----- B: COM  Transform 𕜌 -----
-		if (rbB && invB > 0.0f && anyNonZero(corrB))
+		if (invB > 0.0f)
 		{
-			rbB->SetWorldCOM(rbB->WorldCOM() + corrB); // COM ֔f
-			auto* tfB = c.B->Owner()->Transform();
-			if (tfB)
-			{
-				Quaternion qB = tfB->Rotation();
-				const Vector3 rB = qB.Rotate(rbB->CenterOfMassLocal());
-				tfB->SetPosition(rbB->WorldCOM() - rB);
-			}
+			bodies.SetLinearVelocity(iB, bodies.LinearVelocity(iB) + impulseTVector * invB);
+			bodies.SetAngularVelocity(iB, bodies.AngularVelocity(iB) + bodies.ApplyInvInertia(iB, Vector3::Cross(rB, impulseTVector)));
 		}
 	}
+	return maxDelta;
 }
 
 // --------------------------------------------------
-// xf
-// m_Rigidbodies
+// 面の摩擦（２点以上の接触）
+// 法線インパルスで重みを付けた接触点の平均（圧力中心）で、接線２方向を 2x2 の有効質量でまとめて解き、
+// 法線まわりのねじれ（twist）は別に１つの角インパルスで止める
+// 累積は点ごとの accumImpulseT に配り直して持つ（ウォームスタート、キャッシュはそのまま使える）
+//   点 i の分 = 接線インパルス * w_i + (n×d_i) * (ねじれ / Σ w|d|^2) * w_i （w_i = 法線の割合、d_i = 圧力中心から点へ）
 // --------------------------------------------------
-void PhysicsSystem::IntegrationVelocity(float dt)
+void PhysicsSystem::ResolveFrictionPatch(Contact& c, float& maxDelta)
 {
-	for (Rigidbody* rb : m_Rigidbodies)
+	constexpr int MaxPoints = ContactManifold::MAX_POINTS;
+	SolverBodySet& bodies = m_SolverBodies;
+	const int iA = c.bodyA;
+	const int iB = c.bodyB;
+	const float invA = bodies.InvMass(iA);
+	const float invB = bodies.InvMass(iB);
+	const Vector3 n = c.m.normal; // A→B
+	const int count = c.m.count;
+
+	// ----- 圧力中心 -----
+	float sumN = 0.0f;
+	Vector3 center{};
+	for (int i = 0; i < count; i++)
 	{
-		if (!rb || !rb->IsDynamic()) continue;
+		const Vector3 p = (c.m.points[i].pointOnA + c.m.points[i].pointOnB) * 0.5f;
+		sumN += c.m.points[i].accumN;
+		center += p * c.m.points[i].accumN;
+	}
+	if (sumN <= 0.0f) return; // 押していないので摩擦も無い（点ごとのときと同じく累積はそのまま）
+	center = center * (1.0f / sumN);
+
+	// ----- 今の累積を圧力中心の接線インパルスとねじれに直す -----
+	Vector3 d[MaxPoints]; // 圧力中心から点へ（接平面に落とす）
+	float	w[MaxPoints]; // 法線インパルスの割合
+	Vector3 oldT{};		  // 接線インパルスの合計
+	float	oldTwist = 0.0f;
+	float	radiusSq = 0.0f; // Σ w|d|^2
+	float	radius	 = 0.0f; // Σ w|d|（ねじれの摩擦の腕）
+	for (int i = 0; i < count; i++)
+	{
+		const Vector3 p = (c.m.points[i].pointOnA + c.m.points[i].pointOnB) * 0.5f;
+		d[i] = p - center;
+		d[i] = d[i] - n * Vector3::Dot(d[i], n);
+		w[i] = sumN > 0.0f ? c.m.points[i].accumN / sumN : 0.0f;
+		oldT += c.m.points[i].accumImpulseT;
+		oldTwist += Vector3::Dot(n, Vector3::Cross(d[i], c.m.points[i].accumImpulseT));
+		radiusSq += w[i] * d[i].lengthSq();
+		radius += w[i] * d[i].length();
+	}
 
-		auto* tfc = rb->Owner()->Transform();
+	const Vector3 rA = center - bodies.COM(iA);
+	const Vector3 rB = center - bodies.COM(iB);
 
-		// COM ϕ -----
-		rb->SetWorldCOM(rb->WorldCOM() + rb->Velocity() * dt);
+	// 接線２方向（ResolveContact と同じ取り方）
+	Vector3 t1;
+	if (fabsf(n.x) > 0.57735f) t1 = Vector3{ -n.y, n.x, 0.0f };
+	else					   t1 = Vector3{ 0.0f, -n.z, n.y };
+	t1 = t1.normalized();
+	const Vector3 t2 = Vector3::Cross(n, t1);
 
-		// pFւŐϕ(rad/s) -----
-		Quaternion q = tfc->Rotation().normalized(); // ݎp
-		Vector3 w = rb->AngularVelocity(); // px擾
-		float wlen = w.length();
-		if (wlen > 1e-8f)
+	// ----- 接線（2x2 の有効質量） -----
+	// K(a, b) = 方向 b に 1 入れたときの、圧力中心の相対速度の a 成分の変化
+	auto K = [&](const Vector3& a, const Vector3& b) -> float
 		{
-			float theta = wlen * dt; // px[rad/s] * [s] = px[rad]
-			Vector3 axis = w * (1.0f / wlen); // ]̒PʃxNg
-			float s = sinf(0.5f * theta), c = cosf(0.5f * theta); 
-			Quaternion dq(axis.x * s, axis.y * s, axis.z * s, c); // NH[^jI
-			q = (dq * q).normalized(); // ]iEj
-			tfc->SetRotation(q);
-		}
+			float k = (invA + invB) * Vector3::Dot(a, b);
+			if (invA > 0.0f) k += Vector3::Dot(a, Vector3::Cross(bodies.ApplyInvInertia(iA, Vector3::Cross(rA, b)), rA));
+			if (invB > 0.0f) k += Vector3::Dot(a, Vector3::Cross(bodies.ApplyInvInertia(iB, Vector3::Cross(rB, b)), rB));
+			return k;
+		};
+	const float k11 = K(t1, t1);
+	const float k12 = K(t1, t2);
+	const float k22 = K(t2, t2);
+	const float det = k11 * k22 - k12 * k12;
+	if (k11 < 1e-12f || k22 < 1e-12f) return;
+
+	const Vector3 vRel = (bodies.LinearVelocity(iB) + Vector3::Cross(bodies.AngularVelocity(iB), rB))
+		- (bodies.LinearVelocity(iA) + Vector3::Cross(bodies.AngularVelocity(iA), rA));
+	const float v1 = Vector3::Dot(vRel, t1);
+	const float v2 = Vector3::Dot(vRel, t2);
+	const float old1 = Vector3::Dot(oldT, t1);
+	const float old2 = Vector3::Dot(oldT, t2);
+
+	// 静止摩擦ターゲット（圧力中心の接線速度 0）
+	float new1, new2;
+	if (det > 1e-12f)
+	{
+		new1 = old1 - ( k22 * v1 - k12 * v2) / det;
+		new2 = old2 - (-k12 * v1 + k11 * v2) / det;
+	}
+	else // 解けなければ２方向を別々に
+	{
+		new1 = old1 - v1 / k11;
+		new2 = old2 - v2 / k22;
+	}
 
-		// ----- Trnasform _ COM 畜 -----
-		// origin = COM - R * COMLocal
-		const Vector3 COMLocal = rb->CenterOfMassLocal();
-		const Vector3 r = q.Rotate(COMLocal);
-		tfc->SetPosition(rb->WorldCOM() - r);
+	// Coulomb 円錐（半径 = μ * 法線インパルスの合計）
+	const float len = sqrtf(new1 * new1 + new2 * new2);
+	if (len > c.frictionStatic * sumN)
+	{
+		const float scale = len > 1e-12f ? c.frictionDynamic * sumN / len : 0.0f;
+		new1 *= scale;
+		new2 *= scale;
+	}
+
+	const Vector3 impulseT = t1 * (new1 - old1) + t2 * (new2 - old2);
+	maxDelta = std::max(maxDelta, impulseT.length());
+	if (invA > 0.0f)
+	{
+		bodies.SetLinearVelocity(iA, bodies.LinearVelocity(iA) - impulseT * invA);
+		bodies.SetAngularVelocity(iA, bodies.AngularVelocity(iA) - bodies.ApplyInvInertia(iA, Vector3::Cross(rA, impulseT)));
 	}
+	if (invB > 0.0f)
+	{
+		bodies.SetLinearVelocity(iB, bodies.LinearVelocity(iB) + impulseT * invB);
+		bodies.SetAngularVelocity(iB, bodies.AngularVelocity(iB) + bodies.ApplyInvInertia(iB, Vector3::Cross(rB, impulseT)));
+	}
+
+	// ----- ねじれ（法線まわりの相対角速度を 0 に、上限は μ * 法線 * 腕） -----
+	float newTwist = oldTwist;
+	float kTwist = 0.0f;
+	if (invA > 0.0f) kTwist += Vector3::Dot(n, bodies.ApplyInvInertia(iA, n));
+	if (invB > 0.0f) kTwist += Vector3::Dot(n, bodies.ApplyInvInertia(iB, n));
+	if (kTwist > 1e-12f)
+	{
+		const float wRel = Vector3::Dot(bodies.AngularVelocity(iB) - bodies.AngularVelocity(iA), n);
+		const float limit = c.frictionDynamic * sumN * radius;
+		newTwist = std::clamp(oldTwist - wRel / kTwist, -limit, limit);
+
+		const Vector3 impulseTwist = n * (newTwist - oldTwist);
+		maxDelta = std::max(maxDelta, fabsf(newTwist - oldTwist));
+		if (invA > 0.0f) bodies.SetAngularVelocity(iA, bodies.AngularVelocity(iA) - bodies.ApplyInvInertia(iA, impulseTwist));
+		if (invB > 0.0f) bodies.SetAngularVelocity(iB, bodies.AngularVelocity(iB) + bodies.ApplyInvInertia(iB, impulseTwist));
+	}
+
+	// ----- 点ごとの累積に配り直す -----
+	const Vector3 newT = t1 * new1 + t2 * new2;
+	const float twistPerArm = radiusSq > 1e-12f ? newTwist / radiusSq : 0.0f;
+	for (int i = 0; i < count; i++)
+		c.m.points[i].accumImpulseT = newT * w[i] + Vector3::Cross(n, d[i]) * (twistPerArm * w[i]);
 }
 
 // --------------------------------------------------
-// WCg̎OvZ
-// m_Joints
+// 法線のブロックソルバー
+// 累積インパルス x、法線方向の相対速度 w = A x + b として
+// x >= 0, w >= 0, x * w = 0 を満たす x を、効いている点の組み合わせを全部試して探す（最大４点で 16 通り）
 // --------------------------------------------------
-void PhysicsSystem::PreSolveDistanceJoints(float dt)
+namespace
 {
-	const float beta = 0.2f;
+	// 効いている点の組み合わせ（多い順、最初に条件を満たしたものを採用）
+	// 全部効いているのが普通なので、たいてい最初の１つで決まる
+	const uint8_t BlockMasks2[] = { 0x3, 0x1, 0x2, 0x0 };
+	const uint8_t BlockMasks3[] = { 0x7, 0x3, 0x5, 0x6, 0x1, 0x2, 0x4, 0x0 };
+	const uint8_t BlockMasks4[] = { 0xf, 0x7, 0xb, 0xd, 0xe, 0x3, 0x5, 0x6, 0x9, 0xa, 0xc, 0x1, 0x2, 0x4, 0x8, 0x0 };
 
-	// Joints ̍XV
-	for (auto& joint : m_DistanceJoints)
+	const float BlockRegularization = 1e-4f; // 対角に足す割合（面接触の４点は階数３で特異になるため、配分を均す）
+	const float BlockTolerance		= 1e-4f; // w の許容誤差 [m/s]
+
+	// 小さな連立一次方程式 M x = r を部分ピボットのガウス消去で解く（M, r は壊す）
+	bool SolveSmallSystem(int n, float M[ContactManifold::MAX_POINTS][ContactManifold::MAX_POINTS], float r[ContactManifold::MAX_POINTS], float out[ContactManifold::MAX_POINTS])
 	{
-		// Rigidbody 擾
-		auto* rbA = joint.pBodyA;
-		auto* rbB = joint.pBodyB;
-		TransformComponent* tfA = joint.tfA;
-		TransformComponent* tfB = joint.tfB;
-		if (!tfA || !tfB) continue;
-		if (!rbA && !rbB) continue;
+		for (int col = 0; col < n; col++)
+		{
+			int pivot = col;
+			for (int row = col + 1; row < n; row++)
+				if (fabsf(M[row][col]) > fabsf(M[pivot][col])) pivot = row;
+			if (fabsf(M[pivot][col]) < 1e-12f) return false;
+			if (pivot != col)
+			{
+				for (int k = 0; k < n; k++) std::swap(M[col][k], M[pivot][k]);
+				std::swap(r[col], r[pivot]);
+			}
+			for (int row = col + 1; row < n; row++)
+			{
+				const float f = M[row][col] / M[col][col];
+				for (int k = col; k < n; k++) M[row][k] -= f * M[col][k];
+				r[row] -= f * r[col];
+			}
+		}
+		for (int row = n - 1; row >= 0; row--)
+		{
+			float sum = r[row];
+			for (int k = row + 1; k < n; k++) sum -= M[row][k] * out[k];
+			out[row] = sum / M[row][row];
+		}
+		return true;
+	}
+}
+bool PhysicsSystem::ResolveNormalBlock(Contact& c, float dt, float& maxDelta)
+{
+	constexpr int MaxPoints = ContactManifold::MAX_POINTS;
+	SolverBodySet& bodies = m_SolverBodies;
+	const int iA = c.bodyA;
+	const int iB = c.bodyB;
+	const float invA = bodies.InvMass(iA);
+	const float invB = bodies.InvMass(iB);
+	const Vector3 n = c.m.normal; // A→B
+	const int count = c.m.count;
+
+	// ----- 点ごとの腕と角の寄与 -----
+	Vector3 rA[MaxPoints], rB[MaxPoints];	  // COM からのベクトル
+	Vector3 rnA[MaxPoints], rnB[MaxPoints];	  // r×n
+	Vector3 angA[MaxPoints], angB[MaxPoints]; // I^-1 (r×n)
+	for (int i = 0; i < count; i++)
+	{
+		const Vector3 p = (c.m.points[i].pointOnA + c.m.points[i].pointOnB) * 0.5f; //接触点の中点を求める
+		rA[i] = p - bodies.COM(iA);
+		rB[i] = p - bodies.COM(iB);
+		rnA[i] = Vector3::Cross(rA[i], n);
+		rnB[i] = Vector3::Cross(rB[i], n);
+		angA[i] = invA > 0.0f ? bodies.ApplyInvInertia(iA, rnA[i]) : Vector3();
+		angB[i] = invB > 0.0f ? bodies.ApplyInvInertia(iB, rnB[i]) : Vector3();
+	}
 
-		// AJ[vZ
-		Vector3 xA = rbA->WorldCOM(); // tfA->Position()
+	// ----- A（点 j に法線インパルス１を入れたときの点 i の法線速度の変化）-----
+	float K[MaxPoints][MaxPoints];
+	float maxDiag = 0.0f;
+	for (int i = 0; i < count; i++)
+	{
+		for (int j = 0; j < count; j++)
+			K[i][j] = invA + invB + Vector3::Dot(rnA[i], angA[j]) + Vector3::Dot(rnB[i], angB[j]);
+		maxDiag = std::max(maxDiag, K[i][i]);
+	}
+	if (maxDiag < 1e-12f) return false;
+	const float regularization = BlockRegularization * maxDiag;
+
+	// ----- b（今の累積インパルスを抜いた法線速度 + 位置と反発の目標）-----
+	const Vector3 vA = bodies.LinearVelocity(iA);
+	const Vector3 wA = bodies.AngularVelocity(iA);
+	const Vector3 vB = bodies.LinearVelocity(iB);
+	const Vector3 wB = bodies.AngularVelocity(iB);
+	float oldImpulse[MaxPoints], b[MaxPoints];
+	for (int i = 0; i < count; i++)
+	{
+		oldImpulse[i] = c.m.points[i].accumN;
+		const Vector3 vRel = (vB + Vector3::Cross(wB, rB[i])) - (vA + Vector3::Cross(wA, rA[i]));
+		b[i] = Vector3::Dot(vRel, n) - ContactPositionBias(c.m.points[i].penetration, dt) + c.m.points[i].restitutionBias;
+	}
+	for (int i = 0; i < count; i++)
+		for (int j = 0; j < count; j++) b[i] -= K[i][j] * oldImpulse[j];
+
+	// ----- 効いている点の組み合わせを試す -----
+	const uint8_t* masks = count == 2 ? BlockMasks2 : (count == 3 ? BlockMasks3 : BlockMasks4);
+	const int maskCount = 1 << count;
+	float x[MaxPoints] = {};
+	bool found = false;
+	for (int m = 0; m < maskCount && !found; m++)
+	{
+		const uint8_t mask = masks[m];
+
+		// 効いている点だけ取り出して K_SS x_S = -b_S を解く
+		int index[MaxPoints];
+		int size = 0;
+		for (int i = 0; i < count; i++) if (mask & (1 << i)) index[size++] = i;
+
+		float xs[MaxPoints] = {};
+		if (size > 0)
+		{
+			float M[MaxPoints][MaxPoints], r[MaxPoints];
+			for (int i = 0; i < size; i++)
+			{
+				for (int j = 0; j < size; j++) M[i][j] = K[index[i]][index[j]];
+				M[i][i] += regularization;
+				r[i] = -b[index[i]];
+			}
+			if (!SolveSmallSystem(size, M, r, xs)) continue;
+		}
+
+		// x >= 0
+		float candidate[MaxPoints] = {};
+		bool valid = true;
+		for (int i = 0; i < size && valid; i++)
+		{
+			if (xs[i] < 0.0f) valid = false;
+			candidate[index[i]] = xs[i];
+		}
+		// 効いている点は w = 0（正則化で -εx だけずれる）、効いていない点は w >= 0
+		for (int i = 0; i < count && valid; i++)
+		{
+			float w = b[i];
+			for (int j = 0; j < count; j++) w += K[i][j] * candidate[j];
+			if ((mask & (1 << i)) ? fabsf(w + regularization * candidate[i]) > BlockTolerance : w < -BlockTolerance) valid = false;
+		}
+		if (!valid) continue;
+
+		for (int i = 0; i < count; i++) x[i] = candidate[i];
+		found = true;
+	}
+	if (!found) return false;
+
+	// ----- 増分をまとめて適用 -----
+	Vector3 linearImpulse{}, angularA{}, angularB{};
+	for (int i = 0; i < count; i++)
+	{
+		const float delta = x[i] - oldImpulse[i];
+		c.m.points[i].accumN = x[i];
+		maxDelta = std::max(maxDelta, fabsf(delta));
+
+		linearImpulse += n * delta;
+		angularA += angA[i] * delta;
+		angularB += angB[i] * delta;
+	}
+	if (invA > 0.0f)
+	{
+		bodies.SetLinearVelocity(iA, vA - linearImpulse * invA);
+		bodies.SetAngularVelocity(iA, wA - angularA);
+	}
+	if (invB > 0.0f)
+	{
+		bodies.SetLinearVelocity(iB, vB + linearImpulse * invB);
+		bodies.SetAngularVelocity(iB, wB + angularB);
+	}
+	return true;
+}
+
+// --------------------------------------------------
+// 減衰
+// m_Rigidbodies
+// --------------------------------------------------
+void PhysicsSystem::ApplyDamping(float dt)
+{
+	if (dt <= 0.0f) return;
+
+	for (Rigidbody* rb : m_Rigidbodies)
+	{
+		if (!IsAwakeDynamic(rb)) continue; // 眠っている剛体は飛ばす
+
+		const float a = std::exp(-rb->LinDamping() * dt);
+		const float b = std::exp(-rb->AngDamping() * dt);
+
+		// 線形減衰
+		rb->SetVelocity(rb->Velocity() * a);
+		rb->SetAngularVelocity(rb->AngularVelocity() * b);
+	}
+}
+
+// --------------------------------------------------
+// めり込み解消（スプリットインパルス）
+// m_Contacts
+// めり込みを１ステップで Baumgarte の割合だけ戻す擬似速度を、接触ごとに逐次インパルス法で解く
+// 浅い分（MaxBiasPenetration まで）は ResolveContact でも速度で戻す（速度だけだと高い積み上げが少しずつ傾いていく）
+// Transform には触らず、IntegrationVelocity で速度と一緒に位置へ足す
+// --------------------------------------------------
+void PhysicsSystem::ResolvePosition(float dt)
+{
+	BeginSolverIterations();
+	for (int i = 0; i < m_MaxPositionIterations; i++)
+	{
+		for (auto& c : m_Contacts)
+			if (IsSolverIslandActive(c.island)) RecordSolverDelta(0, c.island, ResolvePseudoContact(c, dt));
+		if (!EndSolverIteration(i, 1, true)) break; // 全アイランドが収束した
+	}
+}
+float PhysicsSystem::ResolvePseudoContact(Contact& c, float dt)
+{
+	SolverBodySet& bodies = m_SolverBodies;
+	const int iA = c.bodyA;
+	const int iB = c.bodyB;
+
+	const float invA = bodies.InvMass(iA);
+	const float invB = bodies.InvMass(iB);
+	if (invA + invB == 0.0f) return 0.0f; // 両方固定
+	const Vector3 n = c.m.normal; // A→B
+
+	float maxDelta = 0.0f; // 入れたインパルスの変化の最大
+	for (int i = 0; i < c.m.count; i++)
+	{
+		// slop を超えた分だけ直す
+		const float C = c.m.points[i].penetration - Slop;
+		if (C <= 0.0f) continue;
+
+		// 接触点と COM 差分を取る
+		const Vector3 p = (c.m.points[i].pointOnA + c.m.points[i].pointOnB) * 0.5f; //接触点の中点を求める
+		const Vector3 rA = p - bodies.COM(iA);
+		const Vector3 rB = p - bodies.COM(iB);
+
+		// 擬似速度の相対速度（法線方向）
+		const Vector3 vA = bodies.PseudoLinearVelocity(iA);
+		const Vector3 wA = bodies.PseudoAngularVelocity(iA);
+		const Vector3 vB = bodies.PseudoLinearVelocity(iB);
+		const Vector3 wB = bodies.PseudoAngularVelocity(iB);
+		const Vector3 vRel = (vB + Vector3::Cross(wB, rB)) - (vA + Vector3::Cross(wA, rA));
+		const float relVelN = Vector3::Dot(vRel, n);
+
+		// 有効質量の分母（ResolveContact と同じ）
+		float denomN = invA + invB;
+		if (invA > 0.0f) denomN += Vector3::Dot(n, Vector3::Cross(bodies.ApplyInvInertia(iA, Vector3::Cross(rA, n)), rA));
+		if (invB > 0.0f) denomN += Vector3::Dot(n, Vector3::Cross(bodies.ApplyInvInertia(iB, Vector3::Cross(rB, n)), rB));
+		if (denomN < 1e-12f) continue;
+
+		// 離れる向きの目標の擬似速度に合わせる（押すだけ、引っ張らない）
+		float deltaImpulse = -(relVelN - Baumgarte * C / dt) / denomN;
+		const float old = c.accumPseudo[i];
+		c.accumPseudo[i] = std::max(0.0f, old + deltaImpulse);
+		deltaImpulse = c.accumPseudo[i] - old;
+		maxDelta = std::max(maxDelta, fabsf(deltaImpulse));
+
+		const Vector3 impulseVector = n * deltaImpulse;
+		if (invA > 0.0f)
+		{
+			bodies.SetPseudoLinearVelocity(iA, vA - impulseVector * invA);
+			bodies.SetPseudoAngularVelocity(iA, wA - bodies.ApplyInvInertia(iA, Vector3::Cross(rA, impulseVector)));
+		}
+		if (invB > 0.0f)
+		{
+			bodies.SetPseudoLinearVelocity(iB, vB + impulseVector * invB);
+			bodies.SetPseudoAngularVelocity(iB, wB + bodies.ApplyInvInertia(iB, Vector3::Cross(rB, impulseVector)));
+		}
+	}
+	return maxDelta;
+}
+
+// --------------------------------------------------
+// 速度反映
+// m_Rigidbodies
+// --------------------------------------------------
+void PhysicsSystem::IntegrationVelocity(float dt)
+{
+	for (Rigidbody* rb : m_Rigidbodies)
+	{
+		if (!IsAwakeDynamic(rb)) continue; // 眠っている剛体は飛ばす
+
+		auto* tfc = rb->Owner()->Transform();
+
+		// めり込み解消の擬似速度（位置にだけ足す）
+		Vector3 pv, pw;
+		const int si = rb->m_SolverIndex;
+		if (si > 0 && si < m_SolverBodies.Count())
+		{
+			pv = m_SolverBodies.PseudoLinearVelocity(si);
+			pw = m_SolverBodies.PseudoAngularVelocity(si);
+		}
+
+		// COM を積分 -----
+		rb->SetWorldCOM(rb->WorldCOM() + (rb->Velocity() + pv) * dt);
+
+		// 姿勢：ωで積分(rad/s) -----
+		Quaternion q = StepRotation(rb, tfc).normalized(); // 現在姿勢
+		Vector3 w = rb->AngularVelocity() + pw; // 角速度取得
+		float wlen = w.length();
+		if (wlen > 1e-8f)
+		{
+			float theta = wlen * dt; // 角速度[rad/s] * 時間[s] = 角度[rad]
+			Vector3 axis = w * (1.0f / wlen); // 回転軸の単位ベクトル
+			float s = sinf(0.5f * theta), c = cosf(0.5f * theta); 
+			Quaternion dq(axis.x * s, axis.y * s, axis.z * s, c); // クォータニオン生成
+			q = (dq * q).normalized(); // 回転（右手）
+			SetStepRotation(rb, tfc, q);
+		}
+
+		// ----- Trnasform 原点を COM から復元 -----
+		// origin = COM - R * COMLocal
+		const Vector3 COMLocal = rb->CenterOfMassLocal();
+		const Vector3 r = q.Rotate(COMLocal);
+		SetStepPosition(rb, tfc, rb->WorldCOM() - r);
+	}
+}
+
+// --------------------------------------------------
+// 連続衝突判定（CCD）
+// 速度積分前の COM を覚える
+// --------------------------------------------------
+void PhysicsSystem::BeginContinuousCollision()
+{
+	m_ContinuousBodies.clear();
+	m_ContinuousColliders.clear();
+	for (Rigidbody* rb : m_Rigidbodies)
+	{
+		if (!IsAwakeDynamic(rb) || !rb->IsContinuousCollision()) continue;
+		m_ContinuousBodies.push_back({ rb, rb->WorldCOM() });
+	}
+	if (m_ContinuousBodies.empty()) return;
+
+	for (Collider* c : m_Colliders)
+	{
+		Rigidbody* rb = c->Body();
+		if (!rb || !rb->IsContinuousCollision() || !IsAwakeDynamic(rb)) continue;
+		if (!c->IsSimulate() || !c->Shape()) continue;
+		m_ContinuousColliders.push_back(c);
+	}
+}
+// --------------------------------------------------
+// 連続衝突判定（CCD）
+// 積分後の移動経路で、最初に静的なもの（Static、眠り）へ当たった位置まで戻して、法線方向の速度を消す
+// 動いている相手同士は通常の判定に任せる
+// 回転は終点の姿勢のまま、平行移動だけを掃引する
+// --------------------------------------------------
+void PhysicsSystem::SolveContinuousCollision()
+{
+	for (const ContinuousBody& cb : m_ContinuousBodies)
+	{
+		Rigidbody* rb = cb.rb;
+		const Vector3 delta = rb->WorldCOM() - cb.startCOM;
+		const float dist = delta.length();
+		if (dist <= 1e-6f) continue;
+
+		// ----- 自分のコライダーごとに一番早く当たる割合を探す -----
+		float toi = 1.0f;
+		Vector3 hitNormal{};
+		bool hit = false;
+		for (Collider* c : m_ContinuousColliders)
+		{
+			if (c->Body() != rb) continue;
+
+			const Collision& shape = *c->Shape();
+			const ColliderPose endPose = StepWorldPose(c); // 終点の姿勢
+			const float extent = ComputeMinExtent(shape, endPose.scale);
+			if (extent <= 0.0f || dist < extent) continue; // 自分の厚みより動かないなら通常の判定で足りる
+
+			ColliderPose startPose = endPose;
+			startPose.position = endPose.position - delta;
+			const AABB sweep = Combine(shape.ComputeWorldAABB(startPose), shape.ComputeWorldAABB(endPose));
+
+			m_BroadPhase.Query(sweep, [&](int proxyId)
+				{
+					Collider* other = m_BroadPhase.GetUser(proxyId);
+					if (other->Owner() == c->Owner()) return true;
+					if (!other->IsSimulate() || !other->Shape()) return true;
+					if (GetBodyState(other->Body()) == BodyState::Awake) return true;
+					if (!ShouldCollide(*c, *other)) return true;
+					if (!sweep.isOverlap(other->WorldAABB())) return true;
+
+					float t = 1.0f;
+					Vector3 n{};
+					if (SweepShape(shape, startPose, delta, extent, *other->Shape(), other->m_WorldPose, toi, t, n) && t < toi)
+					{
+						toi = t;
+						hitNormal = n;
+						hit = true;
+					}
+					return true;
+				});
+		}
+		if (!hit) continue;
+
+		// ----- 当たる直前まで戻す -----
+		rb->SetWorldCOM(cb.startCOM + delta * toi);
+		auto* tf = rb->Owner()->Transform();
+		const Vector3 r = StepRotation(rb, tf).Rotate(rb->CenterOfMassLocal());
+		SetStepPosition(rb, tf, rb->WorldCOM() - r);
+
+		// ----- 法線方向の速度を消す（反発係数の分だけ跳ね返す）-----
+		const Vector3 v = rb->Velocity();
+		const float vn = Vector3::Dot(v, hitNormal);
+		if (vn > 0.0f) rb->SetVelocity(v - hitNormal * (vn * (1.0f + rb->Restitution())));
+
+		if (m_UseStepPoses) continue; // WorldPose は SyncStep で Transform から合わせる
+		for (Collider* c : m_ContinuousColliders)
+			if (c->Body() == rb) c->UpdateWorldPose();
+	}
+}
+
+// --------------------------------------------------
+// ジョイントの事前計算
+// m_Joints
+// --------------------------------------------------
+void PhysicsSystem::PreSolveDistanceJoints(float dt)
+{
+	const float beta = 0.2f;
+
+	// Joints の更新
+	for (auto& joint : m_DistanceJoints)
+	{
+		// Rigidbody 取得
+		auto* rbA = joint.pBodyA;
+		auto* rbB = joint.pBodyB;
+		TransformComponent* tfA = joint.tfA;
+		TransformComponent* tfB = joint.tfB;
+		if (!tfA || !tfB) continue;
+		if (!rbA && !rbB) continue;
+		if (!IsAwakeDynamic(rbA) && !IsAwakeDynamic(rbB)) continue; // 動く側が眠っている
+
+		// アンカー計算
+		Vector3 xA = rbA->WorldCOM(); // tfA->Position()
 		Vector3 xB = rbB->WorldCOM(); // tfB->Position()
 
-		Quaternion qA = tfA->Rotation();
-		Quaternion qB = tfB->Rotation();
+		Quaternion qA = StepRotation(rbA, tfA);
+		Quaternion qB = StepRotation(rbB, tfB);
 
 		Vector3 rA = qA.Rotate(joint.localAnchorA);
 		Vector3 rB = qB.Rotate(joint.localAnchorB);
 
-		joint.rAworld = rA; // COM AJ[ւ̃xNg
+		joint.rAworld = rA; // COM からアンカーへのベクトル
 		joint.rBworld = rB;
 
 		Vector3 pA = xA + rA;
 		Vector3 pB = xB + rB;
 		float len = (pB - pA).length();
 
-		// @xNg
+		// 法線ベクトル
 		Vector3 n = Vector3();
-		n = pB - pA; // AJ[
+		n = pB - pA; // アンカー間
 		n.normalize();
 		joint.normal = n;
 
- 		// L
+ 		// 有効質量
 		float invA = (rbA && rbA->IsDynamic()) ? rbA->InvMass() : 0.0f;
 		float invB = (rbB && rbB->IsDynamic()) ? rbB->InvMass() : 0.0f;
 		float k = invA + invB;
 		
 		auto AngTerm = [](Rigidbody* rb, const Vector3& r, const Vector3& dir) -> float
 			{
-				// dirE[(I^-1 (r~dir))~r]
+				// dir・[(I^-1 (r×dir))×r]
 				return Vector3::Dot(dir, Vector3::Cross(rb->ApplyInvInertiaWorld(Vector3::Cross(r, dir)), r));
 			};
 		if (len > 1e-6f)
@@ -1231,12 +2887,12 @@ void PhysicsSystem::PreSolveDistanceJoints(float dt)
 
 		joint.effectiveMass = (k > 1e-8f) ? 1.0f / k : 0.0f;
 
-		// Baumgarte oCAXi C = ݂̒ - ڕW̒j
+		// Baumgarte バイアス（ C = 現在の長さ - 目標の長さ）
 		float C = len - joint.restLength;
 		joint.bias = beta * C / dt;
 		
-		// ݐϏ
-		joint.accumImpulse = 0.0f; // ̓EH[X^[g
+		// 累積初期化
+		joint.accumImpulse = 0.0f; // 今はウォームスタート無し
 	}
 }
 void PhysicsSystem::PreSolveBallJoints(float dt)
@@ -1245,20 +2901,21 @@ void PhysicsSystem::PreSolveBallJoints(float dt)
 
 	for (auto& joint : m_BallJoints)
 	{
-		// Rigidbody 擾
+		// Rigidbody 取得
 		auto* rbA = joint.pBodyA;
 		auto* rbB = joint.pBodyB;
 		TransformComponent* tfA = joint.tfA;
 		TransformComponent* tfB = joint.tfB;
 		if (!tfA || !tfB) continue;
 		if (!rbA && !rbB) continue;
+		if (!IsAwakeDynamic(rbA) && !IsAwakeDynamic(rbB)) continue; // 動く側が眠っている
 
-		// AJ[vZ
+		// アンカー計算
 		Vector3 xA = rbA->WorldCOM(); // tfA->Position()
 		Vector3 xB = rbB->WorldCOM(); // tfB->Position()
 
-		Quaternion qA = tfA->Rotation();
-		Quaternion qB = tfB->Rotation();
+		Quaternion qA = StepRotation(rbA, tfA);
+		Quaternion qB = StepRotation(rbB, tfB);
 		
 		Vector3 rA = qA.Rotate(joint.localAnchorA);
 		Vector3 rB = qB.Rotate(joint.localAnchorB);
@@ -1269,16 +2926,16 @@ void PhysicsSystem::PreSolveBallJoints(float dt)
 		Vector3 pA = xA + rA;
 		Vector3 pB = xB + rB;
 
-		// ڕẄʒu
+		// 目標の位置
 		Vector3 C = pB - pA;
 
-		// LʌvZiR{j
+		// 有効質量計算（３本方向）
 		float invA = (rbA && rbA->IsDynamic()) ? rbA->InvMass() : 0.0f;
 		float invB = (rbB && rbB->IsDynamic()) ? rbB->InvMass() : 0.0f;
 
 		auto AngTerm = [](Rigidbody* rb, const Vector3& r, const Vector3& dir) -> float
 			{
-				// dirE[(I^-1 (r~dir))~r]
+				// dir・[(I^-1 (r×dir))×r]
 				return Vector3::Dot(dir, Vector3::Cross(rb->ApplyInvInertiaWorld(Vector3::Cross(r, dir)), r));
 			};
 
@@ -1302,10 +2959,10 @@ void PhysicsSystem::PreSolveBallJoints(float dt)
 			joint.effectiveMass[i] = eff;
 		}
 
-		// Baumgarte oCAX
+		// Baumgarte バイアス
 		joint.bias = beta * C / dt;
 
-		// ݐϏ
+		// 累積初期化
 		joint.accumImpulse = Vector3(0.0f, 0.0f, 0.0f);
 	}
 }
@@ -1315,20 +2972,21 @@ void PhysicsSystem::PreSolveHingeJoints(float dt)
 
 	for (auto& joint : m_HingeJoints)
 	{
-		// Rigidbody 擾
+		// Rigidbody 取得
 		auto* rbA = joint.pBodyA;
 		auto* rbB = joint.pBodyB;
 		TransformComponent* tfA = joint.tfA;
 		TransformComponent* tfB = joint.tfB;
 		if (!tfA || !tfB) continue;
 		if (!rbA && !rbB) continue;
+		if (!IsAwakeDynamic(rbA) && !IsAwakeDynamic(rbB)) continue; // 動く側が眠っている
 
-		// AJ[vZ
+		// アンカー計算
 		Vector3 xA = rbA->WorldCOM(); // tfA->Position()
 		Vector3 xB = rbB->WorldCOM(); // tfB->Position()
 
-		Quaternion qA = tfA->Rotation();
-		Quaternion qB = tfB->Rotation();
+		Quaternion qA = StepRotation(rbA, tfA);
+		Quaternion qB = StepRotation(rbB, tfB);
 
 		Vector3 rA = qA.Rotate(joint.localAnchorA);
 		Vector3 rB = qB.Rotate(joint.localAnchorB);
@@ -1339,16 +2997,16 @@ void PhysicsSystem::PreSolveHingeJoints(float dt)
 		Vector3 pA = xA + rA;
 		Vector3 pB = xB + rB;
 
-		// ڕẄʒu
+		// 目標の位置
 		Vector3 C = pB - pA;
 
-		// LʌvZiR{j
+		// 有効質量計算（３本方向）
 		float invA = (rbA && rbA->IsDynamic()) ? rbA->InvMass() : 0.0f;
 		float invB = (rbB && rbB->IsDynamic()) ? rbB->InvMass() : 0.0f;
 
 		auto AngTerm = [](Rigidbody* rb, const Vector3& r, const Vector3& dir) -> float
 			{
-				// dirE[(I^-1 (r~dir))~r]
+				// dir・[(I^-1 (r×dir))×r]
 				return Vector3::Dot(dir, Vector3::Cross(rb->ApplyInvInertiaWorld(Vector3::Cross(r, dir)), r));
 			};
 
@@ -1359,7 +3017,7 @@ void PhysicsSystem::PreSolveHingeJoints(float dt)
 			{0.0f, 0.0f, 1.0f}
 		};
 
-		// ̗L
+		// 直交基底の有効質量
 		for (int i = 0; i < 3; i++)
 		{
 			const Vector3 dir = axes[i];
@@ -1373,17 +3031,17 @@ void PhysicsSystem::PreSolveHingeJoints(float dt)
 			joint.effectiveMassLinear[i] = eff;
 		}
 
-		// Baumgarte oCAX
+		// Baumgarte バイアス
 		joint.biasLinear = betaLinear * C / dt;
 
-		// ݐϏ
+		// 累積初期化
 		joint.accumImpulseLinear = Vector3(0.0f, 0.0f, 0.0f);
 
-		// ----- [h̃qW߂ -----
+		// ----- ワールドのヒンジ軸を求める -----
 		Vector3 axisWorld = qA.Rotate(joint.localAxisA).normalized();
 		joint.axisWorld = axisWorld;
 
-		// 
+		// 直交基底を作る
 		Vector3 t1, t2;
 		if (fabsf(axisWorld.x) > 0.577f)
 			t1 = Vector3( axisWorld.y, -axisWorld.x, 0);
@@ -1395,22 +3053,21 @@ void PhysicsSystem::PreSolveHingeJoints(float dt)
 		joint.swingAxis[0] = t1;
 		joint.swingAxis[1] = t2;
 
-		// ----- ␳p biasSwing vZ -----
-		// A, B ̃qW[h
-		Vector3 axisA = qA.Rotate(joint.localAxisA).normalized();
+		// ----- 軸補正用の biasSwing 計算 -----
+		// A, B 両方のヒンジ軸をワールドで
 		Vector3 axisB = qB.Rotate(joint.localAxisB).normalized();
 
-		// t1, t2 ɂǂꂾYĂ邩
+		// t1, t2 方向にどれだけズレているか
 		float C1 = Vector3::Dot(axisB, t1);
 		float C2 = Vector3::Dot(axisB, t2);
 
 		joint.swingDiff = Vector3(C1, C2, 0);
 
-		// Baumgarte Ŋpx덷xoCAX
+		// Baumgarte で角度誤差→速度バイアスへ
 		const float betaSwing = 0.005f;
 		joint.biasSwing = betaSwing * joint.swingDiff / dt;
 
-		// pxS̗LʂvZ
+		// 角度拘束の有効質量を計算
 		auto AngMix = [&](const Vector3& a, const Vector3& b)
 			{
 				float k = 0.0f;
@@ -1418,17 +3075,17 @@ void PhysicsSystem::PreSolveHingeJoints(float dt)
 				if (rbB && rbB->IsDynamic()) k += Vector3::Dot(a, rbB->ApplyInvInertiaWorld(b));
 				return k;
 			};
-		// K = J M^-1 J^T i2~2j
+		// K = J M^-1 J^T （2×2）
 		float k11 = AngMix(t1, t1);
 		float k12 = AngMix(t1, t2);
 		float k21 = AngMix(t2, t1);
 		float k22 = AngMix(t2, t2);
 
-		// l덷ŔΏ̂ɂȂ₷̂őΏ̉Ă
+		// 数値誤差で非対称になりやすいので対称化しておく
 		float off = 0.5f * (k12 + k21);
 		k12 = off; k21 = off;
 
-		// ts swingMat vZ
+		// 逆行列 swingMat を計算
 		float det = k11 * k22 - k12 * k21;
 		if (det > 1e-8f)
 		{
@@ -1438,7 +3095,7 @@ void PhysicsSystem::PreSolveHingeJoints(float dt)
 			joint.swingMass.m[1][0] = -invDet * k21;
 			joint.swingMass.m[1][1] =  invDet * k11;
 		}
-		else // قړقȂSキor
+		else // ほぼ特異なら拘束を弱くするor無視する
 		{
 			joint.swingMass.m[0][0] = 0.0f;
 			joint.swingMass.m[0][1] = 0.0f;
@@ -1447,11 +3104,11 @@ void PhysicsSystem::PreSolveHingeJoints(float dt)
 		}
 		joint.accImpulseSwing = { 0.0f, 0.0f, 0.0f };
 
-		// ----- xNg[hɕϊ -----
-		Vector3 refA = tfA->Rotation().Rotate(joint.localRefA);
-		Vector3 refB = tfB->Rotation().Rotate(joint.localRefB);
+		// ----- 基準ベクトルをワールドに変換 -----
+		Vector3 refA = qA.Rotate(joint.localRefA);
+		Vector3 refB = qB.Rotate(joint.localRefB);
 
-		// 𗎂ƂāAƒs
+		// 軸成分を落として、軸と直行させる
 		refA -= joint.axisWorld * Vector3::Dot(refA, joint.axisWorld);
 		refB -= joint.axisWorld * Vector3::Dot(refB, joint.axisWorld);
 		if (refA.length() < 1e-8f)
@@ -1474,15 +3131,15 @@ void PhysicsSystem::PreSolveHingeJoints(float dt)
 		joint.refAWorld = refA;
 		joint.refBWorld = refB;
 
-		// ݂̃qWpƂvZ
+		// 現在のヒンジ角θを計算
 		float cosTheta = Vector3::Clamp(Vector3::Dot(refA, refB), -1.0f, 1.0f);
 		float sinTheta = Vector3::Dot(joint.axisWorld, Vector3::Cross(refA, refB));
 		float angle = atan2f(sinTheta, cosTheta);
 		
-		// twist ̗LʂvZ
+		// twist の有効質量を計算
 		auto AngMass = [](Rigidbody* rb, const Vector3& axisDir)
 			{
-				// axisDirE(I^-1 axisDir)
+				// axisDir・(I^-1 axisDir)
 				Vector3 v = rb->ApplyInvInertiaWorld(axisDir);
 				return Vector3::Dot(axisDir, v);
 			};
@@ -1499,16 +3156,16 @@ void PhysicsSystem::PreSolveHingeJoints(float dt)
 		{
 			float Ctwist = 0.0f;
 			const float betaTwist = 0.001f;
-			if (angle < joint.limitMin) // 菬܂ŉ߂
-				Ctwist = angle - joint.limitMin; // ̒l
-			else if (angle > joint.limitMax) // 傫܂ŉ߂
-				Ctwist = angle - joint.limitMax; // ̒l
+			if (angle < joint.limitMin) // 下限より小さい→下限まで押し戻したい
+				Ctwist = angle - joint.limitMin; // 負の値
+			else if (angle > joint.limitMax) // 上限より大きい→上限まで押し戻したい
+				Ctwist = angle - joint.limitMax; // 正の値
 			else
-				Ctwist = 0.0f; // e͈͂ȂpxS͉Ȃ
+				Ctwist = 0.0f; // 許容範囲なら角度拘束は何もしない
 
 			if (Ctwist != 0.0f)
 			{
-				// vn * C = 0  C ɑ
+				// vn * βC = 0 の βC に相当
 				joint.biasTwist += -betaTwist * Ctwist / dt;
 			}
 		}
@@ -1517,7 +3174,7 @@ void PhysicsSystem::PreSolveHingeJoints(float dt)
 		joint.springDiff = 0.0f;
 		if (joint.enableSpring && joint.effMassTwist > 0.0f)
 		{
-			joint.springDiff = angle - joint.springTarget; // LbV
+			joint.springDiff = angle - joint.springTarget; // 差分をキャッシュ
 		}
 
 		// ----- Motor -----
@@ -1534,73 +3191,82 @@ void PhysicsSystem::PreSolveHingeJoints(float dt)
 }
 
 // --------------------------------------------------
-// WCg̉
+// ジョイントの解決
 // m_Joints
 // --------------------------------------------------
 void PhysicsSystem::ResolveDistanceJoints(float dt)
 {
 	for (auto& joint : m_DistanceJoints)
-	{
-		Rigidbody* rbA = joint.pBodyA;
-		Rigidbody* rbB = joint.pBodyB;
-		if (!rbA && !rbB) continue;
-		if (joint.effectiveMass <= 0.0f) continue;
+		if (IsSolverIslandActive(joint.island)) RecordSolverDelta(0, joint.island, ResolveDistanceJoint(joint, dt));
+}
+float PhysicsSystem::ResolveDistanceJoint(DistanceJoint& joint, float /*dt*/)
+{
+	SolverBodySet& bodies = m_SolverBodies;
+	const int iA = joint.bodyA;
+	const int iB = joint.bodyB;
+	if (bodies.InvMass(iA) + bodies.InvMass(iB) <= 0.0f) return 0.0f; // 動く側が無い（固定、眠り）
+	if (joint.effectiveMass <= 0.0f) return 0.0f;
 
-		const Vector3 n = joint.normal;
-		const Vector3 rA = joint.rAworld;
-		const Vector3 rB = joint.rBworld;
+	const Vector3 n = joint.normal;
+	const Vector3 rA = joint.rAworld;
+	const Vector3 rB = joint.rBworld;
 
-		// ݑxi͂Oj
-		Vector3 vA = rbA ? rbA->GetLinearVelocitySolver()   : Vector3();
-		Vector3 wA = rbA ? rbA->GetAngularVelocitySolver() : Vector3();
-		Vector3 vB = rbB ? rbB->GetLinearVelocitySolver()	 : Vector3();
-		Vector3 wB = rbB ? rbB->GetAngularVelocitySolver() : Vector3();
+	// 現在速度（無い方は０）
+	Vector3 vA = bodies.LinearVelocity(iA);
+	Vector3 wA = bodies.AngularVelocity(iA);
+	Vector3 vB = bodies.LinearVelocity(iB);
+	Vector3 wB = bodies.AngularVelocity(iB);
 
-		// Αx
-		Vector3 vRel = (vB + Vector3::Cross(wB, rB)) - (vA + Vector3::Cross(wA, rA));
-		float relVelN = Vector3::Dot(vRel, n);
+	// 相対速度
+	Vector3 vRel = (vB + Vector3::Cross(wB, rB)) - (vA + Vector3::Cross(wA, rA));
+	float relVelN = Vector3::Dot(vRel, n);
 
-		float deltaImpulse = -(relVelN + joint.bias) * joint.effectiveMass;
+	float deltaImpulse = -(relVelN + joint.bias) * joint.effectiveMass;
 
-		// KvȂ璣ԂɂNv
-		float oldImpulse = joint.accumImpulse;
-		float candidate = oldImpulse + deltaImpulse;
+	// 必要なら張り網にするクランプ
+	float oldImpulse = joint.accumImpulse;
+	float candidate = oldImpulse + deltaImpulse;
 
-		switch (joint.mode)
-		{
-		case 0: // Rod
-			// NvȂ
-			joint.accumImpulse = candidate;
-			break;
-		case 1: // Rope
-			// 肾
-			joint.accumImpulse = std::min(0.0f, candidate);
-			break;
-		case 2: // compression
-			// o
-			joint.accumImpulse = std::max(0.0f, candidate);
-			break;
-		}
-		deltaImpulse = joint.accumImpulse - oldImpulse;
+	switch (joint.mode)
+	{
+	case 0: // Rod
+		// クランプなし
+		joint.accumImpulse = candidate;
+		break;
+	case 1: // Rope
+		// 引っ張りだけ
+		joint.accumImpulse = std::min(0.0f, candidate);
+		break;
+	case 2: // compression
+		// 押し出しだけ
+		joint.accumImpulse = std::max(0.0f, candidate);
+		break;
+	}
+	deltaImpulse = joint.accumImpulse - oldImpulse;
 
-		// CpXxNg
-		Vector3 impulseVector = n * deltaImpulse;
+	// インパルスベクトル
+	Vector3 impulseVector = n * deltaImpulse;
 
-		float invA = (rbA && rbA->IsDynamic()) ? rbA->InvMass() : 0.0f;
-		float invB = (rbB && rbB->IsDynamic()) ? rbB->InvMass() : 0.0f;
-		if (invA > 0.0f)
-		{
-			rbA->SetVelocity(vA - impulseVector * invA);
-			rbA->SetAngularVelocity(wA - rbA->ApplyInvInertiaWorld(Vector3::Cross(rA, impulseVector)));
-		}
-		if (invB > 0.0f)
-		{
-			rbB->SetVelocity(vB + impulseVector * invB);
-			rbB->SetAngularVelocity(wB + rbB->ApplyInvInertiaWorld(Vector3::Cross(rB, impulseVector)));
-		}
+	float invA = bodies.InvMass(iA);
+	float invB = bodies.InvMass(iB);
+	if (invA > 0.0f)
+	{
+		bodies.SetLinearVelocity(iA, vA - impulseVector * invA);
+		bodies.SetAngularVelocity(iA, wA - bodies.ApplyInvInertia(iA, Vector3::Cross(rA, impulseVector)));
 	}
+	if (invB > 0.0f)
+	{
+		bodies.SetLinearVelocity(iB, vB + impulseVector * invB);
+		bodies.SetAngularVelocity(iB, wB + bodies.ApplyInvInertia(iB, Vector3::Cross(rB, impulseVector)));
+	}
+	return fabsf(deltaImpulse);
 }
 void PhysicsSystem::ResolveBallJoints(float dt)
+{
+	for (auto& joint : m_BallJoints)
+		if (IsSolverIslandActive(joint.island)) RecordSolverDelta(0, joint.island, ResolveBallJoint(joint, dt));
+}
+float PhysicsSystem::ResolveBallJoint(BallJoint& joint, float /*dt*/)
 {
 	const Vector3 axes[3] =
 	{
@@ -1609,72 +3275,78 @@ void PhysicsSystem::ResolveBallJoints(float dt)
 		{0.0f, 0.0f, 1.0f}
 	};
 
-	for (auto& joint : m_BallJoints)
-	{
-		Rigidbody* rbA = joint.pBodyA;
-		Rigidbody* rbB = joint.pBodyB;
-		if (!rbA && !rbB) continue;
-		if (joint.effectiveMass.lengthSq() <= 1e-8f) continue;
+	SolverBodySet& bodies = m_SolverBodies;
+	const int iA = joint.bodyA;
+	const int iB = joint.bodyB;
+	if (bodies.InvMass(iA) + bodies.InvMass(iB) <= 0.0f) return 0.0f; // 動く側が無い（固定、眠り）
+	if (joint.effectiveMass.lengthSq() <= 1e-8f) return 0.0f;
 
-		Vector3 rA = joint.rAworld;
-		Vector3 rB = joint.rBworld;
+	Vector3 rA = joint.rAworld;
+	Vector3 rB = joint.rBworld;
 
-		// ݑx
-		Vector3 vA = rbA ? rbA->GetLinearVelocitySolver()  : Vector3();
-		Vector3 wA = rbA ? rbA->GetAngularVelocitySolver() : Vector3();
-		Vector3 vB = rbB ? rbB->GetLinearVelocitySolver()  : Vector3();
-		Vector3 wB = rbB ? rbB->GetAngularVelocitySolver() : Vector3();
+	// 現在速度
+	Vector3 vA = bodies.LinearVelocity(iA);
+	Vector3 wA = bodies.AngularVelocity(iA);
+	Vector3 vB = bodies.LinearVelocity(iB);
+	Vector3 wB = bodies.AngularVelocity(iB);
 
-		// Αx
-		Vector3 vRel = (vB + Vector3::Cross(wB, rB)) - (vA + Vector3::Cross(wA, rA));
+	// 相対速度
+	Vector3 vRel = (vB + Vector3::Cross(wB, rB)) - (vA + Vector3::Cross(wA, rA));
 
-		// vCpXZo
-		Vector3 totalImpulse = {0.0f, 0.0f, 0.0f};
+	// 合計インパルスを算出
+	Vector3 totalImpulse = {0.0f, 0.0f, 0.0f};
+	float maxDelta = 0.0f;
 
-		// ʒuSiRj
-		for (int i = 0; i < 3; i++)
-		{
-			float eff = joint.effectiveMass[i];
-			if (eff <= 0.0f) continue; // SɂȂĂȂ
+	// 位置拘束（３軸分）
+	for (int i = 0; i < 3; i++)
+	{
+		float eff = joint.effectiveMass[i];
+		if (eff <= 0.0f) continue; // 拘束になっていない軸
 
-			const Vector3 dir = axes[i];
-			float vRelK = Vector3::Dot(vRel, dir); // ̑x
-			float biasK = joint.bias[i];
+		const Vector3 dir = axes[i];
+		float vRelK = Vector3::Dot(vRel, dir); // 軸方向の速度
+		float biasK = joint.bias[i];
 
-			float deltaImpulse = -(vRelK + biasK) * eff;
+		float deltaImpulse = -(vRelK + biasK) * eff;
 
-			// ݐσCpX
-			float oldImpulse = joint.accumImpulse[i];
-			float newImpulse = oldImpulse + deltaImpulse;
+		// 累積インパルス
+		float oldImpulse = joint.accumImpulse[i];
+		float newImpulse = oldImpulse + deltaImpulse;
 
-			// BallJoint ͊{Nvsv
-			joint.accumImpulse[i] = newImpulse;
+		// BallJoint は基本クランプ不要
+		joint.accumImpulse[i] = newImpulse;
 
-			deltaImpulse = newImpulse - oldImpulse;
+		deltaImpulse = newImpulse - oldImpulse;
+		maxDelta = std::max(maxDelta, fabsf(deltaImpulse));
 
-			// ̎̃CpXZ
-			totalImpulse += dir * deltaImpulse;
-		}
+		// その軸のインパルスを加算する
+		totalImpulse += dir * deltaImpulse;
+	}
 
-		// RSOȂ牽Ȃ
-		if (totalImpulse.lengthSq() <= 1e-8f) continue;
+	// ３軸全部０なら何もしない
+	if (totalImpulse.lengthSq() <= 1e-8f) return maxDelta;
 
-		float invA = (rbA && rbA->IsDynamic()) ? rbA->InvMass() : 0.0f;
-		float invB = (rbB && rbB->IsDynamic()) ? rbB->InvMass() : 0.0f;
+	float invA = bodies.InvMass(iA);
+	float invB = bodies.InvMass(iB);
 
-		if (invA > 0.0f)
-		{
-			rbA->SetVelocity(vA - totalImpulse * invA);
-			rbA->SetAngularVelocity(wA - rbA->ApplyInvInertiaWorld(Vector3::Cross(rA, totalImpulse)));
-		}
-		if (invB > 0.0f)
-		{
-			rbB->SetVelocity(vB + totalImpulse * invB);
-			rbB->SetAngularVelocity(wB + rbB->ApplyInvInertiaWorld(Vector3::Cross(rB, totalImpulse)));
-		}
+	if (invA > 0.0f)
+	{
+		bodies.SetLinearVelocity(iA, vA - totalImpulse * invA);
+		bodies.SetAngularVelocity(iA, wA - bodies.ApplyInvInertia(iA, Vector3::Cross(rA, totalImpulse)));
+	}
+	if (invB > 0.0f)
+	{
+		bodies.SetLinearVelocity(iB, vB + totalImpulse * invB);
+		bodies.SetAngularVelocity(iB, wB + bodies.ApplyInvInertia(iB, Vector3::Cross(rB, totalImpulse)));
 	}
+	return maxDelta;
 }
 void PhysicsSystem::ResolveHingeJoints(float dt)
+{
+	for (auto& joint : m_HingeJoints)
+		if (IsSolverIslandActive(joint.island)) RecordSolverDelta(0, joint.island, ResolveHingeJoint(joint, dt));
+}
+float PhysicsSystem::ResolveHingeJoint(HingeJoint& joint, float dt)
 {
 	const Vector3 axes[3] =
 	{
@@ -1683,262 +3355,260 @@ void PhysicsSystem::ResolveHingeJoints(float dt)
 		{0.0f, 0.0f, 1.0f}
 	};
 
-	for (auto& joint : m_HingeJoints)
-	{
-		Rigidbody* rbA = joint.pBodyA;
-		Rigidbody* rbB = joint.pBodyB;
-		if (!rbA && !rbB) continue;
+	SolverBodySet& bodies = m_SolverBodies;
+	const int iA = joint.bodyA;
+	const int iB = joint.bodyB;
+	if (bodies.InvMass(iA) + bodies.InvMass(iB) <= 0.0f) return 0.0f; // 動く側が無い（固定、眠り）
+
+	Vector3 rA = joint.rAworld;
+	Vector3 rB = joint.rBworld;
 
-		Vector3 rA = joint.rAworld;
-		Vector3 rB = joint.rBworld;
+	// 現在速度
+	Vector3 vA = bodies.LinearVelocity(iA);
+	Vector3 wA = bodies.AngularVelocity(iA);
+	Vector3 vB = bodies.LinearVelocity(iB);
+	Vector3 wB = bodies.AngularVelocity(iB);
 
-		// ݑx
-		Vector3 vA = rbA ? rbA->GetLinearVelocitySolver()   : Vector3();
-		Vector3 wA = rbA ? rbA->GetAngularVelocitySolver() : Vector3();
-		Vector3 vB = rbB ? rbB->GetLinearVelocitySolver()	 : Vector3();
-		Vector3 wB = rbB ? rbB->GetAngularVelocitySolver() : Vector3();
+	float maxDelta = 0.0f; // 入れたインパルスの変化の最大
+
+	// ----- 位置拘束 -----
+	// いずれかの軸が有効ならやる
+	bool isLinear = joint.effectiveMassLinear.x > 0.0f ||
+				    joint.effectiveMassLinear.y > 0.0f ||
+				    joint.effectiveMassLinear.z > 0.0f;
+
+	if (isLinear)
+	{
+		// 相対速度
+		Vector3 vRel = (vB + Vector3::Cross(wB, rB)) - (vA + Vector3::Cross(wA, rA));
 
-		// ----- ʒuS -----
-		// ꂩ̎LȂ
-		bool isLinear = joint.effectiveMassLinear.x > 0.0f ||
-					    joint.effectiveMassLinear.y > 0.0f ||
-					    joint.effectiveMassLinear.z > 0.0f;
+		// 合計インパルスを算出
+		Vector3 totalLinearImpulse = { 0.0f, 0.0f, 0.0f };
 
-		if (isLinear)
+		// 位置拘束（３軸分）
+		for (int i = 0; i < 3; i++)
 		{
-			// Αx
-			Vector3 vRel = (vB + Vector3::Cross(wB, rB)) - (vA + Vector3::Cross(wA, rA));
+			float eff = joint.effectiveMassLinear[i];
+			if (eff <= 0.0f) continue; // 拘束になっていない軸
 
-			// vCpXZo
-			Vector3 totalLinearImpulse = { 0.0f, 0.0f, 0.0f };
+			const Vector3 dir = axes[i];
+			float vRelK = Vector3::Dot(vRel, dir); // 軸方向の速度
+			float biasK = joint.biasLinear[i];
 
-			// ʒuSiRj
-			for (int i = 0; i < 3; i++)
-			{
-				float eff = joint.effectiveMassLinear[i];
-				if (eff <= 0.0f) continue; // SɂȂĂȂ
+			float deltaImpulse = -(vRelK + biasK) * eff;
 
-				const Vector3 dir = axes[i];
-				float vRelK = Vector3::Dot(vRel, dir); // ̑x
-				float biasK = joint.biasLinear[i];
+			// 累積インパルス
+			float oldImpulse = joint.accumImpulseLinear[i];
+			float newImpulse = oldImpulse + deltaImpulse;
 
-				float deltaImpulse = -(vRelK + biasK) * eff;
+			// 位置拘束なので今はクランプなし
+			joint.accumImpulseLinear[i] = newImpulse;
 
-				// ݐσCpX
-				float oldImpulse = joint.accumImpulseLinear[i];
-				float newImpulse = oldImpulse + deltaImpulse;
+			deltaImpulse = newImpulse - oldImpulse;
+			maxDelta = std::max(maxDelta, fabsf(deltaImpulse));
 
-				// ʒuSȂ̂ō̓NvȂ
-				joint.accumImpulseLinear[i] = newImpulse;
+			// その軸のインパルスを加算する
+			totalLinearImpulse += dir * deltaImpulse;
+		}
 
-				deltaImpulse = newImpulse - oldImpulse;
+		// ３軸全部０なら線形拘束をスキップ
+		if (totalLinearImpulse.lengthSq() > 1e-8f)
+		{
+			float invA = bodies.InvMass(iA);
+			float invB = bodies.InvMass(iB);
 
-				// ̎̃CpXZ
-				totalLinearImpulse += dir * deltaImpulse;
+			if (invA > 0.0f)
+			{
+				bodies.SetLinearVelocity(iA, vA - totalLinearImpulse * invA);
+				bodies.SetAngularVelocity(iA, wA - bodies.ApplyInvInertia(iA, Vector3::Cross(rA, totalLinearImpulse)));
 			}
-
-			// RSOȂ`SXLbv
-			if (totalLinearImpulse.lengthSq() > 1e-8f)
+			if (invB > 0.0f)
 			{
-				float invA = (rbA && rbA->IsDynamic()) ? rbA->InvMass() : 0.0f;
-				float invB = (rbB && rbB->IsDynamic()) ? rbB->InvMass() : 0.0f;
-
-				if (invA > 0.0f)
-				{
-					rbA->SetVelocity(vA - totalLinearImpulse * invA);
-					rbA->SetAngularVelocity(wA - rbA->ApplyInvInertiaWorld(Vector3::Cross(rA, totalLinearImpulse)));
-				}
-				if (invB > 0.0f)
-				{
-					rbB->SetVelocity(vB + totalLinearImpulse * invB);
-					rbB->SetAngularVelocity(wB + rbB->ApplyInvInertiaWorld(Vector3::Cross(rB, totalLinearImpulse)));
-				}
+				bodies.SetLinearVelocity(iB, vB + totalLinearImpulse * invB);
+				bodies.SetAngularVelocity(iB, wB + bodies.ApplyInvInertia(iB, Vector3::Cross(rB, totalLinearImpulse)));
 			}
 		}
+	}
 
-		// ΊpxԂ֐
-		auto GetRelativeOmega = [&](const Vector3& wA, const Vector3& wB)
-			{
-				if (rbA && rbB) return wB - wA;
-				else if (rbB)   return wB;
-				else			return -wA;
-			};
+	// 相対角速度を返す関数
+	auto GetRelativeOmega = [&](const Vector3& wA, const Vector3& wB)
+		{
+			return wB - wA; // 動かない側は０が入っている
+		};
 
-		// ----- swing ̊pS -----
-		// XVݑxĎ擾
-		wA = rbA ? rbA->AngularVelocity() : Vector3();
-		wB = rbB ? rbB->AngularVelocity() : Vector3();
+	// ----- swing の角拘束処理 -----
+	// 更新した現在速度を再取得
+	wA = bodies.AngularVelocity(iA);
+	wB = bodies.AngularVelocity(iB);
 
-		// Ίpx
-		Vector3 wRel = GetRelativeOmega(wA, wB);
+	// 相対角速度
+	Vector3 wRel = GetRelativeOmega(wA, wB);
 
-		// t1, t2
-		const Vector3& t1 = joint.swingAxis[0];
-		const Vector3& t2 = joint.swingAxis[1];
+	// 基底t1, t2
+	const Vector3& t1 = joint.swingAxis[0];
+	const Vector3& t2 = joint.swingAxis[1];
 
-		// Cdot = ( wRelEt1, wRelEt2 )
-		Vector3 Cdot;
-		Cdot.x = Vector3::Dot(wRel, t1);
-		Cdot.y = Vector3::Dot(wRel, t2);
+	// Cdot = ( wRel・t1, wRel・t2 )
+	Vector3 Cdot;
+	Cdot.x = Vector3::Dot(wRel, t1);
+	Cdot.y = Vector3::Dot(wRel, t2);
 
-		// rhs = Cdot + bias
-		Vector3 rhs = Cdot + joint.biasSwing;
+	// rhs = Cdot + bias
+	Vector3 rhs = Cdot + joint.biasSwing;
 
-		//  = - swingMass * rhs
-		Vector3 deltaImpulse;
-		const Matrix4x4& mass = joint.swingMass;
-		deltaImpulse.x = -(mass.m[0][0] * rhs.x + mass.m[0][1] * rhs.y);
-		deltaImpulse.y = -(mass.m[1][0] * rhs.x + mass.m[1][1] * rhs.y);
+	// Δλ = - swingMass * rhs
+	Vector3 deltaImpulse;
+	const Matrix4x4& mass = joint.swingMass;
+	deltaImpulse.x = -(mass.m[0][0] * rhs.x + mass.m[0][1] * rhs.y);
+	deltaImpulse.y = -(mass.m[1][0] * rhs.x + mass.m[1][1] * rhs.y);
 
-		// ݐ
-		Vector3 oldImpulse = joint.accImpulseSwing;
-		Vector3 newImpulse = oldImpulse + deltaImpulse;
-		joint.accImpulseSwing = newImpulse;
+	// 累積
+	Vector3 oldImpulse = joint.accImpulseSwing;
+	Vector3 newImpulse = oldImpulse + deltaImpulse;
+	joint.accImpulseSwing = newImpulse;
 
-		// ۂɓKp镪
-		deltaImpulse = newImpulse - oldImpulse;
+	// 実際に適用する分
+	deltaImpulse = newImpulse - oldImpulse;
+	maxDelta = std::max(maxDelta, std::max(fabsf(deltaImpulse.x), fabsf(deltaImpulse.y)));
 
-		// gNCpX = .x * t1 + .y * t2
-		Vector3 totalAngularImpulse = deltaImpulse.x * t1 + deltaImpulse.y * t2;
+	// トルクインパルス = Δλ.x * t1 + Δλ.y * t2
+	Vector3 totalAngularImpulse = deltaImpulse.x * t1 + deltaImpulse.y * t2;
 
-		if (totalAngularImpulse.lengthSq() > 1e-8f) 
-		{
-			float invA = (rbA && rbA->IsDynamic()) ? rbA->InvMass() : 0.0f;
-			float invB = (rbB && rbB->IsDynamic()) ? rbB->InvMass() : 0.0f;
+	if (totalAngularImpulse.lengthSq() > 1e-8f) 
+	{
+		float invA = bodies.InvMass(iA);
+		float invB = bodies.InvMass(iB);
 
-			if (invA > 0.0f)
-			{
-				rbA->SetAngularVelocity(wA - rbA->ApplyInvInertiaWorld(totalAngularImpulse));
-			}
-			if (invB > 0.0f)
-			{
-				rbB->SetAngularVelocity(wB + rbB->ApplyInvInertiaWorld(totalAngularImpulse));
-			}
+		if (invA > 0.0f)
+		{
+			bodies.SetAngularVelocity(iA, wA - bodies.ApplyInvInertia(iA, totalAngularImpulse));
 		}
-
-		// ----- twist ̏ -----
-		if ((joint.enableLimit || joint.enableSpring) && joint.effMassTwist >= 1e-8f)
+		if (invB > 0.0f)
 		{
-			// XVݑxĎ擾
-			wA = rbA ? rbA->AngularVelocity() : Vector3();
-			wB = rbB ? rbB->AngularVelocity() : Vector3();
+			bodies.SetAngularVelocity(iB, wB + bodies.ApplyInvInertia(iB, totalAngularImpulse));
+		}
+	}
 
-			// Ίpx
-			if (rbA && rbB) wRel = wB - wA;
-			else if (rbB)	wRel = wB;
-			else		    wRel = -wA;
+	// ----- twist の処理 -----
+	if ((joint.enableLimit || joint.enableSpring) && joint.effMassTwist >= 1e-8f)
+	{
+		// 更新した現在速度を再取得
+		wA = bodies.AngularVelocity(iA);
+		wB = bodies.AngularVelocity(iB);
 
-			// qWo
-			float wRelTwist = Vector3::Dot(wRel, joint.axisWorld);
+		// 相対角速度
+		wRel = wB - wA; // 動かない側は０が入っている
 
-			// ----- spring  -----
-			// Cdot = wRelTwist + damp * springDiff
-			float Cdot = wRelTwist;
-			if (joint.enableSpring)
-				Cdot += joint.springDamping * joint.springDiff;
+		// ヒンジ軸成分だけ取り出す
+		float wRelTwist = Vector3::Dot(wRel, joint.axisWorld);
 
-			float biasTwist = joint.biasTwist;
+		// ----- spring 処理 -----
+		// Cdot = wRelTwist + damp * springDiff
+		float Cdot = wRelTwist;
+		if (joint.enableSpring)
+			Cdot += joint.springDamping * joint.springDiff;
 
-			// pxS: wRelTwist + bias = 0
-			float deltaImpluse = -(Cdot + biasTwist) * joint.effMassTwist;
+		float biasTwist = joint.biasTwist;
 
-			float oldImpluse = joint.accImpulseTwist;
-			float newImpluse = oldImpluse + deltaImpluse;
+		// 角速度拘束: wRelTwist + bias = 0
+		float deltaImpluse = -(Cdot + biasTwist) * joint.effMassTwist;
 
-			// ----- limit iNvj -----
-			if (joint.enableLimit)
-			{
-				if (biasTwist > 0.0f) // 𒴂ƂF@̃CpX
-					newImpluse = std::max(0.0f, newImpluse);
-				else if (biasTwist < 0.0f) // 𒴂ƂF@̃CpX
-					newImpluse = std::min(0.0f, newImpluse);
-			}
+		float oldImpluse = joint.accImpulseTwist;
+		float newImpluse = oldImpluse + deltaImpluse;
+
+		// ----- limit 処理（クランプ） -----
+		if (joint.enableLimit)
+		{
+			if (biasTwist > 0.0f) // 下限を超えたとき：　正のインパルスだけ許可
+				newImpluse = std::max(0.0f, newImpluse);
+			else if (biasTwist < 0.0f) // 上限を超えたとき：　負のインパルスだけ許可
+				newImpluse = std::min(0.0f, newImpluse);
+		}
 
-			deltaImpluse = newImpluse - oldImpluse;
-			joint.accImpulseTwist = newImpluse;
+		deltaImpluse = newImpluse - oldImpluse;
+		joint.accImpulseTwist = newImpluse;
+		maxDelta = std::max(maxDelta, fabsf(deltaImpluse));
 
-			if (fabsf(deltaImpluse) > 1e-8f)
+		if (fabsf(deltaImpluse) > 1e-8f)
+		{
+			// ヒンジ軸周りのトルクインパルス
+			Vector3 impulseTwist = joint.axisWorld * deltaImpluse;
+
+			if (impulseTwist.lengthSq() > 1e-8f)
 			{
-				// qW̃gNCpX
-				Vector3 impulseTwist = joint.axisWorld * deltaImpluse;
+				float invA = bodies.InvMass(iA);
+				float invB = bodies.InvMass(iB);
 
-				if (impulseTwist.lengthSq() > 1e-8f)
+				if (invA > 0.0f)
 				{
-					float invA = (rbA && rbA->IsDynamic()) ? rbA->InvMass() : 0.0f;
-					float invB = (rbB && rbB->IsDynamic()) ? rbB->InvMass() : 0.0f;
-
-					if (invA > 0.0f)
-					{
-						rbA->SetAngularVelocity(wA - rbA->ApplyInvInertiaWorld(impulseTwist));
-					}
-					if (invB > 0.0f)
-					{
-						rbB->SetAngularVelocity(wB + rbB->ApplyInvInertiaWorld(impulseTwist));
-					}
+					bodies.SetAngularVelocity(iA, wA - bodies.ApplyInvInertia(iA, impulseTwist));
+				}
+				if (invB > 0.0f)
+				{
+					bodies.SetAngularVelocity(iB, wB + bodies.ApplyInvInertia(iB, impulseTwist));
 				}
 			}
-
 		}
 
-		// ----- Motor  -----
-		if (joint.enableMotor && joint.effMassTwist > 0.0f && joint.maxMotorTorque > 0.0f)
-		{
-			// XVݑxĎ擾
-			wA = rbA ? rbA->AngularVelocity() : Vector3();
-			wB = rbB ? rbB->AngularVelocity() : Vector3();
+	}
 
-			// Ίpx
-			if (rbA && rbB) wRel = wB - wA;
-			else if (rbB)	wRel = wB;
-			else		    wRel = -wA;
+	// ----- Motor 処理 -----
+	if (joint.enableMotor && joint.effMassTwist > 0.0f && joint.maxMotorTorque > 0.0f)
+	{
+		// 更新した現在速度を再取得
+		wA = bodies.AngularVelocity(iA);
+		wB = bodies.AngularVelocity(iB);
 
-			// qW̐o
-			float wRelTwist = Vector3::Dot(wRel, joint.axisWorld);
+		// 相対角速度
+		wRel = wB - wA; // 動かない側は０が入っている
 
-			// ڕWxF wRelTwist == motorSpeed
-			float Cdot = wRelTwist - joint.motorSpeed;
+		// ヒンジ軸の成分だけ取り出す
+		float wRelTwist = Vector3::Dot(wRel, joint.axisWorld);
 
-			// Cdot +  * M-1 = 0   = -Cdot * effMass
-			float deltaImpulse = -Cdot * joint.effMassTwist;
+		// 目標速度： wRelTwist == motorSpeed
+		float Cdot = wRelTwist - joint.motorSpeed;
 
-			// ݐςƃNv
-			float oldImpulse = joint.accImpulseMotor;
-			float maxImpulse = joint.maxMotorTorque * dt; // NEm * s = NEmEs
+		// Cdot + λ * M-1 = 0 → λ = -Cdot * effMass
+		float deltaImpulse = -Cdot * joint.effMassTwist;
 
-			float newImpulse = oldImpulse + deltaImpulse;
-			// -maxImpulse ~ maxImpulse ɃNv
-			if (newImpulse >  maxImpulse) newImpulse =  maxImpulse;
-			if (newImpulse < -maxImpulse) newImpulse = -maxImpulse;
+		// 累積とクランプ
+		float oldImpulse = joint.accImpulseMotor;
+		float maxImpulse = joint.maxMotorTorque * dt; // N・m * s = N・m・s
 
-			deltaImpulse = newImpulse - oldImpulse;
-			joint.accImpulseMotor = newImpulse;
+		float newImpulse = oldImpulse + deltaImpulse;
+		// -maxImpulse ~ maxImpulse にクランプ
+		if (newImpulse >  maxImpulse) newImpulse =  maxImpulse;
+		if (newImpulse < -maxImpulse) newImpulse = -maxImpulse;
+
+		deltaImpulse = newImpulse - oldImpulse;
+		joint.accImpulseMotor = newImpulse;
+		maxDelta = std::max(maxDelta, fabsf(deltaImpulse));
 
-			if (fabsf(deltaImpulse) > 1e-8f)
+		if (fabsf(deltaImpulse) > 1e-8f)
+		{
+			Vector3 impulseMotor = joint.axisWorld * deltaImpulse;
+			if (impulseMotor.lengthSq() > 1e-8f)
 			{
-				Vector3 impulseMotor = joint.axisWorld * deltaImpulse;
-				Vector3::Printf(impulseMotor, "impulseMotor");
-				if (impulseMotor.lengthSq() > 1e-8f)
-				{
-					float invA = (rbA && rbA->IsDynamic()) ? rbA->InvMass() : 0.0f;
-					float invB = (rbB && rbB->IsDynamic()) ? rbB->InvMass() : 0.0f;
+				float invA = bodies.InvMass(iA);
+				float invB = bodies.InvMass(iB);
 
-					if (invA > 0.0f)
-					{
-						rbA->SetAngularVelocity(wA - rbA->ApplyInvInertiaWorld(impulseMotor));
-					}
-					if (invB > 0.0f)
-					{
-						rbB->SetAngularVelocity(wB + rbB->ApplyInvInertiaWorld(impulseMotor));
-					}
+				if (invA > 0.0f)
+				{
+					bodies.SetAngularVelocity(iA, wA - bodies.ApplyInvInertia(iA, impulseMotor));
+				}
+				if (invB > 0.0f)
+				{
+					bodies.SetAngularVelocity(iB, wB + bodies.ApplyInvInertia(iB, impulseMotor));
 				}
 			}
 		}
-		//Vector3::Printf(joint.axisWorld);
 	}
+	//Vector3::Printf(joint.axisWorld);
+	return maxDelta;
 }
 
 // ==================================================
-// ----- ̑xXV -----
+// ----- 見かけの速度更新 -----
 // ==================================================
 void PhysicsSystem::UpdateKinematicApparentVelocity(float dt)
 {
@@ -1955,7 +3625,7 @@ void PhysicsSystem::UpdateKinematicApparentVelocity(float dt)
 		const Vector3 curPos = tf->Position();
 		Quaternion curRot = tf->Rotation().normalized();
 
-		// Pt[ڂPrevp̏
+		// １フレーム目のPrevが無い時用の処理
 		if (!rb->HasPrevKinematicPose())
 		{
 			rb->SetPrevPosition(curPos);
@@ -1972,7 +3642,7 @@ void PhysicsSystem::UpdateKinematicApparentVelocity(float dt)
 		// ----- Angular -----
 		Quaternion dq = curRot * rb->PrevRotation().Conjugate();
 		dq = dq.normalized();
-		if (dq.w < 0.0f) dq = dq * -1.0f; // ŒZoH
+		if (dq.w < 0.0f) dq = dq * -1.0f; // 最短経路
 
 		float w = std::clamp(dq.w, -1.0f, 1.0f);
 		float angle = 2.0f * acosf(w);
@@ -1986,93 +3656,777 @@ void PhysicsSystem::UpdateKinematicApparentVelocity(float dt)
 
 		rb->SetKinematicAngularVelocity(axis * (angle / dt));
 
-		// Prev XV
+		// Prev 更新
 		rb->SetPrevPosition(curPos);
 		rb->SetPrevRotation(curRot);
 	}
 }
 
 // --------------------------------------------------
-// 
+// 同期
 // --------------------------------------------------
 void PhysicsSystem::SyncCOM()
 {
-	// Rigidbody  m_CenterOfMassLocal  Collider  m_OffsetPosition 𓯊
-	for (auto* rb : m_Rigidbodies)
+	// Rigidbody の m_CenterOfMassLocal と Collider の m_OffsetPosition を同期させる
+	// オフセットが変わったコライダーから、持っている Rigidbody を辿る
+	for (auto* col : m_Colliders)
 	{
-		auto* col = rb->Owner()->GetComponent<Collider>();
-		if (col)
-		{
-			if (col->OffsetDirty())
-			{
-				// offsetPosition f
-				rb->SetCenterOfMassLocal(col->m_OffsetPositionLocal); // 
-				auto* tr = rb->Owner()->GetComponent<TransformComponent>();
-				rb->SetWorldCOM(tr->Position() + tr->Rotation().Rotate(rb->CenterOfMassLocal()));
-
-				// offsetRotation f
-				rb->UpdateInertiaBodyInvFromOffset(col->m_OffsetRotationLocal);
-				rb->UpdateInertiaWorldInvFrom(rb->Owner()->Transform()->Rotation());
-				col->ConsumeOffsetDirty(); // tO܂
-			}
-		}
+		if (!col->OffsetDirty()) continue;
+		auto* rb = col->Body();
+		if (!rb) continue;
+
+		// offsetPosition 反映
+		rb->SetCenterOfMassLocal(col->m_OffsetPositionLocal); // 同期
+		auto* tr = rb->Owner()->Transform();
+		rb->SetWorldCOM(tr->Position() + tr->Rotation().Rotate(rb->CenterOfMassLocal()));
+
+		// offsetRotation 反映
+		rb->UpdateInertiaBodyInvFromOffset(col->m_OffsetRotationLocal);
+		rb->UpdateInertiaWorldInvFrom(tr->Rotation());
+		col->ConsumeOffsetDirty(); // フラグを折る
 	}
 }
 
 // ==================================================
-// ----- RC_[fobO`֌W -----
+// ----- ソルバーボディ -----
 // ==================================================
-// [hWnKv
-void PhysicsSystem::DrawDebug(DebugRenderer& dr)
+// --------------------------------------------------
+// 集める
+// 起きている Dynamic だけ動かせるボディにする（眠り、Kinematic、Static は逆質量０）
+// --------------------------------------------------
+void PhysicsSystem::BuildSolverBodies()
 {
-	Vector4 colorTrigger = { 0.0f, 0.0f, 1.0f, 1.0f }; // TriggerȂ
+	m_SolverBodies.Clear();
+	for (Rigidbody* rb : m_Rigidbodies)
+		rb->m_SolverIndex = m_SolverBodies.Add(rb, IsAwakeDynamic(rb));
 
-	for (int i = 0; i < m_Colliders.size(); i++)
+	auto indexOf = [](const Rigidbody* rb) { return rb ? rb->m_SolverIndex : SolverBodySet::StaticIndex; };
+	for (auto& c : m_Contacts)
 	{
-		Collider* col = m_Colliders[i];
-		if (!col) continue;
+		c.bodyA = indexOf(c.A->Body());
+		c.bodyB = indexOf(c.B->Body());
+	}
+	for (auto& j : m_DistanceJoints) { j.bodyA = indexOf(j.pBodyA); j.bodyB = indexOf(j.pBodyB); }
+	for (auto& j : m_BallJoints)	 { j.bodyA = indexOf(j.pBodyA); j.bodyB = indexOf(j.pBodyB); }
+	for (auto& j : m_HingeJoints)	 { j.bodyA = indexOf(j.pBodyA); j.bodyB = indexOf(j.pBodyB); }
+}
 
-		const ColliderPose& pose = col->WorldPose();
+// ==================================================
+// ----- ソルバーアイランド -----
+// ==================================================
+// --------------------------------------------------
+// 構築
+// 動かせるボディ同士だけ繋ぐ（Static、Kinematic、眠りは繋ぎ目にしない、UpdateSleep と同じ）
+// 反復回数はメンバーの設定（０はシーンの値）の一番多いもの
+// --------------------------------------------------
+void PhysicsSystem::BuildSolverIslands()
+{
+	const int count = m_SolverBodies.Count();
+	m_SolverIslands.clear();
+	m_SolverIslandOf.assign(count, -1);
+	m_MaxVelocityIterations = 0;
+	m_MaxPositionIterations = 0;
 
-		// Trigger 
-		Vector4 color = col->IsTrigger() ? colorTrigger : Vector4{1.0f, 1.0f, 0.0f, 1.0f}; // F
+	// ----- 繋がりを union-find でまとめる -----
+	m_IslandParent.resize(count);
+	for (int i = 0; i < count; i++) m_IslandParent[i] = i;
 
-		switch (col->m_Type)
+	auto link = [&](int a, int b)
 		{
-		case ColliderType::Box:
+			if (m_SolverBodies.InvMass(a) > 0.0f && m_SolverBodies.InvMass(b) > 0.0f) UniteIsland(a, b);
+		};
+	for (const auto& c : m_Contacts)		link(c.bodyA, c.bodyB);
+	for (const auto& j : m_DistanceJoints)	link(j.bodyA, j.bodyB);
+	for (const auto& j : m_BallJoints)		link(j.bodyA, j.bodyB);
+	for (const auto& j : m_HingeJoints)		link(j.bodyA, j.bodyB);
+
+	// ----- 根から番号を振る -----
+	// ソルバーボディは m_Rigidbodies の順に並んでいて、根は一番小さい番号なので先に出てくる
+	for (const Rigidbody* rb : m_Rigidbodies)
+	{
+		const int i = rb->m_SolverIndex;
+		if (m_SolverBodies.InvMass(i) <= 0.0f) continue;
+
+		const int root = FindIsland(i);
+		if (root == i)
 		{
-			auto* shape = static_cast<BoxCollision*>(col->Shape());
-			assert(shape);
-			Vector3 center = pose.position;
-			Vector3 halfSize = shape->HalfSize() * pose.scale;
-			Matrix4x4 rot = pose.rotation.ToMatrix();
+			m_SolverIslandOf[i] = (int)m_SolverIslands.size();
+			m_SolverIslands.push_back({});
+		}
+		else m_SolverIslandOf[i] = m_SolverIslandOf[root];
 
-			dr.DrawBox(center, halfSize, rot, color);
-			break;
+		SolverIsland& island = m_SolverIslands[m_SolverIslandOf[i]];
+		island.velocityIterations = std::max(island.velocityIterations, rb->m_VelocityIterations > 0 ? rb->m_VelocityIterations : m_VelocityIterations);
+		island.positionIterations = std::max(island.positionIterations, rb->m_PositionIterations > 0 ? rb->m_PositionIterations : m_PositionIterations);
+		m_MaxVelocityIterations = std::max(m_MaxVelocityIterations, island.velocityIterations);
+		m_MaxPositionIterations = std::max(m_MaxPositionIterations, island.positionIterations);
+	}
+
+	// ----- 拘束を動かせる側のアイランドに入れる -----
+	auto islandOf = [&](int a, int b) { return m_SolverIslandOf[a] >= 0 ? m_SolverIslandOf[a] : m_SolverIslandOf[b]; };
+	for (auto& c : m_Contacts)		 c.island = islandOf(c.bodyA, c.bodyB);
+	for (auto& j : m_DistanceJoints) j.island = islandOf(j.bodyA, j.bodyB);
+	for (auto& j : m_BallJoints)	 j.island = islandOf(j.bodyA, j.bodyB);
+	for (auto& j : m_HingeJoints)	 j.island = islandOf(j.bodyA, j.bodyB);
+
+	m_SolverIslandDelta.assign((size_t)m_WorkerPool.ThreadCount() * m_SolverIslands.size(), 0.0f);
+	m_Stats.solverIslands = (int)m_SolverIslands.size();
+}
+// --------------------------------------------------
+// 反復の終わり
+// スレッドごとの最大を集めて、収束したか回数を使い切ったアイランドを止める
+// 最大を取るだけなので、スレッド数や解く順に依らず同じ判定になる
+// --------------------------------------------------
+bool PhysicsSystem::EndSolverIteration(int iteration, int threads, bool position)
+{
+	const size_t islandCount = m_SolverIslands.size();
+	bool anyActive = false;
+	for (size_t k = 0; k < islandCount; k++)
+	{
+		SolverIsland& island = m_SolverIslands[k];
+		if (!island.active) continue;
+
+		float delta = 0.0f;
+		for (int t = 0; t < threads; t++)
+		{
+			float& d = m_SolverIslandDelta[t * islandCount + k];
+			delta = std::max(delta, d);
+			d = 0.0f;
 		}
-		case ColliderType::Sphere:
+		const int iterations = position ? island.positionIterations : island.velocityIterations;
+		if (delta < m_VelocityTolerance || iteration + 1 >= iterations) island.active = false;
+		else anyActive = true;
+	}
+	(position ? m_Stats.positionIterations : m_Stats.velocityIterations) = iteration + 1;
+	return anyActive;
+}
+
+// ==================================================
+// ----- 並列ソルバー -----
+// ==================================================
+// --------------------------------------------------
+// バッチ分け
+// 色を取り合うのは動かせるボディだけ（Static, Kinematic は書き込まれないので共有してよい）
+// 逐次版と同じくジョイント→接触の順に、使える一番小さい色を割り当てる
+// --------------------------------------------------
+void PhysicsSystem::BuildSolverBatches()
+{
+	m_SolverBodyColors.assign(m_SolverBodies.Count(), 0);
+
+	m_SolverColors.resize(MaxSolverColors + 1); // 最後は色が足りなかった分
+	for (auto& color : m_SolverColors) color.clear();
+
+	auto add = [&](SolverConstraint::Type type, int index, int bodyA, int bodyB, int island)
 		{
-			auto* shape = static_cast<SphereCollision*>(col->Shape());
-			assert(shape);
-			Vector3 center = pose.position;
-			float   radius = shape->Radius() * pose.scale.x;
-			Matrix4x4 rot = pose.rotation.ToMatrix();
+			if (island < 0) return; // 動かせるボディが無い
+			const int ia = m_SolverBodies.InvMass(bodyA) > 0.0f ? bodyA : -1;
+			const int ib = m_SolverBodies.InvMass(bodyB) > 0.0f ? bodyB : -1;
+			const uint64_t used = (ia >= 0 ? m_SolverBodyColors[ia] : 0) | (ib >= 0 ? m_SolverBodyColors[ib] : 0);
+
+			int color = 0;
+			while (color < MaxSolverColors && (used & (uint64_t(1) << color))) color++;
+			if (color < MaxSolverColors)
+			{
+				if (ia >= 0) m_SolverBodyColors[ia] |= uint64_t(1) << color;
+				if (ib >= 0) m_SolverBodyColors[ib] |= uint64_t(1) << color;
+			}
+			m_SolverColors[color].push_back({ type, index, island });
+		};
+	for (int i = 0; i < (int)m_DistanceJoints.size(); i++) add(SolverConstraint::Type::Distance, i, m_DistanceJoints[i].bodyA, m_DistanceJoints[i].bodyB, m_DistanceJoints[i].island);
+	for (int i = 0; i < (int)m_BallJoints.size(); i++)	   add(SolverConstraint::Type::Ball,	 i, m_BallJoints[i].bodyA,	   m_BallJoints[i].bodyB,	  m_BallJoints[i].island);
+	for (int i = 0; i < (int)m_HingeJoints.size(); i++)	   add(SolverConstraint::Type::Hinge,	 i, m_HingeJoints[i].bodyA,	   m_HingeJoints[i].bodyB,	  m_HingeJoints[i].island);
+	for (int i = 0; i < (int)m_Contacts.size(); i++)	   add(SolverConstraint::Type::Contact,	 i, m_Contacts[i].bodyA,	   m_Contacts[i].bodyB,		  m_Contacts[i].island);
+
+	// ----- 色順に詰め直す -----
+	m_SolverConstraints.clear();
+	m_SolverBatchStart.clear();
+	for (const auto& color : m_SolverColors)
+	{
+		if (color.empty()) continue;
+		m_SolverBatchStart.push_back((int)m_SolverConstraints.size());
+		m_SolverConstraints.insert(m_SolverConstraints.end(), color.begin(), color.end());
+	}
+	m_SolverBatchStart.push_back((int)m_SolverConstraints.size());
+}
+// --------------------------------------------------
+// 並列の速度解決
+// 全スレッドで反復とバッチを回し、バッチの切れ目ごとに待ち合わせる
+// 反復の終わりに０番スレッドが収束を判定し、全員がそれを見て抜ける
+// --------------------------------------------------
+void PhysicsSystem::SolveVelocityParallel(float dt)
+{
+	BuildSolverBatches();
+	SolveParallel(m_MaxVelocityIterations, false, dt);
+}
+void PhysicsSystem::SolvePositionParallel(float dt)
+{
+	SolveParallel(m_MaxPositionIterations, true, dt); // バッチは速度のときのまま
+}
+void PhysicsSystem::SolveParallel(int iterations, bool position, float dt)
+{
+	const int batchCount = (int)m_SolverBatchStart.size() - 1;
+	if (batchCount <= 0) return;
 
-			dr.DrawSphere(center, radius, rot,  color);
-			break;
-		}
-		case ColliderType::Capsule:
+	// 色が足りなかった分（あれば最後のバッチ）は同じボディを触り得るので分けない
+	const bool hasOverflow = !m_SolverColors[MaxSolverColors].empty();
+
+	BeginSolverIterations();
+	bool converged = false;
+	m_WorkerPool.Run([&](int thread)
 		{
-			auto* shape = static_cast<CapsuleCollision*>(col->Shape());
-			assert(shape);
-			Vector3 center = pose.position;
-			float   radius = shape->Radius()		 * pose.scale.x;
-			float   height = shape->CylinderHeight() * pose.scale.y;
-			Matrix4x4 rot  = pose.rotation.ToMatrix();
+			const int threads = m_WorkerPool.ThreadCount();
+			auto solve = [&](const SolverConstraint& sc)
+				{
+					if (IsSolverIslandActive(sc.island)) RecordSolverDelta(thread, sc.island, SolveConstraint(sc, position, dt));
+				};
+			for (int iteration = 0; iteration < iterations; iteration++)
+			{
+				for (int b = 0; b < batchCount; b++)
+				{
+					const int begin = m_SolverBatchStart[b];
+					const int count = m_SolverBatchStart[b + 1] - begin;
+					const bool serial = count < MinParallelBatch || (hasOverflow && b == batchCount - 1);
+					if (serial)
+					{
+						if (thread == 0)
+							for (int i = begin; i < begin + count; i++) solve(m_SolverConstraints[i]);
+					}
+					else
+					{
+						// スレッド数で等分
+						const int first = begin + (int)((int64_t)count * thread / threads);
+						const int last  = begin + (int)((int64_t)count * (thread + 1) / threads);
+						for (int i = first; i < last; i++) solve(m_SolverConstraints[i]);
+					}
+					m_WorkerPool.Barrier();
+				}
 
-			dr.DrawCapsule(center, radius, height, rot, color);
-			break;
+				// ----- 収束判定 -----
+				if (thread == 0) converged = !EndSolverIteration(iteration, threads, position);
+				m_WorkerPool.Barrier();
+				if (converged) break;
+			}
+		});
+}
+float PhysicsSystem::SolveConstraint(const SolverConstraint& sc, bool position, float dt)
+{
+	// めり込み解消は接触だけ
+	if (position) return sc.type == SolverConstraint::Type::Contact ? ResolvePseudoContact(m_Contacts[sc.index], dt) : 0.0f;
+
+	switch (sc.type)
+	{
+	case SolverConstraint::Type::Contact:  return ResolveContact(m_Contacts[sc.index], dt);
+	case SolverConstraint::Type::Distance: return ResolveDistanceJoint(m_DistanceJoints[sc.index], dt);
+	case SolverConstraint::Type::Ball:	   return ResolveBallJoint(m_BallJoints[sc.index], dt);
+	case SolverConstraint::Type::Hinge:	   return ResolveHingeJoint(m_HingeJoints[sc.index], dt);
+	}
+	return 0.0f;
+}
+
+// ==================================================
+// ----- アイランド、スリープ -----
+// ==================================================
+// --------------------------------------------------
+// 有効化
+// 切ったら眠っているものを全部起こす
+// --------------------------------------------------
+void PhysicsSystem::SetEnableSleep(bool enable)
+{
+	WaitStep();
+	m_EnableSleep = enable;
+	if (enable) return;
+	while (!m_SleepingIslands.empty())
+		WakeIsland(m_SleepingIslands.begin()->second.front());
+}
+// --------------------------------------------------
+// 起こす
+// --------------------------------------------------
+void PhysicsSystem::WakeIsland(Rigidbody* rb)
+{
+	if (!rb) return;
+	auto it = m_SleepingIslands.find(rb->m_SleepIslandId);
+	if (it == m_SleepingIslands.end()) return;
+
+	for (Rigidbody* member : it->second)
+	{
+		member->m_IsSleeping = false; // WakeUp はパイプライン実行中だと溜まるので直接
+		member->m_SleepTimer = 0.0f;
+		member->m_SleepIslandId = 0;
+	}
+	m_SleepingIslands.erase(it);
+}
+void PhysicsSystem::WakeSleepingIslands()
+{
+	// ----- 外から触られた -----
+	// WakeUp、速度の書き込み、Transform の書き込み、BodyType の変更で積まれたものだけ見る
+	for (Rigidbody* rb : m_WakeRequests)
+	{
+		rb->m_WakeRequested = false;
+		if (rb->m_SleepIslandId == 0) { StopWatching(rb); continue; } // もう起きている
+		if (!IsTouchedWhileSleeping(rb)) continue; // 同じ値を書き直しただけ
+
+		auto it = m_SleepingIslands.find(rb->m_SleepIslandId);
+		if (it != m_SleepingIslands.end())
+			for (Rigidbody* member : it->second) StopWatching(member);
+		WakeIsland(rb);
+	}
+	m_WakeRequests.clear();
+	if (m_SleepingIslands.empty()) return;
+
+	// ----- 起きている剛体とジョイントで繋がっている -----
+	auto wakeJoint = [&](Rigidbody* a, Rigidbody* b)
+		{
+			if		(IsAwakeDynamic(a) && b && b->IsSleeping()) WakeIsland(b);
+			else if (IsAwakeDynamic(b) && a && a->IsSleeping()) WakeIsland(a);
+		};
+	for (const auto& j : m_DistanceJoints) wakeJoint(j.pBodyA, j.pBodyB);
+	for (const auto& j : m_BallJoints)	   wakeJoint(j.pBodyA, j.pBodyB);
+	for (const auto& j : m_HingeJoints)	   wakeJoint(j.pBodyA, j.pBodyB);
+}
+bool PhysicsSystem::IsTouchedWhileSleeping(const Rigidbody* rb) const
+{
+	if (!rb->IsSleeping() || !rb->IsDynamic()) return true;
+	if (rb->Velocity().lengthSq() > 0.0f || rb->AngularVelocity().lengthSq() > 0.0f) return true;
+	const TransformComponent* tf = rb->Owner()->Transform();
+	const Quaternion q = tf->Rotation();
+	const Quaternion& s = rb->m_SleepRotation;
+	return (tf->Position() - rb->m_SleepPosition).lengthSq() > 0.0f
+		|| q.x != s.x || q.y != s.y || q.z != s.z || q.w != s.w;
+}
+// --------------------------------------------------
+// Transform の見張り
+// 眠っている間だけ付けて、書き換えられたら Rigidbody::OnTransformMoved から起こす候補に積む
+// 眠った時の姿勢はステップの区切りで決まるので、付けるのは FinishStep（パイプライン実行では書き戻しの後）
+// --------------------------------------------------
+void PhysicsSystem::WatchNewSleepers()
+{
+	for (Rigidbody* rb : m_NewSleepers)
+	{
+		if (rb->m_SleepIslandId == 0) continue; // 同じステップのうちに起こされた
+		rb->Owner()->Transform()->SetMoveWatcher(rb);
+		if (IsTouchedWhileSleeping(rb)) rb->RequestWake(); // 走っている間にスクリプトが動かしていた
+	}
+	m_NewSleepers.clear();
+}
+void PhysicsSystem::StopWatching(Rigidbody* rb)
+{
+	TransformComponent* tf = rb->Owner()->Transform();
+	if (tf->MoveWatcher() == rb) tf->SetMoveWatcher(nullptr);
+}
+// --------------------------------------------------
+// アイランド構築とスリープ判定
+// 接触、ジョイントで繋がった Dynamic をまとめ、全員が一定時間止まっていたら眠らせる
+// Static、Kinematic は繋ぎ目にしない（床を介して全部が１つにならないように）
+// --------------------------------------------------
+void PhysicsSystem::UpdateSleep(float dt)
+{
+	if (!m_EnableSleep) return;
+
+	// ----- 起きている Dynamic に番号を振る -----
+	m_IslandBodies.clear();
+	for (Rigidbody* rb : m_Rigidbodies)
+	{
+		rb->m_IslandIndex = -1;
+		if (!IsAwakeDynamic(rb)) continue;
+		rb->m_IslandIndex = (int)m_IslandBodies.size();
+		m_IslandBodies.push_back(rb);
+
+		// 静止時間
+		const bool still = rb->CanSleep()
+			&& rb->Velocity().lengthSq()		<= SleepLinearTolerance  * SleepLinearTolerance
+			&& rb->AngularVelocity().lengthSq() <= SleepAngularTolerance * SleepAngularTolerance;
+		rb->m_SleepTimer = still ? rb->m_SleepTimer + dt : 0.0f;
+	}
+	const int n = (int)m_IslandBodies.size();
+	if (n == 0) return;
+
+	// ----- 繋がりを union-find でまとめる -----
+	m_IslandParent.resize(n);
+	for (int i = 0; i < n; i++) m_IslandParent[i] = i;
+
+	auto link = [&](Rigidbody* a, Rigidbody* b)
+		{
+			const int ia = a ? a->m_IslandIndex : -1;
+			const int ib = b ? b->m_IslandIndex : -1;
+			if (ia >= 0 && ib >= 0) { UniteIsland(ia, ib); return; }
+			// 動いている Kinematic に触れていたら眠らない
+			if (ia >= 0 && IsMovingKinematic(b)) a->m_SleepTimer = 0.0f;
+			if (ib >= 0 && IsMovingKinematic(a)) b->m_SleepTimer = 0.0f;
+		};
+	for (const auto& c : m_Contacts)		link(c.A->Body(), c.B->Body());
+	for (const auto& j : m_DistanceJoints)	link(j.pBodyA, j.pBodyB);
+	for (const auto& j : m_BallJoints)		link(j.pBodyA, j.pBodyB);
+	for (const auto& j : m_HingeJoints)		link(j.pBodyA, j.pBodyB);
+
+	// ----- アイランドの静止時間は一番短いメンバーの値 -----
+	m_IslandMinTimer.assign(n, TimeToSleep);
+	for (int i = 0; i < n; i++)
+	{
+		float& t = m_IslandMinTimer[FindIsland(i)];
+		t = std::min(t, m_IslandBodies[i]->m_SleepTimer);
+	}
+
+	// ----- 眠らせる -----
+	// 根のボディに ID を持たせて、メンバーはそれを参照する
+	for (int i = 0; i < n; i++)
+	{
+		const int root = FindIsland(i);
+		if (m_IslandMinTimer[root] < TimeToSleep) continue;
+
+		Rigidbody* rootBody = m_IslandBodies[root];
+		if (rootBody->m_SleepIslandId == 0) rootBody->m_SleepIslandId = m_NextIslandId++;
+
+		Rigidbody* rb = m_IslandBodies[i];
+		rb->m_SleepIslandId = rootBody->m_SleepIslandId;
+		rb->m_IsSleeping = true;
+		rb->m_Velocity = Vector3();
+		rb->m_AngularVelocity = Vector3();
+		rb->ConsumeForces();
+		rb->ConsumeTorques();
+		rb->m_SleepPosition = StepPosition(rb, rb->Owner()->Transform()); // パイプライン実行では SyncStep で Transform の値に合わせ直す
+		rb->m_SleepRotation = StepRotation(rb, rb->Owner()->Transform());
+		m_SleepingIslands[rb->m_SleepIslandId].push_back(rb);
+		m_NewSleepers.push_back(rb);
+	}
+}
+int PhysicsSystem::FindIsland(int i)
+{
+	// 経路半分化
+	while (m_IslandParent[i] != i)
+	{
+		m_IslandParent[i] = m_IslandParent[m_IslandParent[i]];
+		i = m_IslandParent[i];
+	}
+	return i;
+}
+void PhysicsSystem::UniteIsland(int a, int b)
+{
+	a = FindIsland(a);
+	b = FindIsland(b);
+	if (a == b) return;
+	// 小さい番号を根にして結果を登録順で決める
+	if (a < b) m_IslandParent[b] = a;
+	else	   m_IslandParent[a] = b;
+}
+
+// ==================================================
+// ----- 計測 -----
+// ==================================================
+void PhysicsSystem::EndPhase(PhysicsStepStats::Phase phase)
+{
+	const auto now = std::chrono::steady_clock::now();
+	m_Stats.phaseMs[phase] += std::chrono::duration<double, std::milli>(now - m_PhaseStart).count();
+	m_PhaseStart = now;
+}
+
+// ==================================================
+// ----- スナップショット -----
+// ==================================================
+namespace
+{
+	// --------------------------------------------------
+	// バイト列の形式
+	// ヘッダー → ボディ → コライダー → ジョイント → ペア集合 → 接触キャッシュ の順に詰める
+	// 値は float / 整数をそのまま並べるだけ（同じ実行ファイルで戻す前提、エンディアンは見ない）
+	// 形式を変えたら SnapshotVersion を上げる
+	// --------------------------------------------------
+	const uint32_t SnapshotMagic   = 0x504E5350u; // "PSNP"
+	const uint32_t SnapshotVersion = 2;
+
+	struct SnapshotHeader
+	{
+		uint32_t magic = SnapshotMagic;
+		uint32_t version = SnapshotVersion;
+		uint32_t bodyCount = 0;
+		uint32_t bodyColliderCount = 0; // ボディに付いているコライダーの数（姿勢を書く）
+		uint32_t colliderSlots = 0; // コライダー ID の数（ペアキーが指す先）
+		uint32_t distanceJointCount = 0;
+		uint32_t ballJointCount = 0;
+		uint32_t hingeJointCount = 0;
+		uint32_t triggerPairCount = 0;
+		uint32_t collisionPairCount = 0;
+		uint32_t contactCount = 0;
+		uint32_t stepStamp = 0;
+		uint32_t nextIslandId = 0;
+	};
+	// １件ごとの大きさ
+	// ボディ: Transform(10) 速度(3) 角速度(3) 力(3) トルク(3) COM(3) 慣性(16) 前の姿勢(3+4) 見かけの速度(3+3) 眠った姿勢(3+4) 静止時間(1)
+	//         ＋ アイランド ID ＋ フラグ２つ
+	const size_t SnapshotBodyBytes	  = sizeof(float) * 62 + sizeof(uint32_t) + 2;
+	const size_t SnapshotColliderBytes = sizeof(float) * (10 + 6); // WorldPose、WorldAABB
+	const size_t SnapshotDistanceBytes = sizeof(float) * 1;
+	const size_t SnapshotBallBytes	  = sizeof(float) * 3;
+	const size_t SnapshotHingeBytes	  = sizeof(float) * 8;
+	const size_t SnapshotContactBytes  = sizeof(uint64_t) + sizeof(float) * 3 + sizeof(int32_t) + sizeof(uint32_t)
+									   + sizeof(float) * 7 * ContactManifold::MAX_POINTS;
+
+	size_t SnapshotSize(const SnapshotHeader& h)
+	{
+		return sizeof(SnapshotHeader)
+			+ SnapshotBodyBytes		* h.bodyCount
+			+ SnapshotColliderBytes * h.bodyColliderCount
+			+ SnapshotDistanceBytes * h.distanceJointCount
+			+ SnapshotBallBytes		* h.ballJointCount
+			+ SnapshotHingeBytes	* h.hingeJointCount
+			+ sizeof(uint64_t)		* (h.triggerPairCount + h.collisionPairCount)
+			+ SnapshotContactBytes	* h.contactCount;
+	}
+
+	// --------------------------------------------------
+	// 書き込み（memcpy で詰めるだけ）
+	// --------------------------------------------------
+	struct SnapshotWriter
+	{
+		uint8_t* p = nullptr;
+
+		template<class T> void Raw(const T& v) { static_assert(std::is_trivially_copyable<T>::value, ""); std::memcpy(p, &v, sizeof(T)); p += sizeof(T); }
+		void Vec (const Vector3& v)	   { Raw(v.x); Raw(v.y); Raw(v.z); }
+		void Quat(const Quaternion& q) { Raw(q.x); Raw(q.y); Raw(q.z); Raw(q.w); }
+		void Mat (const Matrix4x4& m)  { std::memcpy(p, m.m, sizeof(m.m)); p += sizeof(m.m); }
+		void Tf	 (const Transform& t)  { Vec(t.position); Quat(t.rotation); Vec(t.scale); }
+		void Pose(const ColliderPose& t) { Vec(t.position); Quat(t.rotation); Vec(t.scale); }
+		void Box (const AABB& b)	   { Vec(b.min); Vec(b.max); }
+	};
+	// --------------------------------------------------
+	// 読み込み（大きさは先に確かめてあるので範囲は見ない）
+	// --------------------------------------------------
+	struct SnapshotReader
+	{
+		const uint8_t* p = nullptr;
+
+		template<class T> void Raw(T& v) { static_assert(std::is_trivially_copyable<T>::value, ""); std::memcpy(&v, p, sizeof(T)); p += sizeof(T); }
+		void Vec (Vector3& v)	 { Raw(v.x); Raw(v.y); Raw(v.z); }
+		void Quat(Quaternion& q) { Raw(q.x); Raw(q.y); Raw(q.z); Raw(q.w); }
+		void Mat (Matrix4x4& m)	 { std::memcpy(m.m, p, sizeof(m.m)); p += sizeof(m.m); }
+		void Tf	 (Transform& t)	 { Vec(t.position); Quat(t.rotation); Vec(t.scale); }
+		void Pose(ColliderPose& t) { Vec(t.position); Quat(t.rotation); Vec(t.scale); }
+		void Box (AABB& b)		 { Vec(b.min); Vec(b.max); }
+	};
+
+	// 集合はキー順（解除済みの ID を含むものは書かない）
+	template<class IsLive>
+	uint32_t CountLiveKeys(const std::vector<uint64_t>& keys, IsLive isLive)
+	{
+		return (uint32_t)std::count_if(keys.begin(), keys.end(), isLive);
+	}
+	template<class IsLive>
+	void WriteLiveKeys(SnapshotWriter& w, const std::vector<uint64_t>& keys, IsLive isLive)
+	{
+		for (uint64_t k : keys) if (isLive(k)) w.Raw(k);
+	}
+}
+uint32_t PhysicsSystem::CountBodyColliders() const
+{
+	return (uint32_t)std::count_if(m_Colliders.begin(), m_Colliders.end(), [](const Collider* c) { return c->Body() != nullptr; });
+}
+// --------------------------------------------------
+// 保存
+// --------------------------------------------------
+void PhysicsSystem::SaveSnapshot(std::vector<uint8_t>& out)
+{
+	SyncStep(); // 走っているステップがあれば待って反映してから（途中の状態を書かないように）
+	auto isLive = [this](uint64_t k) { return IsLivePair(k); };
+	const uint32_t contactCount = (uint32_t)std::count_if(m_ContactCache.begin(), m_ContactCache.end(), [&](const ContactCacheEntry& e) { return isLive(e.key); });
+
+	SnapshotHeader h;
+	h.bodyCount			 = (uint32_t)m_Rigidbodies.size();
+	h.bodyColliderCount	 = CountBodyColliders();
+	h.colliderSlots		 = (uint32_t)m_ById.size();
+	h.distanceJointCount = (uint32_t)m_DistanceJoints.size();
+	h.ballJointCount	 = (uint32_t)m_BallJoints.size();
+	h.hingeJointCount	 = (uint32_t)m_HingeJoints.size();
+	h.triggerPairCount	 = CountLiveKeys(m_PrevTrigger, isLive);
+	h.collisionPairCount = CountLiveKeys(m_PrevCollision, isLive);
+	h.contactCount		 = contactCount;
+	h.stepStamp			 = m_StepStamp;
+	h.nextIslandId		 = m_NextIslandId;
+
+	out.resize(SnapshotSize(h));
+	SnapshotWriter w{ out.data() };
+	w.Raw(h);
+
+	// ----- ボディ -----
+	// 質量や摩擦などの設定は含めない（ステップで変わらないもの）
+	for (const Rigidbody* rb : m_Rigidbodies)
+	{
+		w.Tf  (rb->Owner()->Transform()->Value());
+		w.Vec (rb->m_Velocity);
+		w.Vec (rb->m_AngularVelocity);
+		w.Vec (rb->m_ForceAccum);
+		w.Vec (rb->m_TorqueAccum);
+		w.Vec (rb->m_CenterOfMassPositionWorld);
+		w.Mat (rb->m_InertiaWorldInv);
+		w.Vec (rb->m_PrevPosition);
+		w.Quat(rb->m_PrevRotation);
+		w.Vec (rb->m_KinematicVelocity);
+		w.Vec (rb->m_KinematicAngularVelocity);
+		w.Vec (rb->m_SleepPosition);
+		w.Quat(rb->m_SleepRotation);
+		w.Raw (rb->m_SleepTimer);
+		w.Raw (rb->m_SleepIslandId);
+		w.Raw (uint8_t(rb->m_HasPrevKinematicPose ? 1 : 0));
+		w.Raw (uint8_t(rb->m_IsSleeping ? 1 : 0));
+	}
+
+	// ----- コライダーの姿勢（戻したときに Transform から組み直さなくていいように）-----
+	for (const Collider* c : m_Colliders)
+	{
+		if (!c->Body()) continue;
+		w.Pose(c->m_WorldPose);
+		w.Box (c->m_WorldAABB);
+	}
+
+	// ----- ジョイントの累積インパルス -----
+	for (const auto& j : m_DistanceJoints) w.Raw(j.accumImpulse);
+	for (const auto& j : m_BallJoints)	   w.Vec(j.accumImpulse);
+	for (const auto& j : m_HingeJoints)
+	{
+		w.Vec(j.accumImpulseLinear);
+		w.Vec(j.accImpulseSwing);
+		w.Raw(j.accImpulseTwist);
+		w.Raw(j.accImpulseMotor);
+	}
+
+	// ----- 前ステップのペア集合 -----
+	WriteLiveKeys(w, m_PrevTrigger, isLive);
+	WriteLiveKeys(w, m_PrevCollision, isLive);
+
+	// ----- 接触キャッシュ（キー順）-----
+	for (const ContactCacheEntry& e : m_ContactCache)
+	{
+		if (!isLive(e.key)) continue;
+		w.Raw(e.key);
+		w.Vec(e.normal);
+		w.Raw(int32_t(e.count));
+		w.Raw(e.stamp);
+		for (int i = 0; i < ContactManifold::MAX_POINTS; i++)
+		{
+			w.Vec(e.localPointA[i]);
+			w.Raw(e.accumN[i]);
+			w.Vec(e.accumImpulseT[i]);
 		}
+	}
+	assert(w.p == out.data() + out.size());
+}
+// --------------------------------------------------
+// 復元
+// 形式と構成を先に確かめてから書き込む（途中で失敗して半端な状態にならないように）
+// --------------------------------------------------
+bool PhysicsSystem::RestoreSnapshot(const std::vector<uint8_t>& blob)
+{
+	SyncStep(); // 走っているステップの結果や積んだ操作が、戻した後に上書きしないように
+	if (blob.size() < sizeof(SnapshotHeader)) return false;
+	SnapshotReader r{ blob.data() };
+	SnapshotHeader h;
+	r.Raw(h);
+	if (h.magic != SnapshotMagic || h.version != SnapshotVersion) return false;
+	if (h.bodyCount			 != m_Rigidbodies.size()	 ||
+		h.colliderSlots		 != m_ById.size()			 ||
+		h.distanceJointCount != m_DistanceJoints.size() ||
+		h.ballJointCount	 != m_BallJoints.size()		 ||
+		h.hingeJointCount	 != m_HingeJoints.size()	 ||
+		h.bodyColliderCount	 != CountBodyColliders()) return false;
+	if (blob.size() != SnapshotSize(h)) return false;
+
+	// ----- ボディ -----
+	for (Rigidbody* rb : m_Rigidbodies)
+	{
+		Transform t;
+		r.Tf(t);
+		rb->Owner()->Transform()->SetValue(t);
+		r.Vec (rb->m_Velocity);
+		r.Vec (rb->m_AngularVelocity);
+		r.Vec (rb->m_ForceAccum);
+		r.Vec (rb->m_TorqueAccum);
+		r.Vec (rb->m_CenterOfMassPositionWorld);
+		r.Mat (rb->m_InertiaWorldInv);
+		r.Vec (rb->m_PrevPosition);
+		r.Quat(rb->m_PrevRotation);
+		r.Vec (rb->m_KinematicVelocity);
+		r.Vec (rb->m_KinematicAngularVelocity);
+		r.Vec (rb->m_SleepPosition);
+		r.Quat(rb->m_SleepRotation);
+		r.Raw (rb->m_SleepTimer);
+		r.Raw (rb->m_SleepIslandId);
+		uint8_t hasPrev = 0, sleeping = 0;
+		r.Raw(hasPrev);
+		r.Raw(sleeping);
+		rb->m_HasPrevKinematicPose = hasPrev != 0;
+		rb->m_IsSleeping		   = sleeping != 0;
+	}
+
+	// ----- コライダーの姿勢と木 -----
+	// 保存した WorldPose をそのまま戻す（ボディの無いものは戻していない）
+	for (Collider* c : m_Colliders)
+	{
+		if (!c->Body()) continue;
+		r.Pose(c->m_WorldPose);
+		r.Box (c->m_WorldAABB);
+		if (m_BroadSetOf[c->Id()] == BroadSet::Static) m_ShapeRecords[c->Id()].pose = c->m_WorldPose; // 静的なものはナロー用の姿勢を毎ステップは写さないので
+		m_WorldAABBs.Set(c->Id(), c->m_WorldAABB);
+		m_BroadPhase.MoveProxy(c->m_ProxyId, c->m_WorldAABB);
+	}
+
+	// ----- ジョイントの累積インパルス -----
+	for (auto& j : m_DistanceJoints) r.Raw(j.accumImpulse);
+	for (auto& j : m_BallJoints)	 r.Vec(j.accumImpulse);
+	for (auto& j : m_HingeJoints)
+	{
+		r.Vec(j.accumImpulseLinear);
+		r.Vec(j.accImpulseSwing);
+		r.Raw(j.accImpulseTwist);
+		r.Raw(j.accImpulseMotor);
+	}
+
+	// ----- 前ステップのペア集合 -----
+	auto readKeys = [&](std::vector<uint64_t>& keys, uint32_t count)
+		{
+			keys.resize(count);
+			for (uint32_t i = 0; i < count; i++) r.Raw(keys[i]);
+		};
+	readKeys(m_PrevTrigger, h.triggerPairCount);
+	readKeys(m_PrevCollision, h.collisionPairCount);
+	BuildCollisionPartners();
+
+	// ----- 接触キャッシュ（キー順で書いてある）-----
+	m_ContactCache.resize(h.contactCount);
+	for (ContactCacheEntry& e : m_ContactCache)
+	{
+		int32_t count;
+		r.Raw(e.key);
+		r.Vec(e.normal);
+		r.Raw(count);
+		r.Raw(e.stamp);
+		e.count = count;
+		for (int i = 0; i < ContactManifold::MAX_POINTS; i++)
+		{
+			r.Vec(e.localPointA[i]);
+			r.Raw(e.accumN[i]);
+			r.Vec(e.accumImpulseT[i]);
 		}
 	}
+	assert(r.p == blob.data() + blob.size());
+	m_StepStamp	   = h.stepStamp;
+	m_NextIslandId = h.nextIslandId;
+
+	// ----- 眠っているアイランド -----
+	// 眠らせたときと同じく m_Rigidbodies の順でメンバーを並べる
+	// Transform を書き戻したときに積まれた起こす候補は捨てて、眠っているものに見張りを付け直す
+	m_SleepingIslands.clear();
+	m_WakeRequests.clear();
+	m_NewSleepers.clear();
+	for (Rigidbody* rb : m_Rigidbodies)
+	{
+		StopWatching(rb);
+		rb->m_WakeRequested = false;
+		if (rb->m_SleepIslandId == 0) continue;
+		m_SleepingIslands[rb->m_SleepIslandId].push_back(rb);
+		m_NewSleepers.push_back(rb);
+	}
+	WatchNewSleepers();
+
+	m_CurrTrigger.clear();
+	m_CurrCollision.clear();
+	m_Contacts.clear();
+	return true;
 }
@@ -1,232 +1,407 @@
 /*
 	PhysicsSystem.h
 	20250821  hanaue sho
-	Z
+	物理演算
 */
 #ifndef PHYSICSSYSTEM_H_
 #define PHYSICSSYSTEM_H_
 #include <vector>
-#include <unordered_set>
+#include <unordered_map>
 #include <algorithm>
 #include <utility>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 #include "ContactManifold.h"
 #include "Matrix4x4.h"
+#include "Quaternion.h"
+#include "DynamicAABBTree.h"
+#include "WorkerPool.h"
+#include "SolverBody.h"
+#include "ShapeDispatch.h"
+#include "SimdKernels.h"
+#include "PhysicsStats.h"
 
 class Scene;
 class Collider;
 class Rigidbody;
+class Component;
 class DistanceJointComponent;
 class BallJointComponent;
 class HingeJointComponent;
 class TransformComponent;
 class DebugRenderer;
+struct SupportShape;
 
 // ==================================================
-// ----- \ -----
+// ----- 構造体 -----
 // ==================================================
 // --------------------------------------------------
-// ڐG_̍\
+// 接触点の構造体
 // --------------------------------------------------
 struct Contact
 {
 	Collider* A;
 	Collider* B;
 	ContactManifold m;
+	int bodyA = 0, bodyB = 0; // ソルバーボディの番号
+	int island = -1;		  // ソルバーアイランドの番号（-1 は動かせるボディが無い）
+	float frictionStatic  = 0.0f; // 混ぜた摩擦係数（PreSolve で計算）
+	float frictionDynamic = 0.0f;
+	float accumPseudo[ContactManifold::MAX_POINTS] = {}; // 擬似速度の累積インパルス（ステップ内だけ）
 };
 // --------------------------------------------------
-// WCg֌W̍\
+// 接触キャッシュ（ウォームスタート用）
+// 前ステップの累積インパルスを A のローカル接触点と一緒に持ち越す
+// --------------------------------------------------
+struct ContactCacheEntry
+{
+	uint64_t key = 0; // ペアキー
+	Vector3 normal{}; // A→B
+	int count = 0;
+	Vector3 localPointA[ContactManifold::MAX_POINTS];	// A のローカルでの接触点（中点）
+	float	accumN[ContactManifold::MAX_POINTS] = {};		// 法線の累積インパルス
+	Vector3 accumImpulseT[ContactManifold::MAX_POINTS]; // 接線の累積インパルス（ワールド）
+	uint32_t stamp = 0; // 最後に更新したステップ
+};
+// --------------------------------------------------
+// ジョイント関係の構造体
 // --------------------------------------------------
 struct DistanceJoint
 {
-	// DistanceJointComponent ̏
+	// DistanceJointComponent の情報
 	int jointId = -1;
-	Rigidbody* pBodyA = nullptr; // g Rigidbody
-	Rigidbody* pBodyB = nullptr; //  Rigidbody
-	TransformComponent* tfA = nullptr; // gTransform
-	TransformComponent* tfB = nullptr; // Transform
+	Rigidbody* pBodyA = nullptr; // 自身の Rigidbody
+	Rigidbody* pBodyB = nullptr; // 相方の Rigidbody
+	int bodyA = 0, bodyB = 0;	 // ソルバーボディの番号（ステップごとに振り直す）
+	int island = -1;			 // ソルバーアイランドの番号（ステップごとに振り直す）
+	TransformComponent* tfA = nullptr; // 自身のTransform
+	TransformComponent* tfB = nullptr; // 相方のTransform
 
 	Vector3 localAnchorA = Vector3(0.0f, 0.0f, 0.0f);
 	Vector3 localAnchorB = Vector3(0.0f, 0.0f, 0.0f);
 	float restLength = 0.0f;
 	int mode = 0;
 
-	// \op̃LbV
-	Vector3 rAworld = Vector3(0.0f, 0.0f, 0.0f); // COM AJ[܂ł̃xNg
+	// ソルバ用のキャッシュ
+	Vector3 rAworld = Vector3(0.0f, 0.0f, 0.0f); // COM からアンカーまでのベクトル
 	Vector3 rBworld = Vector3(0.0f, 0.0f, 0.0f);
-	Vector3 normal  = Vector3(0.0f, 0.0f, 0.0f); // anchorA  anchorB
+	Vector3 normal  = Vector3(0.0f, 0.0f, 0.0f); // anchorA → anchorB
 	float effectiveMass = 0.0f;
 	float bias			= 0.0f;
-	float accumImpulse	= 0.0f; // ݐσCpX
+	float accumImpulse	= 0.0f; // 累積インパルス
 };
 struct BallJoint
 {
-	// BallJointComponent ̏
+	// BallJointComponent の情報
 	int jointId = -1;
-	Rigidbody* pBodyA = nullptr; // g Rigidbody
-	Rigidbody* pBodyB = nullptr; //  Rigidbody
-	TransformComponent* tfA = nullptr; // gTransform
-	TransformComponent* tfB = nullptr; // Transform
+	Rigidbody* pBodyA = nullptr; // 自身の Rigidbody
+	Rigidbody* pBodyB = nullptr; // 相方の Rigidbody
+	int bodyA = 0, bodyB = 0;	 // ソルバーボディの番号（ステップごとに振り直す）
+	int island = -1;			 // ソルバーアイランドの番号（ステップごとに振り直す）
+	TransformComponent* tfA = nullptr; // 自身のTransform
+	TransformComponent* tfB = nullptr; // 相方のTransform
 
 	Vector3 localAnchorA = Vector3(0.0f, 0.0f, 0.0f);
 	Vector3 localAnchorB = Vector3(0.0f, 0.0f, 0.0f);
 
-	// \op̃LbV
-	Vector3 rAworld = Vector3(0.0f, 0.0f, 0.0f); // COM AJ[܂ł̃xNg
+	// ソルバ用のキャッシュ
+	Vector3 rAworld = Vector3(0.0f, 0.0f, 0.0f); // COM からアンカーまでのベクトル
 	Vector3 rBworld = Vector3(0.0f, 0.0f, 0.0f);
 
-	// R̗LʁAoCAXAݐσCpX
+	// ３軸分の有効質量、バイアス、累積インパルス
 	Vector3 effectiveMass;
 	Vector3 bias;
-	Vector3 accumImpulse; // ݐσCpX
+	Vector3 accumImpulse; // 累積インパルス
 };
 struct HingeJoint
 {
-	// HingeJointComponent ̏
+	// HingeJointComponent の情報
 	int jointId = -1;
-	Rigidbody* pBodyA = nullptr; // g Rigidbody
-	Rigidbody* pBodyB = nullptr; //  Rigidbody
-	TransformComponent* tfA = nullptr; // gTransform
-	TransformComponent* tfB = nullptr; // Transform
-
-	// AJ[ 
+	Rigidbody* pBodyA = nullptr; // 自身の Rigidbody
+	Rigidbody* pBodyB = nullptr; // 相方の Rigidbody
+	int bodyA = 0, bodyB = 0;	 // ソルバーボディの番号（ステップごとに振り直す）
+	int island = -1;			 // ソルバーアイランドの番号（ステップごとに振り直す）
+	TransformComponent* tfA = nullptr; // 自身のTransform
+	TransformComponent* tfB = nullptr; // 相方のTransform
+
+	// アンカー 
 	Vector3 localAnchorA = Vector3(0.0f, 0.0f, 0.0f);
 	Vector3 localAnchorB = Vector3(0.0f, 0.0f, 0.0f);
 
-	// \op̃LbV
-	Vector3 rAworld = Vector3(0.0f, 0.0f, 0.0f); // COM AJ[܂ł̃xNg
+	// ソルバ用のキャッシュ
+	Vector3 rAworld = Vector3(0.0f, 0.0f, 0.0f); // COM からアンカーまでのベクトル
 	Vector3 rBworld = Vector3(0.0f, 0.0f, 0.0f);
 
-	// R̗LʁAoCAXAݐσCpX
+	// ３軸分の有効質量、バイアス、累積インパルス
 	Vector3 effectiveMassLinear;
 	Vector3 biasLinear;
-	Vector3 accumImpulseLinear; // ݐσCpX
+	Vector3 accumImpulseLinear; // 累積インパルス
 
-	// 킹~bgp
-	Vector3 swingAxis[2]{}; // qWɒ
+	// 軸合わせ＆リミット用
+	Vector3 swingAxis[2]{}; // ヒンジ軸に直交する基底
 	Matrix4x4 swingMass;
 	Vector3 biasSwing; // (bias1, bias2, 0)
-	Vector3 accImpulseSwing; // ݐσCpX (1, 2, 0)
-	Vector3 swingDiff; // swing 덷 (C1, C2, 0)
+	Vector3 accImpulseSwing; // 累積インパルス (λ1, λ2, 0)
+	Vector3 swingDiff; // swing 誤差 (C1, C2, 0)
 
-	// ̉]icCXgjA[^[p
+	// 軸周りの回転（ツイスト）制限、モーター用
 	float effMassTwist    = 0.0f;
 	float biasTwist		  = 0.0f;
 	float accImpulseTwist = 0.0f;
 
-	// qWEi[Jj
-	Vector3 localAxisA = Vector3(1.0f, 0.0f, 0.0f); // qW
-	Vector3 localAxisB = Vector3(1.0f, 0.0f, 0.0f); // qW
-	Vector3 localRefA = Vector3(1.0f, 0.0f, 0.0f); // Ox̌
-	Vector3 localRefB = Vector3(1.0f, 0.0f, 0.0f); // B̂Ox̌
+	// ヒンジ軸・基準方向（ローカル）
+	Vector3 localAxisA = Vector3(1.0f, 0.0f, 0.0f); // ヒンジ軸
+	Vector3 localAxisB = Vector3(1.0f, 0.0f, 0.0f); // ヒンジ軸
+	Vector3 localRefA = Vector3(1.0f, 0.0f, 0.0f); // ０度の向き
+	Vector3 localRefB = Vector3(1.0f, 0.0f, 0.0f); // B側の０度の向き
 
-	// [hɕϊ
+	// ワールドに変換したもの
 	Vector3 axisWorld = Vector3(1.0f, 0.0f, 0.0f);
-	Vector3 refAWorld = Vector3(1.0f, 0.0f, 0.0f); // ÂO̕
-	Vector3 refBWorld = Vector3(1.0f, 0.0f, 0.0f); // B̂O̕
+	Vector3 refAWorld = Vector3(1.0f, 0.0f, 0.0f); // Aの０の方向
+	Vector3 refBWorld = Vector3(1.0f, 0.0f, 0.0f); // Bの０の方向
 
-	// ~bg
+	// リミット
 	bool enableLimit = false;
 	float limitMin = 0.0f;
 	float limitMax = 0.0f;
 	
-	// [^[
+	// モーター
 	bool enableMotor = false;
 	float motorSpeed = 0.0f;
 	float maxMotorTorque = 0.0f;
 	float accImpulseMotor = 0.0f;
 
-	// ol
+	// バネ
 	bool enableSpring	= false;
-	float springTarget	= 0.0f; // ڕWpx
+	float springTarget	= 0.0f; // 目標角度
 	float springDamping = 0.0f;
-	float springDiff	= 0.0f; // angle - target LbV
+	float springDiff	= 0.0f; // angle - target をキャッシュ
+};
+// --------------------------------------------------
+// 並列ソルバーのバッチに詰める拘束
+// type で m_Contacts / 各ジョイント配列のどれかを指す
+// --------------------------------------------------
+struct SolverConstraint
+{
+	enum class Type : uint8_t { Contact, Distance, Ball, Hinge };
+	Type type = Type::Contact;
+	int	 index = -1;
+	int	 island = -1;
+};
+// --------------------------------------------------
+// ソルバーアイランド
+// 接触とジョイントで繋がった、動かせるボディのまとまり
+// 反復回数はアイランドごと、インパルスの変化が小さくなったアイランドから解くのをやめる
+// --------------------------------------------------
+struct SolverIsland
+{
+	int velocityIterations = 0;
+	int positionIterations = 0;
+	bool active = true; // まだ解くか（速度、めり込み解消の反復の前に立て直す）
+};
+// --------------------------------------------------
+// 連続衝突判定（CCD）を行うボディ
+// 速度積分前の COM を覚えておき、積分後に移動経路を調べる
+// --------------------------------------------------
+struct ContinuousBody
+{
+	Rigidbody* rb = nullptr;
+	Vector3 startCOM{};
 };
 // --------------------------------------------------
-// Query p̍\
+// パイプライン実行中に溜めた Rigidbody の操作
+// ステップが走っている間に本体スレッドから呼ばれたものを、SyncStep で呼ばれた順に反映する
+// --------------------------------------------------
+struct BodyCommand
+{
+	enum class Type : uint8_t
+	{
+		AddForce, AddTorque, AddForceAtPoint,
+		ApplyImpulse, ApplyImpulseAtPoint,
+		SetVelocity, SetAngularVelocity,
+		WakeUp, SetBodyType,
+		SetMass, SetRestitution, SetFrictionDynamic, SetFrictionStatic, SetLinDamping, SetAngDamping,
+		SetGravityMode, SetGravityScale, SetCustomGravity,
+		SetCanSleep, SetContinuousCollision, SetSolverIterations,
+	};
+	Rigidbody* rb = nullptr;
+	Type type = Type::AddForce;
+	Vector3 a{}, b{};	 // 力やインパルスと、加える点（SetCustomGravity は a）
+	int value = 0;		 // SetBodyType、SetGravityMode の種類、on / off、速度の反復回数
+	int value2 = 0;		 // 位置の反復回数
+	float scalar = 0.0f; // 質量、反発係数、摩擦、減衰、重力の倍率
+};
+// --------------------------------------------------
+// Query 用の構造体
 // --------------------------------------------------
 struct QueryOptions
 {
 	bool isSimulate = true;
 	bool isTrigger  = false;
 	bool isQueryOnly = false;
-	float slop = 0.0f; // isOverlap  slop
+	float slop = 0.0f; // isOverlap の slop
+	uint32_t layerMask = 0xffffffffu; // 当てる相手のレイヤー（ビット）
 };
 struct QueryHit
 {
-	Collider* other = nullptr; // 
-	Vector3 normal{};		   // A -> BiA=j
-	float penetration = 0.0f;  // ߂荞ݗ
-	Vector3 mtd{};			   // oxNg
+	Collider* other = nullptr; // 当たった相手
+	Vector3 normal{};		   // A -> B（A=自分）
+	float penetration = 0.0f;  // めり込み量
+	Vector3 mtd{};			   // 自分を押し出すベクトル
 	ContactManifold manifold{};
 };
+struct CastHit
+{
+	Collider* other = nullptr; // 当たった相手
+	float fraction = 1.0f;	   // delta の何割動いたところで当たったか [0, 1]
+	float distance = 0.0f;	   // 当たるまでに動ける距離
+	Vector3 normal{};		   // 相手の面の法線（自分の方を向く）
+	Vector3 point{};		   // 接触点（相手の表面）
+};
+struct Ray
+{
+	Vector3 origin{};
+	Vector3 direction{};	   // 正規化済み
+	float maxDistance = 0.0f;
+};
+struct RaycastHit
+{
+	Collider* other = nullptr; // 当たった相手（外れなら nullptr）
+	float distance = 0.0f;	   // 始点からの距離
+	Vector3 point{};		   // 当たった点
+	Vector3 normal{};		   // 相手の面の法線（始点側を向く）
+};
 
 // ==================================================
-// ----- NX{ -----
+// ----- クラス本体 -----
 // ==================================================
 class PhysicsSystem
 {
 private:
 	// ==================================================
-	// ----- vf -----
+	// ----- 要素 -----
 	// ==================================================
 	// --------------------------------------------------
-	// eV[
+	// 親シーン
     // --------------------------------------------------
-	Scene* m_pScene = nullptr; // ݂̃V[
+	Scene* m_pScene = nullptr; // 現在のシーン
 	
 	// --------------------------------------------------
-	// o^RC_[A{fB
+	// 登録コライダー、ボディ
     // --------------------------------------------------
-	std::vector<Collider*>  m_Colliders;   // o^ Collider Ǘz
-	std::vector<Rigidbody*> m_Rigidbodies; // o^ Rigidbody Ǘz
+	std::vector<Collider*>  m_Colliders;   // 登録した Collider を管理する配列
+	std::vector<int>		m_ColliderSlot; // id → m_Colliders の添字（解除で末尾と入れ替えるため）
+	std::vector<Rigidbody*> m_Rigidbodies; // 登録した Rigidbody を管理する配列
 
 	// --------------------------------------------------
-	// o^WCg
+	// 登録ジョイント
 	// --------------------------------------------------
 	std::vector<DistanceJoint> m_DistanceJoints;
 	int m_DistanceJointNextId = 0;
 	std::vector<int> m_FreeDistanceJointIds;
-	std::vector<DistanceJointComponent*> m_DistanceJointById; //id  Joint* itpj
+	std::vector<DistanceJointComponent*> m_DistanceJointById; //id → Joint* （逆引き用）
 
 	std::vector<BallJoint> m_BallJoints;
 	int m_BallJointNextId = 0;
 	std::vector<int> m_FreeBallJointIds;
-	std::vector<BallJointComponent*> m_BallJointById; //id  Joint* itpj
+	std::vector<BallJointComponent*> m_BallJointById; //id → Joint* （逆引き用）
 
 	std::vector<HingeJoint> m_HingeJoints;
 	int m_HingeJointNextId = 0;
 	std::vector<int> m_FreeHingeJointIds;
-	std::vector<HingeJointComponent*> m_HingeJointById; //id  Joint* itpj
+	std::vector<HingeJointComponent*> m_HingeJointById; //id → Joint* （逆引き用）
 
 	// --------------------------------------------------
-	// RC_[p̔ 
+	// コライダー用採番 
     // --------------------------------------------------
 	int m_NextId = 0;
-	std::vector<int> m_FreeIds;	   // ID̍ėp
-	std::vector<Collider*> m_ById; //id  collider* itpj
+	std::vector<int> m_FreeIds;	   // 解放IDの再利用
+	std::vector<Collider*> m_ById; //id → collider* （逆引き用）
+	std::vector<int> m_RetiredIds; // 解除したがペア集合にまだ残っている ID（次のステップの始めに掃除してから m_FreeIds へ）
+
+	// --------------------------------------------------
+	// ブロードフェーズ（動的 AABB 木）
+	// --------------------------------------------------
+	DynamicAABBTree m_BroadPhase;
+
+	// 区分ごとのコライダー
+	// 静的（ボディ無し or Static で、トリガー・クエリ以外）は木を引かず、AABB や姿勢も毎ステップは更新しない
+	// トリガーは別の区分にして、トリガーが絡むペアは重なりだけの判定に回す（m_TriggerPairs）
+	// 区分は登録や BodyType / Mode の変化があったときだけ振り分け直す（MarkBroadphaseDirty）
+	// 静的なものは Transform を見張っておいて、動かされたら次の BeginStep で姿勢と木を合わせる（m_MovedStatics）
+	enum class BroadSet : uint8_t { Static, Kinematic, Dynamic, Trigger, None };
+	std::vector<Collider*> m_StaticColliders;
+	std::vector<Collider*> m_KinematicColliders; // Kinematic のボディ、クエリ
+	std::vector<Collider*> m_DynamicColliders;
+	std::vector<Collider*> m_TriggerColliders;	 // トリガー（ボディの種類は問わない）
+	std::vector<Collider*> m_MovingColliders;	 // Kinematic、Dynamic、トリガーの順に繋いだもの（毎ステップ更新するもの）
+	std::vector<AABB>	   m_MovingProxyAABBs;	 // m_MovingColliders と同じ並びの木に入れる AABB（作業用）
+	std::vector<BroadSet>  m_BroadSetOf;		   // id → 区分（None はまだ振り分けていない）
+	std::vector<Collider*> m_MovedStatics;		   // Transform を動かされた静的コライダー（Collider::OnTransformMoved から積まれる）
+	bool m_BroadSetsDirty  = true;
+	int  m_StaticPairCount = 0; // 静的同士で重なっている組（木を引かないので毎ステップ省けている判定）
+	std::vector<uint64_t> m_CandidatePairs; // ナローに回すペア候補（毎ステップ使い回す）
+	std::vector<uint64_t> m_TriggerPairs;	// トリガーが絡むペア候補（接触点は作らずに重なりだけ見る）
+	AABBSoA			 m_WorldAABBs;		  // コライダー ID ごとの WorldAABB（BeginStep で写す）
+	std::vector<int> m_BroadCandidates;	  // 木から引いた相手（実際の AABB で絞る前）
+	std::vector<int> m_BroadHits;
+	std::vector<Collider*> m_BroadSleepers; // 眠っていて木を引かなかったもの（途中で起こしたら引き直す）
+	std::vector<uint8_t>   m_BroadWoken;	// id → このステップで起こしたか（作業用）
+
+	// --------------------------------------------------
+	// ナローフェーズ
+	// m_ShapeRecords はコライダー ID ごとの形状レコード（姿勢はステップの始めに写す）
+	// m_NarrowPairs は候補ペアを形状の組ごとに並べ直したもの
+	// m_NarrowBatchStart[k] ～ m_NarrowBatchStart[k + 1] が組 k（ShapeDispatch::PairIndex）のペア
+	// --------------------------------------------------
+	std::vector<ShapeRecord> m_ShapeRecords;
+	std::vector<uint64_t>	 m_NarrowPairs;
+	int m_NarrowBatchStart[ShapeDispatch::TypeCount * ShapeDispatch::TypeCount + 1] = {};
+	// 球 × 球の組は SIMD でまとめて判定する（作業用）
+	std::vector<int>			 m_SphereIdA, m_SphereIdB;
+	std::vector<ContactManifold> m_SphereManifolds;
+	std::vector<uint8_t>		 m_SphereHits;
+	// スレッドごとの判定結果（ペアを区切った順に繋ぐ、毎ステップ使い回す）
+	struct NarrowBuffer
+	{
+		std::vector<uint64_t> triggers;
+		std::vector<uint64_t> collisions;
+		std::vector<Contact>  contacts;
+		int calls[ShapeDispatch::TypeCount * ShapeDispatch::TypeCount] = {};
+	};
+	std::vector<NarrowBuffer> m_NarrowBuffers;
 
 	// ==================================================
-	// ----- wp -----
+	// ----- 小ヘルパ -----
 	// ==================================================
 	// --------------------------------------------------
-	// yAW
+	// ペア集合
     // --------------------------------------------------
 	uint64_t MakePairKey(uint32_t a, uint32_t b) noexcept
 	{
-		if (b < a) std::swap(a, b); // 𐳋K
-		return (uint64_t(a) << 32) | uint64_t(b); // 64bit ̒ɁAʃrbgA傫ʃrbgƂċl߂
+		if (b < a) std::swap(a, b); // 順序を正規化
+		return (uint64_t(a) << 32) | uint64_t(b); // 64bit の中に、小さい方を上位ビット、大きい方を下位ビットとして詰める
 	}
-	static inline int KeyHigh(uint64_t k) { return int(uint32_t(k >> 32)); } // ʃrbg int ɕϊ
-	static inline int KeyLow (uint64_t k) { return int(uint32_t(k & 0xffffffffu)); } // ʃrbg int ɕϊ
+	static inline int KeyHigh(uint64_t k) { return int(uint32_t(k >> 32)); } // 上位ビットを int に変換
+	static inline int KeyLow (uint64_t k) { return int(uint32_t(k & 0xffffffffu)); } // 下位ビットを int に変換
 
 	// --------------------------------------------------
-	// PXebvOƌ݂̏Փ˃yA
+	// １ステップ前と現在の衝突ペア
+	// キー順に並べた配列で持ち、Enter / Stay / Exit はマージで差分を取る
+	// 解除したコライダーのペアはすぐには消さず、差分や次のステップの始めに読み飛ばす
 	// --------------------------------------------------
-	std::unordered_set<uint64_t> m_PrevTrigger,   m_CurrTrigger;
-	std::unordered_set<uint64_t> m_PrevCollision, m_CurrCollision;
+	std::vector<uint64_t> m_PrevTrigger,   m_CurrTrigger;
+	std::vector<uint64_t> m_PrevCollision, m_CurrCollision;
+
+	// 前ステップの衝突相手（id ごと、m_PrevCollision から作る）
+	// m_CollisionPartners[m_CollisionPartnerStart[id] ～ m_CollisionPartnerStart[id + 1]] が id の相手
+	std::vector<int> m_CollisionPartnerStart;
+	std::vector<int> m_CollisionPartners;
 
 	// --------------------------------------------------
-	// ΃L[
+	// 発火キュー
     // --------------------------------------------------
 	std::vector<std::pair<Collider*, Collider*>> m_TriggerEnter;
 	std::vector<std::pair<Collider*, Collider*>> m_TriggerStay;
@@ -235,41 +410,161 @@ private:
 	std::vector<std::pair<Collider*, Collider*>> m_CollisionStay;
 	std::vector<std::pair<Collider*, Collider*>> m_CollisionExit;
 
+	// 配信する呼び出し（キューから受け手の分だけ積んで、最後にまとめて呼ぶ、毎ステップ使い回す）
+	// 呼んでいる途中で AddComponent されても受け手の配列を辿らずに済む
+	struct EventCall
+	{
+		Component* component;
+		Collider*  me;
+		Collider*  other;
+		uint8_t	   event; // PhysicsEvent
+	};
+	std::vector<EventCall> m_EventCalls;
+
 	// --------------------------------------------------
-	// Xebv̏Փ˓_̃Rei
+	// 今ステップの衝突点のコンテナ
     // --------------------------------------------------
 	std::vector<Contact> m_Contacts; 
 
 	// --------------------------------------------------
-	// RW}XN
+	// 接触キャッシュ（前ステップの接触、キー順）
+	// 毎ステップ今ステップの接触から作り直すので、並べた配列を二分探索で引く
+	// スナップショットもこの並びのまま書く
+	// --------------------------------------------------
+	std::vector<ContactCacheEntry> m_ContactCache;
+	std::vector<std::pair<uint64_t, int>> m_ContactCacheOrder; // 作り直すときの並べ替え用（キー、m_Contacts の番号）
+	uint32_t m_StepStamp = 0;
+
+	// --------------------------------------------------
+	// ソルバの反復回数
+	// 速度は１反復でのインパルスの変化が m_VelocityTolerance を下回ったら打ち切る
+	// 位置（めり込み解消の擬似速度）も同じ閾値で打ち切る
+	// --------------------------------------------------
+	int	  m_VelocityIterations = 8; // 箱の塔（８段まで）は３で立つが、20 段の BoxPyramid は６、BoxPile は８要る
+	int	  m_PositionIterations = 4;
+	float m_VelocityTolerance  = 1e-4f; // [N・s]、０で打ち切らない
+	bool  m_EnableBlockSolver  = true;	// 複数点の接触の法線をまとめて解く
+	bool  m_EnableWarmStart	   = true;	// 前ステップの累積インパルスから始める
+
+	// --------------------------------------------------
+	// ソルバーアイランド（ステップ内の作業用）
+	// m_SolverIslandOf はソルバーボディ → アイランド（動かせないボディは -1）
+	// m_SolverIslandDelta はスレッド×アイランドの、今の反復での最大インパルス変化
+	// --------------------------------------------------
+	std::vector<SolverIsland> m_SolverIslands;
+	std::vector<int>		  m_SolverIslandOf;
+	std::vector<float>		  m_SolverIslandDelta;
+	int m_MaxVelocityIterations = 0; // アイランドの中で一番多い反復回数
+	int m_MaxPositionIterations = 0;
+
+	// --------------------------------------------------
+	// ソルバーボディ
+	// 反復中は Rigidbody ではなくこちらの速度を読み書きする
+	// --------------------------------------------------
+	SolverBodySet m_SolverBodies;
+
+	// --------------------------------------------------
+	// 並列ソルバー
+	// 同じ Dynamic を触らない拘束同士を同じ色（バッチ）に塗り分けて、バッチ内を並列に解く
+	// m_SolverBatchStart[b] ～ m_SolverBatchStart[b + 1] が b 番目のバッチ
+	// --------------------------------------------------
+	WorkerPool m_WorkerPool;
+	std::vector<SolverConstraint> m_SolverConstraints;
+	std::vector<int>			  m_SolverBatchStart;
+	std::vector<std::vector<SolverConstraint>> m_SolverColors; // 色ごとの作業用
+	std::vector<uint64_t>		  m_SolverBodyColors;		   // ボディごとの使用済み色（ビット）
+
+	// --------------------------------------------------
+	// アイランド、スリープ
+	// m_IslandBodies / m_IslandParent はステップ内の作業用（union-find）
+	// m_SleepingIslands は眠っているアイランド（ID → 所属ボディ）
+	// m_WakeRequests は眠っている間に触られたボディ（Rigidbody の WakeUp、速度、BodyType の書き込みと Transform の見張りから積まれる）
+	// m_NewSleepers はこのステップで眠ったボディ（FinishStep で Transform の見張りを付ける）
+	// --------------------------------------------------
+	std::vector<Rigidbody*> m_IslandBodies;
+	std::vector<int>		m_IslandParent;
+	std::vector<float>		m_IslandMinTimer;
+	std::unordered_map<uint32_t, std::vector<Rigidbody*>> m_SleepingIslands;
+	std::vector<Rigidbody*> m_WakeRequests;
+	std::vector<Rigidbody*> m_NewSleepers;
+	uint32_t m_NextIslandId = 1;
+	bool m_EnableSleep = true;
+
+	// --------------------------------------------------
+	// 連続衝突判定（CCD）
+	// ステップ内の作業用
+	// --------------------------------------------------
+	std::vector<ContinuousBody> m_ContinuousBodies;
+	std::vector<Collider*>		m_ContinuousColliders;
+
+	// --------------------------------------------------
+	// コリジョンマスク
 	// --------------------------------------------------
 	static constexpr int MaxLayers = 32;
 	uint32_t m_CollisionMask[MaxLayers] = {};
+
+	// --------------------------------------------------
+	// 計測
+	// m_Stats は今のステップ、EndStep の最後に m_LastStats と履歴へ写す
+	// --------------------------------------------------
+	PhysicsStepStats	m_Stats;
+	PhysicsStepStats	m_LastStats;
+	PhysicsStatsHistory m_StatsHistory;
+	std::chrono::steady_clock::time_point m_StepStart;
+	std::chrono::steady_clock::time_point m_PhaseStart;
+	uint32_t m_StatsStep = 0;
+
+	// --------------------------------------------------
+	// パイプライン実行
+	// m_StepInFlight は KickStep から SyncStep まで（本体スレッドだけが書く）
+	// m_StepRunning は物理スレッドが Step を回している間（m_StepMutex で守る）
+	// m_UseStepPoses の間は、物理スレッドが Transform ではなく Rigidbody の m_Step～ の姿勢を読み書きする
+	// --------------------------------------------------
+	bool  m_Pipelined	 = false;
+	bool  m_StepInFlight = false;
+	bool  m_UseStepPoses = false;
+	float m_StepDt		 = 0.0f;
+	std::thread		m_StepThread;
+	std::thread::id m_MainThreadId;
+	std::mutex		m_StepMutex;
+	std::condition_variable m_StepWake; // 物理スレッドを起こす
+	std::condition_variable m_StepDone; // 本体スレッドへ終わりを知らせる
+	bool m_StepRunning	  = false;
+	bool m_StepThreadStop = false;
+	std::chrono::steady_clock::time_point m_StepAsyncEnd; // 物理スレッドが終わった時刻（待っていた時間を計測から外す）
+	std::vector<BodyCommand> m_BodyCommands;
+	std::vector<Collider*>	 m_PendingColliders;   // 走っている間に登録されたもの（SyncStep で登録する）
+	std::vector<Rigidbody*>	 m_PendingRigidbodies;
 public:
 	// ==================================================
-	// ----- RXgN^ -----
+	// ----- コンストラクタ -----
 	// ==================================================
 	PhysicsSystem(Scene& scene) : m_pScene(&scene) {}
-	~PhysicsSystem() = default;
+	~PhysicsSystem() { StopStepThread(); }
 
 	// ==================================================
-	// ----- CtTCN -----
+	// ----- ライフサイクル -----
 	// ==================================================
 	// --------------------------------------------------
-	// AI
+	// 初期化、終了処理
 	// --------------------------------------------------
 	void Init();
 	void Shutdown();
 	// --------------------------------------------------
-	// C[}XN
+	// レイヤーマスク
 	// --------------------------------------------------
 	void SetCollision(int layerA, int layerB, bool enable);
 	bool ShouldCollide(const Collider& a, const Collider& b) const;
 	// --------------------------------------------------
-	// o^A 
+	// 登録、解除 
     // --------------------------------------------------
 	int  RegisterCollider  (Collider* c);
 	void UnregisterCollider(Collider* c);
+	void UpdateShapeRecord (Collider* c); // 形状を差し替えたとき
+	void MarkBroadphaseDirty() { m_BroadSetsDirty = true; } // BodyType や Mode を変えたとき（次のステップの始めに振り分け直す）
+	void RequestWake(Rigidbody* rb) { m_WakeRequests.push_back(rb); } // 眠っている間に触られた（Rigidbody から呼ぶ、次の BeginStep で起こすか決める）
+	void RequestStaticRefresh(Collider* c) { if (m_MovedStatics.empty() || m_MovedStatics.back() != c) m_MovedStatics.push_back(c); } // 静的コライダーの Transform が動かされた（Collider から呼ぶ、次の BeginStep で合わせる）
+	void RefreshStaticCollider(Collider* c);			  // 静的コライダーの姿勢と木を今の Transform に合わせる（Transform を動かしたなら次の BeginStep で自動で呼ばれる）
 	void RegisterRigidbody  (Rigidbody* rb);
 	void UnregisterRigidbody(Rigidbody* rb);
 	int  RegisterDistanceJoint  (DistanceJointComponent* joint);
@@ -279,82 +574,233 @@ public:
 	int  RegisterHingeJoint  (HingeJointComponent* joint);
 	void UnregisterHingeJoint(HingeJointComponent* joint);
 	// --------------------------------------------------
-	// Xebv
+	// ステップ
     // --------------------------------------------------
 	void BeginStep(float fixedDt); 
 	void Step(float fixedDt); 
 	void EndStep(float fixedDt);
 
-	void DispatchEvents(); // Trigger, Collision zM
+	void DispatchEvents(); // Trigger, Collision 配信
+
+	// --------------------------------------------------
+	// パイプライン実行
+	// 物理を専用スレッドで１ステップ先行させて、本体スレッドの Update / Draw と重ねる
+	// KickStep: BeginStep の後に、Step と EndStep の積分、CCD、スリープまでを物理スレッドへ渡す
+	// SyncStep: 走っているステップを待って、姿勢を Transform へ書き戻し、イベントを配って、溜めた操作を反映する
+	// 走っている間に本体スレッドから来た Rigidbody の操作（AddForce、SetVelocity、質量や摩擦などの設定）と、コライダー、剛体の登録は溜めておく
+	// 走っている間に本体スレッドが読む Rigidbody の速度、スリープは、KickStep で写した値を返す
+	// 解除、ジョイントの登録、形状の差し替えは、走っているステップを待ってから行う
+	// コライダーのモードなどの設定は FixedUpdate（ステップの区切り）で変える
+	// --------------------------------------------------
+	void SetPipelined(bool enable);
+	bool IsPipelined() const { return m_Pipelined; }
+	bool IsStepInFlight() const { return m_StepInFlight; }
+	bool IsStepInFlightOnMainThread() const { return m_StepInFlight && std::this_thread::get_id() == m_MainThreadId; } // 物理スレッドからは false
+	void KickStep(float fixedDt);
+	void SyncStep();
+	// 走っている間に本体スレッドから呼ばれたら積んで true（Rigidbody から呼ぶ）
+	bool DeferBodyCommand(const BodyCommand& cmd)
+	{
+		if (!IsStepInFlightOnMainThread()) return false;
+		m_BodyCommands.push_back(cmd);
+		return true;
+	}
+
+	// --------------------------------------------------
+	// ソルバ設定
+	// --------------------------------------------------
+	// 反復回数はシーン全体の既定値、Rigidbody::SetSolverIterations でアイランドごとに増やせる
+	void SetVelocityIterations(int count) { m_VelocityIterations = std::max(1, count); }
+	int  VelocityIterations() const { return m_VelocityIterations; }
+	void SetPositionIterations(int count) { m_PositionIterations = std::max(0, count); }
+	int  PositionIterations() const { return m_PositionIterations; }
+	void  SetVelocityTolerance(float impulse) { m_VelocityTolerance = std::max(0.0f, impulse); }
+	float VelocityTolerance() const { return m_VelocityTolerance; }
+	void SetEnableBlockSolver(bool enable) { m_EnableBlockSolver = enable; }
+	bool EnableBlockSolver() const { return m_EnableBlockSolver; }
+	void SetEnableWarmStart(bool enable) { m_EnableWarmStart = enable; } // off は比較用（接触キャッシュは更新し続ける）
+	bool EnableWarmStart() const { return m_EnableWarmStart; }
+	void SetSolverThreadCount(int count) { WaitStep(); m_WorkerPool.Start(count); } // １で逐次（呼び出しスレッド込みの数）
+	int  SolverThreadCount() const { return m_WorkerPool.ThreadCount(); }
+	void SetEnableSleep(bool enable);
+	bool EnableSleep() const { return m_EnableSleep; }
+	int  SleepingIslandCount() const { return (int)m_SleepingIslands.size(); }
+
+	// --------------------------------------------------
+	// スナップショット（巻き戻し、リプレイ用）
+	// ボディの状態、コライダーの姿勢、ジョイントの累積インパルス、ペア集合、接触キャッシュを１つのバイト列に書き出す
+	// 戻せるのは同じ構成（ボディ、コライダー、ジョイントの登録が同じ）のときだけ、違えば false で何も変えない
+	// 戻した後のステップは、保存した時点から進めたときとビット単位で同じになる
+	// 走っているステップ（パイプライン実行）は待って反映してから保存、復元する
+	// --------------------------------------------------
+	void SaveSnapshot(std::vector<uint8_t>& out);
+	bool RestoreSnapshot(const std::vector<uint8_t>& blob);
+
+	// --------------------------------------------------
+	// 計測（フェーズごとの時間と件数）
+	// LastStepStats は最後に終わったステップ、履歴は直近 N ステップ（容量は StatsHistory().SetCapacity で変える）
+	// --------------------------------------------------
+	const PhysicsStepStats&	   LastStepStats() const { return m_LastStats; }
+	const PhysicsStatsHistory& StatsHistory() const { return m_StatsHistory; }
+	PhysicsStatsHistory&	   StatsHistory()		{ return m_StatsHistory; }
 
 	// ==================================================
-	// ----- Query ֌W -----
+	// ----- Query 関係 -----
 	// ==================================================
 	// --------------------------------------------------
-	// Pj܂̈ʒuŏdȂĂ邩ił[PԂj
+	// １）いまの位置で重なっているか（最も深い１件を返す）
     // --------------------------------------------------
 	bool QueryOverlapBest(const Collider* self, QueryHit& outHit, const QueryOptions& opt) const;
 	// --------------------------------------------------
-	// QjMTDiŏoj~ꍇ
+	// ２）MTD（最小押し出し）だけ欲しい場合
 	// --------------------------------------------------
 	bool QueryComputeMTD(const Collider* self, Vector3& outMTD, QueryHit* outHit, const QueryOptions& opt) const;
 	// --------------------------------------------------
-	// Rj^ CapsuleCast: delta ɓƂɍŏɓʒu񕪒TŒT
-	// i͎gĂȂj
+	// ３）形状キャスト: delta 方向に動かしたときに最初に当たる相手
+	// 掃引 AABB で木を引いて、候補ごとに GJK の保守的前進で当たる割合を求める（１回で最も手前の１件）
+	// 最初からめり込んでいる相手は無視するので、押し出しは QueryComputeMTD で行う
+	// 木は BeginStep で更新するので、スクリプトがこのステップで動かした相手は前の位置で当たる
+	// --------------------------------------------------
+	bool SphereCast (const Vector3& center, float radius, const Vector3& delta, CastHit& outHit, const QueryOptions& opt) const;
+	bool CapsuleCast(const Vector3& p0, const Vector3& p1, float radius, const Vector3& delta, CastHit& outHit, const QueryOptions& opt) const;
+	bool BoxCast	(const Vector3& center, const Vector3& halfSize, const Quaternion& rotation, const Vector3& delta, CastHit& outHit, const QueryOptions& opt) const;
+	bool ColliderCast(const Collider* self, const Vector3& delta, CastHit& outHit, const QueryOptions& opt) const; // self の形状と今の姿勢で（self は当たらない）
 	// --------------------------------------------------
-	bool QueryCapsuleCastBinary(const Collider* self, const Vector3& delta, float skinWidth, QueryHit& outHit, const QueryOptions& opt, int binaryIterations = 10) const;
+	// ４）レイキャスト: 最も手前の１件
+	// 木はレイのスラブ判定で辿り、当たるたびに maxDistance を縮めて奥の枝を刈る
+	// 始点が内側にある相手には当たらない
+	// --------------------------------------------------
+	bool Raycast(const Vector3& origin, const Vector3& direction, float maxDistance, RaycastHit& outHit, const QueryOptions& opt) const;
+	// --------------------------------------------------
+	// ５）レイキャストをまとめて（outHits[i] が rays[i] の結果、戻り値は当たった本数）
+	// 木はレイの束で一度だけ辿るので、近いレイが多いほど１本ずつより速い
+	// --------------------------------------------------
+	int RaycastMany(const Ray* rays, int count, RaycastHit* outHits, const QueryOptions& opt) const;
 
 private:
+	// --------------------------------------------------
+	// 形状キャストの本体
+	// --------------------------------------------------
+	bool CastSupportShape(const SupportShape& shape, const Vector3& delta, const Collider* self, CastHit& outHit, const QueryOptions& opt) const;
+
 	// ==================================================
-	// ----- {Z -----
+	// ----- 基本物理演算 -----
 	// ==================================================
 	// --------------------------------------------------
-	// ͔f
+	// 力反映
 	// m_Rigidbodies
     // --------------------------------------------------
 	void IntegrationForce(float dt);
 
 	// --------------------------------------------------
-	// Փ˔ 
+	// 衝突判定 
 	// m_Colliders
     // --------------------------------------------------
 	void DetermineCollision();
 
 	// --------------------------------------------------
-	// Փ˓_̎OvZ
+	// ブロードフェーズの区分
+	// RebuildBroadphaseSets: m_Colliders を区分ごとに振り分ける（新しく静的になったものは今の姿勢に合わせて、Transform に見張りを付ける）
+	// RefreshMovedStatics: Transform を動かされた静的コライダーを今の姿勢に合わせる（同じ GameObject の静的コライダーも一緒に）
+	// WatchStatic / StopWatchingStatic: 静的コライダーの Transform の見張りの付け外し
+	// IsBroadQuerier: 自分から木を引く側か（静的、眠っているもの、クエリは引かない）
+	// QueryBroadPairs: colA の AABB で木を引いて候補ペアを足す（トリガーが絡むペアは m_TriggerPairs へ）
+	// --------------------------------------------------
+	BroadSet ClassifyCollider(const Collider* c) const;
+	void RebuildBroadphaseSets();
+	void RefreshMovedStatics();
+	void WakeCollisionPartners(int id); // 前ステップで id と触れていた相手のアイランドを起こす
+	void WatchStatic(Collider* c);
+	void StopWatchingStatic(Collider* c);
+	void CountStaticPairs();
+	bool IsBroadQuerier(const Collider* c) const;
+	void QueryBroadPairs(Collider* colA, bool woken);
+	template<class F> void ForEachMovingCollider(F f)
+	{
+		for (Collider* c : m_MovingColliders) f(c);
+	}
+
+	// --------------------------------------------------
+	// 衝突ペア集合
+	// PurgeRetiredPairs: 解除した ID のペアを集合と接触キャッシュから落として、ID を再利用に回す
+	// DiffPairs: 並んだ prev / curr をマージして Enter / Exit / Stay を積む（prev と curr を入れ替える）
+	// BuildCollisionPartners: m_PrevCollision から id ごとの相手を作る
+	// --------------------------------------------------
+	void PurgeRetiredPairs();
+	void DiffPairs(std::vector<uint64_t>& prev, std::vector<uint64_t>& curr,
+		std::vector<std::pair<Collider*, Collider*>>& outEnter,
+		std::vector<std::pair<Collider*, Collider*>>& outExit,
+		std::vector<std::pair<Collider*, Collider*>>& outStay);
+	void BuildCollisionPartners();
+	bool IsLivePair(uint64_t key) const { return m_ById[KeyHigh(key)] && m_ById[KeyLow(key)]; }
+	uint32_t CountBodyColliders() const; // スナップショットに姿勢を書くコライダー（ボディ付き）の数
+
+	// --------------------------------------------------
+	// 衝突点の事前計算
 	// m_Contacts
 	// --------------------------------------------------
 	void PreSolveContacts();
 
 	// --------------------------------------------------
-	// x
+	// 接触キャッシュ
+	// WarmStartFromCache: 前ステップの近い接触点から累積インパルスを引き継ぐ
+	// UpdateContactCache: 解き終わった累積インパルスを保存、古いものを捨てる
+	// --------------------------------------------------
+	void WarmStartFromCache(uint64_t key, const Collider* colA, ContactManifold& m) const;
+	void UpdateContactCache();
+
+	// --------------------------------------------------
+	// 速度解決
 	// m_Contacts
     // --------------------------------------------------
-	void ResolveVelocity(float dt);
+	// Resolve～ は１回分で入れたインパルスの変化の最大を返す（打ち切りの判定用）
+	void  ResolveVelocity(float dt);
+	float ResolveContact(Contact& c, float dt);
+	// --------------------------------------------------
+	// 法線のブロックソルバー
+	// ２～４点の法線インパルスを小さな LCP として一度に解く（点ごとに順に解くと揺れて収束が遅い）
+	// 行列が悪条件で解けなかったら false（呼び出し側で１点ずつ解く）
+	// --------------------------------------------------
+	bool ResolveNormalBlock(Contact& c, float dt, float& maxDelta);
+	// --------------------------------------------------
+	// 面の摩擦
+	// ２点以上の接触の摩擦を、圧力中心の接線インパルスと法線まわりのねじれとしてまとめて解く
+	// --------------------------------------------------
+	void ResolveFrictionPatch(Contact& c, float& maxDelta);
 	
 	// --------------------------------------------------
-	// iwj
+	// 減衰処理（指数減衰）
 	// m_Rigidbodies
     // --------------------------------------------------
 	void ApplyDamping(float dt);
 
 	// --------------------------------------------------
-	// ʒu␳
+	// めり込み解消（スプリットインパルス）
 	// m_Contacts
+	// 擬似速度だけを解いて、速度積分のときに位置へ１回だけ足す（実際の速度には残さないので跳ねない）
     // --------------------------------------------------
-	void CorrectPosition();
+	void  ResolvePosition(float dt);
+	float ResolvePseudoContact(Contact& c, float dt);
 
 	// --------------------------------------------------
-	// xf
+	// 速度反映
 	// m_Rigidbodies
     // --------------------------------------------------
 	void IntegrationVelocity(float dt);
 
+	// --------------------------------------------------
+	// 連続衝突判定（CCD）
+	// BeginContinuousCollision: 速度積分前の COM を覚える
+	// SolveContinuousCollision: 積分後、移動経路で最初に静的なものへ当たった位置まで戻す
+	// --------------------------------------------------
+	void BeginContinuousCollision();
+	void SolveContinuousCollision();
+
 	// ==================================================
-	// ----- WCg -----
+	// ----- ジョイント -----
 	// ==================================================
 	// --------------------------------------------------
-	// WCg̎OvZ
+	// ジョイントの事前計算
 	// m_Joints
 	// --------------------------------------------------
 	void PreSolveDistanceJoints(float dt);
@@ -362,29 +808,144 @@ private:
 	void PreSolveHingeJoints(float dt);
 
 	// --------------------------------------------------
-	// WCg̉
+	// ジョイントの解決
 	// m_Joints
 	// --------------------------------------------------
 	void ResolveDistanceJoints(float dt);
 	void ResolveBallJoints(float dt);
 	void ResolveHingeJoints(float dt);
+	float ResolveDistanceJoint(DistanceJoint& joint, float dt);
+	float ResolveBallJoint(BallJoint& joint, float dt);
+	float ResolveHingeJoint(HingeJoint& joint, float dt);
+
+	// ==================================================
+	// ----- ソルバーボディ -----
+	// ==================================================
+	// --------------------------------------------------
+	// Rigidbody から速度などを集めて、接触とジョイントに番号を振る
+	// 反復が終わったら m_SolverBodies.WriteBack() で書き戻す
+	// --------------------------------------------------
+	void BuildSolverBodies();
+
+	// ==================================================
+	// ----- ソルバーアイランド -----
+	// ==================================================
+	// --------------------------------------------------
+	// BuildSolverIslands: 動かせるボディを接触とジョイントで union-find し、反復回数を決める
+	// RecordSolverDelta: 拘束１つ分のインパルス変化をアイランドに記録する
+	// EndSolverIteration: 反復の終わりに、収束したか回数を使い切ったアイランドを止める（まだ解くものがあれば true）
+	//					   position で速度とめり込み解消のどちらの回数を見るか選ぶ
+	// --------------------------------------------------
+	void BuildSolverIslands();
+	bool IsSolverIslandActive(int island) const { return island >= 0 && m_SolverIslands[island].active; }
+	void RecordSolverDelta(int thread, int island, float delta)
+	{
+		float& d = m_SolverIslandDelta[(size_t)thread * m_SolverIslands.size() + island];
+		d = std::max(d, delta);
+	}
+	void BeginSolverIterations() { for (auto& island : m_SolverIslands) island.active = true; }
+	bool EndSolverIteration(int iteration, int threads, bool position);
+
+	// ==================================================
+	// ----- 並列ソルバー -----
+	// ==================================================
+	// --------------------------------------------------
+	// バッチ分け（貪欲法の彩色）
+	// 色が足りなくなった拘束は最後のバッチに入れて１スレッドで解く
+	// --------------------------------------------------
+	void BuildSolverBatches();
+	// --------------------------------------------------
+	// 速度解決を反復回数分、バッチごとに並列で行う
+	// バッチ内の拘束は別々のボディしか触らないので、スレッド数に依らず同じ結果になる
+	// めり込み解消も同じバッチで、接触だけを解く
+	// --------------------------------------------------
+	void SolveVelocityParallel(float dt);
+	void SolvePositionParallel(float dt);
+	void SolveParallel(int iterations, bool position, float dt);
+	float SolveConstraint(const SolverConstraint& sc, bool position, float dt);
 
 	// ==================================================
-	// ----- ̑xXV -----
+	// ----- アイランド、スリープ -----
+	// ==================================================
+	// --------------------------------------------------
+	// 起床
+	// WakeSleepingIslands: 個別に起こされた、Transform を書き換えられたボディのアイランドを起こす（積まれた分だけ見る）
+	// WakeIsland: rb が眠っているアイランドを丸ごと起こす
+	// WatchNewSleepers: このステップで眠ったボディの Transform に見張りを付ける
+	// --------------------------------------------------
+	void WakeSleepingIslands();
+	void WakeIsland(Rigidbody* rb);
+	void WatchNewSleepers();
+	void StopWatching(Rigidbody* rb);
+	bool IsTouchedWhileSleeping(const Rigidbody* rb) const;
+	// --------------------------------------------------
+	// アイランド構築と眠りの判定
+	// 接触とジョイントで union-find し、全員が止まっている時間が続いたアイランドを眠らせる
+	// --------------------------------------------------
+	void UpdateSleep(float dt);
+	int  FindIsland(int i);
+	void UniteIsland(int a, int b);
+
+	// ==================================================
+	// ----- 見かけの速度更新 -----
 	// ==================================================
 	void UpdateKinematicApparentVelocity(float dt);
 
 	// ==================================================
-	// -----  -----
+	// ----- 同期 -----
 	// ==================================================
 	// --------------------------------------------------
-	// COM ̓
+	// COM の同期
 	// --------------------------------------------------
 	void SyncCOM();
 
+	// --------------------------------------------------
+	// EndStep の前半と後半
+	// IntegrateStep: 減衰、速度積分、CCD、スリープ（パイプライン実行では物理スレッド）
+	// FinishStep: Enter / Stay / Exit、ディスパッチ、WorldPose の同期、計測の締め（本体スレッド）
+	// --------------------------------------------------
+	void IntegrateStep(float fixedDt);
+	void FinishStep();
+
+	// ==================================================
+	// ----- パイプライン実行 -----
+	// ==================================================
+	// --------------------------------------------------
+	// 物理スレッド
+	// WaitStep: 走っているステップが終わるまで待つ（書き戻しはしない）
+	// --------------------------------------------------
+	void StepThreadMain();
+	void WaitStep();
+	void StopStepThread();
+	// --------------------------------------------------
+	// ステップ中の剛体の姿勢
+	// KickStep で Transform から写し、物理スレッドはこちらを読み書きして、SyncStep で Transform へ書き戻す
+	// 同期実行では Transform を直接読み書きする
+	// --------------------------------------------------
+	void CaptureStepPoses();
+	void PublishStepPoses();
+	Vector3	   StepPosition(const Rigidbody* rb, const TransformComponent* tf) const;
+	Quaternion StepRotation(const Rigidbody* rb, const TransformComponent* tf) const;
+	void SetStepPosition(Rigidbody* rb, TransformComponent* tf, const Vector3& position);
+	void SetStepRotation(Rigidbody* rb, TransformComponent* tf, const Quaternion& rotation);
+	ColliderPose StepWorldPose(Collider* c); // ボディの姿勢から見た WorldPose（同期実行では UpdateWorldPose も行う）
+	// --------------------------------------------------
+	// 溜めた登録と操作の反映
+	// --------------------------------------------------
+	void ApplyPendingRegistrations();
+	void ApplyBodyCommands();
+
+	// ==================================================
+	// ----- 計測 -----
+	// ==================================================
+	// --------------------------------------------------
+	// 前の区切りからの時間を phase に足す
+	// --------------------------------------------------
+	void EndPhase(PhysicsStepStats::Phase phase);
+
 public:
 	// ==================================================
-	// ----- RC_[fobO`֌W -----
+	// ----- コライダーデバッグ描画関係 -----
 	// ==================================================
 	void DrawDebug(DebugRenderer& dr);
 };
@@ -0,0 +1,124 @@
+/*
+	PhysicsSystemDebug.cpp
+	20261017  hanaue sho
+	物理演算のデバッグ描画
+	DebugRenderer（D3D）に繋がるのはここだけ（ベンチマークなど描画の無いビルドでは外す）
+*/
+#include <assert.h>
+#include "PhysicsSystem.h"
+#include "ColliderComponent.h"
+#include "collision.h"
+#include "TriangleMeshBVH.h"
+#include "ConvexHull.h"
+#include "DebugRenderer.h"
+
+// ==================================================
+// ----- コライダーデバッグ描画関係 -----
+// ==================================================
+// ワールド座標を渡す必要あり
+void PhysicsSystem::DrawDebug(DebugRenderer& dr)
+{
+	WaitStep(); // 接触点を読むので
+	Vector4 colorTrigger = { 0.0f, 0.0f, 1.0f, 1.0f }; // Triggerなら青
+	const int DebugMeshMaxTriangles = 2048; // これより多い TriangleMesh は BVH の根の箱で描く（DebugRenderer の頂点は 65536 まで）
+
+	for (int i = 0; i < m_Colliders.size(); i++)
+	{
+		Collider* col = m_Colliders[i];
+		if (!col) continue;
+
+		const ColliderPose& pose = col->WorldPose();
+
+		// Trigger か判定
+		Vector4 color = col->IsTrigger() ? colorTrigger : Vector4{1.0f, 1.0f, 0.0f, 1.0f}; // 黄色
+
+		switch (col->m_Type)
+		{
+		case ColliderType::Box:
+		{
+			auto* shape = static_cast<BoxCollision*>(col->Shape());
+			assert(shape);
+			Vector3 center = pose.position;
+			Vector3 halfSize = shape->HalfSize() * pose.scale;
+			Matrix4x4 rot = pose.rotation.ToMatrix();
+
+			dr.DrawBox(center, halfSize, rot, color);
+			break;
+		}
+		case ColliderType::Sphere:
+		{
+			auto* shape = static_cast<SphereCollision*>(col->Shape());
+			assert(shape);
+			Vector3 center = pose.position;
+			float   radius = shape->Radius() * pose.scale.x;
+			Matrix4x4 rot = pose.rotation.ToMatrix();
+
+			dr.DrawSphere(center, radius, rot,  color);
+			break;
+		}
+		case ColliderType::Capsule:
+		{
+			auto* shape = static_cast<CapsuleCollision*>(col->Shape());
+			assert(shape);
+			Vector3 center = pose.position;
+			float   radius = shape->Radius()		 * pose.scale.x;
+			float   height = shape->CylinderHeight() * pose.scale.y;
+			Matrix4x4 rot  = pose.rotation.ToMatrix();
+
+			dr.DrawCapsule(center, radius, height, rot, color);
+			break;
+		}
+		case ColliderType::TriangleMesh:
+		{
+			auto* shape = static_cast<TriangleMeshCollision*>(col->Shape());
+			assert(shape);
+			const TriangleMeshBVH& mesh = shape->Mesh();
+			const Vector3 axis[3] = { pose.WorldRight(), pose.WorldUp(), pose.WorldForward() };
+			auto toWorld = [&](const Vector3& v) { return pose.position + axis[0] * (v.x * pose.scale.x) + axis[1] * (v.y * pose.scale.y) + axis[2] * (v.z * pose.scale.z); };
+
+			// 三角形が多いと頂点バッファに収まらないので、BVH の根の箱だけ描く
+			if (mesh.TriangleCount() > DebugMeshMaxTriangles)
+			{
+				const AABB bounds = mesh.Bounds();
+				dr.DrawBox(toWorld((bounds.min + bounds.max) * 0.5f), (bounds.max - bounds.min) * 0.5f * pose.scale, pose.rotation.ToMatrix(), color);
+				break;
+			}
+			for (int t = 0; t < mesh.TriangleCount(); t++)
+			{
+				Vector3 a, b, c;
+				mesh.GetTriangle(t, a, b, c);
+				a = toWorld(a); b = toWorld(b); c = toWorld(c);
+				dr.DrawLine(a, b, color);
+				dr.DrawLine(b, c, color);
+				dr.DrawLine(c, a, color);
+			}
+			break;
+		}
+		case ColliderType::ConvexHull:
+		{
+			auto* shape = static_cast<ConvexHullCollision*>(col->Shape());
+			assert(shape);
+			const ConvexHull& hull = shape->Hull();
+			const Vector3 axis[3] = { pose.WorldRight(), pose.WorldUp(), pose.WorldForward() };
+			auto toWorld = [&](const Vector3& v) { return pose.position + axis[0] * (v.x * pose.scale.x) + axis[1] * (v.y * pose.scale.y) + axis[2] * (v.z * pose.scale.z); };
+
+			// 面の輪郭を描く（隣の面と共有する辺は２回描く）
+			for (int f = 0; f < hull.FaceCount(); f++)
+			{
+				const ConvexHull::Face& face = hull.GetFace(f);
+				Vector3 prev = toWorld(hull.FaceVertex(face, face.count - 1));
+				for (int k = 0; k < face.count; k++)
+				{
+					const Vector3 cur = toWorld(hull.FaceVertex(face, k));
+					dr.DrawLine(prev, cur, color);
+					prev = cur;
+				}
+			}
+			break;
+		}
+		case ColliderType::MeshField: // 地面全体になるので描かない
+		case ColliderType::Count:
+			break;
+		}
+	}
+}
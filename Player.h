@@ -13,7 +13,7 @@
 #include "RigidbodyComponent.h"
 #include "ColliderComponent.h"
 #include "renderer.h"
-#include "texture.h"  // Texture::Load 
+#include "texture.h"  // Texture::Load 既存
 
 
 class Audio;
@@ -28,7 +28,7 @@ void PlayerObject::Init()
 	m_pModelAnimeObject->Init();
 	m_pModelAnimeObject->Transform()->SetParentKeepWorld(this->Transform());
 
-	// RC_[
+	// コライダー
 	auto* col = AddComponent<Collider>();
 	col->SetCapsule(1.5f, 8);
 	col->SetModeQuery();
@@ -44,7 +44,7 @@ void PlayerObject::Init()
 	state->SetModelAnime(m_pModelAnimeObject);
 	state->SetStateInitial(PlayerStateId::Idle);
 
-	// C[
+	// レイヤー
 	SetPhysicsLayer(31);
 	SetTag("Player");
 }
@@ -14,13 +14,13 @@ class ModelAnimeObject;
 class PlayerObject : public GameObject
 {
 private:
-	// Aj֌W
+	// アニメ関係
 	ModelAnimeObject* m_pModelAnimeObject = nullptr;
 
-	// Ȃ́
-	float m_SpeedParam = 0.0f; // Ȃ
+	// いらないもの↓↓↓↓↓
+	float m_SpeedParam = 0.0f; // もういらない
 
-	// ړ֌W
+	// 移動関係
 	Vector3 m_ForwardVector = {0, 0, 1};
 public:
 	void Init() override;
@@ -1,7 +1,7 @@
 /*
 	PlayerStateAim.cpp
 	20260210  hanaue sho
-	vC[ړ̏
+	プレイヤー移動中の処理
 */
 #include "PlayerStateAim.h"
 #include "PlayerStateManagerComponent.h"
@@ -12,36 +12,36 @@
 
 void PlayerStateAim::Enter(PlayerStateManagerComponent& manager)
 {
-	// Aj
+	// アニメ処理
 	manager.GetModelAnime()->PlayAnimeAim();
 	manager.GetModelAnime()->SetIsLocomotion(false);
 	manager.GetModelAnime()->SetSpeedAnime(1.0f);
-	// ړ
+	// 移動制御
 	manager.GetCC()->SetMoveInput({0, 0, 0});
 
-	// J悤
+	// カメラ方向を向くように
 	Vector3 vect = manager.GetCameraForward(); Vector3::Printf(vect);
 	vect.y = 0.0f; 
 	Vector3 targetPos = manager.Owner()->Transform()->Position() + vect * 10.0f;
 	manager.Owner()->Transform()->LookAt(targetPos);
-	// J
+	// カメラ制御
 	manager.SetCameraStateAim();
 
-	// u[
+	// ブーメラン制御
 	manager.GetBoomerang()->ChangeStateAim();
 }
 
 void PlayerStateAim::Update(PlayerStateManagerComponent& manager, float dt)
 {
-	// ^[Qbg⑫
+	// ターゲット補足
 	if (InputSystem::IsAimDownTrigger())
 	{
-		// ^[Qbgǉ
+		// ターゲットを追加
 		manager.GetBoomerang()->AddTarget();
 	}
 
-	// ----- ԑJ -----
-	// ҋ@J
+	// ----- 状態遷移 -----
+	// 待機遷移
 	if (InputSystem::IsThrowUp())
 	{
 		if (manager.GetBoomerang()->GetTargetsSize() > 0)
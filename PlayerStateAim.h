@@ -1,7 +1,7 @@
 /*
 	PlayerStateAim.h
 	20260210  hanaue sho
-	vC[ҋ@̏
+	プレイヤー待機中の処理
 */
 #ifndef PLAYERSTATEAIM_H_
 #define PLAYERSTATEAIM_H_
@@ -1,7 +1,7 @@
 /*
 	PlayerStateIdle.cpp
 	20260210  hanaue sho
-	vC[ҋ@̏
+	プレイヤー待機中の処理
 */
 #include "PlayerStateIdle.h"
 #include "PlayerStateManagerComponent.h"
@@ -13,35 +13,35 @@ void PlayerStateIdle::Enter(PlayerStateManagerComponent& manager)
 	manager.GetModelAnime()->SetSpeedAnime(1.0f);
 	manager.GetModelAnime()->SetIsLocomotion(true);
 	manager.GetModelAnime()->PlayAnimeIdle();
-	// J
+	// カメラ制御
 	manager.SetCameraStateFollow();
 }
 
 void PlayerStateIdle::Update(PlayerStateManagerComponent& manager, float dt)
 {
-	// ----- Aj[VǗ -----
+	// ----- アニメーション管理 -----
 	float speed = manager.GetCC()->ActualVelocity().lengthSq();
 	float maxSpeed = manager.GetCC()->MaxMoveSpeed();
 	manager.GetModelAnime()->SetBlendParam(speed/maxSpeed);
 
-	// ----- ԑJ -----
-	// ړJ
+	// ----- 状態遷移 -----
+	// 移動遷移
 	if (InputSystem::IsMoveDown())
 	{
 		manager.ChangeState(PlayerStateId::Move);
 	}
-	// WvJ
+	// ジャンプ遷移
 	if (InputSystem::IsJumpDownTrigger())
 	{
 		manager.GetCC()->OnJumpPressed();
 		manager.ChangeState(PlayerStateId::Jump);
 	}
-	// J
+	// 落下遷移
 	if (!manager.GetCC()->IsGround())
 	{
 		manager.ChangeState(PlayerStateId::Jump);
 	}
-	// GCJ
+	// エイム遷移
 	if (InputSystem::IsToAimDown())
 	{
 		if (manager.GetBoomerang()->IsStateIdle())
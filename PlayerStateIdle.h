@@ -1,7 +1,7 @@
 /*
 	PlayerStateIdle.h
 	20260210  hanaue sho
-	vC[ҋ@̏
+	プレイヤー待機中の処理
 */
 #ifndef PLAYERSTATEIDLE_H_
 #define PLAYERSTATEIDLE_H_
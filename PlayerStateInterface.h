@@ -1,7 +1,7 @@
 /*
 	PlayerStateInterface.h
 	20260210  hanaue sho
-	Xe[gp^[̃C^[tF[X
+	ステートパターンのインターフェース
 */
 #ifndef PLAYERSTATEINTERFACE_H_
 #define PLAYERSTATEINTERFACE_H_
@@ -22,7 +22,7 @@ public:
 #endif
 
 /*
-yev[gz
+【テンプレート】
 #ifndef PLAYERSTATE@@@_H_
 #define PLAYERSTATE@@@_H_
 #include "PlayerStateInterface.h"
@@ -1,7 +1,7 @@
 /*
 	PlayerStateJump.cpp
 	20260210  hanaue sho
-	vC[󒆂̏
+	プレイヤー空中の処理
 */
 #include "PlayerStateJump.h"
 #include "PlayerStateManagerComponent.h"
@@ -19,29 +19,29 @@ void PlayerStateJump::Enter(PlayerStateManagerComponent& manager)
 
 void PlayerStateJump::Update(PlayerStateManagerComponent& manager, float dt)
 {
-	// ----- ړ -----
+	// ----- 移動処理 -----
 	Vector3 input = InputSystem::GetInputMove();
 	Vector3 forward = manager.GetCameraForward();
 	Vector3 right = manager.GetCameraRight();
 	Vector3 moveDir = right * input.x + forward * input.z;
 	manager.GetCC()->SetMoveInput(moveDir);
 
-	// Wv
+	// ジャンプ長押し
 	manager.GetCC()->SetJumpHeld(Keyboard_IsKeyDown(KK_SPACE));
-	// 󒆃Wv
+	// 空中ジャンプ
 	if (InputSystem::IsJumpDownTrigger())
 	{
 		manager.GetModelAnime()->PlayAnimeJumpAir();
 		manager.GetCC()->OnJumpPressed();
 	}
 
-	// ----- ԑJ -----
-	// n
+	// ----- 状態遷移 -----
+	// 着地判定
 	if (manager.GetCC()->IsGround())
 	{
 		manager.ChangeState(PlayerStateId::Idle);
 	}
-	// GCJ
+	// エイム遷移
 	if (InputSystem::IsToAimDown())
 	{
 
@@ -1,7 +1,7 @@
 /*
 	PlayerStateJump.h
 	20260210  hanaue sho
-	vC[Wv̏
+	プレイヤージャンプ中の処理
 */
 #ifndef PLAYERSTATEJUMP_H_
 #define PLAYERSTATEJUMP_H_
@@ -1,7 +1,7 @@
 /*
 	PlayerStateManagerComponent.h
 	20260210  hanaue sho
-	vC[LN^[̃Xe[gp^[
+	プレイヤーキャラクターのステートパターン
 */
 #ifndef PLAYERSTATEMANAGERCOMPONENT_H_
 #define PLAYERSTATEMANAGERCOMPONENT_H_
@@ -23,38 +23,38 @@
 
 enum class PlayerStateId
 {
-	Idle, // ҋ@
-	Move, // ړ
-	Jump, // Wv
-	Aim,  // _
-	Throw,  // 
+	Idle, // 待機
+	Move, // 移動
+	Jump, // ジャンプ
+	Aim,  // 狙う
+	Throw,  // 投げる
 };
 
 class PlayerStateManagerComponent : public Component
 {
 private:
-	// ݂̃Xe[g
+	// 現在のステート
 	PlayerStateInterface* m_CurrentState = nullptr;
 	PlayerStateId m_CurrentId = PlayerStateId::Idle;
-	// State
+	// State実体
 	PlayerStateIdle m_StateIdle;
 	PlayerStateMove m_StateMove;
 	PlayerStateJump m_StateJump;
 	PlayerStateAim  m_StateAim;
 	PlayerStateThrow  m_StateThrow;
 
-	// J
+	// カメラ
 	GameObject* m_pCamera = nullptr;
 
-	// Aj[VIuWFNg|C^iOQƁj
+	// アニメーションオブジェクトポインタ（外部参照）
 	ModelAnimeObject* m_pModelAnime = nullptr;
 
-	// R|[lg|C^
+	// コンポーネントポインタ
 	CharacterControllerComponent* m_pController = nullptr;
 	BoomerangStateManagerComponent* m_pBoomerang = nullptr;
 	
 public:
-	// ----- CtCN -----
+	// ----- ライフライクル -----
 	void Init() override
 	{
 		m_pController = Owner()->GetComponent<CharacterControllerComponent>();
@@ -73,11 +73,11 @@ public:
 		m_CurrentState->FixedUpdate(*this, fixedDt);
 	}
 
-	// ----- Zb^[ -----
-	// Xe[g̏
+	// ----- 初期化セッター -----
+	// ステートの初期化
 	void SetStateInitial(PlayerStateId id)
 	{
-		if (m_CurrentState) return; // Qdh~
+		if (m_CurrentState) return; // ２重初期化防止
 		PlayerStateInterface* newState = ResolveStateId(id);
 		SetStateInitial(newState);
 	}
@@ -94,7 +94,7 @@ public:
 		m_pBoomerang = boomerang->GetComponent<BoomerangStateManagerComponent>();
 	}
 
-	// ----- Xe[g̐؂ւ -----
+	// ----- ステートの切り替え -----
 	void ChangeState(PlayerStateId id)
 	{
 		PlayerStateInterface* newState = ResolveStateId(id);
@@ -102,7 +102,7 @@ public:
 		if (success) SetStateId(id);
 	}
 
-	// ----- Qb^[ -----
+	// ----- ゲッター -----
 	CharacterControllerComponent* GetCC() { return m_pController; }
 	ModelAnimeObject* GetModelAnime() { return m_pModelAnime; }
 	BoomerangStateManagerComponent* GetBoomerang() { return m_pBoomerang; }
@@ -116,7 +116,7 @@ public:
 	}
 
 
-	// J
+	// カメラ制御
 	void SetCameraStateFollow()
 	{
 		if (!m_pCamera) return;
@@ -163,9 +163,9 @@ private:
 		if (m_CurrentState == newState) return false;
 
 		if (m_CurrentState)
-			m_CurrentState->Exit(*this); // I
+			m_CurrentState->Exit(*this); // 終了処理
 		m_CurrentState = newState;
-		m_CurrentState->Enter(*this); // Jn
+		m_CurrentState->Enter(*this); // 開始処理
 		return true;
 	}
 	void SetStateId(PlayerStateId id)
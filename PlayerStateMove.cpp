@@ -1,7 +1,7 @@
 /*
 	PlayerStateMove.cpp
 	20260210  hanaue sho
-	vC[ړ̏
+	プレイヤー移動中の処理
 */
 #include "PlayerStateMove.h"
 #include "PlayerStateManagerComponent.h"
@@ -16,7 +16,7 @@ void PlayerStateMove::Enter(PlayerStateManagerComponent& manager)
 
 void PlayerStateMove::Update(PlayerStateManagerComponent& manager, float dt)
 {
-	// ----- ړ -----
+	// ----- 移動処理 -----
 	Vector3 input = InputSystem::GetInputMove();
 	Vector3 forward = manager.GetCameraForward(); 
 	Vector3 right = manager.GetCameraRight(); 
@@ -24,30 +24,30 @@ void PlayerStateMove::Update(PlayerStateManagerComponent& manager, float dt)
 	manager.GetCC()->SetMoveInput(moveDir);
 
 
-	// ----- Aj[VǗ -----
+	// ----- アニメーション管理 -----
 	float speed = manager.GetCC()->ActualVelocity().length();
 	float maxSpeed = manager.GetCC()->MaxMoveSpeed();
 	manager.GetModelAnime()->SetBlendParam(speed / maxSpeed);
 	manager.GetModelAnime()->SetSpeedAnime(speed / maxSpeed * 2.0f);
 
-	// ----- ԑJ -----
-	// WvJ
+	// ----- 状態遷移 -----
+	// ジャンプ遷移
 	if (InputSystem::IsJumpDownTrigger())
 	{
 		manager.GetCC()->OnJumpPressed();
 		manager.ChangeState(PlayerStateId::Jump);
 	}
-	// ҋ@J
+	// 待機遷移
 	if (!InputSystem::IsMoveDown())
 	{
 		manager.ChangeState(PlayerStateId::Idle);
 	}
-	// J
+	// 落下遷移
 	if (!manager.GetCC()->IsGround())
 	{
 		manager.ChangeState(PlayerStateId::Jump);
 	}
-	// GCJ
+	// エイム遷移
 	if (InputSystem::IsToAimDown())
 	{
 		if (manager.GetBoomerang()->IsStateIdle())
@@ -1,7 +1,7 @@
 /*
 	PlayerStateMove.h
 	20260210  hanaue sho
-	vC[ړ̏
+	プレイヤー移動中の処理
 */
 #ifndef PLAYERSTATEMOVE_H_
 #define PLAYERSTATEMOVE_H_
@@ -1,7 +1,7 @@
 /*
 	PlayerStateThrow.cpp
 	20260210  hanaue sho
-	vC[ҋ@̏
+	プレイヤー待機中の処理
 */
 #include "PlayerStateThrow.h"
 #include "PlayerStateManagerComponent.h"
@@ -14,17 +14,17 @@ void PlayerStateThrow::Enter(PlayerStateManagerComponent& manager)
 	manager.GetModelAnime()->SetIsLocomotion(false);
 	manager.GetModelAnime()->PlayAnimeThrow();
 
-	// u[
+	// ブーメラン制御
 	manager.GetBoomerang()->ChangeStateThrow();
 
-	// ^C}[
+	// タイマー初期化
 	m_Timer = 0.0f;
 }
 
 void PlayerStateThrow::Update(PlayerStateManagerComponent& manager, float dt)
 {
-	// ----- ԑJ -----
-	// ړJ
+	// ----- 状態遷移 -----
+	// 移動遷移
 	if (InputSystem::IsMoveDown())
 	{
 		manager.ChangeState(PlayerStateId::Idle);
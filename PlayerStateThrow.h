@@ -1,7 +1,7 @@
 /*
 	PlayerStateThrow.h
 	20260210  hanaue sho
-	vC[ҋ@̏
+	プレイヤー待機中の処理
 */
 #ifndef PLAYERSTATETHROW_H_
 #define PLAYERSTATETHROW_H_
@@ -35,7 +35,7 @@ void PlayroomScene::Init()
 {
 	Scene::Init();
 
-	// J -----
+	// カメラ -----
 	Camera* pCamera = AddGameObject<Camera>(0);
 	pCamera->Init();
 	pCamera->GetComponent<CameraComponent>()->SetMode(CameraComponent::Mode::Perspective);
@@ -57,7 +57,7 @@ void PlayroomScene::Init()
 	CreateSection_4();
 	CreateSection_5();
 
-	// -----
+	// りんご-----
 	AppleObject* pApple = AddGameObject<AppleObject>(1);
 	pApple->Init();
 	pApple->Transform()->SetPosition({ 3, -3, 3 });
@@ -85,7 +85,7 @@ void PlayroomScene::Init()
 		}
 	}
 
-	// Gl~[ -----
+	// エネミー -----
 	Enemy* pEnemy = AddGameObject<Enemy>(1);
 	pEnemy->Init();
 	pEnemy->Transform()->SetPosition({ 0, 3, 0 });
@@ -98,7 +98,7 @@ void PlayroomScene::Init()
 
 
 
-	// Cg֌W
+	// ライト関係
 	LightApp light = {};
 	light.enable = 1;
 	light.diffuse = Vector4(1.0f, 1.0f, 1.0f, 1.0f);
@@ -106,12 +106,12 @@ void PlayroomScene::Init()
 	light.direction = Vector4(0.3f, -1.0f, 0.0f, 0.0f).normalized();
 	Renderer::SetLight(light);
 
-	// bVtB[h
+	// メッシュフィールド
 	Field* pField = AddGameObject<Field>(1);
 	pField->Init();
 	pField->Transform()->SetPosition({ -40, -7, -40 });
 
-	// VF[_[֌W
+	// シェーダー関係
 	ToonApp toon = MakeToon(ToonPreset::GravityRush2Like);
 	Renderer::SetToon(toon);
 
@@ -145,12 +145,12 @@ void PlayroomScene::CreateSection_0()
 {
 	Vector3 worldOffset = { 50, 0, 0 };
 	Vector3 position = { 0, 0, 0 };
-	// vC[zu -----
+	// プレイヤー配置 -----
 	PlayerObject* pPlayer = AddGameObject<PlayerObject>(1);
 	position = Vector3(0, 0, 0) + worldOffset;
 	pPlayer->Transform()->SetPosition(position);
 	pPlayer->Init();
-	// S
+	// リンゴ
 	//AppleObject* pApple = AddGameObject<AppleObject>(1);
 	//position = Vector3(0, 5, 0) + worldOffset;
 	//pApple->Init();
@@ -160,13 +160,13 @@ void PlayroomScene::CreateSection_0()
 	//pApple->GetComponent<Rigidbody>()->SetBodyTypeKinematic();
 
 
-	// ThobO
+	// サンドバッグ
 	SandbagObject* pSandbag = AddGameObject<SandbagObject>(1);
 	position = Vector3(-10, 15, 0) + worldOffset;
 	pSandbag->Transform()->SetPosition(position);
 	pSandbag->Init();
 
-	// m
+	// ノレン
 	NorenObject* pNoren = AddGameObject<NorenObject>(1);
 	position = Vector3(0, 13, 5) + worldOffset;
 	pNoren->Transform()->SetPosition(position);
@@ -176,7 +176,7 @@ void PlayroomScene::CreateSection_0()
 	pNoren->Transform()->SetPosition(position);
 	pNoren->Init();
 
-	// JvZ
+	// カプセル
 	for (int i = 0; i < 5; i ++)
 	{
 		LightObject* pLightObject = AddGameObject<LightObject>(1);
@@ -185,7 +185,7 @@ void PlayroomScene::CreateSection_0()
 		pLightObject->Transform()->SetPosition(position);
 	}
 
-	// 
+	// 床
 	{
 		auto* pCube = AddGameObject<CubeObject>(1);
 		pCube->Init();
@@ -195,7 +195,7 @@ void PlayroomScene::CreateSection_0()
 		auto* rigid = pCube->GetComponent<Rigidbody>();
 		rigid->SetBodyTypeStatic();
 	}
-	// 
+	// 奥壁
 	{
 		auto* pCube = AddGameObject<CubeObject>(1);
 		pCube->Init();
@@ -205,7 +205,7 @@ void PlayroomScene::CreateSection_0()
 		auto* rigid = pCube->GetComponent<Rigidbody>();
 		rigid->SetBodyTypeStatic();
 	}
-	// O
+	// 手前壁
 	{
 		auto* pCube = AddGameObject<CubeObject>(1);
 		pCube->Init();
@@ -215,7 +215,7 @@ void PlayroomScene::CreateSection_0()
 		auto* rigid = pCube->GetComponent<Rigidbody>();
 		rigid->SetBodyTypeStatic();
 	}
-	// E
+	// 右壁
 	{
 		auto* pCube = AddGameObject<CubeObject>(1);
 		pCube->Init();
@@ -225,7 +225,7 @@ void PlayroomScene::CreateSection_0()
 		auto* rigid = pCube->GetComponent<Rigidbody>();
 		rigid->SetBodyTypeStatic();
 	}
-	// 
+	// 左壁
 	{
 		auto* pCube = AddGameObject<CubeObject>(1);
 		pCube->Init();
@@ -236,12 +236,12 @@ void PlayroomScene::CreateSection_0()
 		rigid->SetBodyTypeStatic();
 	}
 }
-// ⓹
+// 坂道
 void PlayroomScene::CreateSection_1()
 {
 	Vector3 worldOffset = { 20, 10, 30 };
 	Vector3 position = { 0, 0, 0 };
-	// ⓹zu
+	// 坂道配置
 	{
 		auto* pCube = AddGameObject<CubeObject>(1);
 		pCube->Init();
@@ -249,7 +249,7 @@ void PlayroomScene::CreateSection_1()
 		pCube->Transform()->SetPosition(position);
 		pCube->Transform()->SetScale({ 20, 1, 10 });
 		pCube->Transform()->SetEulerAngles({ 0, 0, -0.7 });
-		pCube->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Kinematic); // 
+		pCube->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Kinematic); // 壁
 	}
 	{
 		auto* pCube = AddGameObject<CubeObject>(1);
@@ -258,7 +258,7 @@ void PlayroomScene::CreateSection_1()
 		pCube->Transform()->SetPosition(position);
 		pCube->Transform()->SetScale({ 20, 1, 10 });
 		pCube->Transform()->SetEulerAngles({ 0, 0, 0.7 });
-		pCube->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Kinematic); // 
+		pCube->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Kinematic); // 壁
 	}
 	{
 		auto* pCube = AddGameObject<CubeObject>(1);
@@ -267,9 +267,9 @@ void PlayroomScene::CreateSection_1()
 		pCube->Transform()->SetPosition(position);
 		pCube->Transform()->SetScale({ 20, 1, 10 });
 		pCube->Transform()->SetEulerAngles({ 0, 0, -0.7 });
-		pCube->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Kinematic); // 
+		pCube->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Kinematic); // 壁
 	}
-	// WFl[^[
+	// ジェネレーター
 	{
 		AppleGenerator* pGenerator = AddGameObject<AppleGenerator>(1);
 		position = Vector3(0, 25, -3) + worldOffset;
@@ -279,23 +279,23 @@ void PlayroomScene::CreateSection_1()
 		pGenerator->SetInterval(1.5f);
 	}
 }
-// ]o[
+// 回転バー
 void PlayroomScene::CreateSection_2()
 {
 	Vector3 worldOffset = { 0, 0, 40 };
 	Vector3 position = { 0, 0, 0 };
-	// ]
+	// 回転体
 	auto* pCube = AddGameObject<CubeObject>(1);
 	pCube->Init();
 	position = Vector3(0, 0, 0) + worldOffset;
 	pCube->Transform()->SetPosition(position);
 	pCube->Transform()->SetScale({ 15, 1, 5 });
-	pCube->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Kinematic); // 
+	pCube->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Kinematic); // 壁
 	auto* ar = pCube->AddComponent<AutoRotateComponent>();
 	ar->SetAxis({ 0, 0, 1 });
 	ar->SetSpeed(5);
 
-	// WFl[^[
+	// ジェネレーター
 	{
 		AppleGenerator* pGenerator = AddGameObject<AppleGenerator>(1);
 		position = Vector3(5, 10, -3) + worldOffset;
@@ -305,17 +305,17 @@ void PlayroomScene::CreateSection_2()
 		pGenerator->SetInterval(3);
 	}
 }
-// bVtB[h
+// メッシュフィールド
 void PlayroomScene::CreateSection_3()
 {
 }
-// 
+// こま
 void PlayroomScene::CreateSection_4()
 {
 	Vector3 worldOffset = { 10, 0, -40 };
 	Vector3 position = { 0, 0, 0 };
 
-	// Ɗy
+	// 独楽
 	for (int i = 0; i < 4; i++)
 	{
 		auto* pCube = AddGameObject<CubeObject>(1);
@@ -330,7 +330,7 @@ void PlayroomScene::CreateSection_4()
 		koma->SetTorquePower(800);
 	}
 	
-	// 
+	// 床
 	{
 		auto* pCube = AddGameObject<CubeObject>(1);
 		pCube->Init();
@@ -340,7 +340,7 @@ void PlayroomScene::CreateSection_4()
 		auto* rigid = pCube->GetComponent<Rigidbody>();
 		rigid->SetBodyTypeStatic();
 	}
-	// 
+	// 奥壁
 	{
 		auto* pCube = AddGameObject<CubeObject>(1);
 		pCube->Init();
@@ -350,7 +350,7 @@ void PlayroomScene::CreateSection_4()
 		auto* rigid = pCube->GetComponent<Rigidbody>();
 		rigid->SetBodyTypeStatic();
 	}
-	// O
+	// 手前壁
 	{
 		auto* pCube = AddGameObject<CubeObject>(1);
 		pCube->Init();
@@ -360,7 +360,7 @@ void PlayroomScene::CreateSection_4()
 		auto* rigid = pCube->GetComponent<Rigidbody>();
 		rigid->SetBodyTypeStatic();
 	}
-	// E
+	// 右壁
 	{
 		auto* pCube = AddGameObject<CubeObject>(1);
 		pCube->Init();
@@ -370,7 +370,7 @@ void PlayroomScene::CreateSection_4()
 		auto* rigid = pCube->GetComponent<Rigidbody>();
 		rigid->SetBodyTypeStatic();
 	}
-	// 
+	// 左壁
 	{
 		auto* pCube = AddGameObject<CubeObject>(1);
 		pCube->Init();
@@ -381,13 +381,13 @@ void PlayroomScene::CreateSection_4()
 		rigid->SetBodyTypeStatic();
 	}
 }
-// ˂鏰
+// 跳ねる床
 void PlayroomScene::CreateSection_5()
 {
 	Vector3 worldOffset = { -40, 0, 0 };
 	Vector3 position = { 0, 0, 0 };
 
-	// 
+	// 床
 	{
 		auto* pCube = AddGameObject<CubeObject>(1);
 		pCube->Init();
@@ -398,7 +398,7 @@ void PlayroomScene::CreateSection_5()
 		rigid->SetBodyTypeStatic();
 		rigid->SetRestitution(2.0f);
 	}
-	// 
+	// 奥壁
 	{
 		auto* pCube = AddGameObject<CubeObject>(1);
 		pCube->Init();
@@ -410,7 +410,7 @@ void PlayroomScene::CreateSection_5()
 		rigid->SetBodyTypeStatic();
 		rigid->SetRestitution(2.0f);
 	}
-	// O
+	// 手前壁
 	{
 		auto* pCube = AddGameObject<CubeObject>(1);
 		pCube->Init();
@@ -422,7 +422,7 @@ void PlayroomScene::CreateSection_5()
 		rigid->SetBodyTypeStatic();
 		rigid->SetRestitution(2.0f);
 	}
-	// E
+	// 右壁
 	{
 		auto* pCube = AddGameObject<CubeObject>(1);
 		pCube->Init();
@@ -434,7 +434,7 @@ void PlayroomScene::CreateSection_5()
 		rigid->SetBodyTypeStatic();
 		rigid->SetRestitution(2.0f);
 	}
-	// 
+	// 左壁
 	{
 		auto* pCube = AddGameObject<CubeObject>(1);
 		pCube->Init();
@@ -446,7 +446,7 @@ void PlayroomScene::CreateSection_5()
 		rigid->SetBodyTypeStatic();
 		rigid->SetRestitution(2.0f);
 	}
-	// WFl[^[
+	// ジェネレーター
 	{
 		AppleGenerator* pGenerator = AddGameObject<AppleGenerator>(1);
 		position = Vector3(20, 30, -20) + worldOffset;
@@ -16,12 +16,12 @@ public:
 	void Update(float dt) override;
 	void Draw() override;
 
-	void CreateSection_0(); // vC[ƌyIuWFNgȂǁiOj
-	void CreateSection_1(); // ⓹iPj
-	void CreateSection_2(); // ]o[iQj
-	void CreateSection_3(); // bVtB[hiXj
-	void CreateSection_4(); // ܁iSj
-	void CreateSection_5(); // ˂鏰iTj
+	void CreateSection_0(); // プレイヤーと軽いオブジェクトなど（０時）
+	void CreateSection_1(); // 坂道（１時）
+	void CreateSection_2(); // 回転バー（２時）
+	void CreateSection_3(); // メッシュフィールド（９時）
+	void CreateSection_4(); // こま（４時）
+	void CreateSection_5(); // 跳ねる床（５時）
 
 };
 
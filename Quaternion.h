@@ -1,8 +1,8 @@
 /*
 	Quaternion.h
 	20250806  hanaue sho
-	EnE˂
-	q = qA * qB  B̉]̂ƂẢ]Kp
+	右手系右ねじ
+	q = qA * qB → Bの回転のあとにAの回転を適用
 */
 #ifndef QUATERNION_H_
 #define QUATERNION_H_
@@ -15,22 +15,22 @@ class Quaternion
 {
 public:
 	// ==================================================
-	// ----- vf{ -----
+	// ----- 要素本体 -----
 	// q = {x, y, z, w}
 	// ==================================================
-	float x, y, z, w; // {̗vf
+	float x, y, z, w; // 本体要素
 
 	// ==================================================
-	// ----- RXgN^ -----
+	// ----- コンストラクタ -----
 	// ==================================================
 	Quaternion() : x(0), y(0), z(0), w(1) { }
 	Quaternion(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
 
 	// ==================================================
-	// ----- Iy[^ -----
+	// ----- オペレータ -----
 	// ==================================================
     // --------------------------------------------------
-	// NH[^jIm̐ρin~gρF]j
+	// クォータニオン同士の積（ハミルトン積：回転合成）
     // --------------------------------------------------
 	Quaternion operator *(const Quaternion& rhs) const
 	{
@@ -42,7 +42,7 @@ public:
 		);
 	}
 	// --------------------------------------------------
-	// float Ƃ̐ρievf float {j
+	// float との積（各要素を float 倍）
     // --------------------------------------------------
 	Quaternion operator *(float s) const
 	{
@@ -50,14 +50,14 @@ public:
 	}
 
 	// ==================================================
-	// ----- [eBeB -----
+	// ----- ユーティリティ -----
 	// ==================================================
     // --------------------------------------------------
-	// PʃNH[^jIԂ
+	// 単位クォータニオンを返す
     // --------------------------------------------------
 	static Quaternion Identity() { return Quaternion(0, 0, 0, 1); }
     // --------------------------------------------------
-	// K
+	// 正規化
     // --------------------------------------------------
 	Quaternion normalized() const
 	{
@@ -67,40 +67,40 @@ public:
 			float invMag = 1.0f / sqrtf(magSq);
 			return Quaternion(x * invMag, y * invMag, z * invMag, w * invMag);
 		}
-		return Identity(); // s͒PʃNH[^jI
+		return Identity(); // 失敗時は単位クォータニオン
 	}
 	// --------------------------------------------------
-	// iQj
+	// 長さ（２乗）
 	// --------------------------------------------------
 	float LengthSq() const noexcept { return x * x + y * y + z * z + w * w; }
 	// --------------------------------------------------
-	// 
+	// 長さ
 	// --------------------------------------------------
 	float Length() const noexcept { return sqrtf(x * x + y * y + z * z + w * w); }
 	// --------------------------------------------------
-	// t
+	// 逆元
     // --------------------------------------------------
 	Quaternion Inverse(float eps = 1e-12f) const noexcept
 	{
 		float ls = LengthSq();
-		if (ls < eps) return Identity(); // قڃ[͈̎Sɓ]ڂԂ
+		if (ls < eps) return Identity(); // ほぼゼロ長の時は安全側に転移を返す
 		return Conjugate() * (1.0f / ls);
 	}
 	// --------------------------------------------------
-	// 
+	// 共役
     // --------------------------------------------------
 	Quaternion Conjugate()const noexcept { return { -x, -y, -z, w }; }
 
 	// ==================================================
-	// -----  -----
+	// ----- 生成 -----
 	// ==================================================
     // --------------------------------------------------
-	// ƊpxNH[^jI𐶐
+	// 軸と角度からクォータニオンを生成
 	// q = {axis * sin(angle/2), cos(angle/2)}
     // --------------------------------------------------
 	static Quaternion FromAxisAngle(const Vector3& axis, float angle)
 	{
-		Vector3 normal = axis.normalized(); // 𐳋K
+		Vector3 normal = axis.normalized(); // 軸を正規化
 		float sinHalfAngle = sinf(angle * 0.5f);
 		float cosHalfAngle = cosf(angle * 0.5f);
 
@@ -112,8 +112,8 @@ public:
 		);
 	}
 	// --------------------------------------------------
-	// IC[e琶iYawPitchRolljiEWnj
-	// WobN͉łȂ̂ŒӁiQua->Eulaer->Quâ悤ȍs̓Yj
+	// オイラー各から生成（Yaw→Pitch→Roll）（右手座標系）
+	// ※ジンバルロックは回避できないので注意（Qua->Eulaer->Quaのような行き来はズレるよ）※
     // --------------------------------------------------
 	static Quaternion FromEulerAngles(const Vector3& euler)
 	{
@@ -130,7 +130,7 @@ public:
 		return q.normalized();
 	}
 	// --------------------------------------------------
-	// from to ōxNg֌NH[^jI𐶐
+	// from to で作られるベクトルへ向くクォータニオンを生成
 	// --------------------------------------------------
 	static Quaternion LookAt(const Vector3& from, const Vector3& to, const Vector3& up = Vector3(0, 1, 0))
 	{
@@ -138,11 +138,11 @@ public:
 		Vector3 right = Vector3::Cross(up, forward).normalized();
 		Vector3 newUp = Vector3::Cross(forward, right);
 
-		// ]s
+		// 回転行列を作る
 		Matrix4x4 rot;
 		rot.identity();
 
-		// ƍsɋl߂
+		// ちゃんと行に詰める
 		rot.m[0][0] = right.x;
 		rot.m[0][1] = right.y;
 		rot.m[0][2] = right.z;
@@ -155,12 +155,12 @@ public:
 		rot.m[2][1] = forward.y;
 		rot.m[2][2] = forward.z;
 
-		// s񂩂NH[^jI
+		// 行列からクォータニオンを作る
 		return Quaternion::FromMatrix(rot);
 	}
 	// --------------------------------------------------
-	// ]s񂩂NH[^jI𐶐iKsłKvj
-	// 20250928 ꂪxNgV̂ŃoOĂ݂
+	// 回転行列からクォータニオンを生成（※正規直交行列である必要あり）
+	// 20250928 これが列ベクトル流儀のせいでバグってたみたい
 	// --------------------------------------------------
 	static Quaternion FromMatrix(const Matrix4x4& rot)
 	{
@@ -175,7 +175,7 @@ public:
 			q.y = (rot.m[2][0] - rot.m[0][2]) / s;
 			q.z = (rot.m[0][1] - rot.m[1][0]) / s;
 		}
-		else // őpɉގKp
+		else // 最大角に応じた類似式を適用
 		{
 			if (rot.m[0][0] > rot.m[1][1] && rot.m[0][0] > rot.m[2][2])
 			{
@@ -205,24 +205,24 @@ public:
 		return q.normalized();
 	}
 	// --------------------------------------------------
-	// from  to ։񂷂߂̃NH[^jI𐶐ij
+	// from から to へ回すためのクォータニオンを生成（差分）
 	// --------------------------------------------------
 	static Quaternion FromToRotation(const Vector3& from, const Vector3& to)
 	{
 		Vector3 v0 = from.normalized();
 		Vector3 v1 = to.normalized();
 
-		float dot = Vector3::Dot(v0, v1); //
+		float dot = Vector3::Dot(v0, v1); //内積
 
-		if (dot > 0.9999f)// قړ
+		if (dot > 0.9999f)// ほぼ同じ方向
 		{
-			return Quaternion::Identity(); // ]KvȂ
+			return Quaternion::Identity(); // 回転する必要なし
 		}
-		else if (dot < -0.9999f) // قڋtiPWOx]j
+		else if (dot < -0.9999f) // ほぼ逆方向（１８０度回転）
 		{
-			// Cӂ̐xNg]Ɂi萫̂߁j
+			// 任意の垂直ベクトルを回転軸に（安定性のため）
 			Vector3 orth = Vector3(1.0f, 0.0f, 0.0f);
-			if (fabs(v0.x) > 0.9f) // ƎĂȂ炙
+			if (fabs(v0.x) > 0.9f) // ｘと似てるならｙを試す
 				orth = Vector3(0.0f, 1.0f, 0.0f);
 			Vector3 axis = Vector3::Cross(v0, orth).normalized();
 			return Quaternion::FromAxisAngle(axis, PI);
@@ -237,10 +237,10 @@ public:
 	}
 	
 	// ==================================================
-	// ----- ]Kp -----
+	// ----- 回転適用 -----
 	// ==================================================
 	// --------------------------------------------------
-	// ^ꂽxNgNH[^jIŉ񂷁iKpj
+	// 与えられたベクトルをクォータニオンで回す（適用させる）
 	// v' = q * v * q^(-1)
 	// --------------------------------------------------
 	Vector3 Rotate(const Vector3& vect) const
@@ -253,11 +253,11 @@ public:
 	}
 
 	// ==================================================
-	// ----- ϊEo -----
+	// ----- 変換・抽出 -----
 	// ==================================================
 	// --------------------------------------------------
-	// ]sɕϊ
-	// hQX̉]狁܂
+	// 回転行列に変換
+	// ロドリゲスの回転公式から求まる
 	// --------------------------------------------------
 	Matrix4x4 ToMatrix() const
 	{
@@ -283,8 +283,8 @@ public:
 		return mat;
 	}
 	// --------------------------------------------------
-	// NH[^jIIC[p擾iyawpitchrollj
-	// ]soRĂ̂Ŏ]s񂩂IC[p߂菇Ɠ
+	// クォータニオンからオイラー角を取得（yaw→pitch→roll）
+	// 回転行列を経由しているので実質回転行列からオイラー角を求める手順と同じ
 	// --------------------------------------------------
 	Vector3 ToEulerAngles() const
 	{
@@ -303,13 +303,13 @@ public:
 		float yaw = 0;
 		float roll = 0;
 
-		// pitch(X])
+		// pitch(X軸回転)
 		if (fabs(cosf(pitch)) > 1e-6f) // 
 		{
 			yaw = atan2f(r02, r22); // yaw
 			roll = atan2f(-r10, r11); // roll
 		}
-		else // WobNߖTipitch  90j
+		else // ジンバルロック近傍（pitch ≒ 90）
 		{
 			yaw = atan2f(r20, r00);
 			roll = 0.0f;
@@ -317,11 +317,11 @@ public:
 		return { pitch, yaw, roll }; // {X, Y, Z}
 	}
 	// --------------------------------------------------
-	// Ɗpxo
-	// q = ( axis * sin(/2), cos(/2) )
-	//  = arccos(q.w) * 2
-	// axis = q(x, y, z) / sin(/2)
-	// angle ÔƂ͎CӂȂ̂ŁAƂ肠PʃxNgiPCOCOjԂ
+	// 軸と角度を取り出す
+	// q = ( axis * sin(θ/2), cos(θ/2) )
+	// θ = arccos(q.w) * 2
+	// axis = q(x, y, z) / sin(θ/2)
+	// angle が０のときは軸が任意なので、とりあえず単位ベクトル（１，０，０）を返す
 	// --------------------------------------------------
 	void ToAxisAngle(Vector3& outAxis, float& outAngle) const
 	{
@@ -329,25 +329,25 @@ public:
 
 		float wClamped = Vector3::Clamp(q.w, -1.0f, 1.0f);
 
-		// px̎擾
+		// 角度の取得
 		float angle = 2.0f * acosf(wClamped);
 		outAngle = angle;
 
-		// ̎擾
-		float sinHalfSq = 1.0f - wClamped * wClamped; // (sin)^2 = 1 - cos^2 
-		if (sinHalfSq < 0.0f) sinHalfSq = 0.0f; // 덷ŔɂȂ̂h
+		// 軸の取得
+		float sinHalfSq = 1.0f - wClamped * wClamped; // (sinθ)^2 = 1 - cosθ^2 
+		if (sinHalfSq < 0.0f) sinHalfSq = 0.0f; // 誤差で微小負になるのを防ぐ
 		float sinHalf = sqrtf(sinHalfSq); 
-		if (sinHalf < 0.0001f) // pxOȂ̂Ŏ͔CӁiPʃxNgԂj
+		if (sinHalf < 0.0001f) // 角度０なので軸は任意（単位ベクトルを返す）
 			outAxis = Vector3(1.0f, 0.0f, 0.0f);
 		else
 			outAxis = Vector3(q.x, q.y, q.z) / sinHalf;
 	}
 
 	// ==================================================
-	// ----- ` -----
+	// ----- 線形補間 -----
 	// ==================================================
 	// --------------------------------------------------
-	// NH[^jI̋ʐ`
+	// クォータニオンの球面線形補間
 	// Spherical Lerp
 	// --------------------------------------------------
 	static Quaternion Slerp(const Quaternion& q1, const Quaternion& q2, float t)
@@ -355,10 +355,10 @@ public:
 		Quaternion a = q1.normalized();
 		Quaternion b = q2.normalized();
 
-		// ςŉ]̊pxvZ
+		// 内積で回転の角度を計算
 		float  dot = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
 
-		// ⊮oHɂȂ̂h
+		// 補完経路が遠回りになるのを防ぐ
 		if (dot < 0.0f)
 		{
 			b = Quaternion(-b.x, -b.y, -b.z, -b.w);
@@ -368,7 +368,7 @@ public:
 		const float DOT_THRESHOULD = 0.9995f;
 		if (dot > DOT_THRESHOULD)
 		{
-			// `ԁîŐxIɖȂj
+			// 線形補間（差が小さいので精度的に問題ない）
 			Quaternion result = Quaternion(
 				a.x + t * (b.x - a.x),
 				a.y + t * (b.y - a.y),
@@ -378,10 +378,10 @@ public:
 			return result.normalized();
 		}
 
-		// ʐ`
-		float theta = acosf(dot);		//  = angle between a and b
-		float sinTheta = sinf(theta);	// sin()
-		float tTheta = theta * t;		// t
+		// 球面線形補間
+		float theta = acosf(dot);		// θ = angle between a and b
+		float sinTheta = sinf(theta);	// sin(θ)
+		float tTheta = theta * t;		// tθ
 
 		float scaleA = sinf(theta - tTheta) / sinTheta;
 		float scaleB = sinf(tTheta) / sinTheta;
@@ -394,7 +394,7 @@ public:
 		).normalized();
 	}
 	// --------------------------------------------------
-	// ԁiŒZj
+	// 補間（最短距離）
 	// NormalizedLerpShortest
 	// --------------------------------------------------
 	static Quaternion NlerpShortest(const Quaternion& q1, const Quaternion& q2, float t)
@@ -402,10 +402,10 @@ public:
 		Quaternion a = q1.normalized();
 		Quaternion b = q2.normalized();
 
-		// ςŉ]̊pxvZ
+		// 内積で回転の角度を計算
 		float  dot = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
 
-		// ⊮oHɂȂ̂h
+		// 補完経路が遠回りになるのを防ぐ
 		if (dot < 0.0f)
 		{
 			b = Quaternion(-b.x, -b.y, -b.z, -b.w);
@@ -420,10 +420,10 @@ public:
 	}
 
 	// ==================================================
-	// ----- fobOp -----
+	// ----- デバッグ用 -----
 	// ==================================================
 	// --------------------------------------------------
-	// ̃}gbNX̗ގ̊mF
+	// 二つのマトリックスの類似の確認
 	// --------------------------------------------------
 	static float MaxAbs3x3Diff(const Matrix4x4& A, const Matrix4x4& B) {
 		float m = 0.0f;
@@ -434,11 +434,11 @@ public:
 		return m;
 	}
 	// --------------------------------------------------
-	// ̃NH[^jI̗ގ̊mF
+	// 二つのクォータニオンの類似の確認
 	// --------------------------------------------------
 	static float AngleBetweenQuats(const Quaternion& a, const Quaternion& b) {
 		Quaternion na = a.normalized(), nb = b.normalized();
-		float dot = fabsf(na.x * nb.x + na.y * nb.y + na.z * nb.z + na.w * nb.w); // }lz
+		float dot = fabsf(na.x * nb.x + na.y * nb.y + na.z * nb.z + na.w * nb.w); // ±同値を吸収
 		if (dot > 1.0f) dot = 1.0f;
 		return 2.0f * acosf(dot); // [rad]
 	}
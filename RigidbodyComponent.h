@@ -10,7 +10,7 @@
 #include "Vector3.h"
 #include "PhysicsSystem.h"
 #include "Manager.h"
-#include "Scene.h"
+#include "scene.h"
 #undef min 
 #undef max 
 
@@ -18,136 +18,204 @@ class Rigidbody : public Component
 {
 public:
 	// ==================================================
-	// ----- 񋓑 -----
+	// ----- 列挙体 -----
 	// ==================================================
     // --------------------------------------------------
-	// {fB^Cv 
-	// static    : Փ˔̂
-	// Kinematic : ʒuŵݔf
-	// Dynamic   : R{ՓˉSĂs
+	// ボディタイプ 
+	// static    : 衝突判定のみ
+	// Kinematic : 位置指定のみ反映
+	// Dynamic   : 自然落下＋衝突解決全てを行う
     // --------------------------------------------------
 	enum class BodyType { Static, Kinematic, Dynamic };
 
 	// --------------------------------------------------
-	// d͐ݒ 
-	// Global : ʂ̏d
-	// Custom : JX^iCӁj
-	// None   : d
+	// 重力設定 
+	// Global : 共通の重力
+	// Custom : カスタム（任意）
+	// None   : 無重力
     // --------------------------------------------------
 	enum class GravityMode {Global, Custom, None};
 
 private:
 	// ==================================================
-	// ----- vf -----
+	// ----- 要素 -----
 	// ==================================================
     // --------------------------------------------------
-	// {fB^Cv
+	// ボディタイプ
     // --------------------------------------------------
 	BodyType m_BodyType = BodyType::Dynamic;
 	// --------------------------------------------------
-	//  
+	// 質量 
     // --------------------------------------------------
-	float m_Mass	= 1.0f; // 
-	float m_InvMass = 1.0f; // t iDynamic && mass>0 Ȃ 1/mass, ȊO0j
-	Vector3 m_CenterOfMassLocal{ 0, 0, 0 }; // dSW
-	Vector3 m_CenterOfMassPositionWorld{ 0, 0, 0 }; // SW
+	float m_Mass	= 1.0f; // 質量
+	float m_InvMass = 1.0f; // 逆質量 （Dynamic && mass>0 ならば 1/mass, それ以外は0）
+	Vector3 m_CenterOfMassLocal{ 0, 0, 0 }; // 重心座標
+	Vector3 m_CenterOfMassPositionWorld{ 0, 0, 0 }; // 中心座標
 	// --------------------------------------------------
-	// xEpx
+	// 速度・角速度
     // --------------------------------------------------
-	Vector3 m_Velocity{ 0, 0, 0 }; // `x
-	Vector3 m_ForceAccum{ 0, 0, 0 }; // ͂̐ϕ
-	Vector3 m_AngularVelocity{ 0, 0, 0 }; // px
-	Vector3 m_TorqueAccum{0, 0, 0}; // ݐσgN
+	Vector3 m_Velocity{ 0, 0, 0 }; // 線形速度
+	Vector3 m_ForceAccum{ 0, 0, 0 }; // 力の積分
+	Vector3 m_AngularVelocity{ 0, 0, 0 }; // 角速度
+	Vector3 m_TorqueAccum{0, 0, 0}; // 累積トルク
 	// --------------------------------------------------
-	// ̑xEpxiKinematic pj
+	// 見かけの速度・角速度（Kinematic 用）
 	// --------------------------------------------------
-	Vector3	   m_PrevPosition{ 0, 0, 0 };	// PȎx
-	Quaternion m_PrevRotation{ 0, 0, 0, 1}; // PỎ]
+	Vector3	   m_PrevPosition{ 0, 0, 0 };	// １つ前の速度
+	Quaternion m_PrevRotation{ 0, 0, 0, 1}; // １つ前の回転
 	Vector3 m_KinematicVelocity{ 0, 0, 0 };
 	Vector3 m_KinematicAngularVelocity{ 0, 0, 0 };
-	bool m_HasPrevKinematicPose = false; // Pt[ڗp
+	bool m_HasPrevKinematicPose = false; // １フレーム目用
 	// --------------------------------------------------
-	// ]ie\j
+	// 回転（慣性テンソル）
     // --------------------------------------------------
-	Matrix4x4 m_InertiaShapeInv  = Matrix4x4{} * 1.0f; // [Je\̋tsi[J劵łǂ̎₷\Bl傫قǁg₷hjipɊȂj
-	Matrix4x4 m_InertiaBodyInv  = Matrix4x4{} * 1.0f; // ItZbg]𔽉f̃[JipɊȂj
-	Matrix4x4 m_InertiaWorldInv {}; // [htsĩ[hɑ΂Ăǂꂾ₷\jipɊj
+	Matrix4x4 m_InertiaShapeInv  = Matrix4x4{} * 1.0f; // ローカル慣性テンソルの逆行列（ローカル主慣性軸でどの軸が回りやすいかを表す。値が大きいほど“回りやすい”）（姿勢に寄らない）
+	Matrix4x4 m_InertiaBodyInv  = Matrix4x4{} * 1.0f; // オフセット回転を反映した剛体ローカル（姿勢に寄らない）
+	Matrix4x4 m_InertiaWorldInv {}; // ワールド慣性逆行列（今のワールド軸に対してどれだけ回りやすいかを表す）（姿勢に寄る）
 	// --------------------------------------------------
-	// W
+	// 反発係数
     // --------------------------------------------------
-	float m_Restitution = 0.0f; // W
-	// --------------------------------------------------
-	// CE
-	// --------------------------------------------------
-	float m_FrictionDynamic = 0.45f;   // CW
-	float m_FrictionStatic  = 0.6f;   // Î~CW
-	float m_LinDamping = 0.5f; // `W[1/s]
-	float m_AngDamping = 0.5f; // pW  [1/s]
-	// --------------------------------------------------
-	// d
-	// --------------------------------------------------
-	GravityMode m_GravityMode = GravityMode::Global;  // FO[og
-	float		m_GravityScale = 1.0f;				  // PʏAOd
-	Vector3		m_CustomGravity{ 0.0f, -9.8f, 0.0f }; // CustomɎgx
+	float m_Restitution = 0.0f; // 反発係数
+	// --------------------------------------------------
+	// 摩擦・減衰
+	// --------------------------------------------------
+	float m_FrictionDynamic = 0.45f;   // 動摩擦係数μ
+	float m_FrictionStatic  = 0.6f;   // 静止摩擦係数μ
+	float m_LinDamping = 0.5f; // 線形減衰係数[1/s]
+	float m_AngDamping = 0.5f; // 角減衰係数  [1/s]
+	// --------------------------------------------------
+	// 重力
+	// --------------------------------------------------
+	GravityMode m_GravityMode = GravityMode::Global;  // 既定：グローバルを使う
+	float		m_GravityScale = 1.0f;				  // １＝通常、０＝無重力
+	Vector3		m_CustomGravity{ 0.0f, -9.8f, 0.0f }; // Custom時に使う加速度
+	// --------------------------------------------------
+	// スリープ
+	// 止まっている時間が続いたらアイランドごと眠らせる
+	// --------------------------------------------------
+	bool  m_IsSleeping = false; // 眠っているか
+	bool  m_CanSleep   = true;	// 眠ってよいか
+	float m_SleepTimer = 0.0f;	// 静止している時間[s]
+	uint32_t   m_SleepIslandId = 0;		   // 一緒に眠ったアイランド（０は無し）
+	Vector3	   m_SleepPosition{ 0, 0, 0 };   // 眠った時の姿勢（Transform の書き込み検出用）
+	Quaternion m_SleepRotation{ 0, 0, 0, 1 };
+	bool m_WakeRequested = false; // 起こす候補として PhysicsSystem に積んだ（次の BeginStep で見る）
+	int m_IslandIndex = -1; // アイランド構築時の作業用番号
+	int m_SolverIndex = -1; // ソルバーボディの番号（ステップ内の作業用）
+	// --------------------------------------------------
+	// 連続衝突判定（CCD）
+	// 速い物体が１ステップで薄い物をすり抜けないように、最初に当たった位置で止める
+	// --------------------------------------------------
+	bool m_UseContinuousCollision = false;
+	// --------------------------------------------------
+	// ソルバの反復回数（０はシーンの設定を使う）
+	// アイランドはメンバーの中で一番多い回数で解く
+	// --------------------------------------------------
+	int m_VelocityIterations = 0;
+	int m_PositionIterations = 0;
+	// --------------------------------------------------
+	// パイプライン実行（PhysicsSystem::SetPipelined）
+	// 物理スレッドは Transform ではなく m_Step～ の姿勢を読み書きして、SyncStep で Transform へ書き戻す
+	// m_StepStart～ は写したときの姿勢（走っている間にスクリプトが Transform を動かしたらそちらを残す）
+	// --------------------------------------------------
+	PhysicsSystem* m_pPhysics = nullptr; // 登録先（操作を溜めるか聞く）
+	Vector3	   m_StepPosition{ 0, 0, 0 };
+	Quaternion m_StepRotation{ 0, 0, 0, 1 };
+	Vector3	   m_StepStartPosition{ 0, 0, 0 };
+	Quaternion m_StepStartRotation{ 0, 0, 0, 1 };
+	bool m_StepPositionDirty = false;
+	bool m_StepRotationDirty = false;
+	// 走っている間に本体スレッドが読む値（KickStep で写す、物理スレッドが書いている本物は読まない）
+	Vector3 m_StepVelocity{ 0, 0, 0 };
+	Vector3 m_StepAngularVelocity{ 0, 0, 0 };
+	Vector3 m_StepKinematicVelocity{ 0, 0, 0 };
+	Vector3 m_StepKinematicAngularVelocity{ 0, 0, 0 };
+	bool m_StepIsSleeping = false;
+
+	friend class PhysicsSystem;
 
 	// ==================================================
-	// ----- wp֐ -----
+	// ----- 小ヘルパ関数 -----
 	// ==================================================
 	// --------------------------------------------------
-	// tʂ̍ČvZ 
+	// 逆質量の再計算 
 	// --------------------------------------------------
 	void RecalcInvMass() 
 	{
 		if (m_BodyType == BodyType::Dynamic && m_Mass > 0) m_InvMass = 1.0f / m_Mass;
 		else											   m_InvMass = 0.0f;
 	}
+	// --------------------------------------------------
+	// パイプライン実行中に本体スレッドから呼ばれた操作は、ステップの区切りまで溜める
+	// --------------------------------------------------
+	bool Defer(BodyCommand::Type type, const Vector3& a = {}, const Vector3& b = {}, int value = 0, int value2 = 0)
+	{
+		return m_pPhysics && m_pPhysics->DeferBodyCommand({ this, type, a, b, value, value2 });
+	}
+	bool DeferScalar(BodyCommand::Type type, float scalar)
+	{
+		return m_pPhysics && m_pPhysics->DeferBodyCommand({ this, type, {}, {}, 0, 0, scalar });
+	}
+	// 走っている間の本体スレッドは、写した値を読む
+	bool ReadsStepCopy() const { return m_pPhysics && m_pPhysics->IsStepInFlightOnMainThread(); }
+	// --------------------------------------------------
+	// 眠っている間に外から触られたら、起こす候補として PhysicsSystem に積む
+	// 眠っている剛体を毎ステップ見て回らないように、触った側から知らせる
+	// --------------------------------------------------
+	void RequestWake()
+	{
+		if (m_WakeRequested || !m_pPhysics) return;
+		m_WakeRequested = true;
+		m_pPhysics->RequestWake(this);
+	}
+	void RequestWakeIfSleeping() { if (m_SleepIslandId != 0) RequestWake(); }
 
 public:
 	// ==================================================
-    // ----- Zb^[EQb^[ -----
+    // ----- セッター・ゲッター -----
 	// ==================================================
     // --------------------------------------------------
-	// {fB^Cv
+	// ボディタイプ
     // --------------------------------------------------
-	void SetBodyType(BodyType bt) { m_BodyType = bt; RecalcInvMass(); }
-	void SetBodyTypeDynamic()   { m_BodyType = BodyType::Dynamic;   RecalcInvMass(); }
-	void SetBodyTypeKinematic() { m_BodyType = BodyType::Kinematic; RecalcInvMass(); }
-	void SetBodyTypeStatic()	{ m_BodyType = BodyType::Static;	RecalcInvMass(); }
+	void SetBodyType(BodyType bt) { if (Defer(BodyCommand::Type::SetBodyType, {}, {}, (int)bt)) return; m_BodyType = bt; RecalcInvMass(); if (m_pPhysics) m_pPhysics->MarkBroadphaseDirty(); RequestWakeIfSleeping(); } // ブロードフェーズの区分が変わる
+	void SetBodyTypeDynamic()   { SetBodyType(BodyType::Dynamic); }
+	void SetBodyTypeKinematic() { SetBodyType(BodyType::Kinematic); }
+	void SetBodyTypeStatic()	{ SetBodyType(BodyType::Static); }
 	BodyType GetBodyType()	const { return m_BodyType; }	// BodyType
 	bool  IsDynamic()		const { return m_BodyType == BodyType::Dynamic; }
 	bool  IsKinematic()		const { return m_BodyType == BodyType::Kinematic; }
 	bool  IsStatic()		const { return m_BodyType == BodyType::Static; }
 	// --------------------------------------------------
-	//  
+	// 質量 
 	// --------------------------------------------------	
-	void  SetMass(float m) { m_Mass = std::max(m, 0.0f); RecalcInvMass();} 
+	void  SetMass(float m) { if (DeferScalar(BodyCommand::Type::SetMass, m)) return; m_Mass = std::max(m, 0.0f); RecalcInvMass(); }
 	float Mass()	const  { return m_Mass; }
 	float InvMass()	const  { return m_InvMass; }
 	void  SetCenterOfMassLocal(const Vector3& c) { m_CenterOfMassLocal = c; }
 	const Vector3& CenterOfMassLocal() const { return m_CenterOfMassLocal; }
 	// --------------------------------------------------
-	// xEpx
+	// 速度・角速度
     // --------------------------------------------------
-	const Vector3& Velocity() const { return m_Velocity; }
-	void  SetVelocity(const Vector3& v) {m_Velocity = v; }
-	const Vector3& AngularVelocity() const { return m_AngularVelocity; }
-	void  SetAngularVelocity(const Vector3& v) { m_AngularVelocity = v; }
+	const Vector3& Velocity() const { return ReadsStepCopy() ? m_StepVelocity : m_Velocity; }
+	void  SetVelocity(const Vector3& v) { if (Defer(BodyCommand::Type::SetVelocity, v)) return; m_Velocity = v; RequestWakeIfSleeping(); }
+	const Vector3& AngularVelocity() const { return ReadsStepCopy() ? m_StepAngularVelocity : m_AngularVelocity; }
+	void  SetAngularVelocity(const Vector3& v) { if (Defer(BodyCommand::Type::SetAngularVelocity, v)) return; m_AngularVelocity = v; RequestWakeIfSleeping(); }
 	// --------------------------------------------------
-	// ̑xEpxiKinematic pj
+	// 見かけの速度・角速度（Kinematic 用）
 	// --------------------------------------------------
 	const Vector3& PrevPosition() const { return m_PrevPosition; }
 	void SetPrevPosition(const Vector3& pos) { m_PrevPosition = pos; }
 	const Quaternion& PrevRotation() const { return m_PrevRotation; }
 	void SetPrevRotation(const Quaternion& q) { m_PrevRotation = q; }
-	const Vector3& KinematicVelocity() const { return m_KinematicVelocity; }
+	const Vector3& KinematicVelocity() const { return ReadsStepCopy() ? m_StepKinematicVelocity : m_KinematicVelocity; }
 	void SetKinematicVelocity(const Vector3& v) { m_KinematicVelocity = v; }
-	const Vector3& KinematicAngularVelocity() const { return m_KinematicAngularVelocity; }
+	const Vector3& KinematicAngularVelocity() const { return ReadsStepCopy() ? m_StepKinematicAngularVelocity : m_KinematicAngularVelocity; }
 	void SetKinematicAngularVelocity(const Vector3& v) { m_KinematicAngularVelocity = v; }
 	bool HasPrevKinematicPose() const { return m_HasPrevKinematicPose; }
 	void SetHasPrevKinematicPose(bool b) { m_HasPrevKinematicPose = b; }
 	// --------------------------------------------------
-	// xEpx̎擾API
-	// Kinematic ͌̑xԂ
+	// 速度・角速度の取得API
+	// Kinematic は見かけの速度を返す
 	// --------------------------------------------------
 	Vector3 GetLinearVelocitySolver() const
 	{
@@ -162,72 +230,93 @@ public:
 		return Vector3{0, 0, 0};
 	}
 	// --------------------------------------------------
-	// ]ie\j
+	// 回転（慣性テンソル）
 	// --------------------------------------------------
 	void             SetInertiaShapeInv(const Matrix4x4& invLocal) { m_InertiaShapeInv = invLocal; }
 	const Matrix4x4& InertiaShapeInv() const { return m_InertiaShapeInv; }
 	const Matrix4x4& InertiaWorldInv() const { return m_InertiaWorldInv; }
 	// --------------------------------------------------
-	// W
+	// 反発係数
 	// --------------------------------------------------
 	float Restitution() const { return m_Restitution; }
-	void  SetRestitution(float e)  { m_Restitution = e; } 
+	void  SetRestitution(float e)  { if (DeferScalar(BodyCommand::Type::SetRestitution, e)) return; m_Restitution = e; }
 	// --------------------------------------------------
-	// CE
+	// 摩擦・減衰
 	// --------------------------------------------------
-	float FrictionDynamic() const { return m_FrictionDynamic; }  // C
-	void  SetFrictionDynamic(float f) { m_FrictionDynamic = f; }
-	float FrictionStatic() const { return m_FrictionStatic; }	 // Î~C
-	void  SetFrictionStatic(float f) { m_FrictionStatic = f; }
-	float LinDamping() const { return m_LinDamping; }	// `
-	void  SetLinDamping(float d) { m_LinDamping = d; }
-	float AngDamping() const { return m_AngDamping; }	// px
-	void  SetAngDamping(float d) { m_AngDamping = std::max(0.0f, d); }
+	float FrictionDynamic() const { return m_FrictionDynamic; }  // 動摩擦力
+	void  SetFrictionDynamic(float f) { if (DeferScalar(BodyCommand::Type::SetFrictionDynamic, f)) return; m_FrictionDynamic = f; }
+	float FrictionStatic() const { return m_FrictionStatic; }	 // 静止摩擦力
+	void  SetFrictionStatic(float f) { if (DeferScalar(BodyCommand::Type::SetFrictionStatic, f)) return; m_FrictionStatic = f; }
+	float LinDamping() const { return m_LinDamping; }	// 線形減衰
+	void  SetLinDamping(float d) { if (DeferScalar(BodyCommand::Type::SetLinDamping, d)) return; m_LinDamping = d; }
+	float AngDamping() const { return m_AngDamping; }	// 角速度減衰
+	void  SetAngDamping(float d) { if (DeferScalar(BodyCommand::Type::SetAngDamping, d)) return; m_AngDamping = std::max(0.0f, d); }
 	// --------------------------------------------------
-	// d
+	// 重力
 	// --------------------------------------------------
-	void SetGravityMode(GravityMode m) { m_GravityMode = m; }
+	void SetGravityMode(GravityMode m) { if (Defer(BodyCommand::Type::SetGravityMode, {}, {}, (int)m)) return; m_GravityMode = m; }
 	GravityMode GravityMode() const { return m_GravityMode; }
-	void SetGravityScale(float f) { m_GravityScale = f; }
+	void SetGravityScale(float f) { if (DeferScalar(BodyCommand::Type::SetGravityScale, f)) return; m_GravityScale = f; }
 	float GravityScale() const { return m_GravityScale; }
-	void SetCustomGravity(const Vector3& g) { m_CustomGravity = g; }
+	void SetCustomGravity(const Vector3& g) { if (Defer(BodyCommand::Type::SetCustomGravity, g)) return; m_CustomGravity = g; }
 	Vector3 CustomGravity() const { return m_CustomGravity; }
+	// --------------------------------------------------
+	// スリープ
+	// 起こすのは AddForce, ApplyImpulse 等と PhysicsSystem（接触、Transform の書き込み）
+	// --------------------------------------------------
+	bool IsSleeping() const { return ReadsStepCopy() ? m_StepIsSleeping : m_IsSleeping; }
+	void WakeUp() { if (Defer(BodyCommand::Type::WakeUp)) return; m_IsSleeping = false; m_SleepTimer = 0.0f; RequestWakeIfSleeping(); } // アイランドごと起こすのは次の BeginStep
+	void SetCanSleep(bool b) { if (Defer(BodyCommand::Type::SetCanSleep, {}, {}, b ? 1 : 0)) return; m_CanSleep = b; if (!b) WakeUp(); }
+	bool CanSleep() const { return m_CanSleep; }
+	// --------------------------------------------------
+	// 連続衝突判定（CCD）
+	// 弾やブーメランなど、速くて小さいものだけ on にする
+	// --------------------------------------------------
+	void SetContinuousCollision(bool b) { if (Defer(BodyCommand::Type::SetContinuousCollision, {}, {}, b ? 1 : 0)) return; m_UseContinuousCollision = b; }
+	bool IsContinuousCollision() const { return m_UseContinuousCollision; }
+	// --------------------------------------------------
+	// ソルバの反復回数
+	// 積み上げの土台やラグドールなど、収束しにくいものだけ増やす
+	// --------------------------------------------------
+	void SetSolverIterations(int velocity, int position) { if (Defer(BodyCommand::Type::SetSolverIterations, {}, {}, velocity, position)) return; m_VelocityIterations = std::max(0, velocity); m_PositionIterations = std::max(0, position); }
+	int  VelocityIterations() const { return m_VelocityIterations; }
+	int  PositionIterations() const { return m_PositionIterations; }
 
 	// ==================================================
-	// ----- e\֌W -----
+	// ----- 慣性テンソル関係 -----
 	// ==================================================
 	// --------------------------------------------------
-	// InertiaLocalInv ݂̎pōXV
+	// InertiaLocalInv を現在の姿勢で更新
 	// --------------------------------------------------
 	void UpdateInertiaWorldInvFrom(const Quaternion& worldQ)
 	{
-		Matrix4x4 R = worldQ.ToMatrix().RotationNormalized(); // ]s
-		Matrix4x4 Rt = R.Transpose(); // tsi]sȂ̂œ]uj
+		Matrix4x4 R = worldQ.ToMatrix().RotationNormalized(); // 純回転行列
+		Matrix4x4 Rt = R.Transpose(); // 逆行列（純回転行列なので転置）
 		m_InertiaWorldInv = Rt * m_InertiaBodyInv * R;
 	}
 	// --------------------------------------------------
-	// gNpx̊pvZƂ̃wpiInertiaInvKpj
+	// トルク→角加速度の角項を計算するときのヘルパ（InertiaInvを適用させる）
 	// --------------------------------------------------
 	Vector3 ApplyInvInertiaWorld(const Vector3& v) const
 	{
 		if (!IsDynamic()) return Vector3();
-		return m_InertiaWorldInv.TransformNormal(v); // 3x3 |
+		return m_InertiaWorldInv.TransformNormal(v); // 3x3 部分だけを掛ける
 	}
 	// --------------------------------------------------
-	// InertiaBodyInv ̌vZ
+	// InertiaBodyInv の計算
 	// --------------------------------------------------
 	void UpdateInertiaBodyInvFromOffset(const Quaternion& offsetQ)
 	{
 		Quaternion q = offsetQ.normalized();
-		// offset ]
+		// offset 回転
 		Matrix4x4 R = q.ToMatrix().RotationNormalized();
 		Matrix4x4 Rt = R.Transpose();
 		
-		// `厲(Shape)  ̃[J(Body)։
+		// 形状主軸(Shape) → 剛体ローカル(Body)へ回す
 		m_InertiaBodyInv = Rt * m_InertiaShapeInv * R; // Ibody^(-1) = offsetR^(T) * Ishape^(-1) * offsetR
 	}
 	// --------------------------------------------------
-	// InertiaShapeInv ̌vZ
+	// InertiaShapeInv の計算
 	// --------------------------------------------------
 	void ComputeBoxInertia(const Vector3& half) { ComputeBoxInertia(half, m_Mass); }
 	void ComputeBoxInertia(const Vector3& half, float mass)
@@ -237,7 +326,7 @@ public:
 		float Iy = (mass / 12.0f) * (c * c + a * a);
 		float Iz = (mass / 12.0f) * (a * a + b * b);
 		m_InertiaShapeInv.identity();
-		m_InertiaShapeInv.m[0][0] = 1.0f / Ix; // t
+		m_InertiaShapeInv.m[0][0] = 1.0f / Ix; // 逆数
 		m_InertiaShapeInv.m[1][1] = 1.0f / Iy; 
 		m_InertiaShapeInv.m[2][2] = 1.0f / Iz; 
 	}
@@ -252,7 +341,7 @@ public:
 	}
 
 	// --------------------------------------------------
-	// CenterOfMass [h֕ϊi݂OnAddedŃLbVĂj
+	// CenterOfMass をワールドへ変換（現在はOnAddedでキャッシュしてる）
 	// --------------------------------------------------
 	void SetWorldCOM(const Vector3& pos) { m_CenterOfMassPositionWorld = pos; }
 	Vector3 WorldCOM() const
@@ -261,35 +350,41 @@ public:
 	}
 
 	// ==================================================
-	// ----- Force ֌W -----
+	// ----- Force 関係 -----
 	// ==================================================
 	// --------------------------------------------------
-	// ͂
+	// 力を加える
 	// --------------------------------------------------
 	void AddForce(const Vector3& f) 
 	{ 
+		if (Defer(BodyCommand::Type::AddForce, f)) return;
 		m_ForceAccum += f; 
+		WakeUp();
 	}
 	// --------------------------------------------------
-	// CpX
+	// インパルス
 	// --------------------------------------------------
 	void ApplyImpulse(const Vector3& P)
 	{
+		if (Defer(BodyCommand::Type::ApplyImpulse, P)) return;
 		if (!IsDynamic()) return;
 		m_Velocity += P * m_InvMass;
+		WakeUp();
 	}
 	// --------------------------------------------------
-	// CpXiWwj
+	// インパルス（座標指定）
 	// --------------------------------------------------
 	void ApplyImpulseAtPoint(const Vector3& P, const Vector3& worldP)
 	{
+		if (Defer(BodyCommand::Type::ApplyImpulseAtPoint, P, worldP)) return;
 		if (!IsDynamic()) return;
 		m_Velocity += P * m_InvMass;
 		const Vector3 r = worldP - WorldCOM();
 		m_AngularVelocity += ApplyInvInertiaWorld(Vector3::Cross(r, P));
+		WakeUp();
 	}
 	// --------------------------------------------------
-	// ͂̏
+	// 力の消費
 	// --------------------------------------------------
 	Vector3 ConsumeForces() 
 	{ 
@@ -297,35 +392,39 @@ public:
 	} 
 
 	// ==================================================
-	// ----- Torque ֌W -----
+	// ----- Torque 関係 -----
 	// ==================================================
 	// --------------------------------------------------
-	// ]^
+	// 回転を与える
 	// --------------------------------------------------
 	void AddTorque(const Vector3& tau) 
 	{
+		if (Defer(BodyCommand::Type::AddTorque, tau)) return;
 		if (!IsDynamic()) return;
 		m_TorqueAccum += tau;
+		WakeUp();
 	}
 	// --------------------------------------------------
-	// ]^
-	// F : EW̗̓xNg[N]
-	// WorldP : ̗͂鐢EW̓_[m]
+	// 回転を与える
+	// F : 世界座標の力ベクトル[N]
+	// WorldP : その力を加える世界座標上の点[m]
 	// --------------------------------------------------
 	void AddForceAtPoint(const Vector3& F, const Vector3& worldP)
 	{
+		if (Defer(BodyCommand::Type::AddForceAtPoint, F, worldP)) return;
 		if (!IsDynamic()) return;
 
-		// `
+		// 線形
 		m_ForceAccum += F;
 
-		// gN
-		const Vector3 r = worldP - WorldCOM(); // S̃xNg
-		const Vector3 tau = Vector3::Cross(r, F); // ɈˑăgN̑傫ς
+		// トルク
+		const Vector3 r = worldP - WorldCOM(); // 中心からのベクトル
+		const Vector3 tau = Vector3::Cross(r, F); // 距離に依存してトルクの大きさが変わる
 		m_TorqueAccum += tau;
+		WakeUp();
 	}
 	// --------------------------------------------------
-	// gN̏
+	// トルクの消費
 	// --------------------------------------------------
 	Vector3 ConsumeTorques() 
 	{ 
@@ -333,20 +432,20 @@ public:
 	} 
 
 	// ==================================================
-	// ----- CtTCN -----
+	// ----- ライフサイクル -----
 	// ==================================================
 	void OnAdded() override
 	{
-		// o^
+		// 登録する
 		Manager::GetScene()->physicsSystem().RegisterRigidbody(this);
 
 		auto* tr = Owner()->GetComponent<TransformComponent>();
 		m_CenterOfMassPositionWorld = tr->Position() + tr->Rotation().Rotate(m_CenterOfMassLocal);
-		//tr->WorldMatrix().TransformPoint(m_CenterOfMassLocal); // 
+		//tr->WorldMatrix().TransformPoint(m_CenterOfMassLocal); // 旧
 	}
-	void FixedUpdate(float dt) override
+	void FixedUpdate(float /*dt*/) override
 	{
-		//  Transform Ɠ
+		// ここで Transform と同期
 		//if (!IsDynamic())
 		{
 			auto* tr = Owner()->GetComponent<TransformComponent>();
@@ -355,9 +454,14 @@ public:
 	}
 	void Uninit() override
 	{
-		// 폜
+		// 削除処理
 		Manager::GetScene()->physicsSystem().UnregisterRigidbody(this);
 	}
+	void OnTransformMoved() override
+	{
+		// 眠っている間だけ Transform を見張っている（PhysicsSystem が付け外しする）
+		RequestWake();
+	}
 };
 
 #endif
\ No newline at end of file
@@ -50,30 +50,30 @@ void SandbagObject::Init()
 	m_pProvider = AddComponent<SkinMatrixProviderComponent>();
 	m_pProvider->SetUp(&m_Skeleton, animator, m_pBoneManager, Transform());
 	m_pProvider->SetMode(SkinMatrixProviderComponent::Mode::Hybrid);
-	SetupBones(); // ̐ݒ
+	SetupBones(); // 骨の設定
 
 
 	// MeshRenderer
 	auto* mr = AddComponent<MeshRendererComponent>();
 
-	// Slot 
+	// Slot 数
 	const int slotCount = mf->MaterialSlotCount();
 	mr->ResizeMaterialSlots(slotCount);
 
-	// ʃVF[_[
+	// 共通シェーダー
 	ID3D11VertexShader* vs = nullptr;
 	ID3D11PixelShader* ps = nullptr;
 	ID3D11InputLayout* il = nullptr;
 	Renderer::CreateVertexShader(&vs, &il, "shader\\VS_Skinned.cso", Renderer::VertexLayoutType::Skinned);
 	Renderer::CreatePixelShader(&ps, "shader\\PS_Toon.cso");
 
-	// ʃ}eA萔
+	// 共通マテリアル定数
 	MaterialApp m{};
 	m.diffuse = Vector4(1, 1, 1, 1);
 	m.ambient = Vector4(1, 1, 1, 1);
 	m.textureEnable = true;
 
-	// slot Ƃ MaterialComponent  srv h
+	// slot ごとに MaterialComponent を作って srv を刺す
 	for (int slot = 0; slot < slotCount; slot++)
 	{
 		auto* mat = AddComponent<MaterialComponent>();
@@ -93,7 +93,7 @@ void SandbagObject::Init()
 	if (slotCount > 0)
 		mr->SetBaseMaterial(mr->GetMaterialSlot(0));
 
-	// AEgC}eAǉ
+	// アウトラインマテリアル追加
 	auto* matOutline = AddComponent<MaterialComponent>();
 	Renderer::CreateVertexShader(&vs, &il, "shader\\VS_SkinnedOutline.cso", Renderer::VertexLayoutType::Skinned);
 	Renderer::CreatePixelShader(&ps, "shader\\PS_Outline.cso");
@@ -113,7 +113,7 @@ void SandbagObject::Update(float dt)
 {
 	GameObject::Update(dt);
 
-	// ----- Aj[VĐ -----
+	// ----- アニメーション再生 -----
 	auto* animator = GetComponent<AnimatorComponent>();
 	auto* provider = GetComponent<SkinMatrixProviderComponent>();
 	if (m_pProvider->IsAniamtion())
@@ -135,15 +135,15 @@ void SandbagObject::SetupBones()
 {
 	auto* animator = GetComponent<AnimatorComponent>();
 
-	// ܂͍̈ʒu𑵂
+	// まずは骨の位置を揃える
 	animator->EvaluateNow();
 	m_pBoneManager->UpdateFromAnimator(animator->ModelMatrixes(), nullptr);
 
-	// ̐ݒ
+	// 骨の設定
 	const int indexFirst = 0;
 	const int indexSecond = 1;
 
-	// ̍
+	// 上の骨
 	{
 		m_pBoneManager->SetBonePhysics(indexFirst, true, false);
 		m_pProvider->SetBonePhysics(indexFirst, true);
@@ -153,7 +153,7 @@ void SandbagObject::SetupBones()
 		coll->SetOffsetPosition({ 0, 0.0f, 0.0f });
 
 	}
-	// ̍
+	// 下の骨
 	{
 		m_pBoneManager->SetBonePhysics(indexSecond, true, true);
 		m_pProvider->SetBonePhysics(indexSecond, true);
@@ -164,7 +164,7 @@ void SandbagObject::SetupBones()
 		auto* rigid = bone->GetComponent<Rigidbody>();
 		rigid->SetMass(10);
 	}
-	// WCgݒ
+	// ジョイント設定
 	{
 		auto* bone = m_pBoneManager->GetBoneObject(indexFirst);
 		auto* joint = bone->AddComponent<BallJointComponent>();
@@ -0,0 +1,336 @@
+/*
+	ShapeDispatch.cpp
+	20261017  hanaue sho
+	ナローフェーズの形状ディスパッチ（形状の種類 × 種類の関数テーブル）
+*/
+#include <assert.h>
+#include <math.h>
+#include <algorithm>
+#include <vector>
+#include "ShapeDispatch.h"
+#include "collision.h"
+#include "ContactManifold.h"
+
+// ==================================================
+// ヘルパ
+// ==================================================
+namespace
+{
+	// --------------------------------------------------
+	// 種類 → 形状クラス
+	// Load: レコードから形状を取り出す（Box / Sphere / Capsule はスタックに作り直す）
+	// Hit : 相手（self）の isOverlapWithX を仮想関数を通さずに呼ぶ
+	// --------------------------------------------------
+	template<ColliderType T> struct ShapeTraits;
+	template<> struct ShapeTraits<ColliderType::Box>
+	{
+		static BoxCollision Load(const ShapeRecord& r) { return BoxCollision(Vector3(r.param[0], r.param[1], r.param[2])); }
+		template<class Self> static bool Hit(const Self& self, const ColliderPose& myTrans, const BoxCollision& other, const ColliderPose& trans, ContactManifold& out, float slop)
+		{ return self.Self::isOverlapWithBox(myTrans, other, trans, out, slop); }
+	};
+	template<> struct ShapeTraits<ColliderType::Sphere>
+	{
+		static SphereCollision Load(const ShapeRecord& r) { return SphereCollision(r.param[0]); }
+		template<class Self> static bool Hit(const Self& self, const ColliderPose& myTrans, const SphereCollision& other, const ColliderPose& trans, ContactManifold& out, float slop)
+		{ return self.Self::isOverlapWithSphere(myTrans, other, trans, out, slop); }
+	};
+	template<> struct ShapeTraits<ColliderType::Capsule>
+	{
+		static CapsuleCollision Load(const ShapeRecord& r) { return CapsuleCollision(r.param[0], r.param[1]); }
+		template<class Self> static bool Hit(const Self& self, const ColliderPose& myTrans, const CapsuleCollision& other, const ColliderPose& trans, ContactManifold& out, float slop)
+		{ return self.Self::isOverlapWithCapsule(myTrans, other, trans, out, slop); }
+	};
+	template<> struct ShapeTraits<ColliderType::MeshField>
+	{
+		static const HeightMapCollision& Load(const ShapeRecord& r) { return static_cast<const HeightMapCollision&>(*r.shape); }
+		template<class Self> static bool Hit(const Self& self, const ColliderPose& myTrans, const HeightMapCollision& other, const ColliderPose& trans, ContactManifold& out, float slop)
+		{ return self.Self::isOverlapWithHeightMap(myTrans, other, trans, out, slop); }
+	};
+	template<> struct ShapeTraits<ColliderType::TriangleMesh>
+	{
+		static const TriangleMeshCollision& Load(const ShapeRecord& r) { return static_cast<const TriangleMeshCollision&>(*r.shape); }
+		template<class Self> static bool Hit(const Self& self, const ColliderPose& myTrans, const TriangleMeshCollision& other, const ColliderPose& trans, ContactManifold& out, float slop)
+		{ return self.Self::isOverlapWithTriangleMesh(myTrans, other, trans, out, slop); }
+	};
+	template<> struct ShapeTraits<ColliderType::ConvexHull>
+	{
+		static const ConvexHullCollision& Load(const ShapeRecord& r) { return static_cast<const ConvexHullCollision&>(*r.shape); }
+		template<class Self> static bool Hit(const Self& self, const ColliderPose& myTrans, const ConvexHullCollision& other, const ColliderPose& trans, ContactManifold& out, float slop)
+		{ return self.Self::isOverlapWithConvexHull(myTrans, other, trans, out, slop); }
+	};
+
+	// --------------------------------------------------
+	// A × B の判定
+	// A->isOverlap(B) は B.isOverlapWithA(B, A) を呼ぶので、同じ向きで呼ぶ（法線は A → B）
+	// --------------------------------------------------
+	template<ColliderType A, ColliderType B>
+	bool OverlapPair(const ShapeRecord& a, const ShapeRecord& b, ContactManifold& out, float slop)
+	{
+		decltype(auto) shapeA = ShapeTraits<A>::Load(a);
+		decltype(auto) shapeB = ShapeTraits<B>::Load(b);
+		return ShapeTraits<A>::Hit(shapeB, b.pose, shapeA, a.pose, out, slop);
+	}
+	// 球 × 球は一番多い組なので、形状を作り直さずにレコードから直接計算する
+	template<>
+	bool OverlapPair<ColliderType::Sphere, ColliderType::Sphere>(const ShapeRecord& a, const ShapeRecord& b, ContactManifold& out, float slop)
+	{
+		return SphereCollision::OverlapSpheres(b.pose.position, b.param[0] * b.pose.scale.x, a.pose.position, a.param[0] * a.pose.scale.x, out, slop);
+	}
+
+	// --------------------------------------------------
+	// テーブル（行が A、列が B）
+	// --------------------------------------------------
+	template<ColliderType A>
+	void FillRow(ShapeDispatch::OverlapFn* row)
+	{
+		row[(int)ColliderType::Box]			 = &OverlapPair<A, ColliderType::Box>;
+		row[(int)ColliderType::Sphere]		 = &OverlapPair<A, ColliderType::Sphere>;
+		row[(int)ColliderType::Capsule]		 = &OverlapPair<A, ColliderType::Capsule>;
+		row[(int)ColliderType::MeshField]	 = &OverlapPair<A, ColliderType::MeshField>;
+		row[(int)ColliderType::TriangleMesh] = &OverlapPair<A, ColliderType::TriangleMesh>;
+		row[(int)ColliderType::ConvexHull]	 = &OverlapPair<A, ColliderType::ConvexHull>;
+	}
+	struct OverlapTable
+	{
+		ShapeDispatch::OverlapFn fn[ShapeDispatch::TypeCount * ShapeDispatch::TypeCount] = {};
+		OverlapTable()
+		{
+			constexpr int N = ShapeDispatch::TypeCount;
+			static_assert(N == 6, "add the new shape type to OverlapTable");
+			FillRow<ColliderType::Box>			(fn + N * (int)ColliderType::Box);
+			FillRow<ColliderType::Sphere>		(fn + N * (int)ColliderType::Sphere);
+			FillRow<ColliderType::Capsule>		(fn + N * (int)ColliderType::Capsule);
+			FillRow<ColliderType::MeshField>	(fn + N * (int)ColliderType::MeshField);
+			FillRow<ColliderType::TriangleMesh>	(fn + N * (int)ColliderType::TriangleMesh);
+			FillRow<ColliderType::ConvexHull>	(fn + N * (int)ColliderType::ConvexHull);
+		}
+	};
+	const OverlapTable s_OverlapTable;
+}
+const ShapeDispatch::OverlapFn* const ShapeDispatch::OverlapFns = s_OverlapTable.fn;
+namespace
+{
+	// --------------------------------------------------
+	// 重なっているかだけの判定
+	// スケールの扱い（符号を取るかどうかまで）は組ごとに Collision の isOverlapWithX に合わせる
+	// 半径が負になる鏡像のスケールでも Overlap と同じ答えにするため
+	// --------------------------------------------------
+	float SphereRadius(const ShapeRecord& r) { return r.param[0] * fabsf(r.pose.scale.x); } // 球 × 箱
+	float SphereRadiusSigned(const ShapeRecord& r) { return r.param[0] * r.pose.scale.x; }	// 球 × 球、球 × カプセル
+	Vector3 BoxHalf(const ShapeRecord& r)
+	{
+		return Vector3(r.param[0] * fabsf(r.pose.scale.x), r.param[1] * fabsf(r.pose.scale.y), r.param[2] * fabsf(r.pose.scale.z));
+	}
+
+	// カプセルの線分の両端と半径
+	// 線分が潰れているときは Overlap と同じく球として扱う（半径は scale.x）
+	void CapsuleSegment(const ShapeRecord& r, Vector3& p0, Vector3& p1, float& radius)
+	{
+		const Vector3 up = r.pose.WorldUp();
+		const float halfCylinder = r.param[1] * r.pose.scale.y * 0.5f;
+		p0 = r.pose.position + up * halfCylinder;
+		p1 = r.pose.position - up * halfCylinder;
+		radius = (p0 - p1).lengthSq() < 1e-8f ? r.param[0] * r.pose.scale.x : r.param[0] * std::max(r.pose.scale.x, r.pose.scale.z);
+	}
+
+	// 球 × 球
+	bool IntersectSphereSphere(const ShapeRecord& a, const ShapeRecord& b)
+	{
+		const float sum = SphereRadiusSigned(a) + SphereRadiusSigned(b);
+		return sum >= 0.0f && (b.pose.position - a.pose.position).lengthSq() <= sum * sum;
+	}
+	// 球 × 箱（箱の上の最近点までの距離）
+	bool IntersectSphereBox(const ShapeRecord& sphere, const ShapeRecord& box)
+	{
+		const Vector3 axes[3] = { box.pose.WorldRight(), box.pose.WorldUp(), box.pose.WorldForward() };
+		const Vector3 half = BoxHalf(box);
+		const Vector3 d = sphere.pose.position - box.pose.position;
+		float distSq = 0.0f;
+		for (int i = 0; i < 3; i++)
+		{
+			const float t = Vector3::Dot(d, axes[i]);
+			const float e = (&half.x)[i];
+			if		(t >  e) distSq += (t - e) * (t - e);
+			else if (t < -e) distSq += (t + e) * (t + e);
+		}
+		const float r = SphereRadius(sphere);
+		return distSq <= r * r;
+	}
+	bool IntersectBoxSphere(const ShapeRecord& a, const ShapeRecord& b) { return IntersectSphereBox(b, a); }
+	// 球 × カプセル（線分上の最近点までの距離）
+	bool IntersectSphereCapsule(const ShapeRecord& sphere, const ShapeRecord& capsule)
+	{
+		Vector3 p0, p1;
+		float radius;
+		CapsuleSegment(capsule, p0, p1, radius);
+		const Vector3 c = sphere.pose.position;
+		const Vector3 seg = p1 - p0;
+		const float lenSq = seg.lengthSq();
+		const float t = lenSq > 1e-12f ? std::clamp(Vector3::Dot(c - p0, seg) / lenSq, 0.0f, 1.0f) : 0.0f;
+		const float sum = SphereRadiusSigned(sphere) + radius;
+		return sum >= 0.0f && (c - (p0 + seg * t)).lengthSq() <= sum * sum;
+	}
+	bool IntersectCapsuleSphere(const ShapeRecord& a, const ShapeRecord& b) { return IntersectSphereCapsule(b, a); }
+	// カプセル × カプセル（線分同士の最近点の距離）
+	bool IntersectCapsuleCapsule(const ShapeRecord& a, const ShapeRecord& b)
+	{
+		Vector3 p0, p1, q0, q1;
+		float radiusA, radiusB;
+		CapsuleSegment(a, p0, p1, radiusA);
+		CapsuleSegment(b, q0, q1, radiusB);
+		const Vector3 d1 = p1 - p0, d2 = q1 - q0, r = p0 - q0;
+		const float aa = d1.lengthSq(), ee = d2.lengthSq(), f = Vector3::Dot(d2, r);
+		constexpr float Epsilon = 1e-12f;
+		float s = 0.0f, t = 0.0f;
+		if (aa <= Epsilon && ee <= Epsilon) {} // どっちも点
+		else if (aa <= Epsilon) t = std::clamp(f / ee, 0.0f, 1.0f);
+		else
+		{
+			const float c = Vector3::Dot(d1, r);
+			if (ee <= Epsilon) s = std::clamp(-c / aa, 0.0f, 1.0f);
+			else
+			{
+				const float bb = Vector3::Dot(d1, d2);
+				const float denom = aa * ee - bb * bb; // 平行なら 0
+				s = denom > Epsilon ? std::clamp((bb * f - c * ee) / denom, 0.0f, 1.0f) : 0.0f;
+				t = (bb * s + f) / ee;
+				if		(t < 0.0f) { t = 0.0f; s = std::clamp(-c / aa, 0.0f, 1.0f); }
+				else if (t > 1.0f) { t = 1.0f; s = std::clamp((bb - c) / aa, 0.0f, 1.0f); }
+			}
+		}
+		const float sum = radiusA + radiusB;
+		return sum >= 0.0f && ((p0 + d1 * s) - (q0 + d2 * t)).lengthSq() <= sum * sum;
+	}
+	// 箱 × 箱（分離軸 15 本、見つかった時点で抜ける）
+	bool IntersectBoxBox(const ShapeRecord& a, const ShapeRecord& b)
+	{
+		const Vector3 axA[3] = { a.pose.WorldRight(), a.pose.WorldUp(), a.pose.WorldForward() };
+		const Vector3 axB[3] = { b.pose.WorldRight(), b.pose.WorldUp(), b.pose.WorldForward() };
+		const Vector3 hA = BoxHalf(a), hB = BoxHalf(b);
+		const float* ea = &hA.x;
+		const float* eb = &hB.x;
+
+		// B の軸を A の軸で表した回転（平行な辺の外積が潰れないように少し足す）
+		constexpr float Epsilon = 1e-6f;
+		float R[3][3], absR[3][3];
+		for (int i = 0; i < 3; i++)
+			for (int j = 0; j < 3; j++)
+			{
+				R[i][j] = Vector3::Dot(axA[i], axB[j]);
+				absR[i][j] = fabsf(R[i][j]) + Epsilon;
+			}
+		const Vector3 d = b.pose.position - a.pose.position;
+		const float t[3] = { Vector3::Dot(d, axA[0]), Vector3::Dot(d, axA[1]), Vector3::Dot(d, axA[2]) };
+
+		// A の面
+		for (int i = 0; i < 3; i++)
+			if (fabsf(t[i]) > ea[i] + eb[0] * absR[i][0] + eb[1] * absR[i][1] + eb[2] * absR[i][2]) return false;
+		// B の面
+		for (int j = 0; j < 3; j++)
+		{
+			const float tj = t[0] * R[0][j] + t[1] * R[1][j] + t[2] * R[2][j];
+			if (fabsf(tj) > ea[0] * absR[0][j] + ea[1] * absR[1][j] + ea[2] * absR[2][j] + eb[j]) return false;
+		}
+		// 辺 × 辺
+		for (int i = 0; i < 3; i++)
+		{
+			const int i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+			for (int j = 0; j < 3; j++)
+			{
+				const int j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+				const float ra = ea[i1] * absR[i2][j] + ea[i2] * absR[i1][j];
+				const float rb = eb[j1] * absR[i][j2] + eb[j2] * absR[i][j1];
+				if (fabsf(t[i2] * R[i1][j] - t[i1] * R[i2][j]) > ra + rb) return false;
+			}
+		}
+		return true;
+	}
+	// 直接の判定が無い組は接触点を作って捨てる（Overlap と必ず同じ答えになるように）
+	template<ColliderType A, ColliderType B>
+	bool IntersectByOverlap(const ShapeRecord& a, const ShapeRecord& b)
+	{
+		ContactManifold m;
+		return OverlapPair<A, B>(a, b, m, 0.0f);
+	}
+
+	template<ColliderType A>
+	void FillIntersectRow(ShapeDispatch::IntersectFn* row)
+	{
+		row[(int)ColliderType::Box]			 = &IntersectByOverlap<A, ColliderType::Box>;
+		row[(int)ColliderType::Sphere]		 = &IntersectByOverlap<A, ColliderType::Sphere>;
+		row[(int)ColliderType::Capsule]		 = &IntersectByOverlap<A, ColliderType::Capsule>;
+		row[(int)ColliderType::MeshField]	 = &IntersectByOverlap<A, ColliderType::MeshField>;
+		row[(int)ColliderType::TriangleMesh] = &IntersectByOverlap<A, ColliderType::TriangleMesh>;
+		row[(int)ColliderType::ConvexHull]	 = &IntersectByOverlap<A, ColliderType::ConvexHull>;
+	}
+	struct IntersectTable
+	{
+		ShapeDispatch::IntersectFn fn[ShapeDispatch::TypeCount * ShapeDispatch::TypeCount] = {};
+		IntersectTable()
+		{
+			constexpr int N = ShapeDispatch::TypeCount;
+			static_assert(N == 6, "add the new shape type to IntersectTable");
+			FillIntersectRow<ColliderType::Box>			(fn + N * (int)ColliderType::Box);
+			FillIntersectRow<ColliderType::Sphere>		(fn + N * (int)ColliderType::Sphere);
+			FillIntersectRow<ColliderType::Capsule>		(fn + N * (int)ColliderType::Capsule);
+			FillIntersectRow<ColliderType::MeshField>	(fn + N * (int)ColliderType::MeshField);
+			FillIntersectRow<ColliderType::TriangleMesh>(fn + N * (int)ColliderType::TriangleMesh);
+			FillIntersectRow<ColliderType::ConvexHull>	(fn + N * (int)ColliderType::ConvexHull);
+
+			// Overlap と同じ距離を正確に出せる組だけ直接
+			// Box × Capsule は Overlap が近似、凸包は Overlap が最小の離れ（minSep）を見るので、接触点を作る方に任せる
+			fn[ShapeDispatch::PairIndex(ColliderType::Sphere, ColliderType::Sphere)] = &IntersectSphereSphere;
+			fn[ShapeDispatch::PairIndex(ColliderType::Sphere, ColliderType::Box)]	 = &IntersectSphereBox;
+			fn[ShapeDispatch::PairIndex(ColliderType::Box, ColliderType::Sphere)]	 = &IntersectBoxSphere;
+			fn[ShapeDispatch::PairIndex(ColliderType::Box, ColliderType::Box)]		 = &IntersectBoxBox;
+			fn[ShapeDispatch::PairIndex(ColliderType::Sphere, ColliderType::Capsule)]  = &IntersectSphereCapsule;
+			fn[ShapeDispatch::PairIndex(ColliderType::Capsule, ColliderType::Sphere)]  = &IntersectCapsuleSphere;
+			fn[ShapeDispatch::PairIndex(ColliderType::Capsule, ColliderType::Capsule)] = &IntersectCapsuleCapsule;
+		}
+	};
+	const IntersectTable s_IntersectTable;
+}
+
+// ==================================================
+// ----- レコード -----
+// ==================================================
+ShapeRecord ShapeDispatch::MakeRecord(ColliderType type, const Collision* shape)
+{
+	assert(shape);
+	ShapeRecord r;
+	r.type = type;
+	r.shape = shape;
+	switch (type)
+	{
+	case ColliderType::Box:
+	{
+		const Vector3 half = static_cast<const BoxCollision*>(shape)->HalfSize();
+		r.param[0] = half.x; r.param[1] = half.y; r.param[2] = half.z;
+		break;
+	}
+	case ColliderType::Sphere:
+		r.param[0] = static_cast<const SphereCollision*>(shape)->Radius();
+		break;
+	case ColliderType::Capsule:
+		r.param[0] = static_cast<const CapsuleCollision*>(shape)->Radius();
+		r.param[1] = static_cast<const CapsuleCollision*>(shape)->CylinderHeight();
+		break;
+	default:
+		break;
+	}
+	return r;
+}
+
+// ==================================================
+// ----- テーブル引き -----
+// ==================================================
+ShapeDispatch::OverlapFn ShapeDispatch::Get(ColliderType a, ColliderType b)
+{
+	assert((int)a < TypeCount && (int)b < TypeCount);
+	return s_OverlapTable.fn[PairIndex(a, b)];
+}
+ShapeDispatch::IntersectFn ShapeDispatch::GetIntersect(ColliderType a, ColliderType b)
+{
+	assert((int)a < TypeCount && (int)b < TypeCount);
+	return s_IntersectTable.fn[PairIndex(a, b)];
+}
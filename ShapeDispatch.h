@@ -0,0 +1,86 @@
+/*
+	ShapeDispatch.h
+	20261017  hanaue sho
+	ナローフェーズの形状ディスパッチ（形状の種類 × 種類の関数テーブル）
+	仮想関数の２段呼び出し（isOverlap → isOverlapWithX）を通さずに、種類の組から直接判定関数を引く
+*/
+#ifndef SHAPEDISPATCH_H_
+#define SHAPEDISPATCH_H_
+#include <assert.h>
+#include <cstdint>
+#include "ColliderPose.h"
+
+class Collision;
+struct ContactManifold;
+
+// ==================================================
+// ----- 形状の種類 -----
+// ==================================================
+enum class ColliderType : uint8_t
+{
+	Box,
+	Sphere,
+	Capsule,
+	MeshField,
+	TriangleMesh,
+	ConvexHull,
+	Count, // 種類の数（テーブルの大きさ）
+};
+
+// ==================================================
+// ----- 形状レコード -----
+// PhysicsSystem がコライダー ID ごとに連続した配列で持つ
+// Box / Sphere / Capsule は値だけで判定できるので、形状本体（ヒープ）を見に行かない
+// ==================================================
+struct ShapeRecord
+{
+	ColliderType type = ColliderType::Box;
+	float param[3] = {};			  // Box: 半分のサイズ xyz、Sphere: 半径、Capsule: 半径と円柱の高さ
+	const Collision* shape = nullptr; // 形状本体（HeightMap など大きいデータを持つ形状はこちらを使う）
+	ColliderPose pose{};			  // ワールド姿勢（ステップの始めに写す）
+};
+
+// ==================================================
+// ----- ディスパッチ -----
+// ==================================================
+namespace ShapeDispatch
+{
+	// --------------------------------------------------
+	// 判定関数（法線は a → b、a.shape->isOverlap(b.shape) と同じ結果）
+	// --------------------------------------------------
+	using OverlapFn = bool(*)(const ShapeRecord& a, const ShapeRecord& b, ContactManifold& out, float slop);
+
+	constexpr int TypeCount = (int)ColliderType::Count;
+	constexpr int PairIndex(ColliderType a, ColliderType b) { return (int)a * TypeCount + (int)b; }
+
+	// --------------------------------------------------
+	// 形状本体からレコードを作る（pose は呼び出し側で入れる）
+	// --------------------------------------------------
+	ShapeRecord MakeRecord(ColliderType type, const Collision* shape);
+
+	// --------------------------------------------------
+	// 種類の組の判定関数
+	// Overlap は一番呼ばれるので、Get を通さずにテーブルを直接引く
+	// --------------------------------------------------
+	extern const OverlapFn* const OverlapFns; // TypeCount × TypeCount（PairIndex で引く）
+	OverlapFn Get(ColliderType a, ColliderType b);
+	inline bool Overlap(const ShapeRecord& a, const ShapeRecord& b, ContactManifold& out, float slop)
+	{
+		assert((int)a.type < TypeCount && (int)b.type < TypeCount);
+		return OverlapFns[PairIndex(a.type, b.type)](a, b, out, slop);
+	}
+
+	// --------------------------------------------------
+	// 重なっているかだけの判定（トリガー用、接触点は作らない）
+	// 球・箱・カプセルの組（Box × Capsule 以外）は直接判定、ほかは Overlap に任せる
+	// どの組も Overlap(slop 0) の戻り値と同じ答えになる（トリガーの入った、出たが Overlap のときと変わらないように）
+	// --------------------------------------------------
+	using IntersectFn = bool(*)(const ShapeRecord& a, const ShapeRecord& b);
+	IntersectFn GetIntersect(ColliderType a, ColliderType b);
+	inline bool Intersect(const ShapeRecord& a, const ShapeRecord& b)
+	{
+		return GetIntersect(a.type, b.type)(a, b);
+	}
+}
+
+#endif
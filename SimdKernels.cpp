@@ -0,0 +1,323 @@
+/*
+	SimdKernels.cpp
+	20261017  hanaue sho
+	ブロード、ナローの SIMD 版（SSE / AVX2、CPU を見て選ぶ）
+*/
+#include <assert.h>
+#include <math.h>
+#include "SimdKernels.h"
+#include "ShapeDispatch.h"
+#include "ContactManifold.h"
+
+// ----- x86 / x64 だけ SIMD を使う（それ以外はスカラーのみ） -----
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define SIMDKERNELS_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define SIMDKERNELS_AVX2 // MSVC は /arch が無くても AVX2 の組み込み関数を書ける
+#else
+#include <cpuid.h>
+#define SIMDKERNELS_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+// ==================================================
+// ヘルパ
+// ==================================================
+namespace
+{
+	SimdKernels::Level s_Level = SimdKernels::DetectLevel();
+
+	// --------------------------------------------------
+	// 球１組ぶん（SphereCollision::isOverlapWithSphere と同じ計算）
+	// 入力は B の関数から見た形：B（this）の中心、A の中心、B の半径、A の半径
+	// --------------------------------------------------
+	bool SphereSphereScalar(const ShapeRecord& a, const ShapeRecord& b, float slop, ContactManifold& out)
+	{
+		const Vector3 centerB = b.pose.position;
+		const Vector3 centerA = a.pose.position;
+		const Vector3 vect = centerB - centerA; // A → B
+		const float distSq = vect.lengthSq();
+		const float radiusA = b.param[0] * b.pose.scale.x; // isOverlapWithSphere と同じく this（B）側
+		const float radiusB = a.param[0] * a.pose.scale.x;
+		const float sum = radiusA + radiusB;
+		if (distSq > 1e-12f)
+		{
+			const float d = sqrtf(distSq);
+			const float inv = 1.0f / d;
+			out.normal = Vector3(vect.x * inv, vect.y * inv, vect.z * inv);
+			out.points[0].penetration = sum - d;
+		}
+		else
+		{
+			out.normal = { 1, 0, 0 };
+			out.points[0].penetration = sum;
+		}
+		out.touching = (out.points[0].penetration >= -slop);
+		out.points[0].pointOnA = centerA + out.normal * radiusA;
+		out.points[0].pointOnB = centerB - out.normal * radiusB;
+		out.count = 1;
+		return out.touching;
+	}
+
+	void SphereSphereOne(const ShapeRecord& a, const ShapeRecord& b, float slop, ContactManifold& out, uint8_t& hit)
+	{
+		ContactManifold m;
+		hit = SphereSphereScalar(a, b, slop, m);
+		if (hit) out = m;
+	}
+
+	// --------------------------------------------------
+	// SIMD 用に１組ずつ並べ直す、結果を１組ずつ書き出す
+	// 呼び出し側と同じ命令セットでコンパイルされるようにテンプレートにしておく（SSE / AVX の切り替えを避ける）
+	// --------------------------------------------------
+	struct SphereLanes
+	{
+		alignas(32) float ax[8], ay[8], az[8], bx[8], by[8], bz[8], ra[8], rb[8]; // ra は B 側、rb は A 側の半径
+		alignas(32) float nx[8], ny[8], nz[8], pen[8];
+		alignas(32) float pax[8], pay[8], paz[8], pbx[8], pby[8], pbz[8];
+	};
+	template<int Lanes>
+	inline void LoadSphereLanes(SphereLanes& l, const ShapeRecord* records, const int* idA, const int* idB)
+	{
+		for (int k = 0; k < Lanes; k++)
+		{
+			const ShapeRecord& a = records[idA[k]];
+			const ShapeRecord& b = records[idB[k]];
+			l.ax[k] = a.pose.position.x; l.ay[k] = a.pose.position.y; l.az[k] = a.pose.position.z;
+			l.bx[k] = b.pose.position.x; l.by[k] = b.pose.position.y; l.bz[k] = b.pose.position.z;
+			l.ra[k] = b.param[0] * b.pose.scale.x;
+			l.rb[k] = a.param[0] * a.pose.scale.x;
+		}
+	}
+	template<int Lanes>
+	inline void StoreSphereLanes(const SphereLanes& l, float slop, ContactManifold* out, uint8_t* hit)
+	{
+		for (int k = 0; k < Lanes; k++)
+		{
+			hit[k] = (l.pen[k] >= -slop);
+			if (!hit[k]) continue; // 当たっていない組は書かない
+			ContactManifold& m = out[k];
+			m = ContactManifold();
+			m.touching = true;
+			m.normal = Vector3(l.nx[k], l.ny[k], l.nz[k]);
+			m.points[0].penetration = l.pen[k];
+			m.points[0].pointOnA = Vector3(l.pax[k], l.pay[k], l.paz[k]);
+			m.points[0].pointOnB = Vector3(l.pbx[k], l.pby[k], l.pbz[k]);
+			m.count = 1;
+		}
+	}
+
+#ifdef SIMDKERNELS_X86
+	// --------------------------------------------------
+	// SSE（４本）
+	// --------------------------------------------------
+	int OverlapIndexedSSE(const AABB& aabb, const AABBSoA& soa, const int* indices, int count, int* out)
+	{
+		const __m128 aMinX = _mm_set1_ps(aabb.min.x), aMinY = _mm_set1_ps(aabb.min.y), aMinZ = _mm_set1_ps(aabb.min.z);
+		const __m128 aMaxX = _mm_set1_ps(aabb.max.x), aMaxY = _mm_set1_ps(aabb.max.y), aMaxZ = _mm_set1_ps(aabb.max.z);
+		int n = 0, i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			const int* id = indices + i;
+			auto load = [id](const std::vector<float>& v) { return _mm_setr_ps(v[id[0]], v[id[1]], v[id[2]], v[id[3]]); }; // SSE には gather が無い
+			// isOverlap と同じく「離れている」条件の OR を取って反転（NaN でも同じ結果）
+			__m128 apart = _mm_or_ps(_mm_cmplt_ps(aMaxX, load(soa.minX)), _mm_cmpgt_ps(aMinX, load(soa.maxX)));
+			apart = _mm_or_ps(apart, _mm_or_ps(_mm_cmplt_ps(aMaxY, load(soa.minY)), _mm_cmpgt_ps(aMinY, load(soa.maxY))));
+			apart = _mm_or_ps(apart, _mm_or_ps(_mm_cmplt_ps(aMaxZ, load(soa.minZ)), _mm_cmpgt_ps(aMinZ, load(soa.maxZ))));
+			int mask = ~_mm_movemask_ps(apart) & 0xf;
+			while (mask)
+			{
+				const int k = mask & 1 ? 0 : mask & 2 ? 1 : mask & 4 ? 2 : 3;
+				out[n++] = id[k];
+				mask &= mask - 1;
+			}
+		}
+		for (; i < count; i++)
+		{
+			const int j = indices[i];
+			const AABB o{ {soa.minX[j], soa.minY[j], soa.minZ[j]}, {soa.maxX[j], soa.maxY[j], soa.maxZ[j]} };
+			if (aabb.isOverlap(o)) out[n++] = j;
+		}
+		return n;
+	}
+	void SphereSphereSSE(const ShapeRecord* records, const int* idA, const int* idB, int count, float slop, ContactManifold* out, uint8_t* hit)
+	{
+		SphereLanes l;
+		const __m128 eps = _mm_set1_ps(1e-12f), one = _mm_set1_ps(1.0f);
+		int i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			LoadSphereLanes<4>(l, records, idA + i, idB + i);
+			const __m128 ax = _mm_load_ps(l.ax), ay = _mm_load_ps(l.ay), az = _mm_load_ps(l.az);
+			const __m128 bx = _mm_load_ps(l.bx), by = _mm_load_ps(l.by), bz = _mm_load_ps(l.bz);
+			const __m128 ra = _mm_load_ps(l.ra), rb = _mm_load_ps(l.rb);
+			const __m128 vx = _mm_sub_ps(bx, ax), vy = _mm_sub_ps(by, ay), vz = _mm_sub_ps(bz, az);
+			const __m128 distSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz));
+			const __m128 sum = _mm_add_ps(ra, rb);
+			const __m128 apart = _mm_cmpgt_ps(distSq, eps); // 中心が重なっていない
+			const __m128 d = _mm_sqrt_ps(distSq);
+			const __m128 inv = _mm_div_ps(one, d);
+			// 重なっているときは (1, 0, 0) と sum
+			const __m128 nx = _mm_or_ps(_mm_and_ps(apart, _mm_mul_ps(vx, inv)), _mm_andnot_ps(apart, one));
+			const __m128 ny = _mm_and_ps(apart, _mm_mul_ps(vy, inv));
+			const __m128 nz = _mm_and_ps(apart, _mm_mul_ps(vz, inv));
+			_mm_store_ps(l.nx, nx); _mm_store_ps(l.ny, ny); _mm_store_ps(l.nz, nz);
+			_mm_store_ps(l.pen, _mm_or_ps(_mm_and_ps(apart, _mm_sub_ps(sum, d)), _mm_andnot_ps(apart, sum)));
+			_mm_store_ps(l.pax, _mm_add_ps(ax, _mm_mul_ps(nx, ra))); _mm_store_ps(l.pay, _mm_add_ps(ay, _mm_mul_ps(ny, ra))); _mm_store_ps(l.paz, _mm_add_ps(az, _mm_mul_ps(nz, ra)));
+			_mm_store_ps(l.pbx, _mm_sub_ps(bx, _mm_mul_ps(nx, rb))); _mm_store_ps(l.pby, _mm_sub_ps(by, _mm_mul_ps(ny, rb))); _mm_store_ps(l.pbz, _mm_sub_ps(bz, _mm_mul_ps(nz, rb)));
+			StoreSphereLanes<4>(l, slop, out + i, hit + i);
+		}
+		for (; i < count; i++) SphereSphereOne(records[idA[i]], records[idB[i]], slop, out[i], hit[i]);
+	}
+
+	// --------------------------------------------------
+	// AVX2（８本）
+	// --------------------------------------------------
+	SIMDKERNELS_AVX2 int OverlapIndexedAVX2(const AABB& aabb, const AABBSoA& soa, const int* indices, int count, int* out)
+	{
+		const __m256 aMinX = _mm256_set1_ps(aabb.min.x), aMinY = _mm256_set1_ps(aabb.min.y), aMinZ = _mm256_set1_ps(aabb.min.z);
+		const __m256 aMaxX = _mm256_set1_ps(aabb.max.x), aMaxY = _mm256_set1_ps(aabb.max.y), aMaxZ = _mm256_set1_ps(aabb.max.z);
+		int n = 0, i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256i id = _mm256_loadu_si256((const __m256i*)(indices + i));
+			__m256 apart = _mm256_or_ps(_mm256_cmp_ps(aMaxX, _mm256_i32gather_ps(soa.minX.data(), id, 4), _CMP_LT_OQ), _mm256_cmp_ps(aMinX, _mm256_i32gather_ps(soa.maxX.data(), id, 4), _CMP_GT_OQ));
+			apart = _mm256_or_ps(apart, _mm256_or_ps(_mm256_cmp_ps(aMaxY, _mm256_i32gather_ps(soa.minY.data(), id, 4), _CMP_LT_OQ), _mm256_cmp_ps(aMinY, _mm256_i32gather_ps(soa.maxY.data(), id, 4), _CMP_GT_OQ)));
+			apart = _mm256_or_ps(apart, _mm256_or_ps(_mm256_cmp_ps(aMaxZ, _mm256_i32gather_ps(soa.minZ.data(), id, 4), _CMP_LT_OQ), _mm256_cmp_ps(aMinZ, _mm256_i32gather_ps(soa.maxZ.data(), id, 4), _CMP_GT_OQ)));
+			unsigned mask = ~(unsigned)_mm256_movemask_ps(apart) & 0xffu;
+			while (mask)
+			{
+				unsigned k = 0;
+				while (!(mask & (1u << k))) k++;
+				out[n++] = indices[i + k];
+				mask &= mask - 1;
+			}
+		}
+		for (; i < count; i++)
+		{
+			const int j = indices[i];
+			const AABB o{ {soa.minX[j], soa.minY[j], soa.minZ[j]}, {soa.maxX[j], soa.maxY[j], soa.maxZ[j]} };
+			if (aabb.isOverlap(o)) out[n++] = j;
+		}
+		return n;
+	}
+	SIMDKERNELS_AVX2 void SphereSphereAVX2(const ShapeRecord* records, const int* idA, const int* idB, int count, float slop, ContactManifold* out, uint8_t* hit)
+	{
+		SphereLanes l;
+		const __m256 eps = _mm256_set1_ps(1e-12f), one = _mm256_set1_ps(1.0f);
+		int i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			LoadSphereLanes<8>(l, records, idA + i, idB + i);
+			const __m256 ax = _mm256_load_ps(l.ax), ay = _mm256_load_ps(l.ay), az = _mm256_load_ps(l.az);
+			const __m256 bx = _mm256_load_ps(l.bx), by = _mm256_load_ps(l.by), bz = _mm256_load_ps(l.bz);
+			const __m256 ra = _mm256_load_ps(l.ra), rb = _mm256_load_ps(l.rb);
+			const __m256 vx = _mm256_sub_ps(bx, ax), vy = _mm256_sub_ps(by, ay), vz = _mm256_sub_ps(bz, az);
+			const __m256 distSq = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy)), _mm256_mul_ps(vz, vz)); // FMA にしない（スカラーと合わせる）
+			const __m256 sum = _mm256_add_ps(ra, rb);
+			const __m256 apart = _mm256_cmp_ps(distSq, eps, _CMP_GT_OQ);
+			const __m256 d = _mm256_sqrt_ps(distSq);
+			const __m256 inv = _mm256_div_ps(one, d);
+			const __m256 nx = _mm256_blendv_ps(one, _mm256_mul_ps(vx, inv), apart);
+			const __m256 ny = _mm256_and_ps(apart, _mm256_mul_ps(vy, inv));
+			const __m256 nz = _mm256_and_ps(apart, _mm256_mul_ps(vz, inv));
+			_mm256_store_ps(l.nx, nx); _mm256_store_ps(l.ny, ny); _mm256_store_ps(l.nz, nz);
+			_mm256_store_ps(l.pen, _mm256_blendv_ps(sum, _mm256_sub_ps(sum, d), apart));
+			_mm256_store_ps(l.pax, _mm256_add_ps(ax, _mm256_mul_ps(nx, ra))); _mm256_store_ps(l.pay, _mm256_add_ps(ay, _mm256_mul_ps(ny, ra))); _mm256_store_ps(l.paz, _mm256_add_ps(az, _mm256_mul_ps(nz, ra)));
+			_mm256_store_ps(l.pbx, _mm256_sub_ps(bx, _mm256_mul_ps(nx, rb))); _mm256_store_ps(l.pby, _mm256_sub_ps(by, _mm256_mul_ps(ny, rb))); _mm256_store_ps(l.pbz, _mm256_sub_ps(bz, _mm256_mul_ps(nz, rb)));
+			StoreSphereLanes<8>(l, slop, out + i, hit + i);
+		}
+		for (; i < count; i++) SphereSphereOne(records[idA[i]], records[idB[i]], slop, out[i], hit[i]);
+	}
+#endif
+}
+
+// ==================================================
+// ----- 命令セット -----
+// ==================================================
+SimdKernels::Level SimdKernels::DetectLevel()
+{
+#ifdef SIMDKERNELS_X86
+	int info[4] = {};
+#if defined(_MSC_VER)
+	__cpuid(info, 0);
+	const int maxLeaf = info[0];
+	__cpuid(info, 1);
+#else
+	unsigned r[4] = {};
+	__get_cpuid(0, &r[0], &r[1], &r[2], &r[3]);
+	const int maxLeaf = (int)r[0];
+	__get_cpuid(1, &r[0], &r[1], &r[2], &r[3]);
+	for (int k = 0; k < 4; k++) info[k] = (int)r[k];
+#endif
+	if (!(info[3] & (1 << 25))) return Level::Scalar; // SSE
+
+	// AVX2 は CPU と OS（YMM レジスタの保存）の両方が対応している必要がある
+	const bool osxsave = (info[2] & (1 << 27)) != 0;
+	const bool avx	   = (info[2] & (1 << 28)) != 0;
+	if (!osxsave || !avx || maxLeaf < 7) return Level::SSE;
+#if defined(_MSC_VER)
+	const unsigned long long xcr0 = _xgetbv(0);
+	__cpuidex(info, 7, 0);
+#else
+	unsigned eax, edx;
+	__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	const unsigned long long xcr0 = ((unsigned long long)edx << 32) | eax;
+	__cpuid_count(7, 0, r[0], r[1], r[2], r[3]);
+	for (int k = 0; k < 4; k++) info[k] = (int)r[k];
+#endif
+	if ((xcr0 & 0x6) != 0x6) return Level::SSE;
+	if (!(info[1] & (1 << 5))) return Level::SSE; // AVX2
+	return Level::AVX2;
+#else
+	return Level::Scalar;
+#endif
+}
+SimdKernels::Level SimdKernels::ActiveLevel() { return s_Level; }
+void SimdKernels::SetLevel(Level level)
+{
+	const Level detected = DetectLevel();
+	s_Level = (int)level <= (int)detected ? level : detected;
+}
+const char* SimdKernels::LevelName(Level level)
+{
+	switch (level)
+	{
+	case Level::SSE:  return "SSE";
+	case Level::AVX2: return "AVX2";
+	default:		  return "Scalar";
+	}
+}
+
+// ==================================================
+// ----- AABB -----
+// ==================================================
+int SimdKernels::OverlapIndexed(const AABB& aabb, const AABBSoA& soa, const int* indices, int count, int* out)
+{
+#ifdef SIMDKERNELS_X86
+	if (s_Level == Level::AVX2) return OverlapIndexedAVX2(aabb, soa, indices, count, out);
+	if (s_Level == Level::SSE)	return OverlapIndexedSSE(aabb, soa, indices, count, out);
+#endif
+	int n = 0;
+	for (int i = 0; i < count; i++)
+	{
+		const int j = indices[i];
+		const AABB o{ {soa.minX[j], soa.minY[j], soa.minZ[j]}, {soa.maxX[j], soa.maxY[j], soa.maxZ[j]} };
+		if (aabb.isOverlap(o)) out[n++] = j;
+	}
+	return n;
+}
+
+// ==================================================
+// ----- 球 × 球 -----
+// ==================================================
+void SimdKernels::SphereSphere(const ShapeRecord* records, const int* idA, const int* idB, int count, float slop, ContactManifold* out, uint8_t* hit)
+{
+#ifdef SIMDKERNELS_X86
+	if (s_Level == Level::AVX2) { SphereSphereAVX2(records, idA, idB, count, slop, out, hit); return; }
+	if (s_Level == Level::SSE)	{ SphereSphereSSE(records, idA, idB, count, slop, out, hit); return; }
+#endif
+	for (int i = 0; i < count; i++) SphereSphereOne(records[idA[i]], records[idB[i]], slop, out[i], hit[i]);
+}
@@ -0,0 +1,76 @@
+/*
+	SimdKernels.h
+	20261017  hanaue sho
+	ブロード、ナローの SIMD 版（SSE / AVX2、CPU を見て選ぶ）
+	どの命令セットでもスカラー版と同じ結果になるように、演算の順番を揃えている
+*/
+#ifndef SIMDKERNELS_H_
+#define SIMDKERNELS_H_
+#include <vector>
+#include <cstdint>
+#include "collision.h" // AABB
+
+struct ShapeRecord;
+struct ContactManifold;
+
+// ==================================================
+// ----- AABB の SoA -----
+// コライダー ID ごと、軸ごとに並べておく（まとめて読み込めるように）
+// ==================================================
+struct AABBSoA
+{
+	std::vector<float> minX, minY, minZ;
+	std::vector<float> maxX, maxY, maxZ;
+
+	int Size() const { return (int)minX.size(); }
+	void Resize(int count)
+	{
+		// 空いている ID は誰とも当たらない箱（min > max）にしておく
+		minX.resize(count, 1e30f); minY.resize(count, 1e30f); minZ.resize(count, 1e30f);
+		maxX.resize(count, -1e30f); maxY.resize(count, -1e30f); maxZ.resize(count, -1e30f);
+	}
+	void Set(int i, const AABB& aabb)
+	{
+		minX[i] = aabb.min.x; minY[i] = aabb.min.y; minZ[i] = aabb.min.z;
+		maxX[i] = aabb.max.x; maxY[i] = aabb.max.y; maxZ[i] = aabb.max.z;
+	}
+	void Clear(int i) { Set(i, { {1e30f, 1e30f, 1e30f}, {-1e30f, -1e30f, -1e30f} }); }
+};
+
+// ==================================================
+// ----- カーネル -----
+// ==================================================
+namespace SimdKernels
+{
+	// --------------------------------------------------
+	// 命令セット
+	// 起動時に CPU を調べて使える一番広いものを選ぶ
+	// SetLevel は比較、計測用（CPU が対応していないものは選べない）
+	// --------------------------------------------------
+	enum class Level
+	{
+		Scalar,
+		SSE,  // ４本ずつ
+		AVX2, // ８本ずつ
+	};
+	Level DetectLevel();
+	Level ActiveLevel();
+	void  SetLevel(Level level);
+	const char* LevelName(Level level);
+
+	// --------------------------------------------------
+	// aabb と soa[indices[i]] を比べて、当たっている indices[i] を順番のまま out に詰める
+	// AABB::isOverlap と同じ判定、戻り値は詰めた数（out は count 個ぶん必要）
+	// --------------------------------------------------
+	int OverlapIndexed(const AABB& aabb, const AABBSoA& soa, const int* indices, int count, int* out);
+
+	// --------------------------------------------------
+	// 球 × 球をまとめて判定
+	// records[idA[i]] × records[idB[i]]（どちらも Sphere）の結果を out[i] / hit[i] に入れる
+	// 当たっていない組の out[i] は書かない（書き込みを減らすため）
+	// ShapeDispatch::Overlap(records[idA[i]], records[idB[i]]) と同じ結果
+	// --------------------------------------------------
+	void SphereSphere(const ShapeRecord* records, const int* idA, const int* idB, int count, float slop, ContactManifold* out, uint8_t* hit);
+}
+
+#endif
@@ -79,10 +79,10 @@ void SkinMatrixProviderComponent::BuildHybridSkinMatrixes()
 	const int boneCount = (int)m_pSkeleton->bones.size();
 	if (boneCount <= 0) return;
 
-	// Hybrid ̓}XNK{
+	// Hybrid はマスク必須
 	if ((int)m_UsePhysicsBone.size() != boneCount) return;
 
-	// animeLocal 擾iAnimator  Update ς݂łOj
+	// animeLocal を取得（Animator が Update 済みである前提）
 	const auto& animeLocal = m_pAnimator->LocalPoseOut();
 	if ((int)animeLocal.size() < boneCount) return;
 
@@ -92,7 +92,7 @@ void SkinMatrixProviderComponent::BuildHybridSkinMatrixes()
 	const Matrix4x4 ownerWorld = m_pOwnerTransform->WorldMatrix();
 	const Matrix4x4 invOwnerWorld = ownerWorld.Inverse();
 
-	// bones ͐eqɃ\[gĂO
+	// bones は親→子順にソートされている前提
 	const bool hasMask = (m_UsePhysicsBone.size() == (size_t)boneCount);
 	for (int i = 0; i < boneCount; i++)
 	{
@@ -100,18 +100,18 @@ void SkinMatrixProviderComponent::BuildHybridSkinMatrixes()
 
 		if (hasMask && m_UsePhysicsBone[i])
 		{
-			// ----- Physics 쓮 : boneWorld -> boneModel ɖ߂ -----
+			// ----- Physics 駆動 : boneWorld -> boneModel に戻す -----
 			const Matrix4x4& boneWorld = m_pBoneManager->GetBoneWorldMatrix(i);
 
 			// boneModel = boneWorld * invOwnerWorld
 			Matrix4x4 boneModel = boneWorld * invOwnerWorld;
 
-			// ŏIfp͂Ŋm
+			// 最終モデル姿勢はこれで確定
 			m_FinalModel[i] = boneModel;
 		}
 		else
 		{
-			// ----- Animation 쓮 : animeLocal eɍŏIɍ
+			// ----- Animation 駆動 : animeLocal を親に最終に合成
 			if (parent < 0) m_FinalModel[i] = animeLocal[i];
 			else			m_FinalModel[i] = animeLocal[i] * m_FinalModel[parent];
 		}
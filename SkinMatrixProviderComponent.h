@@ -18,14 +18,14 @@ class SkinMatrixProviderComponent : public Component
 public:
 	enum class Mode
 	{
-		Animation, // Animation  SkinMatrix ̂܂܎g
-		Ragdoll,   // iBoneManagerj SkinMatrix g
-		Hybrid,	   // ꕔAꕔAj[V
+		Animation, // Animation の SkinMatrix をそのまま使う
+		Ragdoll,   // 物理（BoneManager）から作った SkinMatrix を使う
+		Hybrid,	   // 一部物理、一部アニメーション
 	};
 
 private:
 	// ==================================================
-	// ----- \vf -----
+	// ----- 構成要素 -----
 	// ==================================================
 	Skeleton*			m_pSkeleton = nullptr;
 	AnimatorComponent*	m_pAnimator = nullptr;
@@ -33,34 +33,34 @@ private:
 	TransformComponent* m_pOwnerTransform = nullptr;
 
 	// ==================================================
-	// ----- [h -----
+	// ----- モード -----
 	// ==================================================
 	Mode m_Mode = Mode::Animation;
 
 	// ==================================================
-	// ----- }gNX -----
+	// ----- マトリクス -----
 	// ==================================================
-	// ŏIpƂɁA Bone  Physics ̗p邩ǂ
+	// 最終姿勢を作るときに、この Bone は Physics を採用するかどうか
 	std::vector<char> m_UsePhysicsBone; // 0 = Animation, 1 = Physics
-	std::vector<Matrix4x4> m_SkinPhys; // R Skin
-	std::vector<Matrix4x4> m_SkinOut;  // uh̍ŏIo͗p Skiniݖgpj
-	std::vector<Matrix4x4> m_FinalModel;  // ŏIfpi{[Ɓj
+	std::vector<Matrix4x4> m_SkinPhys; // 物理由来の Skin
+	std::vector<Matrix4x4> m_SkinOut;  // ブレンド後の最終出力用の Skin（現在未使用）
+	std::vector<Matrix4x4> m_FinalModel;  // 最終モデル姿勢（ボーンごと）
 
 public:
 	// ==================================================
-	// ----- ZbgAbviKĂڂˁj -----
+	// ----- 初期セットアップ（必ず呼ぼうね） -----
 	// ==================================================
 	void SetUp(Skeleton* skeleton, AnimatorComponent* anime, BoneManager* boneManager, TransformComponent* ownerTrans);
 
 	// ==================================================
-	// ----- BoneObject  Physics ݒ -----
-	// ȂƃAjŏ㏑Ă܂
-	// i[ꂽꍇAPhysics DȂ̂ Transform ̏͏㏑Ă܂
+	// ----- BoneObject の Physics 設定 -----
+	// これをしないとアニメで上書きされてしまう
+	// 格納された場合、Physics 優先なので Transform 側からの処理は上書きされてしまう
 	// ==================================================
 	void SetBonePhysics(int boneIndex, bool enable) { m_UsePhysicsBone[boneIndex] = enable ? 1 : 0; }
 
 	// ==================================================
-	// ----- [h֌W -----
+	// ----- モード関係 -----
 	// ==================================================
 	void SetMode(Mode m) { m_Mode = m; }
 	void SetModeAnimation() { m_Mode = Mode::Animation; }
@@ -72,18 +72,18 @@ public:
 	bool IsHybrid()	   const { return m_Mode == Mode::Hybrid; }
 
 	// ==================================================
-	// ----- ANZT -----
+	// ----- アクセサ -----
 	// ==================================================
 	const std::vector<char>& UsePhysicsBoneMask() const { return m_UsePhysicsBone; }
 
 	// ==================================================
-	// ----- Draw Ă -----
+	// ----- Draw 側がこれを呼ぶ -----
 	// ==================================================
 	const Matrix4x4* GetSkinMatrixPtr(int& outCount);
 private:
-	// BoneManager {[̍s쐬
+	// BoneManager からボーンの行列を作成
 	void BuildPhysicsSkinMatrixes();
-	// Hybrid ȃ{[̍s쐬
+	// Hybrid なボーンの行列を作成
 	void BuildHybridSkinMatrixes();
 };
 
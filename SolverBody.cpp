@@ -0,0 +1,62 @@
+/*
+	SolverBody.cpp
+	20261017  hanaue sho
+	ソルバー用の剛体の状態（SoA）
+*/
+#include "SolverBody.h"
+#include "RigidbodyComponent.h"
+
+// ==================================================
+// ----- 構築、書き戻し -----
+// ==================================================
+void SolverBodySet::Clear()
+{
+	for (auto* v : { &m_VX, &m_VY, &m_VZ, &m_WX, &m_WY, &m_WZ, &m_PVX, &m_PVY, &m_PVZ, &m_PWX, &m_PWY, &m_PWZ, &m_InvMass,
+					 &m_I00, &m_I01, &m_I02, &m_I10, &m_I11, &m_I12, &m_I20, &m_I21, &m_I22,
+					 &m_PX, &m_PY, &m_PZ })
+		v->clear();
+	m_pWriteBack.clear();
+
+	Add(nullptr, false); // ０番：動かない剛体
+}
+int SolverBodySet::Add(Rigidbody* rb, bool canMove)
+{
+	const int index = Count();
+
+	const Vector3 v = rb ? rb->GetLinearVelocitySolver()  : Vector3();
+	const Vector3 w = rb ? rb->GetAngularVelocitySolver() : Vector3();
+	const Vector3 p = rb ? rb->WorldCOM() : Vector3();
+	m_VX.push_back(v.x); m_VY.push_back(v.y); m_VZ.push_back(v.z);
+	m_WX.push_back(w.x); m_WY.push_back(w.y); m_WZ.push_back(w.z);
+	m_PX.push_back(p.x); m_PY.push_back(p.y); m_PZ.push_back(p.z);
+	for (auto* e : { &m_PVX, &m_PVY, &m_PVZ, &m_PWX, &m_PWY, &m_PWZ })
+		e->push_back(0.0f);
+
+	// 動かせない剛体は逆質量と慣性を０にしておく
+	m_InvMass.push_back(canMove ? rb->InvMass() : 0.0f);
+	if (canMove)
+	{
+		const Matrix4x4& I = rb->InertiaWorldInv();
+		m_I00.push_back(I.m[0][0]); m_I01.push_back(I.m[0][1]); m_I02.push_back(I.m[0][2]);
+		m_I10.push_back(I.m[1][0]); m_I11.push_back(I.m[1][1]); m_I12.push_back(I.m[1][2]);
+		m_I20.push_back(I.m[2][0]); m_I21.push_back(I.m[2][1]); m_I22.push_back(I.m[2][2]);
+	}
+	else
+	{
+		for (auto* e : { &m_I00, &m_I01, &m_I02, &m_I10, &m_I11, &m_I12, &m_I20, &m_I21, &m_I22 })
+			e->push_back(0.0f);
+	}
+
+	m_pWriteBack.push_back(canMove ? rb : nullptr);
+	return index;
+}
+void SolverBodySet::WriteBack() const
+{
+	for (int i = 0; i < Count(); i++)
+	{
+		Rigidbody* rb = m_pWriteBack[i];
+		if (!rb) continue;
+		rb->SetVelocity(LinearVelocity(i));
+		rb->SetAngularVelocity(AngularVelocity(i));
+	}
+}
@@ -0,0 +1,89 @@
+/*
+	SolverBody.h
+	20261017  hanaue sho
+	ソルバー用の剛体の状態（SoA）
+	ステップごとに Rigidbody から集めて、反復が終わったら１回だけ書き戻す
+	０番は「動かない剛体」（Rigidbody 無し用）で、速度も逆質量も常に０
+*/
+#ifndef SOLVERBODY_H_
+#define SOLVERBODY_H_
+#include <vector>
+#include "Vector3.h"
+
+class Rigidbody;
+
+// ==================================================
+// ----- クラス本体 -----
+// ==================================================
+class SolverBodySet
+{
+public:
+	static constexpr int StaticIndex = 0;
+
+private:
+	// ==================================================
+	// ----- 要素 -----
+	// ==================================================
+	// --------------------------------------------------
+	// 速度、角速度（Kinematic は見かけの速度）
+	// --------------------------------------------------
+	std::vector<float> m_VX, m_VY, m_VZ;
+	std::vector<float> m_WX, m_WY, m_WZ;
+	// --------------------------------------------------
+	// 擬似速度、擬似角速度（めり込み解消用）
+	// 速度積分のときに位置へ足すだけで、速度には残さない
+	// --------------------------------------------------
+	std::vector<float> m_PVX, m_PVY, m_PVZ;
+	std::vector<float> m_PWX, m_PWY, m_PWZ;
+	// --------------------------------------------------
+	// 逆質量、ワールド慣性逆行列（3x3）
+	// 動かない剛体は全部０なので、掛けても何も起きない
+	// --------------------------------------------------
+	std::vector<float> m_InvMass;
+	std::vector<float> m_I00, m_I01, m_I02;
+	std::vector<float> m_I10, m_I11, m_I12;
+	std::vector<float> m_I20, m_I21, m_I22;
+	// --------------------------------------------------
+	// 重心（反復中は動かない）
+	// --------------------------------------------------
+	std::vector<float> m_PX, m_PY, m_PZ;
+	// --------------------------------------------------
+	// 書き戻し先（起きている Dynamic 以外は nullptr）
+	// --------------------------------------------------
+	std::vector<Rigidbody*> m_pWriteBack;
+
+public:
+	// ==================================================
+	// ----- 構築、書き戻し -----
+	// ==================================================
+	void Clear();
+	int  Add(Rigidbody* rb, bool canMove); // canMove: 起きている Dynamic か
+	void WriteBack() const;
+	int  Count() const { return (int)m_InvMass.size(); }
+
+	// ==================================================
+	// ----- 読み書き -----
+	// ==================================================
+	float InvMass(int i) const { return m_InvMass[i]; }
+	Vector3 COM(int i) const { return Vector3(m_PX[i], m_PY[i], m_PZ[i]); }
+	Vector3 LinearVelocity(int i) const { return Vector3(m_VX[i], m_VY[i], m_VZ[i]); }
+	Vector3 AngularVelocity(int i) const { return Vector3(m_WX[i], m_WY[i], m_WZ[i]); }
+	void SetLinearVelocity(int i, const Vector3& v) { m_VX[i] = v.x; m_VY[i] = v.y; m_VZ[i] = v.z; }
+	void SetAngularVelocity(int i, const Vector3& w) { m_WX[i] = w.x; m_WY[i] = w.y; m_WZ[i] = w.z; }
+	Vector3 PseudoLinearVelocity(int i) const { return Vector3(m_PVX[i], m_PVY[i], m_PVZ[i]); }
+	Vector3 PseudoAngularVelocity(int i) const { return Vector3(m_PWX[i], m_PWY[i], m_PWZ[i]); }
+	void SetPseudoLinearVelocity(int i, const Vector3& v) { m_PVX[i] = v.x; m_PVY[i] = v.y; m_PVZ[i] = v.z; }
+	void SetPseudoAngularVelocity(int i, const Vector3& w) { m_PWX[i] = w.x; m_PWY[i] = w.y; m_PWZ[i] = w.z; }
+	// --------------------------------------------------
+	// I^-1 を掛ける（Rigidbody::ApplyInvInertiaWorld と同じ行ベクトル流儀）
+	// --------------------------------------------------
+	Vector3 ApplyInvInertia(int i, const Vector3& v) const
+	{
+		return Vector3(
+			v.x * m_I00[i] + v.y * m_I10[i] + v.z * m_I20[i],
+			v.x * m_I01[i] + v.y * m_I11[i] + v.z * m_I21[i],
+			v.x * m_I02[i] + v.y * m_I12[i] + v.z * m_I22[i]);
+	}
+};
+
+#endif
@@ -11,22 +11,22 @@
 
 struct SpriteClip
 {
-	int columns; // 
-	int rows;	 // c
-	int frameCount; // ۂɎgR}̐
+	int columns; // 横分割数
+	int rows;	 // 縦分割数
+	int frameCount; // 実際に使うコマの数
 	float fps;
 	bool loopDefault = false;
-	bool flipY = false; // eNX`̏㉺]
-	bool flipX = false; // eNX`̍E]
+	bool flipY = false; // テクスチャの上下反転
+	bool flipX = false; // テクスチャの左右反転
 };
 
 class SpriteAnimationComponent : public Component
 {
 private:
 	SpriteRendererComponent* m_pSpriteRenderer = nullptr;
-	const SpriteClip* m_pClip = nullptr; // On
+	const SpriteClip* m_pClip = nullptr; // 外部から渡す
 
-	// 
+	// 状態
 	bool m_IsPlaying = true;
 	bool m_IsLoop = true;
 	float m_Speed = 1.0f;
@@ -44,7 +44,7 @@ public:
 		if (!m_pSpriteRenderer) return;
 		if (!m_pClip) return;
 
-		// Nbv
+		// クリップ情報
 		const int columns = m_pClip->columns;
 		const int rows	  = m_pClip->rows;
 		const float fps   = m_pClip->fps;
@@ -58,12 +58,12 @@ public:
 		if (frames <= 0 || frames > sheetFrames) frames = sheetFrames;
 		if (frames <= 0) return;
 
-		// ĐĂȂꍇłAOSetFrameƂ̔f̂߂Dirty
+		// 再生していない場合でも、外部からSetFrameしたときの反映のためのDirty処理
 		if (m_IsPlaying)
 		{
 			m_Timer += fixedDt * m_Speed;
 
-			// t[Zo
+			// フレーム算出
 			int newFrame = (int)(m_Timer * fps);
 
 			if (m_IsLoop)
@@ -75,7 +75,7 @@ public:
 				if (newFrame >= frames)
 				{
 					newFrame = frames - 1;
-					m_IsPlaying = false; // ~
+					m_IsPlaying = false; // 自動停止
 				}
 				if (newFrame < 0) newFrame = 0;
 			}
@@ -89,9 +89,9 @@ public:
 		if (m_Frame >= frames) m_Frame = frames - 1;
 
 		if (!m_Dirty) return;
-		m_Dirty = false; // dirty 
+		m_Dirty = false; // dirty 消費
 
-		// frame  uv rect
+		// frame → uv rect
 		const float sx = 1.0f / (float)columns;
 		const float sy = 1.0f / (float)rows;
 		const int col = m_Frame % columns;
@@ -115,7 +115,7 @@ public:
 		m_pSpriteRenderer->SetUVRect(offset, scale);
 	}
 
-	// OAPI
+	// 外部API
 	void SetClip(const SpriteClip* clip, bool resetTimer = true) 
 	{ 
 		m_pClip = clip; 
@@ -16,12 +16,12 @@ private:
 	Vector2 m_UvScale  = { 1, 1 };
 	Vector4 m_Color	   = { 1, 1, 1, 1 };
 
-	bool m_IsUI    = false; // UI\
-	bool m_OnWorld = false; // RDԂɂ邩ǂ
-	int m_Order = 0; // UI`揇i[xɂ͗Ȃj
+	bool m_IsUI    = false; // UI表示
+	bool m_OnWorld = false; // ３D空間にあるかどうか
+	int m_Order = 0; // UI描画順序（深度には頼らない）
 
 public:
-	// CtTCN
+	// ライフサイクル
 	void OnAdded() override
 	{
 		MeshRendererComponent::OnAdded();
@@ -31,22 +31,22 @@ public:
 		if (!m_pTransform || !m_pMeshFilter || !m_pMaterialBase) return;
 		if (!m_pMaterialBase->IsReady() || !m_pMeshFilter->IsReady()) return;
 
-		// }eAiVF[_AILAeNX`A萔obt@MATERIALjoCh
+		// マテリアル（シェーダ、IL、テクスチャ、定数バッファのMATERIAL）をバインド
 		m_pMaterialBase->Bind();
 
-		// world s Renderer 
+		// world 行列を Renderer に
 		const Matrix4x4& worldMatrix = m_pTransform->WorldMatrix();
 		const Matrix4x4& worldMatrixInv = m_pTransform->WorldMatrixInv();
 		Renderer::SetObject(worldMatrix, worldMatrixInv);
 		
-		// Sprite XV
+		// Sprite 情報更新
 		SpriteApp s;
 		s.spriteUVOffset = m_UvOffset;
 		s.spriteUVScale  = m_UvScale;
 		s.spriteColor	 = m_Color;
 		Renderer::SetSprite(s);
 		
-		// MeshZbg Draw
+		// Meshをセットして Draw
 		auto* ctx = Renderer::DeviceContext();
 		if (!ctx) return;
 
@@ -62,13 +62,13 @@ public:
 			ctx->IASetIndexBuffer(m_pMeshFilter->IndexBuffer(), m_pMeshFilter->IndexFormat(), 0);
 			ctx->DrawIndexed(m_pMeshFilter->IndexCount(), 0, 0);
 		}
-		else // CfbNX`i_`j
+		else // 非インデックス描画（頂点描画）
 		{
 			ctx->Draw(m_pMeshFilter->VertexCount(), 0);
 		}
 	}
 
-	// Zb^[
+	// セッター
 	void SetUVRect(const Vector2& offset, const Vector2& scale)
 	{
 		m_UvOffset = offset;
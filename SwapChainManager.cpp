@@ -1,7 +1,7 @@
 /*
 	SwapChainManager.cpp
 	20251006  hanaue sho
-	SwapChain, RTV, DSV 𐶐NX
+	SwapChain, RTV, DSV を生成するクラス
 */
 #include "SwapChainManager.h"
 #include <cassert>
@@ -14,7 +14,7 @@ void SwapChainManager::Create(HWND hwnd, uint32_t width, uint32_t height, ID3D11
 	m_Device = dev;
 	m_DeviceContext = ctx;
 
-	// DXGI Factory 擾
+	// DXGI Factory 取得
 	ComPtr<IDXGIDevice> dxgiDevice;
 	HRESULT hr = m_Device.As(&dxgiDevice);
 	assert(SUCCEEDED(hr));
@@ -43,26 +43,26 @@ void SwapChainManager::Destroy()
 
 void SwapChainManager::Resize(uint32_t width, uint32_t height)
 {
-	if (width == 0 || height == 0) return; // OTCY͖
+	if (width == 0 || height == 0) return; // ０サイズは無視
 	if (!m_SwapChain) return;
 	m_Width  = width;
 	m_Height = height;
 
-	// ŏɃAoChiOMOj
+	// 最初にアンバインド（OMから外す）
 	if (m_DeviceContext)
 	{
 		ID3D11RenderTargetView* nullRTV[1] = { nullptr };
 		m_DeviceContext->OMSetRenderTargets(0, nullRTV, nullptr);
 	}
 
-	// obNobt@ɂԂ牺r[͐ɉ
+	// バックバッファにぶら下がるビューは先に解放
 	m_DSV.Reset();
 	m_RTV.Reset();
 
-	// obt@TCYύX
-	HRESULT hr = m_SwapChain->ResizeBuffers(0, // buffer count (0 = ύX) 
+	// バッファサイズ変更
+	HRESULT hr = m_SwapChain->ResizeBuffers(0, // buffer count (0 = 変更無し) 
 											width, height,
-											DXGI_FORMAT_R8G8B8A8_UNORM, // Ɠ
+											DXGI_FORMAT_R8G8B8A8_UNORM, // 既存と同じ
 											0
 											);
 	assert(SUCCEEDED(hr));
@@ -93,33 +93,33 @@ void SwapChainManager::Present(int vsync)
 void SwapChainManager::CreateSwapChain(HWND hwnd)
 {
 	DXGI_SWAP_CHAIN_DESC scd = {};
-	// obt@\
-	scd.BufferCount = 1; // obNobt@̖i݂̓_uobt@j
+	// バッファ構成
+	scd.BufferCount = 1; // バックバッファの枚数（現在はダブルバッファ）
 	scd.BufferDesc.Width = m_Width;
 	scd.BufferDesc.Height = m_Height;
 	scd.BufferDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
 	scd.BufferDesc.RefreshRate.Numerator = 60;
 	scd.BufferDesc.RefreshRate.Denominator = 1;
 
-	// gpړI
+	// 使用目的
 	scd.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
 
-	// o͐EBhE
+	// 出力先ウィンドウ
 	scd.OutputWindow = hwnd;
 
-	// TvO
-	scd.SampleDesc.Count = 1;	// A`GCAXȂ
-	scd.SampleDesc.Quality = 0; // ix
+	// サンプリング
+	scd.SampleDesc.Count = 1;	// アンチエイリアスなし
+	scd.SampleDesc.Quality = 0; // 品質レベル
 
-	// }`Tvgꍇ Factory ŕi₢킹Kv
+	// マルチサンプルを使う場合は Factory で品質を問い合わせる必要がある
 	// device->CheckMultisampleQualityLevels(...);
 
-	// EBhE[h^tXN[
+	// ウィンドウモード／フルスクリーン
 	scd.Windowed = TRUE;
 
-	// XbvGtFNg
-	scd.SwapEffect = DXGI_SWAP_EFFECT_DISCARD; // DXGI 1.0 ݊
-	scd.Flags = 0; // tOȂiIvVŎgj
+	// スワップエフェクト
+	scd.SwapEffect = DXGI_SWAP_EFFECT_DISCARD; // DXGI 1.0 互換
+	scd.Flags = 0; // 特殊フラグなし（垂直同期オプション等で使う）
 
 	HRESULT hr = m_Factory->CreateSwapChain(m_Device.Get(), &scd, m_SwapChain.GetAddressOf());
 	assert(SUCCEEDED(hr));
@@ -142,7 +142,7 @@ void SwapChainManager::CreateDepthStencil(uint32_t w, uint32_t h)
 	td.Height = h;
 	td.MipLevels = 1;
 	td.ArraySize = 1;
-	td.Format = DXGI_FORMAT_D16_UNORM; // 24bit [x + 8bit XeViD16֖߂j
+	td.Format = DXGI_FORMAT_D16_UNORM; // 24bit 深度 + 8bit ステンシル（今はD16へ戻した）
 	td.SampleDesc.Count = 1;
 	td.Usage = D3D11_USAGE_DEFAULT;
 	td.BindFlags = D3D11_BIND_DEPTH_STENCIL;
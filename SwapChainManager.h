@@ -1,7 +1,7 @@
 /*
 	SwapChainManager.h
 	20251006  hanaue sho
-	SwapChain, RTV, DSV 𐶐NX
+	SwapChain, RTV, DSV を生成するクラス
 */
 #ifndef SWAPCHAINMANAGER_H_
 #define SWAPCHAINMANAGER_H_
@@ -16,7 +16,7 @@ class SwapChainManager
 {
 private:
 	// ==================================================
-	// ----- {̗vf -----
+	// ----- 本体要素 -----
 	// ==================================================
 	ComPtr<ID3D11Device> m_Device;
 	ComPtr<ID3D11DeviceContext> m_DeviceContext;
@@ -24,13 +24,13 @@ private:
 	ComPtr<ID3D11RenderTargetView> m_RTV;
 	ComPtr<ID3D11DepthStencilView> m_DSV;
 
-	ComPtr<IDXGIFactory> m_Factory; // DXGI 1.0 ݊̂
+	ComPtr<IDXGIFactory> m_Factory; // DXGI 1.0 互換のため
 	HWND m_hWnd{};
 	uint32_t m_Width{}, m_Height{};
 
 public:
 	// ==================================================
-	// ----- ֐ -----
+	// ----- 関数 -----
 	// ==================================================
 	void Create(HWND hwnd, uint32_t width, uint32_t height, ID3D11Device* dev, ID3D11DeviceContext* ctx);
 	void Destroy();
@@ -41,7 +41,7 @@ public:
 	void Present(int vsync);
 
 	// ==================================================
-	// ----- Render::Init ɓn -----
+	// ----- Render::Init に渡すもの -----
 	// ==================================================
 	IDXGISwapChain*			SwapChain() const { return m_SwapChain.Get(); }
 	ID3D11RenderTargetView* RTV()		const { return m_RTV.Get(); }
@@ -51,7 +51,7 @@ public:
 
 private:
 	// ==================================================
-	// ----- NGCg֐ -----
+	// ----- クリエイト関数 -----
 	// ==================================================
 	void CreateSwapChain(HWND hwnd);
 	void CreateBackbufferRTV();
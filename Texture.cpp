@@ -3,7 +3,7 @@
 #include "Manager.h"
 
 #include <windows.h>
-//#include <d3d11.h> // ꂢH
+//#include <d3d11.h> // これいる？
 #include "DirectXTex.h" 
 #if _DEBUG
 #pragma comment(lib, "DirectXTex_Debug.lib")
@@ -16,45 +16,45 @@ std::unordered_map<std::string, ID3D11ShaderResourceView*> Texture::m_PoolByKey;
 
 std::string Texture::MakeKeyFromPath(const std::string& fullPath)
 {
-	// ؂蕶𓝈
+	// 区切り文字を統一
 	std::string s = fullPath;
 	for (auto& ch : s) if (ch == '\\') ch = '/';
 
-	// Ō̃XbVʒuT
+	// 最後のスラッシュ位置を探す
 	const auto slash = s.find_last_of('/');
 	const size_t start = (slash == std::string::npos) ? 0 : (slash + 1);
 
-	// Ō̃hbgʒuT
+	// 最後のドット位置を探す
 	auto dot = s.find_last_of('.');
 	if (dot == std::string::npos || dot < start) dot = s.size();
 
-	// [start, dot) Ԃ
+	// [start, dot) を返す
 	return s.substr(start, dot - start);
 }
 
 ID3D11ShaderResourceView* Texture::LoadByPath(const char* fullPath)
 {
-	// ----- ؂蕶𓝈 -----
+	// ----- 区切り文字を統一 -----
 	std::string s = fullPath;
 	for (auto& ch : s) if (ch == '\\') ch = '/';
 
-	// ----- tpXŃ[hς݂Ȃv[Ԃ -----
+	// ----- フルパスでロード済みならプールから返す -----
 	auto it = m_PoolByPath.find(s);
 	if (it != m_PoolByPath.end())
 	{
-		return it->second; // ̂ŕԂ
+		return it->second; // 見つけたので返す
 	}
 
-	// ----- }`oCgCh֕ϊ -----
+	// ----- マルチバイト→ワイド文字へ変換 -----
 	wchar_t wFileName[512];
 	const size_t CAP = sizeof(wFileName) / sizeof(wFileName[0]);
-	if (s.size() + 1 > CAP) return nullptr;		// I[o[t[h~
+	if (s.size() + 1 > CAP) return nullptr;		// オーバーフロー防止
 
-	size_t wrote = mbstowcs(wFileName, s.c_str(), s.size() + 1); // RCAPijƓ
-	if (wrote == (size_t)-1) return nullptr;   // s`FbN
-	if (wrote < CAP) wFileName[wrote] = L'\0'; // ÔߏI[`FbN
+	size_t wrote = mbstowcs(wFileName, s.c_str(), s.size() + 1); // 第３引数はCAP（上限）と同じ
+	if (wrote == (size_t)-1) return nullptr;   // 失敗チェック
+	if (wrote < CAP) wFileName[wrote] = L'\0'; // 念のため終端チェック
 
-	// ----- WIC oRPNG/JPG/BMP ǂݍ -----
+	// ----- WIC 経由でPNG/JPG/BMP を読み込み -----
 	using namespace DirectX;
 	TexMetadata metadata;
 	ScratchImage image;
@@ -62,7 +62,7 @@ ID3D11ShaderResourceView* Texture::LoadByPath(const char* fullPath)
 	HRESULT hr = LoadFromWICFile(wFileName, WIC_FLAGS_NONE, &metadata, image);
 	if (FAILED(hr)) return nullptr;
 
-	// ----- SRV ̐ -----
+	// ----- SRV の生成 -----
 	hr = CreateShaderResourceView(
 		Renderer::Device(), 
 		image.GetImages(), 
@@ -70,10 +70,10 @@ ID3D11ShaderResourceView* Texture::LoadByPath(const char* fullPath)
 		metadata, 
 		&pTexture);
 	
-	// ----- SRV łƂmF -----
+	// ----- SRV が生成できたことを確認 -----
 	if (FAILED(hr) || !pTexture) return nullptr;
 
-	// ----- v[ɓo^ -----
+	// ----- プールに登録 -----
 	m_PoolByPath[s] = pTexture;
 
 	return pTexture;
@@ -86,7 +86,7 @@ ID3D11ShaderResourceView* Texture::LoadAndRegisterKey(const char* fullPath)
 
 	std::string key = MakeKeyFromPath(fullPath);
 
-	// Փ˂͂lȂŃv[ɒǉ
+	// 衝突はいったん考えないでプールに追加
 	m_PoolByKey[key] = srv;
 
 	return srv;
@@ -94,7 +94,7 @@ ID3D11ShaderResourceView* Texture::LoadAndRegisterKey(const char* fullPath)
 
 ID3D11ShaderResourceView* Texture::GetByKey(const char* keyNoExt)
 {
-	auto it = m_PoolByKey.find(keyNoExt); // 啶
+	auto it = m_PoolByKey.find(keyNoExt); // 大文字小文字を区別
 	return (it != m_PoolByKey.end()) ? it->second : nullptr;
 }
 
@@ -102,7 +102,7 @@ int Texture::PreloadDirectory(const char* dirPath, bool recursive)
 {
 	if (!dirPath) return 0;
 
-	std::string dir = NormalizePathKey(dirPath); // KĂ֐
+	std::string dir = NormalizePathKey(dirPath); // 正規化してから実装関数へ
 	return PreloadDirectoryImpl(dir, recursive);
 }
 
@@ -119,8 +119,8 @@ int Texture::GetTexturesFromDir(const char* dirPath, std::vector<ID3D11ShaderRes
 {
 	if (!dirPath) return 0;
 
-	std::string dir = NormalizePathKey(dirPath); // K
-	if (dir.back() != '/') dir += "/"; // ɃXbVȂt^
+	std::string dir = NormalizePathKey(dirPath); // 正規化
+	if (dir.back() != '/') dir += "/"; // 末尾にスラッシュが無いなら付与
 
 	const size_t before = out.size();
 
@@ -131,7 +131,7 @@ int Texture::GetTexturesFromDir(const char* dirPath, std::vector<ID3D11ShaderRes
 
 		if (!recursive)
 		{
-			// ̂݁Fdir ̒ɍXȂ'/'΃TutH_Ȃ̂ŏO
+			// 直下のみ：dir の直後に更なる'/'があればサブフォルダなので除外
 			size_t pos = path.find('/', dir.size());
 			if (pos != std::string::npos) continue;
 		}
@@ -140,7 +140,7 @@ int Texture::GetTexturesFromDir(const char* dirPath, std::vector<ID3D11ShaderRes
 	return static_cast<int>(out.size() - before);
 }
 
-// SJ
+// 全開放
 void Texture::Shutdown()
 {
 	for (auto& kv : m_PoolByPath)
@@ -158,68 +158,68 @@ std::string Texture::NormalizePathKey(const char* path)
 
 int Texture::PreloadDirectoryImpl(const std::string& dirNormalized, bool recursive)
 {
-	// '\\'؂ windows pX쐬
-	// winAPI Ō邽߂Ɉx '\\'؂֖߂
+	// '\\'区切りの windows パスを作成
+	// winAPI で検索するために一度 '\\'区切りへ戻す
 	std::string winPath = dirNormalized;
 	for (auto& ch : winPath) if (ch == '/') ch = '\\';
 	if (!winPath.empty() && winPath.back() != '\\') winPath.push_back('\\');
 
-	// p^[iChJ[hj
+	// 検索パターン（ワイルドカード）
 	std::string pattern = winPath + "*";
 
-	// ANSI ł̌Jn
+	// ANSI 版の検索を開始
 	WIN32_FIND_DATAA fda;
 	HANDLE hFind = FindFirstFileA(pattern.c_str(), &fda);
-	if (hFind == INVALID_HANDLE_VALUE) return 0; // sȂOԂ
+	if (hFind == INVALID_HANDLE_VALUE) return 0; // 失敗なら０を返す
 
 	int loaded = 0;
 
 	do 	
 	{
-		// Gg
+		// 見つかったエントリ名
 		const char* nameA = fda.cFileName;
 		if (std::strcmp(nameA, ".") == 0 || std::strcmp(nameA, "..") == 0) continue;
 
-		// q̃tpXiANSIj
+		// 子のフルパス（ANSI）
 		std::string child = winPath + nameA;
 
-		// GW\֐K
+		// エンジン内部表現へ正規化
 		for (auto& ch : child) if (ch == '\\') ch = '/';
 
-		// fBNgt@C𑮐Ŕ
+		// ディレクトリかファイルかを属性で判定
 		const bool isDir = (fda.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
 		if (isDir)
 		{
-			// fBNgȂA recursive = true ̂ƂɍċAIɏ
+			// ディレクトリなら、 recursive = true のときに再帰的に処理
 			if (recursive) loaded += PreloadDirectoryImpl(child, true);
 		}
 		else
 		{
-			// t@CȂgq WIC 摜
+			// ファイルなら拡張子が WIC 画像か判定
 			if (!IsWicImageExt(child)) continue;
-			// 摜Ȃ烍[hL[o^
+			// 画像ならロード＆キー登録
 			if (Texture::LoadAndRegisterKey(child.c_str())) ++loaded;
 		}
-	} while (FindNextFileA(hFind, &fda)); // ̃Gg
+	} while (FindNextFileA(hFind, &fda)); // 次のエントリへ
 
-	// nh
+	// ハンドルを閉じる
 	FindClose(hFind);
 	return loaded;
 }
 
 bool Texture::IsWicImageExt(const std::string& path)
 {
-	// gq擾
+	// 小文字拡張子を取得
 	int dot = -1;
 	for (int i = (int)path.size() - 1; i >= 0; i--)
 	{
 		if (path[i] == '.') { dot = i; break; }
-		if (path[i] == '/' || path[i] == '\\') break; // fBNgׂ璆f
+		if (path[i] == '/' || path[i] == '\\') break; // ディレクトリを跨いだら中断
 	}
 	if (dot < 0) return false;
 
-	std::string ext = path.substr(dot); // gqo
-	for (auto& c : ext) c = (char)std::tolower((unsigned char)c); // gq
+	std::string ext = path.substr(dot); // 拡張子部分を取り出す
+	for (auto& c : ext) c = (char)std::tolower((unsigned char)c); // 拡張子部分を小文字化
 
 	return ext == ".png" || ext == ".jpg" || ext == ".jpeg" ||
 		   ext == ".bmp" || ext == ".gif" || ext == ".tif"  ||
@@ -1,7 +1,7 @@
 /*
 	Texture.h
 	20250929  hanaue sho
-	eNX`[h̃NX
+	テクスチャロード周りのクラス
 */
 #ifndef TEXTURE_H_
 #define TEXTURE_H_
@@ -14,75 +14,75 @@ class Texture
 {
 private:
 	// --------------------------------------------------
-	// eNX`v[
+	// テクスチャプール
 	// --------------------------------------------------
-	static std::unordered_map<std::string, ID3D11ShaderResourceView*> m_PoolByPath; // tpX
-	static std::unordered_map<std::string, ID3D11ShaderResourceView*> m_PoolByKey;  // L[
+	static std::unordered_map<std::string, ID3D11ShaderResourceView*> m_PoolByPath; // フルパス
+	static std::unordered_map<std::string, ID3D11ShaderResourceView*> m_PoolByKey;  // キー
 
 	// --------------------------------------------------
-	// L[wp֐
+	// キーを作るヘルパ関数
 	// --------------------------------------------------
 	static std::string MakeKeyFromPath(const std::string& fullPath);
 
 public:
 	// --------------------------------------------------
-	// eNX`̃[h
-	// t@C̃pX摜[h
-	// ̉摜v[֊i[
+	// テクスチャのロード
+	// ファイルのパスから画像をロード
+	// その画像をプールへ格納
 	// --------------------------------------------------
 	static ID3D11ShaderResourceView* LoadByPath(const char* fullPath);
 
 	// --------------------------------------------------
-	// eNX`[ho^
-	// L[t@Cl[ɂĊi[
+	// テクスチャをロード＆登録
+	// キーをファイルネームにして格納
 	// --------------------------------------------------
 	static ID3D11ShaderResourceView* LoadAndRegisterKey(const char* fullPath);
 
 	// --------------------------------------------------
-	// t@Cl[L[摜擾
+	// ファイルネームキーから画像を取得
 	// --------------------------------------------------
 	static ID3D11ShaderResourceView* GetByKey(const char* keyNoExt);
 
 	// --------------------------------------------------
-	// w肵tH_̒̉摜ǂݍ
+	// 指定したフォルダの中の画像を読み込む
 	// --------------------------------------------------
 	static int PreloadDirectory(const char* dirPath, bool recursive = true);
 
 	// --------------------------------------------------
-	// SẴeNX`擾
+	// 全てのテクスチャを取得
 	// --------------------------------------------------
 	static int GetTextureAll(std::vector<ID3D11ShaderResourceView*>& out);
 
 	// --------------------------------------------------
-	// w肵fBNg̃eNX`擾
+	// 指定したディレクトリのテクスチャを取得
 	// --------------------------------------------------
 	static int GetTexturesFromDir(const char* dirPath, std::vector<ID3D11ShaderResourceView*>& out, bool recursive = false);
 
 	// --------------------------------------------------
-	// I
+	// 終了処理
 	// --------------------------------------------------
 	static void Shutdown();
 
 private:
 	// --------------------------------------------------
-	// pX̐K
+	// パスの正規化
 	// --------------------------------------------------
 	static std::string NormalizePathKey(const char* path);
 
 	// --------------------------------------------------
-	// fBNg̑
+	// ディレクトリ内の走査
 	// --------------------------------------------------
 	static int PreloadDirectoryImpl(const std::string& dirNormalized, bool recursive);
 
 	// --------------------------------------------------
-	// gq̔
+	// 拡張子の判定
 	// --------------------------------------------------
 	static bool IsWicImageExt(const std::string& path);
 
 	// --------------------------------------------------
-	// 퓬v
-	// s ̐擪 prefix.size() ̕ prefix ۂƔr
-	// s ̐擪 prefix vĂ邩
+	// 戦闘一致判定
+	// s の先頭 prefix.size() 分の文字と prefix を丸ごと比較
+	// s の先頭と prefix が一致しているか判定
 	// --------------------------------------------------
 	static bool StartsWith(const std::string& s, const std::string& prefix);
 
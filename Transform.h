@@ -13,26 +13,26 @@ struct Transform
 {
 public:
     // ==================================================
-	// ----- vf{ -----
+	// ----- 要素本体 -----
     // ==================================================
 	Vector3 position = {0.0f, 0.0f, 0.0f};
-	Quaternion rotation = Quaternion::Identity(); // NH[^jI
+	Quaternion rotation = Quaternion::Identity(); // クォータニオン
 	Vector3 scale = { 1.0f, 1.0f, 1.0f };
 
     // ==================================================
-    // ----- RXgN^ -----
+    // ----- コンストラクタ -----
     // ==================================================
 	Transform() {}
 
     // ==================================================
-	// ----- Qb^[Zb^[ -----
+	// ----- ゲッターセッター -----
     // ==================================================
-	Matrix4x4 GetLocalMatrix() const // iTransformComponentŎgĂ܂j
+	Matrix4x4 GetLocalMatrix() const // （TransformComponentで使っています）
 	{
 		Matrix4x4 Scale = Matrix4x4::CreateScale(scale.x, scale.y, scale.z);
-		Matrix4x4 Rotation = rotation.ToMatrix(); // ]s
+		Matrix4x4 Rotation = rotation.ToMatrix(); // 回転行列
 		Matrix4x4 Translation = Matrix4x4::CreateTranslation(position.x, position.y, position.z);
-		return Scale * Rotation * Translation; // SRT ̏
+		return Scale * Rotation * Translation; // S→R→T の順番
 	}
 
 	Vector3 GetRight() const	{ return rotation.Rotate(Vector3(1, 0, 0)); }
@@ -40,19 +40,19 @@ public:
 	Vector3 GetForward() const	{ return rotation.Rotate(Vector3(0, 0, 1)); }
 
     // ==================================================
-    // ----- [eBeB -----
+    // ----- ユーティリティ -----
     // ==================================================
     // --------------------------------------------------
-	// MatrixTransform𐶐
+	// MatrixからTransformを生成
     // --------------------------------------------------
     static Transform FromMatrix(const Matrix4x4& mat, float eps = 1e-6f) noexcept
     {
         Transform out;
 
-        // PjTranslationisxNgFSsڂsړj
+        // １）Translation（行ベクトル：４行目が平行移動成分）
         out.position = Vector3(mat.m[3][0], mat.m[3][1], mat.m[3][2]);
 
-        // 2) ScaleF3x3 ̊eusv̒isxNgVj
+        // 2) Scale：3x3 の各「行」の長さ（行ベクトル流儀）
         Vector3 row0 = Vector3(mat.m[0][0], mat.m[0][1], mat.m[0][2]);
         Vector3 row1 = Vector3(mat.m[1][0], mat.m[1][1], mat.m[1][2]);
         Vector3 row2 = Vector3(mat.m[2][0], mat.m[2][1], mat.m[2][2]);
@@ -63,15 +63,15 @@ public:
 
         out.scale = Vector3(sx, sy, sz);
 
-        // 3) RotationFsKisxNgj
+        // 3) Rotation：行正規化（行ベクトル）
         Vector3 u0 = row0 * (1.0f / sx);
         Vector3 u1 = row1 * (1.0f / sy);
         Vector3 u2 = row2 * (1.0f / sz);
 
-        // ]XP[is̔ˁj΍FE蒼ɂ낦
+        // 反転スケール（行列の反射）対策：右手直交にそろえる
         if (Vector3::Dot(Vector3::Cross(u0, u1), u2) < 0.0f) 
         {
-            // Ƃ Z 𔽓]iǂłǂѐ厖j
+            // 慣例として Z を反転（どれでも良いが一貫性が大事）
             u2 *= -1.0f;
             sz = -sz;
             out.scale.z = sz;
@@ -86,4 +86,4 @@ public:
 	}
 };
 
-#endif TRANSFORM_H_
\ No newline at end of file
+#endif // TRANSFORM_H_
\ No newline at end of file
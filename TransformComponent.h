@@ -1,7 +1,7 @@
 /*
 	TransformComponent.h
 	20250813  hanaue sho
-	TransformĂR|[lg
+	Transformを持っているコンポーネント
 */
 #ifndef TRANSFORMCOMPONENT_H_
 #define TRANSFORMCOMPONENT_H_
@@ -17,55 +17,60 @@ class TransformComponent : public Component
 {
 protected:
     // ==================================================
-    // ----- vf -----
+    // ----- 要素 -----
     // ==================================================
     // --------------------------------------------------
-    // f[^{
+    // データ本体
     // --------------------------------------------------
-	Transform m_Value{}; //  Transform ̂܂ܓ
+	Transform m_Value{}; // 既存の Transform をそのまま内包
     // --------------------------------------------------
-    // eq֌Wi񏊗Lj
+    // 親子関係（非所有）
     // --------------------------------------------------
     TransformComponent* m_pParent = nullptr;
     std::vector<TransformComponent*> m_Children;
     // --------------------------------------------------
-    // LbV
+    // キャッシュ
     // --------------------------------------------------
     mutable Matrix4x4 m_Local{};
     mutable Matrix4x4 m_World{};
-    mutable Matrix4x4 m_WorldInv{}; // t[hs̃LbV
-    mutable bool m_LocalDirty = true; // ύXiCBXVKw`̍œKɎgj
-    mutable bool m_WorldDirty = true; // ύXiCBXVKw`̍œKɎgj
+    mutable Matrix4x4 m_WorldInv{}; // 逆ワールド行列のキャッシュ
+    mutable bool m_LocalDirty = true; // 何か変更があったか（CB更新や階層伝搬の最適化に使える）
+    mutable bool m_WorldDirty = true; // 何か変更があったか（CB更新や階層伝搬の最適化に使える）
+    // --------------------------------------------------
+    // 書き換えの通知（非所有）
+    // 眠っている剛体が見張って、スクリプトや親に動かされたら起きる
+    // --------------------------------------------------
+    Component* m_pMoveWatcher = nullptr;
 
 public:
     // ==================================================
-    // ----- RXgN^ -----
+    // ----- コンストラクタ -----
     // ==================================================
     TransformComponent() = default;
     ~TransformComponent() = default;
 
     // ==================================================
-    // ----- Zb^[EQb^[ -----
+    // ----- セッター・ゲッター -----
     // ==================================================
     // --------------------------------------------------
-	// ANZXil̂̂ւ̎QƁj
+	// アクセス（値そのものへの参照）
     // --------------------------------------------------
 	Transform&       Value()        noexcept { return m_Value; }
 	const Transform& Value() const  noexcept { return m_Value; }
     void             SetValue(const Transform& t) noexcept { m_Value = t; MarkLocalDirty();}
     // --------------------------------------------------
-    // [hW
+    // ワールド座標
     // --------------------------------------------------
     void SetPosition(const Vector3& pos)
     {
         if (m_pParent)
         {
-            Matrix4x4 invParent = m_pParent->WorldMatrix().Inverse(); // ts̎擾
+            Matrix4x4 invParent = m_pParent->WorldMatrix().Inverse(); // 逆行列の取得
             Vector3 localPos = invParent.TransformPoint(pos);
             SetLocalPosition(localPos);
         }
         else
-            SetLocalPosition(pos); // eȂ̂Ń[J[h
+            SetLocalPosition(pos); // 親がいないのでローカル＝ワールド
     }
     Vector3 Position() const
     {
@@ -73,17 +78,17 @@ public:
         return Vector3(w.m[3][0], w.m[3][1], w.m[3][2]);
     }
     // --------------------------------------------------
-    // [h]iQuaternionj
+    // ワールド回転（Quaternion）
     // --------------------------------------------------
     void SetRotation(const Quaternion& q)
     { 
         Quaternion parentQ = m_pParent ? m_pParent->Rotation() : Quaternion::Identity();
-        m_Value.rotation = (q * parentQ.Inverse()).normalized(); // sxNg~E~\]
+        m_Value.rotation = (q * parentQ.Inverse()).normalized(); // 行ベクトル×右手×能動回転
         MarkLocalDirty();
     }
     Quaternion Rotation() const   noexcept { return Transform::FromMatrix(WorldMatrix()).rotation; }
     // --------------------------------------------------
-    // [h]iEulerj
+    // ワールド回転（Euler）
     // --------------------------------------------------
     void    SetEulerAngles(const Vector3& e) noexcept 
     { 
@@ -92,9 +97,9 @@ public:
     }
     Vector3 EulerAngles() const noexcept { return Rotation().ToEulerAngles(); }
     // --------------------------------------------------
-    // [hXP[
-    // e]+lXP[̏ꍇ͋ߎ
-    // mɂȂɕipolar decompositionjŐ` R*S ɕĂ珈
+    // ワールドスケール
+    // 親が回転+非一様スケールの場合は近似
+    // 正確にやるなら極分解（polar decomposition）で線形部を R*S に分解してから処理
     // --------------------------------------------------
     void SetScale(const Vector3& worldS) noexcept 
     { 
@@ -131,40 +136,40 @@ public:
         return {sx, sy, sz};
     }
     // --------------------------------------------------
-    // [hxNg
+    // ワールドベクトル
     // --------------------------------------------------
     Vector3  WorldRight()    const   noexcept { return WorldMatrix().TransformNormal({ 1, 0, 0 }).normalized(); }
     Vector3  WorldUp()       const   noexcept { return WorldMatrix().TransformNormal({ 0, 1, 0 }).normalized(); }
     Vector3  WorldForward()  const   noexcept { return WorldMatrix().TransformNormal({ 0, 0, 1 }).normalized(); }
     // --------------------------------------------------
-    // [J]iQuaternionj
+    // ローカル回転（Quaternion）
     // --------------------------------------------------
     void       SetLocalRotation(const Quaternion& q)       noexcept { m_Value.rotation = q.normalized(); MarkLocalDirty(); }
     Quaternion LocalRotation()                   const   noexcept { return m_Value.rotation; }
     // --------------------------------------------------
-    // [J]iEulerj
+    // ローカル回転（Euler）
     // --------------------------------------------------
     void     SetLocalEulerAngles(const Vector3& e)       noexcept { m_Value.rotation = Quaternion::FromEulerAngles(e); MarkLocalDirty(); }
     Vector3  LocalEulerAngles()                  const   noexcept { return m_Value.rotation.ToEulerAngles(); }
     // --------------------------------------------------
-    // [JXP[
+    // ローカルスケール
     // --------------------------------------------------
     void     SetLocalScale(const Vector3& s)             noexcept { m_Value.scale = s; MarkLocalDirty(); }
     Vector3  LocalScale()                        const   noexcept { return m_Value.scale; }
     // --------------------------------------------------
-    // [JxNg
+    // ローカルベクトル
     // --------------------------------------------------
     Vector3  Right()    const   noexcept { return m_Value.GetRight(); }
     Vector3  Up()       const   noexcept { return m_Value.GetUp(); }
     Vector3  Forward()  const   noexcept { return m_Value.GetForward(); }
     // --------------------------------------------------
-    // [JW
+    // ローカル座標
     // --------------------------------------------------
     void SetLocalPosition(const Vector3& p)noexcept { m_Value.position = p; MarkLocalDirty(); }
     Vector3 LocalPosition() const noexcept { return m_Value.position; }
 
     // --------------------------------------------------
-    // s擾ixČvZj
+    // 行列取得（遅延再計算）
     // --------------------------------------------------
     const Matrix4x4& LocalMatrix()
     {
@@ -173,56 +178,56 @@ public:
             m_Local = m_Value.GetLocalMatrix();
 
             m_LocalDirty = false;
-            m_WorldDirty = true; // [Jς̂Ń[hXV
+            m_WorldDirty = true; // ローカルが変わったのでワールドも更新
         }
         return m_Local;
     }
     const Matrix4x4& WorldMatrix()
     {
-        // [JXV
-        LocalMatrix(); //  WorldDirty tOƂ
+        // ローカル更新
+        LocalMatrix(); // ここで WorldDirty フラグが立つことがある
 
         if (m_WorldDirty)
         {
             if (m_pParent)
-                m_World = m_Local * m_pParent->WorldMatrix(); // [J~e
+                m_World = m_Local * m_pParent->WorldMatrix(); // ローカル×親
             else
-                m_World = m_Local; // eȂ̂ World = Local
+                m_World = m_Local; // 親がいないので World = Local
             m_WorldDirty = false;
 
-            // m_WorldInvTranspose ̍ČvZ
+            // m_WorldInvTranspose の再計算
             CulcWorldNormalMatrix();
         }
         return m_World;
     }
-    const Matrix4x4& WorldMatrix() const // @RCĉ mutable gĂ܂@
+    const Matrix4x4& WorldMatrix() const // ※※※　コイツのせいで mutable を使っています　※※※
     {
-        const_cast<TransformComponent*>(this)->WorldMatrix(); // ōČvZĂiHj
+        const_cast<TransformComponent*>(this)->WorldMatrix(); // ここで再計算している（？）
         return m_World;
     }
     const Matrix4x4 WorldMatrixInv() const
     {
-        const_cast<TransformComponent*>(this)->WorldMatrix(); // ōČvZĂiHj
+        const_cast<TransformComponent*>(this)->WorldMatrix(); // ここで再計算している（？）
         return m_WorldInv;
     }
     
     // --------------------------------------------------
-    // Transform ̋
+    // Transform の強制書き換え
     // --------------------------------------------------
     void SetWorldMatrixFromExternal(const Matrix4x4& desireWorld)
     {
         Matrix4x4 M = desireWorld;
-        // e}gNX̊mF
+        // 親マトリクスの確認
         if (m_pParent)
         {
             const Matrix4x4 invParent = m_pParent->WorldMatrix().Inverse();
-            M = desireWorld * invParent; // ẽ[J֗Ƃ
+            M = desireWorld * invParent; // 親のローカルへ落とす
         }
 
-        // ----- Translation o -----
+        // ----- Translation 抽出 -----
         const Vector3 t(M.m[3][0], M.m[3][1], M.m[3][2]);
 
-        // ----- Rotation o -----
+        // ----- Rotation 抽出 -----
         Vector3 r0(M.m[0][0], M.m[0][1], M.m[0][2]);
         Vector3 r1(M.m[1][0], M.m[1][1], M.m[1][2]);
         Vector3 r2(M.m[2][0], M.m[2][1], M.m[2][2]);
@@ -233,7 +238,7 @@ public:
         float sy = r1.length();
         float sz = r2.length();
 
-        // ԂĂꍇ͉]XVȂ
+        // 軸がつぶれている場合は回転を更新しない
         if (sx < eps || sy < eps || sz < eps)
         {
             m_Value.position = t;
@@ -241,17 +246,17 @@ public:
             return;
         }
 
-        // XP[iPʉj
+        // スケール除去（単位化）
         Vector3 u0 = r0 * (1.0f / sx);
         Vector3 u1 = r1 * (1.0f / sy);
         Vector3 u2 = r2 * (1.0f / sz);
 
-        // ----- ȈՒň艻 -----
+        // ----- 簡易直交化で安定化 -----
         u0 = u0.normalized();
-        // u1 @u0 菜
+        // u1 から　u0 成分を取り除く
         u1 = u1 - u0 * Vector3::Dot(u0, u1);
         float u1len = u1.length();
-        if (u1len < eps) // sˉ]ێ
+        if (u1len < eps) // 直交失敗⇒回転維持
         {
             m_Value.position = t;
             MarkLocalDirty();
@@ -259,10 +264,10 @@ public:
         }
         u1 = u1 * (1.0f / u1len);
 
-        // Oς u2 蒼
+        // 外積で u2 を作り直す
         u2 = Vector3::Cross(u0, u1);
         float u2len = u2.length();
-        if (u2len < eps) // sˉ]ێ
+        if (u2len < eps) // 直交失敗⇒回転維持
         {
             m_Value.position = t;
             MarkLocalDirty();
@@ -270,14 +275,14 @@ public:
         }
         u2 = u2 * (1.0f / u2len);
 
-        // det < 0 ΍
+        // det < 0 対策
         Vector3 u2raw = r2 * (1.0f / sz);
         if (Vector3::Dot(u2, u2raw) < 0.0f)
         {
             u2 *= -1.0f;
         }
 
-        // ]s
+        // 回転行列を作る
         Matrix4x4 R;
         R.identity();
         R.m[0][0] = u0.x; R.m[0][1] = u0.y; R.m[0][2] = u0.z;
@@ -285,43 +290,49 @@ public:
         R.m[2][0] = u2.x; R.m[2][1] = u2.y; R.m[2][2] = u2.z;
         Quaternion q = Quaternion::FromMatrix(R).normalized();
 
-        // ----- Transform ֔f -----
+        // ----- Transform へ反映 -----
         m_Value.position = t;
         m_Value.rotation = q;
-        // m_Value.scale ͈ێ
+        // m_Value.scale は維持
 
         MarkLocalDirty();
     }
 
     // ==================================================
-    // ----- Dirty ֌W -----
+    // ----- Dirty 関係 -----
     // ==================================================
     // --------------------------------------------------
-    // Dirty `FbN
+    // Dirty チェック
     // --------------------------------------------------
     bool IsWorldDirty() const noexcept { return m_WorldDirty; }
     // --------------------------------------------------
-    // [Js̕ύX
+    // 書き換えの見張り（ワールド行列が変わるたびに OnTransformMoved を呼ぶ）
+    // --------------------------------------------------
+    void       SetMoveWatcher(Component* watcher) noexcept { m_pMoveWatcher = watcher; }
+    Component* MoveWatcher() const noexcept { return m_pMoveWatcher; }
+    // --------------------------------------------------
+    // ローカル行列の変更
     // --------------------------------------------------
     void MarkLocalDirty()
     {
         m_LocalDirty = true;
-        MarkWorldDirtyRecursive(); // [Jς̂Ń[hς
+        MarkWorldDirtyRecursive(); // ローカルが変わるのでワールドも変える
     }
     // --------------------------------------------------
-    // [hsύX
+    // ワールド行列変更命令
     // --------------------------------------------------
     void MarkWorldDirtyRecursive()
     {
         m_WorldDirty = true;
-        for (auto* ch : m_Children) if (ch) ch->MarkWorldDirtyRecursive(); // qS̍sČvZ
+        if (m_pMoveWatcher) m_pMoveWatcher->OnTransformMoved();
+        for (auto* ch : m_Children) if (ch) ch->MarkWorldDirtyRecursive(); // 子供全員の行列を再計算
     }
 
     // ==================================================
-    // ----- eq֌WǗ -----
+    // ----- 親子関係管理 -----
     // ==================================================
     // --------------------------------------------------
-    // node ̐e̒ maybeAncestor Ȃ`FbN
+    // node の親の中に maybeAncestor がいないかチェック
     // --------------------------------------------------
     static bool IsDescendantOf(TransformComponent* node, TransformComponent* maybeAncestor) 
     {
@@ -330,14 +341,14 @@ public:
         return false;
     }
     // --------------------------------------------------
-    // eݒi[hێj
+    // 親設定（ワールド非維持）
     // --------------------------------------------------
     void SetParent(TransformComponent* pParent)
     {
-        if (m_pParent == pParent) return; // ɐeɐݒ肵Ă
-        if (pParent && IsDescendantOf(pParent, this)) return; // ̎qeɐݒ肵Ȃ߂Ƀ`FbN
+        if (m_pParent == pParent) return; // 既に親に設定している
+        if (pParent && IsDescendantOf(pParent, this)) return; // 自分の子を親に設定しないためにチェック
 
-        // e玩O
+        // 旧親から自分を外す
         if (m_pParent)
         {
             auto& v = m_pParent->m_Children;
@@ -348,21 +359,21 @@ public:
 
         if (m_pParent) m_pParent->m_Children.push_back(this);
 
-        // eς̂Ń[hς̂ōČvZ
+        // 親が変わったのでワールド基準が変わるので再計算
         MarkWorldDirtyRecursive();
     }
     // --------------------------------------------------
-    // eݒi[hێj
+    // 親設定（ワールド維持）
     // --------------------------------------------------
     void SetParentKeepWorld(TransformComponent* newParent)
     {
-        if (m_pParent == newParent) return; // ɐeɐݒ肵Ă
-        if (newParent && IsDescendantOf(newParent, this)) return; // ̎qeɐݒ肵Ȃ߂Ƀ`FbN
+        if (m_pParent == newParent) return; // 既に親に設定している
+        if (newParent && IsDescendantOf(newParent, this)) return; // 自分の子を親に設定しないためにチェック
 
-        // ݂̃[hWێ
+        // 現在のワールド座標を保持
         Matrix4x4 currentWorld = WorldMatrix();
 
-        // ܂͒ʏ SetParent Ɠ
+        // まずは通常の SetParent と同じ処理
         if (m_pParent)
         {
             auto& v = m_pParent->m_Children;
@@ -371,7 +382,7 @@ public:
         m_pParent = newParent;
         if (m_pParent) m_pParent->m_Children.push_back(this);
          
-        // V[JWvZēKp
+        // 新しいローカル座標を計算して適用
         if (m_pParent)
         {
             Matrix4x4 invParent = m_pParent->WorldMatrix().Inverse();
@@ -381,20 +392,20 @@ public:
         else
             m_Value = Transform::FromMatrix(currentWorld);
 
-        MarkLocalDirty(); // [hXV
+        MarkLocalDirty(); // ワールドも更新される
     }
     // --------------------------------------------------
-    // Zb^[Qb^[
+    // セッターゲッター
     // --------------------------------------------------
     TransformComponent* Parent()                noexcept { return m_pParent; }
     const TransformComponent* Parent() const    noexcept { return m_pParent; }
     const std::vector<TransformComponent*>& Children() const noexcept { return m_Children; }
 
     // ==================================================
-    // ]
+    // 回転処理
     // ==================================================
     // --------------------------------------------------
-    // ]֐i[J]j
+    // 回転させる関数（ローカル軸回転）
     // --------------------------------------------------
     void Rotate(const Vector3& deltaEuler)
     {
@@ -403,7 +414,7 @@ public:
         SetLocalRotation((qL * delta).normalized());
     }
     // --------------------------------------------------
-    // Cӂ̎ŉ]
+    // 任意の軸で回転
     // --------------------------------------------------
     void RotateAxis(const Vector3& worldAxis, float angle)
     {
@@ -412,7 +423,7 @@ public:
         SetRotation((delta * qW).normalized());
     }
     // --------------------------------------------------
-    // ^[Qbg̕
+    // ターゲットの方向を向ける
     // --------------------------------------------------
     void LookAt(const Vector3& target, const Vector3& up = Vector3(0, 1, 0))
     {
@@ -421,7 +432,7 @@ public:
     }
     
     // ==================================================
-    // ----- CtTCN -----
+    // ----- ライフサイクル -----
     // ==================================================
     void OnAdded()  override 
     {
@@ -431,22 +442,22 @@ public:
     void Init()     override {}
     void Uninit()   override 
     {
-        // q̐eQƂOi|j-----
+        // 子の親参照を外す（お掃除）-----
         for (auto* ch : m_Children) if (ch) ch->m_pParent = nullptr;
         m_Children.clear();
         SetParent(nullptr);
     }
-    // Transform ͒ʏ Update/Draw ŏsvBKwȂ炱Ń[hXVȂ
-    void FixedUpdate(float dt)  override {}
-    void Update(float dt)       override {}
+    // Transform は通常 Update/Draw で処理不要。階層化するならここでワールド更新など
+    void FixedUpdate(float /*dt*/)  override {}
+    void Update(float /*dt*/)       override {}
     void Draw()                 override {}
 
 private:
     // --------------------------------------------------
-    // R~R̐`݂̂̋ts
+    // ３×３の線形部のみの逆行列
     // --------------------------------------------------
     void CulcWorldNormalMatrix()
-    {        // A = world  3x3 `isxNgKj
+    {        // A = world の 3x3 線形部（行ベクトル規約）
         float a00 = m_World.m[0][0], a01 = m_World.m[0][1], a02 = m_World.m[0][2];
         float a10 = m_World.m[1][0], a11 = m_World.m[1][1], a12 = m_World.m[1][2];
         float a20 = m_World.m[2][0], a21 = m_World.m[2][1], a22 = m_World.m[2][2];
@@ -457,7 +468,7 @@ private:
         if (std::fabs(det) > 1e-8f) {
             float invDet = 1.0f / det;
 
-            // ܂]qicofactorjvZ
+            // まず余因子（cofactor）を計算
             float c00 = (a11 * a22 - a12 * a21);
             float c01 = (a02 * a21 - a01 * a22);
             float c02 = (a01 * a12 - a02 * a11);
@@ -470,12 +481,12 @@ private:
             float c21 = (a01 * a20 - a00 * a21);
             float c22 = (a00 * a11 - a01 * a10);
 
-            // ts A^{-1} = (1/det) * Cofactor^T
+            // 逆行列 A^{-1} = (1/det) * Cofactor^T
             N.m[0][0] = c00 * invDet; N.m[0][1] = c10 * invDet; N.m[0][2] = c20 * invDet;
             N.m[1][0] = c01 * invDet; N.m[1][1] = c11 * invDet; N.m[1][2] = c21 * invDet;
             N.m[2][0] = c02 * invDet; N.m[2][1] = c12 * invDet; N.m[2][2] = c22 * invDet;
         }
-        m_WorldInv = N;   //  ϐgInvhɁBCB ւ3~3
+        m_WorldInv = N;   // ← 変数名も“Inv”に。CB へもこの3×3を入れる
     }
 
 };
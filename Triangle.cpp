@@ -1,9 +1,9 @@
 #include "Triangle.h"
 
-// _ɍł߂Op`̓_̎Zo
+// 点ｐに最も近い三角形上の点の算出
 static Vector3 ClosestPointOnTriangle(const Vector3& p, const Triangle& tri)
 {
-    // Triangle ̂R_W
+    // Triangle の３頂点座標
     const Vector3& a = tri.a;
     const Vector3& b = tri.b;
     const Vector3& c = tri.c;
@@ -15,25 +15,25 @@ static Vector3 ClosestPointOnTriangle(const Vector3& p, const Triangle& tri)
     float d1 = Vector3::Dot(ab, ap);
     float d2 = Vector3::Dot(ac, ap);
 
-    // _ A ̈
+    // 頂点 A 領域
     if (d1 <= 0.0f && d2 <= 0.0f)
         return a;
 
-    // _ B ̈
+    // 頂点 B 領域
     Vector3 bp = p - b;
     float d3 = Vector3::Dot(ab, bp);
     float d4 = Vector3::Dot(ac, bp);
     if (d3 >= 0.0f && d4 <= d3)
         return b;
 
-    // _ C ̈
+    // 頂点 C 領域
     Vector3 cp = p - c;
     float d5 = Vector3::Dot(ab, cp);
     float d6 = Vector3::Dot(ac, cp);
     if (d6 >= 0.0f && d5 <= d6)
         return c;
 
-    //  AB ̈
+    // 辺 AB 領域
     float vc = d1 * d4 - d3 * d2;
     if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
     {
@@ -41,7 +41,7 @@ static Vector3 ClosestPointOnTriangle(const Vector3& p, const Triangle& tri)
         return a + ab * v;
     }
 
-    //  AC ̈
+    // 辺 AC 領域
     float vb = d5 * d2 - d1 * d6;
     if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
     {
@@ -49,7 +49,7 @@ static Vector3 ClosestPointOnTriangle(const Vector3& p, const Triangle& tri)
         return a + ac * w;
     }
 
-    //  BC ̈
+    // 辺 BC 領域
     float va = d3 * d6 - d5 * d4;
     if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
     {
@@ -58,7 +58,7 @@ static Vector3 ClosestPointOnTriangle(const Vector3& p, const Triangle& tri)
         return b + bc * w;
     }
 
-    // ʓ̈@@Op`ʂւ̎ˉe
+    // 面内部領域　→　三角形面への射影
     Vector3 n = Vector3::Cross(ab, ac).normalized();
     float dist = Vector3::Dot(p - a, n);
     return p - n * dist;
@@ -71,15 +71,15 @@ bool CollisionTriangle::IntersectBox()
 
 bool CollisionTriangle::IntersectSphere(const Vector3& center, float radius, const Triangle& tri, TriHit& outHit)
 {
-    // ̒Sɍł߂Op`̓_߂
+    // 球の中心に最も近い三角形上の点を求める
     Vector3 closest = ClosestPointOnTriangle(center, tri);
 
-    // Ƃ̍xNg
+    // 距離との差分ベクトル
     Vector3 diff = closest - center;
     float distSq = diff.lengthSq();
     float r = radius;
 
-    // âQ傫Ȃ瓖ĂȂ
+    // 半径の２乗より大きいなら当たっていない
     if (distSq > r * r)
     {
         outHit.hit = false;
@@ -91,24 +91,24 @@ bool CollisionTriangle::IntersectSphere(const Vector3& center, float radius, con
     // penetration depth
     float penetration = r - dist;
 
-    // @߂
+    // 法線を求める
     Vector3 normal = { 1, 0, 0 };
     if (dist > 1e-8f)
     {
-        // ̒S  ŋߐړ_̕
-        normal = diff / dist; // Sphere  Triangle
+        // 球の中心 → 最近接点の方向
+        normal = diff / dist; // Sphere → Triangle
     }
     else
     {
-        // center Op`قڒɂꍇFOp`̖@g
+        // center が三角形上ほぼ直上にある場合：三角形の法線を使う
         Vector3 ab = tri.b - tri.a;
         Vector3 ac = tri.c - tri.a;
-        normal = -Vector3::Cross(ab, ac).normalized(); // Sphere  Tri Ɍ邽߂Ɂ|t
+        normal = -Vector3::Cross(ab, ac).normalized(); // Sphere → Tri に向けるために－を付ける
     }
 
-    // ڐG_
-    Vector3 contactPointOnSphere   = center + normal * radius; // sphere ̓_
-    Vector3 contactPointOnTriangle = closest; // triangle ̓_
+    // 接触点
+    Vector3 contactPointOnSphere   = center + normal * radius; // sphere 上の点
+    Vector3 contactPointOnTriangle = closest; // triangle 上の点
 
     outHit.hit = true;
     outHit.penetration = penetration;
@@ -8,7 +8,7 @@
 
 struct Triangle
 {
-	Vector3 a, b, c; // Triangle \R_i[hWj
+	Vector3 a, b, c; // Triangle を構成する３頂点（ワールド座標）
 };
 
 struct TriHit
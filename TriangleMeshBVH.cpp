@@ -0,0 +1,267 @@
+/*
+	TriangleMeshBVH.cpp
+	20261017  hanaue sho
+	三角形メッシュの当たり判定用 BVH（SAH で構築）
+*/
+#include <algorithm>
+#include <limits>
+#include <math.h>
+#include "TriangleMeshBVH.h"
+
+// ==================================================
+// ヘルパ関数
+// ==================================================
+namespace
+{
+	const float Inf = std::numeric_limits<float>::max();
+
+	// 範囲（AABB の min / max）
+	struct BuildBounds
+	{
+		Vector3 min{ Inf, Inf, Inf };
+		Vector3 max{ -Inf, -Inf, -Inf };
+
+		void Grow(const Vector3& p)
+		{
+			min = { std::min(min.x, p.x), std::min(min.y, p.y), std::min(min.z, p.z) };
+			max = { std::max(max.x, p.x), std::max(max.y, p.y), std::max(max.z, p.z) };
+		}
+		void Grow(const BuildBounds& b) // 空の範囲を足しても広がらないよう、min / max ごとに取る
+		{
+			min = { std::min(min.x, b.min.x), std::min(min.y, b.min.y), std::min(min.z, b.min.z) };
+			max = { std::max(max.x, b.max.x), std::max(max.y, b.max.y), std::max(max.z, b.max.z) };
+		}
+		// 表面積の半分（SAH の比較にしか使わないので）
+		float HalfArea() const
+		{
+			if (min.x > max.x) return 0.0f;
+			const Vector3 e = max - min;
+			return e.x * e.y + e.y * e.z + e.z * e.x;
+		}
+	};
+	float Axis(const Vector3& v, int axis) { return axis == 0 ? v.x : (axis == 1 ? v.y : v.z); }
+}
+
+// ==================================================
+// ----- 構築 -----
+// ==================================================
+TriangleMeshBVH::TriangleMeshBVH(std::vector<Vector3> vertices, std::vector<uint32_t> indices)
+	: m_Vertices(std::move(vertices)), m_Indices(std::move(indices))
+{
+	assert(m_Indices.size() % 3 == 0);
+	Build();
+}
+// --------------------------------------------------
+// ビン分けした SAH で上から分割していく
+// 三角形は重心で振り分け、葉の順に m_Indices を並べ替える
+// --------------------------------------------------
+void TriangleMeshBVH::Build()
+{
+	m_Nodes.clear();
+	const int triCount = TriangleCount();
+	if (triCount == 0) return;
+
+	// ----- 三角形ごとの範囲と重心 -----
+	std::vector<BuildBounds>	 triBounds(triCount);
+	std::vector<Vector3> centroids(triCount);
+	std::vector<int>	 order(triCount);
+	for (int t = 0; t < triCount; t++)
+	{
+		Vector3 a, b, c;
+		GetTriangle(t, a, b, c);
+		triBounds[t].Grow(a);
+		triBounds[t].Grow(b);
+		triBounds[t].Grow(c);
+		centroids[t] = (a + b + c) / 3.0f;
+		order[t] = t;
+	}
+
+	// ノード数は高々 2n - 1
+	m_Nodes.reserve(triCount * 2);
+	m_Nodes.push_back({});
+
+	// ----- 分割待ちのノード（ノード番号と order の範囲） -----
+	struct Task { int node, begin, count; };
+	std::vector<Task> tasks;
+	tasks.push_back({ 0, 0, triCount });
+	while (!tasks.empty())
+	{
+		const Task task = tasks.back();
+		tasks.pop_back();
+
+		// ----- このノードの範囲 -----
+		BuildBounds bounds, centroidBounds;
+		for (int k = task.begin; k < task.begin + task.count; k++)
+		{
+			bounds.Grow(triBounds[order[k]]);
+			centroidBounds.Grow(centroids[order[k]]);
+		}
+		m_Nodes[task.node].min = bounds.min;
+		m_Nodes[task.node].max = bounds.max;
+
+		auto makeLeaf = [&]()
+			{
+				m_Nodes[task.node].first = task.begin;
+				m_Nodes[task.node].count = task.count;
+			};
+		if (task.count <= MaxLeafTriangles) { makeLeaf(); continue; }
+
+		// ----- 各軸でビンに分けて、一番安い分割を探す -----
+		int bestAxis = -1, bestSplit = 0;
+		float bestCost = Inf;
+		for (int axis = 0; axis < 3; axis++)
+		{
+			const float lo = Axis(centroidBounds.min, axis);
+			const float hi = Axis(centroidBounds.max, axis);
+			if (hi - lo < 1e-8f) continue; // 重心が揃っていて分けられない
+			const float scale = SahBins / (hi - lo);
+
+			BuildBounds binBounds[SahBins];
+			int binCount[SahBins] = {};
+			for (int k = task.begin; k < task.begin + task.count; k++)
+			{
+				const int t = order[k];
+				const int bin = std::min(SahBins - 1, (int)((Axis(centroids[t], axis) - lo) * scale));
+				binBounds[bin].Grow(triBounds[t]);
+				binCount[bin]++;
+			}
+
+			// 右から累積しておいて、左から走査する
+			float rightArea[SahBins];
+			int rightCount[SahBins];
+			BuildBounds acc;
+			int count = 0;
+			for (int b = SahBins - 1; b > 0; b--)
+			{
+				acc.Grow(binBounds[b]);
+				count += binCount[b];
+				rightArea[b] = acc.HalfArea();
+				rightCount[b] = count;
+			}
+			acc = BuildBounds();
+			count = 0;
+			for (int b = 0; b < SahBins - 1; b++)
+			{
+				acc.Grow(binBounds[b]);
+				count += binCount[b];
+				if (count == 0 || rightCount[b + 1] == 0) continue;
+				const float cost = acc.HalfArea() * count + rightArea[b + 1] * rightCount[b + 1];
+				if (cost < bestCost)
+				{
+					bestCost = cost;
+					bestAxis = axis;
+					bestSplit = b + 1; // このビンから右
+				}
+			}
+		}
+
+		// ----- 分けても得しない（または分けられない）なら葉 -----
+		const float leafCost = bounds.HalfArea() * task.count;
+		if (bestAxis < 0 || (bestCost >= leafCost && task.count <= MaxLeafTriangles * 4)) { makeLeaf(); continue; }
+
+		// ----- 振り分け -----
+		const float lo = Axis(centroidBounds.min, bestAxis);
+		const float scale = SahBins / (Axis(centroidBounds.max, bestAxis) - lo);
+		auto mid = std::partition(order.begin() + task.begin, order.begin() + task.begin + task.count, [&](int t)
+			{
+				return std::min(SahBins - 1, (int)((Axis(centroids[t], bestAxis) - lo) * scale)) < bestSplit;
+			});
+		const int leftCount = (int)(mid - (order.begin() + task.begin));
+		assert(0 < leftCount && leftCount < task.count);
+
+		// ----- 子ノード（隣り合わせで確保） -----
+		const int left = (int)m_Nodes.size();
+		m_Nodes.push_back({});
+		m_Nodes.push_back({});
+		m_Nodes[task.node].first = left;
+		m_Nodes[task.node].count = 0;
+		tasks.push_back({ left,		task.begin,				leftCount });
+		tasks.push_back({ left + 1, task.begin + leftCount, task.count - leftCount });
+	}
+
+	// ----- 葉の順に三角形を並べ替える -----
+	std::vector<uint32_t> sorted(m_Indices.size());
+	for (int k = 0; k < triCount; k++)
+	{
+		sorted[k * 3 + 0] = m_Indices[order[k] * 3 + 0];
+		sorted[k * 3 + 1] = m_Indices[order[k] * 3 + 1];
+		sorted[k * 3 + 2] = m_Indices[order[k] * 3 + 2];
+	}
+	m_Indices.swap(sorted);
+}
+
+// ==================================================
+// ----- 探索 -----
+// ==================================================
+bool TriangleMeshBVH::Raycast(const Vector3& origin, const Vector3& dir, float maxDist, float& outT, int& outTri) const
+{
+	if (m_Nodes.empty()) return false;
+
+	const Vector3 invDir = {
+		fabsf(dir.x) > 1e-12f ? 1.0f / dir.x : (dir.x < 0.0f ? -1e30f : 1e30f),
+		fabsf(dir.y) > 1e-12f ? 1.0f / dir.y : (dir.y < 0.0f ? -1e30f : 1e30f),
+		fabsf(dir.z) > 1e-12f ? 1.0f / dir.z : (dir.z < 0.0f ? -1e30f : 1e30f) };
+	// ノードに入る t（外れなら Inf）
+	auto enter = [&](const Node& node)
+		{
+			return AABB{ node.min, node.max }.isOverlapRay(origin, invDir, maxDist)
+				? std::max({ 0.0f,
+							 std::min((node.min.x - origin.x) * invDir.x, (node.max.x - origin.x) * invDir.x),
+							 std::min((node.min.y - origin.y) * invDir.y, (node.max.y - origin.y) * invDir.y),
+							 std::min((node.min.z - origin.z) * invDir.z, (node.max.z - origin.z) * invDir.z) })
+				: Inf;
+		};
+
+	bool hit = false;
+	struct Entry { int node; float tEnter; };
+	Entry stack[MaxStack];
+	int top = 0;
+	const float tRoot = enter(m_Nodes[0]);
+	if (tRoot == Inf) return false;
+	stack[top++] = { 0, tRoot };
+	while (top > 0)
+	{
+		const Entry e = stack[--top];
+		if (e.tEnter > maxDist) continue; // 積んだ後に手前で当たった
+		const Node& node = m_Nodes[e.node];
+		if (node.IsLeaf())
+		{
+			for (int i = 0; i < node.count; i++)
+			{
+				// Moller-Trumbore（両面）
+				Vector3 a, b, c;
+				GetTriangle(node.first + i, a, b, c);
+				const Vector3 e1 = b - a;
+				const Vector3 e2 = c - a;
+				const Vector3 p = Vector3::Cross(dir, e2);
+				const float det = Vector3::Dot(e1, p);
+				if (fabsf(det) < 1e-12f) continue; // 平行
+				const float invDet = 1.0f / det;
+				const Vector3 s = origin - a;
+				const float u = Vector3::Dot(s, p) * invDet;
+				if (u < 0.0f || u > 1.0f) continue;
+				const Vector3 q = Vector3::Cross(s, e1);
+				const float v = Vector3::Dot(dir, q) * invDet;
+				if (v < 0.0f || u + v > 1.0f) continue;
+				const float t = Vector3::Dot(e2, q) * invDet;
+				if (t < 0.0f || t > maxDist) continue;
+
+				maxDist = t;
+				outT = t;
+				outTri = node.first + i;
+				hit = true;
+			}
+			continue;
+		}
+
+		// ----- 近い方の子を後に積む（先に取り出す） -----
+		int nearChild = node.first, farChild = node.first + 1;
+		float tNear = enter(m_Nodes[nearChild]);
+		float tFar	= enter(m_Nodes[farChild]);
+		if (tFar < tNear) { std::swap(nearChild, farChild); std::swap(tNear, tFar); }
+		assert(top + 2 <= MaxStack && "TriangleMeshBVH stack overflow");
+		if (tFar != Inf)  stack[top++] = { farChild, tFar };
+		if (tNear != Inf) stack[top++] = { nearChild, tNear };
+	}
+	return hit;
+}
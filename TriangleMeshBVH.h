@@ -0,0 +1,150 @@
+/*
+	TriangleMeshBVH.h
+	20261017  hanaue sho
+	三角形メッシュの当たり判定用 BVH（SAH で構築）
+	ローカル空間で持つので、同じアセットのコライダー同士で共有できる
+*/
+#ifndef TRIANGLEMESHBVH_H_
+#define TRIANGLEMESHBVH_H_
+#include <vector>
+#include <cstdint>
+#include <assert.h>
+#include <math.h>
+#include "Vector3.h"
+#include "collision.h"
+#include "ColliderPose.h"
+#include "Triangle.h"
+
+// ==================================================
+// ----- クラス本体 -----
+// ==================================================
+class TriangleMeshBVH
+{
+public:
+	// --------------------------------------------------
+	// 定数
+	// --------------------------------------------------
+	static constexpr int MaxLeafTriangles = 4;	// これ以下なら葉にする
+	static constexpr int SahBins = 12;			// SAH の分割候補（ビン）の数
+	static constexpr int MaxStack = 64;			// 探索用スタックの深さ
+
+	// --------------------------------------------------
+	// ノード（32 byte）
+	// 葉なら count > 0 で、first から count 個の三角形
+	// 節なら count == 0 で、子は first と first + 1
+	// --------------------------------------------------
+	struct Node
+	{
+		Vector3 min;
+		int		first = 0;
+		Vector3 max;
+		int		count = 0;
+
+		bool IsLeaf() const { return count > 0; }
+	};
+
+private:
+	std::vector<Vector3>  m_Vertices;
+	std::vector<uint32_t> m_Indices; // ３つで三角形１枚（BVH の葉の順に並べ替え済み）
+	std::vector<Node>	  m_Nodes;	 // [0] が根
+
+public:
+	// ==================================================
+	// ----- コンストラクタ -----
+	// ==================================================
+	TriangleMeshBVH(std::vector<Vector3> vertices, std::vector<uint32_t> indices);
+
+	// ==================================================
+	// ----- ゲッター -----
+	// ==================================================
+	int TriangleCount() const { return (int)m_Indices.size() / 3; }
+	int NodeCount() const { return (int)m_Nodes.size(); }
+	AABB Bounds() const { return m_Nodes.empty() ? AABB{} : AABB{ m_Nodes[0].min, m_Nodes[0].max }; }
+	const std::vector<Vector3>& Vertices() const { return m_Vertices; }
+	void GetTriangle(int tri, Vector3& a, Vector3& b, Vector3& c) const
+	{
+		assert(0 <= tri && tri < TriangleCount());
+		a = m_Vertices[m_Indices[tri * 3 + 0]];
+		b = m_Vertices[m_Indices[tri * 3 + 1]];
+		c = m_Vertices[m_Indices[tri * 3 + 2]];
+	}
+
+	// ==================================================
+	// ----- 探索 -----
+	// ==================================================
+	// --------------------------------------------------
+	// box（ローカル）と重なる葉の三角形ごとに f(triIndex) を呼ぶ
+	// --------------------------------------------------
+	template<class F>
+	void Query(const AABB& box, F&& f) const
+	{
+		if (m_Nodes.empty()) return;
+
+		int stack[MaxStack];
+		int top = 0;
+		stack[top++] = 0;
+		while (top > 0)
+		{
+			const Node& node = m_Nodes[stack[--top]];
+			if (node.max.x < box.min.x || node.min.x > box.max.x
+			 || node.max.y < box.min.y || node.min.y > box.max.y
+			 || node.max.z < box.min.z || node.min.z > box.max.z) continue;
+
+			if (node.IsLeaf())
+			{
+				for (int i = 0; i < node.count; i++) f(node.first + i);
+			}
+			else
+			{
+				assert(top + 2 <= MaxStack && "TriangleMeshBVH stack overflow");
+				stack[top++] = node.first;
+				stack[top++] = node.first + 1;
+			}
+		}
+	}
+	// --------------------------------------------------
+	// レイ（ローカル）と一番手前の三角形（両面）
+	// 近い方の子から辿り、当たったら maxDist を縮めて奥を刈る
+	// --------------------------------------------------
+	bool Raycast(const Vector3& origin, const Vector3& dir, float maxDist, float& outT, int& outTri) const;
+
+private:
+	void Build();
+};
+
+// ==================================================
+// ----- TriangleMeshCollision の探索 -----
+// ワールド AABB をメッシュのローカルに移して BVH を引き、候補だけワールドに戻す
+// ==================================================
+template<class F>
+void TriangleMeshCollision::ForEachTriangleInAABB(const ColliderPose& myTrans, const AABB& worldBox, F&& f) const
+{
+	const Vector3 axis[3] = { myTrans.WorldRight(), myTrans.WorldUp(), myTrans.WorldForward() };
+	const float	  scale[3] = { myTrans.scale.x, myTrans.scale.y, myTrans.scale.z };
+
+	// ----- ワールド AABB → ローカル AABB（回転したぶん広がる） -----
+	const Vector3 center = (worldBox.min + worldBox.max) * 0.5f - myTrans.position;
+	const Vector3 half	 = (worldBox.max - worldBox.min) * 0.5f;
+	float c[3], e[3];
+	for (int k = 0; k < 3; k++)
+	{
+		c[k] = Vector3::Dot(axis[k], center) / scale[k];
+		e[k] = (fabsf(axis[k].x) * half.x + fabsf(axis[k].y) * half.y + fabsf(axis[k].z) * half.z) / fabsf(scale[k]);
+	}
+	const AABB local{ { c[0] - e[0], c[1] - e[1], c[2] - e[2] }, { c[0] + e[0], c[1] + e[1], c[2] + e[2] } };
+
+	// ----- 候補の三角形をワールドに戻して渡す -----
+	auto toWorld = [&](const Vector3& v)
+		{
+			return myTrans.position + axis[0] * (v.x * scale[0]) + axis[1] * (v.y * scale[1]) + axis[2] * (v.z * scale[2]);
+		};
+	m_pMesh->Query(local, [&](int tri)
+		{
+			Vector3 a, b, c;
+			m_pMesh->GetTriangle(tri, a, b, c);
+			const Triangle world{ toWorld(a), toWorld(b), toWorld(c) };
+			f(world);
+		});
+}
+
+#endif
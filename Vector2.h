@@ -1,5 +1,5 @@
 /*
-	Vector2 ̃NX
+	Vector2 のクラス
 	20251006  hanaue sho
 */
 #ifndef VECTOR2_H_
@@ -13,31 +13,31 @@ class Vector2
 {
 public:
 	// ==================================================
-	// ----- vf{ -----
+	// ----- 要素本体 -----
 	// v = {x, y}
 	// ==================================================
 	float x = 0, y = 0;
 
 	// ==================================================
-	// ----- RXgN^ -----
+	// ----- コンストラクタ -----
 	// ==================================================
 	Vector2() {}
 	Vector2(const Vector2& a) : x(a.x), y(a.y) {}
 	Vector2(float nx, float ny) : x(nx), y(ny) {}
 
 	// ==================================================
-	// ----- Iy[^ -----
+	// ----- オペレータ -----
 	// ==================================================
 	// --------------------------------------------------
-	// WIȃIuWFNg̕ێ
+	// 標準的なオブジェクトの保守
     // --------------------------------------------------
     // --------------------------------------------------
-	// iC̊Kɏ]lւ̎QƂԂj
+	// 代入（C言語の慣習に従い値への参照を返す）
     // --------------------------------------------------
 	Vector2& operator = (const Vector2& a)
 	{ x = a.x; y = a.y; return *this; }
 	// --------------------------------------------------
-	// `FbN
+	// 等しさチェック
     // --------------------------------------------------
 	bool operator == (const Vector2& a) const
 	{ return x == a.x && y == a.y ;}
@@ -45,30 +45,30 @@ public:
 	{ return x != a.x || y != a.y ;}
 
 	// --------------------------------------------------
-	// xNg
+	// ベクトル操作
 	// --------------------------------------------------
 	// --------------------------------------------------
-	// Z
+	// 加算
     // --------------------------------------------------
 	Vector2 operator +() const { return *this; }
 	// --------------------------------------------------
-	// P̃}CiX́A]xNgԂ
+	// 単項式のマイナスは、反転したベクトルを返す
     // --------------------------------------------------
 	Vector2 operator -() const { return Vector2(-x, -y); }
 	// --------------------------------------------------
-	// 񍀎́{Ɓ|̓xNgZAZ
+	// 二項式の＋と－はベクトルを加算し、減算する
     // --------------------------------------------------
 	Vector2 operator +(const Vector2& a) const 
 	{ return Vector2(x + a.x, y + a.y); }
 	Vector2 operator -(const Vector2& a) const
 	{ return Vector2(x - a.x, y - a.y); }
 	// --------------------------------------------------
-	// XJ[ɂZƏZ
+	// スカラーによる乗算と除算
     // --------------------------------------------------
 	Vector2 operator *(float a) const
 	{ return Vector2(x * a, y * a); }
 	// --------------------------------------------------
-	// xNg̊evf̏Z
+	// ベクトルの各要素の乗算
     // --------------------------------------------------
 	Vector2 operator *(const Vector2& a) const
 	{
@@ -76,12 +76,12 @@ public:
 	}
 	Vector2 operator /(float a) const
 	{
-		if (a == 0.0f) return Vector2(0, 0);// [Z`FbN
+		if (a == 0.0f) return Vector2(0, 0);// ※ゼロ除算チェック
 		float oneOverA = 1.0f / a; 
 		return Vector2(x * oneOverA, y * oneOverA); 
 	}
 	// --------------------------------------------------
-	// vf̎o
+	// 要素の取り出し
     // --------------------------------------------------
 	float& operator [](int i) 
 	{
@@ -102,13 +102,13 @@ public:
 		}
 	}
 	// --------------------------------------------------
-	// gݍ킹Zq
+	// 組み合わせ代入演算子
     // --------------------------------------------------
 	Vector2& operator +=(const Vector2& a)
 	{ x += a.x; y += a.y; return *this; }
 	Vector2& operator -=(const Vector2& a)
 	{ x -= a.x; y -= a.y; return *this; }
-	Vector2& operator *=(const Vector2& a) // vfƂ̏ZiA_}[ρj
+	Vector2& operator *=(const Vector2& a) // 要素ごとの乗算（アダマール積）
 	{ x *= a.x; y *= a.y; return *this; }
 	Vector2& operator /=(const Vector2& a)
 	{
@@ -121,10 +121,10 @@ public:
 	{ x /= s; y /= s; return *this;}
 	
 	// ==================================================
-	// ----- [eBeB -----
+	// ----- ユーティリティ -----
 	// ==================================================
     // --------------------------------------------------
-	// xNg𐳋K
+	// ベクトルを正規化する
     // --------------------------------------------------
 	void normalize()
 	{
@@ -137,7 +137,7 @@ public:
 		}
 	}
 	// --------------------------------------------------
-	// xNg̐K̃Rs[Ԃ
+	// ベクトルの正規化のコピーを返す
     // --------------------------------------------------
 	Vector2 normalized() const
 	{
@@ -150,43 +150,43 @@ public:
 		return Vector2(0, 0);
 	}
 	// --------------------------------------------------
-	// xNg̒Ԃ
+	// ベクトルの長さを返す
 	// --------------------------------------------------
 	float length() const
 	{
 		return sqrtf(x * x + y * y);
 	}
 	// --------------------------------------------------
-	// xNg̒̓Ԃ
+	// ベクトルの長さの二乗を返す
 	// --------------------------------------------------
 	float lengthSq() const
 	{
 		return x * x + y * y;
 	}
 	// --------------------------------------------------
-	// xNgOɂ
+	// ベクトルを０にする
 	// --------------------------------------------------
 	void zero() { x = y = 0.0f; }
 
 	// ==================================================
-	// ----- ρEO -----
+	// ----- 内積・外積 -----
 	// ==================================================
 	// --------------------------------------------------
-	// xNg̊OρiEnj
+	// ベクトルの外積（右手系）
 	// --------------------------------------------------
 	static float Cross(const Vector2& a, const Vector2& b)
 	{
 		return a.x * b.y - a.y * b.x;
 	}
 	// --------------------------------------------------
-	// xNg̊OρiWnj
+	// ベクトルの外積（左手座標系）
 	// --------------------------------------------------
 	static float CrossLH(const Vector2& a, const Vector2& b) 
 	{ 
 		return -Cross(a, b); 
 	}
 	// --------------------------------------------------
-	// xNg̓
+	// ベクトルの内積
 	// --------------------------------------------------
 	static float Dot(const Vector2& a, const Vector2& b)
 	{
@@ -194,10 +194,10 @@ public:
 	}
 
 	// ==================================================
-	// ----- Swp -----
+	// ----- ゴリラヘルパ -----
 	// ==================================================
 	// --------------------------------------------------
-	// vf printf ŏóiӊOƕ֗j
+	// 要素を printf で出力（意外と便利）
 	// --------------------------------------------------
 	static void Printf(const Vector2& v, std::string s = "noname")
 	{
@@ -206,16 +206,16 @@ public:
 };
 
 // ==================================================
-// ----- Iy[^itŁj -----
+// ----- オペレータ（逆版） -----
 // ==================================================
 inline Vector2 operator *(float s, const Vector2& v)
 {
 	return Vector2(v.x * s, v.y * s);
 }
-// CӁFXJ[eŊpriႦ reciprocal ̂悤Ȏgj
+// 任意：スカラーを各成分で割った特殊用途（例えば reciprocal のような使い方）
 inline Vector2 operator /(float s, const Vector2& v)
 {
-	return Vector2(s / v.x, s / v.y); // CӁiȗprj
+	return Vector2(s / v.x, s / v.y); // 任意（特殊な用途向け）
 }
 
 
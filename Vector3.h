@@ -1,5 +1,5 @@
 /*
-	Vector3 ̃NX
+	Vector3 のクラス
 	20250513 hanaue sho
 */
 #ifndef VECTOR3_H_
@@ -13,31 +13,31 @@ class Vector3
 {
 public:
 	// ==================================================
-	// ----- vf{ -----
+	// ----- 要素本体 -----
 	// v = {x, y, z}
 	// ==================================================
 	float x = 0, y = 0, z = 0;
 
 	// ==================================================
-	// ----- RXgN^ -----
+	// ----- コンストラクタ -----
 	// ==================================================
 	Vector3() {}
 	Vector3(const Vector3& a) : x(a.x), y(a.y), z(a.z) {}
 	Vector3(float nx, float ny, float nz) : x(nx), y(ny), z(nz) {}
 
 	// ==================================================
-	// ----- Iy[^ -----
+	// ----- オペレータ -----
 	// ==================================================
 	// --------------------------------------------------
-	// WIȃIuWFNg̕ێ
+	// 標準的なオブジェクトの保守
     // --------------------------------------------------
     // --------------------------------------------------
-	// iC̊Kɏ]lւ̎QƂԂj
+	// 代入（C言語の慣習に従い値への参照を返す）
     // --------------------------------------------------
 	Vector3& operator = (const Vector3& a)
 	{ x = a.x; y = a.y; z = a.z; return *this; }
 	// --------------------------------------------------
-	// `FbN
+	// 等しさチェック
     // --------------------------------------------------
 	bool operator == (const Vector3& a) const
 	{ return x == a.x && y == a.y && z == a.z; }
@@ -45,30 +45,30 @@ public:
 	{ return x != a.x || y != a.y || z != a.z; }
 
 	// --------------------------------------------------
-	// xNg
+	// ベクトル操作
 	// --------------------------------------------------
 	// --------------------------------------------------
-	// Z
+	// 加算
     // --------------------------------------------------
 	Vector3 operator +() const { return *this; }
 	// --------------------------------------------------
-	// P̃}CiX́A]xNgԂ
+	// 単項式のマイナスは、反転したベクトルを返す
     // --------------------------------------------------
 	Vector3 operator -() const { return Vector3(-x, -y, -z); }
 	// --------------------------------------------------
-	// 񍀎́{Ɓ|̓xNgZAZ
+	// 二項式の＋と－はベクトルを加算し、減算する
     // --------------------------------------------------
 	Vector3 operator +(const Vector3& a) const 
 	{ return Vector3(x + a.x, y + a.y, z + a.z); }
 	Vector3 operator -(const Vector3& a) const
 	{ return Vector3(x - a.x, y - a.y, z - a.z); }
 	// --------------------------------------------------
-	// XJ[ɂZƏZ
+	// スカラーによる乗算と除算
     // --------------------------------------------------
 	Vector3 operator *(float a) const
 	{ return Vector3(x * a, y * a, z * a); }
 	// --------------------------------------------------
-	// xNg̊evf̏Z
+	// ベクトルの各要素の乗算
     // --------------------------------------------------
 	Vector3 operator *(const Vector3& a) const
 	{
@@ -76,12 +76,12 @@ public:
 	}
 	Vector3 operator /(float a) const
 	{
-		if (a == 0.0f) return Vector3(0, 0, 0);// [Z`FbN
+		if (a == 0.0f) return Vector3(0, 0, 0);// ※ゼロ除算チェック
 		float oneOverA = 1.0f / a; 
 		return Vector3(x * oneOverA, y * oneOverA, z * oneOverA); 
 	}
 	// --------------------------------------------------
-	// vf̎o
+	// 要素の取り出し
     // --------------------------------------------------
 	float& operator [](int i) 
 	{
@@ -90,7 +90,7 @@ public:
 		{
 		case 0: return x;
 		case 1: return y;
-		case 2: return z;
+		default: return z;
 		}
 	}
 	const float& operator [](int i) const
@@ -100,17 +100,17 @@ public:
 		{
 		case 0: return x;
 		case 1: return y;
-		case 2: return z;
+		default: return z;
 		}
 	}
 	// --------------------------------------------------
-	// gݍ킹Zq
+	// 組み合わせ代入演算子
     // --------------------------------------------------
 	Vector3& operator +=(const Vector3& a)
 	{ x += a.x; y += a.y; z += a.z; return *this; }
 	Vector3& operator -=(const Vector3& a)
 	{ x -= a.x; y -= a.y; z -= a.z; return *this; }
-	Vector3& operator *=(const Vector3& a) // vfƂ̏ZiA_}[ρj
+	Vector3& operator *=(const Vector3& a) // 要素ごとの乗算（アダマール積）
 	{ x *= a.x; y *= a.y; z *= a.z; return *this; }
 	Vector3& operator /=(const Vector3& a)
 	{
@@ -123,10 +123,10 @@ public:
 	{ x /= s; y /= s; z /= s; return *this;}
 	
 	// ==================================================
-	// ----- [eBeB -----
+	// ----- ユーティリティ -----
 	// ==================================================
     // --------------------------------------------------
-	// xNg𐳋K
+	// ベクトルを正規化する
     // --------------------------------------------------
 	void normalize()
 	{
@@ -140,7 +140,7 @@ public:
 		}
 	}
 	// --------------------------------------------------
-	// xNg̐K̃Rs[Ԃ
+	// ベクトルの正規化のコピーを返す
     // --------------------------------------------------
 	Vector3 normalized() const
 	{
@@ -153,29 +153,29 @@ public:
 		return Vector3(0, 0, 0);
 	}
 	// --------------------------------------------------
-	// xNg̒Ԃ
+	// ベクトルの長さを返す
 	// --------------------------------------------------
 	float length() const
 	{
 		return sqrtf(x * x + y * y + z * z);
 	}
 	// --------------------------------------------------
-	// xNg̒̓Ԃ
+	// ベクトルの長さの二乗を返す
 	// --------------------------------------------------
 	float lengthSq() const
 	{
 		return x * x + y * y + z * z;
 	}
 	// --------------------------------------------------
-	// xNgOɂ
+	// ベクトルを０にする
 	// --------------------------------------------------
 	void zero() { x = y = z = 0.0f; }
 
 	// ==================================================
-	// ----- ρEO -----
+	// ----- 内積・外積 -----
 	// ==================================================
 	// --------------------------------------------------
-	// xNg̊OρiEnj
+	// ベクトルの外積（右手系）
 	// --------------------------------------------------
 	static Vector3 Cross(const Vector3& a, const Vector3& b)
 	{
@@ -186,14 +186,14 @@ public:
 		);
 	}
 	// --------------------------------------------------
-	// xNg̊OρiWnj
+	// ベクトルの外積（左手座標系）
 	// --------------------------------------------------
 	static Vector3 CrossLH(const Vector3& a, const Vector3& b) 
 	{ 
 		return -Cross(a, b); 
 	}
 	// --------------------------------------------------
-	// xNg̓
+	// ベクトルの内積
 	// --------------------------------------------------
 	static float Dot(const Vector3& a, const Vector3& b)
 	{
@@ -201,10 +201,10 @@ public:
 	}
 
 	// ==================================================
-	// ----- Swp -----
+	// ----- ゴリラヘルパ -----
 	// ==================================================
 	// --------------------------------------------------
-	// vf printf ŏóiӊOƕ֗j
+	// 要素を printf で出力（意外と便利）
 	// --------------------------------------------------
 	static void Printf(const Vector3& v, std::string s = "noname")
 	{
@@ -212,12 +212,12 @@ public:
 	}
 
 	// --------------------------------------------------
-	// Nv
-	// ^ꂽlŏlƍől̒Ɏ߂
-	// P@F@l
-	// Q@F@ŏl
-	// R@F@ől
-	// Ԃl@@F@Nvl
+	// クランプ
+	// 与えられた値を最小値と最大値の中に収める
+	// 第１引数　：　値
+	// 第２引数　：　最小値
+	// 第３引数　：　最大値
+	// 返り値　　：　クランプした値
 	// --------------------------------------------------
 	static float Clamp(const float& value, const float& min, const float& max)
 	{
@@ -240,16 +240,16 @@ public:
 
 
 // ==================================================
-// ----- Iy[^itŁj -----
+// ----- オペレータ（逆版） -----
 // ==================================================
 inline Vector3 operator *(float s, const Vector3& v)
 {
 	return Vector3(v.x * s, v.y * s, v.z * s);
 }
-// CӁFXJ[eŊpriႦ reciprocal ̂悤Ȏgj
+// 任意：スカラーを各成分で割った特殊用途（例えば reciprocal のような使い方）
 inline Vector3 operator /(float s, const Vector3& v)
 {
-	return Vector3(s / v.x, s / v.y, s / v.z); // CӁiȗprj
+	return Vector3(s / v.x, s / v.y, s / v.z); // 任意（特殊な用途向け）
 }
 
 
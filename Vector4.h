@@ -1,5 +1,5 @@
 /*
-	Vector4 ̃NX
+	Vector4 のクラス
 	20251006 hanaue sho
 */
 #ifndef Vector4_H_
@@ -13,31 +13,31 @@ class Vector4
 {
 public:
 	// ==================================================
-	// ----- vf{ -----
+	// ----- 要素本体 -----
 	// v = {x, y, z, w}
 	// ==================================================
 	float x = 0, y = 0, z = 0, w = 0;
 
 	// ==================================================
-	// ----- RXgN^ -----
+	// ----- コンストラクタ -----
 	// ==================================================
 	Vector4() {}
 	Vector4(const Vector4& a) : x(a.x), y(a.y), z(a.z), w(a.w) {}
 	Vector4(float nx, float ny, float nz, float nw) : x(nx), y(ny), z(nz), w(nw) {}
 
 	// ==================================================
-	// ----- Iy[^ -----
+	// ----- オペレータ -----
 	// ==================================================
 	// --------------------------------------------------
-	// WIȃIuWFNg̕ێ
+	// 標準的なオブジェクトの保守
     // --------------------------------------------------
     // --------------------------------------------------
-	// iC̊Kɏ]lւ̎QƂԂj
+	// 代入（C言語の慣習に従い値への参照を返す）
     // --------------------------------------------------
 	Vector4& operator = (const Vector4& a)
 	{ x = a.x; y = a.y; z = a.z; w = a.w; return *this; }
 	// --------------------------------------------------
-	// `FbN
+	// 等しさチェック
     // --------------------------------------------------
 	bool operator == (const Vector4& a) const
 	{ return x == a.x && y == a.y && z == a.z && w == a.w; }
@@ -45,30 +45,30 @@ public:
 	{ return x != a.x || y != a.y || z != a.z || w != a.w; }
 
 	// --------------------------------------------------
-	// xNg
+	// ベクトル操作
 	// --------------------------------------------------
 	// --------------------------------------------------
-	// Z
+	// 加算
     // --------------------------------------------------
 	Vector4 operator +() const { return *this; }
 	// --------------------------------------------------
-	// P̃}CiX́A]xNgԂ
+	// 単項式のマイナスは、反転したベクトルを返す
     // --------------------------------------------------
 	Vector4 operator -() const { return Vector4(-x, -y, -z, -w); }
 	// --------------------------------------------------
-	// 񍀎́{Ɓ|̓xNgZAZ
+	// 二項式の＋と－はベクトルを加算し、減算する
     // --------------------------------------------------
 	Vector4 operator +(const Vector4& a) const 
 	{ return Vector4(x + a.x, y + a.y, z + a.z, w + a.w); }
 	Vector4 operator -(const Vector4& a) const
 	{ return Vector4(x - a.x, y - a.y, z - a.z, w - a.w); }
 	// --------------------------------------------------
-	// XJ[ɂZƏZ
+	// スカラーによる乗算と除算
     // --------------------------------------------------
 	Vector4 operator *(float a) const
 	{ return Vector4(x * a, y * a, z * a, w * a); }
 	// --------------------------------------------------
-	// xNg̊evf̏Z
+	// ベクトルの各要素の乗算
     // --------------------------------------------------
 	Vector4 operator *(const Vector4& a) const
 	{
@@ -76,12 +76,12 @@ public:
 	}
 	Vector4 operator /(float a) const
 	{
-		if (a == 0.0f) return Vector4(0, 0, 0, 0);// [Z`FbN
+		if (a == 0.0f) return Vector4(0, 0, 0, 0);// ※ゼロ除算チェック
 		float oneOverA = 1.0f / a; 
 		return Vector4(x * oneOverA, y * oneOverA, z * oneOverA, w * oneOverA); 
 	}
 	// --------------------------------------------------
-	// vf̎o
+	// 要素の取り出し
     // --------------------------------------------------
 	float& operator [](int i) 
 	{
@@ -106,13 +106,13 @@ public:
 		}
 	}
 	// --------------------------------------------------
-	// gݍ킹Zq
+	// 組み合わせ代入演算子
     // --------------------------------------------------
 	Vector4& operator +=(const Vector4& a)
 	{ x += a.x; y += a.y; z += a.z; w += a.w; return *this; }
 	Vector4& operator -=(const Vector4& a)
 	{ x -= a.x; y -= a.y; z -= a.z; w -= a.w; return *this; }
-	Vector4& operator *=(const Vector4& a) // vfƂ̏ZiA_}[ρj
+	Vector4& operator *=(const Vector4& a) // 要素ごとの乗算（アダマール積）
 	{ x *= a.x; y *= a.y; z *= a.z; w *= a.w; return *this; }
 	Vector4& operator /=(const Vector4& a)
 	{
@@ -125,10 +125,10 @@ public:
 	{ x /= s; y /= s; z /= s; w /= s; return *this;}
 	
 	// ==================================================
-	// ----- [eBeB -----
+	// ----- ユーティリティ -----
 	// ==================================================
     // --------------------------------------------------
-	// xNg𐳋K
+	// ベクトルを正規化する
     // --------------------------------------------------
 	void normalize()
 	{
@@ -143,7 +143,7 @@ public:
 		}
 	}
 	// --------------------------------------------------
-	// xNg̐K̃Rs[Ԃ
+	// ベクトルの正規化のコピーを返す
     // --------------------------------------------------
 	Vector4 normalized() const
 	{
@@ -156,29 +156,29 @@ public:
 		return Vector4(0, 0, 0, 0);
 	}
 	// --------------------------------------------------
-	// xNg̒Ԃ
+	// ベクトルの長さを返す
 	// --------------------------------------------------
 	float length() const
 	{
 		return sqrtf(x * x + y * y + z * z + w * w);
 	}
 	// --------------------------------------------------
-	// xNg̒̓Ԃ
+	// ベクトルの長さの二乗を返す
 	// --------------------------------------------------
 	float lengthSq() const
 	{
 		return x * x + y * y + z * z + w * w;
 	}
 	// --------------------------------------------------
-	// xNgOɂ
+	// ベクトルを０にする
 	// --------------------------------------------------
 	void zero() { x = y = z = w = 0.0f; }
 
 	// ==================================================
-	// ----- -----
+	// ----- 内積-----
 	// ==================================================
 	// --------------------------------------------------
-	// xNg̓
+	// ベクトルの内積
 	// --------------------------------------------------
 	static float Dot(const Vector4& a, const Vector4& b)
 	{
@@ -186,10 +186,10 @@ public:
 	}
 
 	// ==================================================
-	// ----- Swp -----
+	// ----- ゴリラヘルパ -----
 	// ==================================================
 	// --------------------------------------------------
-	// vf printf ŏóiӊOƕ֗j
+	// 要素を printf で出力（意外と便利）
 	// --------------------------------------------------
 	static void Printf(const Vector4& v, std::string s = "noname")
 	{
@@ -198,16 +198,16 @@ public:
 };
 
 // ==================================================
-// ----- Iy[^itŁj -----
+// ----- オペレータ（逆版） -----
 // ==================================================
 inline Vector4 operator *(float s, const Vector4& v)
 {
 	return Vector4(v.x * s, v.y * s, v.z * s, v.w * s);
 }
-// CӁFXJ[eŊpriႦ reciprocal ̂悤Ȏgj
+// 任意：スカラーを各成分で割った特殊用途（例えば reciprocal のような使い方）
 inline Vector4 operator /(float s, const Vector4& v)
 {
-	return Vector4(s / v.x, s / v.y, s / v.z, s / v.w); // CӁiȗprj
+	return Vector4(s / v.x, s / v.y, s / v.z, s / v.w); // 任意（特殊な用途向け）
 }
 
 #endif
\ No newline at end of file
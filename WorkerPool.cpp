@@ -0,0 +1,111 @@
+/*
+	WorkerPool.cpp
+	20261017  hanaue sho
+	物理演算用のワーカースレッド
+*/
+#include <assert.h>
+#include <algorithm>
+#include "WorkerPool.h"
+
+// ==================================================
+// ----- 起動、停止 -----
+// ==================================================
+void WorkerPool::Start(int threadCount)
+{
+	Stop();
+
+	m_ThreadCount = std::max(1, threadCount);
+	m_Stop = false;
+	m_BarrierCount = 0;
+	for (int i = 1; i < m_ThreadCount; i++)
+		m_Workers.emplace_back(&WorkerPool::WorkerMain, this, i, m_JobGeneration); // 起動前のジョブは見ない
+}
+void WorkerPool::Stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_Stop = true;
+	}
+	m_WakeUp.notify_all();
+	for (auto& t : m_Workers) t.join();
+	m_Workers.clear();
+	m_ThreadCount = 1;
+}
+
+// ==================================================
+// ----- 実行 -----
+// ==================================================
+void WorkerPool::Run(const std::function<void(int)>& job)
+{
+	if (m_ThreadCount <= 1) { job(0); return; }
+
+	// ----- ワーカーを起こす -----
+	m_Pending = m_ThreadCount - 1;
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_pJob = &job;
+		m_JobGeneration++;
+	}
+	m_WakeUp.notify_all();
+
+	// ----- 自分も０番として参加 -----
+	job(0);
+
+	// ----- 全員終わるまで待つ -----
+	while (m_Pending.load(std::memory_order_acquire) > 0)
+		std::this_thread::yield();
+	m_pJob = nullptr;
+}
+void WorkerPool::ParallelFor(int count, const std::function<void(int, int)>& job)
+{
+	if (count <= 0) return;
+	const int threads = std::min(m_ThreadCount, count);
+	if (threads <= 1) { job(0, count); return; }
+
+	Run([&](int t)
+		{
+			if (t >= threads) return;
+			const int begin = (int)((int64_t)count * t / threads);
+			const int end	= (int)((int64_t)count * (t + 1) / threads);
+			job(begin, end);
+		});
+}
+// --------------------------------------------------
+// 待ち合わせ
+// 最後に来たスレッドが世代を進めて全員を解放する
+// --------------------------------------------------
+void WorkerPool::Barrier()
+{
+	if (m_ThreadCount <= 1) return;
+
+	const uint32_t generation = m_BarrierGeneration.load(std::memory_order_acquire);
+	if (m_BarrierCount.fetch_add(1, std::memory_order_acq_rel) + 1 == m_ThreadCount)
+	{
+		m_BarrierCount.store(0, std::memory_order_relaxed);
+		m_BarrierGeneration.fetch_add(1, std::memory_order_release);
+		return;
+	}
+	while (m_BarrierGeneration.load(std::memory_order_acquire) == generation)
+		std::this_thread::yield();
+}
+
+// ==================================================
+// ----- ワーカー -----
+// ==================================================
+void WorkerPool::WorkerMain(int threadIndex, uint64_t seen)
+{
+	for (;;)
+	{
+		const std::function<void(int)>* job = nullptr;
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_WakeUp.wait(lock, [&] { return m_Stop || m_JobGeneration != seen; });
+			if (m_Stop) return;
+			seen = m_JobGeneration;
+			job = m_pJob;
+		}
+		assert(job);
+		(*job)(threadIndex);
+		m_Pending.fetch_sub(1, std::memory_order_acq_rel);
+	}
+}
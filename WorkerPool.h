@@ -0,0 +1,86 @@
+/*
+	WorkerPool.h
+	20261017  hanaue sho
+	物理演算用のワーカースレッド
+	Run に渡した関数を全スレッドで同時に実行する（呼び出しスレッドも０番として参加）
+	Run の中では Barrier で全スレッドの足並みを揃えられる
+*/
+#ifndef WORKERPOOL_H_
+#define WORKERPOOL_H_
+#include <cstdint>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+// ==================================================
+// ----- クラス本体 -----
+// ==================================================
+class WorkerPool
+{
+private:
+	// ==================================================
+	// ----- 要素 -----
+	// ==================================================
+	// --------------------------------------------------
+	// スレッド
+	// m_ThreadCount は呼び出しスレッド込みの数
+	// --------------------------------------------------
+	std::vector<std::thread> m_Workers;
+	int m_ThreadCount = 1;
+	// --------------------------------------------------
+	// ジョブ
+	// 世代番号が変わったらワーカーは m_pJob を実行する
+	// --------------------------------------------------
+	std::mutex m_Mutex;
+	std::condition_variable m_WakeUp;
+	const std::function<void(int)>* m_pJob = nullptr;
+	uint64_t m_JobGeneration = 0;
+	bool m_Stop = false;
+	std::atomic<int> m_Pending{ 0 }; // 実行中のワーカー数
+	// --------------------------------------------------
+	// 待ち合わせ
+	// --------------------------------------------------
+	std::atomic<int>	  m_BarrierCount{ 0 };
+	std::atomic<uint32_t> m_BarrierGeneration{ 0 };
+
+public:
+	// ==================================================
+	// ----- コンストラクタ -----
+	// ==================================================
+	WorkerPool() = default;
+	~WorkerPool() { Stop(); }
+	WorkerPool(const WorkerPool&) = delete;
+	WorkerPool& operator=(const WorkerPool&) = delete;
+
+	// ==================================================
+	// ----- 起動、停止 -----
+	// ==================================================
+	void Start(int threadCount);
+	void Stop();
+	int  ThreadCount() const { return m_ThreadCount; }
+
+	// ==================================================
+	// ----- 実行 -----
+	// ==================================================
+	// --------------------------------------------------
+	// 全スレッドで job(threadIndex) を実行して、全員終わるまで待つ
+	// --------------------------------------------------
+	void Run(const std::function<void(int)>& job);
+	// --------------------------------------------------
+	// [0, count) をスレッド数で等分して job(begin, end) を実行
+	// 分け方はスレッド数だけで決まる
+	// --------------------------------------------------
+	void ParallelFor(int count, const std::function<void(int, int)>& job);
+	// --------------------------------------------------
+	// Run の中で全スレッドが来るまで待つ
+	// --------------------------------------------------
+	void Barrier();
+
+private:
+	void WorkerMain(int threadIndex, uint64_t seen);
+};
+
+#endif
@@ -5,11 +5,11 @@
 #include "Camera.h"
 #include "CameraMove.h"
 #include "Mouse.h"
-#include "Main.h" // SCREEN_SIZEp
+#include "Main.h" // SCREEN_SIZE用
 #include "Keyboard.h"
 
 // --------------------------------------------------
-// JiNXj
+// カメラ（基底クラス）
 // --------------------------------------------------
 void Camera::Init()
 {
@@ -17,12 +17,12 @@ void Camera::Init()
 	auto* camera = AddComponent<CameraComponent>();
 	auto* cameraMove = AddComponent<CameraMove>();
 
-	// 2Dݒ
+	// 2D設定
 	camera->SetMode(CameraComponent::Mode::Ortho2D);
 	camera->SetOrthoOffCenter(0.0f, (float)SCREEN_WIDTH, (float)SCREEN_HEIGHT, 0.0f, 0.0f, 0.1f);
-	camera->UseTransformIn2D(false); // Œ 2D J
+	camera->UseTransformIn2D(false); // 固定 2D カメラ
 
-	// 3Dݒ
+	// 3D設定
 	// cam->SetMode(CameraComponent::Mode::Perspective);
 	// cam->SetPerspective(DirectX::XMConvertToRadians(60.0f),
 	//                     (float)SCREEN_WIDTH / SCREEN_HEIGHT,
@@ -35,38 +35,38 @@ void Camera::Update(float dt)
 {
 	GameObject::Update(dt);
 
-	// ----- J -----
-	//if (Keyboard_IsKeyDownTrigger(KK_D7)) // ʒu
+	// ----- カメラ制御 -----
+	//if (Keyboard_IsKeyDownTrigger(KK_D7)) // 初期位置
 	//{
 	//	Transform()->SetPosition({ 0, 10, -15 });
 	//	Transform()->SetEulerAngles({ 0.5, 0, 0 });
 	//}
-	//if (Keyboard_IsKeyDownTrigger(KK_D1)) // bVtB[h
+	//if (Keyboard_IsKeyDownTrigger(KK_D1)) // メッシュフィールド
 	//{
 	//	Transform()->SetPosition({ 3, 5, -10 });
 	//	Transform()->SetEulerAngles({ 0.8, -0.5, 0 });
 	//}
-	//if (Keyboard_IsKeyDownTrigger(KK_D2)) // ]
+	//if (Keyboard_IsKeyDownTrigger(KK_D2)) // 回転床
 	//{
 	//	Transform()->SetPosition({ 0, 10, 15 });
 	//	Transform()->SetEulerAngles({ 0.5, -0.2, 0 });
 	//}
-	//if (Keyboard_IsKeyDownTrigger(KK_D3)) // ⓹
+	//if (Keyboard_IsKeyDownTrigger(KK_D3)) // 坂道
 	//{
 	//	Transform()->SetPosition({ 30, 30, 10 });
 	//	Transform()->SetEulerAngles({ 0.5, -0.2, 0 });
 	//}
-	//if (Keyboard_IsKeyDownTrigger(KK_D4)) // L
+	//if (Keyboard_IsKeyDownTrigger(KK_D4)) // キャラ
 	//{
 	//	Transform()->SetPosition({ 50, 15, -15 });
 	//	Transform()->SetEulerAngles({ 0.5, 0, 0 });
 	//}
-	//if (Keyboard_IsKeyDownTrigger(KK_D5)) // Ɗy
+	//if (Keyboard_IsKeyDownTrigger(KK_D5)) // 独楽
 	//{
 	//	Transform()->SetPosition({ 20, 10, -55 });
 	//	Transform()->SetEulerAngles({ 0.5, 0, 0 });
 	//}
-	//if (Keyboard_IsKeyDownTrigger(KK_D6)) // oEh
+	//if (Keyboard_IsKeyDownTrigger(KK_D6)) // バウンド
 	//{
 	//	Transform()->SetPosition({ -45, 20, -30 });
 	//	Transform()->SetEulerAngles({ 0.5, 0, 0 });
@@ -76,28 +76,28 @@ void Camera::Update(float dt)
 
 /*
 // --------------------------------------------------
-// XN[̍WԂ
-// F[hW
+// スクリーン上の座標を返す
+// 引数：ワールド座標
 // --------------------------------------------------
 XMFLOAT2 Camera::GetPositionOnScreen(const XMFLOAT3& position)
 {
-	XMMATRIX worldMatrix = XMMatrixTranslation(position.x, position.y, position.z); // fW烏[hWւ̕ϊ
-	XMMATRIX viewMatrix = m_mtxView; // [hWr[Wւ̕ϊ
-	XMMATRIX projectionMatrix = m_mtxPerspective; // r[WvWFNVWւ̕ϊ
+	XMMATRIX worldMatrix = XMMatrixTranslation(position.x, position.y, position.z); // モデル座標からワールド座標への変換
+	XMMATRIX viewMatrix = m_mtxView; // ワールド座標からビュー座標への変換
+	XMMATRIX projectionMatrix = m_mtxPerspective; // ビュー座標からプロジェクション座標への変換
 
-	XMVECTOR worldPos = { position.x, position.y, position.z, 1.0f }; // IuWFNg̍Wi[hWj
-	XMVECTOR viewPos = XMVector3TransformCoord(worldPos, viewMatrix); // r[Ԃ֕ϊ
-	XMVECTOR projPos = XMVector3TransformCoord(viewPos, projectionMatrix); // vWFNVԂ֕ϊ
+	XMVECTOR worldPos = { position.x, position.y, position.z, 1.0f }; // オブジェクトの座標（ワールド座標）
+	XMVECTOR viewPos = XMVector3TransformCoord(worldPos, viewMatrix); // ビュー空間へ変換
+	XMVECTOR projPos = XMVector3TransformCoord(viewPos, projectionMatrix); // プロジェクション空間へ変換
 
-	// vWFNVšʂƂēW[-1, 1]͈̔
+	// プロジェクション行列の結果として得られる座標は[-1, 1]の範囲
 	XMFLOAT2 positionOnScreen;
 	positionOnScreen.x = (projPos.m128_f32[0] + 1.0f) * 0.5f * SCREEN_WIDTH;
 	positionOnScreen.y = (1.0f - projPos.m128_f32[1]) * 0.5f * SCREEN_HEIGHT;
 
 	/*
-		Y^
-		̈ʒu֌WɂĂ̓J̔wʂɂ̂ʓ̍WwĂ܂ƂB
-		ΉƂĂ̓JƂ̈ʒu֌WmFĔwʂ̂Ƃ͕`悵Ȃ悤ɂȂǁB
+		備忘録
+		特定の位置関係によってはカメラの背面にあるものが画面内の座標を指してしまうことがある。
+		対応策としてはカメラとの位置関係を確認して背面のときは描画しないようにするなど。
 	
 
 	return positionOnScreen;
@@ -105,24 +105,24 @@ XMFLOAT2 Camera::GetPositionOnScreen(const XMFLOAT3& position)
 */
 /*
 // --------------------------------------------------
-// t[J
-// RɓJ
-// }EXzC[ : ^[Qbg܂ł̋
-// ENbN : 
+// フリーカメラ
+// 自由に動けるカメラ
+// マウスホイール : ターゲットまでの距離調整
+// 右クリック : 旋回
 // --------------------------------------------------
 void FreeCamera::Update()
 {
-	// }EXɂJړ ----------
-	if (Mouse_IsWheelScroll()) m_Distance += 0.5f * Mouse_GetWheelScroll(); // 
+	// マウスによるカメラ移動 ----------
+	if (Mouse_IsWheelScroll()) m_Distance += 0.5f * Mouse_GetWheelScroll(); // 距離調整
 	m_Distance = Clamp(m_Distance, -70, -0.5f);
 
-	// NbNĂԂɃ}EẌړʂ𔽉f -----
+	// クリックしている間にマウスの移動量を反映 -----
 	static XMFLOAT2 mousePos = {};
 	static XMFLOAT2 mousePosOld = {};
-	// ENbNŉ] -----
+	// 右クリックで回転 -----
 	if (Mouse_IsClick(MS_CLICK_RIGHT))
 	{
-		// 擾
+		// 取得
 		if (Mouse_IsClickTrigger(MS_CLICK_RIGHT))
 		{
 			mousePosOld.x = Mouse_GetPositionX();
@@ -131,29 +131,29 @@ void FreeCamera::Update()
 		mousePos.x = Mouse_GetPositionX();
 		mousePos.y = Mouse_GetPositionY();
 
-		// [JxNg]
+		// ローカルベクトルを回転させる
 		{
 			XMMATRIX rotation = XMMatrixRotationAxis(m_VectorTop, -(mousePosOld.x - mousePos.x) * 0.005f);
 			m_VectorFront = XMVector3TransformNormal(m_VectorFront, rotation);
-			m_VectorRight = XMVector3Cross(m_VectorTop, m_VectorFront); // O
+			m_VectorRight = XMVector3Cross(m_VectorTop, m_VectorFront); // 外積
 
-			m_VectorFront = XMVector3Normalize(m_VectorFront); // K
-			m_VectorRight = XMVector3Normalize(m_VectorRight); // K
+			m_VectorFront = XMVector3Normalize(m_VectorFront); // 正規化
+			m_VectorRight = XMVector3Normalize(m_VectorRight); // 正規化
 		}
 		{
 			XMMATRIX rotation = XMMatrixRotationAxis(m_VectorRight, -(mousePosOld.y - mousePos.y) * 0.005f);
 			m_VectorFront = XMVector3TransformNormal(m_VectorFront, rotation);
-			m_VectorTop = XMVector3Cross(m_VectorFront, m_VectorRight); // O
+			m_VectorTop = XMVector3Cross(m_VectorFront, m_VectorRight); // 外積
 
-			m_VectorFront = XMVector3Normalize(m_VectorFront); // K
-			m_VectorTop = XMVector3Normalize(m_VectorTop); // K
+			m_VectorFront = XMVector3Normalize(m_VectorFront); // 正規化
+			m_VectorTop = XMVector3Normalize(m_VectorTop); // 正規化
 		}
 
-		// L^
+		// 記録
 		mousePosOld.x = mousePos.x;
 		mousePosOld.y = mousePos.y;
 	}
-	// NbNňړ -----
+	// 中クリックで移動 -----
 	if (Mouse_IsClick(MS_CLICK_MIDDLE))
 	{
 		if (Mouse_IsClickTrigger(MS_CLICK_MIDDLE))
@@ -164,7 +164,7 @@ void FreeCamera::Update()
 		mousePos.x = Mouse_GetPositionX();
 		mousePos.y = Mouse_GetPositionY();
 
-		// }EẌړʂňړ -----
+		// マウスの移動量で移動 -----
 		XMFLOAT3 targetPosition = m_TargetPosition;
 		XMFLOAT3 cameraPosition = {};
 		XMStoreFloat3(&cameraPosition, m_Position);
@@ -183,10 +183,10 @@ void FreeCamera::Update()
 		cameraPosition.y += vecTop.y * diff.y + vecRight.y * diff.x;
 		cameraPosition.z += vecTop.z * diff.y + vecRight.z * diff.x;
 
-		m_TargetPosition = targetPosition; // XV
-		m_Position = XMLoadFloat3(&cameraPosition); // XV
+		m_TargetPosition = targetPosition; // 更新
+		m_Position = XMLoadFloat3(&cameraPosition); // 更新
 
-		// L^
+		// 記録
 		mousePosOld.x = mousePos.x;
 		mousePosOld.y = mousePos.y;
 
@@ -195,35 +195,35 @@ void FreeCamera::Update()
 	}
 
 
-	// JWvZ ----------
+	// カメラ座標計算 ----------
 	XMMATRIX rotation =
 	{
 		{m_VectorRight},
 		{m_VectorTop},
 		{m_VectorFront},
 		{0.0f,   0.0f,   0.0f,   1.0f}
-	}; // [JxNgɂ]s
-	XMMATRIX translation = XMMatrixTranslationFromVector(XMLoadFloat3(&m_TargetPosition)); // Ώۂ position
-	XMMATRIX translation1 = XMMatrixTranslation(0.0f, 0.0f, m_Distance); // äړ
+	}; // ローカルベクトルによる回転行列
+	XMMATRIX translation = XMMatrixTranslationFromVector(XMLoadFloat3(&m_TargetPosition)); // 対象の position
+	XMMATRIX translation1 = XMMatrixTranslation(0.0f, 0.0f, m_Distance); // 半径分の移動距離
 
-	XMMATRIX world = translation1 * rotation * translation; // ϊs
+	XMMATRIX world = translation1 * rotation * translation; // 変換行列
 
-	XMVECTOR position = XMVector3TransformCoord({ 0.0f, 0.0f, 0.0f }, world); // ϊ position
+	XMVECTOR position = XMVector3TransformCoord({ 0.0f, 0.0f, 0.0f }, world); // 変換後の position
 
-	XMVECTOR vect = position - m_Position; // xNg
+	XMVECTOR vect = position - m_Position; // 方向ベクトル
 	vect *= 0.05f;
 	m_Position += vect;
 
-	// J̌̌vZ ----------
+	// カメラの向きの計算 ----------
 	XMVECTOR targetPos = XMLoadFloat3(&m_TargetPosition);
-	vect = targetPos - m_FocusPosition; // xNg
+	vect = targetPos - m_FocusPosition; // 方向ベクトル
 	vect *= 0.05f * 2;
 	m_FocusPosition += vect;
 
-	//                               cameraPosition          camerǎ        camerȁxNg
-	XMMATRIX view = XMMatrixLookAtLH(m_Position, m_FocusPosition, m_VectorTop); // LH...LeftHand(Wn)
-	//                                              camerảp  AXyNg  nearZ  farZ
-	XMMATRIX perspective = XMMatrixPerspectiveFovLH(XM_PI / 3.0f, (float)SCREEN_WIDTH / SCREEN_HEIGHT, 0.01f, 1000.0f); // p[XyNeBuWϊ // XMConvertToRadians(60) ł
+	//                               cameraPosition          cameraの向き        cameraの上ベクトル
+	XMMATRIX view = XMMatrixLookAtLH(m_Position, m_FocusPosition, m_VectorTop); // LH...LeftHand(左手座標系)
+	//                                              cameraの画角  アスペクト比  nearZ  farZ
+	XMMATRIX perspective = XMMatrixPerspectiveFovLH(XM_PI / 3.0f, (float)SCREEN_WIDTH / SCREEN_HEIGHT, 0.01f, 1000.0f); // パースペクティブ座標変換 // XMConvertToRadians(60) でも可
 
 	SetMatrixView(view);
 	SetMatrixPerspective(perspective);
@@ -233,46 +233,46 @@ void FreeCamera::Update()
 
 void FreeCamera::Draw()
 {
-	//vWFNVs쐬
+	//プロジェクション行列を作成
 	XMMATRIX	ProjectionMatrix = GetMatrixPerspective();
-	//vWFNVsZbg
+	//プロジェクション行列をセット
 	Renderer::SetProjectionMatrix(ProjectionMatrix);
 
-	//Js쐬
+	//カメラ行列を作成
 	XMVECTOR	eyev = m_FocusPosition;
 	XMVECTOR	pos = m_Position;
 	XMVECTOR	up = m_VectorTop;
 	XMMATRIX	ViewMatrix = XMMatrixLookAtLH(pos, eyev, up);
 
-	//JsZbg
+	//カメラ行列をセット
 	Renderer::SetViewMatrix(GetMatrixView());
 
 	Renderer::SetDepthEnable(true);
 
-	////JWZbg
+	////カメラ座標セット
 	//XMFLOAT3 position;
 	//XMStoreFloat3(&position, GetPosition());
 	//Renderer::SetCameraPosition(position);
 }
 
 // --------------------------------------------------
-// tH[J
-// ^[QbgɒǏ]J
-// }EXzC[ : ^[Qbg܂ł̋
-// ENbN : 
+// フォローカメラ
+// ターゲットに追従するカメラ
+// マウスホイール : ターゲットまでの距離調整
+// 右クリック : 旋回
 // --------------------------------------------------
 void FollowCamera::Update()
 {
-	// }EXɂJړ ----------
-	if (Mouse_IsWheelScroll()) m_Distance += 1.5f * Mouse_GetWheelScroll(); // 
+	// マウスによるカメラ移動 ----------
+	if (Mouse_IsWheelScroll()) m_Distance += 1.5f * Mouse_GetWheelScroll(); // 距離調整
 	m_Distance = Clamp(m_Distance, -70, -3);
 
-	// NbNĂԂɃ}EẌړʂ𔽉f
+	// クリックしている間にマウスの移動量を反映
 	static XMFLOAT2 mousePos = {};
 	static XMFLOAT2 mousePosOld = {};
 	if (Mouse_IsClick(MS_CLICK_RIGHT))
 	{
-		// 擾
+		// 取得
 		if (Mouse_IsClickTrigger(MS_CLICK_RIGHT))
 		{
 			mousePosOld.x = Mouse_GetPositionX();
@@ -281,65 +281,65 @@ void FollowCamera::Update()
 		mousePos.x = Mouse_GetPositionX();
 		mousePos.y = Mouse_GetPositionY();
 
-		// [JxNg]
+		// ローカルベクトルを回転させる
 		{
 			XMMATRIX rotation = XMMatrixRotationAxis(m_VectorTop, -(mousePosOld.x - mousePos.x) * 0.005f);
 			m_VectorFront = XMVector3TransformNormal(m_VectorFront, rotation);
-			m_VectorRight = XMVector3Cross(m_VectorTop, m_VectorFront); // O
+			m_VectorRight = XMVector3Cross(m_VectorTop, m_VectorFront); // 外積
 
-			m_VectorFront = XMVector3Normalize(m_VectorFront); // K
-			m_VectorRight = XMVector3Normalize(m_VectorRight); // K
+			m_VectorFront = XMVector3Normalize(m_VectorFront); // 正規化
+			m_VectorRight = XMVector3Normalize(m_VectorRight); // 正規化
 		}
 		{
 			XMMATRIX rotation = XMMatrixRotationAxis(m_VectorRight, -(mousePosOld.y - mousePos.y) * 0.005f);
 			m_VectorFront = XMVector3TransformNormal(m_VectorFront, rotation);
-			m_VectorTop = XMVector3Cross(m_VectorFront, m_VectorRight); // O
+			m_VectorTop = XMVector3Cross(m_VectorFront, m_VectorRight); // 外積
 
-			m_VectorFront = XMVector3Normalize(m_VectorFront); // K
-			m_VectorTop = XMVector3Normalize(m_VectorTop); // K
+			m_VectorFront = XMVector3Normalize(m_VectorFront); // 正規化
+			m_VectorTop = XMVector3Normalize(m_VectorTop); // 正規化
 		}
 
-		// L^
+		// 記録
 		mousePosOld.x = mousePos.x;
 		mousePosOld.y = mousePos.y;
 	}
 
-	// JWvZ ----------
+	// カメラ座標計算 ----------
 	XMMATRIX rotation =
 	{
 		{m_VectorRight},
 		{m_VectorTop},
 		{m_VectorFront},
 		{0.0f,   0.0f,   0.0f,   1.0f}
-	}; // [JxNgɂ]s
+	}; // ローカルベクトルによる回転行列
 
 	XMFLOAT3 positionTarget = { m_pTargetObject->GetPosition().x, m_pTargetObject->GetPosition().y, m_pTargetObject->GetPosition().z };
-	XMMATRIX translation = XMMatrixTranslationFromVector(XMLoadFloat3(&positionTarget)); // Ώۂ position
-	XMMATRIX translation1 = XMMatrixTranslation(0.0f, 0.0f, m_Distance); // äړ
+	XMMATRIX translation = XMMatrixTranslationFromVector(XMLoadFloat3(&positionTarget)); // 対象の position
+	XMMATRIX translation1 = XMMatrixTranslation(0.0f, 0.0f, m_Distance); // 半径分の移動距離
 
-	XMMATRIX world = translation1 * rotation * translation; // ϊs
+	XMMATRIX world = translation1 * rotation * translation; // 変換行列
 
-	XMVECTOR position = XMVector3TransformCoord({ 0.0f, 0.0f, 0.0f }, world); // ϊ position
+	XMVECTOR position = XMVector3TransformCoord({ 0.0f, 0.0f, 0.0f }, world); // 変換後の position
 
-	XMVECTOR vect = position - m_Position; // xNg
+	XMVECTOR vect = position - m_Position; // 方向ベクトル
 	vect *= 0.05f;
 	m_Position += vect;
 
-	// J̌̌vZ ----------
+	// カメラの向きの計算 ----------
 	XMVECTOR targetPos = XMLoadFloat3(&positionTarget);
-	vect = targetPos - m_FocusPosition; // xNg
+	vect = targetPos - m_FocusPosition; // 方向ベクトル
 	vect *= 0.05f;
 	m_FocusPosition += vect;
 
-	//                               cameraPosition          camerǎ        camerȁxNg
-	XMMATRIX view = XMMatrixLookAtLH(m_Position, m_FocusPosition, m_VectorTop); // LH...LeftHand(Wn)
-	//                                              camerảp  AXyNg  nearZ  farZ
-	XMMATRIX perspective = XMMatrixPerspectiveFovLH(XM_PI / 3.0f, (float)SCREEN_WIDTH / SCREEN_HEIGHT, 0.01f, 1000.0f); // p[XyNeBuWϊ // XMConvertToRadians(60) ł
+	//                               cameraPosition          cameraの向き        cameraの上ベクトル
+	XMMATRIX view = XMMatrixLookAtLH(m_Position, m_FocusPosition, m_VectorTop); // LH...LeftHand(左手座標系)
+	//                                              cameraの画角  アスペクト比  nearZ  farZ
+	XMMATRIX perspective = XMMatrixPerspectiveFovLH(XM_PI / 3.0f, (float)SCREEN_WIDTH / SCREEN_HEIGHT, 0.01f, 1000.0f); // パースペクティブ座標変換 // XMConvertToRadians(60) でも可
 
 	SetMatrixView(view);
 	SetMatrixPerspective(perspective);
 
-	// 킯ĂނiZ\[g֌Wj
+	// わけ合ってむりやり代入（Zソート関係）
 	XMFLOAT3 pos;
 	Vector3 posVec;
 	XMStoreFloat3(&pos, m_Position);
@@ -351,18 +351,18 @@ void FollowCamera::Update()
 
 void FollowCamera::Draw()
 {
-	//vWFNVs쐬
+	//プロジェクション行列を作成
 	XMMATRIX	ProjectionMatrix = GetMatrixPerspective();
-	//vWFNVsZbg
+	//プロジェクション行列をセット
 	Renderer::SetProjectionMatrix(ProjectionMatrix);
 
-	//Js쐬
+	//カメラ行列を作成
 	XMVECTOR	eyev = m_FocusPosition;
 	XMVECTOR	pos = m_Position;
 	XMVECTOR	up = m_VectorTop;
 	XMMATRIX	ViewMatrix = XMMatrixLookAtLH(pos, eyev, up);
 
-	//JsZbg
+	//カメラ行列をセット
 	Renderer::SetViewMatrix(GetMatrixView());
 
 
@@ -4,27 +4,32 @@
 */
 #include <algorithm>
 #include <vector>
-#include "Collision.h"
+#include <limits>
+#include <cfloat>
+#include "collision.h"
 #include "TransformComponent.h"
 #include "Matrix4x4.h"
 #include "Quaternion.h"
 #include "ContactManifold.h"
 #include "Triangle.h"
 #include "ColliderPose.h"
+#include "TriangleMeshBVH.h"
+#include "ConvexHull.h"
+#include "GJK.h"
 
 // ==================================================
-// wp֐
+// ヘルパ関数
 // ==================================================
 namespace
 {
-	// [hOBB
+	// ワールドOBB
 	struct OBBW
 	{
 		Vector3 center;  // center
 		Vector3 axis[3]; // world acis
-		Vector3 extent;	 // world scale Kp
+		Vector3 extent;	 // world scale 適用後
 	};
-	// [hOBB ̍\z
+	// ワールドOBB の構築
 	OBBW MakeOBB(const ColliderPose& pose, const BoxCollision& box)
 	{
 		OBBW o;
@@ -39,10 +44,10 @@ namespace
 	}
 
 	float AbsDot(const Vector3& a, const Vector3& b) { return fabsf(Vector3::Dot(a, b)); }
-	// ővf̃CfbNXԂ
+	// 最大要素のインデックスを返す
 	int ArgMax3(float a, float b, float c) { return (a > b ? (a > c ? 0 : 2) : (b > c ? 1 : 2)); } // {max, return} = {a, 0}, {b, 1}, {c, 2} 
 
-	// _Q𕽖ʂŃNbviSutherland-Hodgmanj
+	// 点群を平面でクリップ（Sutherland-Hodgman）
 	std::vector<Vector3> ClipPolygonAgainstPlane(const std::vector<Vector3>& poly, const Vector3& n, float d)
 	{
 		std::vector<Vector3> out;
@@ -50,11 +55,11 @@ namespace
 		const int N = (int)poly.size();
 		for (int i = 0; i < N; i++)
 		{
-			const Vector3& A = poly[i]; // _in_j
-			const Vector3& B = poly[(i + 1) % N]; // ׂ̒_ iI_j
+			const Vector3& A = poly[i]; // 基準頂点（始点）
+			const Vector3& B = poly[(i + 1) % N]; // 隣の頂点 （終点）
 			const float da = Vector3::Dot(n, A) - d;
 			const float db = Vector3::Dot(n, B) - d;
-			const bool ina = (da <= 0.0f); // ngOhƂĂ
+			const bool ina = (da <= 0.0f); // 今回はn方向を“外側”としている
 			const bool inb = (db <= 0.0f);
 			if (ina && inb)
 				out.push_back(B);
@@ -78,10 +83,10 @@ namespace
 	struct AxisChoice 
 	{ 
 		AxisKind kind;
-		int ia; // faceA:0..2 / Edge : A
-		int ib; // faceB:0..2 / Edge : B
-		float depth; // ŏѓ
-		Vector3 n; // A  B
+		int ia; // faceA:0..2 / Edge : A側軸
+		int ib; // faceB:0..2 / Edge : B側軸
+		float depth; // 最小貫入量
+		Vector3 n; // A → B
 	}; 
 	float SupportRadius(const OBBW& O, const Vector3& n)
 	{
@@ -90,23 +95,23 @@ namespace
 	bool SAT_AllAxes(const OBBW& A, const OBBW& B, AxisChoice& out, float epsLen2 = 1e-12f)
 	{
 		const Vector3 vectAtoB = B.center - A.center;
-		float best = 1e9f; // ѓ[x
-		AxisKind bestKind = AxisKind::FaceA; // 
+		float best = 1e9f; // 貫入深度
+		AxisKind bestKind = AxisKind::FaceA; // 種類
 		int bestI = 0, bestJ = 0;  // 
 		Vector3 bestN = A.axis[0]; // 
 
 		auto testAxis = [&](const Vector3& nRaw, AxisKind kind, int ia, int ib) -> bool
 			{
 				float nLen2 = nRaw.lengthSq();
-				if (nLen2 < epsLen2) return true; // iقڕsj
-				Vector3 n = nRaw / sqrtf(nLen2); // eijiKj
-				float dist = fabsf(Vector3::Dot(vectAtoB, n)); // e
-				float rA = SupportRadius(A, n); // ̓e
-				float rB = SupportRadius(B, n); // ̓e
-				float overlap = rA + rB - dist; // Ŕr
-				if (overlap < 0.0f) return false; // 
+				if (nLen2 < epsLen2) return true; // 無効軸（ほぼ平行）
+				Vector3 n = nRaw / sqrtf(nLen2); // 投影軸（分離軸）（正規化）
+				float dist = fabsf(Vector3::Dot(vectAtoB, n)); // 投影
+				float rA = SupportRadius(A, n); // 半長の投影
+				float rB = SupportRadius(B, n); // 半長の投影
+				float overlap = rA + rB - dist; // 軸上で比較
+				if (overlap < 0.0f) return false; // 分離
 				if (overlap < best) { best = overlap; bestKind = kind; bestI = ia; bestJ = ib; bestN = n; }
-				return true; // GĂ
+				return true; // 触れている
 			};
 
 		// Face Axis (A, B)
@@ -114,28 +119,40 @@ namespace
 		for (int j = 0; j < 3; j++) if (!testAxis(B.axis[j], AxisKind::FaceB, -1, j)) return false;
 
 		// Edge-Edge Axis
+		// 面の軸で決まった結果を覚えておく
+		const float faceBest = best;
+		const AxisKind faceKind = bestKind;
+		const int faceI = bestI, faceJ = bestJ;
+		const Vector3 faceN = bestN;
 		for (int i = 0; i < 3; i++)
 			for (int j = 0; j < 3; j++)
 			{
 				Vector3 c = Vector3::Cross(A.axis[i], B.axis[j]);
+				if (c.lengthSq() < 1e-6f) continue; // ほぼ平行なエッジ同士は面の軸と同じなので見ない
 				if (!testAxis(c, AxisKind::EdgeEdge, i, j)) return false;
 			}
+		// エッジ軸は面の軸よりはっきり浅いときだけ採用する
+		// （積み重ねで面とエッジが毎ステップ入れ替わると接触点が安定しない）
+		if (bestKind == AxisKind::EdgeEdge && best > faceBest * 0.95f - 0.005f)
+		{
+			best = faceBest; bestKind = faceKind; bestI = faceI; bestJ = faceJ; bestN = faceN;
+		}
 
-		// @ A  B Ɍ
+		// 法線は A → B に向ける
 		if (Vector3::Dot(bestN, vectAtoB) < 0) bestN = -bestN; 
 
-		// AxisChoice ̐
+		// AxisChoice の生成
 		out.kind = bestKind;
 		out.ia = bestI;
 		out.ib = bestJ;
 		out.depth = best;
 		out.n = bestN;
 
-		return true; // ڐG
+		return true; // 接触
 	}
 
-	// ref OBB  refFace I
-	void BuildRefFaceQuad(const OBBW& R, int refAxis, std::vector<Vector3>& outQuad) 
+	// ref OBB の refFace を選ぶ
+	[[maybe_unused]] void BuildRefFaceQuad(const OBBW& R, int refAxis, std::vector<Vector3>& outQuad) 
 	{
 		static const int others[3][2] = { {1,2}, {0,2}, {0,1} };
 		const int u = others[refAxis][0];
@@ -145,15 +162,15 @@ namespace
 		Vector3 Rv = R.axis[v];
 		float eu = R.extent[u];
 		float ev = R.extent[v];
-		Vector3 center = R.center + n * R.extent[refAxis]; // \
+		Vector3 center = R.center + n * R.extent[refAxis]; // 表側面
 		outQuad.clear();
-		outQuad.push_back(center + Ru*eu + Rv*ev); // E
-		outQuad.push_back(center - Ru*eu + Rv*ev); // 
-		outQuad.push_back(center - Ru*eu - Rv*ev); // 
-		outQuad.push_back(center + Ru*eu - Rv*ev); // E
+		outQuad.push_back(center + Ru*eu + Rv*ev); // 右上
+		outQuad.push_back(center - Ru*eu + Rv*ev); // 左上
+		outQuad.push_back(center - Ru*eu - Rv*ev); // 左下
+		outQuad.push_back(center + Ru*eu - Rv*ev); // 右下
 	}
 
-	// incidence face : normal ɍłs B ̖ʁiindex Ԃj
+	// incidence face : normal に最も反平行な B の面（index を返す）
 	int PickIncidenceFace(const OBBW& I, const Vector3& n) 
 	{
 		float d0 = Vector3::Dot(I.axis[0], n);
@@ -162,7 +179,7 @@ namespace
 		return ArgMax3(fabsf(d0), fabsf(d1), fabsf(d2));
 	}
 
-	// Q{̐iS}dir*Lenjŋߐړ_
+	// ２本の線分（中心±dir*Len）最近接点
 	void ClosestPointSegmentSegment(
 		const Vector3& P0, const Vector3& u, float lu,
 		const Vector3& Q0, const Vector3& v, float lv,
@@ -176,7 +193,7 @@ namespace
 		float e = Vector3::Dot(v, w0);
 		float denom = a*c - b*b;
 		float s, t;
-		if (denom < 1e-12f) // قڕs
+		if (denom < 1e-12f) // ほぼ平行
 		{ 
 			s = 0.0f; 
 			t = (c > 1e-12f) ? (e / c) : 0.0f; 
@@ -193,6 +210,484 @@ namespace
 		outP = P0 + u*s;
 		outQ = Q0 + v*t;
 	}
+
+	// --------------------------------------------------
+	// レイ × 球（始点が内側なら当たり無し）
+	// --------------------------------------------------
+	bool RaySphere(const Vector3& origin, const Vector3& dir, const Vector3& center, float radius, float maxDist, float& outT)
+	{
+		const Vector3 m = origin - center;
+		const float b = Vector3::Dot(m, dir);
+		const float c = Vector3::Dot(m, m) - radius * radius;
+		if (c <= 0.0f || b > 0.0f) return false; // 内側 or 離れていく
+		const float disc = b * b - c;
+		if (disc < 0.0f) return false;
+		const float t = -b - sqrtf(disc);
+		if (t > maxDist) return false;
+		outT = t < 0.0f ? 0.0f : t;
+		return true;
+	}
+	// --------------------------------------------------
+	// レイ × 三角形（Moller-Trumbore）
+	// 表（Cross(b - a, c - a) の向き）から入るときだけ当たり
+	// --------------------------------------------------
+	bool RayTriangleFront(const Vector3& origin, const Vector3& dir, const Vector3& a, const Vector3& b, const Vector3& c, float maxDist, float& outT, Vector3& outNormal)
+	{
+		const Vector3 e1 = b - a;
+		const Vector3 e2 = c - a;
+		const Vector3 n = Vector3::Cross(e1, e2);
+		if (Vector3::Dot(n, dir) >= 0.0f) return false; // 裏から or 平行
+
+		const Vector3 p = Vector3::Cross(dir, e2);
+		const float det = Vector3::Dot(e1, p);
+		const float invDet = 1.0f / det;
+		const Vector3 s = origin - a;
+		const float u = Vector3::Dot(s, p) * invDet;
+		if (u < 0.0f || u > 1.0f) return false;
+		const Vector3 q = Vector3::Cross(s, e1);
+		const float v = Vector3::Dot(dir, q) * invDet;
+		if (v < 0.0f || u + v > 1.0f) return false;
+		const float t = Vector3::Dot(e2, q) * invDet;
+		if (t < 0.0f || t > maxDist) return false;
+
+		outT = t;
+		outNormal = n;
+		return true;
+	}
+
+	// --------------------------------------------------
+	// HeightMap の接触候補（固定容量、ヒープを使わない）
+	// 溢れたら一番浅い候補と入れ替えるので、深い方から Capacity 個が残る
+	// --------------------------------------------------
+	struct TriHitBuffer
+	{
+		static constexpr int Capacity = 32;
+		TriHit hits[Capacity];
+		int count = 0;
+
+		void Add(const TriHit& h)
+		{
+			if (count < Capacity) { hits[count++] = h; return; }
+			int shallowest = 0;
+			for (int i = 1; i < count; i++)
+				if (hits[i].penetration < hits[shallowest].penetration) shallowest = i;
+			if (h.penetration > hits[shallowest].penetration) hits[shallowest] = h;
+		}
+	};
+	// --------------------------------------------------
+	// 候補から ContactManifold を組み立てる
+	// 深い順に見て、採用済みの点（pointOnA）から minSep 以上離れたものだけ MAX_POINTS まで採る
+	// 全部は並べ替えず、必要な分だけ「残りで一番深いもの」を選ぶ
+	// --------------------------------------------------
+	bool BuildManifoldFromHits(TriHitBuffer& buffer, float minSep, ContactManifold& out)
+	{
+		if (buffer.count == 0) return false;
+
+		const int maxCounts = out.MAX_POINTS;
+		const float minSepSq = minSep * minSep;
+		out.count = 0;
+		int remain = buffer.count;
+		while (remain > 0 && out.count < maxCounts)
+		{
+			// ----- 残りで一番深いものを末尾と入れ替えて取り出す -----
+			int deepest = 0;
+			for (int i = 1; i < remain; i++)
+				if (buffer.hits[i].penetration > buffer.hits[deepest].penetration) deepest = i;
+			std::swap(buffer.hits[deepest], buffer.hits[remain - 1]);
+			const TriHit& h = buffer.hits[--remain];
+
+			// ----- 採用済みの点に近ければ飛ばす -----
+			bool close = false;
+			for (int c = 0; c < out.count; c++)
+			{
+				Vector3 diff = h.pointOnA - out.points[c].pointOnA;
+				if (diff.lengthSq() < minSepSq)
+				{
+					close = true;
+					break;
+				}
+			}
+			if (close) continue;
+
+			if (out.count == 0) out.normal = h.normal; // 現在は最大深度のみを normal に採用する
+			out.points[out.count].penetration = h.penetration;
+			out.points[out.count].pointOnA	  = h.pointOnA;
+			out.points[out.count].pointOnB	  = h.pointOnB;
+			out.count++;
+		}
+
+		out.touching = true;
+		return out.touching;
+	}
+
+	// --------------------------------------------------
+	// 凸多角形を平面でクリップ（固定長の配列版、ヒープを使わない）
+	// n 方向を外側として、dot(n, p) <= d の側を残す
+	// 凸包の面は頂点が多いこともあるので多めに取っておく（溢れた点は捨てる）
+	// --------------------------------------------------
+	constexpr int MaxClipPoints = 32;
+	int ClipPolygonAgainstPlaneFixed(const Vector3* poly, int count, const Vector3& n, float d, Vector3* out)
+	{
+		int outCount = 0;
+		for (int i = 0; i < count; i++)
+		{
+			const Vector3& A = poly[i];
+			const Vector3& B = poly[(i + 1) % count];
+			const float da = Vector3::Dot(n, A) - d;
+			const float db = Vector3::Dot(n, B) - d;
+			const bool ina = (da <= 0.0f);
+			const bool inb = (db <= 0.0f);
+			if (ina != inb && outCount < MaxClipPoints)
+			{
+				const float t = da / (da - db + 1e-20f);
+				out[outCount++] = A + (B - A) * t;
+			}
+			if (inb && outCount < MaxClipPoints) out[outCount++] = B;
+		}
+		return outCount;
+	}
+	// --------------------------------------------------
+	// 面のクリップで MAX_POINTS より多く残った点から、支える面積が広くなる点を選ぶ
+	// 一番深い点 → そこから一番遠い点 → その２点との三角形が一番大きい点 → 三角形の外へ一番広げる点
+	// （前から順に採ると、同じ大きさの面が少しずれたときに角が抜けて、積み上げが片側に傾く）
+	// n は面の法線、選んだ点の番号を selected に入れて個数を返す
+	// --------------------------------------------------
+	int SelectManifoldPoints(const Vector3* points, const float* pens, int count, const Vector3& n, int selected[ContactManifold::MAX_POINTS])
+	{
+		constexpr int MaxPoints = ContactManifold::MAX_POINTS;
+		if (count <= MaxPoints)
+		{
+			for (int i = 0; i < count; i++) selected[i] = i;
+			return count;
+		}
+		auto area = [&](int a, int b, int c) { return Vector3::Dot(Vector3::Cross(points[b] - points[a], points[c] - points[a]), n); }; // 符号付き（n から見て反時計回りが＋）
+
+		int i0 = 0;
+		for (int i = 1; i < count; i++) if (pens[i] > pens[i0]) i0 = i;
+
+		int i1 = -1;
+		float best = -1.0f;
+		for (int i = 0; i < count; i++)
+		{
+			const float d = (points[i] - points[i0]).lengthSq();
+			if (i != i0 && d > best) { best = d; i1 = i; }
+		}
+
+		int i2 = -1;
+		best = -1.0f;
+		for (int i = 0; i < count; i++)
+		{
+			const float a = fabsf(area(i0, i1, i));
+			if (i != i0 && i != i1 && a > best) { best = a; i2 = i; }
+		}
+		const float side = area(i0, i1, i2) >= 0.0f ? 1.0f : -1.0f; // 三角形の向き
+
+		// 三角形の外にある点は、どれかの辺との面積が向きと逆になる（一番外れているものを採る）
+		int i3 = -1;
+		best = 0.0f;
+		for (int i = 0; i < count; i++)
+		{
+			if (i == i0 || i == i1 || i == i2) continue;
+			const float a = side * std::min(area(i0, i1, i), std::min(area(i1, i2, i), area(i2, i0, i)));
+			if (a < best) { best = a; i3 = i; }
+		}
+
+		selected[0] = i0; selected[1] = i1; selected[2] = i2;
+		if (i3 < 0) return 3; // 残りは全部三角形の中
+		selected[3] = i3;
+		return 4;
+	}
+	// --------------------------------------------------
+	// OBB × 三角形（SAT、13軸）
+	// 法線は Box → 三角形、pointOnA が Box 上、pointOnB が三角形上
+	// 面の軸を優先し、辺×辺は明らかに浅いときだけ採る
+	// --------------------------------------------------
+	void BoxTriangleContacts(const OBBW& box, const Triangle& tri, float slop, TriHitBuffer& hits)
+	{
+		const Vector3 v[3]	  = { tri.a, tri.b, tri.c };
+		const Vector3 edge[3] = { tri.b - tri.a, tri.c - tri.b, tri.a - tri.c };
+		Vector3 triN = Vector3::Cross(edge[0], tri.c - tri.a);
+		const float triNLen2 = triN.lengthSq();
+		if (triNLen2 < 1e-12f) return; // 潰れた三角形
+		triN = triN / sqrtf(triNLen2);
+
+		// ----- SAT（FaceA : Box の面、FaceB : 三角形の面） -----
+		float best = 1e9f;
+		AxisKind bestKind = AxisKind::FaceB;
+		int bestI = 0, bestJ = 0;
+		Vector3 bestN = triN;
+		auto testAxis = [&](const Vector3& nRaw, AxisKind kind, int ia, int ib) -> bool
+			{
+				const float nLen2 = nRaw.lengthSq();
+				if (nLen2 < 1e-12f) return true; // 無効軸（ほぼ平行）
+				const Vector3 n = nRaw / sqrtf(nLen2);
+				const float c = Vector3::Dot(box.center, n);
+				const float r = SupportRadius(box, n);
+				const float p0 = Vector3::Dot(v[0], n);
+				const float p1 = Vector3::Dot(v[1], n);
+				const float p2 = Vector3::Dot(v[2], n);
+				const float overlapPos = c + r - std::min({ p0, p1, p2 }); // 三角形が +n 側にあるとき
+				const float overlapNeg = std::max({ p0, p1, p2 }) - (c - r); // 三角形が -n 側にあるとき
+				if (overlapPos < 0.0f || overlapNeg < 0.0f) return false; // 分離
+				const float depth = std::min(overlapPos, overlapNeg);
+				const float biased = (kind == AxisKind::EdgeEdge) ? depth * 1.05f + 1e-3f : depth;
+				if (biased < best)
+				{
+					best = depth; bestKind = kind; bestI = ia; bestJ = ib;
+					bestN = (overlapPos < overlapNeg) ? n : -n;
+				}
+				return true;
+			};
+		if (!testAxis(triN, AxisKind::FaceB, -1, -1)) return;
+		for (int i = 0; i < 3; i++) if (!testAxis(box.axis[i], AxisKind::FaceA, i, -1)) return;
+		for (int i = 0; i < 3; i++)
+			for (int j = 0; j < 3; j++)
+				if (!testAxis(Vector3::Cross(box.axis[i], edge[j]), AxisKind::EdgeEdge, i, j)) return;
+
+		const Vector3 n = bestN;
+		const float ext[3] = { box.extent.x, box.extent.y, box.extent.z };
+		auto addHit = [&](const Vector3& onA, const Vector3& onB, float depth)
+			{
+				TriHit h;
+				h.hit = true;
+				h.penetration = depth;
+				h.normal = n;
+				h.pointOnA = onA;
+				h.pointOnB = onB;
+				hits.Add(h);
+			};
+
+		Vector3 bufA[MaxClipPoints], bufB[MaxClipPoints];
+		if (bestKind == AxisKind::FaceB)
+		{
+			// ----- 三角形の面：三角形に向いた Box の面を、三角形の柱でクリップ -----
+			const int k = PickIncidenceFace(box, n);
+			const float sk = Vector3::Dot(box.axis[k], n) > 0.0f ? 1.0f : -1.0f;
+			const int k1 = (k + 1) % 3, k2 = (k + 2) % 3;
+			const Vector3 fc = box.center + box.axis[k] * (sk * ext[k]);
+			const Vector3 u1 = box.axis[k1] * ext[k1];
+			const Vector3 u2 = box.axis[k2] * ext[k2];
+			bufA[0] = fc + u1 + u2; bufA[1] = fc - u1 + u2; bufA[2] = fc - u1 - u2; bufA[3] = fc + u1 - u2;
+			int count = 4;
+			Vector3* src = bufA; Vector3* dst = bufB;
+			for (int i = 0; i < 3 && count > 0; i++)
+			{
+				const Vector3 side = Vector3::Cross(edge[i], triN); // 三角形の外向き
+				count = ClipPolygonAgainstPlaneFixed(src, count, side, Vector3::Dot(side, v[i]), dst);
+				std::swap(src, dst);
+			}
+			for (int i = 0; i < count; i++)
+			{
+				const float depth = Vector3::Dot(src[i] - v[0], n); // 三角形の面を越えた分
+				if (depth < -slop) continue;
+				addHit(src[i], src[i] - n * depth, depth);
+			}
+		}
+		else if (bestKind == AxisKind::FaceA)
+		{
+			// ----- Box の面：三角形を Box の面の柱でクリップ -----
+			const int k = bestI;
+			const Vector3 fn = Vector3::Dot(box.axis[k], n) > 0.0f ? box.axis[k] : -box.axis[k];
+			const float planeD = Vector3::Dot(fn, box.center) + ext[k];
+			bufA[0] = v[0]; bufA[1] = v[1]; bufA[2] = v[2];
+			int count = 3;
+			Vector3* src = bufA; Vector3* dst = bufB;
+			for (int m = 0; m < 3 && count > 0; m++)
+			{
+				if (m == k) continue;
+				const float c = Vector3::Dot(box.axis[m], box.center);
+				count = ClipPolygonAgainstPlaneFixed(src, count, box.axis[m], c + ext[m], dst);
+				std::swap(src, dst);
+				if (count == 0) break;
+				count = ClipPolygonAgainstPlaneFixed(src, count, -box.axis[m], -c + ext[m], dst);
+				std::swap(src, dst);
+			}
+			for (int i = 0; i < count; i++)
+			{
+				const float depth = planeD - Vector3::Dot(fn, src[i]); // Box の面より内側の分
+				if (depth < -slop) continue;
+				addHit(src[i] + fn * depth, src[i], depth);
+			}
+		}
+		else
+		{
+			// ----- 辺×辺：n 側に一番出ている Box の辺と、三角形の辺の最近接点 -----
+			Vector3 edgeCenter = box.center;
+			for (int m = 0; m < 3; m++)
+			{
+				if (m == bestI) continue;
+				edgeCenter = edgeCenter + box.axis[m] * (Vector3::Dot(box.axis[m], n) > 0.0f ? ext[m] : -ext[m]);
+			}
+			const float triEdgeLen = edge[bestJ].length();
+			const Vector3 triEdgeCenter = v[bestJ] + edge[bestJ] * 0.5f;
+			Vector3 onA, onB;
+			ClosestPointSegmentSegment(edgeCenter, box.axis[bestI], ext[bestI],
+									   triEdgeCenter, edge[bestJ] / triEdgeLen, triEdgeLen * 0.5f, onA, onB);
+			addHit(onA, onB, best);
+		}
+	}
+
+	// --------------------------------------------------
+	// 凸形状（GJK 用）を作る
+	// --------------------------------------------------
+	SupportShape MakeBoxShape(const ColliderPose& pose, const BoxCollision& box)
+	{
+		const OBBW obb = MakeOBB(pose, box);
+		return SupportShape::Box(obb.center, obb.axis, obb.extent);
+	}
+	SupportShape MakeSphereShape(const ColliderPose& pose, const SphereCollision& sphere)
+	{
+		return SupportShape::Sphere(pose.position, sphere.Radius() * fabsf(pose.scale.x));
+	}
+	SupportShape MakeCapsuleShape(const ColliderPose& pose, const CapsuleCollision& capsule)
+	{
+		const Vector3 up = pose.WorldUp();
+		const float halfCylinder = capsule.CylinderHeight() * fabsf(pose.scale.y) * 0.5f;
+		const float radius = capsule.Radius() * std::max(fabsf(pose.scale.x), fabsf(pose.scale.z));
+		return SupportShape::Capsule(pose.position + up * halfCylinder, pose.position - up * halfCylinder, radius);
+	}
+	SupportShape MakeHullShape(const ColliderPose& pose, const ConvexHullCollision& hull)
+	{
+		const Vector3 axes[3] = { pose.WorldRight(), pose.WorldUp(), pose.WorldForward() };
+		return SupportShape::Hull(&hull.Hull(), pose.position, axes, pose.scale);
+	}
+	// --------------------------------------------------
+	// dir に一番向いている面（丸い形状は芯を dir 側へ半径ぶんずらした点）
+	// 面を持つ形状（箱、三角形、凸包）なら頂点数、法線は面の外向き
+	// --------------------------------------------------
+	int SupportFeature(const SupportShape& s, const Vector3& dir, Vector3* out, Vector3& outNormal)
+	{
+		outNormal = dir;
+		switch (s.type)
+		{
+		case SupportShape::Type::Point:
+			out[0] = s.p[0] + dir * s.radius;
+			return 1;
+		case SupportShape::Type::Segment:
+			out[0] = s.p[0] + dir * s.radius;
+			out[1] = s.p[1] + dir * s.radius;
+			return 2;
+		case SupportShape::Type::Triangle:
+		{
+			const Vector3 n = Vector3::Cross(s.p[1] - s.p[0], s.p[2] - s.p[0]).normalized();
+			outNormal = Vector3::Dot(n, dir) >= 0.0f ? n : -n;
+			out[0] = s.p[0]; out[1] = s.p[1]; out[2] = s.p[2];
+			return 3;
+		}
+		case SupportShape::Type::Box:
+		{
+			const int k = ArgMax3(AbsDot(s.axis[0], dir), AbsDot(s.axis[1], dir), AbsDot(s.axis[2], dir));
+			const float sk = Vector3::Dot(s.axis[k], dir) >= 0.0f ? 1.0f : -1.0f;
+			const int k1 = (k + 1) % 3, k2 = (k + 2) % 3;
+			const Vector3 fc = s.p[0] + s.axis[k] * (sk * s.half[k]);
+			const Vector3 u1 = s.axis[k1] * s.half[k1];
+			const Vector3 u2 = s.axis[k2] * s.half[k2];
+			outNormal = s.axis[k] * sk;
+			out[0] = fc + u1 + u2; out[1] = fc - u1 + u2; out[2] = fc - u1 - u2; out[3] = fc + u1 - u2;
+			return 4;
+		}
+		case SupportShape::Type::Hull:
+		{
+			// 法線は逆転置（スケールで割る）で回すので、方向もスケールで割ってローカルへ
+			const Vector3 local(Vector3::Dot(s.axis[0], dir) / s.half.x, Vector3::Dot(s.axis[1], dir) / s.half.y, Vector3::Dot(s.axis[2], dir) / s.half.z);
+			const ConvexHull::Face& face = s.hull->GetFace(s.hull->SupportFace(local));
+			const Vector3& n = face.normal;
+			outNormal = (s.axis[0] * (n.x / s.half.x) + s.axis[1] * (n.y / s.half.y) + s.axis[2] * (n.z / s.half.z)).normalized();
+			const int count = std::min(face.count, MaxClipPoints);
+			for (int i = 0; i < count; i++) out[i] = s.HullToWorld(s.hull->FaceVertex(face, i));
+			return count;
+		}
+		}
+		out[0] = s.p[0];
+		return 1;
+	}
+	// --------------------------------------------------
+	// 凸形状同士の接触点（GJK / EPA ＋ 面のクリップ）
+	// 法線は A → B、pointOnA が A 上、pointOnB が B 上
+	// EPA の向きとほぼ同じ向きの面があれば、それを参照面にして相手の面（丸い形状なら芯）をクリップし点を増やす
+	// 辺同士などで揃う面が無ければ EPA の１点だけ
+	// --------------------------------------------------
+	void ConvexContacts(const SupportShape& A, const SupportShape& B, float slop, TriHitBuffer& hits)
+	{
+		GJK::PenetrationResult pen;
+		if (!GJK::Penetration(A, B, pen) || pen.depth < -slop) return;
+
+		TriHit hit;
+		hit.hit = true;
+		auto addHit = [&](const Vector3& normal, const Vector3& onA, const Vector3& onB, float depth)
+			{
+				hit.normal = normal;
+				hit.pointOnA = onA;
+				hit.pointOnB = onB;
+				hit.penetration = depth;
+				hits.Add(hit);
+			};
+
+		// ----- 参照面を決める（A を少し優先） -----
+		constexpr float FaceCos = 0.99f;
+		Vector3 polyA[MaxClipPoints], polyB[MaxClipPoints], nA, nB;
+		const int countA = SupportFeature(A, pen.normal, polyA, nA);
+		const int countB = SupportFeature(B, -pen.normal, polyB, nB);
+		const float alignA = countA >= 3 ? Vector3::Dot(nA, pen.normal) : -1.0f;
+		const float alignB = countB >= 3 ? Vector3::Dot(nB, -pen.normal) : -1.0f;
+		if (std::max(alignA, alignB) < FaceCos)
+		{
+			addHit(pen.normal, pen.pointA, pen.pointB, pen.depth);
+			return;
+		}
+		const bool refIsA = alignA >= alignB - 1e-3f;
+		const Vector3* ref = refIsA ? polyA : polyB;
+		const int refCount = refIsA ? countA : countB;
+		const Vector3 refN = refIsA ? nA : nB; // 参照形状の外向き
+
+		// ----- 相手の面を参照面の柱でクリップ -----
+		Vector3 bufA[MaxClipPoints], bufB[MaxClipPoints];
+		int count = refIsA ? countB : countA;
+		for (int i = 0; i < count; i++) bufA[i] = refIsA ? polyB[i] : polyA[i];
+		Vector3 refCenter{};
+		for (int i = 0; i < refCount; i++) refCenter += ref[i];
+		refCenter = refCenter / (float)refCount;
+		Vector3* src = bufA; Vector3* dst = bufB;
+		for (int i = 0; i < refCount && count > 0; i++)
+		{
+			const Vector3& r0 = ref[i];
+			const Vector3& r1 = ref[(i + 1) % refCount];
+			Vector3 side = Vector3::Cross(r1 - r0, refN);
+			if (Vector3::Dot(side, refCenter - r0) > 0.0f) side = -side; // 外向きに揃える
+			count = ClipPolygonAgainstPlaneFixed(src, count, side, Vector3::Dot(side, r0), dst);
+			std::swap(src, dst);
+		}
+
+		// ----- 参照面より内側の点だけ残す -----
+		const float refD = Vector3::Dot(refN, ref[0]);
+		const Vector3 normal = refIsA ? refN : -refN;
+		bool added = false;
+		for (int i = 0; i < count; i++)
+		{
+			const float sep = Vector3::Dot(refN, src[i]) - refD; // 負ならめり込んでいる
+			if (sep > slop) continue;
+			const Vector3 onRef = src[i] - refN * sep;
+			if (refIsA) addHit(normal, onRef, src[i], -sep);
+			else		addHit(normal, src[i], onRef, -sep);
+			added = true;
+		}
+		if (!added) addHit(pen.normal, pen.pointA, pen.pointB, pen.depth); // クリップで全滅した場合の保険
+	}
+	// --------------------------------------------------
+	// 凸形状同士の ContactManifold
+	// --------------------------------------------------
+	bool ConvexManifold(const SupportShape& A, const SupportShape& B, float minSep, float slop, ContactManifold& out)
+	{
+		TriHitBuffer hits;
+		ConvexContacts(A, B, slop, hits);
+		return BuildManifoldFromHits(hits, minSep, out);
+	}
+	// 凸包の接触点同士の最小間隔（一番近い面までの距離の1/4）
+	float HullMinSeparation(const ConvexHullCollision& hull, const ColliderPose& pose)
+	{
+		const float s = std::min(fabsf(pose.scale.x), std::min(fabsf(pose.scale.y), fabsf(pose.scale.z)));
+		return 0.25f * hull.Hull().InnerRadius() * s;
+	}
 }
 
 
@@ -204,127 +699,177 @@ AABB BoxCollision::ComputeWorldAABB(const ColliderPose& trans) const
 	Vector3 center = trans.position;
 	Matrix4x4 rotate = trans.rotation.ToMatrix();
 	Matrix4x4 scale = Matrix4x4::CreateScale(trans.scale.x, trans.scale.y, trans.scale.z);
-	Matrix4x4 mat = scale * rotate; // ]ƃXP[s
-	Vector3 e; // evf̗̐Βl m_HalfSize ̓
+	Matrix4x4 mat = scale * rotate; // 回転とスケールを持った行列
+	Vector3 e; // 各要素の列の絶対値と m_HalfSize の内積
 	e.x = fabsf(mat.m[0][0]) * m_HalfSize.x + fabsf(mat.m[1][0]) * m_HalfSize.y + fabsf(mat.m[2][0]) * m_HalfSize.z;
 	e.y = fabsf(mat.m[0][1]) * m_HalfSize.x + fabsf(mat.m[1][1]) * m_HalfSize.y + fabsf(mat.m[2][1]) * m_HalfSize.z;
 	e.z = fabsf(mat.m[0][2]) * m_HalfSize.x + fabsf(mat.m[1][2]) * m_HalfSize.y + fabsf(mat.m[2][2]) * m_HalfSize.z;
 
 	return { center - e, center + e }; // min: center - e, max: center + e
 }
+bool BoxCollision::Raycast(const ColliderPose& myTrans, const Vector3& origin, const Vector3& dir, float maxDist, RayHit& out) const
+{
+	// OBB のローカル軸ごとのスラブ
+	const OBBW obb = MakeOBB(myTrans, *this);
+	const float extent[3] = { obb.extent.x, obb.extent.y, obb.extent.z };
+	const Vector3 d = origin - obb.center;
+
+	float tEnter = 0.0f, tExit = maxDist;
+	int enterAxis = -1;
+	float enterSign = 0.0f;
+	for (int k = 0; k < 3; k++)
+	{
+		const float p = Vector3::Dot(obb.axis[k], d);
+		const float f = Vector3::Dot(obb.axis[k], dir);
+		if (fabsf(f) < 1e-8f) // 平行
+		{
+			if (fabsf(p) > extent[k]) return false;
+			continue;
+		}
+		float tNear = (-extent[k] - p) / f;
+		float tFar	= ( extent[k] - p) / f;
+		float sign = -1.0f; // 負の面から入る
+		if (tNear > tFar) { std::swap(tNear, tFar); sign = 1.0f; }
+		if (tNear > tEnter) { tEnter = tNear; enterAxis = k; enterSign = sign; }
+		if (tFar < tExit) tExit = tFar;
+		if (tEnter > tExit) return false;
+	}
+	if (enterAxis < 0) return false; // 始点が内側
+
+	out.distance = tEnter;
+	out.point	 = origin + dir * tEnter;
+	out.normal	 = obb.axis[enterAxis] * enterSign;
+	return true;
+}
 bool BoxCollision::isOverlap(const ColliderPose& myTrans, const Collision& collisionB, const ColliderPose& transB, ContactManifold& out, float slop) const
 {
 	return collisionB.isOverlapWithBox(transB, *this, myTrans, out, slop);
 }
 // --------------------------------------------------
-// BOX ~ BOX iSATj
+// BOX × BOX （SAT方式）
 // --------------------------------------------------
 bool BoxCollision::isOverlapWithBox(const ColliderPose& myTrans, const BoxCollision& box, const ColliderPose& transBox, ContactManifold& out, float slop) const
 {
-	// ----- OBB \z -----@i_ufBXpb`̕QłABtɐj
+	// ----- OBB 構築 -----　（ダブルディスパッチの弊害でここはAとB逆に生成する）
 	OBBW B = MakeOBB(myTrans, *this);
 	OBBW A = MakeOBB(transBox, box);
 
-	// ----- SATiŏѓ(depth)Ƃ̏𓾂j -----
+	// ----- SAT（最小貫入(depth)とその勝ち軸を得る） -----
 	AxisChoice ch;
-	if (!SAT_AllAxes(A, B, ch)) { out.touching = false; out.count = 0; return false; } // ĂȂI
+	if (!SAT_AllAxes(A, B, ch)) { out.touching = false; out.count = 0; return false; } // 当たっていなかったら終わり
 
-	// ------ X[vlĐڐG𔻒 ------
-	// depth >= -slop ȂڐG
+	// ------ スロープを考慮して接触を判定 ------
+	// depth >= -slop なら接触扱い
 	const bool touching = (ch.depth >= -slop);
 	out.touching = touching;
 	if (!touching) { out.count = 0; return false; }
 
-	// ڐG@iSAT őI΂ꂽj
-	out.normal = ch.n; // A  B
+	// 接触法線（SAT で選ばれた軸）
+	out.normal = ch.n; // A → B
 
-	// ----- manifold ̍\z -----
+	// ----- manifold の構築 -----
 	out.count = 0;
 
 	if (ch.kind == AxisKind::FaceA || ch.kind == AxisKind::FaceB)
 	{
 		// face-face
-		const bool refIsA = (ch.kind == AxisKind::FaceA); // ReferenceBox ̔
-		const OBBW& Ref = refIsA ? A : B; // ReferenceBox ̐ݒ
-		const OBBW& Inc = refIsA ? B : A; // IncidenceBox ̐ݒ
+		const bool refIsA = (ch.kind == AxisKind::FaceA); // ReferenceBox の判定
+		const OBBW& Ref = refIsA ? A : B; // ReferenceBox の設定
+		const OBBW& Inc = refIsA ? B : A; // IncidenceBox の設定
 		const int refAxis = refIsA ? ch.ia : ch.ib;
 
-		// QƖʖ@́uQƁv֌Kv
-		// out.normal  ABBQƂB̂Ƃ͔] BA ɂ
+		// 参照面法線は「参照→相手」へ向ける必要がある
+		// out.normal は A→B。参照がBのときは反転して B→A にする
 		//const Vector3 refN = refIsA ? out.normal : -out.normal;
 		const Vector3 refN = refIsA ? out.normal : -out.normal; 
 
-		// QƖʂ̎lp`i͎gĂȂ̂ŕujifobO`Ɏg݂j
+		// 参照面の四角形（今は使ってないので放置）（デバッグ描画に使えるみたい）
 		//std::vector<Vector3> refQuad;
 		//BuildRefFaceQuad(Ref, refAxis, refQuad);
 
-		// ----- OBBAQƖ@ɍłsȖʂIԁîS_j-----
-		const int incFace = PickIncidenceFace(Inc, refN); // incFace ̌
-		const int sign = (Vector3::Dot(Inc.axis[incFace], refN) > 0.0f) ? -1.0f : 1.0f; // refNɔsɂȂ悤ȕ
+		// ----- 入射OBB側から、参照法線に最も反平行な面を選ぶ（その４頂点）-----
+		const int incFace = PickIncidenceFace(Inc, refN); // incFace の候補
+		const int sign = (Vector3::Dot(Inc.axis[incFace], refN) > 0.0f) ? -1.0f : 1.0f; // refNに反平行になるような符号
 
-		// ˖ʂ̂Sςđp`ɂ
+		// 入射面の４済を作って多角形にする
 		std::vector<Vector3> poly; poly.reserve(4);
 		{
-			// Incidence face ̂S
-			const int u = (incFace == 0 ? 1 : 0); // ˖ʂ̂Q{̃GbWiincFace ȊÔQj
+			// Incidence face の４隅を作る
+			const int u = (incFace == 0 ? 1 : 0); // 入射面の２本のエッジ方向（incFace 軸以外の２軸）
 			const int v = (incFace == 2 ? 1 : 2);
 			
-			// n Ɣsȁu̖ʁv̕ʏ̒S_ 
-			const Vector3 c  = Inc.center + Inc.axis[incFace] * Inc.extent[incFace] * sign; // Αʁin ɔsj
+			// n と反平行な「裏側の面」の平面上の中心点 
+			const Vector3 c  = Inc.center + Inc.axis[incFace] * Inc.extent[incFace] * sign; // 反対側面（n に反平行）
 			const Vector3 U  = Inc.axis[u], V = Inc.axis[v];
 			const float   eu = Inc.extent[u], ev = Inc.extent[v];
-			poly.push_back(c + U * eu + V * ev); // E
-			poly.push_back(c - U * eu + V * ev); // 
-			poly.push_back(c - U * eu - V * ev); // 
-			poly.push_back(c + U * eu - V * ev); // E
+			poly.push_back(c + U * eu + V * ev); // 右上
+			poly.push_back(c - U * eu + V * ev); // 左上
+			poly.push_back(c - U * eu - V * ev); // 左下
+			poly.push_back(c + U * eu - V * ev); // 右下
 		}
 
-		// ----- QƖʂ̂S́gʕʁhœ˖ʃ|SNbv -----
+		// ----- 参照面の４つの“側面平面”で入射面ポリゴンをクリップ -----
 		std::vector<Vector3> poly1 = poly;
-		auto clipAgainstSidePlane = [&](const Vector3& pn, float pd) // pn : ʂ̖@xNg, pd : _̃ItZbgiʏ̔Cӂ̓_j
+		auto clipAgainstSidePlane = [&](const Vector3& pn, float pd) // pn : 平面の法線ベクトル, pd : 原点からのオフセット（平面上の任意の点）
 			{
 				poly1 = ClipPolygonAgainstPlane(poly1, pn, pd);
 			};
 
-		// QƖʏ̒S_i\j
-		const int u = (refAxis == 0 ? 1 : 0); // refAxis ȊÔQ
+		// 参照面上の中心点（表側）
+		const int u = (refAxis == 0 ? 1 : 0); // refAxis 以外の２軸
 		const int v = (refAxis == 2 ? 1 : 2);
-		const Vector3 p0 = Ref.center + refN * Ref.extent[refAxis]; // QƖʏ̒S_
+		const Vector3 p0 = Ref.center + refN * Ref.extent[refAxis]; // 参照面上の中心点
 
-		// E								// ʂ[ĥǂɂ邩߂Ă
+		// 左右								// 側面がワールド上のどこにあるか求めている
 		clipAgainstSidePlane( Ref.axis[u],  Vector3::Dot(Ref.axis[u], p0) + Ref.extent[u]);
 		clipAgainstSidePlane(-Ref.axis[u], -Vector3::Dot(Ref.axis[u], p0) + Ref.extent[u]);
-		// ㉺
+		// 上下
 		clipAgainstSidePlane( Ref.axis[v],  Vector3::Dot(Ref.axis[v], p0) + Ref.extent[v]);
 		clipAgainstSidePlane(-Ref.axis[v], -Vector3::Dot(Ref.axis[v], p0) + Ref.extent[v]);
 
-		// c_iڐG_j manifold 
+		// 残った頂点（接触点候補）のうち、めり込んでいるもの
+		constexpr int MaxCandidates = 8; // 四角形を４平面で切るので多くても８点
+		Vector3 candidates[MaxCandidates];
+		float	candidatePens[MaxCandidates];
+		int		candidateCount = 0;
 		for (const Vector3& q : poly1)
 		{
-			if (out.count >= ContactManifold::MAX_POINTS) break; // S܂Łi݂͑̏j
+			// 参照面への有向距離：dot(refN, q - p0)（表側が＋）
+			// penetration は参照面への signed 距離の -値を使う（>=0 が重なり）
+			const float signedDist = Vector3::Dot(q - p0, refN); // 参照面表側が＋なので <= 0 ならめり込んでいる
+			const float pen = -signedDist;					// pen > 0 ならめり込んでいる
+			if (pen < -slop) continue; // slop よりも小さい = めり込んでいない
+			if (candidateCount >= MaxCandidates) break;
+			candidates[candidateCount] = q;
+			candidatePens[candidateCount] = pen;
+			candidateCount++;
+		}
 
-			// QƖʂւ̗LFdot(refN, q - p0)i\{j
-			// penetration ͎QƖʂւ signed  -lgi>=0 dȂj
-			const float signedDist = Vector3::Dot(q - p0, refN); // QƖʕ\{Ȃ̂ <= 0 Ȃ߂荞ł
-			const float pen = -signedDist;					// pen > 0 Ȃ߂荞ł
-			if (pen < -slop) continue; // slop  = ߂荞łȂ
+		// manifold へ（上限４つまで、多ければ面積が広くなるものを選ぶ）
+		int selected[ContactManifold::MAX_POINTS];
+		const int selectedCount = SelectManifoldPoints(candidates, candidatePens, candidateCount, refN, selected);
+		for (int k = 0; k < selectedCount; k++)
+		{
+			const Vector3& q = candidates[selected[k]];
+			const float pen = candidatePens[selected[k]];
+			const float signedDist = -pen;
 
-			// A/B ꂼ́g̖ʏh̓_
+			// A/B それぞれの“自分の面上”の点を作る
 			if (ch.kind == AxisKind::FaceA)
 			{
 				out.points[out.count].pointOnB = q;
-				out.points[out.count].pointOnA = q - refN * signedDist; // A QƖʏ
+				out.points[out.count].pointOnA = q - refN * signedDist; // A 参照面上
 			}
 			else
 			{
 				out.points[out.count].pointOnA = q;
-				out.points[out.count].pointOnB = q + refN * signedDist; // B QƖʏ 
+				out.points[out.count].pointOnB = q + refN * signedDist; // B 参照面上 
 			}
 			out.points[out.count].penetration = pen;
 			out.count++;
 		}
 
-		// NbvőSłꍇ̕یil덷΍j
+		// クリップで全滅した場合の保険（数値誤差対策）
 		if (out.count == 0)
 		{
 			out.count = 1;
@@ -335,12 +880,12 @@ bool BoxCollision::isOverlapWithBox(const ColliderPose& myTrans, const BoxCollis
 	} // if (ch.kind == AxisKind::FaceA || ch.kind == AxisKind::FaceB)
 	else
 	{
-		// Edge-Edgeił͂Ȃy߂̂́j
+		// Edge-Edge（厳密ではなく軽めのもの）
 		const int ia = ch.ia, ib = ch.ib;
-		// \GbW̒SieOBB̊YȊO̓e 0 ̒SOKj
-		const Vector3 Pa0 = A.center; // \S
+		// 代表エッジの中心（各OBBの該当軸以外の投影は 0 の中心線でOK）
+		const Vector3 Pa0 = A.center; // 代表線分中心
 		const Vector3 Qa0 = B.center;
-		const Vector3 ua = A.axis[ia]; const float la = A.extent[ia]; // 
+		const Vector3 ua = A.axis[ia]; const float la = A.extent[ia]; // 方向＆半長
 		const Vector3 ub = B.axis[ib]; const float lb = B.extent[ib];
 
 		Vector3 pA, pB;
@@ -349,34 +894,34 @@ bool BoxCollision::isOverlapWithBox(const ColliderPose& myTrans, const BoxCollis
 		out.count = 1;
 		out.points[0].pointOnA = pA;
 		out.points[0].pointOnB = pB;
-		out.points[0].penetration = ch.depth; // SAT ̍ŏѓ̂܂܂
+		out.points[0].penetration = ch.depth; // SAT の最小貫入をそのままつかう
 	}
 
-	return true; // SĂ̔ʂ̂ true
+	return true; // 全ての判定を通ったので true
 }
 // --------------------------------------------------
-// BOX ~ SPHERE iŋߐړ_j
+// BOX × SPHERE （最近接点方式）
 // --------------------------------------------------
 bool BoxCollision::isOverlapWithSphere(const ColliderPose& myTrans, const SphereCollision& sphere, const ColliderPose& transSph, ContactManifold& out, float slop) const
 {
-	// ----- OBB̐E擾 -----
+	// ----- OBBの世界軸を取得 -----
 	const Vector3 aX = myTrans.WorldRight();
 	const Vector3 aY = myTrans.WorldUp();
 	const Vector3 aZ = myTrans.WorldForward();
 
-	// ----- GNXegiXP[fj -----
+	// ----- 半エクステント（スケール反映） -----
 	Vector3 extent = {
 		fabsf(myTrans.scale.x) * m_HalfSize.x,
 		fabsf(myTrans.scale.y) * m_HalfSize.y,
 		fabsf(myTrans.scale.z) * m_HalfSize.z,
 	};
 
-	// ----- ̒SƔa擾 -----
+	// ----- 球の中心と半径取得 -----
 	const Vector3 centerSph = transSph.position;
 	const Vector3 centerBox = myTrans.position;
-	const float   radius = sphere.Radius() * fabsf(transSph.scale.x); // U scale.x ŃXP[O
+	const float   radius = sphere.Radius() * fabsf(transSph.scale.x); // 一旦 scale.x でスケーリング
 
-	// ----- SSւ̃xNg𔠂̎ɓe -----
+	// ----- 箱中心→球中心へのベクトルを箱の軸に投影 -----
 	const Vector3 vect = centerSph - centerBox;
 	const Vector3 dist = {
 		Vector3::Dot(vect, aX),
@@ -384,7 +929,7 @@ bool BoxCollision::isOverlapWithSphere(const ColliderPose& myTrans, const Sphere
 		Vector3::Dot(vect, aZ)
 	};
 
-	// ----- ŋߐړ_̃[JWiClampj-----
+	// ----- 最近接点のローカル座標（Clamp）-----
 	auto Clamp = [](float a, float min, float max)
 		{
 			float result = a;
@@ -396,41 +941,41 @@ bool BoxCollision::isOverlapWithSphere(const ColliderPose& myTrans, const Sphere
 	float qy = Clamp(dist.y, -extent.y, extent.y);
 	float qz = Clamp(dist.z, -extent.z, extent.z);
 
-	// ----- [hŋߐړ_ -----
-	Vector3 qWorld = centerBox + aX * qx + aY * qy + aZ * qz; // ڐG_̌vZ
+	// ----- ワールド最近接点 -----
+	Vector3 qWorld = centerBox + aX * qx + aY * qy + aZ * qz; // 接触点の計算
 
-	// ----- S@@ŋߐړ_xNg ------
+	// ----- 球中心　→　最近接点ベクトル ------
 	const Vector3 vectSphToPoint = centerSph - qWorld;
 	const float distSphToPointSq = vectSphToPoint.lengthSq(); 
 
-	// ̓ɂP[X΍
+	// 球が箱の内部にある特殊ケース対策
 	Vector3 n;
 	float pen;
-	if (distSphToPointSq > 1e-12f) // ̊Oɂ
+	if (distSphToPointSq > 1e-12f) // 球が箱の外にいる
 	{
 		const float dist = sqrtf(distSphToPointSq);
-		n = vectSphToPoint / dist; // ڐG_@iBox  Spherej
-		pen = radius - dist; // ȂdȂĂ
+		n = vectSphToPoint / dist; // 接触点→球　方向（Box → Sphere）
+		pen = radius - dist; // 正なら重なっている
 	}
-	else // ̓
+	else // 球が箱の内部
 	{
-		// ŋߕʂI
+		// 最近平面を選ぶ
 		const float dx = extent.x - fabsf(dist.x);
 		const float dy = extent.y - fabsf(dist.y);
 		const float dz = extent.z - fabsf(dist.z);
-		if		(dx <= dy && dx <= dz) { n = (dist.x >= 0 ? aX : -aX); qx = (dist.x >= 0 ? extent.x : -extent.x); } // ԋ߂̖ʂ̕ normal ɂ
+		if		(dx <= dy && dx <= dz) { n = (dist.x >= 0 ? aX : -aX); qx = (dist.x >= 0 ? extent.x : -extent.x); } // 一番近くの面の方向を normal にする
 		else if (dy <= dz)			   { n = (dist.y >= 0 ? aY : -aY); qy = (dist.y >= 0 ? extent.y : -extent.y); }
 		else						   { n = (dist.z >= 0 ? aZ : -aZ); qz = (dist.z >= 0 ? extent.z : -extent.z); }
 
-		qWorld = centerBox + aX * qx + aY * qy + aZ * qz; // ڐG_̍ČvZ
-		pen = radius + std::min(dx, std::min(dy, dz)); // ŏdȂĂ
+		qWorld = centerBox + aX * qx + aY * qy + aZ * qz; // 接触点の再計算
+		pen = radius + std::min(dx, std::min(dy, dz)); // 正で重なっている
 	}
-	// ڐGĂ邩̔
+	// 接触しているかの判定
 	const bool touching = (pen >= -slop);
 
-	// ----- ContactManifold ̏o -----
+	// ----- ContactManifold の出力 -----
 	out.touching = touching;
-	out.normal = -n; // Sphere  Box
+	out.normal = -n; // Sphere → Box
 	out.count = 1;
 	out.points[0].penetration = pen;
 	out.points[0].pointOnA = centerSph + out.normal * radius;
@@ -439,7 +984,7 @@ bool BoxCollision::isOverlapWithSphere(const ColliderPose& myTrans, const Sphere
 	return touching;
 }
 // --------------------------------------------------
-// BOX ~ CAPSULE
+// BOX × CAPSULE
 // --------------------------------------------------
 bool BoxCollision::isOverlapWithCapsule(const ColliderPose& myTrans, const CapsuleCollision& capsule, const ColliderPose& transCap, ContactManifold& out, float slop) const
 {
@@ -448,7 +993,7 @@ bool BoxCollision::isOverlapWithCapsule(const ColliderPose& myTrans, const Capsu
 	return b;
 }
 // --------------------------------------------------
-// BOX ~ HEIGHTMAP
+// BOX × HEIGHTMAP
 // --------------------------------------------------
 bool BoxCollision::isOverlapWithHeightMap(const ColliderPose& myTrans, const HeightMapCollision& map, const ColliderPose& transMap, ContactManifold& out, float slop) const
 {
@@ -456,6 +1001,24 @@ bool BoxCollision::isOverlapWithHeightMap(const ColliderPose& myTrans, const Hei
 	out.normal = -out.normal;
 	return b;
 }
+// --------------------------------------------------
+// BOX × TRIANGLEMESH
+// --------------------------------------------------
+bool BoxCollision::isOverlapWithTriangleMesh(const ColliderPose& myTrans, const TriangleMeshCollision& mesh, const ColliderPose& transMesh, ContactManifold& out, float slop) const
+{
+	bool b = mesh.isOverlapWithBox(transMesh, *this, myTrans, out, slop);
+	out.normal = -out.normal;
+	return b;
+}
+// --------------------------------------------------
+// BOX × CONVEXHULL
+// --------------------------------------------------
+bool BoxCollision::isOverlapWithConvexHull(const ColliderPose& myTrans, const ConvexHullCollision& hull, const ColliderPose& transHull, ContactManifold& out, float slop) const
+{
+	bool b = hull.isOverlapWithBox(transHull, *this, myTrans, out, slop);
+	out.normal = -out.normal;
+	return b;
+}
 
 // ==================================================
 // SphereCollision
@@ -468,33 +1031,45 @@ AABB SphereCollision::ComputeWorldAABB(const ColliderPose& trans) const
 	Vector3 d{ radius, radius, radius };
 	return { center - d, center + d }; // min: center - radius, max: center + radius
 }
+bool SphereCollision::Raycast(const ColliderPose& myTrans, const Vector3& origin, const Vector3& dir, float maxDist, RayHit& out) const
+{
+	const Vector3 center = myTrans.position;
+	const float radius = m_Radius * fabsf(myTrans.scale.x); // 当たり判定と同じくｘの値を使う
+	float t;
+	if (!RaySphere(origin, dir, center, radius, maxDist, t)) return false;
+
+	out.distance = t;
+	out.point	 = origin + dir * t;
+	out.normal	 = (out.point - center).normalized();
+	return true;
+}
 bool SphereCollision::isOverlap(const ColliderPose& myTrans, const Collision& collisionB, const ColliderPose& transB, ContactManifold& out, float slop) const
 {
 	return collisionB.isOverlapWithSphere(transB, *this, myTrans, out, slop);
 }
 // --------------------------------------------------
-// SPHERE ~ BOX
+// SPHERE × BOX
 // --------------------------------------------------
 bool SphereCollision::isOverlapWithBox(const ColliderPose& myTrans, const BoxCollision& box, const ColliderPose& transBox, ContactManifold& out, float slop) const
 {
-	// ----- OBB̐E擾 -----
+	// ----- OBBの世界軸を取得 -----
 	const Vector3 aX = transBox.WorldRight();
 	const Vector3 aY = transBox.WorldUp();
 	const Vector3 aZ = transBox.WorldForward();
 
-	// ----- GNXegiXP[fj -----
+	// ----- 半エクステント（スケール反映） -----
 	Vector3 extent = {
 		fabsf(transBox.scale.x) * box.HalfSize().x,
 		fabsf(transBox.scale.y) * box.HalfSize().y,
 		fabsf(transBox.scale.z) * box.HalfSize().z,
 	};
 
-	// ----- ̒SƔa擾 -----
+	// ----- 球の中心と半径取得 -----
 	const Vector3 centerSph = myTrans.position;
 	const Vector3 centerBox = transBox.position;
-	const float   radius = this->Radius() * fabsf(myTrans.scale.x); // U scale.x ŃXP[O
+	const float   radius = this->Radius() * fabsf(myTrans.scale.x); // 一旦 scale.x でスケーリング
 
-	// ----- SSւ̃xNg𔠂̎ɓe -----
+	// ----- 箱中心→球中心へのベクトルを箱の軸に投影 -----
 	const Vector3 vect = centerSph - centerBox;
 	const Vector3 dist = {
 		Vector3::Dot(vect, aX),
@@ -502,7 +1077,7 @@ bool SphereCollision::isOverlapWithBox(const ColliderPose& myTrans, const BoxCol
 		Vector3::Dot(vect, aZ)
 	};
 
-	// ----- ŋߐړ_̃[JWiClampj-----
+	// ----- 最近接点のローカル座標（Clamp）-----
 	auto Clamp = [](float a, float min, float max)
 		{
 			float result = a;
@@ -514,41 +1089,41 @@ bool SphereCollision::isOverlapWithBox(const ColliderPose& myTrans, const BoxCol
 	float qy = Clamp(dist.y, -extent.y, extent.y);
 	float qz = Clamp(dist.z, -extent.z, extent.z);
 
-	// ----- [hŋߐړ_ -----
-	Vector3 qWorld = centerBox + aX * qx + aY * qy + aZ * qz; // ڐG_̌vZ
+	// ----- ワールド最近接点 -----
+	Vector3 qWorld = centerBox + aX * qx + aY * qy + aZ * qz; // 接触点の計算
 
-	// ----- S@@ŋߐړ_xNg ------
+	// ----- 球中心　→　最近接点ベクトル ------
 	const Vector3 vectSphToPoint = centerSph - qWorld;
 	const float distSphToPointSq = vectSphToPoint.lengthSq();
 
-	// ̓ɂP[X΍
+	// 球が箱の内部にある特殊ケース対策
 	Vector3 n;
 	float pen;
-	if (distSphToPointSq > 1e-12f) // ̊Oɂ
+	if (distSphToPointSq > 1e-12f) // 球が箱の外にいる
 	{
 		const float dist = sqrtf(distSphToPointSq);
-		n = vectSphToPoint / dist; // ڐG_@iBox  Spherej
-		pen = radius - dist; // ȂdȂĂ
+		n = vectSphToPoint / dist; // 接触点→球　方向（Box → Sphere）
+		pen = radius - dist; // 正なら重なっている
 	}
-	else // ̓
+	else // 球が箱の内部
 	{
-		// ŋߕʂI
+		// 最近平面を選ぶ
 		const float dx = extent.x - fabsf(dist.x);
 		const float dy = extent.y - fabsf(dist.y);
 		const float dz = extent.z - fabsf(dist.z);
-		if (dx <= dy && dx <= dz) { n = (dist.x >= 0 ? aX : -aX); qx = (dist.x >= 0 ? extent.x : -extent.x); } // ԋ߂̖ʂ̕ normal ɂ
+		if (dx <= dy && dx <= dz) { n = (dist.x >= 0 ? aX : -aX); qx = (dist.x >= 0 ? extent.x : -extent.x); } // 一番近くの面の方向を normal にする
 		else if (dy <= dz) { n = (dist.y >= 0 ? aY : -aY); qy = (dist.y >= 0 ? extent.y : -extent.y); }
 		else { n = (dist.z >= 0 ? aZ : -aZ); qz = (dist.z >= 0 ? extent.z : -extent.z); }
 
-		qWorld = centerBox + aX * qx + aY * qy + aZ * qz; // ڐG_̍ČvZ
-		pen = radius + std::min(dx, std::min(dy, dz)); // ŏdȂĂ
+		qWorld = centerBox + aX * qx + aY * qy + aZ * qz; // 接触点の再計算
+		pen = radius + std::min(dx, std::min(dy, dz)); // 正で重なっている
 	}
-	// ڐGĂ邩̔
+	// 接触しているかの判定
 	const bool touching = (pen >= -slop);
 
-	// ----- ContactManifold ̏o -----
+	// ----- ContactManifold の出力 -----
 	out.touching = touching;
-	out.normal = n; // Sphere  Box
+	out.normal = n; // Sphere → Box
 	out.count = 1;
 	out.points[0].penetration = pen;
 	out.points[0].pointOnA = centerSph + out.normal * radius;
@@ -557,36 +1132,42 @@ bool SphereCollision::isOverlapWithBox(const ColliderPose& myTrans, const BoxCol
 	return touching;
 }
 // --------------------------------------------------
-// SPHERE ~ SPHERE
+// SPHERE × SPHERE
 // --------------------------------------------------
 bool SphereCollision::isOverlapWithSphere(const ColliderPose& myTrans, const SphereCollision& sphere, const ColliderPose& transSph, ContactManifold& out, float slop) const
 {
-	// S
-	Vector3 centerB = myTrans.position;
-	Vector3 centerA = transSph.position;
+	// 半径（スケール反映）
+	return OverlapSpheres(myTrans.position, m_Radius * myTrans.scale.x,		   // とりあえずｘの値を使う
+						  transSph.position, sphere.Radius() * transSph.scale.x, // とりあえずｘの値を使う
+						  out, slop);
+}
+bool SphereCollision::OverlapSpheres(const Vector3& myCenter, float myRadius, const Vector3& otherCenter, float otherRadius, ContactManifold& out, float slop)
+{
+	// 中心
+	Vector3 centerB = myCenter;
+	Vector3 centerA = otherCenter;
 
-	// iQj
-	Vector3 vect = centerB - centerA; // A  B
+	// 距離（２乗）
+	Vector3 vect = centerB - centerA; // A → B
 	float distSq = vect.lengthSq();
 
-	// aiXP[fj
-	float radiusA = m_Radius * myTrans.scale.x;			// Ƃ肠̒lg
-	float radiusB = sphere.Radius() * transSph.scale.x; // Ƃ肠̒lg
+	float radiusA = myRadius;
+	float radiusB = otherRadius;
 	float sum = radiusA + radiusB;
 
-	// ڐG
-	if (distSq > 1e-12f) // Q_Ԃ̋0ȏォmF
+	// 接触判定
+	if (distSq > 1e-12f) // ２点間の距離が0以上か確認
 	{
 		const float d = sqrtf(distSq);
-		out.normal = vect / d; // A  B
-		out.points[0].penetration = sum - d; // ѓ[xvZ
+		out.normal = vect / d; // A → B
+		out.points[0].penetration = sum - d; // 貫入深度計算
 	}
 	else
 	{
-		out.normal = { 1, 0, 0 }; // ޔ
+		out.normal = { 1, 0, 0 }; // 退避向き
 		out.points[0].penetration = sum;
 	}
-	out.touching = (out.points[0].penetration >= -slop); // ѓ[x  sum > d  ڐGĂ
+	out.touching = (out.points[0].penetration >= -slop); // 貫入深度が正 → sum > d → 接触している
 
 	out.points[0].pointOnA = centerA + out.normal * radiusA;
 	out.points[0].pointOnB = centerB - out.normal * radiusB;
@@ -595,7 +1176,7 @@ bool SphereCollision::isOverlapWithSphere(const ColliderPose& myTrans, const Sph
 	return out.touching;
 }
 // --------------------------------------------------
-// SPHERE ~ CAPSULEiƋ̂̍ŋߐړ_j
+// SPHERE × CAPSULE（線分と球体の最近接点）
 // --------------------------------------------------
 bool SphereCollision::isOverlapWithCapsule(const ColliderPose& myTrans, const CapsuleCollision& capsule, const ColliderPose& transCap, ContactManifold& out, float slop) const
 {
@@ -604,7 +1185,7 @@ bool SphereCollision::isOverlapWithCapsule(const ColliderPose& myTrans, const Ca
 	return b;
 }
 // --------------------------------------------------
-// SPHERE ~ HEIGHTMAP
+// SPHERE × HEIGHTMAP
 // --------------------------------------------------
 bool SphereCollision::isOverlapWithHeightMap(const ColliderPose& myTrans, const HeightMapCollision& map, const ColliderPose& transMap, ContactManifold& out, float slop) const
 {
@@ -612,6 +1193,24 @@ bool SphereCollision::isOverlapWithHeightMap(const ColliderPose& myTrans, const
 	out.normal = -out.normal;
 	return b;
 }
+// --------------------------------------------------
+// SPHERE × TRIANGLEMESH
+// --------------------------------------------------
+bool SphereCollision::isOverlapWithTriangleMesh(const ColliderPose& myTrans, const TriangleMeshCollision& mesh, const ColliderPose& transMesh, ContactManifold& out, float slop) const
+{
+	bool b = mesh.isOverlapWithSphere(transMesh, *this, myTrans, out, slop);
+	out.normal = -out.normal;
+	return b;
+}
+// --------------------------------------------------
+// SPHERE × CONVEXHULL
+// --------------------------------------------------
+bool SphereCollision::isOverlapWithConvexHull(const ColliderPose& myTrans, const ConvexHullCollision& hull, const ColliderPose& transHull, ContactManifold& out, float slop) const
+{
+	bool b = hull.isOverlapWithSphere(transHull, *this, myTrans, out, slop);
+	out.normal = -out.normal;
+	return b;
+}
 
 // ==================================================
 // CapsuleCollision
@@ -619,15 +1218,15 @@ bool SphereCollision::isOverlapWithHeightMap(const ColliderPose& myTrans, const
 AABB CapsuleCollision::ComputeWorldAABB(const ColliderPose& trans) const
 {
 	Vector3 center = trans.position;
-	Vector3 up     = trans.WorldUp(); // ̓[hxNgH
+	Vector3 up     = trans.WorldUp(); // ここはワールド上ベクトル？
 	Vector3 scale  = trans.scale;
 
-	// [hԂł̗̐[
+	// ワールド空間での線分の両端
 	float halfCylinder = (m_CylinderHeight * scale.y) * 0.5f;
 	Vector3 top    = center + up * halfCylinder;
 	Vector3 bottom = center - up * halfCylinder;
 
-	// ̐ AABB
+	// この線分の AABB
 	Vector3 minP(
 				 std::min(top.x, bottom.x),
 				 std::min(top.y, bottom.y),
@@ -639,27 +1238,78 @@ AABB CapsuleCollision::ComputeWorldAABB(const ColliderPose& trans) const
 				 std::max(top.z, bottom.z)
 				);
 
-	// aSɖc܂
+	// 半径分だけ全方向に膨らませる
 	float radiusScale = std::max(scale.x, scale.z);
 	float worldRadius = m_Radius * radiusScale;
 	Vector3 e = Vector3(worldRadius, worldRadius, worldRadius);
 
 	return { minP - e , maxP + e };
 }
+bool CapsuleCollision::Raycast(const ColliderPose& myTrans, const Vector3& origin, const Vector3& dir, float maxDist, RayHit& out) const
+{
+	// 円柱部の両端と半径（当たり判定と同じスケールの取り方）
+	const Vector3 up = myTrans.WorldUp();
+	const float half   = m_CylinderHeight * fabsf(myTrans.scale.y) * 0.5f;
+	const float radius = m_Radius * std::max(fabsf(myTrans.scale.x), fabsf(myTrans.scale.z));
+	const Vector3 p0 = myTrans.position - up * half;
+	const Vector3 p1 = myTrans.position + up * half;
+
+	// 始点が内側なら当たり無し
+	const Vector3 m = origin - p0;
+	const float len = half * 2.0f;
+	const float sOrigin = Vector3::Clamp(Vector3::Dot(m, up), 0.0f, len);
+	if ((origin - (p0 + up * sOrigin)).lengthSq() <= radius * radius) return false;
+
+	float best = maxDist;
+	Vector3 bestCenter{}; // 法線を出すための軸上の点
+	bool hit = false;
+
+	// ----- 円柱部 -----
+	if (len > 1e-6f)
+	{
+		const Vector3 dPerp = dir - up * Vector3::Dot(dir, up);
+		const Vector3 mPerp = m	  - up * Vector3::Dot(m, up);
+		const float a = Vector3::Dot(dPerp, dPerp);
+		const float b = Vector3::Dot(mPerp, dPerp);
+		const float c = Vector3::Dot(mPerp, mPerp) - radius * radius;
+		const float disc = b * b - a * c;
+		if (a > 1e-12f && disc >= 0.0f)
+		{
+			const float t = (-b - sqrtf(disc)) / a;
+			const float s = Vector3::Dot(m + dir * t, up);
+			if (t >= 0.0f && t <= best && s >= 0.0f && s <= len)
+			{
+				best = t;
+				bestCenter = p0 + up * s;
+				hit = true;
+			}
+		}
+	}
+	// ----- 両端の球 -----
+	float t;
+	if (RaySphere(origin, dir, p0, radius, best, t)) { best = t; bestCenter = p0; hit = true; }
+	if (RaySphere(origin, dir, p1, radius, best, t)) { best = t; bestCenter = p1; hit = true; }
+	if (!hit) return false;
+
+	out.distance = best;
+	out.point	 = origin + dir * best;
+	out.normal	 = (out.point - bestCenter).normalized();
+	return true;
+}
 bool CapsuleCollision::isOverlap(const ColliderPose& myTrans, const Collision& collisionB, const ColliderPose& transB, ContactManifold& out, float slop) const
 {
 	return collisionB.isOverlapWithCapsule(transB, *this, myTrans, out, slop);
 }
 // --------------------------------------------------
-// CAPSULE ~ BOXiOBB̍ŋߐړ_j
+// CAPSULE × BOX（線分とOBBの最近接点）
 // --------------------------------------------------
 bool CapsuleCollision::isOverlapWithBox(const ColliderPose& myTrans, const BoxCollision& box, const ColliderPose& transBox, ContactManifold& out, float slop) const
 {
-	// SW
+	// 中心座標
 	Vector3 centerBox = transBox.position;
 	Vector3 centerCap = myTrans.position;
 
-	// OBB ̊
+	// OBB の基底
 	Vector3 boxRight   = transBox.WorldRight();
 	Vector3 boxUp	   = transBox.WorldUp();
 	Vector3 boxForward = transBox.WorldForward();
@@ -670,20 +1320,20 @@ bool CapsuleCollision::isOverlapWithBox(const ColliderPose& myTrans, const BoxCo
 		fabsf(transBox.scale.z) * box.HalfSize().z,
 	};
 
-	// JvZ̉~̗[W
+	// カプセルの円柱部の両端座標
 	float half = m_CylinderHeight * myTrans.scale.y / 2.0f;
 	Vector3 top    = centerCap + half * myTrans.WorldUp();
 	Vector3 bottom = centerCap - half * myTrans.WorldUp();
 
-	// O
+	// 高さ０回避
 	if ((top - bottom).lengthSq() < 1e-8f)
 	{
-		// ̂Ƃ݂Ȃ isOverlapWithSphere Ă
+		// 球体とみなして isOverlapWithSphere を呼ぶ
 		SphereCollision capsule(m_Radius);
 		return box.isOverlapWithSphere(transBox, capsule, myTrans, out, slop);
 	}
 
-	// JvZ̗̎[ Box ̃[JWɗƂ
+	// カプセルの軸の両端を Box のローカル座標に落とし込む
 	Vector3 topOnBoxLocal = {
 							 Vector3::Dot(boxRight  , top - centerBox),
 							 Vector3::Dot(boxUp     , top - centerBox),
@@ -695,9 +1345,9 @@ bool CapsuleCollision::isOverlapWithBox(const ColliderPose& myTrans, const BoxCo
 								Vector3::Dot(boxForward, bottom - centerBox)
 							   };
 	
-	// ŋߐړ_ɑΉ̌̓_
-	Vector3 axis = topOnBoxLocal - bottomOnBoxLocal; // bottom  top  
-	// p = bottomOnBoxLocal + t * axis Ap = +extent ɂȂ t ̒l 
+	// 最近接点に対応する線分上の候補の点
+	Vector3 axis = topOnBoxLocal - bottomOnBoxLocal; // bottom → top  
+	// p = bottomOnBoxLocal + t * axis より、p = +extent になる t の値 
 	auto ComputeT = [&](int index, int sign)
 		{
 			return  (sign * extent[index] - bottomOnBoxLocal[index]) / axis[index];
@@ -709,7 +1359,7 @@ bool CapsuleCollision::isOverlapWithBox(const ColliderPose& myTrans, const BoxCo
 	for (int i = 0; i < 6; i++)
 	{
 		int axisIndex = i / 2;
-		if (fabsf(axis[axisIndex]) < 1e-8f) continue; // ƕsȂ̂ŌȂ
+		if (fabsf(axis[axisIndex]) < 1e-8f) continue; // 軸と平行なので交差しない
 
 		int sign = (i % 2 == 0) ? 1 : -1;
 		float t = ComputeT(axisIndex, sign);
@@ -717,20 +1367,20 @@ bool CapsuleCollision::isOverlapWithBox(const ColliderPose& myTrans, const BoxCo
 			tList.push_back(t);
 	}
 
-	// ŋߐړ_TiOBB ̃[JWj
+	// 最近接点を探す（OBB のローカル座標）
 	float minDist = FLT_MAX;
 	Vector3 pointOnBox{};
 	Vector3 pointOnCapsule{};
 	float capsuleRadius = m_Radius * std::max(myTrans.scale.x, myTrans.scale.z);
-	for (int i = 0; i < tList.size(); i++)
+	for (int i = 0; i < static_cast<int>(tList.size()); i++)
 	{
-		Vector3 P = bottomOnBoxLocal + tList[i] * axis; // ̂_P
-		Vector3 Q = P; // box̍ŋߐړ_Q
+		Vector3 P = bottomOnBoxLocal + tList[i] * axis; // 線分上のある点P
+		Vector3 Q = P; // box上の最近接点Q
 		Q.x = Vector3::Clamp(P.x, -extent.x, extent.x);
 		Q.y = Vector3::Clamp(P.y, -extent.y, extent.y);
 		Q.z = Vector3::Clamp(P.z, -extent.z, extent.z);
 
-		// ŒZT
+		// 最短距離を探す
 		if (minDist > (P - Q).length())
 		{
 			minDist = (P - Q).length();
@@ -739,7 +1389,7 @@ bool CapsuleCollision::isOverlapWithBox(const ColliderPose& myTrans, const BoxCo
 		}
 	}
 
-	// [J烏[h
+	// ローカルからワールド
 	auto LocalToWorld = [&](const Vector3& local) -> Vector3
 		{
 			return centerBox 
@@ -750,10 +1400,10 @@ bool CapsuleCollision::isOverlapWithBox(const ColliderPose& myTrans, const BoxCo
 
 	Vector3 P_world = LocalToWorld(pointOnCapsule); // Capsule
 	Vector3 Q_world = LocalToWorld(pointOnBox);		// Box
-	Vector3 vect_world = P_world - Q_world; // Box  Capsule
+	Vector3 vect_world = P_world - Q_world; // Box → Capsule
 	float dist = vect_world.length();
 
-	// ̔r
+	// 距離の比較
 	float penetration = capsuleRadius - dist;
 	if (penetration <= -slop)
 	{
@@ -767,61 +1417,61 @@ bool CapsuleCollision::isOverlapWithBox(const ColliderPose& myTrans, const BoxCo
 		out.normal = vect_world / dist;
 		out.points[0].penetration = penetration;
 	}
-	else // dist قڂÔƂ
+	else // dist がほぼ０のとき
 	{
 		Vector3 fallback = centerCap - centerBox;
 		if (fallback.lengthSq() < 1e-8f) fallback = { 1, 0, 0 };
-		out.normal = fallback.normalized(); // ޔ
+		out.normal = fallback.normalized(); // 退避向き
 		out.points[0].penetration = penetration;
 	}
 	out.touching = true;
 
 	out.points[0].pointOnA = Q_world; // Box
-	out.points[0].pointOnB = P_world - out.normal * capsuleRadius; // Capsule i甼a񂹂Wj
+	out.points[0].pointOnB = P_world - out.normal * capsuleRadius; // Capsule （軸から半径分寄せた座標）
 	out.count = 1;
 
 	return out.touching;
 }
 // --------------------------------------------------
-// CAPSULE ~ SPHEREiƋ̂̍ŋߐړ_j
+// CAPSULE × SPHERE（線分と球体の最近接点）
 // --------------------------------------------------
 bool CapsuleCollision::isOverlapWithSphere(const ColliderPose& myTrans, const SphereCollision& sphere, const ColliderPose& transSph, ContactManifold& out, float slop) const
 {
-	// SW
+	// 中心座標
 	Vector3 centerCapsule = myTrans.position;
 	Vector3 centerSphere  = transSph.position;
 
-	// JvZ̉~̗[W
+	// カプセルの円柱部の両端座標
 	float half = m_CylinderHeight * myTrans.scale.y / 2.0f;
 	Vector3 top = centerCapsule + half * myTrans.WorldUp();
 	Vector3 bottom = centerCapsule - half * myTrans.WorldUp();
-	// Zo
+	// 軸方向算出
 	Vector3 axis = top - bottom;
-	if (axis.lengthSq() < 1e-8f) // ̈
+	if (axis.lengthSq() < 1e-8f) // 球体扱い
 	{
-		// ̂Ƃ݂Ȃ isOverlapWithSphere Ă
+		// 球体とみなして isOverlapWithSphere を呼ぶ
 		SphereCollision capsule(m_Radius);
 		return sphere.isOverlapWithSphere(transSph, capsule, myTrans, out, slop);
 	}
 
-	// ŋߐړ_Zo
+	// 最近接点算出
 	Vector3 vectBottomToSphere = centerSphere - bottom;
 	float t = Vector3::Dot(vectBottomToSphere, axis) / Vector3::Dot(axis, axis);
 	t = Vector3::Clamp(t, 0, 1);
 
-	// ڐG_
+	// 接触点
 	Vector3 point = bottom + t * axis;
 
-	// 
-	Vector3 vect = centerSphere - point; // Capsule  Sphere
+	// 距離
+	Vector3 vect = centerSphere - point; // Capsule → Sphere
 	float distSq = vect.lengthSq();
 
-	// a
+	// 半径
 	float radiusCapsule = m_Radius * std::max(myTrans.scale.x, myTrans.scale.z);
 	float radiusSphere  = sphere.Radius() * transSph.scale.x;
 	float sum = radiusCapsule + radiusSphere;
 
-	// Փ˔
+	// 衝突判定
 	if (distSq > 1e-12f)
 	{
 		const float d = sqrt(distSq);
@@ -830,7 +1480,7 @@ bool CapsuleCollision::isOverlapWithSphere(const ColliderPose& myTrans, const Sp
 	}
 	else
 	{
-		out.normal = { 1, 0, 0 }; // ޔ
+		out.normal = { 1, 0, 0 }; // 退避向き
 		out.points[0].penetration = sum;
 	}
 	out.touching = (out.points[0].penetration >= -slop);
@@ -842,7 +1492,7 @@ bool CapsuleCollision::isOverlapWithSphere(const ColliderPose& myTrans, const Sp
 	return out.touching;
 }
 // --------------------------------------------------
-// CAPSULE ~ CAPSULEiƐ̍ŋߐړ_j
+// CAPSULE × CAPSULE（線分と線分の最近接点）
 // --------------------------------------------------
 bool CapsuleCollision::isOverlapWithCapsule(const ColliderPose& myTrans, const CapsuleCollision& capsule, const ColliderPose& transCap, ContactManifold& out, float slop) const
 {
@@ -852,19 +1502,19 @@ bool CapsuleCollision::isOverlapWithCapsule(const ColliderPose& myTrans, const C
 	float radiusA = capsule.Radius() * std::max(transCap.scale.x, transCap.scale.z);
 	float radiusB = m_Radius		 * std::max(myTrans.scale.x, myTrans.scale.z);
 
-	// JvZ̉~̗[W
+	// カプセルの円柱部の両端座標
 	float halfA		= capsule.CylinderHeight() * transCap.scale.y / 2.0f;
 	Vector3 topA	= centerA + halfA * transCap.WorldUp();
 	Vector3 bottomA = centerA - halfA * transCap.WorldUp();
 	float halfB		= m_CylinderHeight * myTrans.scale.y / 2.0f;
 	Vector3 topB	= centerB + halfB * myTrans.WorldUp();
 	Vector3 bottomB = centerB - halfB * myTrans.WorldUp();
-	// Zo
+	// 軸方向算出
 	Vector3 axisA = topA - bottomA;
 	Vector3 axisB = topB - bottomB;
 
-	// O̎̏
-	if (axisA.lengthSq() < 1e-8f && axisB.lengthSq() < 1e-8f) // ǂ̈
+	// 高さ０の時の処理
+	if (axisA.lengthSq() < 1e-8f && axisB.lengthSq() < 1e-8f) // どっちも球体扱い
 	{
 		SphereCollision capsuleA(capsule.Radius());
 		SphereCollision capsuleB(m_Radius);
@@ -881,42 +1531,42 @@ bool CapsuleCollision::isOverlapWithCapsule(const ColliderPose& myTrans, const C
 		return capsule.isOverlapWithSphere(transCap, capsuleB, myTrans, out, slop);
 	}
 
-	// ----- l -----
+	// ----- 考え方 -----
 	/*
 		P(s) = bottomA + s * axisA
 		Q(t) = bottomB + t * axisB
-		D(s, t) = |P(s) - Q(t)|ŏɂȂ悤 s, t ߂
+		D(s, t) = |P(s) - Q(t)|が最小になるような s, t を求める
 		(D(s, t))^2 = |P(s) - Q(t)|^2 = | bottomA - bottomB + s*axisA - t*axisB|^2
-		(D(s, t))^2 = | AB + s*axisA - t*axisB|^2 ƂŕΔĂOɂȂ邓Ƃŏ̂ƂɂȂ
-		sŕΔF2axisAE(AB + s*axisA - t*axisB) = 0  axisAE(AB + s*axisA - taxisB) = 0  s*(axisAEaxisA) - t*(axisBEaxisA) + ABEaxisA = 0
-		tŕΔF2axisBE(AB + s*axisA - t*axisB) = 0  axisBE(AB + s*axisA - taxisB) = 0  s*(axisAEaxisB) - t*(axisBEaxisB) + ABEaxisB = 0
-		L̂Q炓A߂iȉϐɒuj
-		as - bt + d = 0 ˍsŏ [a - b ][s] = [-d]
+		(D(s, t))^2 = | AB + s*axisA - t*axisB|^2 をｓとｔで偏微分すして０になるｓとｔが最小のｓとｔになる
+		sで偏微分：2axisA・(AB + s*axisA - t*axisB) = 0 ⇒ axisA・(AB + s*axisA - taxisB) = 0 ⇒ s*(axisA・axisA) - t*(axisB・axisA) + AB・axisA = 0
+		tで偏微分：2axisB・(AB + s*axisA - t*axisB) = 0 ⇒ axisB・(AB + s*axisA - taxisB) = 0 ⇒ s*(axisA・axisB) - t*(axisB・axisB) + AB・axisB = 0
+		上記の２式からｓ、ｔを求める（以下変数に置き換える）
+		as - bt + d = 0 ⇒行列で書くと [a - b ][s] = [-d]
 		bs - ct + e = 0				   [b - c ][t] = [-e]
-		L̍s̍s񎮁F = ac - b^2
-		0 ȂQ͕sł͂Ȃ̂ŕʂɉB
+		上記の行列の行列式：Δ = ac - b^2
+		Δ≠0 なら２直線は平行ではないので普通に解ける。
 	*/
 
-	// KvȓςZo
+	// 必要な内積を算出
 	// bottomA - bottomB
 	Vector3 AB = bottomA - bottomB;
-	float a = Vector3::Dot(axisA, axisA); // axisA ̒̂Q
-	float b = Vector3::Dot(axisA, axisB); // axisA  axisB ̓
-	float c = Vector3::Dot(axisB, axisB); // axisB ̒̂Q
-	float d = Vector3::Dot(axisA, AB);	  // axisA  AB ̓
-	float e = Vector3::Dot(axisB, AB);	  // axisB  AB ̓
+	float a = Vector3::Dot(axisA, axisA); // axisA の長さの２乗
+	float b = Vector3::Dot(axisA, axisB); // axisA と axisB の内積
+	float c = Vector3::Dot(axisB, axisB); // axisB の長さの２乗
+	float d = Vector3::Dot(axisA, AB);	  // axisA と AB の内積
+	float e = Vector3::Dot(axisB, AB);	  // axisB と AB の内積
 
 	float delta = a * c - b * b;
-	if (fabsf(delta) > 1e-8f) // 񕽍sȂ̂ŘA
+	if (fabsf(delta) > 1e-8f) // 非平行なので連立方程式を解く
 	{
 		float s = (b * e - c * d) / delta;
 		float t = (a * e - b * d) / delta;
 
-		if (s > 0 && s < 1 && t > 0 && t < 1) // 0<s<1 && 0<t<1 𖞂̂ŁAs, t ̂܂܎g
+		if (s > 0 && s < 1 && t > 0 && t < 1) // 0<s<1 && 0<t<1 を満たすので、s, t をそのまま使う
 		{
 			Vector3 pointOnAxisA = bottomA + axisA * s;
 			Vector3 pointOnAxisB = bottomB + axisB * t;
-			Vector3 vect = pointOnAxisB - pointOnAxisA; // A  B
+			Vector3 vect = pointOnAxisB - pointOnAxisA; // A → B
 			float distSq = vect.lengthSq();
 
 			if (distSq > 1e-8f) 
@@ -928,7 +1578,7 @@ bool CapsuleCollision::isOverlapWithCapsule(const ColliderPose& myTrans, const C
 			}
 			else
 			{
-				out.normal = { 1, 0, 0 }; // ޔ
+				out.normal = { 1, 0, 0 }; // 退避向き
 				out.points[0].penetration = radiusA + radiusB;
 			}
 			out.touching = (out.points[0].penetration >= -slop);
@@ -938,8 +1588,8 @@ bool CapsuleCollision::isOverlapWithCapsule(const ColliderPose& myTrans, const C
 			return out.touching;
 		}
 	}
-	// s,t͈͊O܂͕sȂƂ̏
-	// s = 0, 1 ܂ t = 0, 1 ̂Ƃ
+	// s,tが範囲外または平行なときの処理
+	// s = 0, 1 または t = 0, 1 のとき
 	float tList[4]{};
 	float sList[4]{};
 	tList[0] = 0;
@@ -950,22 +1600,22 @@ bool CapsuleCollision::isOverlapWithCapsule(const ColliderPose& myTrans, const C
 	sList[1] = -Vector3::Dot(axisA, AB - axisB) / a; // t = 1
 	sList[2] = 0;
 	sList[3] = 1;
-	// Nv
+	// クランプ処理
 	tList[2] = Vector3::Clamp(tList[2], 0, 1);
 	tList[3] = Vector3::Clamp(tList[3], 0, 1);
 	sList[0] = Vector3::Clamp(sList[0], 0, 1);
 	sList[1] = Vector3::Clamp(sList[1], 0, 1);
 
-	// ŋߐړ_T
+	// 最近接点を探す
 	float minDist = FLT_MAX;
 	Vector3 pointOnAxisA{};
 	Vector3 pointOnAxisB{};
-	for (int i = 0; i < 4; i++) // [_ vs _
+	for (int i = 0; i < 4; i++) // 端点 vs 中点
 	{
 		Vector3 P = bottomA + axisA * sList[i];
 		Vector3 Q = bottomB + axisB * tList[i];
 
-		// ŒZT
+		// 最短距離を探す
 		if (minDist > (P - Q).length())
 		{
 			minDist = (P - Q).length();
@@ -973,13 +1623,13 @@ bool CapsuleCollision::isOverlapWithCapsule(const ColliderPose& myTrans, const C
 			pointOnAxisB = Q;
 		}
 	}
-	for (int i = 0; i < 4; i++) // [_ vs [_
+	for (int i = 0; i < 4; i++) // 端点 vs 端点
 	{
 		int index = i % 2;
 		Vector3 P = bottomA + axisA * sList[2 + (i / 2)];// 2, 2, 3, 3
 		Vector3 Q = bottomB + axisB * tList[index]; // 0, 1, 0,1 
 
-		// ŒZT
+		// 最短距離を探す
 		if (minDist > (P - Q).length())
 		{
 			minDist = (P - Q).length();
@@ -988,7 +1638,7 @@ bool CapsuleCollision::isOverlapWithCapsule(const ColliderPose& myTrans, const C
 		}
 	}
 
-	Vector3 vect = pointOnAxisB - pointOnAxisA; // A  B
+	Vector3 vect = pointOnAxisB - pointOnAxisA; // A → B
 	float distSq = vect.lengthSq();
 
 	if (fabsf(distSq) > 1e-8f)
@@ -999,7 +1649,7 @@ bool CapsuleCollision::isOverlapWithCapsule(const ColliderPose& myTrans, const C
 	}
 	else
 	{
-		out.normal = { 1, 0, 0 }; // ޔ
+		out.normal = { 1, 0, 0 }; // 退避向き
 		out.points[0].penetration = radiusA + radiusB;
 	}
 	out.touching = (out.points[0].penetration >= -slop);
@@ -1011,7 +1661,7 @@ bool CapsuleCollision::isOverlapWithCapsule(const ColliderPose& myTrans, const C
 	return out.touching;
 }
 // --------------------------------------------------
-// CAPSULE ~ HEIGHTMAP
+// CAPSULE × HEIGHTMAP
 // --------------------------------------------------
 bool CapsuleCollision::isOverlapWithHeightMap(const ColliderPose& myTrans, const HeightMapCollision& map, const ColliderPose& transMap, ContactManifold& out, float slop) const
 {
@@ -1019,16 +1669,87 @@ bool CapsuleCollision::isOverlapWithHeightMap(const ColliderPose& myTrans, const
 	out.normal = -out.normal;
 	return b;
 }
+// --------------------------------------------------
+// CAPSULE × TRIANGLEMESH
+// --------------------------------------------------
+bool CapsuleCollision::isOverlapWithTriangleMesh(const ColliderPose& myTrans, const TriangleMeshCollision& mesh, const ColliderPose& transMesh, ContactManifold& out, float slop) const
+{
+	bool b = mesh.isOverlapWithCapsule(transMesh, *this, myTrans, out, slop);
+	out.normal = -out.normal;
+	return b;
+}
+// --------------------------------------------------
+// CAPSULE × CONVEXHULL
+// --------------------------------------------------
+bool CapsuleCollision::isOverlapWithConvexHull(const ColliderPose& myTrans, const ConvexHullCollision& hull, const ColliderPose& transHull, ContactManifold& out, float slop) const
+{
+	bool b = hull.isOverlapWithCapsule(transHull, *this, myTrans, out, slop);
+	out.normal = -out.normal;
+	return b;
+}
 
 // ==================================================
 // HeightMapCollision
 // ==================================================
+// --------------------------------------------------
+// 高さのピラミッドを作る（コンストラクタから１回だけ）
+// --------------------------------------------------
+void HeightMapCollision::BuildHeightPyramid()
+{
+	m_Pyramid.clear();
+	m_PyramidLevels.clear();
+	if (m_Width < 2 || m_Depth < 2) return;
+
+	// ----- [0] 段目：セルごとの４頂点 -----
+	int width = m_Width - 1;
+	int depth = m_Depth - 1;
+	m_PyramidLevels.push_back({ 0, width, depth });
+	m_Pyramid.resize(width * depth);
+	for (int j = 0; j < depth; j++)
+	{
+		for (int i = 0; i < width; i++)
+		{
+			const float h00 = GetHeight(i, j), h10 = GetHeight(i + 1, j), h01 = GetHeight(i, j + 1), h11 = GetHeight(i + 1, j + 1);
+			m_Pyramid[j * width + i] = { std::min({ h00, h10, h01, h11 }), std::max({ h00, h10, h01, h11 }) };
+		}
+	}
+
+	// ----- 上の段：下の段の２ｘ２をまとめる -----
+	while (width > 1 || depth > 1)
+	{
+		const PyramidLevel below = m_PyramidLevels.back();
+		width = (width + 1) / 2;
+		depth = (depth + 1) / 2;
+		const int offset = (int)m_Pyramid.size();
+		m_PyramidLevels.push_back({ offset, width, depth });
+		m_Pyramid.resize(offset + width * depth);
+		for (int z = 0; z < depth; z++)
+		{
+			for (int x = 0; x < width; x++)
+			{
+				HeightRange range = { std::numeric_limits<float>::max(), -std::numeric_limits<float>::max() };
+				for (int dz = 0; dz < 2; dz++)
+				{
+					for (int dx = 0; dx < 2; dx++)
+					{
+						const int bx = x * 2 + dx, bz = z * 2 + dz;
+						if (bx >= below.width || bz >= below.depth) continue;
+						const HeightRange& child = m_Pyramid[below.offset + bz * below.width + bx];
+						range.min = std::min(range.min, child.min);
+						range.max = std::max(range.max, child.max);
+					}
+				}
+				m_Pyramid[offset + z * width + x] = range;
+			}
+		}
+	}
+}
 bool HeightMapCollision::BuildCellTrianglesWorld(int i, int j, const ColliderPose& transHM, Triangle& out0, Triangle& out1) const
 {
-	// ͈̓`FbN
+	// 範囲チェック
 	if (i < 0 || j < 0 || i >= m_Width - 1 || j >= m_Depth - 1) return false;
 
-	// [JԂłS_
+	// ローカル空間で４頂点を作る
 	float x0 = i	   * m_CellSizeX; 
 	float x1 = (i + 1) * m_CellSizeX; 
 	float z0 = j	   * m_CellSizeZ; 
@@ -1039,19 +1760,19 @@ bool HeightMapCollision::BuildCellTrianglesWorld(int i, int j, const ColliderPos
 	float h01 = GetHeight(i	   , j + 1);
 	float h11 = GetHeight(i + 1, j + 1);
 
-	// [J_
-	Vector3 v00(x0, h00, z0); // O
-	Vector3 v10(x1, h10, z0); // EO
-	Vector3 v01(x0, h01, z1); // 
-	Vector3 v11(x1, h11, z1); // E
+	// ローカル頂点
+	Vector3 v00(x0, h00, z0); // 左手前
+	Vector3 v10(x1, h10, z0); // 右手前
+	Vector3 v01(x0, h01, z1); // 左奥
+	Vector3 v11(x1, h11, z1); // 右奥
 
-	// [J  [hϊ
+	// ローカル → ワールド変換
 	const Vector3 pos	  = transHM.position;
 	const Vector3 right   = transHM.WorldRight();
 	const Vector3 up	  = transHM.WorldUp();
 	const Vector3 forward = transHM.WorldForward();
 
-	// XP[Kp
+	// スケールを適用
 	Vector3 scale = transHM.scale;
 	v00 *= scale;
 	v10 *= scale;
@@ -1068,8 +1789,8 @@ bool HeightMapCollision::BuildCellTrianglesWorld(int i, int j, const ColliderPos
 	Vector3 v01World = LocalToWorld(v01);
 	Vector3 v11World = LocalToWorld(v11);
 
-	// Q̎Op`ɕiMeshƍ킹Kvj
-	// (v00, v01, v11), (v00, v11, v10) Ƃ
+	// ２枚の三角形に分割（Meshと合わせる必要あり）
+	// (v00, v01, v11), (v00, v11, v10) とする
 	out0.a = v00World;
 	out0.b = v01World;
 	out0.c = v11World;
@@ -1079,41 +1800,150 @@ bool HeightMapCollision::BuildCellTrianglesWorld(int i, int j, const ColliderPos
 
 	return true;
 }
+bool HeightMapCollision::ComputeCellRange(const ColliderPose& myTrans, const AABB& aabb, int& iMin, int& iMax, int& jMin, int& jMax) const
+{
+	// 回転無し前提なので XZ をそのままセル番号に直す
+	const float sizeX = m_CellSizeX * myTrans.scale.x;
+	const float sizeZ = m_CellSizeZ * myTrans.scale.z;
+	const Vector3 origin = myTrans.position;
+
+	iMin = std::max(static_cast<int>(std::floor((aabb.min.x - origin.x) / sizeX)), 0);
+	iMax = std::min(static_cast<int>(std::floor((aabb.max.x - origin.x) / sizeX)), m_Width - 2);
+	jMin = std::max(static_cast<int>(std::floor((aabb.min.z - origin.z) / sizeZ)), 0);
+	jMax = std::min(static_cast<int>(std::floor((aabb.max.z - origin.z) / sizeZ)), m_Depth - 2);
+	return iMin <= iMax && jMin <= jMax;
+}
 AABB HeightMapCollision::ComputeWorldAABB(const ColliderPose& ownerTrans) const
 {
-	//  HeightMap ͉]֎~ iXP[O֎~j
-	// [J
+	// ※※※※※ HeightMap は回転禁止 ※※※※※（負スケーリングも禁止）
+	// ローカル空間
 	Vector3 minLocal = { 0.0f, m_MinHeight, 0.0f };
 	Vector3 maxLocal = { m_CellSizeX * (m_Width - 1), m_MaxHeight, m_CellSizeZ * (m_Depth - 1) };
 
 	Vector3 scale = ownerTrans.scale;
 
-	// Scale Kp
+	// Scale 適用
 	minLocal *= scale;
 	maxLocal *= scale;
 
-	// _
+	// 原点
 	Vector3 pos = ownerTrans.position;
 	
 	return {minLocal + pos, maxLocal + pos};
 }
+// --------------------------------------------------
+// レイキャスト
+// ローカル（スケール前）の格子を２D DDA で手前のセルから辿り、セルごとに三角形２枚だけ調べる
+// ローカルの方向は dir / scale なので、パラメータ t はワールドの距離のまま使える
+// 上面から入るときだけ当たり（地面の下からは抜ける）
+// --------------------------------------------------
+bool HeightMapCollision::Raycast(const ColliderPose& myTrans, const Vector3& origin, const Vector3& dir, float maxDist, RayHit& out) const
+{
+	// ※※※※※ HeightMap は回転禁止 ※※※※※（負スケーリングも禁止）
+	const Vector3 scale = myTrans.scale;
+	const Vector3 o = { (origin.x - myTrans.position.x) / scale.x,
+						(origin.y - myTrans.position.y) / scale.y,
+						(origin.z - myTrans.position.z) / scale.z };
+	const Vector3 d = { dir.x / scale.x, dir.y / scale.y, dir.z / scale.z };
+
+	// ----- ローカルの範囲で切り取る -----
+	const float sizeX = m_CellSizeX * (m_Width - 1);
+	const float sizeZ = m_CellSizeZ * (m_Depth - 1);
+	float tEnter = 0.0f, tExit = maxDist;
+	auto clip = [&](float o, float d, float min, float max)
+		{
+			if (fabsf(d) < 1e-12f) return min <= o && o <= max;
+			float tNear = (min - o) / d;
+			float tFar	= (max - o) / d;
+			if (tNear > tFar) std::swap(tNear, tFar);
+			tEnter = std::max(tEnter, tNear);
+			tExit  = std::min(tExit, tFar);
+			return tEnter <= tExit;
+		};
+	if (!clip(o.x, d.x, 0.0f, sizeX) || !clip(o.z, d.z, 0.0f, sizeZ) || !clip(o.y, d.y, m_MinHeight, m_MaxHeight))
+		return false;
+
+	// ----- 最初のセル -----
+	const Vector3 start = o + d * tEnter;
+	int i = std::clamp(static_cast<int>(std::floor(start.x / m_CellSizeX)), 0, m_Width - 2);
+	int j = std::clamp(static_cast<int>(std::floor(start.z / m_CellSizeZ)), 0, m_Depth - 2);
+
+	// ----- 次の境界までの t と、１セル進むごとの t -----
+	const int stepI = d.x > 0.0f ? 1 : (d.x < 0.0f ? -1 : 0);
+	const int stepJ = d.z > 0.0f ? 1 : (d.z < 0.0f ? -1 : 0);
+	const float inf = std::numeric_limits<float>::infinity();
+	float tNextX = stepI == 0 ? inf : (((stepI > 0 ? i + 1 : i) * m_CellSizeX) - o.x) / d.x;
+	float tNextZ = stepJ == 0 ? inf : (((stepJ > 0 ? j + 1 : j) * m_CellSizeZ) - o.z) / d.z;
+	const float tDeltaX = stepI == 0 ? inf : m_CellSizeX / fabsf(d.x);
+	const float tDeltaZ = stepJ == 0 ? inf : m_CellSizeZ / fabsf(d.z);
+
+	float tCell = tEnter;
+	while (tCell <= tExit)
+	{
+		const float tCellEnd = std::min({ tNextX, tNextZ, tExit });
+
+		// ----- セルの高さの範囲とレイの高さの範囲が重なる時だけ三角形を見る -----
+		const HeightRange& range = CellHeightRange(i, j);
+		const float yA = o.y + d.y * tCell;
+		const float yB = o.y + d.y * tCellEnd;
+		if (std::min(yA, yB) <= range.max && std::max(yA, yB) >= range.min)
+		{
+			const float h00 = GetHeight(i, j), h10 = GetHeight(i + 1, j), h01 = GetHeight(i, j + 1), h11 = GetHeight(i + 1, j + 1);
+			const float x0 = i * m_CellSizeX, x1 = (i + 1) * m_CellSizeX;
+			const float z0 = j * m_CellSizeZ, z1 = (j + 1) * m_CellSizeZ;
+			const Vector3 v00(x0, h00, z0), v10(x1, h10, z0), v01(x0, h01, z1), v11(x1, h11, z1);
+
+			// (v00, v01, v11), (v00, v11, v10)（BuildCellTrianglesWorld と同じ分割）
+			float best = tExit, t;
+			Vector3 n, bestN;
+			bool hit = false;
+			if (RayTriangleFront(o, d, v00, v01, v11, best, t, n)) { best = t; bestN = n; hit = true; }
+			if (RayTriangleFront(o, d, v00, v11, v10, best, t, n)) { best = t; bestN = n; hit = true; }
+			if (hit)
+			{
+				// 法線はスケールの逆で変換
+				out.distance = best;
+				out.point	 = origin + dir * best;
+				out.normal	 = Vector3(bestN.x / scale.x, bestN.y / scale.y, bestN.z / scale.z).normalized();
+				return true;
+			}
+		}
+
+		// ----- 次のセルへ -----
+		if (tNextX < tNextZ)
+		{
+			i += stepI;
+			if (i < 0 || i > m_Width - 2) break;
+			tCell = tNextX;
+			tNextX += tDeltaX;
+		}
+		else
+		{
+			j += stepJ;
+			if (stepJ == 0 || j < 0 || j > m_Depth - 2) break;
+			tCell = tNextZ;
+			tNextZ += tDeltaZ;
+		}
+	}
+	return false;
+}
 bool HeightMapCollision::isOverlap(const ColliderPose& myTrans, const Collision& collisionB, const ColliderPose& transB, ContactManifold& out, float slop) const
 {
 	return collisionB.isOverlapWithHeightMap(transB, *this, myTrans, out, slop);
 }
 // --------------------------------------------------
-// HEIGHTMAP ~ BOX
+// HEIGHTMAP × BOX
 // --------------------------------------------------
 bool HeightMapCollision::isOverlapWithBox(const ColliderPose& myTrans, const BoxCollision& box, const ColliderPose& transBox, ContactManifold& out, float slop) const
 {
-	// box ̏擾
+	// box の情報を取得
 	Vector3 centerBox  = transBox.position;
 	Vector3 rightBox   = transBox.WorldRight();
 	Vector3 upBox	   = transBox.WorldUp();
 	Vector3 forwardBox = transBox.WorldForward();
 	Vector3 halfSizeBox = box.HalfSize() * transBox.scale;
 
-	// [JW_
+	// ローカル８頂点
 	Vector3 vertexLocal[8] ={
 		{ -halfSizeBox.x, -halfSizeBox.y, -halfSizeBox.z }, // 000
 		{ -halfSizeBox.x, -halfSizeBox.y,  halfSizeBox.z }, // 001
@@ -1124,7 +1954,7 @@ bool HeightMapCollision::isOverlapWithBox(const ColliderPose& myTrans, const Box
 		{  halfSizeBox.x,  halfSizeBox.y, -halfSizeBox.z }, // 110
 		{  halfSizeBox.x,  halfSizeBox.y,  halfSizeBox.z } // 111
 	};
-	// [h֕ϊ
+	// ワールドへ変換
 	auto LocalToWorld = [&](const Vector3& local)
 		{
 			return centerBox + rightBox * local.x + upBox * local.y + forwardBox * local.z;
@@ -1132,15 +1962,15 @@ bool HeightMapCollision::isOverlapWithBox(const ColliderPose& myTrans, const Box
 	Vector3 vertexes[8];
 	for (int i = 0; i < 8; i++) vertexes[i] = LocalToWorld(vertexLocal[i]);
 	
-	// Point vs HeightMap ̃wp
+	// Point vs HeightMap のヘルパ
 	auto TestPointOnHeightMap = [&](const Vector3& pos, TriHit& outHit)
 		{
-			// HeightMap ̒_ƃZTCY
+			// HeightMap の頂点とセルサイズ
 			Vector3 origin = myTrans.position;
 			float cellSizeX = m_CellSizeX;
 			float cellSizeZ = m_CellSizeZ;
 
-			// HeightMap ̃[JXZ֕ϊ
+			// HeightMap のローカルXZへ変換
 			Vector3 local = pos - origin;
 			float fx = local.x / cellSizeX;
 			float fz = local.z / cellSizeZ;
@@ -1148,38 +1978,41 @@ bool HeightMapCollision::isOverlapWithBox(const ColliderPose& myTrans, const Box
 			int i = static_cast<int>(std::floor(fx));
 			int j = static_cast<int>(std::floor(fz));
 
-			// ͈͊O
+			// 範囲外
 			if (i < 0 || j < 0 || i >= m_Width - 1 || j >= m_Depth - 1) return false;
 
-			// Z[0,1]䗦
+			// セルの一番高い所より上にある頂点は三角形を作るまでもない
+			if (pos.y - slop >= origin.y + CellHeightRange(i, j).max * myTrans.scale.y) return false;
+
+			// セル内の[0,1]比率
 			float sx = fx - static_cast<float>(i);
 			float sz = fz - static_cast<float>(j);
 
-			// ΉQOp`[hŐ
+			// 対応する２枚三角形をワールドで生成
 			Triangle tri0, tri1;
 			if (!BuildCellTrianglesWorld(i, j, myTrans, tri0, tri1)) return false;
 
-			// MeshField Ɠɍ킹
+			// MeshField と同じ分割に合わせる
 			const Triangle* tri = (sx <= sz) ? &tri0 : &tri1;
 
 			const Vector3& a = tri->a;
 			const Vector3& b = tri->b;
 			const Vector3& c = tri->c;
 
-			// ʖ@vZ
+			// 面法線を計算
 			Vector3 e1 = b - a;
 			Vector3 e2 = c - a;
 			Vector3 n = Vector3::Cross(e1, e2);
 			float len = n.length();
 			if (len < 1e-8f) return false;
-			n /= len; // K
+			n /= len; // 正規化
 
-			//if (n.y < 0.0f) n = -n; // K悤ȃ`[jO
+			//if (n.y < 0.0f) n = -n; // 必ず上方向を向くようなチューニング
 
-			// ʏ̍ H(x, z) ߂
-			// nE(x - a) = 0  y 
+			// 平面上の高さ H(x, z) を求める
+			// n・(x - a) = 0 から y を解く
 			// n.x * (Px - a.x) + n.y * (y - a.y) + n.z * (Pz - a.z) = 0
-			//  y = a.y - (n.x * (Px - a.x) + n.z * (Pz - a.z)) / n.y
+			// → y = a.y - (n.x * (Px - a.x) + n.z * (Pz - a.z)) / n.y
 			if (fabsf(n.y) < 1e-8f) return false;
 
 			float H = a.y - (n.x * (pos.x - a.x) + n.z * (pos.z - a.z)) / n.y;
@@ -1188,199 +2021,88 @@ bool HeightMapCollision::isOverlapWithBox(const ColliderPose& myTrans, const Box
 
 			if (penetration <= slop) return false;
 
-			// contact l߂
+			// contact 情報を詰める
 			outHit.hit = true;
 			outHit.penetration = penetration;
-			outHit.normal = -n; // Box  HeightMap ɂKv̂ł
+			outHit.normal = -n; // Box → HeightMap にする必要があるのでこっち向き
 
-			// pointOnA: HeightMap in`\ʏ̓_j
-			// pointOnB: Box i_̂́j
+			// pointOnA: HeightMap 側（地形表面上の点）
+			// pointOnB: Box 側（頂点そのもの）
 			outHit.pointOnA = pos + n * penetration;
 			outHit.pointOnB = pos;
 			return true;
 		};
-	// W_ PointHit W߂
-	std::vector<TriHit> hits;
-	hits.reserve(8);
+	// ８頂点の PointHit を集める
+	TriHitBuffer hits;
 	for (int i = 0; i < 8; i++)
 	{
 		TriHit h{};
 		if (TestPointOnHeightMap(vertexes[i], h))
-			hits.push_back(h);
+			hits.Add(h);
 	}
-	if (hits.empty()) return false;
 
-	// ----- TriHit  ContactManifold gݗĂ -----
-	// penetration ̑傫Ƀ\[g
-	std::vector<const TriHit*> sorted;
-	sorted.reserve(hits.size());
-	for (auto& h : hits) sorted.push_back(&h);
-
-	std::sort(sorted.begin(), sorted.end(),
-		[](const TriHit* a, const TriHit* b)
-		{
-			return a->penetration > b->penetration;
-		}
-	);
-
-	const int maxCounts = out.MAX_POINTS;
-
-	// 擪ił[_j̗p
-	const TriHit* first = sorted[0];
-	out.normal = first->normal; // ݂͍ő[x݂̂ normal ɍ̗p
-	out.points[0].penetration = first->penetration;
-	out.points[0].pointOnA = first->pointOnA;
-	out.points[0].pointOnB = first->pointOnB;
-	out.count = 1;
-
-	// ȍ~A\mi[
-	float minSep = 0.25f * std::min(m_CellSizeX, m_CellSizeZ); // ZTCY1/4ȏ͂ȂĂOK
-	float minSepSq = minSep * minSep;
-	for (int i = 1; i < static_cast<int>(sorted.size()) && out.count < maxCounts; i++)
-	{
-		const TriHit* h = sorted[i];
-
-		bool close = false;
-
-		for (int c = 0; c < out.count; c++)
-		{
-			// HeightMap ̐ڐG_m̋
-			Vector3 diff = h->pointOnA - out.points[c].pointOnA;
-			if (diff.lengthSq() < minSepSq)
-			{
-				close = true;
-				break;
-			}
-		}
-
-		if (close) continue; // ߂̂ŃXLbv
-
-		// \Ă̂ō̗p
-		out.points[out.count].penetration = h->penetration;
-		out.points[out.count].pointOnA = h->pointOnA;
-		out.points[out.count].pointOnB = h->pointOnB;
-		out.count++;
-	}
-
-	out.touching = true;
-
-	return out.touching;
+	// ----- TriHit から ContactManifold を組み立てる -----
+	return BuildManifoldFromHits(hits, 0.25f * std::min(m_CellSizeX, m_CellSizeZ), out); // セルサイズの1/4以上はなれていればOK
 }
 // --------------------------------------------------
-// HEIGHTMAP ~ SPHERE
+// HEIGHTMAP × SPHERE
 // --------------------------------------------------
-bool HeightMapCollision::isOverlapWithSphere(const ColliderPose& myTrans, const SphereCollision& sphere, const ColliderPose& transSph, ContactManifold& out, float slop) const
+bool HeightMapCollision::isOverlapWithSphere(const ColliderPose& myTrans, const SphereCollision& sphere, const ColliderPose& transSph, ContactManifold& out, float /*slop*/) const
 {
-	// Sphere [h
+	// Sphere ワールド情報
 	Vector3 centerSph = transSph.position;
 	float radius = sphere.Radius() * transSph.scale.x;
 
-	// HeightMap ̌_
+	// HeightMap の原点
 	Vector3 origin = myTrans.position;
 
-	// ObhP}X̃TCY
+	// グリッド１マスのサイズ
 	float cellSizeX = m_CellSizeX;
 	float cellSizeZ = m_CellSizeZ;
 
-	// Sphere ̒S HeightMap ̃[JXZWɕϊ
+	// Sphere の中心を HeightMap のローカルXZ座標に変換
 	Vector3 local = centerSph - origin;
 	float lx = local.x;
 	float lz = local.z;
 
-	// Sphere Z͈͂vZ
+	// Sphere がかかるセル範囲を計算
 	int iMin = static_cast<int>(std::floor((lx - radius) / cellSizeX));
 	int iMax = static_cast<int>(std::floor((lx + radius) / cellSizeX));
 	int jMin = static_cast<int>(std::floor((lz - radius) / cellSizeZ));
 	int jMax = static_cast<int>(std::floor((lz + radius) / cellSizeZ));
-	// HeightMap ̎TCYŃNv
+	// HeightMap の実サイズでクランプ
 	iMin = std::max(iMin, 0);
 	jMin = std::max(jMin, 0);
 	iMax = std::min(iMax, m_Width - 2);
 	jMax = std::min(jMax, m_Depth - 2);
 
-	// eZ̎Op`Ɣ
-	std::vector<TriHit> hits;
-	hits.reserve(16); // Kɗ̈m
-	for (int j = jMin; j <= jMax; j++)
-	{
-		for (int i = iMin; i <= iMax; i++)
+	// 球の高さに掛かるセルの三角形とだけ判定（ピラミッドでまとめて刈る）
+	const float yMin = (centerSph.y - radius - origin.y) / myTrans.scale.y;
+	const float yMax = (centerSph.y + radius - origin.y) / myTrans.scale.y;
+	TriHitBuffer hits;
+	ForEachCellInRange(iMin, iMax, jMin, jMax, yMin, yMax, [&](int i, int j)
 		{
-			// Ή triangle 𐶐
+			// 対応する triangle を生成
 			Triangle tri0, tri1;
-			if (!BuildCellTrianglesWorld(i, j, myTrans, tri0, tri1)) continue;
+			if (!BuildCellTrianglesWorld(i, j, myTrans, tri0, tri1)) return;
 
 			TriHit hit0, hit1;
 
 			if (CollisionTriangle::IntersectSphere(centerSph, radius, tri0, hit0))
-				hits.push_back(hit0);
+				hits.Add(hit0);
 			if (CollisionTriangle::IntersectSphere(centerSph, radius, tri1, hit1))
-				hits.push_back(hit1);
-		}
-	}
-	if (hits.empty()) return false;
-
-	// ----- TriHit  ContactManifold gݗĂ -----
-	// penetration ̑傫Ƀ\[g
-	std::vector<const TriHit*> sorted;
-	sorted.reserve(hits.size());
-	for (auto& h : hits) sorted.push_back(&h);
-	
-	std::sort(sorted.begin(), sorted.end(),
-			  [](const TriHit* a, const TriHit* b)
-			  {
-				return a->penetration > b->penetration;
-			  }
-			 );
-	
-	const int maxCounts = out.MAX_POINTS;
-
-	// 擪ił[_j̗p
-	const TriHit* first = sorted[0];
-	out.normal = first->normal; // ݂͍ő[x݂̂ normal ɍ̗p
-	out.points[0].penetration = first->penetration;
-	out.points[0].pointOnA = first->pointOnA;
-	out.points[0].pointOnB = first->pointOnB;
-	out.count = 1;
-
-	// ȍ~A\mi[
-	float minSep = 0.25f * std::min(m_CellSizeX, m_CellSizeZ); // ZTCY1/4ȏ͂ȂĂOK
-	float minSepSq = minSep * minSep;
-	for (int i = 1; i < static_cast<int>(sorted.size()) && out.count < maxCounts; i++)
-	{
-		const TriHit* h = sorted[i];
-	
-		bool close = false;
-		
-		for (int c = 0; c < out.count; c++)
-		{
-			// Sphere ̓_mŋ
-			Vector3 diff = h->pointOnA - out.points[c].pointOnA;
-			if (diff.lengthSq() < minSepSq)
-			{
-				close = true;
-				break;
-			}
-		}
-
-		if (close) continue; // ߂̂ŃXLbv
+				hits.Add(hit1);
+		});
 
-		// \Ă̂ō̗p
-		out.points[out.count].penetration = h->penetration;
-		out.points[out.count].pointOnA    = h->pointOnA;
-		out.points[out.count].pointOnB    = h->pointOnB;
-		out.count++;
-	}
-
-	out.touching = true;
-
-	return out.touching;
+	// ----- TriHit から ContactManifold を組み立てる -----
+	return BuildManifoldFromHits(hits, 0.25f * std::min(m_CellSizeX, m_CellSizeZ), out); // セルサイズの1/4以上はなれていればOK
 }
 // --------------------------------------------------
-// HEIGHTMAP ~ CAPSULE
+// HEIGHTMAP × CAPSULE
 // --------------------------------------------------
-bool HeightMapCollision::isOverlapWithCapsule(const ColliderPose& myTrans, const CapsuleCollision& capsule, const ColliderPose& transCap, ContactManifold& out, float slop) const
+bool HeightMapCollision::isOverlapWithCapsule(const ColliderPose& myTrans, const CapsuleCollision& capsule, const ColliderPose& transCap, ContactManifold& out, float /*slop*/) const
 {
-	// JvZ̐
+	// カプセルの線分を作る
 	Vector3 upCap = transCap.WorldUp();
 	float halfCylinderHeight = capsule.CylinderHeight() * 0.5f * transCap.scale.y;
 	float radius = capsule.Radius() * transCap.scale.x;
@@ -1388,8 +2110,8 @@ bool HeightMapCollision::isOverlapWithCapsule(const ColliderPose& myTrans, const
 	Vector3 bottom	  = centerCap - upCap * halfCylinderHeight;
 	Vector3 top		  = centerCap + upCap * halfCylinderHeight;
 
-	// Tv̒SvZ
-	const int SAMPLE_COUNT = 5; // p[^iR`T肪߁j
+	// サンプル球の中心を計算
+	const int SAMPLE_COUNT = 5; // 調整パラメータ（３～５あたりがおすすめ）
 	Vector3 centers[SAMPLE_COUNT];
 	for (int i = 0; i < SAMPLE_COUNT; i++)
 	{
@@ -1397,15 +2119,15 @@ bool HeightMapCollision::isOverlapWithCapsule(const ColliderPose& myTrans, const
 		centers[i] = bottom + (top - bottom) * t;
 	}
 
-	// ----- Capsule ŜAABB HeightMap ̃Z͈͂߂ -----
-	// HeightMap ̌_
+	// ----- Capsule 全体のAABBから HeightMap 上のセル範囲を求める -----
+	// HeightMap の原点
 	Vector3 origin = myTrans.position;
 
-	// ObhP}X̃TCY
+	// グリッド１マスのサイズ
 	float cellSizeX = m_CellSizeX;
 	float cellSizeZ = m_CellSizeZ;
 
-	// JvZXZeAABB
+	// カプセルのXZ投影のAABBを取る
 	float minX = centers[0].x;
 	float maxX = centers[0].x;
 	float minZ = centers[0].z;
@@ -1417,127 +2139,374 @@ bool HeightMapCollision::isOverlapWithCapsule(const ColliderPose& myTrans, const
 		minZ = std::min(minZ, centers[i].z);
 		maxZ = std::max(maxZ, centers[i].z);
 	}
-	// ag
+	// 半径分拡張
 	minX -= radius;
 	maxX += radius;
 	minZ -= radius;
 	maxZ += radius;
 
-	// ----- HeightMap ̃[JXZɕϊ -----
+	// ----- HeightMap のローカルXZに変換 -----
 	Vector3 minLocal = { minX - origin.x, 0.0f, minZ - origin.z };
 	Vector3 maxLocal = { maxX - origin.x, 0.0f, maxZ - origin.z };
 
-	// Capsule Z͈͂vZ
+	// Capsule がかかるセル範囲を計算
 	int iMin = static_cast<int>(std::floor(minLocal.x / cellSizeX));
 	int iMax = static_cast<int>(std::floor(maxLocal.x / cellSizeX));
 	int jMin = static_cast<int>(std::floor(minLocal.z / cellSizeZ));
 	int jMax = static_cast<int>(std::floor(maxLocal.z / cellSizeZ));
 
-	// HeightMap ͈͂ŃNv
+	// HeightMap 範囲でクランプ
 	iMin = std::max(iMin, 0);
 	jMin = std::max(jMin, 0);
 	iMax = std::min(iMax, m_Width - 2);
 	jMax = std::min(jMax, m_Depth - 2);
-	// ͈͊OȂ瓖ĂȂ
+	// 範囲外なら当たっていない
 	if (iMin > iMax || jMin > jMax) return false;
 
-	// ----- eZ̎Op`~TvŔ -----
-	std::vector<TriHit> hits;
-	hits.reserve(32);
-	for (int j = jMin; j <= jMax; j++)
+	// ----- 各セルの三角形×サンプル球で判定 -----
+	// カプセルの高さに掛かるセルだけ（ピラミッドでまとめて刈る）
+	float minY = centers[0].y, maxY = centers[0].y;
+	for (int i = 1; i < SAMPLE_COUNT; i++)
 	{
-		for (int i = iMin; i <= iMax; i++)
+		minY = std::min(minY, centers[i].y);
+		maxY = std::max(maxY, centers[i].y);
+	}
+	const float yMin = (minY - radius - origin.y) / myTrans.scale.y;
+	const float yMax = (maxY + radius - origin.y) / myTrans.scale.y;
+	TriHitBuffer hits;
+	ForEachCellInRange(iMin, iMax, jMin, jMax, yMin, yMax, [&](int i, int j)
 		{
 			Triangle tri0, tri1;
-			if (!BuildCellTrianglesWorld(i, j, myTrans, tri0, tri1)) continue;
+			if (!BuildCellTrianglesWorld(i, j, myTrans, tri0, tri1)) return;
 
+			// セルの高さ（ワールド）に掛からないサンプル球は飛ばす
+			const HeightRange& range = CellHeightRange(i, j);
+			const float cellMin = origin.y + range.min * myTrans.scale.y;
+			const float cellMax = origin.y + range.max * myTrans.scale.y;
 			for (int s = 0; s < SAMPLE_COUNT; s++)
 			{
+				if (centers[s].y - radius > cellMax || centers[s].y + radius < cellMin) continue;
 				TriHit hit0, hit1;
-				if (CollisionTriangle::IntersectSphere(centers[s], radius, tri0, hit0)) hits.push_back(hit0);
-				if (CollisionTriangle::IntersectSphere(centers[s], radius, tri1, hit1)) hits.push_back(hit1);
+				if (CollisionTriangle::IntersectSphere(centers[s], radius, tri0, hit0)) hits.Add(hit0);
+				if (CollisionTriangle::IntersectSphere(centers[s], radius, tri1, hit1)) hits.Add(hit1);
 			}
-		}
-	}
-	if (hits.empty()) return false;
-
-	// ----- TriHit  ContactManifold gݗĂ -----
-	// penetration ̑傫Ƀ\[g
-	std::vector<const TriHit*> sorted;
-	sorted.reserve(hits.size());
-	for (auto& h : hits) sorted.push_back(&h);
+		});
 
-	std::sort(sorted.begin(), sorted.end(),
-		[](const TriHit* a, const TriHit* b)
+	// ----- TriHit から ContactManifold を組み立てる -----
+	return BuildManifoldFromHits(hits, 0.25f * std::min(m_CellSizeX, m_CellSizeZ), out); // セルサイズの1/4以上はなれていればOK
+}
+// --------------------------------------------------
+// HEIGHTMAP × HEIGHTMAP
+// --------------------------------------------------
+bool HeightMapCollision::isOverlapWithHeightMap(const ColliderPose& /*myTrans*/, const HeightMapCollision& /*map*/, const ColliderPose& /*transMap*/, ContactManifold& /*out*/, float /*slop*/) const
+{
+	// こいつらはあたらない
+	return false;
+}
+// --------------------------------------------------
+// HEIGHTMAP × TRIANGLEMESH
+// --------------------------------------------------
+bool HeightMapCollision::isOverlapWithTriangleMesh(const ColliderPose& /*myTrans*/, const TriangleMeshCollision& /*mesh*/, const ColliderPose& /*transMesh*/, ContactManifold& /*out*/, float /*slop*/) const
+{
+	// どちらも動かないので判定しない
+	return false;
+}
+// --------------------------------------------------
+// HEIGHTMAP × CONVEXHULL
+// 掛かるセルの三角形ごとに凸形状同士で判定する
+// --------------------------------------------------
+bool HeightMapCollision::isOverlapWithConvexHull(const ColliderPose& myTrans, const ConvexHullCollision& hull, const ColliderPose& transHull, ContactManifold& out, float slop) const
+{
+	const AABB box = hull.ComputeWorldAABB(transHull);
+	int iMin, iMax, jMin, jMax;
+	if (!ComputeCellRange(myTrans, box, iMin, iMax, jMin, jMax)) return false;
+
+	const SupportShape shape = MakeHullShape(transHull, hull);
+	const float yMin = (box.min.y - myTrans.position.y) / myTrans.scale.y;
+	const float yMax = (box.max.y - myTrans.position.y) / myTrans.scale.y;
+	TriHitBuffer hits;
+	ForEachCellInRange(iMin, iMax, jMin, jMax, yMin, yMax, [&](int i, int j)
 		{
-			return a->penetration > b->penetration;
-		}
-	);
+			Triangle tri[2];
+			if (!BuildCellTrianglesWorld(i, j, myTrans, tri[0], tri[1])) return;
+			for (const Triangle& t : tri)
+				ConvexContacts(shape, SupportShape::Triangle(t.a, t.b, t.c), slop, hits);
+		});
+
+	// ----- TriHit から ContactManifold を組み立てる -----
+	return BuildManifoldFromHits(hits, HullMinSeparation(hull, transHull), out);
+}
 
-	const int maxCounts = out.MAX_POINTS;
+// ==================================================
+// TriangleMeshCollision
+// ==================================================
+AABB TriangleMeshCollision::ComputeWorldAABB(const ColliderPose& ownerTrans) const
+{
+	// ローカルの根の範囲を、Box と同じく中心と半長で回す
+	const AABB local = m_pMesh->Bounds();
+	const Vector3 c = (local.min + local.max) * 0.5f;
+	const Vector3 h = (local.max - local.min) * 0.5f;
+	const Vector3 axis[3] = { ownerTrans.WorldRight() * ownerTrans.scale.x,
+							  ownerTrans.WorldUp()	  * ownerTrans.scale.y,
+							  ownerTrans.WorldForward() * ownerTrans.scale.z };
+	const Vector3 center = ownerTrans.position + axis[0] * c.x + axis[1] * c.y + axis[2] * c.z;
+	Vector3 e;
+	e.x = fabsf(axis[0].x) * h.x + fabsf(axis[1].x) * h.y + fabsf(axis[2].x) * h.z;
+	e.y = fabsf(axis[0].y) * h.x + fabsf(axis[1].y) * h.y + fabsf(axis[2].y) * h.z;
+	e.z = fabsf(axis[0].z) * h.x + fabsf(axis[1].z) * h.y + fabsf(axis[2].z) * h.z;
+	return AABB{ center - e, center + e };
+}
+// --------------------------------------------------
+// レイはローカルに移して BVH で探す
+// 方向はスケールで割るだけ（正規化しない）なので t はワールドのまま使える
+// --------------------------------------------------
+bool TriangleMeshCollision::Raycast(const ColliderPose& myTrans, const Vector3& origin, const Vector3& dir, float maxDist, RayHit& out) const
+{
+	const Vector3 axis[3] = { myTrans.WorldRight(), myTrans.WorldUp(), myTrans.WorldForward() };
+	const Vector3 rel = origin - myTrans.position;
+	const Vector3 localOrigin = { Vector3::Dot(axis[0], rel) / myTrans.scale.x,
+								  Vector3::Dot(axis[1], rel) / myTrans.scale.y,
+								  Vector3::Dot(axis[2], rel) / myTrans.scale.z };
+	const Vector3 localDir = { Vector3::Dot(axis[0], dir) / myTrans.scale.x,
+							   Vector3::Dot(axis[1], dir) / myTrans.scale.y,
+							   Vector3::Dot(axis[2], dir) / myTrans.scale.z };
+	float t = 0.0f;
+	int tri = -1;
+	if (!m_pMesh->Raycast(localOrigin, localDir, maxDist, t, tri)) return false;
+
+	// ----- 法線はワールドの三角形から作って、レイの来た側に向ける -----
+	Vector3 a, b, c;
+	m_pMesh->GetTriangle(tri, a, b, c);
+	auto toWorld = [&](const Vector3& v)
+		{
+			return myTrans.position + axis[0] * (v.x * myTrans.scale.x) + axis[1] * (v.y * myTrans.scale.y) + axis[2] * (v.z * myTrans.scale.z);
+		};
+	const Vector3 wa = toWorld(a);
+	Vector3 normal = Vector3::Cross(toWorld(b) - wa, toWorld(c) - wa).normalized();
+	if (Vector3::Dot(normal, dir) > 0.0f) normal = -normal;
 
-	// 擪ił[_j̗p
-	const TriHit* first = sorted[0];
-	out.normal = first->normal; // ݂͍ő[x݂̂ normal ɍ̗p
-	out.points[0].penetration = first->penetration;
-	out.points[0].pointOnA = first->pointOnA;
-	out.points[0].pointOnB = first->pointOnB;
-	out.count = 1;
+	out.distance = t;
+	out.point	 = origin + dir * t;
+	out.normal	 = normal;
+	return true;
+}
+bool TriangleMeshCollision::isOverlap(const ColliderPose& myTrans, const Collision& collisionB, const ColliderPose& transB, ContactManifold& out, float slop) const
+{
+	return collisionB.isOverlapWithTriangleMesh(transB, *this, myTrans, out, slop);
+}
+// --------------------------------------------------
+// TRIANGLEMESH × BOX
+// --------------------------------------------------
+bool TriangleMeshCollision::isOverlapWithBox(const ColliderPose& myTrans, const BoxCollision& box, const ColliderPose& transBox, ContactManifold& out, float slop) const
+{
+	const OBBW obb = MakeOBB(transBox, box);
+	TriHitBuffer hits;
+	ForEachTriangleInAABB(myTrans, box.ComputeWorldAABB(transBox), [&](const Triangle& tri)
+		{
+			BoxTriangleContacts(obb, tri, slop, hits);
+		});
 
-	// ȍ~A\mi[
-	float minSep = 0.25f * std::min(m_CellSizeX, m_CellSizeZ); // ZTCY1/4ȏ͂ȂĂOK
-	float minSepSq = minSep * minSep;
-	for (int i = 1; i < static_cast<int>(sorted.size()) && out.count < maxCounts; i++)
-	{
-		const TriHit* h = sorted[i];
+	// ----- TriHit から ContactManifold を組み立てる -----
+	const float minExtent = std::min({ obb.extent.x, obb.extent.y, obb.extent.z });
+	return BuildManifoldFromHits(hits, 0.25f * minExtent, out); // 一番短い半長の1/4以上はなれていればOK
+}
+// --------------------------------------------------
+// TRIANGLEMESH × SPHERE
+// --------------------------------------------------
+bool TriangleMeshCollision::isOverlapWithSphere(const ColliderPose& myTrans, const SphereCollision& sphere, const ColliderPose& transSph, ContactManifold& out, float /*slop*/) const
+{
+	// Sphere ワールド情報
+	const Vector3 centerSph = transSph.position;
+	const float radius = sphere.Radius() * transSph.scale.x;
 
-		bool close = false;
+	TriHitBuffer hits;
+	const Vector3 r = { radius, radius, radius };
+	ForEachTriangleInAABB(myTrans, AABB{ centerSph - r, centerSph + r }, [&](const Triangle& tri)
+		{
+			TriHit hit;
+			if (CollisionTriangle::IntersectSphere(centerSph, radius, tri, hit)) hits.Add(hit);
+		});
 
-		for (int c = 0; c < out.count; c++)
+	// ----- TriHit から ContactManifold を組み立てる -----
+	return BuildManifoldFromHits(hits, 0.25f * radius, out); // 半径の1/4以上はなれていればOK
+}
+// --------------------------------------------------
+// TRIANGLEMESH × CAPSULE
+// HeightMap と同じくサンプル球で近似する
+// --------------------------------------------------
+bool TriangleMeshCollision::isOverlapWithCapsule(const ColliderPose& myTrans, const CapsuleCollision& capsule, const ColliderPose& transCap, ContactManifold& out, float /*slop*/) const
+{
+	// カプセルの線分を作る
+	const Vector3 upCap = transCap.WorldUp();
+	const float halfCylinderHeight = capsule.CylinderHeight() * 0.5f * transCap.scale.y;
+	const float radius = capsule.Radius() * transCap.scale.x;
+	const Vector3 bottom = transCap.position - upCap * halfCylinderHeight;
+	const Vector3 top	 = transCap.position + upCap * halfCylinderHeight;
+
+	// サンプル球の中心を計算
+	const int SAMPLE_COUNT = 5;
+	Vector3 centers[SAMPLE_COUNT];
+	for (int i = 0; i < SAMPLE_COUNT; i++)
+		centers[i] = bottom + (top - bottom) * ((float)i / float(SAMPLE_COUNT - 1));
+
+	// ----- カプセル全体の AABB で三角形を集め、サンプル球ごとに判定 -----
+	const Vector3 r = { radius, radius, radius };
+	const AABB box{ Vector3(std::min(bottom.x, top.x), std::min(bottom.y, top.y), std::min(bottom.z, top.z)) - r,
+					Vector3(std::max(bottom.x, top.x), std::max(bottom.y, top.y), std::max(bottom.z, top.z)) + r };
+	TriHitBuffer hits;
+	ForEachTriangleInAABB(myTrans, box, [&](const Triangle& tri)
 		{
-			// Sphere ̓_mŋ
-			Vector3 diff = h->pointOnA - out.points[c].pointOnA;
-			if (diff.lengthSq() < minSepSq)
+			// 三角形の範囲に掛からないサンプル球は飛ばす
+			const Vector3 triMin = { std::min({ tri.a.x, tri.b.x, tri.c.x }), std::min({ tri.a.y, tri.b.y, tri.c.y }), std::min({ tri.a.z, tri.b.z, tri.c.z }) };
+			const Vector3 triMax = { std::max({ tri.a.x, tri.b.x, tri.c.x }), std::max({ tri.a.y, tri.b.y, tri.c.y }), std::max({ tri.a.z, tri.b.z, tri.c.z }) };
+			for (int s = 0; s < SAMPLE_COUNT; s++)
 			{
-				close = true;
-				break;
+				if (!AABB{ centers[s] - r, centers[s] + r }.isOverlap(AABB{ triMin, triMax })) continue;
+				TriHit hit;
+				if (CollisionTriangle::IntersectSphere(centers[s], radius, tri, hit)) hits.Add(hit);
 			}
-		}
+		});
+
+	// ----- TriHit から ContactManifold を組み立てる -----
+	return BuildManifoldFromHits(hits, 0.25f * radius, out); // 半径の1/4以上はなれていればOK
+}
+// --------------------------------------------------
+// TRIANGLEMESH × HEIGHTMAP, TRIANGLEMESH
+// --------------------------------------------------
+bool TriangleMeshCollision::isOverlapWithHeightMap(const ColliderPose& /*myTrans*/, const HeightMapCollision& /*map*/, const ColliderPose& /*transMap*/, ContactManifold& /*out*/, float /*slop*/) const
+{
+	// どちらも動かないので判定しない
+	return false;
+}
+bool TriangleMeshCollision::isOverlapWithTriangleMesh(const ColliderPose& /*myTrans*/, const TriangleMeshCollision& /*mesh*/, const ColliderPose& /*transMesh*/, ContactManifold& /*out*/, float /*slop*/) const
+{
+	// どちらも動かないので判定しない
+	return false;
+}
+// --------------------------------------------------
+// TRIANGLEMESH × CONVEXHULL
+// BVH で拾った三角形ごとに凸形状同士で判定する
+// --------------------------------------------------
+bool TriangleMeshCollision::isOverlapWithConvexHull(const ColliderPose& myTrans, const ConvexHullCollision& hull, const ColliderPose& transHull, ContactManifold& out, float slop) const
+{
+	const SupportShape shape = MakeHullShape(transHull, hull);
+	TriHitBuffer hits;
+	ForEachTriangleInAABB(myTrans, hull.ComputeWorldAABB(transHull), [&](const Triangle& t)
+		{
+			ConvexContacts(shape, SupportShape::Triangle(t.a, t.b, t.c), slop, hits);
+		});
 
-		if (close) continue; // ߂̂ŃXLbv
+	// ----- TriHit から ContactManifold を組み立てる -----
+	return BuildManifoldFromHits(hits, HullMinSeparation(hull, transHull), out);
+}
 
-		// \Ă̂ō̗p
-		out.points[out.count].penetration = h->penetration;
-		out.points[out.count].pointOnA = h->pointOnA;
-		out.points[out.count].pointOnB = h->pointOnB;
-		out.count++;
+// ==================================================
+// ConvexHullCollision
+// ==================================================
+AABB ConvexHullCollision::ComputeWorldAABB(const ColliderPose& ownerTrans) const
+{
+	AABB out;
+	MakeHullShape(ownerTrans, *this).ComputeBounds(out.min, out.max);
+	return out;
+}
+// --------------------------------------------------
+// レイはローカルに移して、面の平面で区間を削っていく
+// 方向はスケールで割るだけ（正規化しない）なので t はワールドのまま使える
+// --------------------------------------------------
+bool ConvexHullCollision::Raycast(const ColliderPose& myTrans, const Vector3& origin, const Vector3& dir, float maxDist, RayHit& out) const
+{
+	const Vector3 axis[3] = { myTrans.WorldRight(), myTrans.WorldUp(), myTrans.WorldForward() };
+	const Vector3 rel = origin - myTrans.position;
+	const Vector3 localOrigin = { Vector3::Dot(axis[0], rel) / myTrans.scale.x,
+								  Vector3::Dot(axis[1], rel) / myTrans.scale.y,
+								  Vector3::Dot(axis[2], rel) / myTrans.scale.z };
+	const Vector3 localDir = { Vector3::Dot(axis[0], dir) / myTrans.scale.x,
+							   Vector3::Dot(axis[1], dir) / myTrans.scale.y,
+							   Vector3::Dot(axis[2], dir) / myTrans.scale.z };
+
+	float tEnter = 0.0f, tExit = maxDist;
+	int enterFace = -1;
+	for (int i = 0; i < m_pHull->FaceCount(); i++)
+	{
+		const ConvexHull::Face& face = m_pHull->GetFace(i);
+		const float denom = Vector3::Dot(face.normal, localDir);
+		const float dist = Vector3::Dot(face.normal, localOrigin) - face.distance; // 正なら面の外
+		if (fabsf(denom) < 1e-12f)
+		{
+			if (dist > 0.0f) return false; // 平行で外側
+			continue;
+		}
+		const float t = -dist / denom;
+		if (denom < 0.0f) { if (t > tEnter) { tEnter = t; enterFace = i; } } // 入る面
+		else			  { if (t < tExit) tExit = t; }						 // 出る面
+		if (tEnter > tExit) return false;
 	}
+	if (enterFace < 0) return false; // 始点が内側
 
-	out.touching = true;
-
-	return out.touching;
+	// ----- 法線は逆転置（スケールで割る）で回す -----
+	const Vector3& n = m_pHull->GetFace(enterFace).normal;
+	out.distance = tEnter;
+	out.point	 = origin + dir * tEnter;
+	out.normal	 = (axis[0] * (n.x / myTrans.scale.x) + axis[1] * (n.y / myTrans.scale.y) + axis[2] * (n.z / myTrans.scale.z)).normalized();
+	return true;
+}
+bool ConvexHullCollision::isOverlap(const ColliderPose& myTrans, const Collision& collisionB, const ColliderPose& transB, ContactManifold& out, float slop) const
+{
+	return collisionB.isOverlapWithConvexHull(transB, *this, myTrans, out, slop);
 }
 // --------------------------------------------------
-// HEIGHTMAP ~ HEIGHTMAP
+// CONVEXHULL × BOX, SPHERE, CAPSULE, CONVEXHULL
+// どれも凸形状同士（GJK / EPA ＋ 面のクリップ）
 // --------------------------------------------------
-bool HeightMapCollision::isOverlapWithHeightMap(const ColliderPose& myTrans, const HeightMapCollision& map, const ColliderPose& transMap, ContactManifold& out, float slop) const
+bool ConvexHullCollision::isOverlapWithBox(const ColliderPose& myTrans, const BoxCollision& box, const ColliderPose& transBox, ContactManifold& out, float slop) const
 {
-	// ͂Ȃ
-	return false;
+	const SupportShape a = MakeBoxShape(transBox, box);
+	const float minSep = std::min(HullMinSeparation(*this, myTrans), 0.25f * std::min(a.half.x, std::min(a.half.y, a.half.z))); // 小さい方に合わせる
+	return ConvexManifold(a, MakeHullShape(myTrans, *this), minSep, slop, out);
+}
+bool ConvexHullCollision::isOverlapWithSphere(const ColliderPose& myTrans, const SphereCollision& sphere, const ColliderPose& transSph, ContactManifold& out, float slop) const
+{
+	return ConvexManifold(MakeSphereShape(transSph, sphere), MakeHullShape(myTrans, *this), HullMinSeparation(*this, myTrans), slop, out);
+}
+bool ConvexHullCollision::isOverlapWithCapsule(const ColliderPose& myTrans, const CapsuleCollision& capsule, const ColliderPose& transCap, ContactManifold& out, float slop) const
+{
+	const SupportShape a = MakeCapsuleShape(transCap, capsule);
+	const float minSep = std::min(HullMinSeparation(*this, myTrans), 0.25f * a.radius);
+	return ConvexManifold(a, MakeHullShape(myTrans, *this), minSep, slop, out);
+}
+bool ConvexHullCollision::isOverlapWithConvexHull(const ColliderPose& myTrans, const ConvexHullCollision& hull, const ColliderPose& transHull, ContactManifold& out, float slop) const
+{
+	const float minSep = std::min(HullMinSeparation(*this, myTrans), HullMinSeparation(hull, transHull));
+	return ConvexManifold(MakeHullShape(transHull, hull), MakeHullShape(myTrans, *this), minSep, slop, out);
+}
+// --------------------------------------------------
+// CONVEXHULL × HEIGHTMAP, TRIANGLEMESH
+// --------------------------------------------------
+bool ConvexHullCollision::isOverlapWithHeightMap(const ColliderPose& myTrans, const HeightMapCollision& map, const ColliderPose& transMap, ContactManifold& out, float slop) const
+{
+	bool b = map.isOverlapWithConvexHull(transMap, *this, myTrans, out, slop);
+	out.normal = -out.normal;
+	return b;
+}
+bool ConvexHullCollision::isOverlapWithTriangleMesh(const ColliderPose& myTrans, const TriangleMeshCollision& mesh, const ColliderPose& transMesh, ContactManifold& out, float slop) const
+{
+	bool b = mesh.isOverlapWithConvexHull(transMesh, *this, myTrans, out, slop);
+	out.normal = -out.normal;
+	return b;
 }
 
-// Y^
+// 備忘録
 /*
 // --------------------------------------------------
-// BOX ~ BOX iSATj
+// BOX × BOX （SAT方式）
 // --------------------------------------------------
 bool BoxCollision::isOverlapWithBox(const Transform& myTrans, const BoxCollision& box, const Transform& transBox, ContactManifold& out, float slop) const
 {
-	// lp
-	constexpr float EPS_LEN2 = 1e-10f; // ̒OQꖢȂ畽sƂ݂ȂXLbv
-	constexpr float MARGIN	 = 1e-5f;	// r̊ɏ
+	// 数値安定用
+	constexpr float EPS_LEN2 = 1e-10f; // 軸の長さ＾２がこれ未満なら平行とみなしスキップ
+	constexpr float MARGIN	 = 1e-5f;	// 比較の緩衝
 
-	// ----- BoxA, B ̎Px擾Ă -----
+	// ----- BoxA, B の軸を１度だけ取得しておく -----
 	const Vector3 aX = myTrans.GetRight();
 	const Vector3 aY = myTrans.GetUp();
 	const Vector3 aZ = myTrans.GetForward();
@@ -1545,33 +2514,33 @@ bool BoxCollision::isOverlapWithBox(const Transform& myTrans, const BoxCollision
 	const Vector3 bY = transBox.GetUp();
 	const Vector3 bZ = transBox.GetForward();
 
-	// ----- W߂ -----
+	// ----- 軸を集める -----
 	Vector3 listAxis[15];
-	// BoxÂR
+	// BoxAの３軸
 	listAxis[0] = aX;
 	listAxis[1] = aY;
 	listAxis[2] = aZ;
-	// BoxB̂R
+	// BoxBの３軸
 	listAxis[3] = bX;
 	listAxis[4] = bY;
 	listAxis[5] = bZ;
-	// ̎̃NXX
-	int index = 6; // Û
+	// 上の軸のクロス９軸
+	int index = 6; // ６から入れるので
 	for (int ia = 0; ia < 3; ia++)
 	{
 		for (int ib = 3; ib < 6; ib++)
 		{
 			Vector3 cross = Vector3::Cross(listAxis[ia], listAxis[ib]);
-			if (cross.lengthSq() < EPS_LEN2) continue; // OςOɌȂ߂@@قڕs@@ƂĖ
-			cross.normalize(); // K
-			listAxis[index++] = cross; // KɊi[
+			if (cross.lengthSq() < EPS_LEN2) continue; // 外積が０に限りなく近い　→　ほぼ平行　→　分離軸として無効
+			cross.normalize(); // 正規化
+			listAxis[index++] = cross; // 正規化後に格納
 		}
 	}
 
-	// ----- e̔iSATj -----
-	// Box Ԃ̃xNg
+	// ----- 各軸の判定（SAT） -----
+	// Box 間のベクトル
 	Vector3 vect = transBox.position - myTrans.position;
-	// e Box ̔GNXegiXP[Kpj
+	// 各 Box の半エクステント（スケール適用）
 	Vector3 extentA = {
 		fabsf(myTrans.scale.x) * m_HalfSize.x,
 		fabsf(myTrans.scale.y) * m_HalfSize.y,
@@ -1583,13 +2552,13 @@ bool BoxCollision::isOverlapWithBox(const Transform& myTrans, const BoxCollision
 		fabsf(transBox.scale.z) * box.HalfSize().z,
 	};
 
-	// ẽ`FbN
+	// 各軸のチェック
 	for (int i = 0; i < index; i++)
 	{
-		// Sԋɓe
+		// 中心間距離を軸上に投影
 		float dist = fabsf(Vector3::Dot(vect, listAxis[i]));
 
-		// ea
+		// 投影半径
 		float rA = extentA.x * fabsf(Vector3::Dot(aX, listAxis[i]))
 				 + extentA.y * fabsf(Vector3::Dot(aY, listAxis[i]))
 				 + extentA.z * fabsf(Vector3::Dot(aZ, listAxis[i]));
@@ -1597,9 +2566,9 @@ bool BoxCollision::isOverlapWithBox(const Transform& myTrans, const BoxCollision
 				 + extentB.y * fabsf(Vector3::Dot(bY, listAxis[i]))
 				 + extentB.z * fabsf(Vector3::Dot(bZ, listAxis[i]));
 
-		if (dist > rA + rB + MARGIN) return false; // Ă̂ false
+		if (dist > rA + rB + MARGIN) return false; // 分離しているので false
 	}
 
-	return true; // SĂ̔ʂ̂ true
+	return true; // 全ての判定を通ったので true
 }
 */
\ No newline at end of file
@@ -4,10 +4,11 @@
 */
 #ifndef COLLISION_H_
 #define COLLISION_H_
+#include <memory>
 #include "Vector3.h"
 
 // ==================================================
-// ----- \ -----
+// ----- 構造体 -----
 // ==================================================
 struct AABB
 {
@@ -18,23 +19,58 @@ struct AABB
 			  || max.y < o.min.y || min.y > o.max.y
 			  || max.z < o.min.z || min.z > o.max.z);
 	}
+	// o をすっぽり含むか
+	bool isContain(const AABB& o) const
+	{
+		return min.x <= o.min.x && o.max.x <= max.x
+			&& min.y <= o.min.y && o.max.y <= max.y
+			&& min.z <= o.min.z && o.max.z <= max.z;
+	}
+	// レイ（スラブ法）。invDir は方向の逆数（０成分は大きな値にしておく）
+	// 分岐を減らすため３軸まとめて計算してから比べる
+	bool isOverlapRay(const Vector3& origin, const Vector3& invDir, float maxDist) const
+	{
+		const float x0 = (min.x - origin.x) * invDir.x, x1 = (max.x - origin.x) * invDir.x;
+		const float y0 = (min.y - origin.y) * invDir.y, y1 = (max.y - origin.y) * invDir.y;
+		const float z0 = (min.z - origin.z) * invDir.z, z1 = (max.z - origin.z) * invDir.z;
+		const float nearX = x0 < x1 ? x0 : x1, farX = x0 < x1 ? x1 : x0;
+		const float nearY = y0 < y1 ? y0 : y1, farY = y0 < y1 ? y1 : y0;
+		const float nearZ = z0 < z1 ? z0 : z1, farZ = z0 < z1 ? z1 : z0;
+		float tEnter = nearX > nearY ? nearX : nearY;
+		tEnter = tEnter > nearZ ? tEnter : nearZ;
+		tEnter = tEnter > 0.0f ? tEnter : 0.0f;
+		float tExit = farX < farY ? farX : farY;
+		tExit = tExit < farZ ? tExit : farZ;
+		tExit = tExit < maxDist ? tExit : maxDist;
+		return tEnter <= tExit;
+	}
+};
+struct RayHit
+{
+	float distance = 0.0f; // 始点からの距離
+	Vector3 point{};	   // 当たった点
+	Vector3 normal{};	   // 当たった面の法線（始点側を向く）
 };
 
 // ==================================================
-// ----- O錾 -----
+// ----- 前方宣言 -----
 // ==================================================
 class GameObject;
 class TransformComponent; 
-struct ContactManifold; // RCc̓NXȂ̂Œ
+struct ContactManifold; // コイツはクラスじゃないので注意
 class BoxCollision; 
 class SphereCollision; 
 class CapsuleCollision;
 class HeightMapCollision;
+class TriangleMeshCollision;
+class TriangleMeshBVH;
+class ConvexHullCollision;
+class ConvexHull;
 struct Triangle;
 struct ColliderPose;
 
 // ==================================================
-// ----- RDRWC^tF[X -----
+// ----- ３Dコリジョンインタフェース -----
 // ==================================================
 class Collision
 {
@@ -42,18 +78,26 @@ public:
 	virtual ~Collision() = default;
 
 	// --------------------------------------------------
-	// u[hp
+	// ブロード用
     // --------------------------------------------------
 	virtual AABB ComputeWorldAABB(const ColliderPose& ownerTrans) const = 0;
 
 	// --------------------------------------------------
-	// _ufBXpb`
+	// レイキャスト（dir は正規化済み、maxDist まで）
+	// 始点が形状の内側にある場合は当たらない
+	// --------------------------------------------------
+	virtual bool Raycast(const ColliderPose& myTrans, const Vector3& origin, const Vector3& dir, float maxDist, RayHit& out) const = 0;
+
+	// --------------------------------------------------
+	// ダブルディスパッチ方式
     // --------------------------------------------------
 	virtual bool isOverlap			   (const ColliderPose& myTrans, const Collision& collisionB,	    const ColliderPose& transB  , ContactManifold& out, float slop) const = 0;
 	virtual bool isOverlapWithBox	   (const ColliderPose& myTrans, const BoxCollision& box,		    const ColliderPose& transBox, ContactManifold& out, float slop) const = 0;
 	virtual bool isOverlapWithSphere   (const ColliderPose& myTrans, const SphereCollision& sphere,	const ColliderPose& transSph, ContactManifold& out, float slop) const = 0;
 	virtual bool isOverlapWithCapsule  (const ColliderPose& myTrans, const CapsuleCollision& capsule, const ColliderPose& transCap, ContactManifold& out, float slop) const = 0;
 	virtual bool isOverlapWithHeightMap(const ColliderPose& myTrans, const HeightMapCollision& map,   const ColliderPose& transMap, ContactManifold& out, float slop) const = 0;
+	virtual bool isOverlapWithTriangleMesh(const ColliderPose& myTrans, const TriangleMeshCollision& mesh, const ColliderPose& transMesh, ContactManifold& out, float slop) const = 0;
+	virtual bool isOverlapWithConvexHull(const ColliderPose& myTrans, const ConvexHullCollision& hull, const ColliderPose& transHull, ContactManifold& out, float slop) const = 0;
 };
 
 // ==================================================
@@ -62,7 +106,7 @@ public:
 class BoxCollision : public Collision
 {
 private:
-	Vector3 m_HalfSize; // ̃TCY
+	Vector3 m_HalfSize; // 半分のサイズ
 
 public:
 	BoxCollision(const Vector3& halfSize) : m_HalfSize(halfSize) {}
@@ -70,12 +114,15 @@ public:
 	const Vector3& HalfSize() const { return m_HalfSize; }
 
 	AABB ComputeWorldAABB(const ColliderPose& ownerTrans) const override;
+	bool Raycast(const ColliderPose& myTrans, const Vector3& origin, const Vector3& dir, float maxDist, RayHit& out) const override;
 
 	bool isOverlap			 (const ColliderPose& myTrans, const Collision& collisionB,	  const ColliderPose& transB  , ContactManifold& out, float slop) const override;
 	bool isOverlapWithBox	 (const ColliderPose& myTrans, const BoxCollision& box,		  const ColliderPose& transBox, ContactManifold& out, float slop) const override;
 	bool isOverlapWithSphere (const ColliderPose& myTrans, const SphereCollision& sphere,	  const ColliderPose& transSph, ContactManifold& out, float slop) const override;
 	bool isOverlapWithCapsule(const ColliderPose& myTrans, const CapsuleCollision& capsule, const ColliderPose& transCap, ContactManifold& out, float slop) const override;
 	bool isOverlapWithHeightMap(const ColliderPose& myTrans, const HeightMapCollision& map, const ColliderPose& transMap, ContactManifold& out, float slop) const override;
+	bool isOverlapWithTriangleMesh(const ColliderPose& myTrans, const TriangleMeshCollision& mesh, const ColliderPose& transMesh, ContactManifold& out, float slop) const override;
+	bool isOverlapWithConvexHull(const ColliderPose& myTrans, const ConvexHullCollision& hull, const ColliderPose& transHull, ContactManifold& out, float slop) const override;
 };
 
 // ==================================================
@@ -84,20 +131,26 @@ public:
 class SphereCollision : public Collision
 {
 private:
-	float m_Radius; // a
+	float m_Radius; // 半径
 
 public:
 	SphereCollision(float radius) : m_Radius(radius) {}
 
 	float Radius() const { return m_Radius; }
 
+	// 球 × 球の本体（isOverlapWithSphere と ShapeDispatch から呼ぶ、半径はスケール反映済み）
+	static bool OverlapSpheres(const Vector3& myCenter, float myRadius, const Vector3& otherCenter, float otherRadius, ContactManifold& out, float slop);
+
 	AABB ComputeWorldAABB(const ColliderPose& ownerTrans) const override;
+	bool Raycast(const ColliderPose& myTrans, const Vector3& origin, const Vector3& dir, float maxDist, RayHit& out) const override;
 
 	bool isOverlap			 (const ColliderPose& myTrans, const Collision& collisionB,	  const ColliderPose& transB  , ContactManifold& out, float slop) const override;
 	bool isOverlapWithBox	 (const ColliderPose& myTrans, const BoxCollision& box,		  const ColliderPose& transBox, ContactManifold& out, float slop) const override;
 	bool isOverlapWithSphere (const ColliderPose& myTrans, const SphereCollision& sphere,	  const ColliderPose& transSph, ContactManifold& out, float slop) const override;
 	bool isOverlapWithCapsule(const ColliderPose& myTrans, const CapsuleCollision& capsule, const ColliderPose& transCap, ContactManifold& out, float slop) const override;
 	bool isOverlapWithHeightMap(const ColliderPose& myTrans, const HeightMapCollision& map, const ColliderPose& transMap, ContactManifold& out, float slop) const override;
+	bool isOverlapWithTriangleMesh(const ColliderPose& myTrans, const TriangleMeshCollision& mesh, const ColliderPose& transMesh, ContactManifold& out, float slop) const override;
+	bool isOverlapWithConvexHull(const ColliderPose& myTrans, const ConvexHullCollision& hull, const ColliderPose& transHull, ContactManifold& out, float slop) const override;
 };
 
 // ==================================================
@@ -106,8 +159,8 @@ public:
 class CapsuleCollision : public Collision
 {
 private:
-	float m_Radius = 1.0f; // a
-	float m_CylinderHeight = 1.0f; // 
+	float m_Radius = 1.0f; // 半径
+	float m_CylinderHeight = 1.0f; // 高さ
 
 public:
 	CapsuleCollision(float radius, float cylinderHeight) : m_Radius(radius), m_CylinderHeight(cylinderHeight) {}
@@ -116,12 +169,15 @@ public:
 	float CylinderHeight() const { return m_CylinderHeight; }
 
 	AABB ComputeWorldAABB(const ColliderPose& ownerTrans) const override;
+	bool Raycast(const ColliderPose& myTrans, const Vector3& origin, const Vector3& dir, float maxDist, RayHit& out) const override;
 	
 	bool isOverlap			 (const ColliderPose& myTrans, const Collision& collisionB,	  const ColliderPose& transB  , ContactManifold& out, float slop) const override;
 	bool isOverlapWithBox	 (const ColliderPose& myTrans, const BoxCollision& box,		  const ColliderPose& transBox, ContactManifold& out, float slop) const override;
 	bool isOverlapWithSphere (const ColliderPose& myTrans, const SphereCollision& sphere,	  const ColliderPose& transSph, ContactManifold& out, float slop) const override;
 	bool isOverlapWithCapsule(const ColliderPose& myTrans, const CapsuleCollision& capsule, const ColliderPose& transCap, ContactManifold& out, float slop) const override;
 	bool isOverlapWithHeightMap(const ColliderPose& myTrans, const HeightMapCollision& map, const ColliderPose& transMap, ContactManifold& out, float slop) const override;
+	bool isOverlapWithTriangleMesh(const ColliderPose& myTrans, const TriangleMeshCollision& mesh, const ColliderPose& transMesh, ContactManifold& out, float slop) const override;
+	bool isOverlapWithConvexHull(const ColliderPose& myTrans, const ConvexHullCollision& hull, const ColliderPose& transHull, ContactManifold& out, float slop) const override;
 };
 
 // ==================================================
@@ -130,17 +186,28 @@ public:
 class HeightMapCollision : public Collision
 {
 private:
-	int m_Width = 100; // }bvTCY
-	int m_Depth = 100; // }bvTCY
-	float m_CellSizeX = 1.0f; // ZTCY
-	float m_CellSizeZ = 1.0f; // ZTCY
-	std::vector<float> m_Heights; // }bv
+	int m_Width = 100; // マップサイズ
+	int m_Depth = 100; // マップサイズ
+	float m_CellSizeX = 1.0f; // セルサイズ
+	float m_CellSizeZ = 1.0f; // セルサイズ
+	std::vector<float> m_Heights; // 高さマップ
 
-	// LbV
+	// キャッシュ
 	float m_MinHeight = 0.0f;
 	float m_MaxHeight = 0.0f;
-	// Ή Triangle ̌vZ
-	bool BuildCellTrianglesWorld(int i, int j, const ColliderPose& myTrans, Triangle& out0, Triangle& out1) const;
+
+	// --------------------------------------------------
+	// 高さのピラミッド（四分木）
+	// [0] 段目がセルごとの４頂点の min / max、上の段は下の段の２ｘ２をまとめたもの
+	// 一番上は１ｘ１（マップ全体）
+	// --------------------------------------------------
+	struct HeightRange { float min, max; };
+	struct PyramidLevel { int offset, width, depth; }; // m_Pyramid の中の位置と、その段のブロック数
+	static constexpr int MaxPyramidStack = 128; // 探索用スタックの深さ（段数 x 3 + 1 あれば足りる）
+	std::vector<HeightRange>  m_Pyramid;
+	std::vector<PyramidLevel> m_PyramidLevels;
+
+	void BuildHeightPyramid();
 public:
 	HeightMapCollision(int width, int depth, float cellSizeX, float cellSizeZ, std::vector<float> heights) : m_Width(width), m_Depth(depth), m_CellSizeX(cellSizeX), m_CellSizeZ(cellSizeZ), m_Heights(heights) 
 	{
@@ -149,7 +216,7 @@ public:
 
 		float min = m_Heights[0];
 		float max = m_Heights[0];
-		for (int i = 0; i < m_Heights.size(); i++)
+		for (int i = 0; i < static_cast<int>(m_Heights.size()); i++)
 		{
 			float height = m_Heights[i];
 			if (min > height) min = height;
@@ -157,6 +224,8 @@ public:
 		}
 		m_MinHeight = min;
 		m_MaxHeight = max;
+
+		BuildHeightPyramid();
 	}
 
 	float Width() const { return m_Width; }
@@ -166,13 +235,143 @@ public:
 	const std::vector<float>& Heights() const { return m_Heights; };
 	float GetHeight(int x, int z) const { return m_Heights[z * m_Width + x]; }
 
+	// 対応する Triangle の計算
+	bool BuildCellTrianglesWorld(int i, int j, const ColliderPose& myTrans, Triangle& out0, Triangle& out1) const;
+	// ワールド AABB が掛かるセル範囲（[iMin, iMax] x [jMin, jMax]、掛からなければ false）
+	bool ComputeCellRange(const ColliderPose& myTrans, const AABB& aabb, int& iMin, int& iMax, int& jMin, int& jMax) const;
+	// セル(i, j) の４頂点の高さの min / max（ローカル）
+	const HeightRange& CellHeightRange(int i, int j) const { return m_Pyramid[j * (m_Width - 1) + i]; }
+	// --------------------------------------------------
+	// セル範囲 [iMin, iMax] x [jMin, jMax] のうち、ローカルの高さ [yMin, yMax] に掛かるセルごとに f(i, j) を呼ぶ
+	// ピラミッドを上から辿って、範囲にも高さにも掛からないブロックはまとめて飛ばす
+	// --------------------------------------------------
+	template<class F>
+	void ForEachCellInRange(int iMin, int iMax, int jMin, int jMax, float yMin, float yMax, F&& f) const
+	{
+		if (iMin > iMax || jMin > jMax || m_PyramidLevels.empty()) return;
+
+		iMin = iMin < 0 ? 0 : iMin;
+		jMin = jMin < 0 ? 0 : jMin;
+		iMax = iMax > m_Width - 2 ? m_Width - 2 : iMax;
+		jMax = jMax > m_Depth - 2 ? m_Depth - 2 : jMax;
+		if (iMin > iMax || jMin > jMax) return;
+
+		struct Entry { int level, x, z; };
+		Entry stack[MaxPyramidStack];
+		int top = 0;
+
+		// ----- 範囲が２ｘ２ブロックに収まる一番下の段から始める（小さい範囲で根から降りてこないように） -----
+		int start = 0;
+		while (start + 1 < (int)m_PyramidLevels.size()
+			&& ((iMax >> start) - (iMin >> start) > 1 || (jMax >> start) - (jMin >> start) > 1))
+			start++;
+		for (int z = jMax >> start; z >= (jMin >> start); z--)
+			for (int x = iMax >> start; x >= (iMin >> start); x--)
+				stack[top++] = { start, x, z };
+		while (top > 0)
+		{
+			const Entry e = stack[--top];
+			const PyramidLevel& level = m_PyramidLevels[e.level];
+
+			// ----- このブロックが覆うセル範囲と高さ -----
+			const int x0 = e.x << e.level, x1 = ((e.x + 1) << e.level) - 1;
+			const int z0 = e.z << e.level, z1 = ((e.z + 1) << e.level) - 1;
+			if (x1 < iMin || x0 > iMax || z1 < jMin || z0 > jMax) continue;
+			const HeightRange& range = m_Pyramid[level.offset + e.z * level.width + e.x];
+			if (range.max < yMin || range.min > yMax) continue;
+
+			if (e.level == 0)
+			{
+				f(e.x, e.z);
+				continue;
+			}
+
+			// ----- 子の２ｘ２ -----
+			const PyramidLevel& child = m_PyramidLevels[e.level - 1];
+			for (int dz = 1; dz >= 0; dz--)
+			{
+				for (int dx = 1; dx >= 0; dx--)
+				{
+					const int cx = e.x * 2 + dx, cz = e.z * 2 + dz;
+					if (cx >= child.width || cz >= child.depth) continue;
+					assert(top < MaxPyramidStack && "HeightMap pyramid stack overflow");
+					stack[top++] = { e.level - 1, cx, cz };
+				}
+			}
+		}
+	}
+
+	AABB ComputeWorldAABB(const ColliderPose& ownerTrans) const override;
+	bool Raycast(const ColliderPose& myTrans, const Vector3& origin, const Vector3& dir, float maxDist, RayHit& out) const override;
+
+	bool isOverlap			 (const ColliderPose& myTrans, const Collision& collisionB,	  const ColliderPose& transB,   ContactManifold& out, float slop) const override;
+	bool isOverlapWithBox	 (const ColliderPose& myTrans, const BoxCollision& box,		  const ColliderPose& transBox, ContactManifold& out, float slop) const override;
+	bool isOverlapWithSphere (const ColliderPose& myTrans, const SphereCollision& sphere,	  const ColliderPose& transSph, ContactManifold& out, float slop) const override;
+	bool isOverlapWithCapsule(const ColliderPose& myTrans, const CapsuleCollision& capsule, const ColliderPose& transCap, ContactManifold& out, float slop) const override;
+	bool isOverlapWithHeightMap(const ColliderPose& myTrans, const HeightMapCollision& map, const ColliderPose& transMap, ContactManifold& out, float slop) const override;
+	bool isOverlapWithTriangleMesh(const ColliderPose& myTrans, const TriangleMeshCollision& mesh, const ColliderPose& transMesh, ContactManifold& out, float slop) const override;
+	bool isOverlapWithConvexHull(const ColliderPose& myTrans, const ConvexHullCollision& hull, const ColliderPose& transHull, ContactManifold& out, float slop) const override;
+};
+
+// ==================================================
+// ----- TriangleMesh -----
+// 静的なモデル用（Rigidbody は Static で使う）
+// 三角形はローカル空間の BVH で持ち、同じアセット同士で共有する
+// ==================================================
+class TriangleMeshCollision : public Collision
+{
+private:
+	std::shared_ptr<const TriangleMeshBVH> m_pMesh;
+
+public:
+	TriangleMeshCollision(std::shared_ptr<const TriangleMeshBVH> mesh) : m_pMesh(std::move(mesh)) { assert(m_pMesh); }
+
+	const TriangleMeshBVH& Mesh() const { return *m_pMesh; }
+
+	// --------------------------------------------------
+	// ワールド AABB に掛かる三角形ごとに f(Triangle（ワールド）) を呼ぶ
+	// 定義は TriangleMeshBVH.h（BVH の中身が要るので）
+	// --------------------------------------------------
+	template<class F>
+	void ForEachTriangleInAABB(const ColliderPose& myTrans, const AABB& worldBox, F&& f) const;
+
+	AABB ComputeWorldAABB(const ColliderPose& ownerTrans) const override;
+	bool Raycast(const ColliderPose& myTrans, const Vector3& origin, const Vector3& dir, float maxDist, RayHit& out) const override;
+
+	bool isOverlap			 (const ColliderPose& myTrans, const Collision& collisionB,	  const ColliderPose& transB,   ContactManifold& out, float slop) const override;
+	bool isOverlapWithBox	 (const ColliderPose& myTrans, const BoxCollision& box,		  const ColliderPose& transBox, ContactManifold& out, float slop) const override;
+	bool isOverlapWithSphere (const ColliderPose& myTrans, const SphereCollision& sphere,	  const ColliderPose& transSph, ContactManifold& out, float slop) const override;
+	bool isOverlapWithCapsule(const ColliderPose& myTrans, const CapsuleCollision& capsule, const ColliderPose& transCap, ContactManifold& out, float slop) const override;
+	bool isOverlapWithHeightMap(const ColliderPose& myTrans, const HeightMapCollision& map, const ColliderPose& transMap, ContactManifold& out, float slop) const override;
+	bool isOverlapWithTriangleMesh(const ColliderPose& myTrans, const TriangleMeshCollision& mesh, const ColliderPose& transMesh, ContactManifold& out, float slop) const override;
+	bool isOverlapWithConvexHull(const ColliderPose& myTrans, const ConvexHullCollision& hull, const ColliderPose& transHull, ContactManifold& out, float slop) const override;
+};
+
+// ==================================================
+// ----- ConvexHull -----
+// 頂点群から作った凸包（GJK / EPA で判定し、面のクリップで接触点を補う）
+// 凸包はローカル空間で持ち、同じアセット同士で共有する
+// ==================================================
+class ConvexHullCollision : public Collision
+{
+private:
+	std::shared_ptr<const ConvexHull> m_pHull;
+
+public:
+	ConvexHullCollision(std::shared_ptr<const ConvexHull> hull) : m_pHull(std::move(hull)) { assert(m_pHull); }
+
+	const ConvexHull& Hull() const { return *m_pHull; }
+
 	AABB ComputeWorldAABB(const ColliderPose& ownerTrans) const override;
+	bool Raycast(const ColliderPose& myTrans, const Vector3& origin, const Vector3& dir, float maxDist, RayHit& out) const override;
 
 	bool isOverlap			 (const ColliderPose& myTrans, const Collision& collisionB,	  const ColliderPose& transB,   ContactManifold& out, float slop) const override;
 	bool isOverlapWithBox	 (const ColliderPose& myTrans, const BoxCollision& box,		  const ColliderPose& transBox, ContactManifold& out, float slop) const override;
 	bool isOverlapWithSphere (const ColliderPose& myTrans, const SphereCollision& sphere,	  const ColliderPose& transSph, ContactManifold& out, float slop) const override;
 	bool isOverlapWithCapsule(const ColliderPose& myTrans, const CapsuleCollision& capsule, const ColliderPose& transCap, ContactManifold& out, float slop) const override;
 	bool isOverlapWithHeightMap(const ColliderPose& myTrans, const HeightMapCollision& map, const ColliderPose& transMap, ContactManifold& out, float slop) const override;
+	bool isOverlapWithTriangleMesh(const ColliderPose& myTrans, const TriangleMeshCollision& mesh, const ColliderPose& transMesh, ContactManifold& out, float slop) const override;
+	bool isOverlapWithConvexHull(const ColliderPose& myTrans, const ConvexHullCollision& hull, const ColliderPose& transHull, ContactManifold& out, float slop) const override;
 };
 
 #endif
\ No newline at end of file
@@ -34,7 +34,7 @@ void Game::Init()
 {
 	Scene::Init();
 
-	// J -----
+	// カメラ -----
 	{
 		Camera* pCamera = AddGameObject<Camera>(0);
 		pCamera->Init();
@@ -51,7 +51,7 @@ void Game::Init()
 		//as->Play();
 	}
 	{
-		// 2DJ
+		// 2Dカメラ
 		Camera* pCamera = AddGameObject<Camera>(0);
 		pCamera->Init();
 
@@ -74,19 +74,19 @@ void Game::Init()
 	pLightObject->Init();
 	pLightObject->Transform()->SetPosition({ -7, 0, 0 });*/
 
-	// vC[ -----
+	// プレイヤー -----
 	PlayerObject* pPlayer = AddGameObject<PlayerObject>(1);
 	pPlayer->Init();
 
-	//// ThobO
+	//// サンドバッグ
 	//SandbagObject* pSandbag = AddGameObject<SandbagObject>(1);
 	//pSandbag->Init();
 
-	//// m
+	//// ノレン
 	//NorenObject* pNoren = AddGameObject<NorenObject>(1);
 	//pNoren->Init();
 
-	// -----
+	// りんご-----
 	AppleObject* pApple = AddGameObject<AppleObject>(1);
 	pApple->Init();
 	pApple->Transform()->SetPosition({ 3, -3, 3 });
@@ -114,7 +114,7 @@ void Game::Init()
 		}
 	}
 	
-	// Gl~[ -----
+	// エネミー -----
 	Enemy* pEnemy = AddGameObject<Enemy>(1);
 	pEnemy->Init();
 	pEnemy->Transform()->SetPosition({5, 3, 0});
@@ -153,14 +153,14 @@ void Game::Init()
 	hjc->SetSpringTarget(3);
 	hjc->RegisterToPhysicsSystem();*/
 
-	// 
+	// 床
 	pEnemy = AddGameObject<Enemy>(1);
 	pEnemy->Init();
 	pEnemy->Transform()->SetPosition({ 0, -10, 0 });
 	pEnemy->Transform()->SetScale({ 10, 5, 10 });
 	pEnemy->Transform()->SetEulerAngles({ 0, 0, 0.1f });
 	pEnemy->GetComponent<Collider>()->SetBox({ 1, 1, 1 });
-	pEnemy->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Static); // 
+	pEnemy->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Static); // 壁
 	//djc = pEnemy->AddComponent<DistanceJointComponent>();
 	//djc->SetOtherObject(pPlayerEx);
 	//djc->SetLocalAnchorA(Vector3(0, 5, 0));
@@ -168,36 +168,36 @@ void Game::Init()
 	//djc->SetMode(DistanceJointComponent::DistanceJointMode::Rope);
 	//djc->RegisterToPhysicsSystem();
 
-	// ǂS
+	// 壁４方
 	pEnemy = AddGameObject<Enemy>(1);
 	pEnemy->Init();
 	pEnemy->Transform()->SetPosition({ 10.5f, -4, 0 });
 	pEnemy->Transform()->SetScale({ 1, 5, 10 });
 	pEnemy->GetComponent<Collider>()->SetBox({ 1, 1, 1 });
-	pEnemy->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Static); // 
+	pEnemy->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Static); // 壁
 	
 	pEnemy = AddGameObject<Enemy>(1);
 	pEnemy->Init();
 	pEnemy->Transform()->SetPosition({ -10.5f, -4, 0 });
 	pEnemy->Transform()->SetScale({ 1, 1, 10 });
 	pEnemy->GetComponent<Collider>()->SetBox({ 1, 1, 1 });
-	pEnemy->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Static); // 
+	pEnemy->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Static); // 壁
 
 	pEnemy = AddGameObject<Enemy>(1);
 	pEnemy->Init();
 	pEnemy->Transform()->SetPosition({ 0, -4, 10.5f });
 	pEnemy->Transform()->SetScale({ 10, 1, 1 });
 	pEnemy->GetComponent<Collider>()->SetBox({ 1, 1, 1 });
-	pEnemy->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Static); // 
+	pEnemy->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Static); // 壁
 
 	pEnemy = AddGameObject<Enemy>(1);
 	pEnemy->Init();
 	pEnemy->Transform()->SetPosition({ 0, -4, -10.5f });
 	pEnemy->Transform()->SetScale({ 10, 1, 1 });
 	pEnemy->GetComponent<Collider>()->SetBox({ 1, 1, 1 });
-	pEnemy->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Static); // 
+	pEnemy->GetComponent<Rigidbody>()->SetBodyType(Rigidbody::BodyType::Static); // 壁
 
-	// Cg֌W
+	// ライト関係
 	LightApp light = {};
 	light.enable	= 1;
 	light.diffuse   = Vector4(1.0f, 1.0f, 1.0f, 1.0f);
@@ -205,14 +205,14 @@ void Game::Init()
 	light.direction = Vector4(0.3f, -1.0f, 0.0f, 0.0f).normalized();
 	Renderer::SetLight(light);
 
-	// bVtB[h
+	// メッシュフィールド
 	Field* pField = AddGameObject<Field>(1);
 	pField->Init();
 	pField->Transform()->SetPosition({ -40, -7, -40 });
 
 
 
-	// VF[_[֌W
+	// シェーダー関係
 	ToonApp toon = MakeToon(ToonPreset::GravityRush2Like);
 	Renderer::SetToon(toon);
 
@@ -8,17 +8,17 @@
 
 void Polygon2D::Init()
 {
-    // 1) Transformi GameObject ctor Œǉς݁j擾ďpĂ
+    // 1) Transform（既に GameObject ctor で追加済み）を取得して初期姿勢を入れておく
     auto* tf = GetComponent<TransformComponent>();
     tf->SetPosition({ 0,0,0 });
     tf->SetScale({ 1,1,1 });
     tf->SetEulerAngles({ 0,0,0 });
 
-    // 2) MeshFilter ǉĒ_obt@i4_̋`j
+    // 2) MeshFilter を追加して頂点バッファ（4頂点の矩形）を作る
     auto* mf = AddComponent<MeshFilterComponent>();
     MeshFactory::CreateQuad(mf, { 200.0f, 200.0f, false });
 
-    // 3) Material ǉiVF[_/eNX`/}eAj
+    // 3) Material を追加（シェーダ/テクスチャ/マテリアル）
     auto* mat = AddComponent<MaterialComponent>();
 
     ID3D11VertexShader* vs = nullptr;
@@ -28,9 +28,9 @@ void Polygon2D::Init()
     Renderer::CreatePixelShader(&ps, "shader\\PS_Sprite.cso");
     mat->SetVSPS(vs, ps, il, /*takeVS*/true, /*takePS*/true, /*takeIL*/true);
 
-    //  Polygon2D Ɠ kirby g
+    // 旧 Polygon2D と同じ kirby を使う
     ID3D11ShaderResourceView* srv = Texture::LoadAndRegisterKey("assets\\texture\\PlayerDead.png");
-    // Tv[ Renderer::Init()  0Ԃ PSSetSamplers ς݂Ȃ null ł`
+    // サンプラーは Renderer::Init() で 0番に PSSetSamplers 済みなら null でも描ける
     mat->SetMainTexture(srv, /*sampler*/nullptr, /*takeSrv*/false, /*takeSamp*/false);
 
     MaterialApp m{};
@@ -39,10 +39,10 @@ void Polygon2D::Init()
     m.textureEnable = TRUE;
     mat->SetMaterial(m);
 
-    // eNX`̉\̂ŃAt@uh
+    // 透明テクスチャの可能性が高いのでアルファブレンドに
     mat->SetBlendMode(/*Alpha*/MaterialComponent::BlendMode::Alpha);
 
-    // 4) MeshRenderer ǉi`sWj
+    // 4) MeshRenderer を追加（描画実行係）
     auto* sr = AddComponent<SpriteRendererComponent>();
     sr->SetUI(true);
     sr->SetOnWorld(true);
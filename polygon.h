@@ -12,7 +12,7 @@
 #include "MaterialComponent.h"
 #include "MeshRendererComponent.h"
 #include "renderer.h"
-#include "texture.h"  // Texture::Load 
+#include "texture.h"  // Texture::Load 既存
 
 #include "SpriteAnimationComponent.h"
 
@@ -1,7 +1,7 @@
 /*
 	Renderer.cpp
 	20251007  hanaue sho
-	GPU֏𑗂oH
+	GPUへ情報を送る経路
 */
 #include "Renderer.h"
 #include <cstdio>
@@ -14,7 +14,7 @@ using namespace DirectX;
 #include "DebugRenderer.h"
 
 // ==================================================
-// ----- ÓIoϐ -----
+// ----- 静的メンバ変数生成 -----
 // ==================================================
 ComPtr<ID3D11Device>            Renderer::m_Device{};
 ComPtr<ID3D11DeviceContext>     Renderer::m_DeviceContext{};
@@ -54,24 +54,24 @@ ComPtr<ID3D11RasterizerState>   Renderer::m_RS_ShadowCaster;
 DebugRenderer*					Renderer::m_pDebugRenderer;
 
 // ==================================================
-//  u 
+// ※ 放置 ※
 // ==================================================
 D3D_FEATURE_LEVEL        Renderer::m_FeatureLevel = D3D_FEATURE_LEVEL_11_0;
 
 // --------------------------------------------------
-// EI
+// 初期化・終了処理
 // --------------------------------------------------
 void Renderer::Init(ID3D11Device* dev, ID3D11DeviceContext* ctx)
 {
 	// --------------------------------------------------
-	// foCX擾
+	// デバイス取得
 	// --------------------------------------------------
 	m_Device = dev;
 	m_DeviceContext = ctx;
-	m_FeatureLevel = m_Device ? m_Device->GetFeatureLevel() : D3D_FEATURE_LEVEL_11_0; // Ƃ肠
+	m_FeatureLevel = m_Device ? m_Device->GetFeatureLevel() : D3D_FEATURE_LEVEL_11_0; // とりあえず初期化
 
 	// --------------------------------------------------
-	// 萔obt@쐬
+	// 定数バッファ作成
 	// --------------------------------------------------
 	m_CB_Camera   = CreateCB<CameraCB>();
 	m_CB_Object	  = CreateCB<ObjectCB>();
@@ -86,7 +86,7 @@ void Renderer::Init(ID3D11Device* dev, ID3D11DeviceContext* ctx)
 	m_CB_Sprite	  = CreateCB<SpriteCB>();
 
 	// --------------------------------------------------
-	// VS/PS փoChiXbg 0..8 \j
+	// VS/PS へバインド（スロット 0..8 を予約）
 	// --------------------------------------------------
 	ID3D11Buffer* cbs[] = {
 		m_CB_Camera.Get(),   // b0
@@ -104,25 +104,25 @@ void Renderer::Init(ID3D11Device* dev, ID3D11DeviceContext* ctx)
 	m_DeviceContext->VSSetConstantBuffers(0, 11, cbs);
 	m_DeviceContext->PSSetConstantBuffers(0, 11, cbs);
 
-	// |CgCg[
+	// ポイントライトゼロ初期化
 	PointLightsCB zeroPL{};
-	zeroPL.pointLightCount = 0; // JEgOŏ
+	zeroPL.pointLightCount = 0; // カウントを０で初期化
 	UpdateCB(m_CB_PointLights.Get(), zeroPL);
 
 	// --------------------------------------------------
-	// X^CU
+	// ラスタライザ初期化
 	// --------------------------------------------------
 	ApplyDefaultRasterizer();
 
 	// --------------------------------------------------
-	// uhA[xXeV
+	// ブレンド、深度ステンシル生成
 	// --------------------------------------------------
 	CreateBlendStates();
 	CreateDepthStates(); 
 	CreateRasterizerStates();
 
 	// --------------------------------------------------
-	// fobO_[
+	// デバッグレンダラー
 	// --------------------------------------------------
 	m_pDebugRenderer = new DebugRenderer();
 	m_pDebugRenderer->Initialize();
@@ -131,19 +131,19 @@ void Renderer::Uninit()
 {
 	if (m_DeviceContext) m_DeviceContext->ClearState();
 
-	// ɃXe[g
+	// 先にステートを解放
 	m_DepthStateEnable.Reset();
 	m_DepthStateDisable.Reset();
 	m_BlendState.Reset();
 	m_BlendStateATC.Reset();
 
-	// ComPtr n Reset OK
+	// ComPtr 系は Reset でOK
 	m_CB_Light.Reset();
 	m_CB_Material.Reset();
 	m_CB_Object.Reset();
 	m_CB_Camera.Reset();
 
-	// uhXe[g
+	// ブレンドステート
 	m_BS_Opaque.Reset();
 	m_BS_Alpha.Reset();
 	m_BS_Premul.Reset();
@@ -172,15 +172,15 @@ void Renderer::Uninit()
 void Renderer::BeginFrame(const float clearColor[4])
 {
 	//float clearColor[4] = { 0.1f, 0.3f, 0.5f, 1.0f };
-	// ͋
+	// 今は空っぽ
 }
 void Renderer::EndFrame(int vsync)
 {
-	// ͋
+	// 今は空っぽ
 }
 
 // --------------------------------------------------
-// Zb^[
+// セッター
 // --------------------------------------------------
 void Renderer::SetCamera(const Matrix4x4& view,
 	const Matrix4x4& proj,
@@ -244,7 +244,7 @@ void Renderer::SetSprite(const SpriteApp& sprite)
 }
 
 // --------------------------------------------------
-// CB̍쐬
+// CBの作成
 // --------------------------------------------------
 template<class T>
 ComPtr<ID3D11Buffer> Renderer::CreateCB()
@@ -253,7 +253,7 @@ ComPtr<ID3D11Buffer> Renderer::CreateCB()
 	desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
 	desc.Usage = D3D11_USAGE_DEFAULT;
 	desc.CPUAccessFlags = 0;
-	// 16byte {
+	// 16byte 倍数
 	//desc.ByteWidth = (UINT)((sizeof(T) + 15) / 16 * 16);
 	desc.ByteWidth = (UINT)((sizeof(T) + 15) & ~15);
 	desc.MiscFlags = 0;
@@ -265,7 +265,7 @@ ComPtr<ID3D11Buffer> Renderer::CreateCB()
 	return buf;
 }
 // --------------------------------------------------
-// CB̍XV
+// CBの更新
 // --------------------------------------------------
 template<class T>
 void Renderer::UpdateCB(ID3D11Buffer* cb, const T& data)
@@ -274,7 +274,7 @@ void Renderer::UpdateCB(ID3D11Buffer* cb, const T& data)
 }
 
 // --------------------------------------------------
-// CB\̂̍쐬
+// CB構造体の作成
 // --------------------------------------------------
 static void CopyMat(float dst[16], const Matrix4x4& src)
 {
@@ -437,13 +437,13 @@ SpriteCB Renderer::BuildSpriteCB(const SpriteApp& sprite)
 	return cb;
 }
 // --------------------------------------------------
-// uhXe[g쐬
+// ブレンドステート作成
 // --------------------------------------------------
 void Renderer::CreateBlendStates()
 {
 	auto* dev = Device();
 
-	// s
+	// 不透明
 	D3D11_BLEND_DESC bd{};
 	bd.AlphaToCoverageEnable = FALSE;
 	bd.IndependentBlendEnable = FALSE;
@@ -452,25 +452,25 @@ void Renderer::CreateBlendStates()
 	HRESULT hr = dev->CreateBlendState(&bd, m_BS_Opaque.GetAddressOf());
 	assert(SUCCEEDED(hr));
 	
-	// ʏAt@
+	// 通常アルファ
 	m_BS_Alpha    = MakeBS(dev, FALSE,
 					   D3D11_BLEND_SRC_ALPHA, D3D11_BLEND_INV_SRC_ALPHA, D3D11_BLEND_OP_ADD,
 					   D3D11_BLEND_ONE,		  D3D11_BLEND_INV_SRC_ALPHA, D3D11_BLEND_OP_ADD
 					   );
 
-	// v}`
+	// プリマルチα
 	m_BS_Premul   = MakeBS(dev, FALSE,
 					   D3D11_BLEND_ONE, D3D11_BLEND_INV_SRC_ALPHA, D3D11_BLEND_OP_ADD,
 					   D3D11_BLEND_ONE,	D3D11_BLEND_INV_SRC_ALPHA, D3D11_BLEND_OP_ADD
 					   );
 
-	// ZiFZAێj
+	// 加算（色だけ加算、α保持）
 	m_BS_Add	  = MakeBS(dev, FALSE,
 					   D3D11_BLEND_ONE, D3D11_BLEND_ONE, D3D11_BLEND_OP_ADD,
 					   D3D11_BLEND_ZERO, D3D11_BLEND_ONE, D3D11_BLEND_OP_ADD
 					   );
 
-	// Z
+	// 乗算
 	m_BS_Multiply = MakeBS(dev, FALSE,
 					   D3D11_BLEND_DEST_COLOR, D3D11_BLEND_ZERO, D3D11_BLEND_OP_ADD,
 					   D3D11_BLEND_ONE,		   D3D11_BLEND_INV_SRC_ALPHA, D3D11_BLEND_OP_ADD
@@ -497,28 +497,28 @@ ComPtr<ID3D11BlendState> Renderer::MakeBS(ID3D11Device* dev, bool atc, D3D11_BLE
 	return bs;
 }
 // --------------------------------------------------
-// fvXXeVXe[g쐬
+// デプスステンシルステート作成
 // --------------------------------------------------
 void Renderer::CreateDepthStates()
 {
 	auto* dev = Device();
 
-	// s
+	// 不透明
 	m_DS_Opaque = MakeDS(dev, TRUE, D3D11_DEPTH_WRITE_MASK_ALL, D3D11_COMPARISON_LESS_EQUAL);
 
-	// iǂݐpj
+	// 半透明（読み専用）
 	m_DS_Transparent = MakeDS(dev, TRUE, D3D11_DEPTH_WRITE_MASK_ZERO, D3D11_COMPARISON_LESS_EQUAL);
 
-	// ZvpX
+	// Zプリパス
 	m_DS_ZPrepassWrite = MakeDS(dev, TRUE, D3D11_DEPTH_WRITE_MASK_ALL, D3D11_COMPARISON_LESS_EQUAL);
 
-	// Zv̂ݒF
+	// Z一致のみ着色
 	m_DS_ZEqualReadOnly = MakeDS(dev, TRUE, D3D11_DEPTH_WRITE_MASK_ZERO, D3D11_COMPARISON_EQUAL);
 
-	// AEgC
-	m_DS_OutlineLE = MakeDS(dev, TRUE, D3D11_DEPTH_WRITE_MASK_ZERO, D3D11_COMPARISON_LESS_EQUAL); // D3D11_COMPARISON_LESS_EQUAL ƂԂ₷
+	// アウトライン
+	m_DS_OutlineLE = MakeDS(dev, TRUE, D3D11_DEPTH_WRITE_MASK_ZERO, D3D11_COMPARISON_LESS_EQUAL); // D3D11_COMPARISON_LESS_EQUAL だとつぶれやすい
 
-	// [xȂ
+	// 深度なし
 	m_DS_Disable = MakeDS(dev, FALSE, D3D11_DEPTH_WRITE_MASK_ZERO, D3D11_COMPARISON_ALWAYS);
 }
 ComPtr<ID3D11DepthStencilState> Renderer::MakeDS(ID3D11Device* dev, BOOL depthEnable, D3D11_DEPTH_WRITE_MASK writeMask, D3D11_COMPARISON_FUNC depthFunc, BOOL stencilEnable, UINT8 readMask, UINT8 writeMaskStencil, D3D11_COMPARISON_FUNC stencilFunc, D3D11_STENCIL_OP passOp, D3D11_STENCIL_OP failOp, D3D11_STENCIL_OP zfailOp)
@@ -532,7 +532,7 @@ ComPtr<ID3D11DepthStencilState> Renderer::MakeDS(ID3D11Device* dev, BOOL depthEn
 	ds.StencilReadMask = readMask;
 	ds.StencilWriteMask = writeMaskStencil;
 
-	// OʁAwʂƂɂ
+	// 前面、背面とも同じにする例
 	ds.FrontFace.StencilFunc = stencilFunc;
 	ds.FrontFace.StencilPassOp = passOp;
 	ds.FrontFace.StencilFailOp = failOp;
@@ -545,40 +545,40 @@ ComPtr<ID3D11DepthStencilState> Renderer::MakeDS(ID3D11Device* dev, BOOL depthEn
 	return state;
 }
 // --------------------------------------------------
-// X^CUXe[g쐬
+// ラスタライザステート作成
 // --------------------------------------------------
 void Renderer::CreateRasterizerStates()
 {
 	auto* dev = Device();
 
-	// isAʏj
+	// 既定（不透明、通常）
 	m_RS_BackCull = MakeRS(dev, D3D11_FILL_SOLID, D3D11_CULL_BACK, FALSE, TRUE, FALSE, FALSE, FALSE, 0, 0, 0);
 
-	// AEgCiwʖ@FOʃJOj
-	m_RS_FrontCull = MakeRS(dev, D3D11_FILL_SOLID, D3D11_CULL_FRONT, FALSE, TRUE, FALSE, FALSE, FALSE, 0, 0.0f, 0.0f); // ŌォRԖڂ̈ -2 ƍhԂ₷iOƕCHj
+	// アウトライン（背面法：前面カリング）
+	m_RS_FrontCull = MakeRS(dev, D3D11_FILL_SOLID, D3D11_CULL_FRONT, FALSE, TRUE, FALSE, FALSE, FALSE, 0, 0.0f, 0.0f); // 最後から３番目の引数が -2 だと黒く塗りつぶされやすい（０だと平気？）
 
-	// _uTCh
+	// ダブルサイド
 	m_RS_NoCull = MakeRS(dev, D3D11_FILL_SOLID, D3D11_CULL_NONE, FALSE, TRUE, FALSE, FALSE, FALSE, 0, 0, 0);
 
-	// C[t[ifobOj
+	// ワイヤーフレーム（デバッグ）
 	m_RS_WireFrame = MakeRS(dev, D3D11_FILL_WIREFRAME, D3D11_CULL_BACK, FALSE, TRUE, FALSE, FALSE, FALSE, 0, 0, 0);
 
-	// VhE}bvp
+	// シャドウマップ用
 	m_RS_ShadowCaster = MakeRS(dev, D3D11_FILL_SOLID, D3D11_CULL_BACK, FALSE, TRUE, FALSE, FALSE, FALSE, 200, 1.0f, 0.0f);
 }
 ComPtr<ID3D11RasterizerState> Renderer::MakeRS(ID3D11Device* dev, D3D11_FILL_MODE fill, D3D11_CULL_MODE cull, BOOL frontCCW, BOOL depthClip, BOOL scissor, BOOL multisample, BOOL aaLine, INT depthBias, FLOAT slopeScaledBias, FLOAT depthBiasClamp)
 {
 	D3D11_RASTERIZER_DESC rd{};
-	rd.FillMode = fill; // Op`̓hԂ
-	rd.CullMode = cull; // ǂ̖ʂ̂Ă邩
-	rd.FrontCounterClockwise = frontCCW; // v肪\ʂ̃tO
-	rd.DepthClipEnable = depthClip;		 // NbvԂZŎNbv邩ǂ
-	rd.ScissorEnable = scissor;			 // VU[eXgg
-	rd.MultisampleEnable = multisample;  // MSAA X^CU̗p
-	rd.AntialiasedLineEnable = aaLine;   //  MSAA ̃C`̃AGCAXiOp`ɂ͖֌WBC̃fobO`ꂢɂƂ TRUE j
-	rd.DepthBias = depthBias;				   // [xoCAXiZt@CeBO}EeANl΍j
-	rd.SlopeScaledDepthBias = slopeScaledBias; // ۂ̃oCAX DepthBias * r + SlopScaledDepthBias * slop
-	rd.DepthBiasClamp = depthBiasClamp;		   // ̂ DepthBiasClamp ŃNv
+	rd.FillMode = fill; // 三角形の塗りつぶし
+	rd.CullMode = cull; // どちらの面を捨てるか
+	rd.FrontCounterClockwise = frontCCW; // 反時計回りが表面かのフラグ
+	rd.DepthClipEnable = depthClip;		 // クリップ空間のZで自動クリップするかどうか
+	rd.ScissorEnable = scissor;			 // シザーテストを使うか
+	rd.MultisampleEnable = multisample;  // MSAA ラスタライザの利用
+	rd.AntialiasedLineEnable = aaLine;   // 非 MSAA のライン描画のアンリエイリアス（三角形には無関係。ラインのデバッグ描画をきれいにしたいときに TRUE ）
+	rd.DepthBias = depthBias;				   // 深度バイアス（Zファイティング抑制・影アクネ対策）
+	rd.SlopeScaledDepthBias = slopeScaledBias; // 実際のバイアスは DepthBias * r + SlopScaledDepthBias * slop
+	rd.DepthBiasClamp = depthBiasClamp;		   // 上のを DepthBiasClamp でクランプする
 
 	ComPtr<ID3D11RasterizerState> rs;
 	HRESULT hr = dev->CreateRasterizerState(&rd, rs.GetAddressOf());
@@ -586,13 +586,13 @@ ComPtr<ID3D11RasterizerState> Renderer::MakeRS(ID3D11Device* dev, D3D11_FILL_MOD
 	return rs;
 }
 // --------------------------------------------------
-// ftHgXe[g쐬
+// デフォルトステート作成
 // --------------------------------------------------
 void Renderer::EnsureCommonStates()
 {
 	if (!m_Device) return;
 
-	// [xEuhXe[g
+	// 深度・ブレンドステートを初期化
 	static bool initialized = false;
 	if (initialized) return;
 	initialized = true;
@@ -600,55 +600,55 @@ void Renderer::EnsureCommonStates()
 	ID3D11Device* device = m_Device.Get();
 	assert(device);
 
-	// [xXe[gONi[xeXg݂sj
+	// 深度ステートON（深度テスト＆書き込みを行う）
 	{
 		D3D11_DEPTH_STENCIL_DESC dsOn{};
-		dsOn.DepthEnable	  = TRUE;							  // [xeXgL
-		dsOn.DepthWriteMask   = D3D11_DEPTH_WRITE_MASK_ALL;		  // [xobt@ւ̏ON
-		dsOn.DepthFunc		  = D3D11_COMPARISON_LESS_EQUAL;	  // OȂ`iZj
-		dsOn.StencilEnable    = FALSE;							  // XeV͍͖iVhEA}XN̂ƂɎgpj
-		dsOn.StencilReadMask  = D3D11_DEFAULT_STENCIL_READ_MASK;  // ftHg
-		dsOn.StencilWriteMask = D3D11_DEFAULT_STENCIL_WRITE_MASK; // ftHg
+		dsOn.DepthEnable	  = TRUE;							  // 深度テストを有効
+		dsOn.DepthWriteMask   = D3D11_DEPTH_WRITE_MASK_ALL;		  // 深度バッファへの書き込みON
+		dsOn.DepthFunc		  = D3D11_COMPARISON_LESS_EQUAL;	  // 手前なら描画（Zが小さい方）
+		dsOn.StencilEnable    = FALSE;							  // ステンシルは今回は無効（シャドウ、マスクのときに使用）
+		dsOn.StencilReadMask  = D3D11_DEFAULT_STENCIL_READ_MASK;  // デフォルト
+		dsOn.StencilWriteMask = D3D11_DEFAULT_STENCIL_WRITE_MASK; // デフォルト
 		HRESULT hr = device->CreateDepthStencilState(&dsOn, m_DepthStateEnable.GetAddressOf());
 		assert(SUCCEEDED(hr));
 	}
-	// [xXe[gOFFi[xeXg͂邪݂͂Ȃj
+	// 深度ステートOFF（深度テストはするが書き込みはしない）
 	{
 		D3D11_DEPTH_STENCIL_DESC dsOff{};
 		dsOff.DepthEnable	   = TRUE;
-		dsOff.DepthWriteMask   = D3D11_DEPTH_WRITE_MASK_ZERO;      // [xobt@ւ݂̏~߂
-		dsOff.DepthFunc		   = D3D11_COMPARISON_LESS_EQUAL;	   // OȂ`iZj
-		dsOff.StencilEnable	   = FALSE;							   // XeV͍͖iVhEA}XN̂ƂɎgpj
-		dsOff.StencilReadMask  = D3D11_DEFAULT_STENCIL_READ_MASK;  // ftHg
-		dsOff.StencilWriteMask = D3D11_DEFAULT_STENCIL_WRITE_MASK; // ftHg
+		dsOff.DepthWriteMask   = D3D11_DEPTH_WRITE_MASK_ZERO;      // 深度バッファへの書き込みを止める
+		dsOff.DepthFunc		   = D3D11_COMPARISON_LESS_EQUAL;	   // 手前なら描画（Zが小さい方）
+		dsOff.StencilEnable	   = FALSE;							   // ステンシルは今回は無効（シャドウ、マスクのときに使用）
+		dsOff.StencilReadMask  = D3D11_DEFAULT_STENCIL_READ_MASK;  // デフォルト
+		dsOff.StencilWriteMask = D3D11_DEFAULT_STENCIL_WRITE_MASK; // デフォルト
 		HRESULT hr = device->CreateDepthStencilState(&dsOff, m_DepthStateDisable.GetAddressOf());
 		assert(SUCCEEDED(hr));
 	}
 
-	// ʏuhiWuhj
+	// 通常ブレンド（標準αブレンド）
 	{
 		D3D11_BLEND_DESC bd{};
-		bd.AlphaToCoverageEnable = FALSE;  // }`TvÕ}XN𖳌
-		bd.IndependentBlendEnable = FALSE; // RTɌʐݒ肵ȂiP̂݁j
+		bd.AlphaToCoverageEnable = FALSE;  // マルチサンプリング時のαマスクを無効
+		bd.IndependentBlendEnable = FALSE; // 複数RTに個別設定しない（１枚のみ）
 		auto& rt = bd.RenderTarget[0];
-		rt.BlendEnable			 = TRUE; // uhL
-		rt.SrcBlend				 = D3D11_BLEND_SRC_ALPHA;	  // \[XFo̓
-		rt.DestBlend			 = D3D11_BLEND_INV_SRC_ALPHA; // fXeBl[V
-		rt.BlendOp				 = D3D11_BLEND_OP_ADD;		  // FuhFZ
-		rt.SrcBlendAlpha		 = D3D11_BLEND_ONE;			  // uhî܂܁j
-		rt.DestBlendAlpha		 = D3D11_BLEND_ZERO;		  // uhiej
-		rt.BlendOpAlpha			 = D3D11_BLEND_OP_ADD;		  // uhFZ
-		rt.RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL; // RGBA Sď
+		rt.BlendEnable			 = TRUE; // ブレンドを有効
+		rt.SrcBlend				 = D3D11_BLEND_SRC_ALPHA;	  // ソース：出力α
+		rt.DestBlend			 = D3D11_BLEND_INV_SRC_ALPHA; // デスティネーション
+		rt.BlendOp				 = D3D11_BLEND_OP_ADD;		  // 色ブレンド：加算
+		rt.SrcBlendAlpha		 = D3D11_BLEND_ONE;			  // αブレンド（そのまま）
+		rt.DestBlendAlpha		 = D3D11_BLEND_ZERO;		  // αブレンド（無影響）
+		rt.BlendOpAlpha			 = D3D11_BLEND_OP_ADD;		  // αブレンド：加算
+		rt.RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL; // RGBA 全て書き込み
 		HRESULT hr = device->CreateBlendState(&bd, m_BlendState.GetAddressOf());
 		assert(SUCCEEDED(hr));
 
-		// AlphaToCoverage t
+		// AlphaToCoverage 付き
 		bd.AlphaToCoverageEnable = TRUE;
 		hr = device->CreateBlendState(&bd, m_BlendStateATC.GetAddressOf());
 		assert(SUCCEEDED(hr));
 	}
 
-	// 胉X^CU
+	// 既定ラスタライザ
 	{
 		D3D11_RASTERIZER_DESC rd{};
 		rd.FillMode				 = D3D11_FILL_SOLID;
@@ -665,7 +665,7 @@ void Renderer::EnsureCommonStates()
 		HRESULT hr = device->CreateRasterizerState(&rd, m_RasterizerStateDefault.GetAddressOf());
 		assert(SUCCEEDED(hr));
 	}
-	// Tv[Xe[gݒ
+	// サンプラーステート設定
 	{
 		if (!m_SamplerLinearWrap)
 		{
@@ -710,7 +710,7 @@ void Renderer::SetBlendState(BlendMode mode)
 	case BlendMode::Additive:	   bs = m_BS_Add.Get();		 break;
 	case BlendMode::Multiply:	   bs = m_BS_Multiply.Get(); break;
 	}
-	static  const FLOAT blendFactor[4] = { 1, 1, 1, 1 }; // BLEND_FACTOR gĂȂ̂ł܂gp
+	static  const FLOAT blendFactor[4] = { 1, 1, 1, 1 }; // BLEND_FACTOR を使っていないのでまだ未使用
 	DeviceContext()->OMSetBlendState(bs, nullptr, 0xFFFFFFFF);
 }
 void Renderer::SetDepthState(DepthMode mode, UINT stencilRef)
@@ -725,7 +725,7 @@ void Renderer::SetDepthState(DepthMode mode, UINT stencilRef)
 	case DepthMode::OutlineLE:		ds = m_DS_OutlineLE.Get();		break;
 	case DepthMode::DisableDepth:	ds = m_DS_Disable.Get();		break;
 	}
-	DeviceContext()->OMSetDepthStencilState(ds, stencilRef); // Ref ̓XeVgɈӖ
+	DeviceContext()->OMSetDepthStencilState(ds, stencilRef); // Ref はステンシル使う時に意味ある
 }
 void Renderer::SetRasterizerState(RasterizerMode mode)
 {
@@ -743,7 +743,7 @@ void Renderer::SetRasterizerState(RasterizerMode mode)
 
 void Renderer::CreateVertexShader(ID3D11VertexShader** VertexShader, ID3D11InputLayout** VertexLayout, const char* FileName, VertexLayoutType layoutType)
 {
-	// t@Cl[T
+	// ファイルネームから探す
 	FILE* file = fopen(FileName, "rb");
 	assert(file);
 	long int fsize = _filelength(_fileno(file));
@@ -753,7 +753,7 @@ void Renderer::CreateVertexShader(ID3D11VertexShader** VertexShader, ID3D11Input
 
 	m_Device->CreateVertexShader(buffer.get(), fsize, NULL, VertexShader);
 
-	// CAEgݒ
+	// レイアウト設定
 	std::vector<D3D11_INPUT_ELEMENT_DESC> layoutDesc;
 	if (layoutType == VertexLayoutType::Basic)
 	{
@@ -1,7 +1,7 @@
 /*
 	Renderer.h
 	20251006  hanaue sho
-	GPU֏𑗂oH
+	GPUへ情報を送る経路
 */
 #ifndef RENDERER_H_
 #define RENDERER_H_
@@ -17,7 +17,7 @@ using Microsoft::WRL::ComPtr;
 class DebugRenderer;
 
 // ==================================================
-// ----- _\́iMeshֈړj -----
+// ----- 頂点情報構造体（いずれはMeshへ移動） -----
 // ==================================================
 struct VERTEX_3D
 {
@@ -31,75 +31,75 @@ struct VERTEX_SKINNED
 	Vector3 position;
 	Vector3 normal;
 	Vector2 texcoord;
-	uint8_t boneIndex[4];  // S{܂őΉ
-	float   boneWeight[4]; // EFCg
+	uint8_t boneIndex[4];  // ４本まで対応
+	float   boneWeight[4]; // ウェイト
 };
 
 // ==================================================
-// ----- AvP[Vň\ -----
-//  16byte ɍ킹Kv͂Ȃ
+// ----- アプリケーション側で扱う構造体 -----
+// ※こちらは 16byte に合わせる必要はない
 // ==================================================
 // --------------------------------------------------
-// }eA
+// マテリアル情報
 // --------------------------------------------------
 struct MaterialApp
 {
-	Vector4	ambient;  // 
-	Vector4	diffuse;  // gU 
-	Vector4	specular; // ʌ
-	Vector4	emission; // Ȕ
-	float	shininess = 32.0f; // x
-	int		textureEnable = 1; // eNX`L
+	Vector4	ambient;  // 環境光
+	Vector4	diffuse;  // 拡散光 
+	Vector4	specular; // 鏡面光
+	Vector4	emission; // 自己発光
+	float	shininess = 32.0f; // 光沢度
+	int		textureEnable = 1; // テクスチャ有効
 };
 // --------------------------------------------------
-// Cg
+// ライト情報
 // --------------------------------------------------
 struct LightApp
 {
-	int		enable = 0; // CgLtO
-	Vector4	direction;	// Cg
-	Vector4	diffuse;	// gU
-	Vector4	ambient;	// 
+	int		enable = 0; // ライト有効フラグ
+	Vector4	direction;	// ライト方向
+	Vector4	diffuse;	// 拡散光
+	Vector4	ambient;	// 環境光
 };
 struct PointLightApp
 {
-	Vector3	position;	// 
-	Vector3	diffuse;	// gU
-	float range = 10;	// 
-	float intensity = 1.0f; // x
+	Vector3	position;	// 環境光
+	Vector3	diffuse;	// 拡散光
+	float range = 10;	// 距離
+	float intensity = 1.0f; // 光沢度
 };
 // --------------------------------------------------
-// gD[
+// トゥーン情報
 // --------------------------------------------------
 struct ToonApp
 {
-	float ToonThreshold01; // E臒liÁj
-	float ToonThreshold12; // E臒lij
-	float ToonSmooth01; // ÊڂiÁj
-	float ToonSmooth12; // Êڂij
-	// eĩeBgialbedoɊ|Fj
+	float ToonThreshold01; // 境界閾値（暗→中）
+	float ToonThreshold12; // 境界閾値（中→明）
+	float ToonSmooth01; // 境界のぼかし幅（暗→中）
+	float ToonSmooth12; // 境界のぼかし幅（中→明）
+	// 各段のティント（albedoに掛ける色）
 	Vector3 ToonTintDark; 
 	Vector3 ToonTintMid;  
 	Vector3 ToonTintLit;  
-	// nCCg
+	// ハイライト線
 	float ToonSpecThreshold;
 	float ToonSpecStrength;
-	// ȅ㏑
-	Vector3 ToonShadowOverrideColor; // ㏑F
-	float   ToonShadowOverrideRate;  // 0:gȂA1:S㏑i㏑j
-	float	ToonShadowDesaturate;	 // 0:̂܂܁A1:SmNiEFj
-	float   ToonShadowAlbedoRate;	 // 0:͗lgȂA1: ͗l
+	// 影部分の上書き処理
+	Vector3 ToonShadowOverrideColor; // 上書きする色
+	float   ToonShadowOverrideRate;  // 0:使わない、1:完全上書き（上書き率）
+	float	ToonShadowDesaturate;	 // 0:そのまま、1:完全モノクロ（脱色）
+	float   ToonShadowAlbedoRate;	 // 0:模様を使わない、1: 模様つかう
 };
 // --------------------------------------------------
-// JCg
+// カメラライト情報
 // --------------------------------------------------
 struct CameraLightApp
 {
-	Vector4	direction;	// Cg
-	Vector4	diffuse;	// gU
+	Vector4	direction;	// ライト方向
+	Vector4	diffuse;	// 拡散光
 };
 // --------------------------------------------------
-// AEgC
+// アウトライン情報
 // --------------------------------------------------
 struct OutlineApp
 {
@@ -107,7 +107,7 @@ struct OutlineApp
 	Vector3 outlineColor;
 };
 // --------------------------------------------------
-// XvCg
+// スプライト情報
 // --------------------------------------------------
 struct SpriteApp
 {
@@ -117,32 +117,32 @@ struct SpriteApp
 };
 
 // ==================================================
-// ----- GPU֑萔obt@\ -----
-//  cbufferƕт킹
+// ----- GPU側へ送る定数バッファ構造体 -----
+// ※ cbufferと並びを合わせる
 // ==================================================
 // --------------------------------------------------
-// Jobt@iOj
+// カメラバッファ（ｂ０）
 // --------------------------------------------------
 struct alignas(16) CameraCB
 {
-	float view[16];		// view s
-	float proj[16];		// projection s
-	float viewProj[16];	// ViewProjection s
-	float cameraPos[3]; // Jʒu
+	float view[16];		// view 行列
+	float proj[16];		// projection 行列
+	float viewProj[16];	// ViewProjection 行列
+	float cameraPos[3]; // カメラ位置
 	float fov;			// FovY
-	float screenSize[2];	// ʃTCY
-	float invScreenSize[2]; // tʃTCY
+	float screenSize[2];	// 画面サイズ
+	float invScreenSize[2]; // 逆画面サイズ
 };
 // --------------------------------------------------
-// IuWFNgobt@iPj
+// オブジェクトバッファ（ｂ１）
 // --------------------------------------------------
 struct alignas(16) ObjectCB
 {
-	float world[16];	// [hs
-	float worldInv[16]; // @ϊp
+	float world[16];	// ワールド行列
+	float worldInv[16]; // 法線変換用
 };
 // --------------------------------------------------
-// }eAobt@iQj
+// マテリアルバッファ（ｂ２）
 // --------------------------------------------------
 struct alignas(16) MaterialCB
 {
@@ -152,10 +152,10 @@ struct alignas(16) MaterialCB
 	float emission[4];
 	float shininess;
 	int   textureEnable;
-	float _padMat0[2]; // 16byte AC
+	float _padMat0[2]; // 16byte アライン調整
 };
 // --------------------------------------------------
-// Cgobt@iRj
+// ライトバッファ（ｂ３）
 // --------------------------------------------------
 struct alignas(16) LightCB
 {
@@ -165,10 +165,10 @@ struct alignas(16) LightCB
 	int   enable; int _padL0[3];
 };
 // --------------------------------------------------
-// |CgCgobt@iSj
-// ̃|CgCg̃obt@֓
+// ポイントライトバッファ（ｂ４）
+// 複数のポイントライトを一つのバッファへ入れる
 // --------------------------------------------------
-static const int MAX_POINT = 64; // i킹Kv̂ŒӁIj
+static const int MAX_POINT = 64; // 上限（ここも合わせる必要があるので注意！）
 struct PointLightData
 {
 	float positionRange[4];
@@ -181,31 +181,31 @@ struct alignas(16) PointLightsCB
 	int _padPL0[3];
 };
 // --------------------------------------------------
-// gD[obt@iTj
+// トゥーンバッファ（ｂ５）
 // --------------------------------------------------
 struct alignas(16) ToonCB
 {
-	// E臒lAڂ
-	float ToonThreshold01; // E臒liÁj
-	float ToonThreshold12; // E臒lij
-	float ToonSmooth01; // ÊڂiÁj
-	float ToonSmooth12; // Êڂij
-	// eĩeBgialbedoɊ|Fj
+	// 境界閾値、ぼかし幅
+	float ToonThreshold01; // 境界閾値（暗→中）
+	float ToonThreshold12; // 境界閾値（中→明）
+	float ToonSmooth01; // 境界のぼかし幅（暗→中）
+	float ToonSmooth12; // 境界のぼかし幅（中→明）
+	// 各段のティント（albedoに掛ける色）
 	float ToonTintDark[3]; float _padT0;
 	float ToonTintMid[3];  float _padT1;
 	float ToonTintLit[3];  float _padT2;
-	// nCCg
+	// ハイライト線
 	float ToonSpecThreshold;
 	float ToonSpecStrength;
 	float _padT3[2];
-	// ȅ㏑
-	float ToonShadowOverrideColor[3]; float _padT4; // ㏑F
-	float ToonShadowOverrideRate; // 0:gȂA1:S㏑i㏑j
-	float ToonShadowDesaturate;   // 0:̂܂܁A1:SmNiEFj
-	float ToonShadowAlbedoRate;	 // 0:͗lgȂA1: ͗l
+	// 影部分の上書き処理
+	float ToonShadowOverrideColor[3]; float _padT4; // 上書きする色
+	float ToonShadowOverrideRate; // 0:使わない、1:完全上書き（上書き率）
+	float ToonShadowDesaturate;   // 0:そのまま、1:完全モノクロ（脱色）
+	float ToonShadowAlbedoRate;	 // 0:模様を使わない、1: 模様つかう
 };
 // --------------------------------------------------
-// JCgobt@iUj
+// カメラライトバッファ（ｂ６）
 // --------------------------------------------------
 struct alignas(16) CameraLightCB
 {
@@ -213,7 +213,7 @@ struct alignas(16) CameraLightCB
 	float diffuse[4];
 };
 // --------------------------------------------------
-// AEgCobt@iVj
+// アウトラインバッファ（ｂ７）
 // --------------------------------------------------
 struct alignas(16) OutlineCB
 {
@@ -221,7 +221,7 @@ struct alignas(16) OutlineCB
 	float outlineColor[3];
 };
 // --------------------------------------------------
-// |CgCgCfbNXobt@iWj
+// ポイントライトインデックスバッファ（ｂ８）
 // --------------------------------------------------
 struct alignas(16) PointLightIndexesCB
 {
@@ -230,9 +230,9 @@ struct alignas(16) PointLightIndexesCB
 	float _padPLI[3];
 };
 // --------------------------------------------------
-// XLobt@iXj
+// スキンバッファ（ｂ９）
 // --------------------------------------------------
-static const int MAX_MATRIX = 128; // i킹Kv̂ŒӁIj
+static const int MAX_MATRIX = 128; // 上限（ここも合わせる必要があるので注意！）
 struct alignas(16) SkinCB
 {
 	Matrix4x4 BoneMatrixes[MAX_MATRIX];
@@ -240,16 +240,16 @@ struct alignas(16) SkinCB
 	int       _padS[3];
 };
 // --------------------------------------------------
-// XvCgobt@iPOj
+// スプライトバッファ（ｂ１０）
 // --------------------------------------------------
 struct alignas(16) SpriteCB
 {
 	float spriteUV_OS[4]; // xy = uvOffset, zw = uvScale
-	float spriteColor[4]; // J[
+	float spriteColor[4]; // カラー
 };
 
 // ==================================================
-// ----- AC̃Y`FbN -----
+// ----- アラインのズレチェック -----
 // ==================================================
 static_assert(sizeof(CameraCB) % 16 == 0, "CameraCB size misaligned");
 static_assert(sizeof(ObjectCB) % 16 == 0, "ObjectCB size misaligned");
@@ -264,29 +264,29 @@ static_assert(sizeof(SkinCB)   % 16 == 0, "SkinCB size misaligned");
 static_assert(sizeof(SpriteCB)   % 16 == 0, "SpriteCB size misaligned");
 
 // ==================================================
-// ----- Renderer NX -----
+// ----- Renderer クラス -----
 // ==================================================
 class Renderer
 {
 public:
 	// ==================================================
-	// ----- 񋓑 -----
+	// ----- 列挙体 -----
 	// ==================================================
 	// --------------------------------------------------
-	// uh[h
+	// ブレンドモード
 	// --------------------------------------------------
 	enum class BlendMode { Opaque, Alpha, Premultiplied, Additive, Multiply};
 	enum class DepthMode 
 	{ 
-		Opaque,  // si[xXVj
-		Transparent,   // i[xXVj
-		ZPrepassWrite, // yvPpX
-		ZEqualReadOnly, // yvQpX
-		OutlineLE, // AEgCAo`
-		DisableDepth, // fobOAʌʂȂǁi[xj
+		Opaque,  // 不透明（深度情報更新）
+		Transparent,   // 半透明（深度情報非更新）
+		ZPrepassWrite, // Ｚプリ１パス目
+		ZEqualReadOnly, // Ｚプリ２パス目
+		OutlineLE, // アウトライン、押し出し描画
+		DisableDepth, // デバッグ、画面効果など（深度無効）
 	};
 	// --------------------------------------------------
-	// CvbgCAEg[h
+	// インプットレイアウトモード
 	// --------------------------------------------------
 	enum class VertexLayoutType
 	{
@@ -294,26 +294,26 @@ public:
 		Skinned, // VERTEX_SKINNED
 	};
 	// --------------------------------------------------
-	// X^CU[h
+	// ラスタライザモード
 	// --------------------------------------------------
 	enum class RasterizerMode
 	{
-		BackCullSolid,  // ʏ
-		FrontCullSolid, // 
-		NoneCullSolid,  // 
-		WireFrame,		// C[t[
-		ShadowCaster,   // VhE}bvp
+		BackCullSolid,  // 通常
+		FrontCullSolid, // 裏側
+		NoneCullSolid,  // 両面
+		WireFrame,		// ワイヤーフレーム
+		ShadowCaster,   // シャドウマップ用
 	};
 
 private:
 	// ==================================================
-	// ----- DirectX RAIuWFNg -----
+	// ----- DirectX コアオブジェクト -----
 	// ==================================================
 	static ComPtr<ID3D11Device>           m_Device;
 	static ComPtr<ID3D11DeviceContext>    m_DeviceContext;
 
 	// ==================================================
-	// ----- 萔obt@ -----
+	// ----- 定数バッファ -----
 	// ==================================================
 	static ComPtr<ID3D11Buffer> m_CB_Camera;      // b0
 	static ComPtr<ID3D11Buffer>	m_CB_Object;      // b1
@@ -328,7 +328,7 @@ private:
 	static ComPtr<ID3D11Buffer>	m_CB_Sprite;	  // b10
 
 	// ==================================================
-	// ----- uhEfvXXeV -----
+	// ----- ブレンド・デプスステンシル -----
 	// ==================================================
 	static ComPtr<ID3D11DepthStencilState> m_DepthStateEnable;
 	static ComPtr<ID3D11DepthStencilState> m_DepthStateDisable;
@@ -338,7 +338,7 @@ private:
 	static ComPtr<ID3D11SamplerState>	   m_SamplerLinearWrap;
 
 	// ==================================================
-	// ----- uhEfvXXeVXe[g -----
+	// ----- ブレンド・デプスステンシルステート -----
 	// ==================================================
 	static ComPtr<ID3D11BlendState> m_BS_Opaque;
 	static ComPtr<ID3D11BlendState> m_BS_Alpha;
@@ -353,7 +353,7 @@ private:
 	static ComPtr<ID3D11DepthStencilState> m_DS_Disable;		
 
 	// ==================================================
-	// ----- X^CUXe[g -----
+	// ----- ラスタライザステート -----
 	// ==================================================
 	static ComPtr<ID3D11RasterizerState> m_RS_BackCull;
 	static ComPtr<ID3D11RasterizerState> m_RS_FrontCull;
@@ -362,30 +362,30 @@ private:
 	static ComPtr<ID3D11RasterizerState> m_RS_ShadowCaster;
 
 	// ==================================================
-	// fobO_[
+	// デバッグレンダラー
 	// ==================================================
 	static DebugRenderer* m_pDebugRenderer;
 
 	// ==================================================
-	// @UuiIɎgj@
+	// ※　一旦放置（将来的に使う）　※
 	// ==================================================
 	static D3D_FEATURE_LEVEL       m_FeatureLevel;
 
 public:
 	// ==================================================
-	// ----- EI -----
+	// ----- 初期化・終了処理 -----
 	// ==================================================
 	static void Init(ID3D11Device* dev,	ID3D11DeviceContext* ctx);
 	static void Uninit();
 
 	// ==================================================
-	// ----- t[ -----
+	// ----- フレーム制御 -----
 	// ==================================================
 	static void BeginFrame(const float clearColor[4]);
 	static void EndFrame(int vsync = 1);
 
 	// ==================================================
-	// ----- eݒ -----
+	// ----- 各種設定 -----
 	// ==================================================
 	static void SetCamera(const Matrix4x4& view,
 						  const Matrix4x4& proj,
@@ -413,28 +413,28 @@ public:
 	static ID3D11SamplerState* DefaultLinearWrapSampler() { return m_SamplerLinearWrap.Get(); }
 
 	// --------------------------------------------------
-	// uhXe[gA[xݒ
+	// ブレンドステート、深度設定
 	// --------------------------------------------------
 	static void SetBlendState(BlendMode mode);
 	static void SetDepthState(DepthMode mode, UINT stencilRef = 0);
 	static void SetRasterizerState(RasterizerMode mode);
 
 	// ==================================================
-	// ----- DirectX̊b擾 -----
+	// ----- DirectXの基礎取得 -----
 	// ==================================================
 	static ID3D11Device*		Device( void ){ return m_Device.Get(); }
 	static ID3D11DeviceContext* DeviceContext( void ){ return m_DeviceContext.Get(); }
 
 	// ==================================================
-	// fobO_[
+	// デバッグレンダラー
 	// ==================================================
 	static DebugRenderer* GetDebugRenderer() { return m_pDebugRenderer; }
 private:
 	// ==================================================
-	// ----- [eBeB -----
+	// ----- 内部ユーティリティ -----
 	// ==================================================
 	// --------------------------------------------------
-	// 萔obt@쐬
+	// 定数バッファ作成
 	// --------------------------------------------------
 	template<class T>
 	static ComPtr<ID3D11Buffer> CreateCB();
@@ -460,7 +460,7 @@ private:
 	static SpriteCB   BuildSpriteCB(const SpriteApp& sprite);
 
 	// --------------------------------------------------
-	// uhXe[g쐬
+	// ブレンドステート作成
 	// --------------------------------------------------
 	static void CreateBlendStates();
 	static ComPtr<ID3D11BlendState> MakeBS(ID3D11Device* dev, 
@@ -470,7 +470,7 @@ private:
 										   UINT8 writeMask = D3D11_COLOR_WRITE_ENABLE_ALL
 										  );
 	// --------------------------------------------------
-	// fvXXeVXe[g쐬
+	// デプスステンシルステート作成
 	// --------------------------------------------------
 	static void CreateDepthStates();
 	static ComPtr<ID3D11DepthStencilState> MakeDS(
@@ -486,7 +486,7 @@ private:
 												  D3D11_STENCIL_OP zfailOp = D3D11_STENCIL_OP_KEEP
 												 );
 	// --------------------------------------------------
-	// X^CUXe[g쐬
+	// ラスタライザステート作成
 	// --------------------------------------------------
 	static void CreateRasterizerStates();
 	static ComPtr<ID3D11RasterizerState> MakeRS(
@@ -505,13 +505,13 @@ private:
 
 
 
-	// ʃXe[g̒xi[x^uh^X^CUj
+	// 共通ステートの遅延初期化（深度／ブレンド／ラスタライザ）
 	static void EnsureCommonStates();
 };
 
 
 // ==================================================
-// ----- \̃vZbg -----
+// ----- 構造体プリセット -----
 // ==================================================
 enum class ToonPreset
 {
@@ -530,15 +530,15 @@ inline ToonApp MakeToon(ToonPreset p)
 			toon.ToonThreshold12 = 0.30f;
 			toon.ToonSmooth01 = 0.03f;
 			toon.ToonSmooth12 = 0.01f;
-			toon.ToonTintDark = { 0.15f, 0.20f, 0.30f }; // Â͐ۂ
-			toon.ToonTintMid = { 0.70f, 0.75f, 0.80f }; // ⊦F
-			toon.ToonTintLit = { 1.00f, 1.00f, 1.00f }; // Axĥ܂
+			toon.ToonTintDark = { 0.15f, 0.20f, 0.30f }; // 暗い部分は青っぽく
+			toon.ToonTintMid = { 0.70f, 0.75f, 0.80f }; // やや寒色寄り
+			toon.ToonTintLit = { 1.00f, 1.00f, 1.00f }; // アルベドそのまま
 			toon.ToonSpecThreshold = 0.95f;
 			toon.ToonSpecStrength = 1.0f;
 			toon.ToonShadowOverrideColor = { 0.25f, 0.30f, 0.45f };
-			toon.ToonShadowOverrideRate = 0.70f; // uh
-			toon.ToonShadowDesaturate = 0.60f;  // EF
-			toon.ToonShadowAlbedoRate = 0.0f; // eNX`
+			toon.ToonShadowOverrideRate = 0.70f; // ブレンド率
+			toon.ToonShadowDesaturate = 0.60f;  // 脱色率
+			toon.ToonShadowAlbedoRate = 0.0f; // テクスチャ率
 			return toon;
 		}
 	case ToonPreset::GravityRush2Like:
@@ -548,15 +548,15 @@ inline ToonApp MakeToon(ToonPreset p)
 			toon.ToonThreshold12 = 0.50f;
 			toon.ToonSmooth01 = 0.03f;
 			toon.ToonSmooth12 = 0.03f;
-			toon.ToonTintDark = { 0.45f, 0.50f, 0.60f }; // Â͐ۂ
-			toon.ToonTintMid = { 0.70f, 0.75f, 0.80f }; // ⊦F
-			toon.ToonTintLit = { 1.00f, 1.00f, 1.00f }; // Axĥ܂
+			toon.ToonTintDark = { 0.45f, 0.50f, 0.60f }; // 暗い部分は青っぽく
+			toon.ToonTintMid = { 0.70f, 0.75f, 0.80f }; // やや寒色寄り
+			toon.ToonTintLit = { 1.00f, 1.00f, 1.00f }; // アルベドそのまま
 			toon.ToonSpecThreshold = 0.95f;
 			toon.ToonSpecStrength = 1.0f;
 			toon.ToonShadowOverrideColor = { 0.00f, 0.00f, 0.00f };
-			toon.ToonShadowOverrideRate = 0.00f; // uhiOŏ㏑Ȃj
-			toon.ToonShadowDesaturate = 0.0f;  // EF
-			toon.ToonShadowAlbedoRate = 1.0f; // eNX`
+			toon.ToonShadowOverrideRate = 0.00f; // ブレンド率（０で上書きしない）
+			toon.ToonShadowDesaturate = 0.0f;  // 脱色率
+			toon.ToonShadowAlbedoRate = 1.0f; // テクスチャ率
 			return toon;
 		}
 	}
@@ -18,13 +18,13 @@
 #include "Keyboard.h"
 #include "DebugRenderer.h"
 
-Scene::~Scene() = default; // cpp Œ`ȂƃJ[G[o
+Scene::~Scene() = default; // cpp で定義しないとリンカーエラーが出る
 
 void Scene::Init()
 {
-	m_pPhysicsSystem.reset(new PhysicsSystem(*this)); // make_unique  deleter ɂ͎gȂ
+	m_pPhysicsSystem.reset(new PhysicsSystem(*this)); // make_unique は deleter には使えない
 	m_pPhysicsSystem->Init();
-	m_pLightManager.reset(new LightManager(*this)); // make_unique  deleter ɂ͎gȂ
+	m_pLightManager.reset(new LightManager(*this)); // make_unique は deleter には使えない
 	m_pLightManager->Init();
 	Texture::PreloadDirectory("assets\\texture", true);
 }
@@ -49,8 +49,8 @@ void Scene::Uninit()
 
 void Scene::Update(float dt)
 {
-	m_pLightManager->BeginFrameAndUploadAllLights(); // Cgi[
-	// IuWFNgXV
+	m_pLightManager->BeginFrameAndUploadAllLights(); // ライト情報を格納する
+	// オブジェクト更新処理
 	for (auto& gameObjectList : m_GameObjects)
 	{
 		for (auto* gameObject : gameObjectList)
@@ -59,8 +59,8 @@ void Scene::Update(float dt)
 				gameObject->Update(dt);
 		}
 	}
-	// IuWFNgj
-	for (auto& gameObjectList : m_GameObjects) // Qƌ^ȂƃoO
+	// オブジェクト破棄処理
+	for (auto& gameObjectList : m_GameObjects) // 参照型じゃないとバグるよ
 	{
 		gameObjectList.remove_if(
 			[](GameObject* object)
@@ -68,14 +68,14 @@ void Scene::Update(float dt)
 				if (object && object->IsDestroyRequested())
 				{
 					object->Uninit();
-					delete object; // L҂ delete
-					return true; // XgO
+					delete object; // 所有者が delete
+					return true; // リストから外す
 				}
 				return false;
 			});
 	}
 
-	// fobO؂ւ
+	// デバッグ切り替え
 	if (Keyboard_IsKeyDownTrigger(KK_D0))
 	{
 		m_IsDrawCollision = !m_IsDrawCollision;
@@ -88,6 +88,9 @@ void Scene::Update(float dt)
 
 void Scene::FixedUpdate(float fixedDt)
 {
+	// パイプライン実行では前のステップをここで待って Transform へ書き戻す（スクリプトの FixedUpdate は確定した姿勢を見る）
+	m_pPhysicsSystem->SyncStep();
+
 	for (auto& gameObjectList : m_GameObjects)
 	{
 		for (auto* gameObject : gameObjectList)
@@ -97,15 +100,15 @@ void Scene::FixedUpdate(float fixedDt)
 		}
 	}
 
-	// ----- ZPXebv -----
+	// ----- 物理演算を１ステップ -----
+	// パイプライン実行では Step 以降を物理スレッドへ渡し、Update / Draw と重ねる
 	m_pPhysicsSystem->BeginStep(fixedDt);
-	m_pPhysicsSystem->Step(fixedDt);
-	m_pPhysicsSystem->EndStep(fixedDt);
+	m_pPhysicsSystem->KickStep(fixedDt);
 }
 
 void Scene::Draw()
 {
-	// ----- CJ擾iRD^UIj -----
+	// ----- メインカメラ取得（３D／UI） -----
 	CameraComponent* camera3D = nullptr;
 	CameraComponent* cameraUI = nullptr;
 	auto cameras = GetGameObjects<Camera>();
@@ -113,7 +116,7 @@ void Scene::Draw()
 	{
 		if (!c) continue;
 		CameraComponent* cc = c->GetComponent<CameraComponent>();
-		if (!cc || !cc->IsMain()) continue; // JR|[lgĂȂ or CJȂ
+		if (!cc || !cc->IsMain()) continue; // カメラコンポーネントを持っていない or メインカメラじゃない
 
 		if (cc->IsModePerspective())
 			camera3D = cc;
@@ -121,7 +124,7 @@ void Scene::Draw()
 			cameraUI = cc;
 	}
 
-	// [x\[gp
+	// 深度ソート用
 	Vector3 cameraPos{}, cameraFwd{ 0, 0, 1 };
 	if (camera3D)
 	{
@@ -129,7 +132,7 @@ void Scene::Draw()
 		cameraFwd = camera3D->Owner()->GetComponent<TransformComponent>()->Forward().normalized();
 	}
 
-	// ----- `悷IuWFNg̍\ -----
+	// ----- 描画するオブジェクトの構造体 -----
 	struct DrawItem
 	{
 		MeshRendererComponent* mr = nullptr;
@@ -142,14 +145,14 @@ void Scene::Draw()
 		int order = 0;
 		bool onWorld = false;
 	};
-	std::vector<DrawItem> opaques;      // s
-	std::vector<DrawItem> transparents; // 
-	std::vector<UIDrawItem> uiSprites; // UIp
-	opaques.reserve(512);      // ̈m
-	transparents.reserve(512); // ̈m
+	std::vector<DrawItem> opaques;      // 不透明
+	std::vector<DrawItem> transparents; // 透明
+	std::vector<UIDrawItem> uiSprites; // UI用
+	opaques.reserve(512);      // 領域確保
+	transparents.reserve(512); // 領域確保
 	uiSprites.reserve(256);
 
-	// ----- `ΏۂW -----
+	// ----- 描画対象を収集 -----
 	for (auto& gameObjectList : m_GameObjects)
 	{
 		for (auto* gameObject : gameObjectList)
@@ -172,7 +175,7 @@ void Scene::Draw()
 			auto* tf = gameObject->GetComponent<TransformComponent>();
 			if (!mr || !mat || !tf) continue;
 
-			// Ő[xo
+			// 視線方向で深度を出す
 			float d = 0.0f;
 			if (camera3D)
 			{
@@ -186,47 +189,47 @@ void Scene::Draw()
 		}
 	}
 
-	// ----- \[g -----
-	// sF front-to-backidepthOj
+	// ----- ソート -----
+	// 不透明： front-to-back（小さいdepth＝手前から）
 	std::stable_sort(opaques.begin(), opaques.end(),
 		[](const DrawItem& a, const DrawItem& b) {return a.depth < b.depth; });
-	// F@back-to-fronti傫depthj
+	// 透明：　back-to-front（大きいdepth＝奥から）
 	std::stable_sort(transparents.begin(), transparents.end(),
 		[](const DrawItem& a, const DrawItem& b) {return a.depth > b.depth; });
-	// UIF@SR  Order 
+	// UI：　SR の Order 順
 	std::stable_sort(uiSprites.begin(), uiSprites.end(),
 		[](const UIDrawItem& a, const UIDrawItem& b) {return a.order < b.order; });
 
-	// ----- ` -----
-	// JZbgiRDԁj
+	// ----- 描画 -----
+	// カメラセット（３D空間）
 	if (camera3D)
 	{
 		auto* tf = camera3D->Owner()->GetComponent<TransformComponent>();
 		Vector3 pos = tf ? tf->Position() : Vector3();
 		Renderer::SetCamera(camera3D->View(), camera3D->Proj(), pos, camera3D->FovY(), SCREEN_WIDTH, SCREEN_HEIGHT);
 	}
-	// sidepthON, uhOFFj
+	// 不透明（depth書き込みON, ブレンドOFF）
 	Renderer::SetRasterizerState(Renderer::RasterizerMode::BackCullSolid);
 	Renderer::SetBlendState(Renderer::BlendMode::Opaque);
 	Renderer::SetDepthState(Renderer::DepthMode::Opaque);
 	for (auto& it : opaques) it.mr->DrawBase();
-	// sAEgC
+	// 不透明アウトライン
 	Renderer::SetRasterizerState(Renderer::RasterizerMode::FrontCullSolid);
 	Renderer::SetBlendState(Renderer::BlendMode::Opaque);
 	Renderer::SetDepthState(Renderer::DepthMode::OutlineLE);
 	for (auto& it : opaques) { it.mr->DrawOutline(); }
-	// idepthOFF, uhONj
+	// 透明（depth書き込みOFF推奨, ブレンドON）
 	Renderer::SetRasterizerState(Renderer::RasterizerMode::BackCullSolid);
 	Renderer::SetBlendState(Renderer::BlendMode::Premultiplied);
 	Renderer::SetDepthState(Renderer::DepthMode::Transparent);
 	for (auto& it : transparents) it.mr->DrawBase();
-	// [hUIifvXj
+	// ワールド空間UI（デプス無視）
 	Renderer::SetRasterizerState(Renderer::RasterizerMode::BackCullSolid);
 	Renderer::SetBlendState(Renderer::BlendMode::Premultiplied);
 	Renderer::SetDepthState(Renderer::DepthMode::DisableDepth);
 	for (auto& it : uiSprites) { if(it.onWorld) it.sr->DrawBase(); }
 
-	// fobO`
+	// デバッグ描画
 	if (m_IsDrawCollision)
 	{
 		auto* dr = Renderer::GetDebugRenderer();
@@ -238,14 +241,14 @@ void Scene::Draw()
 		m_pPhysicsSystem->DrawDebug(*dr);
 		dr->Flush();
 	}
-	// JZbgiUIj
+	// カメラセット（UI）
 	if (cameraUI)
 	{
 		auto* tf = cameraUI->Owner()->GetComponent<TransformComponent>();
 		Vector3 pos = tf ? tf->Position() : Vector3();
 		Renderer::SetCamera(cameraUI->View(), cameraUI->Proj(), pos, cameraUI->FovY(), SCREEN_WIDTH, SCREEN_HEIGHT);
 
-		// UI `
+		// UI 描画
 		Renderer::SetRasterizerState(Renderer::RasterizerMode::BackCullSolid);
 		Renderer::SetBlendState(Renderer::BlendMode::Premultiplied);
 		Renderer::SetDepthState(Renderer::DepthMode::DisableDepth);
@@ -21,9 +21,9 @@ struct LightManagerDeleter
 {
 	void operator()(LightManager*) noexcept;
 };
-// FǗ|C^̌^i T j
-// FjɌĂ΂폜֐iIuWFNgǰ^i Deleter j
-using PhysicsSystemPtr = std::unique_ptr<PhysicsSystem, PhysicsSystemDeleter>; // ȂƃJ[G[o
+// 第一引数：管理するポインタの型（ T ）
+// 第二引数：破棄時に呼ばれる削除関数（オブジェクト）の型（ Deleter ）
+using PhysicsSystemPtr = std::unique_ptr<PhysicsSystem, PhysicsSystemDeleter>; // こうしないとリンカーエラーが出る
 using LightManagerPtr  = std::unique_ptr<LightManager,  LightManagerDeleter>;
 
 class Scene
@@ -34,7 +34,7 @@ protected:
 	PhysicsSystemPtr m_pPhysicsSystem;
 	LightManagerPtr m_pLightManager;
 
-	// fobO֌W
+	// デバッグ関係
 	bool m_IsDrawCollision = false;
 	bool m_IsDrawCollisionInFront = false;
 
@@ -49,24 +49,24 @@ public:
 	virtual void Draw();
 
 
-	// Q[IuWFNg̓o^ -----
-	template < typename T > // ev[g
+	// ゲームオブジェクトの登録 -----
+	template < typename T > // テンプレート
 	T* AddGameObject(int layer)
 	{
-		//GameObject* go = new T(); // łłH
+		//GameObject* go = new T(); // こっちでできる？
 		T* go = new T();
-		//go->Init(); // Ȃ炱ŌĂł悢BLȂ߂lgĊOŌĂԂׂ
+		//go->Init(); // 引数無しならここで呼んでよい。引数有りなら戻り値を使って外で呼ぶべし
 		m_GameObjects[layer].push_back(go);
 
 		return go;
 	}
 	/*
-	ev[g͑p֎~
-	RpCɗŊ֐KviGameObject̔hHjpӂĂ邾B
-	Ȃ̂ŃRpC̎Ԃ̂Ŏgǂׂ͌
+	※テンプレートは多用禁止※
+	コンパイル時に裏で関数を必要数分（GameObjectの派生分？）用意しているだけ。
+	なのでコンパイルの時間が増えるので使いどころは限るべき
 	*/
 
-	// Q[IuWFNg̎擾i擪j -----
+	// ゲームオブジェクトの取得（先頭一つ） -----
 	template < typename T >
 	T* GetGameObject()
 	{
@@ -82,7 +82,7 @@ public:
 		return nullptr;
 	}
 
-	// Q[IuWFNg̎擾iSāj -----
+	// ゲームオブジェクトの取得（全て） -----
 	template < typename T >
 	std::vector<T*> GetGameObjects()
 	{